@@ -4,7 +4,9 @@ const char* DEFAULT_SYNTAX_C =
     "supported_api_styles = [\"functions\", \"free-form\"];\n"
     "supported_code_models = [\"goto_label\", \"loop_switch\", \"recursive_functions\"];\n"
     "supported_targets = [\"code\", \"dot\", \"skeleton\"];\n"
-    "supported_features = [\"nested_ifs\", \"bitmaps\", \"computed_gotos\", \"case_ranges\"];\n"
+    "supported_features = [\"nested_ifs\", \"bitmaps\", \"computed_gotos\", \"case_ranges\",\n"
+    "    \"collapse_chains\", \"simd_loops\", \"table_driven\", \"profile_gen\", \"keyword_lookup\",\n"
+    "    \"class_switch\"];\n"
     "\n"
     "semicolons = 1;\n"
     "implicit_bool_conversion = 1;\n"
@@ -65,9 +67,13 @@ const char* DEFAULT_SYNTAX_C =
     "conf:computed-gotos = 0;\n"
     "conf:computed-gotos:threshold = 9;\n"
     "conf:nested-ifs = 0;\n"
+    "conf:simd-loops = 0;\n"
+    "conf:table-driven = 0;\n"
+    "conf:profile-gen = 0;\n"
     "conf:case-insensitive = 0;\n"
     "conf:case-inverted = 0;\n"
     "conf:case-ranges = 0;\n"
+    "conf:collapse-chains = 0;\n"
     "conf:unsafe = 0;\n"
     "conf:monadic = 0;\n"
     "conf:encoding:ebcdic = 0;\n"
@@ -136,6 +142,7 @@ const char* DEFAULT_SYNTAX_C =
     "    dedent topindent \"};\" nl;\n"
     "code:array_global = code:array_local;\n"
     "code:array_elem = array \"[\" index \"]\";\n"
+    "code:char_index = \"(unsigned char)\" char;\n"
     "\n"
     "code:type_int = \"int\";\n"
     "code:type_uint = \"unsigned int\";\n"
@@ -382,4 +389,7 @@ const char* DEFAULT_SYNTAX_C =
     "        : (many\n"
     "            ? \"(\" limit \" - \" cursor \") < \" need\n"
     "            : limit \" <= \" cursor));\n"
+    "\n"
+    "code:cond_likely = \"__builtin_expect(\" cond \", 1)\";\n"
+    "code:cond_unlikely = \"__builtin_expect(\" cond \", 0)\";\n"
     ;
@@ -65,9 +65,13 @@ const char* DEFAULT_SYNTAX_OCAML =
     "conf:computed-gotos = 0;\n"
     "conf:computed-gotos:threshold = 9;\n"
     "conf:nested-ifs = 0;\n"
+    "conf:simd-loops = 0;\n"
+    "conf:table-driven = 0;\n"
+    "conf:profile-gen = 0;\n"
     "conf:case-insensitive = 0;\n"
     "conf:case-inverted = 0;\n"
     "conf:case-ranges = 1;\n"
+    "conf:collapse-chains = 0;\n"
     "conf:unsafe = 0;\n"
     "conf:monadic = 0;\n"
     "conf:encoding:ebcdic = 0;\n"
@@ -132,6 +136,7 @@ const char* DEFAULT_SYNTAX_OCAML =
     "// code:array_local\n"
     "// code:array_global\n"
     "code:array_elem = array \".(\" index \")\";\n"
+    "// code:char_index\n"
     "\n"
     "code:type_int = \"int\";\n"
     "code:type_uint = \"uint\";\n"
@@ -65,9 +65,13 @@ const char* DEFAULT_SYNTAX_RUST =
     "conf:computed-gotos = 0;\n"
     "conf:computed-gotos:threshold = 9;\n"
     "conf:nested-ifs = 0;\n"
+    "conf:simd-loops = 0;\n"
+    "conf:table-driven = 0;\n"
+    "conf:profile-gen = 0;\n"
     "conf:case-insensitive = 0;\n"
     "conf:case-inverted = 0;\n"
     "conf:case-ranges = 1;\n"
+    "conf:collapse-chains = 0;\n"
     "conf:unsafe = 1;\n"
     "conf:monadic = 0;\n"
     "conf:encoding:ebcdic = 0;\n"
@@ -136,6 +140,7 @@ const char* DEFAULT_SYNTAX_RUST =
     "// code:array_local\n"
     "// code:array_global\n"
     "code:array_elem = array \"[\" index \"]\";\n"
+    "// code:char_index\n"
     "\n"
     "code:type_int = \"isize\";\n"
     "code:type_uint = \"usize\";\n"
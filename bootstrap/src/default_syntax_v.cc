@@ -4,7 +4,7 @@ const char* DEFAULT_SYNTAX_V =
     "supported_api_styles = [\"free-form\"];\n"
     "supported_code_models = [\"goto_label\", \"loop_switch\", \"recursive_functions\"];\n"
     "supported_targets = [\"code\", \"dot\"];\n"
-    "supported_features = [\"nested_ifs\", \"bitmaps\", \"case_ranges\", \"unsafe\"];\n"
+    "supported_features = [\"nested_ifs\", \"bitmaps\", \"case_ranges\", \"unsafe\", \"class_switch\"];\n"
     "\n"
     "semicolons = 0;\n"
     "implicit_bool_conversion = 0;\n"
@@ -65,9 +65,13 @@ const char* DEFAULT_SYNTAX_V =
     "conf:computed-gotos = 0;\n"
     "conf:computed-gotos:threshold = 9;\n"
     "conf:nested-ifs = 0;\n"
+    "conf:simd-loops = 0;\n"
+    "conf:table-driven = 0;\n"
+    "conf:profile-gen = 0;\n"
     "conf:case-insensitive = 0;\n"
     "conf:case-inverted = 0;\n"
     "conf:case-ranges = 1;\n"
+    "conf:collapse-chains = 0;\n"
     "conf:unsafe = 0;\n"
     "conf:monadic = 0;\n"
     "conf:encoding:ebcdic = 0;\n"
@@ -135,6 +139,7 @@ const char* DEFAULT_SYNTAX_V =
     "    dedent topindent \"]\" nl;\n"
     "// code:array_global\n"
     "code:array_elem = array \"[\" index \"]\";\n"
+    "code:char_index = char;\n"
     "\n"
     "code:type_int = \"int\";\n"
     "code:type_uint = \"u32\";\n"
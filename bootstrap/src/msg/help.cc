@@ -21,11 +21,36 @@ const char* help =
 "        default for C), and custom is the generic API (the default for Go and\n"
 "        Rust).\n"
 "\n"
+"    --batch FILE\n"
+"\n"
+"        Compile many input files in one re2c process. Each non-empty line of\n"
+"        the manifest FILE (except for lines starting with #) has the form\n"
+"        INPUT OUTPUT [OPTIONS], with whitespace-separated fields. Every input\n"
+"        file is compiled with the command-line options followed by the\n"
+"        options on its line, and the output is the same as with a separate\n"
+"        re2c run. Files are compiled in parallel on -j threads (each file\n"
+"        uses one thread, unless it has its own -j option). Diagnostics for\n"
+"        each file are printed together in the order of the manifest, and\n"
+"        compilation continues after a failed file. Options that name output\n"
+"        files (--header, --depfile, --time-report) should be given per file.\n"
+"\n"
 "    --bit-vectors -b\n"
 "\n"
 "        Optimize conditional jumps using bit masks. This option implies\n"
 "        --nested-ifs.\n"
 "\n"
+"    --cache-dir DIR\n"
+"\n"
+"        Store the generated files in the cache directory DIR (which must\n"
+"        exist) and reuse them on subsequent runs with the same command-line\n"
+"        arguments, as long as the source file and all included files are\n"
+"        unchanged. The cache works on the level of files, not blocks: a\n"
+"        change in any block invalidates the whole file, because the code\n"
+"        generated for one block depends on the other blocks. The cache is\n"
+"        not used together with the generation date (which changes on every\n"
+"        run), if the output goes to stdout, with --skeleton, or if re2c\n"
+"        emits any warnings.\n"
+"\n"
 "    --case-insensitive\n"
 "\n"
 "        Treat single-quoted and double-quoted strings as case-insensitive.\n"
@@ -45,6 +70,30 @@ const char* help =
 "        time, although for some compilers like Tcc it also results in smaller\n"
 "        binary size. This option is supported only for C.\n"
 "\n"
+"    --class-switch\n"
+"\n"
+"        Switch on the equivalence class of the current character instead of the\n"
+"        character itself: each DFA gets a table yycc (or yycc_<cond> with\n"
+"        conditions) that maps code units to classes, and states that dispatch\n"
+"        with a switch statement use dense class numbers as case values. This\n"
+"        makes case lists shorter and lets the compiler generate jump tables,\n"
+"        which is useful with --loop-switch. Class switch is used only for code\n"
+"        units of 1 byte, and it is not supported with --recursive-functions.\n"
+"        The table is indexed with the current character converted to an\n"
+"        unsigned type (syntax template code:char_index). This option is\n"
+"        supported for C, D, Go and V.\n"
+"\n"
+"    --collapse-chains\n"
+"\n"
+"        Collapse chains of transitions on single characters (such as the ones\n"
+"        that match keywords) into a single comparison: re2c reads up to 8\n"
+"        characters at once, combines them into one integer and compares it\n"
+"        with the whole chain. If the comparison fails, the lexer falls back to\n"
+"        the usual per-character dispatch. Chains are collapsed only with the\n"
+"        default API, code units of 1 byte, and YYFILL enabled without the\n"
+"        end-of-input rule: the lexer may read up to YYMAXFILL characters ahead,\n"
+"        as allowed by the YYFILL checks. This option is supported only for C.\n"
+"\n"
 "    --computed-gotos -g\n"
 "\n"
 "        Optimize conditional jumps using non-standard \"computed goto\" extension\n"
@@ -88,6 +137,21 @@ const char* help =
 "        Unicode standard says that standalone surrogates are invalid, but real-\n"
 "        world libraries and programs behave in different ways.\n"
 "\n"
+"    --fast-path\n"
+"\n"
+"        Generate a second copy of every loop in the lexer (such as\n"
+"        identifiers, string literals and comments) that does not call YYFILL.\n"
+"        On entry to the loop the lexer checks if there are enough characters\n"
+"        in the buffer for the longest possible iteration; if so, it stays on\n"
+"        the fast path, otherwise it falls back to the usual code with YYFILL\n"
+"        calls. The fast path lets the C compiler keep the cursor in a\n"
+"        register, as there are no calls inside the loop. Only the YYFILL\n"
+"        calls are removed: the length check is still done on every iteration\n"
+"        of a loop and in the initial state, so the lexer does not become as\n"
+"        fast as one without YYFILL. This option works only with the default\n"
+"        goto/label code model, and it cannot be used with the end-of-input\n"
+"        rule $ or with --storable-state.\n"
+"\n"
 "    --flex-syntax -F\n"
 "\n"
 "        Partial support for Flex syntax: in this mode named definitions don't\n"
@@ -122,6 +186,13 @@ const char* help =
 "        (...) is capturing and (! ...) is non-capturing. With this option (!\n"
 "        ...) is capturing and (...) is non-capturing.\n"
 "\n"
+"    --jobs -j <N>\n"
+"\n"
+"        Construct DFAs for different conditions of a block in parallel, using\n"
+"        up to N threads (but no more than the number of hardware threads).\n"
+"        The generated code is the same as without this option. The default is\n"
+"        1 (no parallelism).\n"
+"\n"
 "    --lang <c | go | rust>\n"
 "\n"
 "        Specify the output language. Supported languages are C, Go and Rust.\n"
@@ -185,11 +256,68 @@ const char* help =
 "\n"
 "        Enable submatch extraction with POSIX-style capturing groups.\n"
 "\n"
+"    --profile-gen\n"
+"\n"
+"        Instrument the generated lexer with counters of DFA state visits,\n"
+"        transitions between states, rule matches, YYFILL calls and\n"
+"        backtracking to the last accepting state. The counters and a function\n"
+"        yyprofdump(FILE*) that writes non-zero counters to a file (one per\n"
+"        line, for example line12 trans 3 5 1024) are generated by the\n"
+"        /*!profile:re2c*/ directive, which should be placed before the\n"
+"        lexers. States are numbered independently of the code layout, so that\n"
+"        the profile can be mapped back to DFA states when the lexer is\n"
+"        regenerated. Collapsed chains, vectorized loops, computed gotos and\n"
+"        table-driven dispatch are disabled, as they go through several states\n"
+"        at once. This option is supported only for C.\n"
+"\n"
+"    --profile-use FILE\n"
+"\n"
+"        Use a profile written by a lexer generated with --profile-gen to\n"
+"        optimize the generated code. The lexer must be generated from the\n"
+"        same source file with the same options (except --profile-gen).\n"
+"        Counters that appear several times are added up, so profiles of\n"
+"        different runs can be concatenated. In goto/label mode hot states are\n"
+"        placed after their most frequent predecessors. Nested if statements\n"
+"        are balanced by execution counts rather than by the number of\n"
+"        ranges, and a state where one transition dominates is dispatched with\n"
+"        if statements rather than a switch. Conditions that were always true\n"
+"        or always false in the profile are wrapped in code:cond_likely and\n"
+"        code:cond_unlikely syntax configurations (for C they expand to\n"
+"        __builtin_expect; the other default syntax files do not define them,\n"
+"        as those languages have no portable branch hints).\n"
+"\n"
 "    --reusable -r\n"
 "\n"
 "        Deprecated since version 2.2 (reusable blocks are allowed by default\n"
 "        now).\n"
 "\n"
+"    --server\n"
+"\n"
+"        Run as a compile server: read requests from stdin, one per line, in\n"
+"        the same format as the entries of a --batch manifest, and answer each\n"
+"        request on stdout with a line ok|error DIAG_SIZE NFILES, followed by\n"
+"        the diagnostics and the generated files (each as a line SIZE PATH\n"
+"        followed by the file contents). The generated files are kept in\n"
+"        memory between requests, and a request with the same options and\n"
+"        unchanged input files (including the included ones) is answered\n"
+"        without recompilation, provided that it has --no-generation-date.\n"
+"        Like with --cache-dir, caching works on the level of files: if any\n"
+"        block of the source file changes, the whole file is recompiled.\n"
+"\n"
+"    --simd-loops\n"
+"\n"
+"        Generate vectorized loops for states that loop on themselves over a\n"
+"        large character class (such as identifiers, whitespace, string\n"
+"        literals and comments): the lexer skips 16 or 32 characters at once\n"
+"        (using SSE2 or AVX2 compare and movemask, or 64-bit words on other\n"
+"        targets) until it finds a character that exits the loop, and then\n"
+"        continues with the usual per-character dispatch. The loop code is\n"
+"        guarded by #if defined(__GNUC__) and requires a little-endian target,\n"
+"        so other compilers use the per-character code. Loops are generated\n"
+"        only with the default API and code units of 1 byte. Without the\n"
+"        end-of-input rule the loop relies on YYFILL checks, so it must be\n"
+"        enabled. This option is supported only for C.\n"
+"\n"
 "    --skeleton -S\n"
 "\n"
 "        Ignore user-defined interface code and generate a self-contained\n"
@@ -208,16 +336,56 @@ const char* help =
 "        primitives, and variables yych, yyaccept and state should be part of\n"
 "        the stored lexer state.\n"
 "\n"
+"    --table-driven\n"
+"\n"
+"        Generate a table-driven lexer: states that dispatch on the current\n"
+"        character look up the next state in a transition table indexed by the\n"
+"        state and the equivalence class of the character, instead of matching\n"
+"        the character in nested switch and if statements. Tables are shared by\n"
+"        all conditions in a block, the element type (unsigned char, short or\n"
+"        int) is chosen by the size of the tables, and states that have no code\n"
+"        of their own are run by a small interpreter in the default case of the\n"
+"        state switch. Only the transitions are in tables: final states with\n"
+"        rule actions, states that save or restore the backtracking position\n"
+"        and transitions with tag operations keep their own cases in the state\n"
+"        switch (there are no action or tag tables). The generated code is\n"
+"        much smaller and compiles much faster for very large lexers (such as\n"
+"        lexers with thousands of keywords or large Unicode classes), but the\n"
+"        tables take more space in the data section, and the lexer is usually\n"
+"        slower than the code that dispatches on characters directly. This\n"
+"        option implies --loop-switch and is supported only for C. It has no\n"
+"        effect on code units larger than 1 byte and with --debug-output.\n"
+"\n"
 "    --tags -T\n"
 "\n"
 "        Enable submatch extraction with tags.\n"
 "\n"
+"    --time-report FILE\n"
+"\n"
+"        Write a JSON report with wall and CPU time spent in each compilation\n"
+"        phase (per block and condition for the phases that construct DFA),\n"
+"        the size of intermediate automata, and the memory used by re2c\n"
+"        allocators at the end of each phase and at peak.\n"
+"\n"
 "    --ucs2 --wide-chars -w\n"
 "\n"
 "        Generate a lexer that reads UCS2-encoded input. re2c assumes that the\n"
 "        character range is 0 -- 0xFFFF and character size is 2 bytes. This\n"
 "        option implies --nested-ifs.\n"
 "\n"
+"    --unroll-loops <n>\n"
+"\n"
+"        Unroll the loops of states that loop to themselves on some characters\n"
+"        (such as identifiers, whitespace, string literals and comments) n\n"
+"        times (at most 16), so that the length of the remaining input is\n"
+"        checked once per n characters rather than on every character. The\n"
+"        YYFILL argument in the loop is increased by n - 1, and so is\n"
+"        YYMAXFILL. The default is zero (no unrolling). Unrolling is done on\n"
+"        the DFA, so it works in all code models and for all target languages.\n"
+"        It has no effect with the end-of-input rule $ or without YYFILL\n"
+"        checks. With --simd-loops only the loops that are not vectorized are\n"
+"        unrolled.\n"
+"\n"
 "    --utf8 --utf-8 -8\n"
 "\n"
 "        Generate a lexer that reads input in UTF-8 encoding. re2c assumes that\n"
@@ -307,13 +475,15 @@ const char* help =
 "        output can be converted to an image with the help of Graphviz (e.g.\n"
 "        something like dot -Tpng -odfa.png dfa.dot).\n"
 "\n"
-"    --dfa-minimization <moore | table>\n"
+"    --dfa-minimization <moore | table | hopcroft>\n"
 "\n"
 "        Internal option: DFA minimization algorithm used by re2c. The moore\n"
 "        option is the Moore algorithm (it is the default). The table option is\n"
-"        the \"table filling\" algorithm. Both algorithms should produce the same\n"
-"        DFA up to states relabeling; table filling is simpler and much slower\n"
-"        and serves as a reference implementation.\n"
+"        the \"table filling\" algorithm. The hopcroft option is the Hopcroft\n"
+"        partition refinement algorithm, which has better worst-case complexity\n"
+"        than Moore on large DFAs. All algorithms should produce the same DFA\n"
+"        up to states relabeling; table filling is simpler and much slower and\n"
+"        serves as a reference implementation.\n"
 "\n"
 "    --eager-skip\n"
 "\n"
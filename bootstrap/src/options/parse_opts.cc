@@ -1,6 +1,7 @@
-/* Generated by re2c 3.0 */
+/* Generated by re2c 3.1 */
 #line 1 "../src/options/parse_opts.re"
 #include <stddef.h>
+#include <stdint.h>
 #include <algorithm>
 #include <string>
 #include <vector>
@@ -12,6 +13,7 @@
 #include "src/msg/warn.h"
 #include "src/options/opt.h"
 #include "src/parse/input.h"
+#include "src/util/string_utils.h"
 
 namespace re2c {
 
@@ -38,49 +40,49 @@ LOCAL_NODISCARD(Ret parse_opts(Opt& opts, conopt_t& global, char** argv, Msg& ms
     char* YYCURSOR, *YYMARKER;
     Warn::option_t option;
 
-#line 45 "../src/options/parse_opts.re"
+#line 47 "../src/options/parse_opts.re"
 
 
 opt:
     if (!next (YYCURSOR, argv)) goto end;
 
-#line 48 "src/options/parse_opts.cc"
+#line 50 "src/options/parse_opts.cc"
 {
 	char yych;
 	unsigned int yyaccept = 0;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
 	};
 	yych = *YYCURSOR;
 	if (yych <= 0x00) goto yy1;
@@ -88,14 +90,12 @@ opt:
 	goto yy2;
 yy1:
 	++YYCURSOR;
-#line 50 "../src/options/parse_opts.re"
+#line 52 "../src/options/parse_opts.re"
 	{ RET_FAIL(error("bad option: %s", *argv)); }
-#line 94 "src/options/parse_opts.cc"
+#line 96 "src/options/parse_opts.cc"
 yy2:
 	yych = *++YYCURSOR;
-	if (yybm[0+yych] & 128) {
-		goto yy2;
-	}
+	if (yybm[0+yych] & 128) goto yy2;
 	goto yy4;
 yy3:
 	yych = *++YYCURSOR;
@@ -105,23 +105,23 @@ yy3:
 	} else {
 		if (yych == 'W') goto yy7;
 	}
-#line 64 "../src/options/parse_opts.re"
+#line 66 "../src/options/parse_opts.re"
 	{ goto opt_short; }
 #line 111 "src/options/parse_opts.cc"
 yy4:
 	++YYCURSOR;
-#line 62 "../src/options/parse_opts.re"
+#line 64 "../src/options/parse_opts.re"
 	{ CHECK_RET(set_source_file(global, *argv));     goto opt; }
 #line 116 "src/options/parse_opts.cc"
 yy5:
 	++YYCURSOR;
-#line 61 "../src/options/parse_opts.re"
+#line 63 "../src/options/parse_opts.re"
 	{ CHECK_RET(set_source_file(global, "<stdin>")); goto opt; }
 #line 121 "src/options/parse_opts.cc"
 yy6:
 	yych = *++YYCURSOR;
 	if (yych <= 0x00) goto yy9;
-#line 65 "../src/options/parse_opts.re"
+#line 67 "../src/options/parse_opts.re"
 	{ goto opt_long; }
 #line 127 "src/options/parse_opts.cc"
 yy7:
@@ -134,12 +134,12 @@ yy7:
 		if (yych == 'n') goto yy13;
 	}
 yy8:
-#line 69 "../src/options/parse_opts.re"
+#line 71 "../src/options/parse_opts.re"
 	{ option = Warn::W;        goto opt_warn; }
 #line 140 "src/options/parse_opts.cc"
 yy9:
 	++YYCURSOR;
-#line 52 "../src/options/parse_opts.re"
+#line 54 "../src/options/parse_opts.re"
 	{
         // the remaining args are non-options, so they must be input files (re2c expects exactly
         // one input file)
@@ -151,7 +151,7 @@ yy9:
 #line 152 "src/options/parse_opts.cc"
 yy10:
 	++YYCURSOR;
-#line 67 "../src/options/parse_opts.re"
+#line 69 "../src/options/parse_opts.re"
 	{ msg.warn.set_all();       goto opt; }
 #line 157 "src/options/parse_opts.cc"
 yy11:
@@ -159,11 +159,8 @@ yy11:
 	if (yych == 'r') goto yy14;
 yy12:
 	YYCURSOR = YYMARKER;
-	if (yyaccept == 0) {
-		goto yy8;
-	} else {
-		goto yy18;
-	}
+	if (yyaccept == 0) goto yy8;
+	else goto yy18;
 yy13:
 	yych = *++YYCURSOR;
 	if (yych == 'o') goto yy15;
@@ -185,9 +182,9 @@ yy17:
 	yych = *(YYMARKER = ++YYCURSOR);
 	if (yych == 'e') goto yy20;
 yy18:
-#line 70 "../src/options/parse_opts.re"
+#line 72 "../src/options/parse_opts.re"
 	{ option = Warn::WNO;      goto opt_warn; }
-#line 191 "src/options/parse_opts.cc"
+#line 188 "src/options/parse_opts.cc"
 yy19:
 	yych = *++YYCURSOR;
 	if (yych == 'r') goto yy21;
@@ -207,14 +204,14 @@ yy22:
 	goto yy12;
 yy23:
 	++YYCURSOR;
-#line 68 "../src/options/parse_opts.re"
+#line 70 "../src/options/parse_opts.re"
 	{ msg.warn.set_all_error(); goto opt; }
-#line 213 "src/options/parse_opts.cc"
+#line 210 "src/options/parse_opts.cc"
 yy24:
 	++YYCURSOR;
-#line 71 "../src/options/parse_opts.re"
+#line 73 "../src/options/parse_opts.re"
 	{ option = Warn::WERROR;   goto opt_warn; }
-#line 218 "src/options/parse_opts.cc"
+#line 215 "src/options/parse_opts.cc"
 yy25:
 	yych = *++YYCURSOR;
 	if (yych != 'o') goto yy12;
@@ -223,15 +220,15 @@ yy25:
 	yych = *++YYCURSOR;
 	if (yych != '-') goto yy12;
 	++YYCURSOR;
-#line 72 "../src/options/parse_opts.re"
+#line 74 "../src/options/parse_opts.re"
 	{ option = Warn::WNOERROR; goto opt_warn; }
-#line 229 "src/options/parse_opts.cc"
+#line 226 "src/options/parse_opts.cc"
 }
-#line 73 "../src/options/parse_opts.re"
+#line 75 "../src/options/parse_opts.re"
 
 
 opt_warn: 
-#line 235 "src/options/parse_opts.cc"
+#line 232 "src/options/parse_opts.cc"
 {
 	char yych;
 	yych = *YYCURSOR;
@@ -247,9 +244,9 @@ opt_warn:
 yy27:
 	++YYCURSOR;
 yy28:
-#line 76 "../src/options/parse_opts.re"
+#line 78 "../src/options/parse_opts.re"
 	{ RET_FAIL(error("bad warning: %s", *argv)); }
-#line 253 "src/options/parse_opts.cc"
+#line 250 "src/options/parse_opts.cc"
 yy29:
 	yych = *(YYMARKER = ++YYCURSOR);
 	if (yych == 'o') goto yy35;
@@ -729,9 +726,9 @@ yy147:
 	goto yy36;
 yy148:
 	++YYCURSOR;
-#line 82 "../src/options/parse_opts.re"
+#line 84 "../src/options/parse_opts.re"
 	{ msg.warn.set(Warn::SWAPPED_RANGE,          option); goto opt; }
-#line 735 "src/options/parse_opts.cc"
+#line 732 "src/options/parse_opts.cc"
 yy149:
 	yych = *++YYCURSOR;
 	if (yych == 'r') goto yy157;
@@ -774,14 +771,14 @@ yy158:
 	goto yy36;
 yy159:
 	++YYCURSOR;
-#line 85 "../src/options/parse_opts.re"
+#line 87 "../src/options/parse_opts.re"
 	{ msg.warn.set(Warn::USELESS_ESCAPE,         option); goto opt; }
-#line 780 "src/options/parse_opts.cc"
+#line 777 "src/options/parse_opts.cc"
 yy160:
 	++YYCURSOR;
-#line 78 "../src/options/parse_opts.re"
+#line 80 "../src/options/parse_opts.re"
 	{ msg.warn.set(Warn::CONDITION_ORDER,        option); goto opt; }
-#line 785 "src/options/parse_opts.cc"
+#line 782 "src/options/parse_opts.cc"
 yy161:
 	yych = *++YYCURSOR;
 	if (yych == 'c') goto yy167;
@@ -852,18 +849,18 @@ yy177:
 	goto yy36;
 yy178:
 	++YYCURSOR;
-#line 84 "../src/options/parse_opts.re"
+#line 86 "../src/options/parse_opts.re"
 	{ msg.warn.set(Warn::UNREACHABLE_RULES,      option); goto opt; }
-#line 858 "src/options/parse_opts.cc"
+#line 855 "src/options/parse_opts.cc"
 yy179:
 	yych = *++YYCURSOR;
 	if (yych == 's') goto yy184;
 	goto yy36;
 yy180:
 	++YYCURSOR;
-#line 80 "../src/options/parse_opts.re"
+#line 82 "../src/options/parse_opts.re"
 	{ msg.warn.set(Warn::MATCH_EMPTY_STRING,     option); goto opt; }
-#line 867 "src/options/parse_opts.cc"
+#line 864 "src/options/parse_opts.cc"
 yy181:
 	yych = *++YYCURSOR;
 	if (yych == 'g') goto yy185;
@@ -886,9 +883,9 @@ yy185:
 	goto yy36;
 yy186:
 	++YYCURSOR;
-#line 86 "../src/options/parse_opts.re"
+#line 88 "../src/options/parse_opts.re"
 	{ msg.warn.set(Warn::SENTINEL_IN_MIDRULE,    option); goto opt; }
-#line 892 "src/options/parse_opts.cc"
+#line 889 "src/options/parse_opts.cc"
 yy187:
 	yych = *++YYCURSOR;
 	if (yych == 'o') goto yy190;
@@ -907,27 +904,27 @@ yy190:
 	goto yy36;
 yy191:
 	++YYCURSOR;
-#line 79 "../src/options/parse_opts.re"
+#line 81 "../src/options/parse_opts.re"
 	{ msg.warn.set(Warn::EMPTY_CHARACTER_CLASS,  option); goto opt; }
-#line 913 "src/options/parse_opts.cc"
+#line 910 "src/options/parse_opts.cc"
 yy192:
 	++YYCURSOR;
-#line 81 "../src/options/parse_opts.re"
+#line 83 "../src/options/parse_opts.re"
 	{ msg.warn.set(Warn::NONDETERMINISTIC_TAGS,  option); goto opt; }
-#line 918 "src/options/parse_opts.cc"
+#line 915 "src/options/parse_opts.cc"
 yy193:
 	yych = *++YYCURSOR;
 	if (yych >= 0x01) goto yy36;
 	++YYCURSOR;
-#line 83 "../src/options/parse_opts.re"
+#line 85 "../src/options/parse_opts.re"
 	{ msg.warn.set(Warn::UNDEFINED_CONTROL_FLOW, option); goto opt; }
-#line 925 "src/options/parse_opts.cc"
+#line 922 "src/options/parse_opts.cc"
 }
-#line 87 "../src/options/parse_opts.re"
+#line 89 "../src/options/parse_opts.re"
 
 
 opt_short: 
-#line 931 "src/options/parse_opts.cc"
+#line 928 "src/options/parse_opts.cc"
 {
 	char yych;
 	yych = *YYCURSOR;
@@ -972,7 +969,7 @@ opt_short:
 			}
 		}
 	} else {
-		if (yych <= 'n') {
+		if (yych <= 'j') {
 			if (yych <= 'e') {
 				if (yych <= 'b') {
 					if (yych <= 'a') goto yy195;
@@ -989,3958 +986,4878 @@ opt_short:
 				} else {
 					if (yych <= 'h') goto yy198;
 					if (yych <= 'i') goto yy212;
-					goto yy195;
+					goto yy213;
 				}
 			}
 		} else {
-			if (yych <= 't') {
-				if (yych <= 'q') {
-					if (yych <= 'o') goto yy213;
-					goto yy195;
+			if (yych <= 's') {
+				if (yych <= 'o') {
+					if (yych <= 'n') goto yy195;
+					goto yy214;
 				} else {
-					if (yych <= 'r') goto yy214;
-					if (yych <= 's') goto yy215;
+					if (yych <= 'q') goto yy195;
+					if (yych <= 'r') goto yy215;
 					goto yy216;
 				}
 			} else {
 				if (yych <= 'v') {
-					if (yych <= 'u') goto yy217;
-					goto yy218;
+					if (yych <= 't') goto yy217;
+					if (yych <= 'u') goto yy218;
+					goto yy219;
 				} else {
-					if (yych <= 'w') goto yy219;
-					if (yych <= 'x') goto yy220;
+					if (yych <= 'w') goto yy220;
+					if (yych <= 'x') goto yy221;
 					goto yy195;
 				}
 			}
 		}
 	}
 	++YYCURSOR;
-#line 92 "../src/options/parse_opts.re"
+#line 94 "../src/options/parse_opts.re"
 	{ goto opt; }
-#line 1021 "src/options/parse_opts.cc"
+#line 1019 "src/options/parse_opts.cc"
 yy195:
 	++YYCURSOR;
-#line 90 "../src/options/parse_opts.re"
+#line 92 "../src/options/parse_opts.re"
 	{ RET_FAIL(error("bad short option: %s", *argv)); }
-#line 1026 "src/options/parse_opts.cc"
+#line 1024 "src/options/parse_opts.cc"
 yy196:
 	++YYCURSOR;
-#line 132 "../src/options/parse_opts.re"
+#line 137 "../src/options/parse_opts.re"
 	{ goto opt_short; }
-#line 1031 "src/options/parse_opts.cc"
+#line 1029 "src/options/parse_opts.cc"
 yy197:
 	++YYCURSOR;
-#line 114 "../src/options/parse_opts.re"
+#line 116 "../src/options/parse_opts.re"
 	{ opts.set_encoding(Enc::Type::UTF8, true);   goto opt_short; }
-#line 1036 "src/options/parse_opts.cc"
+#line 1034 "src/options/parse_opts.cc"
 yy198:
 	++YYCURSOR;
-#line 93 "../src/options/parse_opts.re"
+#line 95 "../src/options/parse_opts.re"
 	{ return usage(); }
-#line 1041 "src/options/parse_opts.cc"
+#line 1039 "src/options/parse_opts.cc"
 yy199:
 	++YYCURSOR;
-#line 98 "../src/options/parse_opts.re"
+#line 100 "../src/options/parse_opts.re"
 	{ global.set_target(Target::DOT);      goto opt_short; }
-#line 1046 "src/options/parse_opts.cc"
+#line 1044 "src/options/parse_opts.cc"
 yy200:
 	++YYCURSOR;
-#line 100 "../src/options/parse_opts.re"
+#line 102 "../src/options/parse_opts.re"
 	{ global.set_flex_syntax(true);        goto opt_short; }
-#line 1051 "src/options/parse_opts.cc"
+#line 1049 "src/options/parse_opts.cc"
 yy201:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy221;
-#line 123 "../src/options/parse_opts.re"
+	if (yych <= 0x00) goto yy222;
+#line 125 "../src/options/parse_opts.re"
 	{ *argv = YYCURSOR; goto opt_incpath; }
-#line 1057 "src/options/parse_opts.cc"
+#line 1055 "src/options/parse_opts.cc"
 yy202:
 	++YYCURSOR;
-#line 116 "../src/options/parse_opts.re"
+#line 118 "../src/options/parse_opts.re"
 	{
         opts.set_tags_posix_syntax(true);
         opts.set_tags_posix_semantics(true);
         goto opt_short;
     }
-#line 1066 "src/options/parse_opts.cc"
+#line 1064 "src/options/parse_opts.cc"
 yy203:
 	++YYCURSOR;
-#line 102 "../src/options/parse_opts.re"
+#line 104 "../src/options/parse_opts.re"
 	{ global.set_target(Target::SKELETON); goto opt_short; }
-#line 1071 "src/options/parse_opts.cc"
+#line 1069 "src/options/parse_opts.cc"
 yy204:
 	++YYCURSOR;
-#line 108 "../src/options/parse_opts.re"
+#line 110 "../src/options/parse_opts.re"
 	{ opts.set_tags(true);            goto opt_short; }
-#line 1076 "src/options/parse_opts.cc"
+#line 1074 "src/options/parse_opts.cc"
 yy205:
 	++YYCURSOR;
-#line 95 "../src/options/parse_opts.re"
+#line 97 "../src/options/parse_opts.re"
 	{ return vernum(); }
-#line 1081 "src/options/parse_opts.cc"
+#line 1079 "src/options/parse_opts.cc"
 yy206:
 	++YYCURSOR;
-#line 104 "../src/options/parse_opts.re"
+#line 106 "../src/options/parse_opts.re"
 	{ opts.set_bitmaps(true);         goto opt_short; }
-#line 1086 "src/options/parse_opts.cc"
+#line 1084 "src/options/parse_opts.cc"
 yy207:
 	++YYCURSOR;
-#line 97 "../src/options/parse_opts.re"
+#line 99 "../src/options/parse_opts.re"
 	{ global.set_start_conditions(true);   goto opt_short; }
-#line 1091 "src/options/parse_opts.cc"
+#line 1089 "src/options/parse_opts.cc"
 yy208:
 	++YYCURSOR;
-#line 105 "../src/options/parse_opts.re"
+#line 107 "../src/options/parse_opts.re"
 	{ opts.set_debug(true);           goto opt_short; }
-#line 1096 "src/options/parse_opts.cc"
+#line 1094 "src/options/parse_opts.cc"
 yy209:
 	++YYCURSOR;
-#line 110 "../src/options/parse_opts.re"
+#line 112 "../src/options/parse_opts.re"
 	{ opts.set_encoding(Enc::Type::EBCDIC, true); goto opt_short; }
-#line 1101 "src/options/parse_opts.cc"
+#line 1099 "src/options/parse_opts.cc"
 yy210:
 	++YYCURSOR;
-#line 99 "../src/options/parse_opts.re"
+#line 101 "../src/options/parse_opts.re"
 	{ global.set_storable_state(true);     goto opt_short; }
-#line 1106 "src/options/parse_opts.cc"
+#line 1104 "src/options/parse_opts.cc"
 yy211:
 	++YYCURSOR;
-#line 106 "../src/options/parse_opts.re"
+#line 108 "../src/options/parse_opts.re"
 	{ opts.set_computed_gotos(true);  goto opt_short; }
-#line 1111 "src/options/parse_opts.cc"
+#line 1109 "src/options/parse_opts.cc"
 yy212:
 	++YYCURSOR;
-#line 101 "../src/options/parse_opts.re"
+#line 103 "../src/options/parse_opts.re"
 	{ global.set_line_dirs(false);         goto opt_short; }
-#line 1116 "src/options/parse_opts.cc"
+#line 1114 "src/options/parse_opts.cc"
 yy213:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy222;
-#line 126 "../src/options/parse_opts.re"
-	{ *argv = YYCURSOR; goto opt_output; }
-#line 1122 "src/options/parse_opts.cc"
+	if (yych <= 0x00) goto yy223;
+#line 134 "../src/options/parse_opts.re"
+	{ *argv = YYCURSOR; goto opt_jobs; }
+#line 1120 "src/options/parse_opts.cc"
 yy214:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy224;
+#line 128 "../src/options/parse_opts.re"
+	{ *argv = YYCURSOR; goto opt_output; }
+#line 1126 "src/options/parse_opts.cc"
+yy215:
 	++YYCURSOR;
-#line 133 "../src/options/parse_opts.re"
+#line 138 "../src/options/parse_opts.re"
 	{ goto opt_short; }
-#line 1127 "src/options/parse_opts.cc"
-yy215:
+#line 1131 "src/options/parse_opts.cc"
+yy216:
 	++YYCURSOR;
-#line 107 "../src/options/parse_opts.re"
+#line 109 "../src/options/parse_opts.re"
 	{ opts.set_nested_ifs(true);      goto opt_short; }
-#line 1132 "src/options/parse_opts.cc"
-yy216:
+#line 1136 "src/options/parse_opts.cc"
+yy217:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy223;
-#line 129 "../src/options/parse_opts.re"
+	if (yych <= 0x00) goto yy225;
+#line 131 "../src/options/parse_opts.re"
 	{ *argv = YYCURSOR; goto opt_header; }
-#line 1138 "src/options/parse_opts.cc"
-yy217:
+#line 1142 "src/options/parse_opts.cc"
+yy218:
 	++YYCURSOR;
-#line 111 "../src/options/parse_opts.re"
+#line 113 "../src/options/parse_opts.re"
 	{ opts.set_encoding(Enc::Type::UTF32, true);  goto opt_short; }
-#line 1143 "src/options/parse_opts.cc"
-yy218:
+#line 1147 "src/options/parse_opts.cc"
+yy219:
 	++YYCURSOR;
-#line 94 "../src/options/parse_opts.re"
+#line 96 "../src/options/parse_opts.re"
 	{ return version(); }
-#line 1148 "src/options/parse_opts.cc"
-yy219:
+#line 1152 "src/options/parse_opts.cc"
+yy220:
 	++YYCURSOR;
-#line 112 "../src/options/parse_opts.re"
+#line 114 "../src/options/parse_opts.re"
 	{ opts.set_encoding(Enc::Type::UCS2, true);   goto opt_short; }
-#line 1153 "src/options/parse_opts.cc"
-yy220:
+#line 1157 "src/options/parse_opts.cc"
+yy221:
 	++YYCURSOR;
-#line 113 "../src/options/parse_opts.re"
+#line 115 "../src/options/parse_opts.re"
 	{ opts.set_encoding(Enc::Type::UTF16, true);  goto opt_short; }
-#line 1158 "src/options/parse_opts.cc"
-yy221:
+#line 1162 "src/options/parse_opts.cc"
+yy222:
 	++YYCURSOR;
-#line 122 "../src/options/parse_opts.re"
+#line 124 "../src/options/parse_opts.re"
 	{ NEXT_ARG("-I", opt_incpath); }
-#line 1163 "src/options/parse_opts.cc"
-yy222:
+#line 1167 "src/options/parse_opts.cc"
+yy223:
 	++YYCURSOR;
-#line 125 "../src/options/parse_opts.re"
+#line 133 "../src/options/parse_opts.re"
+	{ NEXT_ARG("-j, --jobs", opt_jobs); }
+#line 1172 "src/options/parse_opts.cc"
+yy224:
+	++YYCURSOR;
+#line 127 "../src/options/parse_opts.re"
 	{ NEXT_ARG("-o, --output", opt_output); }
-#line 1168 "src/options/parse_opts.cc"
-yy223:
+#line 1177 "src/options/parse_opts.cc"
+yy225:
 	++YYCURSOR;
-#line 128 "../src/options/parse_opts.re"
+#line 130 "../src/options/parse_opts.re"
 	{ NEXT_ARG("-t, --type-header", opt_header); }
-#line 1173 "src/options/parse_opts.cc"
+#line 1182 "src/options/parse_opts.cc"
 }
-#line 134 "../src/options/parse_opts.re"
+#line 139 "../src/options/parse_opts.re"
 
 
 opt_long: 
-#line 1179 "src/options/parse_opts.cc"
+#line 1188 "src/options/parse_opts.cc"
 {
 	char yych;
 	yych = *YYCURSOR;
 	switch (yych) {
-		case 'a': goto yy227;
-		case 'b': goto yy228;
-		case 'c': goto yy229;
-		case 'd': goto yy230;
-		case 'e': goto yy231;
-		case 'f': goto yy232;
-		case 'g': goto yy233;
-		case 'h': goto yy234;
-		case 'i': goto yy235;
-		case 'l': goto yy236;
-		case 'n': goto yy237;
-		case 'o': goto yy238;
-		case 'p': goto yy239;
-		case 'r': goto yy240;
-		case 's': goto yy241;
-		case 't': goto yy242;
-		case 'u': goto yy243;
-		case 'v': goto yy244;
-		case 'w': goto yy245;
-		default: goto yy225;
+		case 'a': goto yy229;
+		case 'b': goto yy230;
+		case 'c': goto yy231;
+		case 'd': goto yy232;
+		case 'e': goto yy233;
+		case 'f': goto yy234;
+		case 'g': goto yy235;
+		case 'h': goto yy236;
+		case 'i': goto yy237;
+		case 'j': goto yy238;
+		case 'l': goto yy239;
+		case 'n': goto yy240;
+		case 'o': goto yy241;
+		case 'p': goto yy242;
+		case 'r': goto yy243;
+		case 's': goto yy244;
+		case 't': goto yy245;
+		case 'u': goto yy246;
+		case 'v': goto yy247;
+		case 'w': goto yy248;
+		default: goto yy227;
 	}
-yy225:
-	++YYCURSOR;
-yy226:
-#line 137 "../src/options/parse_opts.re"
-	{ RET_FAIL(error("bad long option: %s", *argv)); }
-#line 1210 "src/options/parse_opts.cc"
 yy227:
-	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'p') goto yy246;
-	goto yy226;
+	++YYCURSOR;
 yy228:
-	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'i') goto yy248;
-	goto yy226;
+#line 142 "../src/options/parse_opts.re"
+	{ RET_FAIL(error("bad long option: %s", *argv)); }
+#line 1220 "src/options/parse_opts.cc"
 yy229:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy249;
-	if (yych == 'o') goto yy250;
-	goto yy226;
+	if (yych == 'p') goto yy249;
+	goto yy228;
 yy230:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych <= 'f') {
-		if (yych <= 'd') goto yy226;
-		if (yych <= 'e') goto yy251;
-		goto yy252;
-	} else {
-		if (yych == 'u') goto yy253;
-		goto yy226;
-	}
+	if (yych == 'a') goto yy251;
+	if (yych == 'i') goto yy252;
+	goto yy228;
 yy231:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych <= 'c') {
-		if (yych <= '`') goto yy226;
-		if (yych <= 'a') goto yy254;
-		if (yych <= 'b') goto yy255;
-		goto yy256;
+	if (yych <= 'k') {
+		if (yych == 'a') goto yy253;
+		goto yy228;
 	} else {
-		if (yych <= 'l') goto yy226;
-		if (yych <= 'm') goto yy257;
-		if (yych <= 'n') goto yy258;
-		goto yy226;
+		if (yych <= 'l') goto yy254;
+		if (yych == 'o') goto yy255;
+		goto yy228;
 	}
 yy232:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'i') goto yy259;
-	if (yych == 'l') goto yy260;
-	goto yy226;
+	if (yych <= 'f') {
+		if (yych <= 'd') goto yy228;
+		if (yych <= 'e') goto yy256;
+		goto yy257;
+	} else {
+		if (yych == 'u') goto yy258;
+		goto yy228;
+	}
 yy233:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'o') goto yy261;
-	goto yy226;
+	if (yych <= 'c') {
+		if (yych <= '`') goto yy228;
+		if (yych <= 'a') goto yy259;
+		if (yych <= 'b') goto yy260;
+		goto yy261;
+	} else {
+		if (yych <= 'l') goto yy228;
+		if (yych <= 'm') goto yy262;
+		if (yych <= 'n') goto yy263;
+		goto yy228;
+	}
 yy234:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'e') goto yy262;
-	goto yy226;
+	if (yych <= 'h') {
+		if (yych == 'a') goto yy264;
+		goto yy228;
+	} else {
+		if (yych <= 'i') goto yy265;
+		if (yych == 'l') goto yy266;
+		goto yy228;
+	}
 yy235:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'n') goto yy263;
-	goto yy226;
+	if (yych == 'o') goto yy267;
+	goto yy228;
 yy236:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych <= 'd') {
-		if (yych == 'a') goto yy264;
-		goto yy226;
-	} else {
-		if (yych <= 'e') goto yy265;
-		if (yych == 'o') goto yy266;
-		goto yy226;
-	}
+	if (yych == 'e') goto yy268;
+	goto yy228;
 yy237:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'e') goto yy267;
-	if (yych == 'o') goto yy268;
-	goto yy226;
+	if (yych == 'n') goto yy269;
+	goto yy228;
 yy238:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'u') goto yy269;
-	goto yy226;
+	if (yych == 'o') goto yy270;
+	goto yy228;
 yy239:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'o') goto yy270;
-	goto yy226;
+	if (yych <= 'd') {
+		if (yych == 'a') goto yy271;
+		goto yy228;
+	} else {
+		if (yych <= 'e') goto yy272;
+		if (yych == 'o') goto yy273;
+		goto yy228;
+	}
 yy240:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'e') goto yy271;
-	goto yy226;
+	if (yych == 'e') goto yy274;
+	if (yych == 'o') goto yy275;
+	goto yy228;
 yy241:
 	yych = *(YYMARKER = ++YYCURSOR);
-	switch (yych) {
-		case 'i': goto yy272;
-		case 'k': goto yy273;
-		case 't': goto yy274;
-		case 'y': goto yy275;
-		default: goto yy226;
-	}
+	if (yych == 'u') goto yy276;
+	goto yy228;
 yy242:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy276;
-	if (yych == 'y') goto yy277;
-	goto yy226;
+	if (yych == 'o') goto yy277;
+	if (yych == 'r') goto yy278;
+	goto yy228;
 yy243:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych <= 'm') {
-		if (yych == 'c') goto yy278;
-		goto yy226;
-	} else {
-		if (yych <= 'n') goto yy279;
-		if (yych == 't') goto yy280;
-		goto yy226;
-	}
+	if (yych == 'e') goto yy279;
+	goto yy228;
 yy244:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'e') goto yy281;
-	goto yy226;
+	switch (yych) {
+		case 'e': goto yy280;
+		case 'i': goto yy281;
+		case 'k': goto yy282;
+		case 't': goto yy283;
+		case 'y': goto yy284;
+		default: goto yy228;
+	}
 yy245:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'i') goto yy282;
-	goto yy226;
+	if (yych <= 'h') {
+		if (yych == 'a') goto yy285;
+		goto yy228;
+	} else {
+		if (yych <= 'i') goto yy286;
+		if (yych == 'y') goto yy287;
+		goto yy228;
+	}
 yy246:
-	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy283;
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yych <= 'm') {
+		if (yych == 'c') goto yy288;
+		goto yy228;
+	} else {
+		if (yych <= 'n') goto yy289;
+		if (yych == 't') goto yy290;
+		goto yy228;
+	}
 yy247:
-	YYCURSOR = YYMARKER;
-	goto yy226;
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yych == 'e') goto yy291;
+	goto yy228;
 yy248:
-	yych = *++YYCURSOR;
-	if (yych == 't') goto yy284;
-	goto yy247;
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yych == 'i') goto yy292;
+	goto yy228;
 yy249:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy285;
-	goto yy247;
+	if (yych == 'i') goto yy293;
 yy250:
-	yych = *++YYCURSOR;
-	if (yych <= 'l') goto yy247;
-	if (yych <= 'm') goto yy286;
-	if (yych <= 'n') goto yy287;
-	goto yy247;
+	YYCURSOR = YYMARKER;
+	goto yy228;
 yy251:
 	yych = *++YYCURSOR;
-	if (yych == 'b') goto yy288;
-	if (yych == 'p') goto yy289;
-	goto yy247;
+	if (yych == 't') goto yy294;
+	goto yy250;
 yy252:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy290;
-	goto yy247;
+	if (yych == 't') goto yy295;
+	goto yy250;
 yy253:
 	yych = *++YYCURSOR;
-	if (yych == 'm') goto yy291;
-	goto yy247;
+	if (yych == 'c') goto yy296;
+	if (yych == 's') goto yy297;
+	goto yy250;
 yy254:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy292;
-	goto yy247;
+	if (yych == 'a') goto yy298;
+	goto yy250;
 yy255:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy293;
-	goto yy247;
+	if (yych <= 'k') goto yy250;
+	if (yych <= 'l') goto yy299;
+	if (yych <= 'm') goto yy300;
+	if (yych <= 'n') goto yy301;
+	goto yy250;
 yy256:
 	yych = *++YYCURSOR;
-	if (yych == 'b') goto yy294;
-	goto yy247;
+	if (yych == 'b') goto yy302;
+	if (yych == 'p') goto yy303;
+	goto yy250;
 yy257:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy295;
-	if (yych == 'p') goto yy296;
-	goto yy247;
+	if (yych == 'a') goto yy304;
+	goto yy250;
 yy258:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy297;
-	goto yy247;
+	if (yych == 'm') goto yy305;
+	goto yy250;
 yy259:
 	yych = *++YYCURSOR;
-	if (yych == 'x') goto yy298;
-	goto yy247;
+	if (yych == 'g') goto yy306;
+	goto yy250;
 yy260:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy299;
-	goto yy247;
+	if (yych == 'c') goto yy307;
+	goto yy250;
 yy261:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy300;
-	goto yy247;
+	if (yych == 'b') goto yy308;
+	goto yy250;
 yy262:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy301;
-	if (yych == 'l') goto yy302;
-	goto yy247;
+	if (yych == 'i') goto yy309;
+	if (yych == 'p') goto yy310;
+	goto yy250;
 yy263:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy303;
-	if (yych == 'v') goto yy304;
-	goto yy247;
+	if (yych == 'c') goto yy311;
+	goto yy250;
 yy264:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy305;
-	goto yy247;
+	if (yych == 's') goto yy312;
+	goto yy250;
 yy265:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy306;
-	goto yy247;
+	if (yych == 'x') goto yy313;
+	goto yy250;
 yy266:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy307;
-	if (yych == 'o') goto yy308;
-	goto yy247;
+	if (yych == 'e') goto yy314;
+	goto yy250;
 yy267:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy309;
-	goto yy247;
+	if (yych == 't') goto yy315;
+	goto yy250;
 yy268:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy310;
-	goto yy247;
+	if (yych == 'a') goto yy316;
+	if (yych == 'l') goto yy317;
+	goto yy250;
 yy269:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy311;
-	goto yy247;
+	if (yych == 'p') goto yy318;
+	if (yych == 'v') goto yy319;
+	goto yy250;
 yy270:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy312;
-	goto yy247;
+	if (yych == 'b') goto yy320;
+	goto yy250;
 yy271:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy313;
-	if (yych == 'u') goto yy314;
-	goto yy247;
+	if (yych == 'n') goto yy321;
+	goto yy250;
 yy272:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy315;
-	goto yy247;
+	if (yych == 'f') goto yy322;
+	goto yy250;
 yy273:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy316;
-	goto yy247;
+	if (yych == 'c') goto yy323;
+	if (yych == 'o') goto yy324;
+	goto yy250;
 yy274:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy317;
-	if (yych == 'o') goto yy318;
-	goto yy247;
+	if (yych == 's') goto yy325;
+	goto yy250;
 yy275:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy319;
-	goto yy247;
+	if (yych == '-') goto yy326;
+	goto yy250;
 yy276:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy320;
-	goto yy247;
+	if (yych == 't') goto yy327;
+	goto yy250;
 yy277:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy321;
-	goto yy247;
+	if (yych == 's') goto yy328;
+	goto yy250;
 yy278:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy322;
-	goto yy247;
+	if (yych == 'o') goto yy329;
+	goto yy250;
 yy279:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy323;
-	goto yy247;
+	if (yych == 'c') goto yy330;
+	if (yych == 'u') goto yy331;
+	goto yy250;
 yy280:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy324;
-	goto yy247;
+	if (yych == 'r') goto yy332;
+	goto yy250;
 yy281:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy325;
-	goto yy247;
+	if (yych <= 'l') goto yy250;
+	if (yych <= 'm') goto yy333;
+	if (yych <= 'n') goto yy334;
+	goto yy250;
 yy282:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy326;
-	goto yy247;
+	if (yych == 'e') goto yy335;
+	goto yy250;
 yy283:
-	++YYCURSOR;
-#line 190 "../src/options/parse_opts.re"
-	{ NEXT_ARG("--api, --input",     opt_input); }
-#line 1482 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'a') goto yy336;
+	if (yych == 'o') goto yy337;
+	goto yy250;
 yy284:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy327;
-	goto yy247;
+	if (yych == 'n') goto yy338;
+	goto yy250;
 yy285:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy328;
-	goto yy247;
+	if (yych == 'b') goto yy339;
+	if (yych == 'g') goto yy340;
+	goto yy250;
 yy286:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy329;
-	goto yy247;
+	if (yych == 'm') goto yy341;
+	goto yy250;
 yy287:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy330;
-	goto yy247;
+	if (yych == 'p') goto yy342;
+	goto yy250;
 yy288:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy331;
-	goto yy247;
+	if (yych == 's') goto yy343;
+	goto yy250;
 yy289:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy332;
-	goto yy247;
+	if (yych == 'i') goto yy344;
+	if (yych == 'r') goto yy345;
+	goto yy250;
 yy290:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy333;
-	goto yy247;
+	if (yych == 'f') goto yy346;
+	goto yy250;
 yy291:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy334;
-	goto yy247;
+	if (yych == 'r') goto yy347;
+	goto yy250;
 yy292:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy335;
-	goto yy247;
+	if (yych == 'd') goto yy348;
+	goto yy250;
 yy293:
-	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy336;
-	goto yy247;
+	++YYCURSOR;
+#line 212 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--api, --input",     opt_input); }
+#line 1548 "src/options/parse_opts.cc"
 yy294:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy337;
-	goto yy247;
+	if (yych == 'c') goto yy349;
+	goto yy250;
 yy295:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy338;
-	goto yy247;
+	if (yych == '-') goto yy350;
+	goto yy250;
 yy296:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy339;
-	goto yy247;
+	if (yych == 'h') goto yy351;
+	goto yy250;
 yy297:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy340;
-	goto yy247;
+	if (yych == 'e') goto yy352;
+	goto yy250;
 yy298:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy341;
-	goto yy247;
+	if (yych == 's') goto yy353;
+	goto yy250;
 yy299:
 	yych = *++YYCURSOR;
-	if (yych == 'x') goto yy342;
-	goto yy247;
+	if (yych == 'l') goto yy354;
+	goto yy250;
 yy300:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy343;
-	goto yy247;
+	if (yych == 'p') goto yy355;
+	goto yy250;
 yy301:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy344;
-	goto yy247;
+	if (yych == 'd') goto yy356;
+	goto yy250;
 yy302:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy345;
-	goto yy247;
+	if (yych == 'u') goto yy357;
+	goto yy250;
 yy303:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy346;
-	goto yy247;
+	if (yych == 'f') goto yy358;
+	goto yy250;
 yy304:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy347;
-	goto yy247;
+	if (yych == '-') goto yy359;
+	goto yy250;
 yy305:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy348;
-	goto yy247;
+	if (yych == 'p') goto yy360;
+	goto yy250;
 yy306:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy349;
-	goto yy247;
+	if (yych == 'e') goto yy361;
+	goto yy250;
 yy307:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy350;
-	goto yy247;
+	if (yych == 'd') goto yy362;
+	goto yy250;
 yy308:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy351;
-	goto yy247;
+	if (yych <= 0x00) goto yy363;
+	goto yy250;
 yy309:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy352;
-	goto yy247;
+	if (yych == 't') goto yy364;
+	goto yy250;
 yy310:
 	yych = *++YYCURSOR;
-	switch (yych) {
-		case 'd': goto yy353;
-		case 'g': goto yy354;
-		case 'l': goto yy355;
-		case 'o': goto yy356;
-		case 'u': goto yy357;
-		case 'v': goto yy358;
-		default: goto yy247;
-	}
+	if (yych == 't') goto yy365;
+	goto yy250;
 yy311:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy359;
-	goto yy247;
+	if (yych == 'o') goto yy366;
+	goto yy250;
 yy312:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy360;
-	goto yy247;
+	if (yych == 't') goto yy367;
+	goto yy250;
 yy313:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy361;
-	goto yy247;
+	if (yych == 'e') goto yy368;
+	goto yy250;
 yy314:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy362;
-	goto yy247;
+	if (yych == 'x') goto yy369;
+	goto yy250;
 yy315:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy363;
-	goto yy247;
+	if (yych == 'o') goto yy370;
+	goto yy250;
 yy316:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy364;
-	goto yy247;
+	if (yych == 'd') goto yy371;
+	goto yy250;
 yy317:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy365;
-	if (yych == 'r') goto yy366;
-	goto yy247;
+	if (yych == 'p') goto yy372;
+	goto yy250;
 yy318:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy367;
-	goto yy247;
+	if (yych == 'u') goto yy373;
+	goto yy250;
 yy319:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy368;
-	goto yy247;
+	if (yych == 'e') goto yy374;
+	goto yy250;
 yy320:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy369;
-	goto yy247;
+	if (yych == 's') goto yy375;
+	goto yy250;
 yy321:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy370;
-	goto yy247;
+	if (yych == 'g') goto yy376;
+	goto yy250;
 yy322:
 	yych = *++YYCURSOR;
-	if (yych == '2') goto yy371;
-	goto yy247;
+	if (yych == 't') goto yy377;
+	goto yy250;
 yy323:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy372;
-	goto yy247;
+	if (yych == 'a') goto yy378;
+	goto yy250;
 yy324:
 	yych = *++YYCURSOR;
-	switch (yych) {
-		case '-': goto yy373;
-		case '1': goto yy374;
-		case '3': goto yy375;
-		case '8': goto yy376;
-		default: goto yy247;
-	}
+	if (yych == 'p') goto yy379;
+	goto yy250;
 yy325:
 	yych = *++YYCURSOR;
-	if (yych <= 'm') {
-		if (yych == 'b') goto yy377;
-		goto yy247;
-	} else {
-		if (yych <= 'n') goto yy378;
-		if (yych == 's') goto yy379;
-		goto yy247;
-	}
+	if (yych == 't') goto yy380;
+	goto yy250;
 yy326:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy380;
-	goto yy247;
+	switch (yych) {
+		case 'd': goto yy381;
+		case 'g': goto yy382;
+		case 'l': goto yy383;
+		case 'o': goto yy384;
+		case 'u': goto yy385;
+		case 'v': goto yy386;
+		default: goto yy250;
+	}
 yy327:
 	yych = *++YYCURSOR;
-	if (yych == 'v') goto yy381;
-	goto yy247;
+	if (yych == 'p') goto yy387;
+	goto yy250;
 yy328:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy382;
-	goto yy247;
+	if (yych == 'i') goto yy388;
+	goto yy250;
 yy329:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy383;
-	goto yy247;
+	if (yych == 'f') goto yy389;
+	goto yy250;
 yy330:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy384;
-	goto yy247;
+	if (yych == 'u') goto yy390;
+	goto yy250;
 yy331:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy385;
-	goto yy247;
+	if (yych == 's') goto yy391;
+	goto yy250;
 yy332:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy386;
-	goto yy247;
+	if (yych == 'v') goto yy392;
+	goto yy250;
 yy333:
 	yych = *++YYCURSOR;
-	if (yych == 'm') goto yy387;
-	goto yy247;
+	if (yych == 'd') goto yy393;
+	goto yy250;
 yy334:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy388;
-	goto yy247;
+	if (yych == 'g') goto yy394;
+	goto yy250;
 yy335:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy389;
-	goto yy247;
+	if (yych == 'l') goto yy395;
+	goto yy250;
 yy336:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy390;
-	goto yy247;
+	if (yych == 'd') goto yy396;
+	if (yych == 'r') goto yy397;
+	goto yy250;
 yy337:
-	++YYCURSOR;
-#line 168 "../src/options/parse_opts.re"
-	{ opts.set_encoding(Enc::Type::EBCDIC, true); goto opt; }
-#line 1718 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'r') goto yy398;
+	goto yy250;
 yy338:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy391;
-	goto yy247;
+	if (yych == 't') goto yy399;
+	goto yy250;
 yy339:
 	yych = *++YYCURSOR;
-	if (yych == 'y') goto yy392;
-	goto yy247;
+	if (yych == 'l') goto yy400;
+	goto yy250;
 yy340:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy393;
-	goto yy247;
+	if (yych == 's') goto yy401;
+	goto yy250;
 yy341:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy394;
-	goto yy247;
+	if (yych == 'e') goto yy402;
+	goto yy250;
 yy342:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy395;
-	goto yy247;
+	if (yych == 'e') goto yy403;
+	goto yy250;
 yy343:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy396;
-	goto yy247;
+	if (yych == '2') goto yy404;
+	goto yy250;
 yy344:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy397;
-	goto yy247;
+	if (yych == 'c') goto yy405;
+	goto yy250;
 yy345:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy398;
-	goto yy247;
+	if (yych == 'o') goto yy406;
+	goto yy250;
 yy346:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy399;
-	goto yy247;
+	switch (yych) {
+		case '-': goto yy407;
+		case '1': goto yy408;
+		case '3': goto yy409;
+		case '8': goto yy410;
+		default: goto yy250;
+	}
 yy347:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy400;
-	goto yy247;
+	if (yych <= 'm') {
+		if (yych == 'b') goto yy411;
+		goto yy250;
+	} else {
+		if (yych <= 'n') goto yy412;
+		if (yych == 's') goto yy413;
+		goto yy250;
+	}
 yy348:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy401;
-	goto yy247;
+	if (yych == 'e') goto yy414;
+	goto yy250;
 yy349:
 	yych = *++YYCURSOR;
-	if (yych == 'm') goto yy402;
-	goto yy247;
+	if (yych == 'h') goto yy415;
+	goto yy250;
 yy350:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy403;
-	goto yy247;
+	if (yych == 'v') goto yy416;
+	goto yy250;
 yy351:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy404;
-	goto yy247;
+	if (yych == 'e') goto yy417;
+	goto yy250;
 yy352:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy405;
-	goto yy247;
+	if (yych == '-') goto yy418;
+	goto yy250;
 yy353:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy406;
-	goto yy247;
+	if (yych == 's') goto yy419;
+	goto yy250;
 yy354:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy407;
-	goto yy247;
+	if (yych == 'a') goto yy420;
+	goto yy250;
 yy355:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy408;
-	goto yy247;
+	if (yych == 'u') goto yy421;
+	goto yy250;
 yy356:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy409;
-	goto yy247;
+	if (yych == 'i') goto yy422;
+	goto yy250;
 yy357:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy410;
-	goto yy247;
+	if (yych == 'g') goto yy423;
+	goto yy250;
 yy358:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy411;
-	goto yy247;
+	if (yych == 'i') goto yy424;
+	goto yy250;
 yy359:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy412;
-	goto yy247;
+	if (yych == 'm') goto yy425;
+	goto yy250;
 yy360:
 	yych = *++YYCURSOR;
-	if (yych == 'x') goto yy413;
-	goto yy247;
+	if (yych == '-') goto yy426;
+	goto yy250;
 yy361:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy414;
-	goto yy247;
+	if (yych == 'r') goto yy427;
+	goto yy250;
 yy362:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy415;
-	goto yy247;
+	if (yych == 'i') goto yy428;
+	goto yy250;
 yy363:
-	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy416;
-	goto yy247;
+	++YYCURSOR;
+#line 184 "../src/options/parse_opts.re"
+	{ opts.set_encoding(Enc::Type::EBCDIC, true); goto opt; }
+#line 1848 "src/options/parse_opts.cc"
 yy364:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy417;
-	goto yy247;
+	if (yych == '-') goto yy429;
+	goto yy250;
 yy365:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy418;
-	goto yy247;
+	if (yych == 'y') goto yy430;
+	goto yy250;
 yy366:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy419;
-	goto yy247;
+	if (yych == 'd') goto yy431;
+	goto yy250;
 yy367:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy420;
-	goto yy247;
+	if (yych == '-') goto yy432;
+	goto yy250;
 yy368:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy421;
-	goto yy247;
+	if (yych == 'd') goto yy433;
+	goto yy250;
 yy369:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy422;
-	goto yy247;
+	if (yych == '-') goto yy434;
+	goto yy250;
 yy370:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy423;
-	goto yy247;
+	if (yych == '-') goto yy435;
+	goto yy250;
 yy371:
-	++YYCURSOR;
-#line 170 "../src/options/parse_opts.re"
-	{ opts.set_encoding(Enc::Type::UCS2, true);   goto opt; }
-#line 1855 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy436;
+	goto yy250;
 yy372:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy424;
-	goto yy247;
+	if (yych <= 0x00) goto yy437;
+	goto yy250;
 yy373:
 	yych = *++YYCURSOR;
-	if (yych == '1') goto yy425;
-	if (yych == '8') goto yy426;
-	goto yy247;
+	if (yych == 't') goto yy438;
+	goto yy250;
 yy374:
 	yych = *++YYCURSOR;
-	if (yych == '6') goto yy427;
-	goto yy247;
+	if (yych == 'r') goto yy439;
+	goto yy250;
 yy375:
 	yych = *++YYCURSOR;
-	if (yych == '2') goto yy428;
-	goto yy247;
+	if (yych <= 0x00) goto yy440;
+	goto yy250;
 yy376:
-	++YYCURSOR;
-#line 172 "../src/options/parse_opts.re"
-	{ opts.set_encoding(Enc::Type::UTF8, true);   goto opt; }
-#line 1877 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy441;
+	goto yy250;
 yy377:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy429;
-	goto yy247;
+	if (yych == 'm') goto yy442;
+	goto yy250;
 yy378:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy430;
-	goto yy247;
+	if (yych == 't') goto yy443;
+	goto yy250;
 yy379:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy431;
-	goto yy247;
+	if (yych == '-') goto yy444;
+	goto yy250;
 yy380:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy432;
-	goto yy247;
+	if (yych == 'e') goto yy445;
+	goto yy250;
 yy381:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy433;
-	goto yy247;
+	if (yych == 'e') goto yy446;
+	goto yy250;
 yy382:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy434;
-	if (yych == 'r') goto yy435;
-	goto yy247;
+	if (yych == 'e') goto yy447;
+	goto yy250;
 yy383:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy436;
-	goto yy247;
+	if (yych == 'o') goto yy448;
+	goto yy250;
 yy384:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy437;
-	goto yy247;
+	if (yych == 'p') goto yy449;
+	goto yy250;
 yy385:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy438;
-	goto yy247;
+	if (yych == 'n') goto yy450;
+	goto yy250;
 yy386:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy439;
-	goto yy247;
+	if (yych == 'e') goto yy451;
+	goto yy250;
 yy387:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy440;
-	goto yy247;
+	if (yych == 'u') goto yy452;
+	goto yy250;
 yy388:
 	yych = *++YYCURSOR;
-	switch (yych) {
-		case 'a': goto yy441;
-		case 'c': goto yy442;
-		case 'd': goto yy443;
-		case 'i': goto yy444;
-		case 'n': goto yy445;
-		default: goto yy247;
-	}
+	if (yych == 'x') goto yy453;
+	goto yy250;
 yy389:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy446;
-	goto yy247;
+	if (yych == 'i') goto yy454;
+	goto yy250;
 yy390:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy337;
-	goto yy247;
+	if (yych == 'r') goto yy455;
+	goto yy250;
 yy391:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy447;
-	goto yy247;
+	if (yych == 'a') goto yy456;
+	goto yy250;
 yy392:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy448;
-	goto yy247;
+	if (yych == 'e') goto yy457;
+	goto yy250;
 yy393:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy449;
-	goto yy247;
+	if (yych == '-') goto yy458;
+	goto yy250;
 yy394:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy450;
-	goto yy247;
+	if (yych == 'l') goto yy459;
+	goto yy250;
 yy395:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy451;
-	goto yy247;
+	if (yych == 'e') goto yy460;
+	goto yy250;
 yy396:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy452;
-	goto yy247;
+	if (yych == 'f') goto yy461;
+	goto yy250;
 yy397:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy453;
-	goto yy247;
+	if (yych == 't') goto yy462;
+	goto yy250;
 yy398:
-	++YYCURSOR;
-#line 139 "../src/options/parse_opts.re"
-	{ return usage(); }
-#line 1973 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'a') goto yy463;
+	goto yy250;
 yy399:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy283;
-	if (yych == '-') goto yy454;
-	goto yy247;
+	if (yych == 'a') goto yy464;
+	goto yy250;
 yy400:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy455;
-	goto yy247;
+	if (yych == 'e') goto yy465;
+	goto yy250;
 yy401:
-	++YYCURSOR;
-#line 184 "../src/options/parse_opts.re"
-	{ NEXT_ARG("--lang",             opt_lang); }
-#line 1987 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy466;
+	goto yy250;
 yy402:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy456;
-	goto yy247;
+	if (yych == '-') goto yy467;
+	goto yy250;
 yy403:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy457;
-	goto yy247;
+	if (yych == '-') goto yy468;
+	goto yy250;
 yy404:
-	yych = *++YYCURSOR;
-	if (yych == 's') goto yy458;
-	goto yy247;
+	++YYCURSOR;
+#line 186 "../src/options/parse_opts.re"
+	{ opts.set_encoding(Enc::Type::UCS2, true);   goto opt; }
+#line 2013 "src/options/parse_opts.cc"
 yy405:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy459;
-	goto yy247;
+	if (yych == 'o') goto yy469;
+	goto yy250;
 yy406:
 	yych = *++YYCURSOR;
-	if (yych == 'b') goto yy460;
-	goto yy247;
+	if (yych == 'l') goto yy470;
+	goto yy250;
 yy407:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy461;
-	goto yy247;
+	if (yych == '1') goto yy471;
+	if (yych == '8') goto yy472;
+	goto yy250;
 yy408:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy462;
-	goto yy247;
+	if (yych == '6') goto yy473;
+	goto yy250;
 yy409:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy463;
-	goto yy247;
+	if (yych == '2') goto yy474;
+	goto yy250;
 yy410:
-	yych = *++YYCURSOR;
-	if (yych == 's') goto yy464;
-	goto yy247;
+	++YYCURSOR;
+#line 188 "../src/options/parse_opts.re"
+	{ opts.set_encoding(Enc::Type::UTF8, true);   goto opt; }
+#line 2039 "src/options/parse_opts.cc"
 yy411:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy465;
-	goto yy247;
+	if (yych == 'o') goto yy475;
+	goto yy250;
 yy412:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy466;
-	goto yy247;
+	if (yych == 'u') goto yy476;
+	goto yy250;
 yy413:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy467;
-	goto yy247;
+	if (yych == 'i') goto yy477;
+	goto yy250;
 yy414:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy468;
-	goto yy247;
+	if (yych == '-') goto yy478;
+	goto yy250;
 yy415:
 	yych = *++YYCURSOR;
-	if (yych == 'b') goto yy469;
-	goto yy247;
+	if (yych <= 0x00) goto yy479;
+	goto yy250;
 yy416:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy470;
-	goto yy247;
+	if (yych == 'e') goto yy480;
+	goto yy250;
 yy417:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy471;
-	goto yy247;
+	if (yych == '-') goto yy481;
+	goto yy250;
 yy418:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy472;
-	goto yy247;
+	if (yych == 'i') goto yy482;
+	if (yych == 'r') goto yy483;
+	goto yy250;
 yy419:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy473;
-	goto yy247;
+	if (yych == '-') goto yy484;
+	goto yy250;
 yy420:
 	yych = *++YYCURSOR;
-	if (yych == 'b') goto yy474;
-	goto yy247;
+	if (yych == 'p') goto yy485;
+	goto yy250;
 yy421:
 	yych = *++YYCURSOR;
-	if (yych == 'x') goto yy475;
-	goto yy247;
+	if (yych == 't') goto yy486;
+	goto yy250;
 yy422:
-	++YYCURSOR;
-#line 164 "../src/options/parse_opts.re"
-	{ opts.set_tags(true);               goto opt; }
-#line 2072 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy487;
+	goto yy250;
 yy423:
 	yych = *++YYCURSOR;
-	if (yych == 'h') goto yy476;
-	goto yy247;
+	if (yych == '-') goto yy488;
+	goto yy250;
 yy424:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy477;
-	goto yy247;
+	if (yych == 'l') goto yy489;
+	goto yy250;
 yy425:
 	yych = *++YYCURSOR;
-	if (yych == '6') goto yy478;
-	goto yy247;
+	if (yych == 'i') goto yy490;
+	goto yy250;
 yy426:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy376;
-	goto yy247;
+	switch (yych) {
+		case 'a': goto yy491;
+		case 'c': goto yy492;
+		case 'd': goto yy493;
+		case 'i': goto yy494;
+		case 'n': goto yy495;
+		default: goto yy250;
+	}
 yy427:
-	++YYCURSOR;
-#line 171 "../src/options/parse_opts.re"
-	{ opts.set_encoding(Enc::Type::UTF16, true);  goto opt; }
-#line 2093 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == '-') goto yy496;
+	goto yy250;
 yy428:
-	++YYCURSOR;
-#line 169 "../src/options/parse_opts.re"
-	{ opts.set_encoding(Enc::Type::UTF32, true);  goto opt; }
-#line 2098 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'c') goto yy363;
+	goto yy250;
 yy429:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy479;
-	goto yy247;
+	if (yych == 'd') goto yy497;
+	goto yy250;
 yy430:
 	yych = *++YYCURSOR;
-	if (yych == 'm') goto yy480;
-	goto yy247;
+	if (yych == '-') goto yy498;
+	goto yy250;
 yy431:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy481;
-	goto yy247;
+	if (yych == 'i') goto yy499;
+	goto yy250;
 yy432:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy482;
-	goto yy247;
+	if (yych == 'p') goto yy500;
+	goto yy250;
 yy433:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy483;
-	goto yy247;
+	if (yych == '-') goto yy501;
+	goto yy250;
 yy434:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy484;
-	goto yy247;
+	if (yych == 's') goto yy502;
+	goto yy250;
 yy435:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy485;
-	goto yy247;
+	if (yych == 'l') goto yy503;
+	goto yy250;
 yy436:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy486;
-	goto yy247;
+	if (yych == 'r') goto yy504;
+	goto yy250;
 yy437:
+	++YYCURSOR;
+#line 144 "../src/options/parse_opts.re"
+	{ return usage(); }
+#line 2155 "src/options/parse_opts.cc"
+yy438:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy487;
-	goto yy247;
-yy438:
-	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy488;
-	goto yy247;
+	if (yych <= 0x00) goto yy293;
+	if (yych == '-') goto yy505;
+	goto yy250;
 yy439:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy489;
-	goto yy247;
+	if (yych == 't') goto yy506;
+	goto yy250;
 yy440:
-	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy490;
-	goto yy247;
+	++YYCURSOR;
+#line 205 "../src/options/parse_opts.re"
+	{ NEXT_ARG("-j, --jobs",         opt_jobs); }
+#line 2169 "src/options/parse_opts.cc"
 yy441:
-	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy491;
-	goto yy247;
+	++YYCURSOR;
+#line 200 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--lang",             opt_lang); }
+#line 2174 "src/options/parse_opts.cc"
 yy442:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy492;
-	if (yych == 'l') goto yy493;
-	goto yy247;
+	if (yych == 'o') goto yy507;
+	goto yy250;
 yy443:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy494;
-	goto yy247;
+	if (yych == 'i') goto yy508;
+	goto yy250;
 yy444:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy495;
-	goto yy247;
+	if (yych == 's') goto yy509;
+	goto yy250;
 yy445:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy496;
-	goto yy247;
+	if (yych == 'd') goto yy510;
+	goto yy250;
 yy446:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy497;
-	goto yy247;
+	if (yych == 'b') goto yy511;
+	goto yy250;
 yy447:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy498;
-	goto yy247;
+	if (yych == 'n') goto yy512;
+	goto yy250;
 yy448:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy499;
-	goto yy247;
+	if (yych == 'o') goto yy513;
+	goto yy250;
 yy449:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy500;
-	goto yy247;
+	if (yych == 't') goto yy514;
+	goto yy250;
 yy450:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy501;
-	goto yy247;
+	if (yych == 's') goto yy515;
+	goto yy250;
 yy451:
 	yych = *++YYCURSOR;
-	if (yych == 'y') goto yy502;
-	goto yy247;
+	if (yych == 'r') goto yy516;
+	goto yy250;
 yy452:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy503;
-	goto yy247;
+	if (yych == 't') goto yy517;
+	goto yy250;
 yy453:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy504;
-	goto yy247;
+	if (yych == '-') goto yy518;
+	goto yy250;
 yy454:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy505;
-	goto yy247;
+	if (yych == 'l') goto yy519;
+	goto yy250;
 yy455:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy506;
-	goto yy247;
+	if (yych == 's') goto yy520;
+	goto yy250;
 yy456:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy507;
-	goto yy247;
+	if (yych == 'b') goto yy521;
+	goto yy250;
 yy457:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy508;
-	goto yy247;
+	if (yych == 'r') goto yy522;
+	goto yy250;
 yy458:
 	yych = *++YYCURSOR;
-	if (yych == 'w') goto yy509;
-	goto yy247;
+	if (yych == 'l') goto yy523;
+	goto yy250;
 yy459:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy510;
-	goto yy247;
+	if (yych == 'e') goto yy524;
+	goto yy250;
 yy460:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy511;
-	goto yy247;
+	if (yych == 't') goto yy525;
+	goto yy250;
 yy461:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy512;
-	goto yy247;
+	if (yych == 'a') goto yy526;
+	goto yy250;
 yy462:
 	yych = *++YYCURSOR;
-	if (yych == 'k') goto yy513;
-	goto yy247;
+	if (yych == '-') goto yy527;
+	goto yy250;
 yy463:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy514;
-	goto yy247;
+	if (yych == 'b') goto yy528;
+	goto yy250;
 yy464:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy515;
-	goto yy247;
+	if (yych == 'x') goto yy529;
+	goto yy250;
 yy465:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy516;
-	goto yy247;
+	if (yych == '-') goto yy530;
+	goto yy250;
 yy466:
-	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy517;
-	goto yy247;
+	++YYCURSOR;
+#line 180 "../src/options/parse_opts.re"
+	{ opts.set_tags(true);               goto opt; }
+#line 2275 "src/options/parse_opts.cc"
 yy467:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy518;
-	if (yych == 'p') goto yy519;
-	goto yy247;
+	if (yych == 'r') goto yy531;
+	goto yy250;
 yy468:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy520;
-	goto yy247;
+	if (yych == 'h') goto yy532;
+	goto yy250;
 yy469:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy521;
-	goto yy247;
+	if (yych == 'd') goto yy533;
+	goto yy250;
 yy470:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy522;
-	goto yy247;
+	if (yych == 'l') goto yy534;
+	goto yy250;
 yy471:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy523;
-	goto yy247;
+	if (yych == '6') goto yy535;
+	goto yy250;
 yy472:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy524;
-	goto yy247;
+	if (yych <= 0x00) goto yy410;
+	goto yy250;
 yy473:
-	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy525;
-	goto yy247;
+	++YYCURSOR;
+#line 187 "../src/options/parse_opts.re"
+	{ opts.set_encoding(Enc::Type::UTF16, true);  goto opt; }
+#line 2304 "src/options/parse_opts.cc"
 yy474:
-	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy526;
-	goto yy247;
+	++YYCURSOR;
+#line 185 "../src/options/parse_opts.re"
+	{ opts.set_encoding(Enc::Type::UTF32, true);  goto opt; }
+#line 2309 "src/options/parse_opts.cc"
 yy475:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy527;
-	goto yy247;
+	if (yych == 's') goto yy536;
+	goto yy250;
 yy476:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy528;
-	goto yy247;
+	if (yych == 'm') goto yy537;
+	goto yy250;
 yy477:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy529;
-	goto yy247;
+	if (yych == 'o') goto yy538;
+	goto yy250;
 yy478:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy427;
-	goto yy247;
+	if (yych == 'c') goto yy539;
+	goto yy250;
 yy479:
-	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy530;
-	goto yy247;
+	++YYCURSOR;
+#line 210 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--batch",            opt_batch); }
+#line 2330 "src/options/parse_opts.cc"
 yy480:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy531;
-	goto yy247;
+	if (yych == 'c') goto yy540;
+	goto yy250;
 yy481:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy532;
-	goto yy247;
+	if (yych == 'd') goto yy541;
+	goto yy250;
 yy482:
 	yych = *++YYCURSOR;
-	if (yych == 'h') goto yy533;
-	goto yy247;
+	if (yych == 'n') goto yy542;
+	goto yy250;
 yy483:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy534;
-	goto yy247;
+	if (yych == 'a') goto yy543;
+	goto yy250;
 yy484:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy535;
-	if (yych == 'v') goto yy536;
-	goto yy247;
+	if (yych == 's') goto yy544;
+	goto yy250;
 yy485:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy537;
-	goto yy247;
+	if (yych == 's') goto yy545;
+	goto yy250;
 yy486:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy538;
-	goto yy247;
+	if (yych == 'e') goto yy546;
+	goto yy250;
 yy487:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy539;
-	goto yy247;
+	if (yych == 'i') goto yy547;
+	goto yy250;
 yy488:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy540;
-	goto yy247;
+	if (yych == 'o') goto yy548;
+	goto yy250;
 yy489:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy541;
-	goto yy247;
+	if (yych == 'e') goto yy549;
+	goto yy250;
 yy490:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy542;
-	goto yy247;
+	if (yych == 'n') goto yy550;
+	goto yy250;
 yy491:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy543;
-	goto yy247;
+	if (yych == 'd') goto yy551;
+	goto yy250;
 yy492:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy544;
-	goto yy247;
+	if (yych == 'f') goto yy552;
+	if (yych == 'l') goto yy553;
+	goto yy250;
 yy493:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy545;
-	goto yy247;
+	if (yych == 'f') goto yy554;
+	goto yy250;
 yy494:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy546;
-	goto yy247;
+	if (yych == 'n') goto yy555;
+	goto yy250;
 yy495:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy547;
-	goto yy247;
+	if (yych == 'f') goto yy556;
+	goto yy250;
 yy496:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy548;
-	goto yy247;
+	if (yych == 's') goto yy557;
+	goto yy250;
 yy497:
 	yych = *++YYCURSOR;
-	if (yych == 'k') goto yy549;
-	goto yy247;
+	if (yych == 'o') goto yy558;
+	goto yy250;
 yy498:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy550;
-	goto yy247;
+	if (yych == 'c') goto yy559;
+	goto yy250;
 yy499:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy551;
-	goto yy247;
+	if (yych == 'n') goto yy560;
+	goto yy250;
 yy500:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy552;
-	goto yy247;
+	if (yych == 'a') goto yy561;
+	goto yy250;
 yy501:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy553;
-	goto yy247;
+	if (yych == 't') goto yy562;
+	goto yy250;
 yy502:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy554;
-	goto yy247;
+	if (yych == 'y') goto yy563;
+	goto yy250;
 yy503:
 	yych = *++YYCURSOR;
-	if (yych == 'b') goto yy555;
-	goto yy247;
+	if (yych == 'a') goto yy564;
+	goto yy250;
 yy504:
-	++YYCURSOR;
-#line 186 "../src/options/parse_opts.re"
-	{ NEXT_ARG("-t, --header, --type-header", opt_header); }
-#line 2406 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy565;
+	goto yy250;
 yy505:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy556;
-	goto yy247;
+	if (yych == 'e') goto yy566;
+	goto yy250;
 yy506:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy557;
-	goto yy247;
+	if (yych == '-') goto yy567;
+	goto yy250;
 yy507:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy558;
-	goto yy247;
+	if (yych == 's') goto yy568;
+	goto yy250;
 yy508:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy559;
-	goto yy247;
+	if (yych == 'o') goto yy569;
+	goto yy250;
 yy509:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy560;
-	goto yy247;
+	if (yych == 'w') goto yy570;
+	goto yy250;
 yy510:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy561;
-	goto yy247;
+	if (yych == '-') goto yy571;
+	goto yy250;
 yy511:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy562;
-	goto yy247;
+	if (yych == 'u') goto yy572;
+	goto yy250;
 yy512:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy563;
-	goto yy247;
+	if (yych == 'e') goto yy573;
+	goto yy250;
 yy513:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy564;
-	goto yy247;
+	if (yych == 'k') goto yy574;
+	goto yy250;
 yy514:
 	yych = *++YYCURSOR;
-	if (yych == 'm') goto yy565;
-	goto yy247;
+	if (yych == 'i') goto yy575;
+	goto yy250;
 yy515:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy566;
-	goto yy247;
+	if (yych == 'a') goto yy576;
+	goto yy250;
 yy516:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy567;
-	goto yy247;
+	if (yych == 's') goto yy577;
+	goto yy250;
 yy517:
-	++YYCURSOR;
-#line 185 "../src/options/parse_opts.re"
-	{ NEXT_ARG("-o, --output",       opt_output); }
-#line 2459 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy578;
+	goto yy250;
 yy518:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy568;
-	if (yych == 'l') goto yy569;
-	goto yy247;
+	if (yych == 'c') goto yy579;
+	if (yych == 'p') goto yy580;
+	goto yy250;
 yy519:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy570;
-	goto yy247;
+	if (yych == 'e') goto yy581;
+	goto yy250;
 yy520:
 	yych = *++YYCURSOR;
-	if (yych == 'v') goto yy571;
-	goto yy247;
+	if (yych == 'i') goto yy582;
+	goto yy250;
 yy521:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy572;
-	goto yy247;
+	if (yych == 'l') goto yy583;
+	goto yy250;
 yy522:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy573;
-	goto yy247;
+	if (yych <= 0x00) goto yy584;
+	goto yy250;
 yy523:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy574;
-	goto yy247;
+	if (yych == 'o') goto yy585;
+	goto yy250;
 yy524:
-	++YYCURSOR;
-#line 208 "../src/options/parse_opts.re"
-	{ RET_FAIL(error("staDFA algorithm was deprecated and removed")); }
-#line 2489 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == '-') goto yy586;
+	goto yy250;
 yy525:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy575;
-	goto yy247;
+	if (yych == 'o') goto yy587;
+	goto yy250;
 yy526:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy576;
-	goto yy247;
+	if (yych <= 0x00) goto yy588;
+	goto yy250;
 yy527:
-	++YYCURSOR;
-#line 188 "../src/options/parse_opts.re"
-	{ NEXT_ARG("--syntax",           opt_syntax); }
-#line 2502 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'c') goto yy589;
+	goto yy250;
 yy528:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy301;
-	goto yy247;
+	if (yych == 'l') goto yy590;
+	goto yy250;
 yy529:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy428;
-	goto yy247;
+	if (yych <= 0x00) goto yy591;
+	goto yy250;
 yy530:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy577;
-	goto yy247;
+	if (yych == 'd') goto yy592;
+	goto yy250;
 yy531:
-	++YYCURSOR;
-#line 141 "../src/options/parse_opts.re"
-	{ return vernum(); }
-#line 2519 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy593;
+	goto yy250;
 yy532:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy578;
-	goto yy247;
+	if (yych == 'e') goto yy594;
+	goto yy250;
 yy533:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy579;
-	goto yy247;
+	if (yych == 'e') goto yy595;
+	goto yy250;
 yy534:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy580;
-	goto yy247;
+	if (yych == '-') goto yy596;
+	goto yy250;
 yy535:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy581;
-	goto yy247;
+	if (yych <= 0x00) goto yy473;
+	goto yy250;
 yy536:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy582;
-	goto yy247;
+	if (yych == 'e') goto yy597;
+	goto yy250;
 yy537:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy583;
-	goto yy247;
+	if (yych <= 0x00) goto yy598;
+	goto yy250;
 yy538:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy584;
-	goto yy247;
+	if (yych == 'n') goto yy599;
+	goto yy250;
 yy539:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy585;
-	goto yy247;
+	if (yych == 'h') goto yy600;
+	goto yy250;
 yy540:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy586;
-	goto yy247;
+	if (yych == 't') goto yy601;
+	goto yy250;
 yy541:
-	++YYCURSOR;
-#line 187 "../src/options/parse_opts.re"
-	{ NEXT_ARG("--depfile",          opt_depfile); }
-#line 2560 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'i') goto yy602;
+	goto yy250;
 yy542:
 	yych = *++YYCURSOR;
-	if (yych == 'm') goto yy587;
-	goto yy247;
+	if (yych == 's') goto yy603;
+	if (yych == 'v') goto yy604;
+	goto yy250;
 yy543:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy588;
-	goto yy247;
+	if (yych == 'n') goto yy605;
+	goto yy250;
 yy544:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy589;
-	goto yy247;
+	if (yych == 'w') goto yy606;
+	goto yy250;
 yy545:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy590;
-	goto yy247;
+	if (yych == 'e') goto yy607;
+	goto yy250;
 yy546:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy591;
-	goto yy247;
+	if (yych == 'd') goto yy608;
+	goto yy250;
 yy547:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy592;
-	goto yy247;
+	if (yych == 'o') goto yy609;
+	goto yy250;
 yy548:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy593;
-	goto yy247;
+	if (yych == 'u') goto yy610;
+	goto yy250;
 yy549:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy594;
-	goto yy247;
+	if (yych <= 0x00) goto yy611;
+	goto yy250;
 yy550:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy595;
-	goto yy247;
+	if (yych == 'i') goto yy612;
+	goto yy250;
 yy551:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy596;
-	goto yy247;
+	if (yych == 'f') goto yy613;
+	goto yy250;
 yy552:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy597;
-	goto yy247;
+	if (yych == 'g') goto yy614;
+	goto yy250;
 yy553:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy598;
-	goto yy247;
+	if (yych == 'o') goto yy615;
+	goto yy250;
 yy554:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy599;
-	goto yy247;
+	if (yych == 'a') goto yy616;
+	goto yy250;
 yy555:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy600;
-	goto yy247;
+	if (yych == 't') goto yy617;
+	goto yy250;
 yy556:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy601;
-	goto yy247;
+	if (yych == 'a') goto yy618;
+	goto yy250;
 yy557:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy602;
-	goto yy247;
+	if (yych == 'k') goto yy619;
+	goto yy250;
 yy558:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy603;
-	goto yy247;
+	if (yych == 't') goto yy620;
+	goto yy250;
 yy559:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy604;
-	goto yy247;
+	if (yych == 'l') goto yy621;
+	goto yy250;
 yy560:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy605;
-	goto yy247;
+	if (yych == 'g') goto yy622;
+	goto yy250;
 yy561:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy606;
-	goto yy247;
+	if (yych == 't') goto yy623;
+	goto yy250;
 yy562:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy607;
-	goto yy247;
+	if (yych == 'a') goto yy624;
+	goto yy250;
 yy563:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy608;
-	goto yy247;
+	if (yych == 'n') goto yy625;
+	goto yy250;
 yy564:
 	yych = *++YYCURSOR;
-	if (yych == 'h') goto yy609;
-	goto yy247;
+	if (yych == 'b') goto yy626;
+	goto yy250;
 yy565:
-	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy610;
-	goto yy247;
+	++YYCURSOR;
+#line 202 "../src/options/parse_opts.re"
+	{ NEXT_ARG("-t, --header, --type-header", opt_header); }
+#line 2678 "src/options/parse_opts.cc"
 yy566:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy611;
-	goto yy247;
+	if (yych == 'n') goto yy627;
+	goto yy250;
 yy567:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy612;
-	goto yy247;
+	if (yych == 'c') goto yy628;
+	goto yy250;
 yy568:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy613;
-	goto yy247;
+	if (yych == 't') goto yy629;
+	goto yy250;
 yy569:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy614;
-	goto yy247;
+	if (yych == 'n') goto yy630;
+	goto yy250;
 yy570:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy615;
-	goto yy247;
+	if (yych == 'i') goto yy631;
+	goto yy250;
 yy571:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy616;
-	goto yy247;
+	if (yych == 'i') goto yy632;
+	goto yy250;
 yy572:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy617;
-	goto yy247;
+	if (yych == 'g') goto yy633;
+	goto yy250;
 yy573:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy618;
-	goto yy247;
+	if (yych == 'r') goto yy634;
+	goto yy250;
 yy574:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy619;
-	goto yy247;
+	if (yych == 'a') goto yy635;
+	goto yy250;
 yy575:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy287;
-	goto yy247;
+	if (yych == 'm') goto yy636;
+	goto yy250;
 yy576:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy620;
-	goto yy247;
+	if (yych == 'f') goto yy637;
+	goto yy250;
 yy577:
-	++YYCURSOR;
-#line 147 "../src/options/parse_opts.re"
-	{ global.set_verbose(true);            goto opt; }
-#line 2705 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'i') goto yy638;
+	goto yy250;
 yy578:
 	++YYCURSOR;
-#line 140 "../src/options/parse_opts.re"
-	{ return version(); }
-#line 2710 "src/options/parse_opts.cc"
+#line 201 "../src/options/parse_opts.re"
+	{ NEXT_ARG("-o, --output",       opt_output); }
+#line 2731 "src/options/parse_opts.cc"
 yy579:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy621;
-	goto yy247;
+	if (yych == 'a') goto yy639;
+	if (yych == 'l') goto yy640;
+	goto yy250;
 yy580:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy622;
-	goto yy247;
+	if (yych == 'r') goto yy641;
+	goto yy250;
 yy581:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy623;
-	goto yy247;
+	if (yych == '-') goto yy642;
+	goto yy250;
 yy582:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy624;
-	goto yy247;
+	if (yych == 'v') goto yy643;
+	goto yy250;
 yy583:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy625;
-	goto yy247;
+	if (yych == 'e') goto yy644;
+	goto yy250;
 yy584:
-	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy626;
-	goto yy247;
+	++YYCURSOR;
+#line 158 "../src/options/parse_opts.re"
+	{ global.set_server(true);             goto opt; }
+#line 2757 "src/options/parse_opts.cc"
 yy585:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy627;
-	goto yy247;
+	if (yych == 'o') goto yy645;
+	goto yy250;
 yy586:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy628;
-	goto yy247;
+	if (yych == 'p') goto yy646;
+	goto yy250;
 yy587:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy629;
-	goto yy247;
+	if (yych == 'n') goto yy647;
+	goto yy250;
 yy588:
-	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy630;
-	goto yy247;
-yy589:
 	++YYCURSOR;
-#line 218 "../src/options/parse_opts.re"
-	{ global.set_dump_cfg(true);           goto opt; }
-#line 2755 "src/options/parse_opts.cc"
+#line 230 "../src/options/parse_opts.re"
+	{ RET_FAIL(error("staDFA algorithm was deprecated and removed")); }
+#line 2774 "src/options/parse_opts.cc"
+yy589:
+	yych = *++YYCURSOR;
+	if (yych == 'o') goto yy648;
+	goto yy250;
 yy590:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy631;
-	goto yy247;
+	if (yych == 'e') goto yy649;
+	goto yy250;
 yy591:
-	yych = *++YYCURSOR;
-	switch (yych) {
-		case 'd': goto yy632;
-		case 'm': goto yy633;
-		case 'r': goto yy634;
-		case 't': goto yy635;
-		default: goto yy247;
-	}
+	++YYCURSOR;
+#line 204 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--syntax",           opt_syntax); }
+#line 2787 "src/options/parse_opts.cc"
 yy592:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy636;
-	goto yy247;
+	if (yych == 'r') goto yy650;
+	goto yy250;
 yy593:
-	++YYCURSOR;
-#line 211 "../src/options/parse_opts.re"
-	{ global.set_dump_nfa(true);           goto opt; }
-#line 2777 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'p') goto yy651;
+	goto yy250;
 yy594:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy637;
-	goto yy247;
+	if (yych == 'a') goto yy316;
+	goto yy250;
 yy595:
-	++YYCURSOR;
-#line 144 "../src/options/parse_opts.re"
-	{ global.set_target(Target::DOT);      goto opt; }
-#line 2786 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy474;
+	goto yy250;
 yy596:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy638;
-	goto yy247;
+	if (yych == 'l') goto yy652;
+	goto yy250;
 yy597:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy639;
-	goto yy247;
+	if (yych <= 0x00) goto yy653;
+	goto yy250;
 yy598:
-	yych = *++YYCURSOR;
-	if (yych == 's') goto yy640;
-	goto yy247;
+	++YYCURSOR;
+#line 146 "../src/options/parse_opts.re"
+	{ return vernum(); }
+#line 2816 "src/options/parse_opts.cc"
 yy599:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy641;
-	goto yy247;
+	if (yych <= 0x00) goto yy654;
+	goto yy250;
 yy600:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy642;
-	goto yy247;
+	if (yych == 'a') goto yy655;
+	goto yy250;
 yy601:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy643;
-	goto yy247;
+	if (yych == 'o') goto yy656;
+	goto yy250;
 yy602:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy644;
-	goto yy247;
+	if (yych == 'r') goto yy657;
+	goto yy250;
 yy603:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy645;
-	goto yy247;
+	if (yych == 'e') goto yy658;
+	goto yy250;
 yy604:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy646;
-	goto yy247;
+	if (yych == 'e') goto yy659;
+	goto yy250;
 yy605:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy647;
-	goto yy247;
+	if (yych == 'g') goto yy660;
+	goto yy250;
 yy606:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy648;
-	goto yy247;
+	if (yych == 'i') goto yy661;
+	goto yy250;
 yy607:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy649;
-	goto yy247;
+	if (yych == '-') goto yy662;
+	goto yy250;
 yy608:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy650;
-	goto yy247;
+	if (yych == '-') goto yy663;
+	goto yy250;
 yy609:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy651;
-	goto yy247;
+	if (yych == 'n') goto yy664;
+	goto yy250;
 yy610:
 	yych = *++YYCURSOR;
-	if (yych == 'z') goto yy652;
-	goto yy247;
+	if (yych == 't') goto yy665;
+	goto yy250;
 yy611:
-	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy653;
-	goto yy247;
+	++YYCURSOR;
+#line 203 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--depfile",          opt_depfile); }
+#line 2869 "src/options/parse_opts.cc"
 yy612:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy654;
-	goto yy247;
+	if (yych == 'm') goto yy666;
+	goto yy250;
 yy613:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy655;
-	goto yy247;
+	if (yych == 'a') goto yy667;
+	goto yy250;
 yy614:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy656;
-	goto yy247;
+	if (yych <= 0x00) goto yy668;
+	goto yy250;
 yy615:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy657;
-	goto yy247;
+	if (yych == 's') goto yy669;
+	goto yy250;
 yy616:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy658;
-	goto yy247;
+	if (yych == '-') goto yy670;
+	goto yy250;
 yy617:
-	++YYCURSOR;
-#line 197 "../src/options/parse_opts.re"
-	{ goto opt; }
-#line 2875 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy671;
+	goto yy250;
 yy618:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy659;
-	goto yy247;
+	if (yych <= 0x00) goto yy672;
+	goto yy250;
 yy619:
-	++YYCURSOR;
-#line 151 "../src/options/parse_opts.re"
-	{ global.set_target(Target::SKELETON); goto opt; }
-#line 2884 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'i') goto yy673;
+	goto yy250;
 yy620:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy660;
-	goto yy247;
+	if (yych <= 0x00) goto yy674;
+	goto yy250;
 yy621:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy661;
-	goto yy247;
+	if (yych == 'a') goto yy675;
+	goto yy250;
 yy622:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy662;
-	goto yy247;
+	if (yych == '-') goto yy676;
+	goto yy250;
 yy623:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy663;
-	goto yy247;
+	if (yych == 'h') goto yy677;
+	goto yy250;
 yy624:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy664;
-	goto yy247;
+	if (yych == 'g') goto yy678;
+	goto yy250;
 yy625:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy665;
-	goto yy247;
+	if (yych == 't') goto yy679;
+	goto yy250;
 yy626:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy666;
-	goto yy247;
+	if (yych == 'e') goto yy680;
+	goto yy250;
 yy627:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy667;
-	goto yy247;
+	if (yych == 'c') goto yy681;
+	goto yy250;
 yy628:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy668;
-	goto yy247;
+	if (yych == 'a') goto yy682;
+	goto yy250;
 yy629:
 	yych = *++YYCURSOR;
-	if (yych == 'z') goto yy669;
-	goto yy247;
+	if (yych == '-') goto yy683;
+	goto yy250;
 yy630:
-	++YYCURSOR;
-#line 217 "../src/options/parse_opts.re"
-	{ global.set_dump_adfa(true);          goto opt; }
-#line 2929 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == '-') goto yy684;
+	goto yy250;
 yy631:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy670;
-	goto yy247;
+	if (yych == 't') goto yy685;
+	goto yy250;
 yy632:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy671;
-	goto yy247;
+	if (yych == 'f') goto yy686;
+	goto yy250;
 yy633:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy672;
-	goto yy247;
+	if (yych == '-') goto yy687;
+	goto yy250;
 yy634:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy673;
-	goto yy247;
+	if (yych == 'a') goto yy688;
+	goto yy250;
 yy635:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy674;
-	if (yych == 'r') goto yy675;
-	goto yy247;
+	if (yych == 'h') goto yy689;
+	goto yy250;
 yy636:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy676;
-	goto yy247;
+	if (yych == 'i') goto yy690;
+	goto yy250;
 yy637:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy677;
-	goto yy247;
+	if (yych == 'e') goto yy691;
+	goto yy250;
 yy638:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy678;
-	goto yy247;
+	if (yych == 'o') goto yy692;
+	goto yy250;
 yy639:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy679;
-	goto yy247;
+	if (yych == 'p') goto yy693;
+	goto yy250;
 yy640:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy680;
-	goto yy247;
+	if (yych == 'o') goto yy694;
+	goto yy250;
 yy641:
 	yych = *++YYCURSOR;
-	if (yych == 'x') goto yy681;
-	goto yy247;
+	if (yych == 'e') goto yy695;
+	goto yy250;
 yy642:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy682;
-	goto yy247;
+	if (yych == 'g') goto yy696;
+	if (yych == 'u') goto yy697;
+	goto yy250;
 yy643:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy683;
-	goto yy247;
+	if (yych == 'e') goto yy698;
+	goto yy250;
 yy644:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy684;
-	goto yy247;
+	if (yych <= 0x00) goto yy699;
+	goto yy250;
 yy645:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy685;
-	goto yy247;
+	if (yych == 'p') goto yy700;
+	goto yy250;
 yy646:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy686;
-	goto yy247;
+	if (yych == 'a') goto yy701;
+	goto yy250;
 yy647:
 	yych = *++YYCURSOR;
-	if (yych == 'h') goto yy687;
-	goto yy247;
+	if (yych <= 0x00) goto yy702;
+	goto yy250;
 yy648:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy688;
-	goto yy247;
+	if (yych == 'n') goto yy301;
+	goto yy250;
 yy649:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy689;
-	goto yy247;
+	if (yych == '-') goto yy703;
+	goto yy250;
 yy650:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy690;
-	goto yy247;
+	if (yych == 'i') goto yy704;
+	goto yy250;
 yy651:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy691;
-	goto yy247;
+	if (yych == 'o') goto yy705;
+	goto yy250;
 yy652:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy692;
-	goto yy247;
+	if (yych == 'o') goto yy706;
+	goto yy250;
 yy653:
 	++YYCURSOR;
-#line 165 "../src/options/parse_opts.re"
-	{ opts.set_unsafe(false);            goto opt; }
-#line 3023 "src/options/parse_opts.cc"
+#line 152 "../src/options/parse_opts.re"
+	{ global.set_verbose(true);            goto opt; }
+#line 3039 "src/options/parse_opts.cc"
 yy654:
-	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy693;
-	goto yy247;
+	++YYCURSOR;
+#line 145 "../src/options/parse_opts.re"
+	{ return version(); }
+#line 3044 "src/options/parse_opts.cc"
 yy655:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy694;
-	goto yy247;
+	if (yych == 'r') goto yy707;
+	goto yy250;
 yy656:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy695;
-	goto yy247;
+	if (yych == 'r') goto yy708;
+	goto yy250;
 yy657:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy696;
-	goto yy247;
+	if (yych <= 0x00) goto yy709;
+	goto yy250;
 yy658:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy697;
-	goto yy247;
+	if (yych == 'n') goto yy710;
+	goto yy250;
 yy659:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy698;
-	goto yy247;
+	if (yych == 'r') goto yy711;
+	goto yy250;
 yy660:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy699;
-	goto yy247;
+	if (yych == 'e') goto yy712;
+	goto yy250;
 yy661:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy371;
-	goto yy247;
+	if (yych == 't') goto yy713;
+	goto yy250;
 yy662:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy700;
-	goto yy247;
+	if (yych == 'c') goto yy714;
+	goto yy250;
 yy663:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy701;
-	goto yy247;
+	if (yych == 'g') goto yy715;
+	goto yy250;
 yy664:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy702;
-	goto yy247;
+	if (yych == 's') goto yy716;
+	goto yy250;
 yy665:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy703;
-	goto yy247;
+	if (yych == 'p') goto yy717;
+	goto yy250;
 yy666:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy704;
-	goto yy247;
+	if (yych == 'i') goto yy718;
+	goto yy250;
 yy667:
-	++YYCURSOR;
-#line 143 "../src/options/parse_opts.re"
-	{ global.set_start_conditions(true);   goto opt; }
-#line 3080 "src/options/parse_opts.cc"
-yy668:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy705;
-	goto yy247;
+	if (yych <= 0x00) goto yy719;
+	goto yy250;
+yy668:
+	++YYCURSOR;
+#line 240 "../src/options/parse_opts.re"
+	{ global.set_dump_cfg(true);           goto opt; }
+#line 3101 "src/options/parse_opts.cc"
 yy669:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy706;
-	goto yy247;
+	if (yych == 'u') goto yy720;
+	goto yy250;
 yy670:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy707;
-	goto yy247;
+	switch (yych) {
+		case 'd': goto yy721;
+		case 'm': goto yy722;
+		case 'r': goto yy723;
+		case 't': goto yy724;
+		default: goto yy250;
+	}
 yy671:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy708;
-	goto yy247;
+	if (yych == 'r') goto yy725;
+	goto yy250;
 yy672:
-	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy709;
-	goto yy247;
+	++YYCURSOR;
+#line 233 "../src/options/parse_opts.re"
+	{ global.set_dump_nfa(true);           goto opt; }
+#line 3123 "src/options/parse_opts.cc"
 yy673:
 	yych = *++YYCURSOR;
-	if (yych == 'w') goto yy710;
-	goto yy247;
+	if (yych == 'p') goto yy726;
+	goto yy250;
 yy674:
-	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy711;
-	goto yy247;
+	++YYCURSOR;
+#line 149 "../src/options/parse_opts.re"
+	{ global.set_target(Target::DOT);      goto opt; }
+#line 3132 "src/options/parse_opts.cc"
 yy675:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy712;
-	goto yy247;
+	if (yych == 's') goto yy727;
+	goto yy250;
 yy676:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy713;
-	goto yy247;
+	if (yych == 'p') goto yy728;
+	goto yy250;
 yy677:
-	++YYCURSOR;
-#line 152 "../src/options/parse_opts.re"
-	{ global.set_eager_skip(true);         goto opt; }
-#line 3121 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy729;
+	goto yy250;
 yy678:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy714;
-	goto yy247;
+	if (yych == 's') goto yy730;
+	goto yy250;
 yy679:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy715;
-	goto yy247;
+	if (yych == 'a') goto yy731;
+	goto yy250;
 yy680:
-	++YYCURSOR;
-#line 202 "../src/options/parse_opts.re"
-	{ NEXT_ARG("--fixed-tags",       opt_fixed_tags); }
-#line 3134 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'l') goto yy732;
+	goto yy250;
 yy681:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy716;
-	goto yy247;
+	if (yych == 'o') goto yy733;
+	goto yy250;
 yy682:
-	++YYCURSOR;
-#line 153 "../src/options/parse_opts.re"
-	{ global.set_code_model(CodeModel::GOTO_LABEL);  goto opt; }
-#line 3143 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'p') goto yy734;
+	goto yy250;
 yy683:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy717;
-	goto yy247;
+	if (yych == 'c') goto yy735;
+	goto yy250;
 yy684:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy718;
-	goto yy247;
+	if (yych == 'f') goto yy736;
+	goto yy250;
 yy685:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy719;
-	goto yy247;
+	if (yych == 'c') goto yy737;
+	goto yy250;
 yy686:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy720;
-	goto yy247;
+	if (yych == 's') goto yy738;
+	goto yy250;
 yy687:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy721;
-	goto yy247;
+	if (yych == 'i') goto yy739;
+	goto yy250;
 yy688:
-	++YYCURSOR;
-#line 161 "../src/options/parse_opts.re"
-	{ opts.set_nested_ifs(true);         goto opt; }
-#line 3168 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy740;
+	goto yy250;
 yy689:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy722;
-	goto yy247;
+	if (yych == 'e') goto yy741;
+	goto yy250;
 yy690:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy723;
-	goto yy247;
+	if (yych == 'z') goto yy742;
+	goto yy250;
 yy691:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy724;
-	goto yy247;
+	if (yych <= 0x00) goto yy743;
+	goto yy250;
 yy692:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy725;
-	goto yy247;
+	if (yych == 'n') goto yy744;
+	goto yy250;
 yy693:
-	++YYCURSOR;
-#line 150 "../src/options/parse_opts.re"
-	{ global.set_version(false);           goto opt; }
-#line 3189 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy745;
+	goto yy250;
 yy694:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy726;
-	goto yy247;
+	if (yych == 's') goto yy746;
+	goto yy250;
 yy695:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy727;
-	goto yy247;
+	if (yych == 'c') goto yy747;
+	goto yy250;
 yy696:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy728;
-	goto yy247;
+	if (yych == 'e') goto yy748;
+	goto yy250;
 yy697:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy729;
-	goto yy247;
+	if (yych == 's') goto yy749;
+	goto yy250;
 yy698:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy730;
-	goto yy247;
+	if (yych == '-') goto yy750;
+	goto yy250;
 yy699:
-	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy731;
-	goto yy247;
-yy700:
 	++YYCURSOR;
-#line 157 "../src/options/parse_opts.re"
-	{ opts.set_bitmaps(true);            goto opt; }
-#line 3218 "src/options/parse_opts.cc"
+#line 219 "../src/options/parse_opts.re"
+	{ goto opt; }
+#line 3233 "src/options/parse_opts.cc"
+yy700:
+	yych = *++YYCURSOR;
+	if (yych == 's') goto yy751;
+	goto yy250;
 yy701:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy732;
-	goto yy247;
+	if (yych == 's') goto yy752;
+	goto yy250;
 yy702:
-	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy733;
-	goto yy247;
-yy703:
 	++YYCURSOR;
-#line 159 "../src/options/parse_opts.re"
-	{ opts.set_case_ranges(true);        goto opt; }
-#line 3231 "src/options/parse_opts.cc"
+#line 156 "../src/options/parse_opts.re"
+	{ global.set_target(Target::SKELETON); goto opt; }
+#line 3246 "src/options/parse_opts.cc"
+yy703:
+	yych = *++YYCURSOR;
+	if (yych == 's') goto yy753;
+	goto yy250;
 yy704:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy734;
-	goto yy247;
+	if (yych == 'v') goto yy754;
+	goto yy250;
 yy705:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy735;
-	goto yy247;
+	if (yych == 'r') goto yy755;
+	goto yy250;
 yy706:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy736;
-	goto yy247;
+	if (yych == 'o') goto yy756;
+	goto yy250;
 yy707:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy737;
-	goto yy247;
+	if (yych == 's') goto yy757;
+	goto yy250;
 yy708:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy738;
-	goto yy247;
+	if (yych == 's') goto yy758;
+	goto yy250;
 yy709:
-	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy739;
-	goto yy247;
+	++YYCURSOR;
+#line 206 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--cache-dir",        opt_cache_dir); }
+#line 3275 "src/options/parse_opts.cc"
 yy710:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy740;
-	goto yy247;
+	if (yych == 's') goto yy759;
+	goto yy250;
 yy711:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy741;
-	goto yy247;
+	if (yych == 't') goto yy760;
+	goto yy250;
 yy712:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy742;
-	goto yy247;
+	if (yych == 's') goto yy761;
+	goto yy250;
 yy713:
-	++YYCURSOR;
-#line 219 "../src/options/parse_opts.re"
-	{ global.set_dump_interf(true);        goto opt; }
-#line 3272 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'c') goto yy762;
+	goto yy250;
 yy714:
-	++YYCURSOR;
-#line 191 "../src/options/parse_opts.re"
-	{ NEXT_ARG("--empty-class",      opt_empty_class); }
-#line 3277 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'h') goto yy763;
+	goto yy250;
 yy715:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy743;
-	goto yy247;
+	if (yych == 'o') goto yy764;
+	goto yy250;
 yy716:
-	++YYCURSOR;
-#line 146 "../src/options/parse_opts.re"
-	{ global.set_flex_syntax(true);        goto opt; }
-#line 3286 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy765;
+	goto yy250;
 yy717:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy744;
-	goto yy247;
+	if (yych == 'u') goto yy766;
+	goto yy250;
 yy718:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy745;
-	goto yy247;
+	if (yych == 'z') goto yy767;
+	goto yy250;
 yy719:
-	yych = *++YYCURSOR;
-	if (yych == 't') goto yy746;
-	goto yy247;
+	++YYCURSOR;
+#line 239 "../src/options/parse_opts.re"
+	{ global.set_dump_adfa(true);          goto opt; }
+#line 3316 "src/options/parse_opts.cc"
 yy720:
 	yych = *++YYCURSOR;
-	if (yych == 'm') goto yy747;
-	goto yy247;
+	if (yych == 'r') goto yy768;
+	goto yy250;
 yy721:
-	++YYCURSOR;
-#line 154 "../src/options/parse_opts.re"
-	{ global.set_code_model(CodeModel::LOOP_SWITCH); goto opt; }
-#line 3307 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy769;
+	goto yy250;
 yy722:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy748;
-	goto yy247;
+	if (yych == 'i') goto yy770;
+	goto yy250;
 yy723:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy749;
-	goto yy247;
+	if (yych == 'a') goto yy771;
+	goto yy250;
 yy724:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy750;
-	goto yy247;
+	if (yych == 'a') goto yy772;
+	if (yych == 'r') goto yy773;
+	goto yy250;
 yy725:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy751;
-	goto yy247;
+	if (yych == 'f') goto yy774;
+	goto yy250;
 yy726:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy752;
-	goto yy247;
+	if (yych <= 0x00) goto yy775;
+	goto yy250;
 yy727:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy753;
-	goto yy247;
+	if (yych == 's') goto yy776;
+	goto yy250;
 yy728:
 	yych = *++YYCURSOR;
-	if (yych == 'b') goto yy754;
-	goto yy247;
+	if (yych == 'o') goto yy777;
+	goto yy250;
 yy729:
-	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy755;
-	goto yy247;
-yy730:
 	++YYCURSOR;
-#line 196 "../src/options/parse_opts.re"
-	{ goto opt; }
-#line 3344 "src/options/parse_opts.cc"
+#line 171 "../src/options/parse_opts.re"
+	{ opts.set_fast_path(true);          goto opt; }
+#line 3358 "src/options/parse_opts.cc"
+yy730:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy778;
+	goto yy250;
 yy731:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy756;
-	goto yy247;
+	if (yych == 'x') goto yy779;
+	goto yy250;
 yy732:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy757;
-	goto yy247;
+	if (yych <= 0x00) goto yy780;
+	goto yy250;
 yy733:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy758;
-	goto yy247;
+	if (yych == 'd') goto yy781;
+	goto yy250;
 yy734:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy759;
-	goto yy247;
+	if (yych == 't') goto yy782;
+	goto yy250;
 yy735:
-	++YYCURSOR;
-#line 158 "../src/options/parse_opts.re"
-	{ opts.set_debug(true);              goto opt; }
-#line 3365 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'a') goto yy783;
+	goto yy250;
 yy736:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy760;
-	goto yy247;
+	if (yych == 'o') goto yy784;
+	goto yy250;
 yy737:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy761;
-	goto yy247;
+	if (yych == 'h') goto yy785;
+	goto yy250;
 yy738:
-	++YYCURSOR;
-#line 214 "../src/options/parse_opts.re"
-	{ global.set_dump_dfa_det(true);       goto opt; }
-#line 3378 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy786;
+	goto yy250;
 yy739:
-	++YYCURSOR;
-#line 216 "../src/options/parse_opts.re"
-	{ global.set_dump_dfa_min(true);       goto opt; }
-#line 3383 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'n') goto yy787;
+	goto yy250;
 yy740:
-	++YYCURSOR;
-#line 213 "../src/options/parse_opts.re"
-	{ global.set_dump_dfa_raw(true);       goto opt; }
-#line 3388 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'i') goto yy788;
+	goto yy250;
 yy741:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy762;
-	goto yy247;
+	if (yych == 'a') goto yy789;
+	goto yy250;
 yy742:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy763;
-	goto yy247;
+	if (yych == 'e') goto yy790;
+	goto yy250;
 yy743:
-	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy764;
-	goto yy247;
+	++YYCURSOR;
+#line 181 "../src/options/parse_opts.re"
+	{ opts.set_unsafe(false);            goto opt; }
+#line 3415 "src/options/parse_opts.cc"
 yy744:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy765;
-	goto yy247;
+	if (yych <= 0x00) goto yy791;
+	goto yy250;
 yy745:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy766;
-	goto yy247;
+	if (yych == 'u') goto yy792;
+	goto yy250;
 yy746:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy767;
-	goto yy247;
+	if (yych == 'u') goto yy793;
+	goto yy250;
 yy747:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy768;
-	goto yy247;
+	if (yych == 't') goto yy794;
+	goto yy250;
 yy748:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy769;
-	goto yy247;
+	if (yych == 'n') goto yy795;
+	goto yy250;
 yy749:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy770;
-	goto yy247;
+	if (yych == 'e') goto yy796;
+	goto yy250;
 yy750:
-	++YYCURSOR;
-#line 206 "../src/options/parse_opts.re"
-	{ RET_FAIL(error("TDFA(0) algorithm was deprecated and removed")); }
-#line 3429 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'f') goto yy797;
+	goto yy250;
 yy751:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy771;
-	goto yy247;
+	if (yych <= 0x00) goto yy798;
+	goto yy250;
 yy752:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy772;
-	goto yy247;
+	if (yych == 's') goto yy799;
+	goto yy250;
 yy753:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy773;
-	goto yy247;
+	if (yych == 't') goto yy800;
+	goto yy250;
 yy754:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy774;
-	goto yy247;
+	if (yych == 'e') goto yy801;
+	goto yy250;
 yy755:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy775;
-	goto yy247;
+	if (yych == 't') goto yy802;
+	goto yy250;
 yy756:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy776;
-	goto yy247;
+	if (yych == 'p') goto yy803;
+	goto yy250;
 yy757:
 	yych = *++YYCURSOR;
-	if (yych == 'v') goto yy777;
-	goto yy247;
+	if (yych <= 0x00) goto yy404;
+	goto yy250;
 yy758:
-	++YYCURSOR;
-#line 163 "../src/options/parse_opts.re"
-	{ opts.set_case_inverted(true);      goto opt; }
-#line 3462 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy804;
+	goto yy250;
 yy759:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy778;
-	goto yy247;
+	if (yych == 'i') goto yy805;
+	goto yy250;
 yy760:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy779;
-	goto yy247;
+	if (yych == 'e') goto yy806;
+	goto yy250;
 yy761:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy780;
-	goto yy247;
+	if (yych <= 0x00) goto yy807;
+	goto yy250;
 yy762:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy781;
-	goto yy247;
+	if (yych == 'h') goto yy808;
+	goto yy250;
 yy763:
-	++YYCURSOR;
-#line 212 "../src/options/parse_opts.re"
-	{ global.set_dump_dfa_tree(true);      goto opt; }
-#line 3483 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'a') goto yy809;
+	goto yy250;
 yy764:
 	yych = *++YYCURSOR;
-	if (yych == 'y') goto yy782;
-	goto yy247;
+	if (yych == 't') goto yy810;
+	goto yy250;
 yy765:
-	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy783;
-	goto yy247;
+	++YYCURSOR;
+#line 148 "../src/options/parse_opts.re"
+	{ global.set_start_conditions(true);   goto opt; }
+#line 3504 "src/options/parse_opts.cc"
 yy766:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy784;
-	goto yy247;
+	if (yych == 't') goto yy811;
+	goto yy250;
 yy767:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy785;
-	goto yy247;
+	if (yych == 'a') goto yy812;
+	goto yy250;
 yy768:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy786;
-	goto yy247;
+	if (yych == 'e') goto yy813;
+	goto yy250;
 yy769:
-	++YYCURSOR;
-#line 148 "../src/options/parse_opts.re"
-	{ global.set_line_dirs(false);         goto opt; }
-#line 3508 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy814;
+	goto yy250;
 yy770:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy787;
-	goto yy247;
+	if (yych == 'n') goto yy815;
+	goto yy250;
 yy771:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy788;
-	goto yy247;
+	if (yych == 'w') goto yy816;
+	goto yy250;
 yy772:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy789;
-	goto yy247;
+	if (yych == 'g') goto yy817;
+	goto yy250;
 yy773:
-	++YYCURSOR;
-#line 207 "../src/options/parse_opts.re"
-	{ RET_FAIL(error("option --posix-closure was removed")); }
-#line 3525 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy818;
+	goto yy250;
 yy774:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy790;
-	goto yy247;
+	if (yych <= 0x00) goto yy819;
+	goto yy250;
 yy775:
-	yych = *++YYCURSOR;
-	if (yych == 't') goto yy791;
-	goto yy247;
+	++YYCURSOR;
+#line 157 "../src/options/parse_opts.re"
+	{ global.set_eager_skip(true);         goto opt; }
+#line 3545 "src/options/parse_opts.cc"
 yy776:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy792;
-	goto yy247;
+	if (yych <= 0x00) goto yy820;
+	goto yy250;
 yy777:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy793;
-	goto yy247;
+	if (yych == 'l') goto yy821;
+	goto yy250;
 yy778:
 	++YYCURSOR;
-#line 160 "../src/options/parse_opts.re"
-	{ opts.set_computed_gotos(true);     goto opt; }
-#line 3546 "src/options/parse_opts.cc"
+#line 224 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--fixed-tags",       opt_fixed_tags); }
+#line 3558 "src/options/parse_opts.cc"
 yy779:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy794;
-	goto yy247;
+	if (yych <= 0x00) goto yy822;
+	goto yy250;
 yy780:
-	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy795;
-	goto yy247;
+	++YYCURSOR;
+#line 159 "../src/options/parse_opts.re"
+	{ global.set_code_model(CodeModel::GOTO_LABEL);  goto opt; }
+#line 3567 "src/options/parse_opts.cc"
 yy781:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy796;
-	goto yy247;
+	if (yych == 'i') goto yy823;
+	goto yy250;
 yy782:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy797;
-	goto yy247;
+	if (yych == 'u') goto yy824;
+	goto yy250;
 yy783:
-	++YYCURSOR;
-#line 193 "../src/options/parse_opts.re"
-	{ NEXT_ARG("--input-encoding",   opt_input_encoding); }
-#line 3567 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'p') goto yy825;
+	goto yy250;
 yy784:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy798;
-	goto yy247;
+	if (yych == 'r') goto yy826;
+	goto yy250;
 yy785:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy799;
-	goto yy247;
+	if (yych <= 0x00) goto yy827;
+	goto yy250;
 yy786:
-	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy800;
-	goto yy247;
+	++YYCURSOR;
+#line 169 "../src/options/parse_opts.re"
+	{ opts.set_nested_ifs(true);         goto opt; }
+#line 3592 "src/options/parse_opts.cc"
 yy787:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy801;
-	goto yy247;
+	if (yych == 'f') goto yy828;
+	goto yy250;
 yy788:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy802;
-	goto yy247;
+	if (yych == 'o') goto yy829;
+	goto yy250;
 yy789:
-	++YYCURSOR;
-#line 178 "../src/options/parse_opts.re"
-	{
-        opts.set_tags_posix_syntax(true);
-        opts.set_tags_posix_semantics(true);
-        goto opt;
-    }
-#line 3596 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'd') goto yy830;
+	goto yy250;
 yy790:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy803;
-	goto yy247;
+	if (yych == '-') goto yy831;
+	goto yy250;
 yy791:
-	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy804;
-	goto yy247;
-yy792:
 	++YYCURSOR;
-#line 145 "../src/options/parse_opts.re"
-	{ global.set_storable_state(true);     goto opt; }
-#line 3609 "src/options/parse_opts.cc"
+#line 155 "../src/options/parse_opts.re"
+	{ global.set_version(false);           goto opt; }
+#line 3613 "src/options/parse_opts.cc"
+yy792:
+	yych = *++YYCURSOR;
+	if (yych == 'r') goto yy832;
+	goto yy250;
 yy793:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy805;
-	goto yy247;
+	if (yych == 'r') goto yy833;
+	goto yy250;
 yy794:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy806;
-	goto yy247;
+	if (yych == 'a') goto yy834;
+	goto yy250;
 yy795:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy807;
-	goto yy247;
+	if (yych <= 0x00) goto yy835;
+	goto yy250;
 yy796:
-	++YYCURSOR;
-#line 215 "../src/options/parse_opts.re"
-	{ global.set_dump_dfa_tagopt(true);    goto opt; }
-#line 3626 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy836;
+	goto yy250;
 yy797:
-	++YYCURSOR;
-#line 189 "../src/options/parse_opts.re"
-	{ NEXT_ARG("--encoding-policy",  opt_encoding_policy); }
-#line 3631 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'u') goto yy837;
+	goto yy250;
 yy798:
 	++YYCURSOR;
-#line 166 "../src/options/parse_opts.re"
-	{ opts.set_invert_captures(true);    goto opt; }
-#line 3636 "src/options/parse_opts.cc"
+#line 170 "../src/options/parse_opts.re"
+	{ opts.set_simd_loops(true);         goto opt; }
+#line 3642 "src/options/parse_opts.cc"
 yy799:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy808;
-	goto yy247;
+	if (yych <= 0x00) goto yy838;
+	goto yy250;
 yy800:
-	++YYCURSOR;
-#line 192 "../src/options/parse_opts.re"
-	{ NEXT_ARG("--location-format",  opt_location_format); }
-#line 3645 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'a') goto yy839;
+	goto yy250;
 yy801:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy809;
-	goto yy247;
+	if (yych == 'n') goto yy840;
+	goto yy250;
 yy802:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy810;
-	goto yy247;
+	if (yych <= 0x00) goto yy841;
+	goto yy250;
 yy803:
-	++YYCURSOR;
-#line 201 "../src/options/parse_opts.re"
-	{ NEXT_ARG("--posix-prectable",  opt_posix_prectable); }
-#line 3658 "src/options/parse_opts.cc"
-yy804:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy811;
-	goto yy247;
-yy805:
+	if (yych == 's') goto yy842;
+	goto yy250;
+yy804:
 	++YYCURSOR;
-#line 162 "../src/options/parse_opts.re"
-	{ opts.set_case_insensitive(true);   goto opt; }
+#line 163 "../src/options/parse_opts.re"
+	{ opts.set_bitmaps(true);            goto opt; }
 #line 3667 "src/options/parse_opts.cc"
+yy805:
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy843;
+	goto yy250;
 yy806:
-	++YYCURSOR;
-#line 200 "../src/options/parse_opts.re"
-	{ NEXT_ARG("--dfa-minimization", opt_minimization); }
-#line 3672 "src/options/parse_opts.cc"
-yy807:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy812;
-	goto yy247;
+	if (yych == 'd') goto yy844;
+	goto yy250;
+yy807:
+	++YYCURSOR;
+#line 165 "../src/options/parse_opts.re"
+	{ opts.set_case_ranges(true);        goto opt; }
+#line 3680 "src/options/parse_opts.cc"
 yy808:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy813;
-	goto yy247;
+	if (yych <= 0x00) goto yy845;
+	goto yy250;
 yy809:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy814;
-	goto yy247;
+	if (yych == 'i') goto yy846;
+	goto yy250;
 yy810:
-	++YYCURSOR;
-#line 203 "../src/options/parse_opts.re"
-	{ global.set_optimize_tags(false); goto opt; }
-#line 3689 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'o') goto yy847;
+	goto yy250;
 yy811:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy815;
-	goto yy247;
+	if (yych <= 0x00) goto yy848;
+	goto yy250;
 yy812:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy816;
-	goto yy247;
+	if (yych == 't') goto yy849;
+	goto yy250;
 yy813:
-	++YYCURSOR;
-#line 174 "../src/options/parse_opts.re"
-	{
-        opts.set_tags_posix_syntax(true);
-        goto opt;
-    }
-#line 3705 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == '-') goto yy850;
+	goto yy250;
 yy814:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy817;
-	goto yy247;
+	if (yych <= 0x00) goto yy851;
+	goto yy250;
 yy815:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy818;
-	goto yy247;
+	if (yych <= 0x00) goto yy852;
+	goto yy250;
 yy816:
-	++YYCURSOR;
-#line 220 "../src/options/parse_opts.re"
-	{ global.set_dump_closure_stats(true); goto opt; }
-#line 3718 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy853;
+	goto yy250;
 yy817:
-	++YYCURSOR;
-#line 149 "../src/options/parse_opts.re"
-	{ global.set_date(false);              goto opt; }
-#line 3723 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'o') goto yy854;
+	goto yy250;
 yy818:
 	yych = *++YYCURSOR;
-	if (yych >= 0x01) goto yy247;
+	if (yych == 'e') goto yy855;
+	goto yy250;
+yy819:
 	++YYCURSOR;
-#line 155 "../src/options/parse_opts.re"
-	{ global.set_code_model(CodeModel::REC_FUNC);    goto opt; }
-#line 3730 "src/options/parse_opts.cc"
-}
-#line 221 "../src/options/parse_opts.re"
-
-
-opt_lang: 
-#line 3736 "src/options/parse_opts.cc"
-{
-	char yych;
-	yych = *YYCURSOR;
-	switch (yych) {
-		case 'c': goto yy822;
-		case 'd': goto yy823;
-		case 'g': goto yy824;
-		case 'h': goto yy825;
-		case 'j': goto yy826;
-		case 'o': goto yy827;
-		case 'p': goto yy828;
-		case 'r': goto yy829;
-		case 'v': goto yy830;
-		case 'z': goto yy831;
-		default: goto yy820;
-	}
+#line 241 "../src/options/parse_opts.re"
+	{ global.set_dump_interf(true);        goto opt; }
+#line 3729 "src/options/parse_opts.cc"
 yy820:
 	++YYCURSOR;
+#line 213 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--empty-class",      opt_empty_class); }
+#line 3734 "src/options/parse_opts.cc"
 yy821:
-#line 224 "../src/options/parse_opts.re"
-	{
-        ERRARG("--lang",
-            "c | d | go | haskell | java | js | ocaml | python | rust | v | zig",
-            *argv);
-    }
-#line 3762 "src/options/parse_opts.cc"
-yy822:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy832;
-	goto yy821;
+	if (yych == 'i') goto yy856;
+	goto yy250;
+yy822:
+	++YYCURSOR;
+#line 151 "../src/options/parse_opts.re"
+	{ global.set_flex_syntax(true);        goto opt; }
+#line 3743 "src/options/parse_opts.cc"
 yy823:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy833;
-	goto yy821;
+	if (yych == 'n') goto yy857;
+	goto yy250;
 yy824:
-	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'o') goto yy834;
-	goto yy821;
+	yych = *++YYCURSOR;
+	if (yych == 'r') goto yy858;
+	goto yy250;
 yy825:
-	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy836;
-	goto yy821;
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy859;
+	goto yy250;
 yy826:
-	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy837;
-	if (yych == 's') goto yy838;
-	goto yy821;
+	yych = *++YYCURSOR;
+	if (yych == 'm') goto yy860;
+	goto yy250;
 yy827:
-	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'c') goto yy839;
-	goto yy821;
+	++YYCURSOR;
+#line 160 "../src/options/parse_opts.re"
+	{ global.set_code_model(CodeModel::LOOP_SWITCH); goto opt; }
+#line 3764 "src/options/parse_opts.cc"
 yy828:
-	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'y') goto yy840;
-	goto yy821;
+	yych = *++YYCURSOR;
+	if (yych == 'o') goto yy861;
+	goto yy250;
 yy829:
-	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'u') goto yy841;
-	goto yy821;
+	yych = *++YYCURSOR;
+	if (yych == 'n') goto yy862;
+	goto yy250;
 yy830:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy842;
-	goto yy821;
+	if (yych <= 0x00) goto yy863;
+	goto yy250;
 yy831:
-	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'i') goto yy843;
-	goto yy821;
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy864;
+	goto yy250;
 yy832:
-	++YYCURSOR;
-#line 229 "../src/options/parse_opts.re"
-	{ *lang = Lang::C;       goto opt; }
-#line 3808 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy865;
+	goto yy250;
 yy833:
-	++YYCURSOR;
-#line 230 "../src/options/parse_opts.re"
-	{ *lang = Lang::D;       goto opt; }
-#line 3813 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy866;
+	goto yy250;
 yy834:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy844;
+	if (yych == 'b') goto yy867;
+	goto yy250;
 yy835:
-	YYCURSOR = YYMARKER;
-	goto yy821;
+	++YYCURSOR;
+#line 177 "../src/options/parse_opts.re"
+	{ opts.set_profile_gen(true);        goto opt; }
+#line 3797 "src/options/parse_opts.cc"
 yy836:
-	yych = *++YYCURSOR;
-	if (yych == 's') goto yy845;
-	goto yy835;
+	++YYCURSOR;
+#line 208 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--profile-use",      opt_profile_use); }
+#line 3802 "src/options/parse_opts.cc"
 yy837:
 	yych = *++YYCURSOR;
-	if (yych == 'v') goto yy846;
-	goto yy835;
+	if (yych == 'n') goto yy868;
+	goto yy250;
 yy838:
-	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy847;
-	goto yy835;
+	++YYCURSOR;
+#line 218 "../src/options/parse_opts.re"
+	{ goto opt; }
+#line 3811 "src/options/parse_opts.cc"
 yy839:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy848;
-	goto yy835;
+	if (yych == 't') goto yy869;
+	goto yy250;
 yy840:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy849;
-	goto yy835;
+	if (yych <= 0x00) goto yy870;
+	goto yy250;
 yy841:
-	yych = *++YYCURSOR;
-	if (yych == 's') goto yy850;
-	goto yy835;
-yy842:
 	++YYCURSOR;
-#line 238 "../src/options/parse_opts.re"
-	{ *lang = Lang::V;       goto opt; }
-#line 3848 "src/options/parse_opts.cc"
+#line 207 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--time-report",      opt_time_report); }
+#line 3824 "src/options/parse_opts.cc"
+yy842:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy871;
+	goto yy250;
 yy843:
 	yych = *++YYCURSOR;
-	if (yych == 'g') goto yy851;
-	goto yy835;
+	if (yych == 'i') goto yy872;
+	goto yy250;
 yy844:
-	++YYCURSOR;
-#line 231 "../src/options/parse_opts.re"
-	{ *lang = Lang::GO;      goto opt; }
-#line 3857 "src/options/parse_opts.cc"
-yy845:
 	yych = *++YYCURSOR;
-	if (yych == 'k') goto yy852;
-	goto yy835;
+	if (yych <= 0x00) goto yy873;
+	goto yy250;
+yy845:
+	++YYCURSOR;
+#line 166 "../src/options/parse_opts.re"
+	{ opts.set_class_switch(true);       goto opt; }
+#line 3841 "src/options/parse_opts.cc"
 yy846:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy853;
-	goto yy835;
+	if (yych == 'n') goto yy874;
+	goto yy250;
 yy847:
-	++YYCURSOR;
-#line 234 "../src/options/parse_opts.re"
-	{ *lang = Lang::JS;      goto opt; }
-#line 3870 "src/options/parse_opts.cc"
-yy848:
 	yych = *++YYCURSOR;
-	if (yych == 'm') goto yy854;
-	goto yy835;
+	if (yych == 's') goto yy875;
+	goto yy250;
+yy848:
+	++YYCURSOR;
+#line 164 "../src/options/parse_opts.re"
+	{ opts.set_debug(true);              goto opt; }
+#line 3854 "src/options/parse_opts.cc"
 yy849:
 	yych = *++YYCURSOR;
-	if (yych == 'h') goto yy855;
-	goto yy835;
+	if (yych == 'i') goto yy876;
+	goto yy250;
 yy850:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy856;
-	goto yy835;
+	if (yych == 's') goto yy877;
+	goto yy250;
 yy851:
-	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy857;
-	goto yy835;
+	++YYCURSOR;
+#line 236 "../src/options/parse_opts.re"
+	{ global.set_dump_dfa_det(true);       goto opt; }
+#line 3867 "src/options/parse_opts.cc"
 yy852:
-	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy858;
-	goto yy835;
+	++YYCURSOR;
+#line 238 "../src/options/parse_opts.re"
+	{ global.set_dump_dfa_min(true);       goto opt; }
+#line 3872 "src/options/parse_opts.cc"
 yy853:
-	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy859;
-	goto yy835;
+	++YYCURSOR;
+#line 235 "../src/options/parse_opts.re"
+	{ global.set_dump_dfa_raw(true);       goto opt; }
+#line 3877 "src/options/parse_opts.cc"
 yy854:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy860;
-	goto yy835;
+	if (yych == 'p') goto yy878;
+	goto yy250;
 yy855:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy861;
-	goto yy835;
+	if (yych <= 0x00) goto yy879;
+	goto yy250;
 yy856:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy862;
-	goto yy835;
+	if (yych == 'c') goto yy880;
+	goto yy250;
 yy857:
-	++YYCURSOR;
-#line 239 "../src/options/parse_opts.re"
-	{ *lang = Lang::ZIG;     goto opt; }
-#line 3911 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'g') goto yy881;
+	goto yy250;
 yy858:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy863;
-	goto yy835;
+	if (yych == 'e') goto yy882;
+	goto yy250;
 yy859:
-	++YYCURSOR;
-#line 233 "../src/options/parse_opts.re"
-	{ *lang = Lang::JAVA;    goto opt; }
-#line 3920 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'u') goto yy883;
+	goto yy250;
 yy860:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy864;
-	goto yy835;
+	if (yych == 'a') goto yy884;
+	goto yy250;
 yy861:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy865;
-	goto yy835;
+	if (yych <= 0x00) goto yy885;
+	goto yy250;
 yy862:
-	++YYCURSOR;
-#line 237 "../src/options/parse_opts.re"
-	{ *lang = Lang::RUST;    goto opt; }
-#line 3933 "src/options/parse_opts.cc"
-yy863:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy866;
-	goto yy835;
-yy864:
+	if (yych == '-') goto yy886;
+	goto yy250;
+yy863:
 	++YYCURSOR;
-#line 235 "../src/options/parse_opts.re"
-	{ *lang = Lang::OCAML;   goto opt; }
-#line 3942 "src/options/parse_opts.cc"
+#line 228 "../src/options/parse_opts.re"
+	{ RET_FAIL(error("TDFA(0) algorithm was deprecated and removed")); }
+#line 3918 "src/options/parse_opts.cc"
+yy864:
+	yych = *++YYCURSOR;
+	if (yych == 'a') goto yy887;
+	goto yy250;
 yy865:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy867;
-	goto yy835;
+	if (yych == 's') goto yy888;
+	goto yy250;
 yy866:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy868;
-	goto yy835;
+	if (yych <= 0x00) goto yy889;
+	goto yy250;
 yy867:
-	++YYCURSOR;
-#line 236 "../src/options/parse_opts.re"
-	{ *lang = Lang::PYTHON;  goto opt; }
-#line 3955 "src/options/parse_opts.cc"
+	yych = *++YYCURSOR;
+	if (yych == 'l') goto yy890;
+	goto yy250;
 yy868:
+	yych = *++YYCURSOR;
+	if (yych == 'c') goto yy891;
+	goto yy250;
+yy869:
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy892;
+	goto yy250;
+yy870:
+	++YYCURSOR;
+#line 172 "../src/options/parse_opts.re"
+	{
+        global.set_code_model(CodeModel::LOOP_SWITCH);
+        opts.set_table_driven(true);
+        goto opt;
+    }
+#line 3951 "src/options/parse_opts.cc"
+yy871:
+	++YYCURSOR;
+#line 209 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--unroll-loops",     opt_unroll_loops); }
+#line 3956 "src/options/parse_opts.cc"
+yy872:
+	yych = *++YYCURSOR;
+	if (yych == 'v') goto yy893;
+	goto yy250;
+yy873:
+	++YYCURSOR;
+#line 179 "../src/options/parse_opts.re"
+	{ opts.set_case_inverted(true);      goto opt; }
+#line 3965 "src/options/parse_opts.cc"
+yy874:
+	yych = *++YYCURSOR;
+	if (yych == 's') goto yy894;
+	goto yy250;
+yy875:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy895;
+	goto yy250;
+yy876:
+	yych = *++YYCURSOR;
+	if (yych == 'o') goto yy896;
+	goto yy250;
+yy877:
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy897;
+	goto yy250;
+yy878:
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy898;
+	goto yy250;
+yy879:
+	++YYCURSOR;
+#line 234 "../src/options/parse_opts.re"
+	{ global.set_dump_dfa_tree(true);      goto opt; }
+#line 3990 "src/options/parse_opts.cc"
+yy880:
+	yych = *++YYCURSOR;
+	if (yych == 'y') goto yy899;
+	goto yy250;
+yy881:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy900;
+	goto yy250;
+yy882:
+	yych = *++YYCURSOR;
+	if (yych == 's') goto yy901;
+	goto yy250;
+yy883:
+	yych = *++YYCURSOR;
+	if (yych == 'r') goto yy902;
+	goto yy250;
+yy884:
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy903;
+	goto yy250;
+yy885:
+	++YYCURSOR;
+#line 153 "../src/options/parse_opts.re"
+	{ global.set_line_dirs(false);         goto opt; }
+#line 4015 "src/options/parse_opts.cc"
+yy886:
+	yych = *++YYCURSOR;
+	if (yych == 'd') goto yy904;
+	goto yy250;
+yy887:
+	yych = *++YYCURSOR;
+	if (yych == 'g') goto yy905;
+	goto yy250;
+yy888:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy906;
+	goto yy250;
+yy889:
+	++YYCURSOR;
+#line 229 "../src/options/parse_opts.re"
+	{ RET_FAIL(error("option --posix-closure was removed")); }
+#line 4032 "src/options/parse_opts.cc"
+yy890:
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy907;
+	goto yy250;
+yy891:
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy908;
+	goto yy250;
+yy892:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy909;
+	goto yy250;
+yy893:
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy910;
+	goto yy250;
+yy894:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy911;
+	goto yy250;
+yy895:
+	++YYCURSOR;
+#line 168 "../src/options/parse_opts.re"
+	{ opts.set_computed_gotos(true);     goto opt; }
+#line 4057 "src/options/parse_opts.cc"
+yy896:
+	yych = *++YYCURSOR;
+	if (yych == 'n') goto yy912;
+	goto yy250;
+yy897:
+	yych = *++YYCURSOR;
+	if (yych == 'a') goto yy913;
+	goto yy250;
+yy898:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy914;
+	goto yy250;
+yy899:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy915;
+	goto yy250;
+yy900:
+	++YYCURSOR;
+#line 215 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--input-encoding",   opt_input_encoding); }
+#line 4078 "src/options/parse_opts.cc"
+yy901:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy916;
+	goto yy250;
+yy902:
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy917;
+	goto yy250;
+yy903:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy918;
+	goto yy250;
+yy904:
+	yych = *++YYCURSOR;
+	if (yych == 'a') goto yy919;
+	goto yy250;
+yy905:
+	yych = *++YYCURSOR;
+	if (yych == 's') goto yy920;
+	goto yy250;
+yy906:
+	++YYCURSOR;
+#line 194 "../src/options/parse_opts.re"
+	{
+        opts.set_tags_posix_syntax(true);
+        opts.set_tags_posix_semantics(true);
+        goto opt;
+    }
+#line 4107 "src/options/parse_opts.cc"
+yy907:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy921;
+	goto yy250;
+yy908:
+	yych = *++YYCURSOR;
+	if (yych == 'i') goto yy922;
+	goto yy250;
+yy909:
+	++YYCURSOR;
+#line 150 "../src/options/parse_opts.re"
+	{ global.set_storable_state(true);     goto opt; }
+#line 4120 "src/options/parse_opts.cc"
+yy910:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy923;
+	goto yy250;
+yy911:
+	++YYCURSOR;
+#line 167 "../src/options/parse_opts.re"
+	{ opts.set_collapse_chains(true);    goto opt; }
+#line 4129 "src/options/parse_opts.cc"
+yy912:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy924;
+	goto yy250;
+yy913:
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy925;
+	goto yy250;
+yy914:
+	++YYCURSOR;
+#line 237 "../src/options/parse_opts.re"
+	{ global.set_dump_dfa_tagopt(true);    goto opt; }
+#line 4142 "src/options/parse_opts.cc"
+yy915:
+	++YYCURSOR;
+#line 211 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--encoding-policy",  opt_encoding_policy); }
+#line 4147 "src/options/parse_opts.cc"
+yy916:
+	++YYCURSOR;
+#line 182 "../src/options/parse_opts.re"
+	{ opts.set_invert_captures(true);    goto opt; }
+#line 4152 "src/options/parse_opts.cc"
+yy917:
+	yych = *++YYCURSOR;
+	if (yych == 's') goto yy926;
+	goto yy250;
+yy918:
+	++YYCURSOR;
+#line 214 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--location-format",  opt_location_format); }
+#line 4161 "src/options/parse_opts.cc"
+yy919:
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy927;
+	goto yy250;
+yy920:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy928;
+	goto yy250;
+yy921:
+	++YYCURSOR;
+#line 223 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--posix-prectable",  opt_posix_prectable); }
+#line 4174 "src/options/parse_opts.cc"
+yy922:
+	yych = *++YYCURSOR;
+	if (yych == 'o') goto yy929;
+	goto yy250;
+yy923:
+	++YYCURSOR;
+#line 178 "../src/options/parse_opts.re"
+	{ opts.set_case_insensitive(true);   goto opt; }
+#line 4183 "src/options/parse_opts.cc"
+yy924:
+	++YYCURSOR;
+#line 222 "../src/options/parse_opts.re"
+	{ NEXT_ARG("--dfa-minimization", opt_minimization); }
+#line 4188 "src/options/parse_opts.cc"
+yy925:
+	yych = *++YYCURSOR;
+	if (yych == 's') goto yy930;
+	goto yy250;
+yy926:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy931;
+	goto yy250;
+yy927:
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy932;
+	goto yy250;
+yy928:
+	++YYCURSOR;
+#line 225 "../src/options/parse_opts.re"
+	{ global.set_optimize_tags(false); goto opt; }
+#line 4205 "src/options/parse_opts.cc"
+yy929:
+	yych = *++YYCURSOR;
+	if (yych == 'n') goto yy933;
+	goto yy250;
+yy930:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy934;
+	goto yy250;
+yy931:
+	++YYCURSOR;
+#line 190 "../src/options/parse_opts.re"
+	{
+        opts.set_tags_posix_syntax(true);
+        goto opt;
+    }
+#line 4221 "src/options/parse_opts.cc"
+yy932:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy935;
+	goto yy250;
+yy933:
+	yych = *++YYCURSOR;
+	if (yych == 's') goto yy936;
+	goto yy250;
+yy934:
+	++YYCURSOR;
+#line 242 "../src/options/parse_opts.re"
+	{ global.set_dump_closure_stats(true); goto opt; }
+#line 4234 "src/options/parse_opts.cc"
+yy935:
+	++YYCURSOR;
+#line 154 "../src/options/parse_opts.re"
+	{ global.set_date(false);              goto opt; }
+#line 4239 "src/options/parse_opts.cc"
+yy936:
+	yych = *++YYCURSOR;
+	if (yych >= 0x01) goto yy250;
+	++YYCURSOR;
+#line 161 "../src/options/parse_opts.re"
+	{ global.set_code_model(CodeModel::REC_FUNC);    goto opt; }
+#line 4246 "src/options/parse_opts.cc"
+}
+#line 243 "../src/options/parse_opts.re"
+
+
+opt_lang: 
+#line 4252 "src/options/parse_opts.cc"
+{
+	char yych;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case 'c': goto yy940;
+		case 'd': goto yy941;
+		case 'g': goto yy942;
+		case 'h': goto yy943;
+		case 'j': goto yy944;
+		case 'o': goto yy945;
+		case 'p': goto yy946;
+		case 'r': goto yy947;
+		case 'v': goto yy948;
+		case 'z': goto yy949;
+		default: goto yy938;
+	}
+yy938:
+	++YYCURSOR;
+yy939:
+#line 246 "../src/options/parse_opts.re"
+	{
+        ERRARG("--lang",
+            "c | d | go | haskell | java | js | ocaml | python | rust | v | zig",
+            *argv);
+    }
+#line 4278 "src/options/parse_opts.cc"
+yy940:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy950;
+	goto yy939;
+yy941:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy951;
+	goto yy939;
+yy942:
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yych == 'o') goto yy952;
+	goto yy939;
+yy943:
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yych == 'a') goto yy954;
+	goto yy939;
+yy944:
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yych == 'a') goto yy955;
+	if (yych == 's') goto yy956;
+	goto yy939;
+yy945:
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yych == 'c') goto yy957;
+	goto yy939;
+yy946:
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yych == 'y') goto yy958;
+	goto yy939;
+yy947:
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yych == 'u') goto yy959;
+	goto yy939;
+yy948:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy960;
+	goto yy939;
+yy949:
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yych == 'i') goto yy961;
+	goto yy939;
+yy950:
+	++YYCURSOR;
+#line 251 "../src/options/parse_opts.re"
+	{ *lang = Lang::C;       goto opt; }
+#line 4324 "src/options/parse_opts.cc"
+yy951:
+	++YYCURSOR;
+#line 252 "../src/options/parse_opts.re"
+	{ *lang = Lang::D;       goto opt; }
+#line 4329 "src/options/parse_opts.cc"
+yy952:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy962;
+yy953:
+	YYCURSOR = YYMARKER;
+	goto yy939;
+yy954:
+	yych = *++YYCURSOR;
+	if (yych == 's') goto yy963;
+	goto yy953;
+yy955:
+	yych = *++YYCURSOR;
+	if (yych == 'v') goto yy964;
+	goto yy953;
+yy956:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy965;
+	goto yy953;
+yy957:
+	yych = *++YYCURSOR;
+	if (yych == 'a') goto yy966;
+	goto yy953;
+yy958:
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy967;
+	goto yy953;
+yy959:
+	yych = *++YYCURSOR;
+	if (yych == 's') goto yy968;
+	goto yy953;
+yy960:
+	++YYCURSOR;
+#line 260 "../src/options/parse_opts.re"
+	{ *lang = Lang::V;       goto opt; }
+#line 4364 "src/options/parse_opts.cc"
+yy961:
+	yych = *++YYCURSOR;
+	if (yych == 'g') goto yy969;
+	goto yy953;
+yy962:
+	++YYCURSOR;
+#line 253 "../src/options/parse_opts.re"
+	{ *lang = Lang::GO;      goto opt; }
+#line 4373 "src/options/parse_opts.cc"
+yy963:
+	yych = *++YYCURSOR;
+	if (yych == 'k') goto yy970;
+	goto yy953;
+yy964:
+	yych = *++YYCURSOR;
+	if (yych == 'a') goto yy971;
+	goto yy953;
+yy965:
+	++YYCURSOR;
+#line 256 "../src/options/parse_opts.re"
+	{ *lang = Lang::JS;      goto opt; }
+#line 4386 "src/options/parse_opts.cc"
+yy966:
+	yych = *++YYCURSOR;
+	if (yych == 'm') goto yy972;
+	goto yy953;
+yy967:
+	yych = *++YYCURSOR;
+	if (yych == 'h') goto yy973;
+	goto yy953;
+yy968:
+	yych = *++YYCURSOR;
+	if (yych == 't') goto yy974;
+	goto yy953;
+yy969:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy975;
+	goto yy953;
+yy970:
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy976;
+	goto yy953;
+yy971:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy977;
+	goto yy953;
+yy972:
+	yych = *++YYCURSOR;
+	if (yych == 'l') goto yy978;
+	goto yy953;
+yy973:
+	yych = *++YYCURSOR;
+	if (yych == 'o') goto yy979;
+	goto yy953;
+yy974:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy980;
+	goto yy953;
+yy975:
+	++YYCURSOR;
+#line 261 "../src/options/parse_opts.re"
+	{ *lang = Lang::ZIG;     goto opt; }
+#line 4427 "src/options/parse_opts.cc"
+yy976:
+	yych = *++YYCURSOR;
+	if (yych == 'l') goto yy981;
+	goto yy953;
+yy977:
+	++YYCURSOR;
+#line 255 "../src/options/parse_opts.re"
+	{ *lang = Lang::JAVA;    goto opt; }
+#line 4436 "src/options/parse_opts.cc"
+yy978:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy982;
+	goto yy953;
+yy979:
+	yych = *++YYCURSOR;
+	if (yych == 'n') goto yy983;
+	goto yy953;
+yy980:
+	++YYCURSOR;
+#line 259 "../src/options/parse_opts.re"
+	{ *lang = Lang::RUST;    goto opt; }
+#line 4449 "src/options/parse_opts.cc"
+yy981:
+	yych = *++YYCURSOR;
+	if (yych == 'l') goto yy984;
+	goto yy953;
+yy982:
+	++YYCURSOR;
+#line 257 "../src/options/parse_opts.re"
+	{ *lang = Lang::OCAML;   goto opt; }
+#line 4458 "src/options/parse_opts.cc"
+yy983:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy985;
+	goto yy953;
+yy984:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy986;
+	goto yy953;
+yy985:
+	++YYCURSOR;
+#line 258 "../src/options/parse_opts.re"
+	{ *lang = Lang::PYTHON;  goto opt; }
+#line 4471 "src/options/parse_opts.cc"
+yy986:
+	++YYCURSOR;
+#line 254 "../src/options/parse_opts.re"
+	{ *lang = Lang::HASKELL; goto opt; }
+#line 4476 "src/options/parse_opts.cc"
+}
+#line 262 "../src/options/parse_opts.re"
+
+
+opt_output: 
+#line 4482 "src/options/parse_opts.cc"
+{
+	char yych;
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
+	};
+	yych = *YYCURSOR;
+	if (yych <= 0x00) goto yy988;
+	if (yych != '-') goto yy989;
+yy988:
+	++YYCURSOR;
+#line 265 "../src/options/parse_opts.re"
+	{ ERRARG("-o, --output", "filename", *argv); }
+#line 4526 "src/options/parse_opts.cc"
+yy989:
+	yych = *++YYCURSOR;
+	if (yybm[0+yych] & 128) goto yy989;
+	++YYCURSOR;
+#line 266 "../src/options/parse_opts.re"
+	{ global.set_output_file(*argv); goto opt; }
+#line 4533 "src/options/parse_opts.cc"
+}
+#line 267 "../src/options/parse_opts.re"
+
+
+opt_header: 
+#line 4539 "src/options/parse_opts.cc"
+{
+	char yych;
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
+	};
+	yych = *YYCURSOR;
+	if (yych <= 0x00) goto yy991;
+	if (yych != '-') goto yy992;
+yy991:
+	++YYCURSOR;
+#line 270 "../src/options/parse_opts.re"
+	{ ERRARG("-t, --header, --type-header", "filename", *argv); }
+#line 4583 "src/options/parse_opts.cc"
+yy992:
+	yych = *++YYCURSOR;
+	if (yybm[0+yych] & 128) goto yy992;
+	++YYCURSOR;
+#line 271 "../src/options/parse_opts.re"
+	{ opts.set_header_file(*argv); goto opt; }
+#line 4590 "src/options/parse_opts.cc"
+}
+#line 272 "../src/options/parse_opts.re"
+
+
+opt_depfile: 
+#line 4596 "src/options/parse_opts.cc"
+{
+	char yych;
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
+	};
+	yych = *YYCURSOR;
+	if (yych <= 0x00) goto yy994;
+	if (yych != '-') goto yy995;
+yy994:
+	++YYCURSOR;
+#line 275 "../src/options/parse_opts.re"
+	{ ERRARG("--depfile", "filename", *argv); }
+#line 4640 "src/options/parse_opts.cc"
+yy995:
+	yych = *++YYCURSOR;
+	if (yybm[0+yych] & 128) goto yy995;
+	++YYCURSOR;
+#line 276 "../src/options/parse_opts.re"
+	{ global.set_dep_file(*argv); goto opt; }
+#line 4647 "src/options/parse_opts.cc"
+}
+#line 277 "../src/options/parse_opts.re"
+
+
+opt_syntax: 
+#line 4653 "src/options/parse_opts.cc"
+{
+	char yych;
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
+	};
+	yych = *YYCURSOR;
+	if (yych <= 0x00) goto yy997;
+	if (yych != '-') goto yy998;
+yy997:
+	++YYCURSOR;
+#line 280 "../src/options/parse_opts.re"
+	{ ERRARG("--syntax", "filename", *argv); }
+#line 4697 "src/options/parse_opts.cc"
+yy998:
+	yych = *++YYCURSOR;
+	if (yybm[0+yych] & 128) goto yy998;
+	++YYCURSOR;
+#line 281 "../src/options/parse_opts.re"
+	{ global.set_syntax_file(*argv); goto opt; }
+#line 4704 "src/options/parse_opts.cc"
+}
+#line 282 "../src/options/parse_opts.re"
+
+
+opt_cache_dir: 
+#line 4710 "src/options/parse_opts.cc"
+{
+	char yych;
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
+	};
+	yych = *YYCURSOR;
+	if (yych <= 0x00) goto yy1000;
+	if (yych != '-') goto yy1001;
+yy1000:
+	++YYCURSOR;
+#line 285 "../src/options/parse_opts.re"
+	{ ERRARG("--cache-dir", "directory", *argv); }
+#line 4754 "src/options/parse_opts.cc"
+yy1001:
+	yych = *++YYCURSOR;
+	if (yybm[0+yych] & 128) goto yy1001;
+	++YYCURSOR;
+#line 286 "../src/options/parse_opts.re"
+	{ global.set_cache_dir(*argv); goto opt; }
+#line 4761 "src/options/parse_opts.cc"
+}
+#line 287 "../src/options/parse_opts.re"
+
+
+opt_time_report: 
+#line 4767 "src/options/parse_opts.cc"
+{
+	char yych;
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
+	};
+	yych = *YYCURSOR;
+	if (yych <= 0x00) goto yy1003;
+	if (yych != '-') goto yy1004;
+yy1003:
+	++YYCURSOR;
+#line 290 "../src/options/parse_opts.re"
+	{ ERRARG("--time-report", "filename", *argv); }
+#line 4811 "src/options/parse_opts.cc"
+yy1004:
+	yych = *++YYCURSOR;
+	if (yybm[0+yych] & 128) goto yy1004;
 	++YYCURSOR;
-#line 232 "../src/options/parse_opts.re"
-	{ *lang = Lang::HASKELL; goto opt; }
-#line 3960 "src/options/parse_opts.cc"
+#line 291 "../src/options/parse_opts.re"
+	{ global.set_time_report(*argv); goto opt; }
+#line 4818 "src/options/parse_opts.cc"
 }
-#line 240 "../src/options/parse_opts.re"
+#line 292 "../src/options/parse_opts.re"
 
 
-opt_output: 
-#line 3966 "src/options/parse_opts.cc"
+opt_profile_use: 
+#line 4824 "src/options/parse_opts.cc"
 {
 	char yych;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
 	};
 	yych = *YYCURSOR;
-	if (yych <= 0x00) goto yy870;
-	if (yych != '-') goto yy871;
-yy870:
+	if (yych <= 0x00) goto yy1006;
+	if (yych != '-') goto yy1007;
+yy1006:
 	++YYCURSOR;
-#line 243 "../src/options/parse_opts.re"
-	{ ERRARG("-o, --output", "filename", *argv); }
-#line 4010 "src/options/parse_opts.cc"
-yy871:
+#line 295 "../src/options/parse_opts.re"
+	{ ERRARG("--profile-use", "filename", *argv); }
+#line 4868 "src/options/parse_opts.cc"
+yy1007:
 	yych = *++YYCURSOR;
-	if (yybm[0+yych] & 128) {
-		goto yy871;
-	}
+	if (yybm[0+yych] & 128) goto yy1007;
 	++YYCURSOR;
-#line 244 "../src/options/parse_opts.re"
-	{ global.set_output_file(*argv); goto opt; }
-#line 4019 "src/options/parse_opts.cc"
+#line 296 "../src/options/parse_opts.re"
+	{ global.set_profile_use(*argv); goto opt; }
+#line 4875 "src/options/parse_opts.cc"
 }
-#line 245 "../src/options/parse_opts.re"
+#line 297 "../src/options/parse_opts.re"
 
 
-opt_header: 
-#line 4025 "src/options/parse_opts.cc"
+opt_batch: 
+#line 4881 "src/options/parse_opts.cc"
 {
 	char yych;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
 	};
 	yych = *YYCURSOR;
-	if (yych <= 0x00) goto yy873;
-	if (yych != '-') goto yy874;
-yy873:
+	if (yych <= 0x00) goto yy1009;
+	if (yych != '-') goto yy1010;
+yy1009:
 	++YYCURSOR;
-#line 248 "../src/options/parse_opts.re"
-	{ ERRARG("-t, --header, --type-header", "filename", *argv); }
-#line 4069 "src/options/parse_opts.cc"
-yy874:
+#line 300 "../src/options/parse_opts.re"
+	{ ERRARG("--batch", "filename", *argv); }
+#line 4925 "src/options/parse_opts.cc"
+yy1010:
 	yych = *++YYCURSOR;
-	if (yybm[0+yych] & 128) {
-		goto yy874;
-	}
+	if (yybm[0+yych] & 128) goto yy1010;
 	++YYCURSOR;
-#line 249 "../src/options/parse_opts.re"
-	{ opts.set_header_file(*argv); goto opt; }
-#line 4078 "src/options/parse_opts.cc"
+#line 301 "../src/options/parse_opts.re"
+	{ global.set_batch_file(*argv); goto opt; }
+#line 4932 "src/options/parse_opts.cc"
 }
-#line 250 "../src/options/parse_opts.re"
+#line 302 "../src/options/parse_opts.re"
 
 
-opt_depfile: 
-#line 4084 "src/options/parse_opts.cc"
+opt_jobs: 
+#line 4938 "src/options/parse_opts.cc"
 {
 	char yych;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	yych = *YYCURSOR;
-	if (yych <= 0x00) goto yy876;
-	if (yych != '-') goto yy877;
-yy876:
+	if (yych <= '0') goto yy1012;
+	if (yych <= '9') goto yy1014;
+yy1012:
 	++YYCURSOR;
-#line 253 "../src/options/parse_opts.re"
-	{ ERRARG("--depfile", "filename", *argv); }
-#line 4128 "src/options/parse_opts.cc"
-yy877:
-	yych = *++YYCURSOR;
-	if (yybm[0+yych] & 128) {
-		goto yy877;
-	}
+yy1013:
+#line 305 "../src/options/parse_opts.re"
+	{ ERRARG("-j, --jobs", "positive number", *argv); }
+#line 4983 "src/options/parse_opts.cc"
+yy1014:
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yybm[0+yych] & 128) goto yy1016;
+	if (yych >= 0x01) goto yy1013;
+yy1015:
 	++YYCURSOR;
-#line 254 "../src/options/parse_opts.re"
-	{ global.set_dep_file(*argv); goto opt; }
-#line 4137 "src/options/parse_opts.cc"
+#line 306 "../src/options/parse_opts.re"
+	{
+        uint32_t n;
+        const uint8_t* s = reinterpret_cast<const uint8_t*>(*argv);
+        const uint8_t* e = reinterpret_cast<const uint8_t*>(YYCURSOR) - 1;
+        if (!s_to_u32_unsafe(s, e, n)) ERRARG("-j, --jobs", "positive number", *argv);
+        global.set_jobs(n);
+        goto opt;
+    }
+#line 4999 "src/options/parse_opts.cc"
+yy1016:
+	yych = *++YYCURSOR;
+	if (yybm[0+yych] & 128) goto yy1016;
+	if (yych <= 0x00) goto yy1015;
+	YYCURSOR = YYMARKER;
+	goto yy1013;
 }
-#line 255 "../src/options/parse_opts.re"
+#line 314 "../src/options/parse_opts.re"
 
 
-opt_syntax: 
-#line 4143 "src/options/parse_opts.cc"
+opt_unroll_loops: 
+#line 5011 "src/options/parse_opts.cc"
 {
 	char yych;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	yych = *YYCURSOR;
-	if (yych <= 0x00) goto yy879;
-	if (yych != '-') goto yy880;
-yy879:
+	if (yych <= '/') goto yy1018;
+	if (yych <= '9') goto yy1020;
+yy1018:
 	++YYCURSOR;
-#line 258 "../src/options/parse_opts.re"
-	{ ERRARG("--syntax", "filename", *argv); }
-#line 4187 "src/options/parse_opts.cc"
-yy880:
-	yych = *++YYCURSOR;
-	if (yybm[0+yych] & 128) {
-		goto yy880;
-	}
+yy1019:
+#line 317 "../src/options/parse_opts.re"
+	{ ERRARG("--unroll-loops", "nonnegative number", *argv); }
+#line 5056 "src/options/parse_opts.cc"
+yy1020:
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yybm[0+yych] & 128) goto yy1022;
+	if (yych >= 0x01) goto yy1019;
+yy1021:
 	++YYCURSOR;
-#line 259 "../src/options/parse_opts.re"
-	{ global.set_syntax_file(*argv); goto opt; }
-#line 4196 "src/options/parse_opts.cc"
+#line 318 "../src/options/parse_opts.re"
+	{
+        uint32_t n;
+        const uint8_t* s = reinterpret_cast<const uint8_t*>(*argv);
+        const uint8_t* e = reinterpret_cast<const uint8_t*>(YYCURSOR) - 1;
+        if (!s_to_u32_unsafe(s, e, n)) ERRARG("--unroll-loops", "nonnegative number", *argv);
+        opts.set_unroll_loops(n);
+        goto opt;
+    }
+#line 5072 "src/options/parse_opts.cc"
+yy1022:
+	yych = *++YYCURSOR;
+	if (yybm[0+yych] & 128) goto yy1022;
+	if (yych <= 0x00) goto yy1021;
+	YYCURSOR = YYMARKER;
+	goto yy1019;
 }
-#line 260 "../src/options/parse_opts.re"
+#line 326 "../src/options/parse_opts.re"
 
 
 opt_incpath: 
-#line 4202 "src/options/parse_opts.cc"
+#line 5084 "src/options/parse_opts.cc"
 {
 	char yych;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
 	};
 	yych = *YYCURSOR;
-	if (yych <= 0x00) goto yy882;
-	if (yych != '-') goto yy883;
-yy882:
+	if (yych <= 0x00) goto yy1024;
+	if (yych != '-') goto yy1025;
+yy1024:
 	++YYCURSOR;
-#line 263 "../src/options/parse_opts.re"
+#line 329 "../src/options/parse_opts.re"
 	{ ERRARG("-I", "filename", *argv); }
-#line 4246 "src/options/parse_opts.cc"
-yy883:
+#line 5128 "src/options/parse_opts.cc"
+yy1025:
 	yych = *++YYCURSOR;
-	if (yybm[0+yych] & 128) {
-		goto yy883;
-	}
+	if (yybm[0+yych] & 128) goto yy1025;
 	++YYCURSOR;
-#line 265 "../src/options/parse_opts.re"
+#line 331 "../src/options/parse_opts.re"
 	{ const_cast<std::vector<std::string>&>(global.include_paths).push_back(*argv); goto opt; }
-#line 4255 "src/options/parse_opts.cc"
+#line 5135 "src/options/parse_opts.cc"
 }
-#line 266 "../src/options/parse_opts.re"
+#line 332 "../src/options/parse_opts.re"
 
 
 opt_encoding_policy: 
-#line 4261 "src/options/parse_opts.cc"
+#line 5141 "src/options/parse_opts.cc"
 {
 	char yych;
 	yych = *YYCURSOR;
 	if (yych <= 'h') {
-		if (yych == 'f') goto yy886;
+		if (yych == 'f') goto yy1028;
 	} else {
-		if (yych <= 'i') goto yy887;
-		if (yych == 's') goto yy888;
+		if (yych <= 'i') goto yy1029;
+		if (yych == 's') goto yy1030;
 	}
 	++YYCURSOR;
-yy885:
-#line 269 "../src/options/parse_opts.re"
+yy1027:
+#line 335 "../src/options/parse_opts.re"
 	{ ERRARG("--encoding-policy", "ignore | substitute | fail", *argv); }
-#line 4275 "src/options/parse_opts.cc"
-yy886:
+#line 5155 "src/options/parse_opts.cc"
+yy1028:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy889;
-	goto yy885;
-yy887:
+	if (yych == 'a') goto yy1031;
+	goto yy1027;
+yy1029:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'g') goto yy891;
-	goto yy885;
-yy888:
+	if (yych == 'g') goto yy1033;
+	goto yy1027;
+yy1030:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'u') goto yy892;
-	goto yy885;
-yy889:
+	if (yych == 'u') goto yy1034;
+	goto yy1027;
+yy1031:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy893;
-yy890:
+	if (yych == 'i') goto yy1035;
+yy1032:
 	YYCURSOR = YYMARKER;
-	goto yy885;
-yy891:
+	goto yy1027;
+yy1033:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy894;
-	goto yy890;
-yy892:
+	if (yych == 'n') goto yy1036;
+	goto yy1032;
+yy1034:
 	yych = *++YYCURSOR;
-	if (yych == 'b') goto yy895;
-	goto yy890;
-yy893:
+	if (yych == 'b') goto yy1037;
+	goto yy1032;
+yy1035:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy896;
-	goto yy890;
-yy894:
+	if (yych == 'l') goto yy1038;
+	goto yy1032;
+yy1036:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy897;
-	goto yy890;
-yy895:
+	if (yych == 'o') goto yy1039;
+	goto yy1032;
+yy1037:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy898;
-	goto yy890;
-yy896:
+	if (yych == 's') goto yy1040;
+	goto yy1032;
+yy1038:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy899;
-	goto yy890;
-yy897:
+	if (yych <= 0x00) goto yy1041;
+	goto yy1032;
+yy1039:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy900;
-	goto yy890;
-yy898:
+	if (yych == 'r') goto yy1042;
+	goto yy1032;
+yy1040:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy901;
-	goto yy890;
-yy899:
+	if (yych == 't') goto yy1043;
+	goto yy1032;
+yy1041:
 	++YYCURSOR;
-#line 272 "../src/options/parse_opts.re"
+#line 338 "../src/options/parse_opts.re"
 	{ opts.set_encoding_policy(Enc::Policy::FAIL);       goto opt; }
-#line 4330 "src/options/parse_opts.cc"
-yy900:
+#line 5210 "src/options/parse_opts.cc"
+yy1042:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy902;
-	goto yy890;
-yy901:
+	if (yych == 'e') goto yy1044;
+	goto yy1032;
+yy1043:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy903;
-	goto yy890;
-yy902:
+	if (yych == 'i') goto yy1045;
+	goto yy1032;
+yy1044:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy904;
-	goto yy890;
-yy903:
+	if (yych <= 0x00) goto yy1046;
+	goto yy1032;
+yy1045:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy905;
-	goto yy890;
-yy904:
+	if (yych == 't') goto yy1047;
+	goto yy1032;
+yy1046:
 	++YYCURSOR;
-#line 270 "../src/options/parse_opts.re"
+#line 336 "../src/options/parse_opts.re"
 	{ opts.set_encoding_policy(Enc::Policy::IGNORE);     goto opt; }
-#line 4351 "src/options/parse_opts.cc"
-yy905:
+#line 5231 "src/options/parse_opts.cc"
+yy1047:
 	yych = *++YYCURSOR;
-	if (yych != 'u') goto yy890;
+	if (yych != 'u') goto yy1032;
 	yych = *++YYCURSOR;
-	if (yych != 't') goto yy890;
+	if (yych != 't') goto yy1032;
 	yych = *++YYCURSOR;
-	if (yych != 'e') goto yy890;
+	if (yych != 'e') goto yy1032;
 	yych = *++YYCURSOR;
-	if (yych >= 0x01) goto yy890;
+	if (yych >= 0x01) goto yy1032;
 	++YYCURSOR;
-#line 271 "../src/options/parse_opts.re"
+#line 337 "../src/options/parse_opts.re"
 	{ opts.set_encoding_policy(Enc::Policy::SUBSTITUTE); goto opt; }
-#line 4364 "src/options/parse_opts.cc"
+#line 5244 "src/options/parse_opts.cc"
 }
-#line 273 "../src/options/parse_opts.re"
+#line 339 "../src/options/parse_opts.re"
 
 
 opt_input: 
-#line 4370 "src/options/parse_opts.cc"
+#line 5250 "src/options/parse_opts.cc"
 {
 	char yych;
 	yych = *YYCURSOR;
 	if (yych <= 'd') {
-		if (yych <= 'b') goto yy907;
-		if (yych <= 'c') goto yy909;
-		goto yy910;
+		if (yych <= 'b') goto yy1049;
+		if (yych <= 'c') goto yy1051;
+		goto yy1052;
 	} else {
-		if (yych == 'r') goto yy911;
+		if (yych == 'r') goto yy1053;
 	}
-yy907:
+yy1049:
 	++YYCURSOR;
-yy908:
-#line 276 "../src/options/parse_opts.re"
+yy1050:
+#line 342 "../src/options/parse_opts.re"
 	{ ERRARG("--api, --input", "default | custom | record", *argv); }
-#line 4386 "src/options/parse_opts.cc"
-yy909:
+#line 5266 "src/options/parse_opts.cc"
+yy1051:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'u') goto yy912;
-	goto yy908;
-yy910:
+	if (yych == 'u') goto yy1054;
+	goto yy1050;
+yy1052:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'e') goto yy914;
-	goto yy908;
-yy911:
+	if (yych == 'e') goto yy1056;
+	goto yy1050;
+yy1053:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'e') goto yy915;
-	goto yy908;
-yy912:
+	if (yych == 'e') goto yy1057;
+	goto yy1050;
+yy1054:
 	yych = *++YYCURSOR;
-	if (yych == 's') goto yy916;
-yy913:
+	if (yych == 's') goto yy1058;
+yy1055:
 	YYCURSOR = YYMARKER;
-	goto yy908;
-yy914:
+	goto yy1050;
+yy1056:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy917;
-	goto yy913;
-yy915:
+	if (yych == 'f') goto yy1059;
+	goto yy1055;
+yy1057:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy918;
-	goto yy913;
-yy916:
+	if (yych == 'c') goto yy1060;
+	goto yy1055;
+yy1058:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy919;
-	goto yy913;
-yy917:
+	if (yych == 't') goto yy1061;
+	goto yy1055;
+yy1059:
 	yych = *++YYCURSOR;
-	if (yych == 'a') goto yy920;
-	goto yy913;
-yy918:
+	if (yych == 'a') goto yy1062;
+	goto yy1055;
+yy1060:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy921;
-	goto yy913;
-yy919:
+	if (yych == 'o') goto yy1063;
+	goto yy1055;
+yy1061:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy922;
-	goto yy913;
-yy920:
+	if (yych == 'o') goto yy1064;
+	goto yy1055;
+yy1062:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy923;
-	goto yy913;
-yy921:
+	if (yych == 'u') goto yy1065;
+	goto yy1055;
+yy1063:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy924;
-	goto yy913;
-yy922:
+	if (yych == 'r') goto yy1066;
+	goto yy1055;
+yy1064:
 	yych = *++YYCURSOR;
-	if (yych == 'm') goto yy925;
-	goto yy913;
-yy923:
+	if (yych == 'm') goto yy1067;
+	goto yy1055;
+yy1065:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy926;
-	goto yy913;
-yy924:
+	if (yych == 'l') goto yy1068;
+	goto yy1055;
+yy1066:
 	yych = *++YYCURSOR;
-	if (yych == 'd') goto yy927;
-	goto yy913;
-yy925:
+	if (yych == 'd') goto yy1069;
+	goto yy1055;
+yy1067:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy928;
-	goto yy913;
-yy926:
+	if (yych <= 0x00) goto yy1070;
+	goto yy1055;
+yy1068:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy929;
-	goto yy913;
-yy927:
+	if (yych == 't') goto yy1071;
+	goto yy1055;
+yy1069:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy930;
-	goto yy913;
-yy928:
+	if (yych <= 0x00) goto yy1072;
+	goto yy1055;
+yy1070:
 	++YYCURSOR;
-#line 278 "../src/options/parse_opts.re"
+#line 344 "../src/options/parse_opts.re"
 	{ opts.set_api(Api::CUSTOM);  goto opt; }
-#line 4465 "src/options/parse_opts.cc"
-yy929:
+#line 5345 "src/options/parse_opts.cc"
+yy1071:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy931;
-	goto yy913;
-yy930:
+	if (yych <= 0x00) goto yy1073;
+	goto yy1055;
+yy1072:
 	++YYCURSOR;
-#line 279 "../src/options/parse_opts.re"
+#line 345 "../src/options/parse_opts.re"
 	{ opts.set_api(Api::RECORD);  goto opt; }
-#line 4474 "src/options/parse_opts.cc"
-yy931:
+#line 5354 "src/options/parse_opts.cc"
+yy1073:
 	++YYCURSOR;
-#line 277 "../src/options/parse_opts.re"
+#line 343 "../src/options/parse_opts.re"
 	{ opts.set_api(Api::DEFAULT); goto opt; }
-#line 4479 "src/options/parse_opts.cc"
+#line 5359 "src/options/parse_opts.cc"
 }
-#line 280 "../src/options/parse_opts.re"
+#line 346 "../src/options/parse_opts.re"
 
 
 opt_empty_class: 
-#line 4485 "src/options/parse_opts.cc"
+#line 5365 "src/options/parse_opts.cc"
 {
 	char yych;
 	yych = *YYCURSOR;
-	if (yych == 'e') goto yy934;
-	if (yych == 'm') goto yy935;
+	if (yych == 'e') goto yy1076;
+	if (yych == 'm') goto yy1077;
 	++YYCURSOR;
-yy933:
-#line 283 "../src/options/parse_opts.re"
+yy1075:
+#line 349 "../src/options/parse_opts.re"
 	{ ERRARG("--empty-class", "match-empty | match-none | error", *argv); }
-#line 4495 "src/options/parse_opts.cc"
-yy934:
+#line 5375 "src/options/parse_opts.cc"
+yy1076:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'r') goto yy936;
-	goto yy933;
-yy935:
+	if (yych == 'r') goto yy1078;
+	goto yy1075;
+yy1077:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy938;
-	goto yy933;
-yy936:
+	if (yych == 'a') goto yy1080;
+	goto yy1075;
+yy1078:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy939;
-yy937:
+	if (yych == 'r') goto yy1081;
+yy1079:
 	YYCURSOR = YYMARKER;
-	goto yy933;
-yy938:
+	goto yy1075;
+yy1080:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy940;
-	goto yy937;
-yy939:
+	if (yych == 't') goto yy1082;
+	goto yy1079;
+yy1081:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy941;
-	goto yy937;
-yy940:
+	if (yych == 'o') goto yy1083;
+	goto yy1079;
+yy1082:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy942;
-	goto yy937;
-yy941:
+	if (yych == 'c') goto yy1084;
+	goto yy1079;
+yy1083:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy943;
-	goto yy937;
-yy942:
+	if (yych == 'r') goto yy1085;
+	goto yy1079;
+yy1084:
 	yych = *++YYCURSOR;
-	if (yych == 'h') goto yy944;
-	goto yy937;
-yy943:
+	if (yych == 'h') goto yy1086;
+	goto yy1079;
+yy1085:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy945;
-	goto yy937;
-yy944:
+	if (yych <= 0x00) goto yy1087;
+	goto yy1079;
+yy1086:
 	yych = *++YYCURSOR;
-	if (yych == '-') goto yy946;
-	goto yy937;
-yy945:
+	if (yych == '-') goto yy1088;
+	goto yy1079;
+yy1087:
 	++YYCURSOR;
-#line 286 "../src/options/parse_opts.re"
+#line 352 "../src/options/parse_opts.re"
 	{ opts.set_empty_class(EmptyClass::ERROR);       goto opt; }
-#line 4542 "src/options/parse_opts.cc"
-yy946:
+#line 5422 "src/options/parse_opts.cc"
+yy1088:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy947;
-	if (yych == 'n') goto yy948;
-	goto yy937;
-yy947:
+	if (yych == 'e') goto yy1089;
+	if (yych == 'n') goto yy1090;
+	goto yy1079;
+yy1089:
 	yych = *++YYCURSOR;
-	if (yych == 'm') goto yy949;
-	goto yy937;
-yy948:
+	if (yych == 'm') goto yy1091;
+	goto yy1079;
+yy1090:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy950;
-	goto yy937;
-yy949:
+	if (yych == 'o') goto yy1092;
+	goto yy1079;
+yy1091:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy951;
-	goto yy937;
-yy950:
+	if (yych == 'p') goto yy1093;
+	goto yy1079;
+yy1092:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy952;
-	goto yy937;
-yy951:
+	if (yych == 'n') goto yy1094;
+	goto yy1079;
+yy1093:
 	yych = *++YYCURSOR;
-	if (yych == 't') goto yy953;
-	goto yy937;
-yy952:
+	if (yych == 't') goto yy1095;
+	goto yy1079;
+yy1094:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy954;
-	goto yy937;
-yy953:
+	if (yych == 'e') goto yy1096;
+	goto yy1079;
+yy1095:
 	yych = *++YYCURSOR;
-	if (yych == 'y') goto yy955;
-	goto yy937;
-yy954:
+	if (yych == 'y') goto yy1097;
+	goto yy1079;
+yy1096:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy956;
-	goto yy937;
-yy955:
+	if (yych <= 0x00) goto yy1098;
+	goto yy1079;
+yy1097:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy957;
-	goto yy937;
-yy956:
+	if (yych <= 0x00) goto yy1099;
+	goto yy1079;
+yy1098:
 	++YYCURSOR;
-#line 285 "../src/options/parse_opts.re"
+#line 351 "../src/options/parse_opts.re"
 	{ opts.set_empty_class(EmptyClass::MATCH_NONE);  goto opt; }
-#line 4588 "src/options/parse_opts.cc"
-yy957:
+#line 5468 "src/options/parse_opts.cc"
+yy1099:
 	++YYCURSOR;
-#line 284 "../src/options/parse_opts.re"
+#line 350 "../src/options/parse_opts.re"
 	{ opts.set_empty_class(EmptyClass::MATCH_EMPTY); goto opt; }
-#line 4593 "src/options/parse_opts.cc"
+#line 5473 "src/options/parse_opts.cc"
 }
-#line 287 "../src/options/parse_opts.re"
+#line 353 "../src/options/parse_opts.re"
 
 
 opt_location_format: 
-#line 4599 "src/options/parse_opts.cc"
+#line 5479 "src/options/parse_opts.cc"
 {
 	char yych;
 	yych = *YYCURSOR;
-	if (yych == 'g') goto yy960;
-	if (yych == 'm') goto yy961;
+	if (yych == 'g') goto yy1102;
+	if (yych == 'm') goto yy1103;
 	++YYCURSOR;
-yy959:
-#line 290 "../src/options/parse_opts.re"
+yy1101:
+#line 356 "../src/options/parse_opts.re"
 	{ ERRARG("--location-format", "gnu | msvc", *argv); }
-#line 4609 "src/options/parse_opts.cc"
-yy960:
+#line 5489 "src/options/parse_opts.cc"
+yy1102:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'n') goto yy962;
-	goto yy959;
-yy961:
+	if (yych == 'n') goto yy1104;
+	goto yy1101;
+yy1103:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 's') goto yy964;
-	goto yy959;
-yy962:
+	if (yych == 's') goto yy1106;
+	goto yy1101;
+yy1104:
 	yych = *++YYCURSOR;
-	if (yych == 'u') goto yy965;
-yy963:
+	if (yych == 'u') goto yy1107;
+yy1105:
 	YYCURSOR = YYMARKER;
-	goto yy959;
-yy964:
+	goto yy1101;
+yy1106:
 	yych = *++YYCURSOR;
-	if (yych == 'v') goto yy966;
-	goto yy963;
-yy965:
+	if (yych == 'v') goto yy1108;
+	goto yy1105;
+yy1107:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy967;
-	goto yy963;
-yy966:
+	if (yych <= 0x00) goto yy1109;
+	goto yy1105;
+yy1108:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy968;
-	goto yy963;
-yy967:
+	if (yych == 'c') goto yy1110;
+	goto yy1105;
+yy1109:
 	++YYCURSOR;
-#line 291 "../src/options/parse_opts.re"
+#line 357 "../src/options/parse_opts.re"
 	{ msg.locfmt = LOCFMT_GNU;  goto opt; }
-#line 4640 "src/options/parse_opts.cc"
-yy968:
+#line 5520 "src/options/parse_opts.cc"
+yy1110:
 	yych = *++YYCURSOR;
-	if (yych >= 0x01) goto yy963;
+	if (yych >= 0x01) goto yy1105;
 	++YYCURSOR;
-#line 292 "../src/options/parse_opts.re"
+#line 358 "../src/options/parse_opts.re"
 	{ msg.locfmt = LOCFMT_MSVC; goto opt; }
-#line 4647 "src/options/parse_opts.cc"
+#line 5527 "src/options/parse_opts.cc"
 }
-#line 293 "../src/options/parse_opts.re"
+#line 359 "../src/options/parse_opts.re"
 
 
 opt_input_encoding: 
-#line 4653 "src/options/parse_opts.cc"
+#line 5533 "src/options/parse_opts.cc"
 {
 	char yych;
 	yych = *YYCURSOR;
-	if (yych == 'a') goto yy971;
-	if (yych == 'u') goto yy972;
+	if (yych == 'a') goto yy1113;
+	if (yych == 'u') goto yy1114;
 	++YYCURSOR;
-yy970:
-#line 296 "../src/options/parse_opts.re"
+yy1112:
+#line 362 "../src/options/parse_opts.re"
 	{ ERRARG("--input-encoding", "ascii | utf8 ", *argv); }
-#line 4663 "src/options/parse_opts.cc"
-yy971:
+#line 5543 "src/options/parse_opts.cc"
+yy1113:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 's') goto yy973;
-	goto yy970;
-yy972:
+	if (yych == 's') goto yy1115;
+	goto yy1112;
+yy1114:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 't') goto yy975;
-	goto yy970;
-yy973:
+	if (yych == 't') goto yy1117;
+	goto yy1112;
+yy1115:
 	yych = *++YYCURSOR;
-	if (yych == 'c') goto yy976;
-yy974:
+	if (yych == 'c') goto yy1118;
+yy1116:
 	YYCURSOR = YYMARKER;
-	goto yy970;
-yy975:
+	goto yy1112;
+yy1117:
 	yych = *++YYCURSOR;
-	if (yych == 'f') goto yy977;
-	goto yy974;
-yy976:
+	if (yych == 'f') goto yy1119;
+	goto yy1116;
+yy1118:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy978;
-	goto yy974;
-yy977:
+	if (yych == 'i') goto yy1120;
+	goto yy1116;
+yy1119:
 	yych = *++YYCURSOR;
-	if (yych == '8') goto yy979;
-	goto yy974;
-yy978:
+	if (yych == '8') goto yy1121;
+	goto yy1116;
+yy1120:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy980;
-	goto yy974;
-yy979:
+	if (yych == 'i') goto yy1122;
+	goto yy1116;
+yy1121:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy981;
-	goto yy974;
-yy980:
+	if (yych <= 0x00) goto yy1123;
+	goto yy1116;
+yy1122:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy982;
-	goto yy974;
-yy981:
+	if (yych <= 0x00) goto yy1124;
+	goto yy1116;
+yy1123:
 	++YYCURSOR;
-#line 298 "../src/options/parse_opts.re"
+#line 364 "../src/options/parse_opts.re"
 	{ global.set_input_encoding(Enc::Type::UTF8);  goto opt; }
-#line 4706 "src/options/parse_opts.cc"
-yy982:
+#line 5586 "src/options/parse_opts.cc"
+yy1124:
 	++YYCURSOR;
-#line 297 "../src/options/parse_opts.re"
+#line 363 "../src/options/parse_opts.re"
 	{ global.set_input_encoding(Enc::Type::ASCII); goto opt; }
-#line 4711 "src/options/parse_opts.cc"
+#line 5591 "src/options/parse_opts.cc"
 }
-#line 299 "../src/options/parse_opts.re"
+#line 365 "../src/options/parse_opts.re"
 
 
 opt_minimization: 
-#line 4717 "src/options/parse_opts.cc"
+#line 5597 "src/options/parse_opts.cc"
 {
 	char yych;
 	yych = *YYCURSOR;
-	if (yych == 'm') goto yy985;
-	if (yych == 't') goto yy986;
+	if (yych <= 'l') {
+		if (yych == 'h') goto yy1127;
+	} else {
+		if (yych <= 'm') goto yy1128;
+		if (yych == 't') goto yy1129;
+	}
 	++YYCURSOR;
-yy984:
-#line 302 "../src/options/parse_opts.re"
-	{ ERRARG("--dfa-minimization", "table | moore", *argv); }
-#line 4727 "src/options/parse_opts.cc"
-yy985:
+yy1126:
+#line 368 "../src/options/parse_opts.re"
+	{ ERRARG("--dfa-minimization", "table | moore | hopcroft", *argv); }
+#line 5611 "src/options/parse_opts.cc"
+yy1127:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'o') goto yy987;
-	goto yy984;
-yy986:
+	if (yych == 'o') goto yy1130;
+	goto yy1126;
+yy1128:
+	yych = *(YYMARKER = ++YYCURSOR);
+	if (yych == 'o') goto yy1132;
+	goto yy1126;
+yy1129:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy989;
-	goto yy984;
-yy987:
+	if (yych == 'a') goto yy1133;
+	goto yy1126;
+yy1130:
 	yych = *++YYCURSOR;
-	if (yych == 'o') goto yy990;
-yy988:
+	if (yych == 'p') goto yy1134;
+yy1131:
 	YYCURSOR = YYMARKER;
-	goto yy984;
-yy989:
+	goto yy1126;
+yy1132:
 	yych = *++YYCURSOR;
-	if (yych == 'b') goto yy991;
-	goto yy988;
-yy990:
+	if (yych == 'o') goto yy1135;
+	goto yy1131;
+yy1133:
 	yych = *++YYCURSOR;
-	if (yych == 'r') goto yy992;
-	goto yy988;
-yy991:
+	if (yych == 'b') goto yy1136;
+	goto yy1131;
+yy1134:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy993;
-	goto yy988;
-yy992:
+	if (yych == 'c') goto yy1137;
+	goto yy1131;
+yy1135:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy994;
-	goto yy988;
-yy993:
+	if (yych == 'r') goto yy1138;
+	goto yy1131;
+yy1136:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy995;
-	goto yy988;
-yy994:
+	if (yych == 'l') goto yy1139;
+	goto yy1131;
+yy1137:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy996;
-	goto yy988;
-yy995:
+	if (yych == 'r') goto yy1140;
+	goto yy1131;
+yy1138:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy997;
-	goto yy988;
-yy996:
+	if (yych == 'e') goto yy1141;
+	goto yy1131;
+yy1139:
+	yych = *++YYCURSOR;
+	if (yych == 'e') goto yy1142;
+	goto yy1131;
+yy1140:
+	yych = *++YYCURSOR;
+	if (yych == 'o') goto yy1143;
+	goto yy1131;
+yy1141:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy1144;
+	goto yy1131;
+yy1142:
+	yych = *++YYCURSOR;
+	if (yych <= 0x00) goto yy1145;
+	goto yy1131;
+yy1143:
+	yych = *++YYCURSOR;
+	if (yych == 'f') goto yy1146;
+	goto yy1131;
+yy1144:
 	++YYCURSOR;
-#line 304 "../src/options/parse_opts.re"
-	{ global.set_minimization(Minimization::MOORE); goto opt; }
-#line 4774 "src/options/parse_opts.cc"
-yy997:
+#line 370 "../src/options/parse_opts.re"
+	{ global.set_minimization(Minimization::MOORE);    goto opt; }
+#line 5682 "src/options/parse_opts.cc"
+yy1145:
+	++YYCURSOR;
+#line 369 "../src/options/parse_opts.re"
+	{ global.set_minimization(Minimization::TABLE);    goto opt; }
+#line 5687 "src/options/parse_opts.cc"
+yy1146:
+	yych = *++YYCURSOR;
+	if (yych != 't') goto yy1131;
+	yych = *++YYCURSOR;
+	if (yych >= 0x01) goto yy1131;
 	++YYCURSOR;
-#line 303 "../src/options/parse_opts.re"
-	{ global.set_minimization(Minimization::TABLE); goto opt; }
-#line 4779 "src/options/parse_opts.cc"
+#line 371 "../src/options/parse_opts.re"
+	{ global.set_minimization(Minimization::HOPCROFT); goto opt; }
+#line 5696 "src/options/parse_opts.cc"
 }
-#line 305 "../src/options/parse_opts.re"
+#line 372 "../src/options/parse_opts.re"
 
 
 opt_posix_prectable: 
-#line 4785 "src/options/parse_opts.cc"
+#line 5702 "src/options/parse_opts.cc"
 {
 	char yych;
 	yych = *YYCURSOR;
-	if (yych == 'c') goto yy1000;
-	if (yych == 'n') goto yy1001;
+	if (yych == 'c') goto yy1149;
+	if (yych == 'n') goto yy1150;
 	++YYCURSOR;
-yy999:
-#line 308 "../src/options/parse_opts.re"
+yy1148:
+#line 375 "../src/options/parse_opts.re"
 	{ ERRARG("--posix-prectable", "naive | complex", *argv); }
-#line 4795 "src/options/parse_opts.cc"
-yy1000:
+#line 5712 "src/options/parse_opts.cc"
+yy1149:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'o') goto yy1002;
-	goto yy999;
-yy1001:
+	if (yych == 'o') goto yy1151;
+	goto yy1148;
+yy1150:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy1004;
-	goto yy999;
-yy1002:
+	if (yych == 'a') goto yy1153;
+	goto yy1148;
+yy1151:
 	yych = *++YYCURSOR;
-	if (yych == 'm') goto yy1005;
-yy1003:
+	if (yych == 'm') goto yy1154;
+yy1152:
 	YYCURSOR = YYMARKER;
-	goto yy999;
-yy1004:
+	goto yy1148;
+yy1153:
 	yych = *++YYCURSOR;
-	if (yych == 'i') goto yy1006;
-	goto yy1003;
-yy1005:
+	if (yych == 'i') goto yy1155;
+	goto yy1152;
+yy1154:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy1007;
-	goto yy1003;
-yy1006:
+	if (yych == 'p') goto yy1156;
+	goto yy1152;
+yy1155:
 	yych = *++YYCURSOR;
-	if (yych == 'v') goto yy1008;
-	goto yy1003;
-yy1007:
+	if (yych == 'v') goto yy1157;
+	goto yy1152;
+yy1156:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy1009;
-	goto yy1003;
-yy1008:
+	if (yych == 'l') goto yy1158;
+	goto yy1152;
+yy1157:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy1010;
-	goto yy1003;
-yy1009:
+	if (yych == 'e') goto yy1159;
+	goto yy1152;
+yy1158:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy1011;
-	goto yy1003;
-yy1010:
+	if (yych == 'e') goto yy1160;
+	goto yy1152;
+yy1159:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy1012;
-	goto yy1003;
-yy1011:
+	if (yych <= 0x00) goto yy1161;
+	goto yy1152;
+yy1160:
 	yych = *++YYCURSOR;
-	if (yych == 'x') goto yy1013;
-	goto yy1003;
-yy1012:
+	if (yych == 'x') goto yy1162;
+	goto yy1152;
+yy1161:
 	++YYCURSOR;
-#line 309 "../src/options/parse_opts.re"
+#line 376 "../src/options/parse_opts.re"
 	{ global.set_posix_prectable(PosixPrectable::NAIVE);   goto opt; }
-#line 4846 "src/options/parse_opts.cc"
-yy1013:
+#line 5763 "src/options/parse_opts.cc"
+yy1162:
 	yych = *++YYCURSOR;
-	if (yych >= 0x01) goto yy1003;
+	if (yych >= 0x01) goto yy1152;
 	++YYCURSOR;
-#line 310 "../src/options/parse_opts.re"
+#line 377 "../src/options/parse_opts.re"
 	{ global.set_posix_prectable(PosixPrectable::COMPLEX); goto opt; }
-#line 4853 "src/options/parse_opts.cc"
+#line 5770 "src/options/parse_opts.cc"
 }
-#line 311 "../src/options/parse_opts.re"
+#line 378 "../src/options/parse_opts.re"
 
 
 opt_fixed_tags: 
-#line 4859 "src/options/parse_opts.cc"
+#line 5776 "src/options/parse_opts.cc"
 {
 	char yych;
 	yych = *YYCURSOR;
 	if (yych <= 'm') {
-		if (yych == 'a') goto yy1016;
+		if (yych == 'a') goto yy1165;
 	} else {
-		if (yych <= 'n') goto yy1017;
-		if (yych == 't') goto yy1018;
+		if (yych <= 'n') goto yy1166;
+		if (yych == 't') goto yy1167;
 	}
 	++YYCURSOR;
-yy1015:
-#line 314 "../src/options/parse_opts.re"
+yy1164:
+#line 381 "../src/options/parse_opts.re"
 	{ ERRARG("--fixed-tags", "none | toplevel | all", *argv); }
-#line 4873 "src/options/parse_opts.cc"
-yy1016:
+#line 5790 "src/options/parse_opts.cc"
+yy1165:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'l') goto yy1019;
-	goto yy1015;
-yy1017:
+	if (yych == 'l') goto yy1168;
+	goto yy1164;
+yy1166:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'o') goto yy1021;
-	goto yy1015;
-yy1018:
+	if (yych == 'o') goto yy1170;
+	goto yy1164;
+yy1167:
 	yych = *(YYMARKER = ++YYCURSOR);
-	if (yych == 'o') goto yy1022;
-	goto yy1015;
-yy1019:
+	if (yych == 'o') goto yy1171;
+	goto yy1164;
+yy1168:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy1023;
-yy1020:
+	if (yych == 'l') goto yy1172;
+yy1169:
 	YYCURSOR = YYMARKER;
-	goto yy1015;
-yy1021:
+	goto yy1164;
+yy1170:
 	yych = *++YYCURSOR;
-	if (yych == 'n') goto yy1024;
-	goto yy1020;
-yy1022:
+	if (yych == 'n') goto yy1173;
+	goto yy1169;
+yy1171:
 	yych = *++YYCURSOR;
-	if (yych == 'p') goto yy1025;
-	goto yy1020;
-yy1023:
+	if (yych == 'p') goto yy1174;
+	goto yy1169;
+yy1172:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy1026;
-	goto yy1020;
-yy1024:
+	if (yych <= 0x00) goto yy1175;
+	goto yy1169;
+yy1173:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy1027;
-	goto yy1020;
-yy1025:
+	if (yych == 'e') goto yy1176;
+	goto yy1169;
+yy1174:
 	yych = *++YYCURSOR;
-	if (yych == 'l') goto yy1028;
-	goto yy1020;
-yy1026:
+	if (yych == 'l') goto yy1177;
+	goto yy1169;
+yy1175:
 	++YYCURSOR;
-#line 317 "../src/options/parse_opts.re"
+#line 384 "../src/options/parse_opts.re"
 	{ global.set_fixed_tags(FixedTags::ALL);      goto opt; }
-#line 4916 "src/options/parse_opts.cc"
-yy1027:
+#line 5833 "src/options/parse_opts.cc"
+yy1176:
 	yych = *++YYCURSOR;
-	if (yych <= 0x00) goto yy1029;
-	goto yy1020;
-yy1028:
+	if (yych <= 0x00) goto yy1178;
+	goto yy1169;
+yy1177:
 	yych = *++YYCURSOR;
-	if (yych == 'e') goto yy1030;
-	goto yy1020;
-yy1029:
+	if (yych == 'e') goto yy1179;
+	goto yy1169;
+yy1178:
 	++YYCURSOR;
-#line 315 "../src/options/parse_opts.re"
+#line 382 "../src/options/parse_opts.re"
 	{ global.set_fixed_tags(FixedTags::NONE);     goto opt; }
-#line 4929 "src/options/parse_opts.cc"
-yy1030:
+#line 5846 "src/options/parse_opts.cc"
+yy1179:
 	yych = *++YYCURSOR;
-	if (yych != 'v') goto yy1020;
+	if (yych != 'v') goto yy1169;
 	yych = *++YYCURSOR;
-	if (yych != 'e') goto yy1020;
+	if (yych != 'e') goto yy1169;
 	yych = *++YYCURSOR;
-	if (yych != 'l') goto yy1020;
+	if (yych != 'l') goto yy1169;
 	yych = *++YYCURSOR;
-	if (yych >= 0x01) goto yy1020;
+	if (yych >= 0x01) goto yy1169;
 	++YYCURSOR;
-#line 316 "../src/options/parse_opts.re"
+#line 383 "../src/options/parse_opts.re"
 	{ global.set_fixed_tags(FixedTags::TOPLEVEL); goto opt; }
-#line 4942 "src/options/parse_opts.cc"
+#line 5859 "src/options/parse_opts.cc"
 }
-#line 318 "../src/options/parse_opts.re"
+#line 385 "../src/options/parse_opts.re"
 
 
 end:
@@ -4951,6 +5868,18 @@ Ret Opt::parse(char** argv, Input& input) {
     Lang lang = RE2C_LANG;
     CHECK_RET(parse_opts(*this, const_cast<conopt_t&>(glob), argv, msg, &lang));
 
+    // In batch and server modes input files are listed in the manifest or in requests, and each of
+    // them is compiled with its own options, so there is nothing else to do here.
+    if (!glob.batch_file.empty() || glob.server) {
+        const char* mode = glob.server ? "--server" : "--batch";
+        if (!glob.batch_file.empty() && glob.server) {
+            RET_FAIL(error("--batch cannot be used with --server"));
+        } else if (!glob.source_file.empty()) {
+            RET_FAIL(error("source file %s cannot be used with %s", glob.source_file.c_str(), mode));
+        }
+        return Ret::OK;
+    }
+
     if (glob.source_file.empty()) {
         RET_FAIL(error("no source file"));
     }
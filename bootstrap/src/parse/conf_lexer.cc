@@ -1,4 +1,4 @@
-/* Generated by re2c 3.0 */
+/* Generated by re2c 3.1 */
 #line 1 "../src/parse/conf_lexer.re"
 #include <stdint.h>
 #include <string>
@@ -94,39 +94,39 @@ Ret Input::lex_conf(Opt& opts) {
 {
 	uint8_t yych;
 	unsigned int yyaccept = 0;
-	static const unsigned char yybm[] = {
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,  64,   0,   0,   0,  64,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		 64,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,  32,   0,   0, 
-		160, 160, 160, 160, 160, 160, 160, 160, 
-		160, 160,  32,   0,   0,   0,   0,   0, 
-		  0,  32,  32,  32,  32,  32,  32,  32, 
-		 32,  32,  32,  32,  32,  32,  32,  32, 
-		 32,  32,  32,  32,  32,  32,  32,  32, 
-		 32,  32,  32,   0,   0,   0,   0,  32, 
-		  0,  32,  32,  32,  32,  32,  32,  32, 
-		 32,  32,  32,  32,  32,  32,  32,  32, 
-		 32,  32,  32,  32,  32,  32,  32,  32, 
-		 32,  32,  32,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,  64,   0,   0,   0,  64,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		 64,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,  32,   0,   0,
+		160, 160, 160, 160, 160, 160, 160, 160,
+		160, 160,  32,   0,   0,   0,   0,   0,
+		  0,  32,  32,  32,  32,  32,  32,  32,
+		 32,  32,  32,  32,  32,  32,  32,  32,
+		 32,  32,  32,  32,  32,  32,  32,  32,
+		 32,  32,  32,   0,   0,   0,   0,  32,
+		  0,  32,  32,  32,  32,  32,  32,  32,
+		 32,  32,  32,  32,  32,  32,  32,  32,
+		 32,  32,  32,  32,  32,  32,  32,  32,
+		 32,  32,  32,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	if ((lim - cur) < 28) YYFILL(28);
 	yych = *cur;
@@ -172,7 +172,6 @@ Ret Input::lex_conf(Opt& opts) {
 		case '_':
 		case 'g':
 		case 'j':
-		case 'k':
 		case 'o':
 		case 'q':
 		case 'r':
@@ -187,19 +186,20 @@ Ret Input::lex_conf(Opt& opts) {
 		case 'f': goto yy9;
 		case 'h': goto yy10;
 		case 'i': goto yy11;
-		case 'l': goto yy12;
-		case 'm': goto yy13;
-		case 'n': goto yy14;
-		case 'p': goto yy15;
-		case 's': goto yy16;
-		case 't': goto yy17;
-		case 'u': goto yy18;
-		case 'v': goto yy19;
-		case 'y': goto yy20;
+		case 'k': goto yy12;
+		case 'l': goto yy13;
+		case 'm': goto yy14;
+		case 'n': goto yy15;
+		case 'p': goto yy16;
+		case 's': goto yy17;
+		case 't': goto yy18;
+		case 'u': goto yy19;
+		case 'v': goto yy20;
+		case 'y': goto yy21;
 		default: goto yy1;
 	}
 yy1:
-#line 248 "../src/parse/conf_lexer.re"
+#line 257 "../src/parse/conf_lexer.re"
 	{
         RET_FAIL(error_at_tok(
                 "unrecognized configuration '%.*s'", static_cast<int>(cur - tok), tok));
@@ -210,4667 +210,4916 @@ yy2:
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
 yy3:
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
+	if (yybm[0+yych] & 32) goto yy2;
 	goto yy1;
 yy4:
 	yych = *++cur;
-	if (yych == 'p') goto yy21;
+	if (yych == 'p') goto yy22;
 	goto yy3;
 yy5:
 	yych = *++cur;
-	if (yych == 'i') goto yy22;
+	if (yych == 'i') goto yy23;
 	goto yy3;
 yy6:
 	yych = *++cur;
-	if (yych <= 'f') {
-		if (yych == 'a') goto yy23;
-		goto yy3;
-	} else {
-		if (yych <= 'g') goto yy24;
-		if (yych == 'o') goto yy25;
-		goto yy3;
+	switch (yych) {
+		case 'a': goto yy24;
+		case 'g': goto yy25;
+		case 'h': goto yy26;
+		case 'l': goto yy27;
+		case 'o': goto yy28;
+		default: goto yy3;
 	}
 yy7:
 	yych = *++cur;
-	if (yych == 'e') goto yy26;
+	if (yych == 'e') goto yy29;
 	goto yy3;
 yy8:
 	yych = *++cur;
 	if (yych <= 'l') goto yy3;
-	if (yych <= 'm') goto yy27;
-	if (yych <= 'n') goto yy28;
-	if (yych <= 'o') goto yy29;
+	if (yych <= 'm') goto yy30;
+	if (yych <= 'n') goto yy31;
+	if (yych <= 'o') goto yy32;
 	goto yy3;
 yy9:
 	yych = *++cur;
-	if (yych == 'l') goto yy30;
+	if (yych == 'a') goto yy33;
+	if (yych == 'l') goto yy34;
 	goto yy3;
 yy10:
 	yych = *++cur;
-	if (yych == 'e') goto yy31;
+	if (yych == 'e') goto yy35;
 	goto yy3;
 yy11:
 	yych = *++cur;
-	if (yych == 'n') goto yy32;
+	if (yych == 'n') goto yy36;
 	goto yy3;
 yy12:
 	yych = *++cur;
-	if (yych == 'a') goto yy33;
-	if (yych == 'e') goto yy34;
+	if (yych == 'e') goto yy37;
 	goto yy3;
 yy13:
 	yych = *++cur;
-	if (yych == 'o') goto yy35;
+	if (yych == 'a') goto yy38;
+	if (yych == 'e') goto yy39;
 	goto yy3;
 yy14:
 	yych = *++cur;
-	if (yych == 'e') goto yy36;
+	if (yych == 'o') goto yy40;
 	goto yy3;
 yy15:
 	yych = *++cur;
-	if (yych == 'o') goto yy37;
+	if (yych == 'e') goto yy41;
 	goto yy3;
 yy16:
 	yych = *++cur;
-	if (yych == 'e') goto yy38;
-	if (yych == 't') goto yy39;
+	if (yych == 'o') goto yy42;
+	if (yych == 'r') goto yy43;
 	goto yy3;
 yy17:
 	yych = *++cur;
-	if (yych == 'a') goto yy40;
-	goto yy3;
+	if (yych <= 'h') {
+		if (yych == 'e') goto yy44;
+		goto yy3;
+	} else {
+		if (yych <= 'i') goto yy45;
+		if (yych == 't') goto yy46;
+		goto yy3;
+	}
 yy18:
 	yych = *++cur;
-	if (yych == 'n') goto yy41;
+	if (yych == 'a') goto yy47;
 	goto yy3;
 yy19:
 	yych = *++cur;
-	if (yych == 'a') goto yy42;
+	if (yych == 'n') goto yy48;
 	goto yy3;
 yy20:
 	yych = *++cur;
-	if (yych == 'y') goto yy43;
+	if (yych == 'a') goto yy49;
 	goto yy3;
 yy21:
 	yych = *++cur;
-	if (yych == 'i') goto yy44;
+	if (yych == 'y') goto yy50;
 	goto yy3;
 yy22:
 	yych = *++cur;
-	if (yych == 't') goto yy46;
+	if (yych == 'i') goto yy51;
 	goto yy3;
 yy23:
 	yych = *++cur;
-	if (yych == 's') goto yy47;
+	if (yych == 't') goto yy53;
 	goto yy3;
 yy24:
 	yych = *++cur;
-	if (yych == 'o') goto yy48;
+	if (yych == 's') goto yy54;
 	goto yy3;
 yy25:
 	yych = *++cur;
-	if (yych <= 'l') goto yy3;
-	if (yych <= 'm') goto yy49;
-	if (yych <= 'n') goto yy50;
+	if (yych == 'o') goto yy55;
 	goto yy3;
 yy26:
 	yych = *++cur;
-	if (yych == 'b') goto yy51;
-	if (yych == 'f') goto yy52;
+	if (yych == 'a') goto yy56;
 	goto yy3;
 yy27:
 	yych = *++cur;
-	if (yych == 'p') goto yy53;
+	if (yych == 'a') goto yy57;
 	goto yy3;
 yy28:
 	yych = *++cur;
-	if (yych == 'c') goto yy54;
+	if (yych <= 'k') goto yy3;
+	if (yych <= 'l') goto yy58;
+	if (yych <= 'm') goto yy59;
+	if (yych <= 'n') goto yy60;
 	goto yy3;
 yy29:
 	yych = *++cur;
-	if (yych == 'f') goto yy55;
+	if (yych == 'b') goto yy61;
+	if (yych == 'f') goto yy62;
 	goto yy3;
 yy30:
 	yych = *++cur;
-	if (yych == 'a') goto yy56;
+	if (yych == 'p') goto yy63;
 	goto yy3;
 yy31:
 	yych = *++cur;
-	if (yych == 'a') goto yy57;
+	if (yych == 'c') goto yy64;
 	goto yy3;
 yy32:
 	yych = *++cur;
-	if (yych == 'd') goto yy58;
-	if (yych == 'v') goto yy59;
+	if (yych == 'f') goto yy65;
 	goto yy3;
 yy33:
 	yych = *++cur;
-	if (yych == 'b') goto yy60;
+	if (yych == 's') goto yy66;
 	goto yy3;
 yy34:
 	yych = *++cur;
-	if (yych == 'f') goto yy61;
+	if (yych == 'a') goto yy67;
 	goto yy3;
 yy35:
 	yych = *++cur;
-	if (yych == 'n') goto yy62;
+	if (yych == 'a') goto yy68;
 	goto yy3;
 yy36:
 	yych = *++cur;
-	if (yych == 's') goto yy63;
+	if (yych == 'd') goto yy69;
+	if (yych == 'v') goto yy70;
 	goto yy3;
 yy37:
 	yych = *++cur;
-	if (yych == 's') goto yy64;
+	if (yych == 'y') goto yy71;
 	goto yy3;
 yy38:
 	yych = *++cur;
-	if (yych == 'n') goto yy65;
+	if (yych == 'b') goto yy72;
 	goto yy3;
 yy39:
 	yych = *++cur;
-	if (yych == 'a') goto yy66;
+	if (yych == 'f') goto yy73;
 	goto yy3;
 yy40:
 	yych = *++cur;
-	if (yych == 'g') goto yy67;
+	if (yych == 'n') goto yy74;
 	goto yy3;
 yy41:
 	yych = *++cur;
-	if (yych == 's') goto yy68;
+	if (yych == 's') goto yy75;
 	goto yy3;
 yy42:
 	yych = *++cur;
-	if (yych == 'r') goto yy69;
+	if (yych == 's') goto yy76;
 	goto yy3;
 yy43:
+	yych = *++cur;
+	if (yych == 'o') goto yy77;
+	goto yy3;
+yy44:
+	yych = *++cur;
+	if (yych == 'n') goto yy78;
+	goto yy3;
+yy45:
+	yych = *++cur;
+	if (yych == 'm') goto yy79;
+	goto yy3;
+yy46:
+	yych = *++cur;
+	if (yych == 'a') goto yy80;
+	goto yy3;
+yy47:
+	yych = *++cur;
+	if (yych == 'b') goto yy81;
+	if (yych == 'g') goto yy82;
+	goto yy3;
+yy48:
+	yych = *++cur;
+	if (yych <= 'q') goto yy3;
+	if (yych <= 'r') goto yy83;
+	if (yych <= 's') goto yy84;
+	goto yy3;
+yy49:
+	yych = *++cur;
+	if (yych == 'r') goto yy85;
+	goto yy3;
+yy50:
 	yych = *++cur;
 	if (yych <= 'c') {
 		if (yych <= 'a') goto yy3;
-		if (yych <= 'b') goto yy70;
-		goto yy71;
+		if (yych <= 'b') goto yy86;
+		goto yy87;
 	} else {
-		if (yych == 'f') goto yy72;
+		if (yych == 'f') goto yy88;
 		goto yy3;
 	}
-yy44:
+yy51:
 	yych = *++cur;
 	if (yych <= '@') {
 		if (yych <= '/') {
 			if (yych == '-') goto yy2;
 		} else {
 			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy73;
+			if (yych <= ':') goto yy89;
 		}
 	} else {
 		if (yych <= '_') {
 			if (yych <= 'Z') goto yy2;
 			if (yych >= '_') goto yy2;
 		} else {
-			if (yych <= '`') goto yy45;
+			if (yych <= '`') goto yy52;
 			if (yych <= 'z') goto yy2;
 		}
 	}
-yy45:
+yy52:
 #line 103 "../src/parse/conf_lexer.re"
 	{ goto input; }
-#line 420 "src/parse/conf_lexer.cc"
-yy46:
-	yych = *++cur;
-	if (yych == '-') goto yy74;
-	goto yy3;
-yy47:
-	yych = *++cur;
-	if (yych == 'e') goto yy75;
-	goto yy3;
-yy48:
-	yych = *++cur;
-	if (yych == 't') goto yy76;
-	goto yy3;
-yy49:
-	yych = *++cur;
-	if (yych == 'p') goto yy77;
-	goto yy3;
-yy50:
-	yych = *++cur;
-	if (yych == 'd') goto yy78;
-	goto yy3;
-yy51:
-	yych = *++cur;
-	if (yych == 'u') goto yy79;
-	goto yy3;
-yy52:
-	yych = *++cur;
-	if (yych == 'i') goto yy80;
-	goto yy3;
+#line 457 "src/parse/conf_lexer.cc"
 yy53:
 	yych = *++cur;
-	if (yych == 't') goto yy81;
+	if (yych == '-') goto yy90;
 	goto yy3;
 yy54:
 	yych = *++cur;
-	if (yych == 'o') goto yy82;
+	if (yych == 'e') goto yy91;
 	goto yy3;
 yy55:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 118 "../src/parse/conf_lexer.re"
-	{ RET_CONF_EOF(fill_eof); }
-#line 464 "src/parse/conf_lexer.cc"
+	if (yych == 't') goto yy92;
+	goto yy3;
 yy56:
 	yych = *++cur;
-	if (yych == 'g') goto yy83;
+	if (yych == 'r') goto yy93;
 	goto yy3;
 yy57:
 	yych = *++cur;
-	if (yych == 'd') goto yy84;
+	if (yych == 's') goto yy94;
 	goto yy3;
 yy58:
 	yych = *++cur;
-	if (yych == 'e') goto yy85;
+	if (yych == 'l') goto yy95;
 	goto yy3;
 yy59:
 	yych = *++cur;
-	if (yych == 'e') goto yy86;
+	if (yych == 'p') goto yy96;
 	goto yy3;
 yy60:
 	yych = *++cur;
-	if (yych == 'e') goto yy87;
+	if (yych == 'd') goto yy97;
 	goto yy3;
 yy61:
 	yych = *++cur;
-	if (yych == 't') goto yy88;
+	if (yych == 'u') goto yy98;
 	goto yy3;
 yy62:
 	yych = *++cur;
-	if (yych == 'a') goto yy89;
+	if (yych == 'i') goto yy99;
 	goto yy3;
 yy63:
 	yych = *++cur;
-	if (yych == 't') goto yy90;
+	if (yych == 't') goto yy100;
 	goto yy3;
 yy64:
 	yych = *++cur;
-	if (yych == 'i') goto yy91;
+	if (yych == 'o') goto yy101;
 	goto yy3;
 yy65:
 	yych = *++cur;
-	if (yych == 't') goto yy92;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 118 "../src/parse/conf_lexer.re"
+	{ RET_CONF_EOF(fill_eof); }
+#line 511 "src/parse/conf_lexer.cc"
 yy66:
 	yych = *++cur;
-	if (yych == 'r') goto yy93;
-	if (yych == 't') goto yy94;
+	if (yych == 't') goto yy102;
 	goto yy3;
 yy67:
 	yych = *++cur;
-	if (yych == 's') goto yy95;
+	if (yych == 'g') goto yy103;
 	goto yy3;
 yy68:
 	yych = *++cur;
-	if (yych == 'a') goto yy97;
+	if (yych == 'd') goto yy104;
 	goto yy3;
 yy69:
 	yych = *++cur;
-	if (yych == 'i') goto yy98;
+	if (yych == 'e') goto yy105;
 	goto yy3;
 yy70:
 	yych = *++cur;
-	if (yych == 'm') goto yy99;
+	if (yych == 'e') goto yy106;
 	goto yy3;
 yy71:
 	yych = *++cur;
-	if (yych == 'h') goto yy100;
+	if (yych == 'w') goto yy107;
 	goto yy3;
 yy72:
 	yych = *++cur;
-	if (yych == 'i') goto yy101;
-	if (yych == 'n') goto yy102;
+	if (yych == 'e') goto yy108;
 	goto yy3;
 yy73:
 	yych = *++cur;
-	if (yych == 's') goto yy103;
+	if (yych == 't') goto yy109;
 	goto yy3;
 yy74:
 	yych = *++cur;
-	if (yych == 'v') goto yy104;
+	if (yych == 'a') goto yy110;
 	goto yy3;
 yy75:
 	yych = *++cur;
-	if (yych == '-') goto yy105;
+	if (yych == 't') goto yy111;
 	goto yy3;
 yy76:
 	yych = *++cur;
-	if (yych == 'o') goto yy106;
+	if (yych == 'i') goto yy112;
 	goto yy3;
 yy77:
 	yych = *++cur;
-	if (yych == 'u') goto yy107;
+	if (yych == 'f') goto yy113;
 	goto yy3;
 yy78:
 	yych = *++cur;
-	if (yych <= 'd') {
-		if (yych == ':') goto yy108;
-		goto yy3;
-	} else {
-		if (yych <= 'e') goto yy109;
-		if (yych == 'p') goto yy110;
-		goto yy3;
-	}
+	if (yych == 't') goto yy114;
+	goto yy3;
 yy79:
 	yych = *++cur;
-	if (yych == 'g') goto yy111;
+	if (yych == 'd') goto yy115;
 	goto yy3;
 yy80:
 	yych = *++cur;
-	if (yych == 'n') goto yy112;
+	if (yych == 'r') goto yy116;
+	if (yych == 't') goto yy117;
 	goto yy3;
 yy81:
 	yych = *++cur;
-	if (yych == 'y') goto yy113;
+	if (yych == 'l') goto yy118;
 	goto yy3;
 yy82:
 	yych = *++cur;
-	if (yych == 'd') goto yy114;
+	if (yych == 's') goto yy119;
 	goto yy3;
 yy83:
 	yych = *++cur;
-	if (yych == 's') goto yy115;
+	if (yych == 'o') goto yy121;
 	goto yy3;
 yy84:
 	yych = *++cur;
-	if (yych == 'e') goto yy116;
+	if (yych == 'a') goto yy122;
 	goto yy3;
 yy85:
 	yych = *++cur;
-	if (yych == 'n') goto yy117;
+	if (yych == 'i') goto yy123;
 	goto yy3;
 yy86:
 	yych = *++cur;
-	if (yych == 'r') goto yy118;
+	if (yych == 'm') goto yy124;
 	goto yy3;
 yy87:
 	yych = *++cur;
-	if (yych == 'l') goto yy119;
+	if (yych == 'h') goto yy125;
 	goto yy3;
 yy88:
 	yych = *++cur;
-	if (yych == 'm') goto yy120;
+	if (yych == 'i') goto yy126;
+	if (yych == 'n') goto yy127;
 	goto yy3;
 yy89:
 	yych = *++cur;
-	if (yych == 'd') goto yy121;
+	if (yych == 's') goto yy128;
 	goto yy3;
 yy90:
 	yych = *++cur;
-	if (yych == 'e') goto yy122;
+	if (yych == 'v') goto yy129;
 	goto yy3;
 yy91:
 	yych = *++cur;
-	if (yych == 'x') goto yy123;
+	if (yych == '-') goto yy130;
 	goto yy3;
 yy92:
 	yych = *++cur;
-	if (yych == 'i') goto yy124;
+	if (yych == 'o') goto yy131;
 	goto yy3;
 yy93:
 	yych = *++cur;
-	if (yych == 't') goto yy125;
+	if (yych == '-') goto yy132;
 	goto yy3;
 yy94:
 	yych = *++cur;
-	if (yych == 'e') goto yy126;
+	if (yych == 's') goto yy133;
 	goto yy3;
 yy95:
 	yych = *++cur;
-	if (yych <= '@') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy127;
-		}
-	} else {
-		if (yych <= '_') {
-			if (yych <= 'Z') goto yy2;
-			if (yych >= '_') goto yy2;
-		} else {
-			if (yych <= '`') goto yy96;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	if (yych == 'a') goto yy134;
+	goto yy3;
 yy96:
-#line 127 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(tags); }
-#line 650 "src/parse/conf_lexer.cc"
-yy97:
 	yych = *++cur;
-	if (yych == 'f') goto yy128;
+	if (yych == 'u') goto yy135;
 	goto yy3;
+yy97:
+	yych = *++cur;
+	if (yych <= 'd') {
+		if (yych == ':') goto yy136;
+		goto yy3;
+	} else {
+		if (yych <= 'e') goto yy137;
+		if (yych == 'p') goto yy138;
+		goto yy3;
+	}
 yy98:
 	yych = *++cur;
-	if (yych == 'a') goto yy129;
+	if (yych == 'g') goto yy139;
 	goto yy3;
 yy99:
 	yych = *++cur;
-	if (yych == ':') goto yy130;
+	if (yych == 'n') goto yy140;
 	goto yy3;
 yy100:
 	yych = *++cur;
-	if (yych == ':') goto yy131;
+	if (yych == 'y') goto yy141;
 	goto yy3;
 yy101:
 	yych = *++cur;
-	if (yych == 'l') goto yy132;
+	if (yych == 'd') goto yy142;
 	goto yy3;
 yy102:
 	yych = *++cur;
-	if (yych == ':') goto yy133;
+	if (yych == '-') goto yy143;
 	goto yy3;
 yy103:
 	yych = *++cur;
-	if (yych == 'i') goto yy134;
-	if (yych == 't') goto yy135;
+	if (yych == 's') goto yy144;
 	goto yy3;
 yy104:
 	yych = *++cur;
-	if (yych == 'e') goto yy136;
+	if (yych == 'e') goto yy145;
 	goto yy3;
 yy105:
 	yych = *++cur;
-	if (yych == 'i') goto yy137;
-	if (yych == 'r') goto yy138;
+	if (yych == 'n') goto yy146;
 	goto yy3;
 yy106:
 	yych = *++cur;
-	if (yych == ':') goto yy139;
+	if (yych == 'r') goto yy147;
 	goto yy3;
 yy107:
 	yych = *++cur;
-	if (yych == 't') goto yy140;
+	if (yych == 'o') goto yy148;
 	goto yy3;
 yy108:
 	yych = *++cur;
-	switch (yych) {
-		case 'a': goto yy141;
-		case 'd': goto yy142;
-		case 'e': goto yy109;
-		case 'g': goto yy143;
-		case 'p': goto yy110;
-		default: goto yy3;
-	}
+	if (yych == 'l') goto yy149;
+	goto yy3;
 yy109:
 	yych = *++cur;
-	if (yych == 'n') goto yy144;
+	if (yych == 'm') goto yy150;
 	goto yy3;
 yy110:
 	yych = *++cur;
-	if (yych == 'r') goto yy145;
+	if (yych == 'd') goto yy151;
 	goto yy3;
 yy111:
 	yych = *++cur;
-	if (yych == '-') goto yy146;
+	if (yych == 'e') goto yy152;
 	goto yy3;
 yy112:
 	yych = *++cur;
-	if (yych == 'e') goto yy147;
+	if (yych == 'x') goto yy153;
 	goto yy3;
 yy113:
 	yych = *++cur;
-	if (yych == '-') goto yy148;
+	if (yych == 'i') goto yy154;
 	goto yy3;
 yy114:
 	yych = *++cur;
-	if (yych == 'i') goto yy149;
+	if (yych == 'i') goto yy155;
 	goto yy3;
 yy115:
 	yych = *++cur;
-	if (yych == ':') goto yy150;
+	if (yych == '-') goto yy156;
 	goto yy3;
 yy116:
 	yych = *++cur;
-	if (yych == 'r') goto yy151;
+	if (yych == 't') goto yy157;
 	goto yy3;
 yy117:
 	yych = *++cur;
-	if (yych == 't') goto yy153;
+	if (yych == 'e') goto yy158;
 	goto yy3;
 yy118:
 	yych = *++cur;
-	if (yych == 't') goto yy154;
+	if (yych == 'e') goto yy159;
 	goto yy3;
 yy119:
 	yych = *++cur;
-	if (yych == ':') goto yy155;
-	if (yych == 'p') goto yy156;
-	goto yy3;
+	if (yych <= '@') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= '9') goto yy2;
+			if (yych <= ':') goto yy160;
+		}
+	} else {
+		if (yych <= '_') {
+			if (yych <= 'Z') goto yy2;
+			if (yych >= '_') goto yy2;
+		} else {
+			if (yych <= '`') goto yy120;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy120:
-	yych = *++cur;
-	if (yych == 'o') goto yy157;
-	goto yy3;
+#line 127 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(tags); }
+#line 753 "src/parse/conf_lexer.cc"
 yy121:
 	yych = *++cur;
-	if (yych == 'i') goto yy158;
+	if (yych == 'l') goto yy161;
 	goto yy3;
 yy122:
 	yych = *++cur;
-	if (yych == 'd') goto yy159;
+	if (yych == 'f') goto yy162;
 	goto yy3;
 yy123:
 	yych = *++cur;
-	if (yych == '-') goto yy160;
+	if (yych == 'a') goto yy163;
 	goto yy3;
 yy124:
 	yych = *++cur;
-	if (yych == 'n') goto yy161;
+	if (yych == ':') goto yy164;
 	goto yy3;
 yy125:
 	yych = *++cur;
-	if (yych == 'l') goto yy162;
+	if (yych == ':') goto yy165;
 	goto yy3;
 yy126:
 	yych = *++cur;
-	if (yych == ':') goto yy163;
+	if (yych == 'l') goto yy166;
 	goto yy3;
 yy127:
 	yych = *++cur;
-	if (yych == 'e') goto yy164;
-	if (yych == 'p') goto yy165;
+	if (yych == ':') goto yy167;
 	goto yy3;
 yy128:
 	yych = *++cur;
-	if (yych == 'e') goto yy166;
+	if (yych == 'i') goto yy168;
+	if (yych == 't') goto yy169;
 	goto yy3;
 yy129:
 	yych = *++cur;
-	if (yych == 'b') goto yy167;
+	if (yych == 'e') goto yy170;
 	goto yy3;
 yy130:
 	yych = *++cur;
-	if (yych == 'h') goto yy168;
+	if (yych == 'i') goto yy171;
+	if (yych == 'r') goto yy172;
 	goto yy3;
 yy131:
 	yych = *++cur;
-	if (yych <= 'd') {
-		if (yych == 'c') goto yy169;
-		goto yy3;
-	} else {
-		if (yych <= 'e') goto yy170;
-		if (yych == 'l') goto yy171;
-		goto yy3;
-	}
+	if (yych == ':') goto yy173;
+	goto yy3;
 yy132:
 	yych = *++cur;
-	if (yych == 'l') goto yy172;
+	if (yych == 'w') goto yy174;
 	goto yy3;
 yy133:
 	yych = *++cur;
-	if (yych == 's') goto yy173;
+	if (yych == '-') goto yy175;
 	goto yy3;
 yy134:
 	yych = *++cur;
-	if (yych == 'g') goto yy174;
+	if (yych == 'p') goto yy176;
 	goto yy3;
 yy135:
 	yych = *++cur;
-	if (yych == 'y') goto yy175;
+	if (yych == 't') goto yy177;
 	goto yy3;
 yy136:
 	yych = *++cur;
-	if (yych == 'c') goto yy176;
-	goto yy3;
+	switch (yych) {
+		case 'a': goto yy178;
+		case 'd': goto yy179;
+		case 'e': goto yy137;
+		case 'g': goto yy180;
+		case 'p': goto yy138;
+		default: goto yy3;
+	}
 yy137:
 	yych = *++cur;
-	if (yych == 'n') goto yy177;
+	if (yych == 'n') goto yy181;
 	goto yy3;
 yy138:
 	yych = *++cur;
-	if (yych == 'a') goto yy178;
+	if (yych == 'r') goto yy182;
 	goto yy3;
 yy139:
 	yych = *++cur;
-	if (yych == 't') goto yy179;
+	if (yych == '-') goto yy183;
 	goto yy3;
 yy140:
 	yych = *++cur;
-	if (yych == 'e') goto yy180;
+	if (yych == 'e') goto yy184;
 	goto yy3;
 yy141:
 	yych = *++cur;
-	if (yych == 'b') goto yy181;
+	if (yych == '-') goto yy185;
 	goto yy3;
 yy142:
 	yych = *++cur;
-	if (yych == 'i') goto yy182;
+	if (yych == 'i') goto yy186;
 	goto yy3;
 yy143:
 	yych = *++cur;
-	if (yych == 'o') goto yy183;
+	if (yych == 'p') goto yy187;
 	goto yy3;
 yy144:
 	yych = *++cur;
-	if (yych == 'u') goto yy184;
+	if (yych == ':') goto yy188;
 	goto yy3;
 yy145:
 	yych = *++cur;
-	if (yych == 'e') goto yy185;
+	if (yych == 'r') goto yy189;
 	goto yy3;
 yy146:
 	yych = *++cur;
-	if (yych == 'o') goto yy186;
+	if (yych == 't') goto yy191;
 	goto yy3;
 yy147:
 	yych = *++cur;
-	if (yych == ':') goto yy187;
+	if (yych == 't') goto yy192;
 	goto yy3;
 yy148:
 	yych = *++cur;
-	if (yych == 'c') goto yy188;
+	if (yych == 'r') goto yy193;
 	goto yy3;
 yy149:
 	yych = *++cur;
-	if (yych == 'n') goto yy189;
+	if (yych == ':') goto yy194;
+	if (yych == 'p') goto yy195;
 	goto yy3;
 yy150:
 	yych = *++cur;
-	switch (yych) {
-		case '8': goto yy190;
-		case 'P': goto yy191;
-		case 'T': goto yy192;
-		case 'b': goto yy193;
-		case 'c': goto yy195;
-		case 'd': goto yy196;
-		case 'e': goto yy198;
-		case 'g': goto yy200;
-		case 'i': goto yy202;
-		case 'l': goto yy203;
-		case 'm': goto yy13;
-		case 'n': goto yy14;
-		case 'p': goto yy15;
-		case 's': goto yy204;
-		case 't': goto yy205;
-		case 'u': goto yy206;
-		case 'w': goto yy208;
-		case 'x': goto yy210;
-		default: goto yy3;
-	}
+	if (yych == 'o') goto yy196;
+	goto yy3;
 yy151:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
+	if (yych == 'i') goto yy197;
+	goto yy3;
 yy152:
-#line 108 "../src/parse/conf_lexer.re"
-	{
-        CHECK_RET(lex_conf_string(opts));
-        if (!tmp_str.empty()) {
-            std::string path(opts.glob.output_file);
-            get_dir(path);
-            SETOPT(header_file, path + tmp_str);
-        }
-        return Ret::OK;
-    }
-#line 918 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'd') goto yy198;
+	goto yy3;
 yy153:
 	yych = *++cur;
-	if (yych == ':') goto yy211;
+	if (yych == '-') goto yy199;
 	goto yy3;
 yy154:
 	yych = *++cur;
-	if (yych == '-') goto yy212;
+	if (yych == 'l') goto yy200;
 	goto yy3;
 yy155:
 	yych = *++cur;
-	if (yych <= 'r') {
-		if (yych != 'p') goto yy3;
-	} else {
-		if (yych <= 's') goto yy213;
-		if (yych == 'y') goto yy214;
-		goto yy3;
-	}
+	if (yych == 'n') goto yy201;
+	goto yy3;
 yy156:
 	yych = *++cur;
-	if (yych == 'r') goto yy215;
+	if (yych == 'l') goto yy202;
 	goto yy3;
 yy157:
 	yych = *++cur;
-	if (yych == 's') goto yy216;
+	if (yych == 'l') goto yy203;
 	goto yy3;
 yy158:
 	yych = *++cur;
-	if (yych == 'c') goto yy217;
+	if (yych == ':') goto yy204;
 	goto yy3;
 yy159:
 	yych = *++cur;
-	if (yych == '-') goto yy218;
+	if (yych == '-') goto yy205;
 	goto yy3;
 yy160:
 	yych = *++cur;
-	if (yych == 'c') goto yy219;
+	if (yych == 'e') goto yy206;
+	if (yych == 'p') goto yy207;
 	goto yy3;
 yy161:
 	yych = *++cur;
-	if (yych == 'e') goto yy220;
+	if (yych == 'l') goto yy208;
 	goto yy3;
 yy162:
 	yych = *++cur;
-	if (yych == 'a') goto yy221;
+	if (yych == 'e') goto yy209;
 	goto yy3;
 yy163:
 	yych = *++cur;
-	if (yych == 'a') goto yy222;
-	if (yych == 'n') goto yy223;
+	if (yych == 'b') goto yy210;
 	goto yy3;
 yy164:
 	yych = *++cur;
-	if (yych == 'x') goto yy224;
+	if (yych == 'h') goto yy211;
 	goto yy3;
 yy165:
 	yych = *++cur;
-	if (yych == 'r') goto yy225;
-	goto yy3;
+	if (yych <= 'd') {
+		if (yych == 'c') goto yy212;
+		goto yy3;
+	} else {
+		if (yych <= 'e') goto yy213;
+		if (yych == 'l') goto yy214;
+		goto yy3;
+	}
 yy166:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 226 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(unsafe); }
-#line 984 "src/parse/conf_lexer.cc"
+	if (yych == 'l') goto yy215;
+	goto yy3;
 yy167:
 	yych = *++cur;
-	if (yych == 'l') goto yy226;
+	if (yych == 's') goto yy216;
 	goto yy3;
 yy168:
 	yych = *++cur;
-	if (yych == 'e') goto yy227;
+	if (yych == 'g') goto yy217;
 	goto yy3;
 yy169:
 	yych = *++cur;
-	if (yych == 'o') goto yy228;
+	if (yych == 'y') goto yy218;
 	goto yy3;
 yy170:
 	yych = *++cur;
-	if (yych == 'm') goto yy229;
+	if (yych == 'c') goto yy219;
 	goto yy3;
 yy171:
 	yych = *++cur;
-	if (yych == 'i') goto yy230;
+	if (yych == 'n') goto yy220;
 	goto yy3;
 yy172:
 	yych = *++cur;
-	if (yych == ':') goto yy231;
+	if (yych == 'a') goto yy221;
 	goto yy3;
 yy173:
 	yych = *++cur;
-	if (yych == 'e') goto yy232;
+	if (yych == 't') goto yy222;
 	goto yy3;
 yy174:
 	yych = *++cur;
-	if (yych == 'i') goto yy233;
+	if (yych == 'e') goto yy223;
 	goto yy3;
 yy175:
 	yych = *++cur;
-	if (yych == 'l') goto yy234;
+	if (yych == 's') goto yy224;
 	goto yy3;
 yy176:
 	yych = *++cur;
-	if (yych == 't') goto yy235;
+	if (yych == 's') goto yy225;
 	goto yy3;
 yy177:
 	yych = *++cur;
-	if (yych == 's') goto yy236;
-	if (yych == 'v') goto yy237;
+	if (yych == 'e') goto yy226;
 	goto yy3;
 yy178:
 	yych = *++cur;
-	if (yych == 'n') goto yy238;
+	if (yych == 'b') goto yy227;
 	goto yy3;
 yy179:
 	yych = *++cur;
-	if (yych == 'h') goto yy239;
+	if (yych == 'i') goto yy228;
 	goto yy3;
 yy180:
 	yych = *++cur;
-	if (yych == 'd') goto yy240;
+	if (yych == 'o') goto yy229;
 	goto yy3;
 yy181:
 	yych = *++cur;
-	if (yych == 'o') goto yy241;
+	if (yych == 'u') goto yy230;
 	goto yy3;
 yy182:
 	yych = *++cur;
-	if (yych == 'v') goto yy242;
+	if (yych == 'e') goto yy231;
 	goto yy3;
 yy183:
 	yych = *++cur;
-	if (yych == 't') goto yy243;
+	if (yych == 'o') goto yy232;
 	goto yy3;
 yy184:
 	yych = *++cur;
-	if (yych == 'm') goto yy244;
+	if (yych == ':') goto yy233;
 	goto yy3;
 yy185:
 	yych = *++cur;
-	if (yych == 'f') goto yy245;
+	if (yych == 'c') goto yy234;
 	goto yy3;
 yy186:
 	yych = *++cur;
-	if (yych == 'u') goto yy246;
+	if (yych == 'n') goto yy235;
 	goto yy3;
 yy187:
 	yych = *++cur;
-	if (yych == 'Y') goto yy247;
+	if (yych == 'a') goto yy236;
 	goto yy3;
 yy188:
 	yych = *++cur;
-	if (yych == 'l') goto yy248;
-	goto yy3;
+	switch (yych) {
+		case '8': goto yy237;
+		case 'P': goto yy238;
+		case 'T': goto yy239;
+		case 'b': goto yy240;
+		case 'c': goto yy242;
+		case 'd': goto yy243;
+		case 'e': goto yy245;
+		case 'f': goto yy247;
+		case 'g': goto yy248;
+		case 'i': goto yy250;
+		case 'l': goto yy251;
+		case 'm': goto yy14;
+		case 'n': goto yy15;
+		case 'p': goto yy16;
+		case 's': goto yy252;
+		case 't': goto yy254;
+		case 'u': goto yy255;
+		case 'w': goto yy257;
+		case 'x': goto yy259;
+		default: goto yy3;
+	}
 yy189:
 	yych = *++cur;
-	if (yych == 'g') goto yy249;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
 yy190:
-	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 233 "../src/parse/conf_lexer.re"
-	{ RET_CONF_ENC(Enc::Type::UTF8); }
-#line 1085 "src/parse/conf_lexer.cc"
-yy191:
-	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 129 "../src/parse/conf_lexer.re"
+#line 108 "../src/parse/conf_lexer.re"
 	{
-        CHECK_RET(lex_conf_bool(opts));
-        SETOPT(tags_posix_syntax, tmp_num != 0);
-        SETOPT(tags_posix_semantics, tmp_num != 0);
+        CHECK_RET(lex_conf_string(opts));
+        if (!tmp_str.empty()) {
+            std::string path(opts.glob.output_file);
+            get_dir(path);
+            SETOPT(header_file, path + tmp_str);
+        }
         return Ret::OK;
     }
-#line 1098 "src/parse/conf_lexer.cc"
+#line 1076 "src/parse/conf_lexer.cc"
+yy191:
+	yych = *++cur;
+	if (yych == ':') goto yy260;
+	goto yy3;
 yy192:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-	goto yy96;
+	if (yych == '-') goto yy261;
+	goto yy3;
 yy193:
 	yych = *++cur;
-	if (yych <= 'Z') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= ':') goto yy2;
-			if (yych >= 'A') goto yy2;
-		}
+	if (yych == 'd') goto yy262;
+	goto yy3;
+yy194:
+	yych = *++cur;
+	if (yych <= 'r') {
+		if (yych != 'p') goto yy3;
 	} else {
-		if (yych <= '`') {
-			if (yych == '_') goto yy2;
-		} else {
-			if (yych == 'i') goto yy22;
-			if (yych <= 'z') goto yy2;
-		}
+		if (yych <= 's') goto yy263;
+		if (yych == 'y') goto yy264;
+		goto yy3;
 	}
-yy194:
-#line 218 "../src/parse/conf_lexer.re"
-	{ RET_CONF_FEATURE(bitmaps); }
-#line 1125 "src/parse/conf_lexer.cc"
 yy195:
 	yych = *++cur;
-	if (yych == 'a') goto yy23;
-	if (yych == 'o') goto yy250;
+	if (yych == 'r') goto yy265;
 	goto yy3;
 yy196:
 	yych = *++cur;
-	if (yych <= 'Z') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= ':') goto yy2;
-			if (yych >= 'A') goto yy2;
-		}
-	} else {
-		if (yych <= '`') {
-			if (yych == '_') goto yy2;
-		} else {
-			if (yych == 'e') goto yy251;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	if (yych == 's') goto yy266;
+	goto yy3;
 yy197:
-#line 219 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(debug); }
-#line 1151 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'c') goto yy267;
+	goto yy3;
 yy198:
 	yych = *++cur;
-	if (yych <= '_') {
-		if (yych <= ':') {
-			if (yych == '-') goto yy2;
-			if (yych >= '0') goto yy2;
-		} else {
-			if (yych <= '@') goto yy199;
-			if (yych <= 'Z') goto yy2;
-			if (yych >= '_') goto yy2;
-		}
-	} else {
-		if (yych <= 'l') {
-			if (yych <= '`') goto yy199;
-			if (yych == 'c') goto yy252;
-			goto yy2;
-		} else {
-			if (yych <= 'm') goto yy27;
-			if (yych <= 'n') goto yy253;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	if (yych == '-') goto yy268;
+	goto yy3;
 yy199:
-#line 229 "../src/parse/conf_lexer.re"
-	{ RET_CONF_ENC(Enc::Type::EBCDIC); }
-#line 1177 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'c') goto yy269;
+	goto yy3;
 yy200:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
+	if (yych == 'e') goto yy270;
+	goto yy3;
 yy201:
-#line 220 "../src/parse/conf_lexer.re"
-	{ RET_CONF_FEATURE(computed_gotos); }
-#line 1186 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'e') goto yy271;
+	goto yy3;
 yy202:
 	yych = *++cur;
-	if (yych == 'n') goto yy254;
+	if (yych == 'o') goto yy272;
 	goto yy3;
 yy203:
 	yych = *++cur;
-	if (yych == 'e') goto yy34;
+	if (yych == 'a') goto yy273;
 	goto yy3;
 yy204:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 222 "../src/parse/conf_lexer.re"
-	{ RET_CONF_FEATURE(nested_ifs); }
-#line 1202 "src/parse/conf_lexer.cc"
+	if (yych == 'a') goto yy274;
+	if (yych == 'n') goto yy275;
+	goto yy3;
 yy205:
 	yych = *++cur;
-	if (yych <= '^') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-			goto yy152;
-		} else {
-			if (yych <= ':') goto yy2;
-			if (yych <= '@') goto yy152;
-			if (yych <= 'Z') goto yy2;
-			goto yy152;
-		}
-	} else {
-		if (yych <= 'a') {
-			if (yych <= '_') goto yy2;
-			if (yych <= '`') goto yy152;
-			goto yy255;
-		} else {
-			if (yych == 'y') goto yy256;
-			if (yych <= 'z') goto yy2;
-			goto yy152;
-		}
-	}
+	if (yych == 'd') goto yy276;
+	goto yy3;
 yy206:
 	yych = *++cur;
-	if (yych <= '^') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= ':') goto yy2;
-			if (yych <= '@') goto yy207;
-			if (yych <= 'Z') goto yy2;
-		}
-	} else {
-		if (yych <= 'n') {
-			if (yych == '`') goto yy207;
-			if (yych <= 'm') goto yy2;
-			goto yy257;
-		} else {
-			if (yych == 't') goto yy258;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	if (yych == 'x') goto yy277;
+	goto yy3;
 yy207:
-#line 230 "../src/parse/conf_lexer.re"
-	{ RET_CONF_ENC(Enc::Type::UTF32); }
-#line 1249 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'r') goto yy278;
+	goto yy3;
 yy208:
 	yych = *++cur;
-	if (yych <= 'Z') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= ':') goto yy2;
-			if (yych >= 'A') goto yy2;
-		}
-	} else {
-		if (yych <= '`') {
-			if (yych == '_') goto yy2;
-		} else {
-			if (yych == 'i') goto yy259;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	if (yych == '-') goto yy279;
+	goto yy3;
 yy209:
-#line 231 "../src/parse/conf_lexer.re"
-	{ RET_CONF_ENC(Enc::Type::UCS2); }
-#line 1270 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 235 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(unsafe); }
+#line 1160 "src/parse/conf_lexer.cc"
 yy210:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 232 "../src/parse/conf_lexer.re"
-	{ RET_CONF_ENC(Enc::Type::UTF16); }
-#line 1278 "src/parse/conf_lexer.cc"
+	if (yych == 'l') goto yy280;
+	goto yy3;
 yy211:
 	yych = *++cur;
-	if (yych <= 'r') goto yy3;
-	if (yych <= 's') goto yy260;
-	if (yych <= 't') goto yy261;
+	if (yych == 'e') goto yy281;
 	goto yy3;
 yy212:
 	yych = *++cur;
-	if (yych == 'c') goto yy262;
+	if (yych == 'o') goto yy282;
 	goto yy3;
 yy213:
 	yych = *++cur;
-	if (yych == 't') goto yy263;
+	if (yych == 'm') goto yy283;
 	goto yy3;
 yy214:
 	yych = *++cur;
-	if (yych == 'y') goto yy264;
+	if (yych == 'i') goto yy284;
 	goto yy3;
 yy215:
 	yych = *++cur;
-	if (yych == 'e') goto yy265;
+	if (yych == ':') goto yy285;
 	goto yy3;
 yy216:
 	yych = *++cur;
-	if (yych == 't') goto yy266;
+	if (yych == 'e') goto yy286;
 	goto yy3;
 yy217:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 227 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(monadic); }
-#line 1312 "src/parse/conf_lexer.cc"
+	if (yych == 'i') goto yy287;
+	goto yy3;
 yy218:
 	yych = *++cur;
-	if (yych == 'i') goto yy267;
+	if (yych == 'l') goto yy288;
 	goto yy3;
 yy219:
 	yych = *++cur;
-	if (yych == 'a') goto yy268;
+	if (yych == 't') goto yy289;
 	goto yy3;
 yy220:
 	yych = *++cur;
-	if (yych == 'l') goto yy269;
+	if (yych == 's') goto yy290;
+	if (yych == 'v') goto yy291;
 	goto yy3;
 yy221:
 	yych = *++cur;
-	if (yych == 'b') goto yy270;
+	if (yych == 'n') goto yy292;
 	goto yy3;
 yy222:
 	yych = *++cur;
-	if (yych == 'b') goto yy271;
+	if (yych == 'h') goto yy293;
 	goto yy3;
 yy223:
 	yych = *++cur;
-	if (yych == 'e') goto yy272;
+	if (yych == 'i') goto yy294;
 	goto yy3;
 yy224:
 	yych = *++cur;
-	if (yych == 'p') goto yy273;
+	if (yych == 'w') goto yy295;
 	goto yy3;
 yy225:
 	yych = *++cur;
-	if (yych == 'e') goto yy274;
+	if (yych == 'e') goto yy296;
 	goto yy3;
 yy226:
 	yych = *++cur;
-	if (yych == 'e') goto yy275;
+	if (yych == 'd') goto yy297;
 	goto yy3;
 yy227:
 	yych = *++cur;
-	if (yych == 'x') goto yy276;
+	if (yych == 'o') goto yy298;
 	goto yy3;
 yy228:
 	yych = *++cur;
-	if (yych == 'n') goto yy277;
+	if (yych == 'v') goto yy299;
 	goto yy3;
 yy229:
 	yych = *++cur;
-	if (yych == 'i') goto yy278;
+	if (yych == 't') goto yy300;
 	goto yy3;
 yy230:
 	yych = *++cur;
-	if (yych == 't') goto yy279;
+	if (yych == 'm') goto yy301;
 	goto yy3;
 yy231:
 	yych = *++cur;
-	if (yych <= 'd') {
-		if (yych == 'c') goto yy280;
-		goto yy3;
-	} else {
-		if (yych <= 'e') goto yy281;
-		if (yych == 'p') goto yy282;
-		goto yy3;
-	}
+	if (yych == 'f') goto yy302;
+	goto yy3;
 yy232:
 	yych = *++cur;
-	if (yych == 'p') goto yy283;
+	if (yych == 'u') goto yy303;
 	goto yy3;
 yy233:
 	yych = *++cur;
-	if (yych == 'l') goto yy284;
+	if (yych == 'Y') goto yy304;
 	goto yy3;
 yy234:
 	yych = *++cur;
-	if (yych == 'e') goto yy285;
+	if (yych == 'l') goto yy305;
 	goto yy3;
 yy235:
 	yych = *++cur;
-	if (yych == 'o') goto yy286;
+	if (yych == 'g') goto yy306;
 	goto yy3;
 yy236:
 	yych = *++cur;
-	if (yych == 'e') goto yy287;
+	if (yych == 't') goto yy307;
 	goto yy3;
 yy237:
 	yych = *++cur;
-	if (yych == 'e') goto yy288;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 242 "../src/parse/conf_lexer.re"
+	{ RET_CONF_ENC(Enc::Type::UTF8); }
+#line 1275 "src/parse/conf_lexer.cc"
 yy238:
 	yych = *++cur;
-	if (yych == 'g') goto yy289;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 129 "../src/parse/conf_lexer.re"
+	{
+        CHECK_RET(lex_conf_bool(opts));
+        SETOPT(tags_posix_syntax, tmp_num != 0);
+        SETOPT(tags_posix_semantics, tmp_num != 0);
+        return Ret::OK;
+    }
+#line 1286 "src/parse/conf_lexer.cc"
 yy239:
 	yych = *++cur;
-	if (yych == 'r') goto yy290;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+	goto yy120;
 yy240:
 	yych = *++cur;
-	if (yych == '-') goto yy291;
-	goto yy3;
+	if (yych <= 'Z') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= ':') goto yy2;
+			if (yych >= 'A') goto yy2;
+		}
+	} else {
+		if (yych <= '`') {
+			if (yych == '_') goto yy2;
+		} else {
+			if (yych == 'i') goto yy23;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy241:
-	yych = *++cur;
-	if (yych == 'r') goto yy292;
-	goto yy3;
+#line 218 "../src/parse/conf_lexer.re"
+	{ RET_CONF_FEATURE(bitmaps); }
+#line 1311 "src/parse/conf_lexer.cc"
 yy242:
 	yych = *++cur;
-	if (yych == 'i') goto yy293;
-	goto yy3;
+	if (yych <= 'k') {
+		if (yych == 'a') goto yy24;
+		goto yy3;
+	} else {
+		if (yych <= 'l') goto yy27;
+		if (yych == 'o') goto yy308;
+		goto yy3;
+	}
 yy243:
 	yych = *++cur;
-	if (yych == 'o') goto yy294;
-	goto yy3;
+	if (yych <= 'Z') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= ':') goto yy2;
+			if (yych >= 'A') goto yy2;
+		}
+	} else {
+		if (yych <= '`') {
+			if (yych == '_') goto yy2;
+		} else {
+			if (yych == 'e') goto yy309;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy244:
-	yych = *++cur;
-	if (yych == 'p') goto yy296;
-	goto yy3;
+#line 219 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(debug); }
+#line 1342 "src/parse/conf_lexer.cc"
 yy245:
 	yych = *++cur;
-	if (yych == 'i') goto yy297;
-	goto yy3;
+	if (yych <= '_') {
+		if (yych <= ':') {
+			if (yych == '-') goto yy2;
+			if (yych >= '0') goto yy2;
+		} else {
+			if (yych <= '@') goto yy246;
+			if (yych <= 'Z') goto yy2;
+			if (yych >= '_') goto yy2;
+		}
+	} else {
+		if (yych <= 'l') {
+			if (yych <= '`') goto yy246;
+			if (yych == 'c') goto yy310;
+			goto yy2;
+		} else {
+			if (yych <= 'm') goto yy30;
+			if (yych <= 'n') goto yy311;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy246:
-	yych = *++cur;
-	if (yych == 't') goto yy298;
-	goto yy3;
+#line 238 "../src/parse/conf_lexer.re"
+	{ RET_CONF_ENC(Enc::Type::EBCDIC); }
+#line 1368 "src/parse/conf_lexer.cc"
 yy247:
 	yych = *++cur;
-	if (yych == 'Y') goto yy299;
+	if (yych == 'a') goto yy33;
 	goto yy3;
 yy248:
 	yych = *++cur;
-	if (yych == 'a') goto yy300;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
 yy249:
-	yych = *++cur;
-	if (yych == '-') goto yy301;
-	if (yych == ':') goto yy302;
-	goto yy3;
+#line 220 "../src/parse/conf_lexer.re"
+	{ RET_CONF_FEATURE(computed_gotos); }
+#line 1379 "src/parse/conf_lexer.cc"
 yy250:
 	yych = *++cur;
-	if (yych == 'm') goto yy303;
+	if (yych == 'n') goto yy312;
 	goto yy3;
 yy251:
 	yych = *++cur;
-	if (yych == 'b') goto yy51;
+	if (yych == 'e') goto yy39;
 	goto yy3;
 yy252:
 	yych = *++cur;
-	if (yych == 'b') goto yy304;
-	goto yy3;
+	if (yych <= 'Z') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= ':') goto yy2;
+			if (yych >= 'A') goto yy2;
+		}
+	} else {
+		if (yych <= '`') {
+			if (yych == '_') goto yy2;
+		} else {
+			if (yych == 'i') goto yy45;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy253:
-	yych = *++cur;
-	if (yych == 'c') goto yy305;
-	goto yy3;
+#line 222 "../src/parse/conf_lexer.re"
+	{ RET_CONF_FEATURE(nested_ifs); }
+#line 1408 "src/parse/conf_lexer.cc"
 yy254:
 	yych = *++cur;
-	if (yych == 'p') goto yy306;
-	goto yy3;
+	if (yych <= '^') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+			goto yy190;
+		} else {
+			if (yych <= ':') goto yy2;
+			if (yych <= '@') goto yy190;
+			if (yych <= 'Z') goto yy2;
+			goto yy190;
+		}
+	} else {
+		if (yych <= 'a') {
+			if (yych <= '_') goto yy2;
+			if (yych <= '`') goto yy190;
+			goto yy313;
+		} else {
+			if (yych == 'y') goto yy314;
+			if (yych <= 'z') goto yy2;
+			goto yy190;
+		}
+	}
 yy255:
 	yych = *++cur;
-	if (yych == 'g') goto yy307;
-	goto yy3;
+	if (yych <= '^') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= ':') goto yy2;
+			if (yych <= '@') goto yy256;
+			if (yych <= 'Z') goto yy2;
+		}
+	} else {
+		if (yych <= 'n') {
+			if (yych == '`') goto yy256;
+			if (yych <= 'm') goto yy2;
+			goto yy315;
+		} else {
+			if (yych == 't') goto yy316;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy256:
-	yych = *++cur;
-	if (yych == 'p') goto yy308;
-	goto yy3;
+#line 239 "../src/parse/conf_lexer.re"
+	{ RET_CONF_ENC(Enc::Type::UTF32); }
+#line 1455 "src/parse/conf_lexer.cc"
 yy257:
 	yych = *++cur;
-	if (yych == 'i') goto yy309;
-	if (yych == 's') goto yy68;
-	goto yy3;
+	if (yych <= 'Z') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= ':') goto yy2;
+			if (yych >= 'A') goto yy2;
+		}
+	} else {
+		if (yych <= '`') {
+			if (yych == '_') goto yy2;
+		} else {
+			if (yych == 'i') goto yy317;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy258:
-	yych = *++cur;
-	if (yych == 'f') goto yy310;
-	goto yy3;
+#line 240 "../src/parse/conf_lexer.re"
+	{ RET_CONF_ENC(Enc::Type::UCS2); }
+#line 1476 "src/parse/conf_lexer.cc"
 yy259:
 	yych = *++cur;
-	if (yych == 'd') goto yy311;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 241 "../src/parse/conf_lexer.re"
+	{ RET_CONF_ENC(Enc::Type::UTF16); }
+#line 1482 "src/parse/conf_lexer.cc"
 yy260:
 	yych = *++cur;
-	if (yych == 't') goto yy312;
+	if (yych <= 'r') goto yy3;
+	if (yych <= 's') goto yy318;
+	if (yych <= 't') goto yy319;
 	goto yy3;
 yy261:
 	yych = *++cur;
-	if (yych == 'o') goto yy313;
+	if (yych == 'c') goto yy320;
 	goto yy3;
 yy262:
 	yych = *++cur;
-	if (yych == 'a') goto yy314;
+	if (yych == '-') goto yy321;
 	goto yy3;
 yy263:
 	yych = *++cur;
-	if (yych == 'a') goto yy315;
+	if (yych == 't') goto yy322;
 	goto yy3;
 yy264:
 	yych = *++cur;
-	if (yych <= 'N') {
-		if (yych == 'F') goto yy316;
-		if (yych <= 'M') goto yy3;
-		goto yy317;
-	} else {
-		if (yych <= 'f') {
-			if (yych <= 'e') goto yy3;
-			goto yy318;
-		} else {
-			if (yych == 'l') goto yy319;
-			goto yy3;
-		}
-	}
+	if (yych == 'y') goto yy323;
+	goto yy3;
 yy265:
 	yych = *++cur;
-	if (yych == 'f') goto yy320;
+	if (yych == 'e') goto yy324;
 	goto yy3;
 yy266:
 	yych = *++cur;
-	if (yych == '-') goto yy321;
+	if (yych == 't') goto yy325;
 	goto yy3;
 yy267:
 	yych = *++cur;
-	if (yych == 'f') goto yy322;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 236 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(monadic); }
+#line 1518 "src/parse/conf_lexer.cc"
 yy268:
 	yych = *++cur;
-	if (yych == 'p') goto yy323;
+	if (yych == 'i') goto yy326;
 	goto yy3;
 yy269:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 119 "../src/parse/conf_lexer.re"
-	{ RET_CONF_EOF(fill_sentinel); }
-#line 1543 "src/parse/conf_lexer.cc"
+	if (yych == 'a') goto yy327;
+	goto yy3;
 yy270:
 	yych = *++cur;
-	if (yych == 'e') goto yy324;
+	if (yych == '-') goto yy328;
 	goto yy3;
 yy271:
 	yych = *++cur;
-	if (yych == 'o') goto yy325;
+	if (yych == 'l') goto yy329;
 	goto yy3;
 yy272:
 	yych = *++cur;
-	if (yych == 'x') goto yy326;
+	if (yych == 'o') goto yy330;
 	goto yy3;
 yy273:
 	yych = *++cur;
-	if (yych == 'r') goto yy327;
+	if (yych == 'b') goto yy331;
 	goto yy3;
 yy274:
 	yych = *++cur;
-	if (yych == 'f') goto yy328;
+	if (yych == 'b') goto yy332;
 	goto yy3;
 yy275:
 	yych = *++cur;
-	if (yych == ':') goto yy329;
+	if (yych == 'e') goto yy333;
 	goto yy3;
 yy276:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 203 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(bitmaps_hex); }
-#line 1575 "src/parse/conf_lexer.cc"
+	if (yych == 'r') goto yy334;
+	goto yy3;
 yy277:
 	yych = *++cur;
-	if (yych == 'v') goto yy330;
+	if (yych == 'p') goto yy335;
 	goto yy3;
 yy278:
 	yych = *++cur;
-	if (yych == 't') goto yy331;
+	if (yych == 'e') goto yy336;
 	goto yy3;
 yy279:
 	yych = *++cur;
-	if (yych == 'e') goto yy332;
+	if (yych == 'l') goto yy337;
 	goto yy3;
 yy280:
 	yych = *++cur;
-	if (yych == 'h') goto yy333;
+	if (yych == 'e') goto yy338;
 	goto yy3;
 yy281:
 	yych = *++cur;
-	if (yych == 'n') goto yy334;
+	if (yych == 'x') goto yy339;
 	goto yy3;
 yy282:
 	yych = *++cur;
-	if (yych == 'a') goto yy335;
+	if (yych == 'n') goto yy340;
 	goto yy3;
 yy283:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 125 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(fn_sep); }
-#line 1607 "src/parse/conf_lexer.cc"
+	if (yych == 'i') goto yy341;
+	goto yy3;
 yy284:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 105 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(api_sigil); }
-#line 1615 "src/parse/conf_lexer.cc"
+	if (yych == 't') goto yy342;
+	goto yy3;
 yy285:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
+	if (yych <= 'd') {
+		if (yych == 'c') goto yy343;
+		goto yy3;
+	} else {
+		if (yych <= 'e') goto yy344;
+		if (yych == 'p') goto yy345;
+		goto yy3;
 	}
-#line 104 "../src/parse/conf_lexer.re"
-	{ goto api_style; }
-#line 1623 "src/parse/conf_lexer.cc"
 yy286:
 	yych = *++cur;
-	if (yych == 'r') goto yy336;
+	if (yych == 'p') goto yy346;
 	goto yy3;
 yy287:
 	yych = *++cur;
-	if (yych == 'n') goto yy337;
+	if (yych == 'l') goto yy347;
 	goto yy3;
 yy288:
 	yych = *++cur;
-	if (yych == 'r') goto yy338;
+	if (yych == 'e') goto yy348;
 	goto yy3;
 yy289:
 	yych = *++cur;
-	if (yych == 'e') goto yy339;
+	if (yych == 'o') goto yy349;
 	goto yy3;
 yy290:
 	yych = *++cur;
-	if (yych == 'e') goto yy340;
+	if (yych == 'e') goto yy350;
 	goto yy3;
 yy291:
 	yych = *++cur;
-	if (yych == 'g') goto yy341;
+	if (yych == 'e') goto yy351;
 	goto yy3;
 yy292:
 	yych = *++cur;
-	if (yych == 't') goto yy342;
+	if (yych == 'g') goto yy352;
 	goto yy3;
 yy293:
 	yych = *++cur;
-	if (yych == 'd') goto yy343;
+	if (yych == 'r') goto yy353;
 	goto yy3;
 yy294:
-	yyaccept = 0;
-	yych = *(mar = ++cur);
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-	if (yych == '@') goto yy344;
+	yych = *++cur;
+	if (yych == 'g') goto yy354;
+	goto yy3;
 yy295:
-#line 212 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(cond_goto); }
-#line 1666 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'i') goto yy355;
+	goto yy3;
 yy296:
 	yych = *++cur;
-	if (yych == 'r') goto yy346;
+	if (yych == '-') goto yy356;
 	goto yy3;
 yy297:
 	yych = *++cur;
-	if (yych == 'x') goto yy347;
+	if (yych == '-') goto yy357;
 	goto yy3;
 yy298:
 	yych = *++cur;
-	if (yych == 'p') goto yy348;
+	if (yych == 'r') goto yy358;
 	goto yy3;
 yy299:
 	yych = *++cur;
-	switch (yych) {
-		case 'B': goto yy349;
-		case 'C': goto yy350;
-		case 'D': goto yy351;
-		case 'F': goto yy352;
-		case 'G': goto yy353;
-		case 'I': goto yy354;
-		case 'L': goto yy355;
-		case 'M': goto yy356;
-		case 'P': goto yy357;
-		case 'R': goto yy358;
-		case 'S': goto yy359;
-		default: goto yy3;
-	}
+	if (yych == 'i') goto yy359;
+	goto yy3;
 yy300:
 	yych = *++cur;
-	if (yych == 's') goto yy360;
+	if (yych == 'o') goto yy360;
 	goto yy3;
 yy301:
 	yych = *++cur;
-	if (yych == 'p') goto yy361;
+	if (yych == 'p') goto yy362;
 	goto yy3;
 yy302:
 	yych = *++cur;
-	if (yych == 'e') goto yy362;
-	if (yych == 'u') goto yy363;
+	if (yych == 'i') goto yy363;
 	goto yy3;
 yy303:
 	yych = *++cur;
-	if (yych == 'p') goto yy364;
+	if (yych == 't') goto yy364;
 	goto yy3;
 yy304:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-	goto yy199;
+	if (yych == 'Y') goto yy365;
+	goto yy3;
 yy305:
 	yych = *++cur;
-	if (yych == 'o') goto yy365;
+	if (yych == 'a') goto yy366;
 	goto yy3;
 yy306:
 	yych = *++cur;
-	if (yych == 'u') goto yy366;
+	if (yych == '-') goto yy367;
+	if (yych == ':') goto yy368;
 	goto yy3;
 yy307:
 	yych = *++cur;
-	if (yych == 's') goto yy192;
+	if (yych == 'h') goto yy369;
 	goto yy3;
 yy308:
 	yych = *++cur;
-	if (yych == 'e') goto yy367;
+	if (yych <= 'k') goto yy3;
+	if (yych <= 'l') goto yy58;
+	if (yych <= 'm') goto yy370;
 	goto yy3;
 yy309:
 	yych = *++cur;
-	if (yych == 'c') goto yy368;
+	if (yych == 'b') goto yy61;
 	goto yy3;
 yy310:
 	yych = *++cur;
-	if (yych == '-') goto yy369;
+	if (yych == 'b') goto yy371;
 	goto yy3;
 yy311:
 	yych = *++cur;
-	if (yych == 'e') goto yy370;
+	if (yych == 'c') goto yy372;
 	goto yy3;
 yy312:
 	yych = *++cur;
-	if (yych == 'r') goto yy371;
+	if (yych == 'p') goto yy373;
 	goto yy3;
 yy313:
 	yych = *++cur;
-	if (yych == 'p') goto yy372;
+	if (yych == 'b') goto yy81;
+	if (yych == 'g') goto yy374;
 	goto yy3;
 yy314:
 	yych = *++cur;
-	if (yych == 'p') goto yy373;
+	if (yych == 'p') goto yy375;
 	goto yy3;
 yy315:
 	yych = *++cur;
-	if (yych == 'r') goto yy374;
-	goto yy3;
+	if (yych <= 'q') {
+		if (yych == 'i') goto yy376;
+		goto yy3;
+	} else {
+		if (yych <= 'r') goto yy83;
+		if (yych <= 's') goto yy84;
+		goto yy3;
+	}
 yy316:
 	yych = *++cur;
-	if (yych == 'i') goto yy375;
+	if (yych == 'f') goto yy377;
 	goto yy3;
 yy317:
 	yych = *++cur;
-	if (yych == 'e') goto yy376;
+	if (yych == 'd') goto yy378;
 	goto yy3;
 yy318:
 	yych = *++cur;
-	if (yych == 'i') goto yy377;
+	if (yych == 't') goto yy379;
 	goto yy3;
 yy319:
 	yych = *++cur;
-	if (yych == 'o') goto yy378;
+	if (yych == 'o') goto yy380;
 	goto yy3;
 yy320:
 	yych = *++cur;
-	if (yych == 'i') goto yy379;
+	if (yych == 'a') goto yy381;
 	goto yy3;
 yy321:
 	yych = *++cur;
-	if (yych == 'c') goto yy380;
+	if (yych == 'l') goto yy382;
 	goto yy3;
 yy322:
 	yych = *++cur;
-	if (yych == 's') goto yy204;
+	if (yych == 'a') goto yy383;
 	goto yy3;
 yy323:
 	yych = *++cur;
-	if (yych == 't') goto yy381;
-	goto yy3;
+	if (yych <= 'N') {
+		if (yych == 'F') goto yy384;
+		if (yych <= 'M') goto yy3;
+		goto yy385;
+	} else {
+		if (yych <= 'f') {
+			if (yych <= 'e') goto yy3;
+			goto yy386;
+		} else {
+			if (yych == 'l') goto yy387;
+			goto yy3;
+		}
+	}
 yy324:
 	yych = *++cur;
-	if (yych == 'l') goto yy382;
+	if (yych == 'f') goto yy388;
 	goto yy3;
 yy325:
 	yych = *++cur;
-	if (yych == 'r') goto yy384;
+	if (yych == '-') goto yy389;
 	goto yy3;
 yy326:
 	yych = *++cur;
-	if (yych == 't') goto yy385;
+	if (yych == 'f') goto yy390;
 	goto yy3;
 yy327:
 	yych = *++cur;
-	if (yych == 'e') goto yy386;
+	if (yych == 'p') goto yy391;
 	goto yy3;
 yy328:
 	yych = *++cur;
-	if (yych == 'i') goto yy387;
+	if (yych == 'g') goto yy392;
 	goto yy3;
 yy329:
 	yych = *++cur;
-	if (yych == 'y') goto yy388;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 119 "../src/parse/conf_lexer.re"
+	{ RET_CONF_EOF(fill_sentinel); }
+#line 1795 "src/parse/conf_lexer.cc"
 yy330:
 	yych = *++cur;
-	if (yych == 'e') goto yy389;
+	if (yych == 'p') goto yy393;
 	goto yy3;
 yy331:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 201 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(char_emit); }
-#line 1829 "src/parse/conf_lexer.cc"
+	if (yych == 'e') goto yy394;
+	goto yy3;
 yy332:
 	yych = *++cur;
-	if (yych == 'r') goto yy390;
+	if (yych == 'o') goto yy395;
 	goto yy3;
 yy333:
 	yych = *++cur;
-	if (yych == 'e') goto yy391;
+	if (yych == 'x') goto yy396;
 	goto yy3;
 yy334:
 	yych = *++cur;
-	if (yych == 'a') goto yy392;
+	if (yych == 'i') goto yy397;
 	goto yy3;
 yy335:
 	yych = *++cur;
-	if (yych == 'r') goto yy393;
+	if (yych == 'r') goto yy398;
 	goto yy3;
 yy336:
 	yych = *++cur;
-	if (yych == 's') goto yy394;
+	if (yych == 'f') goto yy399;
 	goto yy3;
 yy337:
 	yych = *++cur;
-	if (yych == 's') goto yy395;
+	if (yych == 'o') goto yy400;
 	goto yy3;
 yy338:
 	yych = *++cur;
-	if (yych == 't') goto yy396;
+	if (yych == ':') goto yy401;
 	goto yy3;
 yy339:
 	yych = *++cur;
-	if (yych == 's') goto yy397;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 203 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(bitmaps_hex); }
+#line 1837 "src/parse/conf_lexer.cc"
 yy340:
 	yych = *++cur;
-	if (yych == 's') goto yy398;
+	if (yych == 'v') goto yy402;
 	goto yy3;
 yy341:
 	yych = *++cur;
-	if (yych == 'o') goto yy399;
+	if (yych == 't') goto yy403;
 	goto yy3;
 yy342:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 207 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(cond_abort); }
-#line 1877 "src/parse/conf_lexer.cc"
+	if (yych == 'e') goto yy404;
+	goto yy3;
 yy343:
 	yych = *++cur;
-	if (yych == 'e') goto yy400;
+	if (yych == 'h') goto yy405;
 	goto yy3;
 yy344:
 	yych = *++cur;
-	if (yych == 'c') goto yy401;
+	if (yych == 'n') goto yy406;
+	goto yy3;
 yy345:
-	cur = mar;
-	if (yyaccept <= 2) {
-		if (yyaccept <= 1) {
-			if (yyaccept == 0) {
-				goto yy295;
-			} else {
-				goto yy383;
-			}
-		} else {
-			goto yy461;
-		}
-	} else {
-		if (yyaccept <= 4) {
-			if (yyaccept == 3) {
-				goto yy537;
-			} else {
-				goto yy709;
-			}
-		} else {
-			goto yy746;
-		}
-	}
-yy346:
 	yych = *++cur;
-	if (yych == 'e') goto yy402;
+	if (yych == 'a') goto yy407;
 	goto yy3;
+yy346:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 125 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(fn_sep); }
+#line 1867 "src/parse/conf_lexer.cc"
 yy347:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 208 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(cond_label_prefix); }
-#line 1919 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 105 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(api_sigil); }
+#line 1873 "src/parse/conf_lexer.cc"
 yy348:
 	yych = *++cur;
-	if (yych == 'u') goto yy403;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 104 "../src/parse/conf_lexer.re"
+	{ goto api_style; }
+#line 1879 "src/parse/conf_lexer.cc"
 yy349:
 	yych = *++cur;
-	if (yych == 'A') goto yy404;
+	if (yych == 'r') goto yy408;
 	goto yy3;
 yy350:
 	yych = *++cur;
-	if (yych <= 'S') {
-		if (yych == 'O') goto yy405;
-		goto yy3;
-	} else {
-		if (yych <= 'T') goto yy406;
-		if (yych <= 'U') goto yy407;
-		goto yy3;
-	}
+	if (yych == 'n') goto yy409;
+	goto yy3;
 yy351:
 	yych = *++cur;
-	if (yych == 'E') goto yy408;
+	if (yych == 'r') goto yy410;
 	goto yy3;
 yy352:
 	yych = *++cur;
-	if (yych == 'I') goto yy409;
-	if (yych == 'N') goto yy410;
+	if (yych == 'e') goto yy411;
 	goto yy3;
 yy353:
 	yych = *++cur;
-	if (yych == 'E') goto yy411;
+	if (yych == 'e') goto yy412;
 	goto yy3;
 yy354:
 	yych = *++cur;
-	if (yych == 'N') goto yy412;
+	if (yych == 'h') goto yy413;
 	goto yy3;
 yy355:
 	yych = *++cur;
-	if (yych == 'E') goto yy413;
-	if (yych == 'I') goto yy414;
+	if (yych == 't') goto yy414;
 	goto yy3;
 yy356:
 	yych = *++cur;
-	if (yych == 'A') goto yy415;
-	if (yych == 'T') goto yy416;
+	if (yych == 'c') goto yy415;
 	goto yy3;
 yy357:
 	yych = *++cur;
-	if (yych == 'E') goto yy417;
+	if (yych == 'g') goto yy416;
 	goto yy3;
 yy358:
 	yych = *++cur;
-	if (yych == 'E') goto yy418;
+	if (yych == 't') goto yy417;
 	goto yy3;
 yy359:
 	yych = *++cur;
-	switch (yych) {
-		case 'E': goto yy419;
-		case 'H': goto yy420;
-		case 'K': goto yy421;
-		case 'T': goto yy422;
-		default: goto yy3;
-	}
-yy360:
-	yych = *++cur;
-	if (yych == 's') goto yy423;
+	if (yych == 'd') goto yy418;
 	goto yy3;
+yy360:
+	yyaccept = 0;
+	yych = *(mar = ++cur);
+	if (yybm[0+yych] & 32) goto yy2;
+	if (yych == '@') goto yy419;
 yy361:
-	yych = *++cur;
-	if (yych == 'o') goto yy424;
-	goto yy3;
+#line 212 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(cond_goto); }
+#line 1932 "src/parse/conf_lexer.cc"
 yy362:
 	yych = *++cur;
-	if (yych == 'b') goto yy425;
+	if (yych == 'r') goto yy421;
 	goto yy3;
 yy363:
 	yych = *++cur;
-	if (yych == 'c') goto yy426;
-	if (yych == 't') goto yy427;
+	if (yych == 'x') goto yy422;
 	goto yy3;
 yy364:
 	yych = *++cur;
-	if (yych == 'u') goto yy428;
+	if (yych == 'p') goto yy423;
 	goto yy3;
 yy365:
 	yych = *++cur;
-	if (yych == 'd') goto yy429;
-	goto yy3;
+	switch (yych) {
+		case 'B': goto yy424;
+		case 'C': goto yy425;
+		case 'D': goto yy426;
+		case 'F': goto yy427;
+		case 'G': goto yy428;
+		case 'I': goto yy429;
+		case 'L': goto yy430;
+		case 'M': goto yy431;
+		case 'P': goto yy432;
+		case 'R': goto yy433;
+		case 'S': goto yy434;
+		default: goto yy3;
+	}
 yy366:
 	yych = *++cur;
-	if (yych == 't') goto yy430;
+	if (yych == 's') goto yy435;
 	goto yy3;
 yy367:
 	yych = *++cur;
-	if (yych == '-') goto yy431;
+	if (yych == 'p') goto yy436;
 	goto yy3;
 yy368:
 	yych = *++cur;
-	if (yych == 'o') goto yy432;
+	if (yych == 'e') goto yy437;
+	if (yych == 'u') goto yy438;
 	goto yy3;
 yy369:
 	yych = *++cur;
-	if (yych == '1') goto yy433;
-	if (yych == '8') goto yy190;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 228 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(fast_path); }
+#line 1979 "src/parse/conf_lexer.cc"
 yy370:
 	yych = *++cur;
-	if (yych == '-') goto yy434;
+	if (yych == 'p') goto yy439;
 	goto yy3;
 yy371:
 	yych = *++cur;
-	if (yych == 'i') goto yy435;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+	goto yy246;
 yy372:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 239 "../src/parse/conf_lexer.re"
-	{ RET_CONF_NUM_NONNEG(indent_top); }
-#line 2039 "src/parse/conf_lexer.cc"
+	if (yych == 'o') goto yy440;
+	goto yy3;
 yy373:
 	yych = *++cur;
-	if (yych == 't') goto yy436;
+	if (yych == 'u') goto yy441;
 	goto yy3;
 yy374:
 	yych = *++cur;
-	if (yych == 't') goto yy382;
+	if (yych == 's') goto yy239;
 	goto yy3;
 yy375:
 	yych = *++cur;
-	if (yych == 'l') goto yy437;
+	if (yych == 'e') goto yy442;
 	goto yy3;
 yy376:
 	yych = *++cur;
-	if (yych == 'x') goto yy438;
+	if (yych == 'c') goto yy443;
 	goto yy3;
 yy377:
 	yych = *++cur;
-	if (yych == 'l') goto yy439;
+	if (yych == '-') goto yy444;
 	goto yy3;
 yy378:
 	yych = *++cur;
-	if (yych == 'o') goto yy440;
+	if (yych == 'e') goto yy445;
 	goto yy3;
 yy379:
 	yych = *++cur;
-	if (yych == 'x') goto yy441;
+	if (yych == 'r') goto yy446;
 	goto yy3;
 yy380:
 	yych = *++cur;
-	if (yych == 'a') goto yy442;
+	if (yych == 'p') goto yy447;
 	goto yy3;
 yy381:
 	yych = *++cur;
-	if (yych == 'u') goto yy443;
+	if (yych == 'p') goto yy448;
 	goto yy3;
 yy382:
-	yyaccept = 1;
-	yych = *(mar = ++cur);
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-	if (yych <= '\r') {
-		if (yych == '\t') {
-			ctx = cur;
-			goto yy444;
-		}
-		if (yych >= '\r') {
-			ctx = cur;
-			goto yy444;
-		}
-	} else {
-		if (yych <= ' ') {
-			if (yych >= ' ') {
-				ctx = cur;
-				goto yy444;
-			}
-		} else {
-			if (yych == '=') {
-				ctx = cur;
-				goto yy445;
-			}
-		}
-	}
+	yych = *++cur;
+	if (yych == 'o') goto yy449;
+	goto yy3;
 yy383:
-#line 246 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(label_start); }
-#line 2107 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'r') goto yy450;
+	goto yy3;
 yy384:
 	yych = *++cur;
-	if (yych == 't') goto yy446;
+	if (yych == 'i') goto yy451;
 	goto yy3;
 yy385:
 	yych = *++cur;
-	if (yych == 'l') goto yy447;
+	if (yych == 'e') goto yy452;
 	goto yy3;
 yy386:
 	yych = *++cur;
-	if (yych == 's') goto yy448;
+	if (yych == 'i') goto yy453;
 	goto yy3;
 yy387:
 	yych = *++cur;
-	if (yych == 'x') goto yy449;
+	if (yych == 'o') goto yy454;
 	goto yy3;
 yy388:
 	yych = *++cur;
-	if (yych == 'y') goto yy450;
+	if (yych == 'i') goto yy455;
 	goto yy3;
 yy389:
 	yych = *++cur;
-	if (yych == 'r') goto yy451;
+	if (yych == 'c') goto yy456;
 	goto yy3;
 yy390:
 	yych = *++cur;
-	if (yych == 'a') goto yy452;
+	if (yych == 's') goto yy457;
 	goto yy3;
 yy391:
 	yych = *++cur;
-	if (yych == 'c') goto yy453;
+	if (yych == 't') goto yy458;
 	goto yy3;
 yy392:
 	yych = *++cur;
-	if (yych == 'b') goto yy454;
+	if (yych == 'e') goto yy459;
 	goto yy3;
 yy393:
 	yych = *++cur;
-	if (yych == 'a') goto yy455;
+	if (yych == 's') goto yy460;
 	goto yy3;
 yy394:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-	goto yy194;
+	if (yych == 'l') goto yy461;
+	goto yy3;
 yy395:
 	yych = *++cur;
-	if (yych == 'i') goto yy456;
+	if (yych == 'r') goto yy463;
 	goto yy3;
 yy396:
 	yych = *++cur;
-	if (yych == 'e') goto yy457;
+	if (yych == 't') goto yy464;
 	goto yy3;
 yy397:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 225 "../src/parse/conf_lexer.re"
-	{ RET_CONF_FEATURE(case_ranges); }
-#line 2169 "src/parse/conf_lexer.cc"
+	if (yych == 'v') goto yy465;
+	goto yy3;
 yy398:
 	yych = *++cur;
-	if (yych == 'h') goto yy458;
+	if (yych == 'e') goto yy466;
 	goto yy3;
 yy399:
 	yych = *++cur;
-	if (yych == 't') goto yy459;
+	if (yych == 'i') goto yy467;
 	goto yy3;
 yy400:
 	yych = *++cur;
-	if (yych == 'r') goto yy460;
+	if (yych == 'o') goto yy468;
 	goto yy3;
 yy401:
 	yych = *++cur;
-	if (yych == 'o') goto yy462;
-	goto yy345;
+	if (yych == 'y') goto yy469;
+	goto yy3;
 yy402:
 	yych = *++cur;
-	if (yych == 'f') goto yy463;
+	if (yych == 'e') goto yy470;
 	goto yy3;
 yy403:
 	yych = *++cur;
-	if (yych == 't') goto yy464;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 201 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(char_emit); }
+#line 2117 "src/parse/conf_lexer.cc"
 yy404:
 	yych = *++cur;
-	if (yych == 'C') goto yy465;
+	if (yych == 'r') goto yy471;
 	goto yy3;
 yy405:
 	yych = *++cur;
-	if (yych == 'N') goto yy466;
-	if (yych == 'P') goto yy467;
+	if (yych == 'e') goto yy472;
 	goto yy3;
 yy406:
 	yych = *++cur;
-	if (yych <= 'W') goto yy3;
-	if (yych <= 'X') goto yy468;
-	if (yych <= 'Y') goto yy469;
+	if (yych == 'a') goto yy473;
 	goto yy3;
 yy407:
 	yych = *++cur;
-	if (yych == 'R') goto yy470;
+	if (yych == 'r') goto yy474;
 	goto yy3;
 yy408:
 	yych = *++cur;
-	if (yych == 'B') goto yy471;
+	if (yych == 's') goto yy475;
 	goto yy3;
 yy409:
 	yych = *++cur;
-	if (yych == 'L') goto yy472;
+	if (yych == 's') goto yy476;
 	goto yy3;
 yy410:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 181 "../src/parse/conf_lexer.re"
-	{
-        CHECK_RET(lex_conf_list(opts));
-        if (tmp_list.size() < 1) {
-            RET_FAIL(error_at_tok("`re2c:define:YYFN` value should be a nonempty list of strings"));
-        }
-        SETOPT(api_fn, tmp_list);
-        return Ret::OK;
-    }
-#line 2235 "src/parse/conf_lexer.cc"
+	if (yych == 't') goto yy477;
+	goto yy3;
 yy411:
 	yych = *++cur;
-	if (yych == 'T') goto yy473;
+	if (yych == 's') goto yy478;
 	goto yy3;
 yy412:
 	yych = *++cur;
-	if (yych == 'P') goto yy474;
+	if (yych == 's') goto yy479;
 	goto yy3;
 yy413:
 	yych = *++cur;
-	if (yych == 'S') goto yy475;
+	if (yych == 't') goto yy480;
 	goto yy3;
 yy414:
 	yych = *++cur;
-	if (yych == 'M') goto yy476;
+	if (yych == 'c') goto yy481;
 	goto yy3;
 yy415:
 	yych = *++cur;
-	if (yych == 'R') goto yy477;
-	if (yych == 'X') goto yy478;
+	if (yych == 'h') goto yy482;
 	goto yy3;
 yy416:
 	yych = *++cur;
-	if (yych == 'A') goto yy479;
+	if (yych == 'o') goto yy483;
 	goto yy3;
 yy417:
 	yych = *++cur;
-	if (yych == 'E') goto yy480;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 207 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(cond_abort); }
+#line 2175 "src/parse/conf_lexer.cc"
 yy418:
 	yych = *++cur;
-	if (yych == 'S') goto yy481;
+	if (yych == 'e') goto yy484;
 	goto yy3;
 yy419:
 	yych = *++cur;
-	if (yych == 'T') goto yy482;
-	goto yy3;
+	if (yych == 'c') goto yy485;
 yy420:
-	yych = *++cur;
-	if (yych == 'I') goto yy483;
-	goto yy3;
+	cur = mar;
+	if (yyaccept <= 2) {
+		if (yyaccept <= 1) {
+			if (yyaccept == 0) goto yy361;
+			else goto yy462;
+		} else {
+			goto yy552;
+		}
+	} else {
+		if (yyaccept <= 4) {
+			if (yyaccept == 3) goto yy632;
+			else goto yy808;
+		} else {
+			goto yy845;
+		}
+	}
 yy421:
 	yych = *++cur;
-	if (yych == 'I') goto yy484;
+	if (yych == 'e') goto yy486;
 	goto yy3;
 yy422:
 	yych = *++cur;
-	if (yych == 'A') goto yy485;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 208 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(cond_label_prefix); }
+#line 2209 "src/parse/conf_lexer.cc"
 yy423:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 236 "../src/parse/conf_lexer.re"
-	{ goto empty_class; }
-#line 2292 "src/parse/conf_lexer.cc"
+	if (yych == 'u') goto yy487;
+	goto yy3;
 yy424:
 	yych = *++cur;
-	if (yych == 'l') goto yy486;
+	if (yych == 'A') goto yy488;
 	goto yy3;
 yy425:
 	yych = *++cur;
-	if (yych == 'c') goto yy487;
-	goto yy3;
+	if (yych <= 'S') {
+		if (yych == 'O') goto yy489;
+		goto yy3;
+	} else {
+		if (yych <= 'T') goto yy490;
+		if (yych <= 'U') goto yy491;
+		goto yy3;
+	}
 yy426:
 	yych = *++cur;
-	if (yych == 's') goto yy488;
+	if (yych == 'E') goto yy492;
 	goto yy3;
 yy427:
 	yych = *++cur;
-	if (yych == 'f') goto yy489;
+	if (yych == 'I') goto yy493;
+	if (yych == 'N') goto yy494;
 	goto yy3;
 yy428:
 	yych = *++cur;
-	if (yych == 't') goto yy490;
+	if (yych == 'E') goto yy495;
 	goto yy3;
 yy429:
 	yych = *++cur;
-	if (yych == 'i') goto yy491;
+	if (yych == 'N') goto yy496;
 	goto yy3;
 yy430:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-	goto yy45;
+	if (yych == 'E') goto yy497;
+	if (yych == 'I') goto yy498;
+	goto yy3;
 yy431:
 	yych = *++cur;
-	if (yych == 'h') goto yy10;
+	if (yych == 'A') goto yy499;
+	if (yych == 'T') goto yy500;
 	goto yy3;
 yy432:
 	yych = *++cur;
-	if (yych == 'd') goto yy492;
+	if (yych == 'E') goto yy501;
 	goto yy3;
 yy433:
 	yych = *++cur;
-	if (yych == '6') goto yy210;
+	if (yych == 'E') goto yy502;
 	goto yy3;
 yy434:
 	yych = *++cur;
-	if (yych == 'c') goto yy493;
-	goto yy3;
+	switch (yych) {
+		case 'E': goto yy503;
+		case 'H': goto yy504;
+		case 'K': goto yy505;
+		case 'T': goto yy506;
+		default: goto yy3;
+	}
 yy435:
 	yych = *++cur;
-	if (yych == 'n') goto yy494;
+	if (yych == 's') goto yy507;
 	goto yy3;
 yy436:
 	yych = *++cur;
-	if (yych == 'u') goto yy495;
+	if (yych == 'o') goto yy508;
 	goto yy3;
 yy437:
 	yych = *++cur;
-	if (yych == 'l') goto yy496;
+	if (yych == 'b') goto yy509;
 	goto yy3;
 yy438:
 	yych = *++cur;
-	if (yych == 't') goto yy497;
+	if (yych == 'c') goto yy510;
+	if (yych == 't') goto yy511;
 	goto yy3;
 yy439:
 	yych = *++cur;
-	if (yych == 'l') goto yy498;
+	if (yych == 'u') goto yy512;
 	goto yy3;
 yy440:
 	yych = *++cur;
-	if (yych == 'p') goto yy499;
+	if (yych == 'd') goto yy513;
 	goto yy3;
 yy441:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 241 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(label_prefix); }
-#line 2370 "src/parse/conf_lexer.cc"
+	if (yych == 't') goto yy514;
+	goto yy3;
 yy442:
 	yych = *++cur;
-	if (yych == 'p') goto yy500;
+	if (yych == '-') goto yy515;
 	goto yy3;
 yy443:
 	yych = *++cur;
-	if (yych == 'r') goto yy501;
+	if (yych == 'o') goto yy516;
 	goto yy3;
 yy444:
-	++cur;
-	if (lim <= cur) YYFILL(1);
-	yych = *cur;
-	if (yybm[0+yych] & 64) {
-		goto yy444;
-	}
-	if (yych != '=') goto yy345;
+	yych = *++cur;
+	if (yych == '1') goto yy517;
+	if (yych == '8') goto yy237;
+	goto yy3;
 yy445:
-	++cur;
-	if ((lim - cur) < 2) YYFILL(2);
-	yych = *cur;
-	if (yych <= ' ') {
-		if (yych <= '\f') {
-			if (yych == '\t') goto yy445;
-			goto yy345;
-		} else {
-			if (yych <= '\r') goto yy445;
-			if (yych <= 0x1F) goto yy345;
-			goto yy445;
-		}
-	} else {
-		if (yych <= '/') {
-			if (yych == '-') goto yy502;
-			goto yy345;
-		} else {
-			if (yych <= '0') goto yy503;
-			if (yych <= '9') goto yy505;
-			goto yy345;
-		}
-	}
+	yych = *++cur;
+	if (yych == '-') goto yy518;
+	goto yy3;
 yy446:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 215 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(state_abort); }
-#line 2417 "src/parse/conf_lexer.cc"
+	if (yych == 'i') goto yy519;
+	goto yy3;
 yy447:
 	yych = *++cur;
-	if (yych == 'a') goto yy506;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 248 "../src/parse/conf_lexer.re"
+	{ RET_CONF_NUM_NONNEG(indent_top); }
+#line 2327 "src/parse/conf_lexer.cc"
 yy448:
 	yych = *++cur;
-	if (yych == 's') goto yy507;
+	if (yych == 't') goto yy520;
 	goto yy3;
 yy449:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 135 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(tags_prefix); }
-#line 2433 "src/parse/conf_lexer.cc"
+	if (yych == 'o') goto yy521;
+	goto yy3;
 yy450:
 	yych = *++cur;
-	switch (yych) {
-		case 'a': goto yy508;
-		case 'b': goto yy509;
-		case 'c': goto yy510;
-		case 'f': goto yy511;
-		case 'n': goto yy512;
-		case 'p': goto yy513;
-		case 'r': goto yy514;
-		case 's': goto yy515;
-		case 't': goto yy516;
-		default: goto yy3;
-	}
+	if (yych == 't') goto yy461;
+	goto yy3;
 yy451:
 	yych = *++cur;
-	if (yych == 's') goto yy517;
+	if (yych == 'l') goto yy522;
 	goto yy3;
 yy452:
 	yych = *++cur;
-	if (yych == 'l') goto yy518;
+	if (yych == 'x') goto yy523;
 	goto yy3;
 yy453:
 	yych = *++cur;
-	if (yych == 'k') goto yy519;
+	if (yych == 'l') goto yy524;
 	goto yy3;
 yy454:
 	yych = *++cur;
-	if (yych == 'l') goto yy520;
+	if (yych == 'o') goto yy525;
 	goto yy3;
 yy455:
 	yych = *++cur;
-	if (yych == 'm') goto yy521;
+	if (yych == 'x') goto yy526;
 	goto yy3;
 yy456:
 	yych = *++cur;
-	if (yych == 't') goto yy522;
+	if (yych == 'a') goto yy527;
 	goto yy3;
 yy457:
 	yych = *++cur;
-	if (yych == 'd') goto yy523;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+	goto yy253;
 yy458:
 	yych = *++cur;
-	if (yych == 'o') goto yy524;
+	if (yych == 'u') goto yy528;
 	goto yy3;
 yy459:
 	yych = *++cur;
-	if (yych == 'o') goto yy525;
+	if (yych == 'n') goto yy529;
 	goto yy3;
 yy460:
-	yyaccept = 2;
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 223 "../src/parse/conf_lexer.re"
+	{ RET_CONF_FEATURE(simd_loops); }
+#line 2381 "src/parse/conf_lexer.cc"
+yy461:
+	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yybm[0+yych] & 32) {
-		goto yy2;
+	if (yybm[0+yych] & 32) goto yy2;
+	if (yych <= '\r') {
+		if (yych == '\t') {
+			ctx = cur;
+			goto yy530;
+		}
+		if (yych >= '\r') {
+			ctx = cur;
+			goto yy530;
+		}
+	} else {
+		if (yych <= ' ') {
+			if (yych >= ' ') {
+				ctx = cur;
+				goto yy530;
+			}
+		} else {
+			if (yych == '=') {
+				ctx = cur;
+				goto yy531;
+			}
+		}
 	}
-	if (yych == '@') goto yy526;
-yy461:
-#line 210 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(cond_div); }
-#line 2494 "src/parse/conf_lexer.cc"
 yy462:
-	yych = *++cur;
-	if (yych == 'n') goto yy527;
-	goto yy345;
+#line 255 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(label_start); }
+#line 2411 "src/parse/conf_lexer.cc"
 yy463:
 	yych = *++cur;
-	if (yych == 'i') goto yy528;
+	if (yych == 't') goto yy532;
 	goto yy3;
 yy464:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-	goto yy197;
+	if (yych == 'l') goto yy533;
+	goto yy3;
 yy465:
 	yych = *++cur;
-	if (yych == 'K') goto yy529;
+	if (yych == 'e') goto yy534;
 	goto yy3;
 yy466:
 	yych = *++cur;
-	if (yych == 'D') goto yy530;
+	if (yych == 's') goto yy535;
 	goto yy3;
 yy467:
 	yych = *++cur;
-	if (yych == 'Y') goto yy531;
+	if (yych == 'x') goto yy536;
 	goto yy3;
 yy468:
 	yych = *++cur;
-	if (yych == 'M') goto yy532;
+	if (yych == 'p') goto yy537;
 	goto yy3;
 yy469:
 	yych = *++cur;
-	if (yych == 'P') goto yy533;
+	if (yych == 'y') goto yy538;
 	goto yy3;
 yy470:
 	yych = *++cur;
-	if (yych == 'S') goto yy534;
+	if (yych == 'r') goto yy539;
 	goto yy3;
 yy471:
 	yych = *++cur;
-	if (yych == 'U') goto yy535;
+	if (yych == 'a') goto yy540;
 	goto yy3;
 yy472:
 	yych = *++cur;
-	if (yych == 'L') goto yy536;
+	if (yych == 'c') goto yy541;
 	goto yy3;
 yy473:
 	yych = *++cur;
-	if (yych <= 'B') {
-		if (yych == 'A') goto yy538;
-		goto yy3;
-	} else {
-		if (yych <= 'C') goto yy539;
-		if (yych == 'S') goto yy540;
-		goto yy3;
-	}
+	if (yych == 'b') goto yy542;
+	goto yy3;
 yy474:
 	yych = *++cur;
-	if (yych == 'U') goto yy541;
+	if (yych == 'a') goto yy543;
 	goto yy3;
 yy475:
 	yych = *++cur;
-	if (yych == 'S') goto yy542;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+	goto yy241;
 yy476:
 	yych = *++cur;
-	if (yych == 'I') goto yy543;
+	if (yych == 'i') goto yy544;
 	goto yy3;
 yy477:
 	yych = *++cur;
-	if (yych == 'K') goto yy544;
+	if (yych == 'e') goto yy545;
 	goto yy3;
 yy478:
 	yych = *++cur;
-	if (yych == 'F') goto yy545;
-	if (yych == 'N') goto yy546;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 233 "../src/parse/conf_lexer.re"
+	{ RET_CONF_FEATURE(case_ranges); }
+#line 2477 "src/parse/conf_lexer.cc"
 yy479:
 	yych = *++cur;
-	if (yych == 'G') goto yy547;
+	if (yych == 'h') goto yy546;
 	goto yy3;
 yy480:
 	yych = *++cur;
-	if (yych == 'K') goto yy548;
+	if (yych == 's') goto yy547;
 	goto yy3;
 yy481:
 	yych = *++cur;
-	if (yych == 'T') goto yy549;
+	if (yych == 'h') goto yy548;
 	goto yy3;
 yy482:
 	yych = *++cur;
-	if (yych <= 'B') {
-		if (yych == 'A') goto yy550;
-		goto yy3;
-	} else {
-		if (yych <= 'C') goto yy551;
-		if (yych == 'S') goto yy552;
-		goto yy3;
-	}
+	if (yych == 'a') goto yy549;
+	goto yy3;
 yy483:
 	yych = *++cur;
-	if (yych == 'F') goto yy553;
+	if (yych == 't') goto yy550;
 	goto yy3;
 yy484:
 	yych = *++cur;
-	if (yych == 'P') goto yy554;
+	if (yych == 'r') goto yy551;
 	goto yy3;
 yy485:
 	yych = *++cur;
-	if (yych == 'G') goto yy555;
-	goto yy3;
+	if (yych == 'o') goto yy553;
+	goto yy420;
 yy486:
 	yych = *++cur;
-	if (yych == 'i') goto yy556;
+	if (yych == 'f') goto yy554;
 	goto yy3;
 yy487:
 	yych = *++cur;
-	if (yych == 'd') goto yy557;
+	if (yych == 't') goto yy555;
 	goto yy3;
 yy488:
 	yych = *++cur;
-	if (yych == '2') goto yy558;
+	if (yych == 'C') goto yy556;
 	goto yy3;
 yy489:
 	yych = *++cur;
-	if (yych <= '2') {
-		if (yych == '1') goto yy433;
-		goto yy3;
-	} else {
-		if (yych <= '3') goto yy559;
-		if (yych == '8') goto yy190;
-		goto yy3;
-	}
+	if (yych == 'N') goto yy557;
+	if (yych == 'P') goto yy558;
+	goto yy3;
 yy490:
 	yych = *++cur;
-	if (yych == 'e') goto yy560;
+	if (yych <= 'W') goto yy3;
+	if (yych <= 'X') goto yy559;
+	if (yych <= 'Y') goto yy560;
 	goto yy3;
 yy491:
 	yych = *++cur;
-	if (yych == 'n') goto yy561;
+	if (yych == 'R') goto yy561;
 	goto yy3;
 yy492:
 	yych = *++cur;
-	if (yych == 'e') goto yy562;
+	if (yych == 'B') goto yy562;
 	goto yy3;
 yy493:
 	yych = *++cur;
-	if (yych == 'h') goto yy563;
+	if (yych == 'L') goto yy563;
 	goto yy3;
 yy494:
 	yych = *++cur;
-	if (yych == 'g') goto yy564;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 181 "../src/parse/conf_lexer.re"
+	{
+        CHECK_RET(lex_conf_list(opts));
+        if (tmp_list.size() < 1) {
+            RET_FAIL(error_at_tok("`re2c:define:YYFN` value should be a nonempty list of strings"));
+        }
+        SETOPT(api_fn, tmp_list);
+        return Ret::OK;
+    }
+#line 2553 "src/parse/conf_lexer.cc"
 yy495:
 	yych = *++cur;
-	if (yych == 'r') goto yy565;
+	if (yych == 'T') goto yy564;
 	goto yy3;
 yy496:
 	yych = *++cur;
-	if (yych == 'L') goto yy566;
+	if (yych == 'P') goto yy565;
 	goto yy3;
 yy497:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 244 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(label_next); }
-#line 2663 "src/parse/conf_lexer.cc"
+	if (yych == 'S') goto yy566;
+	goto yy3;
 yy498:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 242 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(label_fill); }
-#line 2671 "src/parse/conf_lexer.cc"
+	if (yych == 'M') goto yy567;
+	goto yy3;
 yy499:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 243 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(label_loop); }
-#line 2679 "src/parse/conf_lexer.cc"
+	if (yych == 'R') goto yy568;
+	if (yych == 'X') goto yy569;
+	goto yy3;
 yy500:
 	yych = *++cur;
-	if (yych == 't') goto yy567;
+	if (yych == 'A') goto yy570;
 	goto yy3;
 yy501:
 	yych = *++cur;
-	if (yych == 'e') goto yy568;
+	if (yych == 'E') goto yy571;
 	goto yy3;
 yy502:
 	yych = *++cur;
-	if (yych <= '0') goto yy345;
-	if (yych <= '9') goto yy505;
-	goto yy345;
+	if (yych == 'S') goto yy572;
+	goto yy3;
 yy503:
-	++cur;
+	yych = *++cur;
+	if (yych == 'T') goto yy573;
+	goto yy3;
 yy504:
-	cur = ctx;
-#line 245 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(label_start_force); }
-#line 2699 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'I') goto yy574;
+	goto yy3;
 yy505:
-	++cur;
-	if (lim <= cur) YYFILL(1);
-	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy505;
-	}
-	goto yy504;
+	yych = *++cur;
+	if (yych == 'I') goto yy575;
+	goto yy3;
 yy506:
 	yych = *++cur;
-	if (yych == 'b') goto yy569;
+	if (yych == 'A') goto yy576;
 	goto yy3;
 yy507:
 	yych = *++cur;
-	if (yych == 'i') goto yy570;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 245 "../src/parse/conf_lexer.re"
+	{ goto empty_class; }
+#line 2608 "src/parse/conf_lexer.cc"
 yy508:
 	yych = *++cur;
-	if (yych == 'c') goto yy571;
+	if (yych == 'l') goto yy577;
 	goto yy3;
 yy509:
 	yych = *++cur;
-	if (yych == 'm') goto yy572;
+	if (yych == 'c') goto yy578;
 	goto yy3;
 yy510:
 	yych = *++cur;
-	if (yych <= 'n') {
-		if (yych == 'h') goto yy574;
-		goto yy3;
-	} else {
-		if (yych <= 'o') goto yy576;
-		if (yych == 't') goto yy577;
-		goto yy3;
-	}
+	if (yych == 's') goto yy579;
+	goto yy3;
 yy511:
 	yych = *++cur;
-	if (yych == 'i') goto yy578;
+	if (yych == 'f') goto yy580;
 	goto yy3;
 yy512:
 	yych = *++cur;
-	if (yych == 'm') goto yy579;
+	if (yych == 't') goto yy581;
 	goto yy3;
 yy513:
 	yych = *++cur;
-	if (yych == 'm') goto yy580;
+	if (yych == 'i') goto yy582;
 	goto yy3;
 yy514:
 	yych = *++cur;
-	if (yych == 'e') goto yy581;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+	goto yy52;
 yy515:
 	yych = *++cur;
-	if (yych == 't') goto yy582;
+	if (yych == 'h') goto yy10;
 	goto yy3;
 yy516:
 	yych = *++cur;
-	if (yych == 'a') goto yy583;
+	if (yych == 'd') goto yy583;
 	goto yy3;
 yy517:
 	yych = *++cur;
-	if (yych == 'i') goto yy584;
+	if (yych == '6') goto yy259;
 	goto yy3;
 yy518:
 	yych = *++cur;
-	if (yych == 's') goto yy585;
+	if (yych == 'c') goto yy584;
 	goto yy3;
 yy519:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 123 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(fill_check); }
-#line 2773 "src/parse/conf_lexer.cc"
+	if (yych == 'n') goto yy585;
+	goto yy3;
 yy520:
 	yych = *++cur;
-	if (yych == 'e') goto yy586;
+	if (yych == 'u') goto yy586;
 	goto yy3;
 yy521:
 	yych = *++cur;
-	if (yych == 'e') goto yy587;
+	if (yych == 'k') goto yy587;
 	goto yy3;
 yy522:
 	yych = *++cur;
-	if (yych == 'i') goto yy588;
+	if (yych == 'l') goto yy588;
 	goto yy3;
 yy523:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 224 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(case_inverted); }
-#line 2793 "src/parse/conf_lexer.cc"
+	if (yych == 't') goto yy589;
+	goto yy3;
 yy524:
 	yych = *++cur;
-	if (yych == 'l') goto yy589;
+	if (yych == 'l') goto yy590;
 	goto yy3;
 yy525:
 	yych = *++cur;
-	if (yych == 's') goto yy590;
+	if (yych == 'p') goto yy591;
 	goto yy3;
 yy526:
 	yych = *++cur;
-	if (yych == 'c') goto yy591;
-	goto yy345;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 250 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(label_prefix); }
+#line 2686 "src/parse/conf_lexer.cc"
 yy527:
 	yych = *++cur;
-	if (yych == 'd') goto yy592;
-	goto yy345;
+	if (yych == 'p') goto yy592;
+	goto yy3;
 yy528:
 	yych = *++cur;
-	if (yych == 'x') goto yy593;
+	if (yych == 'r') goto yy593;
 	goto yy3;
 yy529:
 	yych = *++cur;
-	if (yych == 'U') goto yy594;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 226 "../src/parse/conf_lexer.re"
+	{ RET_CONF_FEATURE(profile_gen); }
+#line 2700 "src/parse/conf_lexer.cc"
 yy530:
-	yych = *++cur;
-	if (yych == 'T') goto yy595;
-	goto yy3;
+	++cur;
+	if (lim <= cur) YYFILL(1);
+	yych = *cur;
+	if (yybm[0+yych] & 64) goto yy530;
+	if (yych != '=') goto yy420;
 yy531:
-	yych = *++cur;
-	if (yych == 'M') goto yy596;
-	if (yych == 'S') goto yy597;
-	goto yy3;
+	++cur;
+	if ((lim - cur) < 2) YYFILL(2);
+	yych = *cur;
+	if (yych <= ' ') {
+		if (yych <= '\f') {
+			if (yych == '\t') goto yy531;
+			goto yy420;
+		} else {
+			if (yych <= '\r') goto yy531;
+			if (yych <= 0x1F) goto yy420;
+			goto yy531;
+		}
+	} else {
+		if (yych <= '/') {
+			if (yych == '-') goto yy594;
+			goto yy420;
+		} else {
+			if (yych <= '0') goto yy595;
+			if (yych <= '9') goto yy597;
+			goto yy420;
+		}
+	}
 yy532:
 	yych = *++cur;
-	if (yych == 'A') goto yy598;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 215 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(state_abort); }
+#line 2735 "src/parse/conf_lexer.cc"
 yy533:
 	yych = *++cur;
-	if (yych == 'E') goto yy599;
+	if (yych == 'a') goto yy598;
 	goto yy3;
 yy534:
 	yych = *++cur;
-	if (yych == 'O') goto yy600;
+	if (yych == 'n') goto yy599;
 	goto yy3;
 yy535:
 	yych = *++cur;
-	if (yych == 'G') goto yy601;
+	if (yych == 's') goto yy600;
 	goto yy3;
 yy536:
-	yyaccept = 3;
-	yych = *(mar = ++cur);
-	if (yych <= '?') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy602;
-		}
-	} else {
-		if (yych <= '^') {
-			if (yych <= '@') goto yy603;
-			if (yych <= 'Z') goto yy2;
-		} else {
-			if (yych == '`') goto yy537;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 135 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(tags_prefix); }
+#line 2753 "src/parse/conf_lexer.cc"
 yy537:
-#line 149 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_fill); }
-#line 2865 "src/parse/conf_lexer.cc"
-yy538:
 	yych = *++cur;
-	if (yych == 'C') goto yy604;
+	if (yych == 's') goto yy601;
 	goto yy3;
+yy538:
+	yych = *++cur;
+	switch (yych) {
+		case 'a': goto yy602;
+		case 'b': goto yy603;
+		case 'c': goto yy604;
+		case 'f': goto yy605;
+		case 'n': goto yy606;
+		case 'p': goto yy607;
+		case 'r': goto yy608;
+		case 's': goto yy609;
+		case 't': goto yy610;
+		default: goto yy3;
+	}
 yy539:
 	yych = *++cur;
-	if (yych == 'O') goto yy605;
+	if (yych == 's') goto yy611;
 	goto yy3;
 yy540:
 	yych = *++cur;
-	if (yych == 'T') goto yy606;
+	if (yych == 'l') goto yy612;
 	goto yy3;
 yy541:
 	yych = *++cur;
-	if (yych == 'T') goto yy607;
+	if (yych == 'k') goto yy613;
 	goto yy3;
 yy542:
 	yych = *++cur;
-	if (yych == 'T') goto yy608;
+	if (yych == 'l') goto yy614;
 	goto yy3;
 yy543:
 	yych = *++cur;
-	if (yych == 'T') goto yy609;
+	if (yych == 'm') goto yy615;
 	goto yy3;
 yy544:
 	yych = *++cur;
-	if (yych == 'E') goto yy610;
+	if (yych == 't') goto yy616;
 	goto yy3;
 yy545:
 	yych = *++cur;
-	if (yych == 'I') goto yy611;
+	if (yych == 'd') goto yy617;
 	goto yy3;
 yy546:
 	yych = *++cur;
-	if (yych == 'M') goto yy612;
+	if (yych == 'o') goto yy618;
 	goto yy3;
 yy547:
 	yych = *++cur;
-	if (yych == 'N') goto yy613;
-	if (yych == 'P') goto yy614;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 227 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(char_weights); }
+#line 2809 "src/parse/conf_lexer.cc"
 yy548:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 164 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_peek); }
-#line 2914 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 225 "../src/parse/conf_lexer.re"
+	{ RET_CONF_FEATURE(class_switch); }
+#line 2815 "src/parse/conf_lexer.cc"
 yy549:
 	yych = *++cur;
-	if (yych == 'O') goto yy615;
+	if (yych == 'i') goto yy619;
 	goto yy3;
 yy550:
 	yych = *++cur;
-	if (yych == 'C') goto yy616;
+	if (yych == 'o') goto yy620;
 	goto yy3;
 yy551:
-	yych = *++cur;
-	if (yych == 'O') goto yy617;
-	goto yy3;
+	yyaccept = 2;
+	yych = *(mar = ++cur);
+	if (yybm[0+yych] & 32) goto yy2;
+	if (yych == '@') goto yy621;
 yy552:
-	yych = *++cur;
-	if (yych == 'T') goto yy618;
-	goto yy3;
+#line 210 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(cond_div); }
+#line 2832 "src/parse/conf_lexer.cc"
 yy553:
 	yych = *++cur;
-	if (yych == 'T') goto yy619;
-	goto yy3;
+	if (yych == 'n') goto yy622;
+	goto yy420;
 yy554:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 178 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_skip); }
-#line 2942 "src/parse/conf_lexer.cc"
+	if (yych == 'i') goto yy623;
+	goto yy3;
 yy555:
 	yych = *++cur;
-	if (yych == 'N') goto yy621;
-	if (yych == 'P') goto yy622;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+	goto yy244;
 yy556:
 	yych = *++cur;
-	if (yych == 'c') goto yy623;
+	if (yych == 'K') goto yy624;
 	goto yy3;
 yy557:
 	yych = *++cur;
-	if (yych == 'i') goto yy624;
+	if (yych == 'D') goto yy625;
 	goto yy3;
 yy558:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-	goto yy209;
+	if (yych == 'Y') goto yy626;
+	goto yy3;
 yy559:
 	yych = *++cur;
-	if (yych == '2') goto yy562;
+	if (yych == 'M') goto yy627;
 	goto yy3;
 yy560:
 	yych = *++cur;
-	if (yych == 'd') goto yy625;
+	if (yych == 'P') goto yy628;
 	goto yy3;
 yy561:
 	yych = *++cur;
-	if (yych == 'g') goto yy626;
+	if (yych == 'S') goto yy629;
 	goto yy3;
 yy562:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-	goto yy207;
+	if (yych == 'U') goto yy630;
+	goto yy3;
 yy563:
 	yych = *++cur;
-	if (yych == 'a') goto yy627;
+	if (yych == 'L') goto yy631;
 	goto yy3;
 yy564:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
+	if (yych <= 'B') {
+		if (yych == 'A') goto yy633;
+		goto yy3;
+	} else {
+		if (yych <= 'C') goto yy634;
+		if (yych == 'S') goto yy635;
+		goto yy3;
 	}
-#line 238 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(indent_str); }
-#line 2991 "src/parse/conf_lexer.cc"
 yy565:
 	yych = *++cur;
-	if (yych == 'e') goto yy628;
+	if (yych == 'U') goto yy636;
 	goto yy3;
 yy566:
 	yych = *++cur;
-	if (yych == 'a') goto yy629;
+	if (yych == 'S') goto yy637;
 	goto yy3;
 yy567:
 	yych = *++cur;
-	if (yych == 'u') goto yy630;
+	if (yych == 'I') goto yy638;
 	goto yy3;
 yy568:
 	yych = *++cur;
-	if (yych == 's') goto yy191;
+	if (yych == 'K') goto yy639;
 	goto yy3;
 yy569:
 	yych = *++cur;
-	if (yych == 'e') goto yy631;
+	if (yych == 'F') goto yy640;
+	if (yych == 'N') goto yy641;
 	goto yy3;
 yy570:
 	yych = *++cur;
-	if (yych == 'o') goto yy632;
+	if (yych == 'G') goto yy642;
 	goto yy3;
 yy571:
 	yych = *++cur;
-	if (yych == 'c') goto yy633;
+	if (yych == 'K') goto yy643;
 	goto yy3;
 yy572:
 	yych = *++cur;
-	if (yych <= '@') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy130;
-		}
-	} else {
-		if (yych <= '_') {
-			if (yych <= 'Z') goto yy2;
-			if (yych >= '_') goto yy2;
-		} else {
-			if (yych <= '`') goto yy573;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	if (yych == 'T') goto yy644;
+	goto yy3;
 yy573:
-#line 202 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(var_bitmaps); }
-#line 3041 "src/parse/conf_lexer.cc"
-yy574:
 	yych = *++cur;
-	if (yych <= '@') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy131;
-		}
+	if (yych <= 'B') {
+		if (yych == 'A') goto yy645;
+		goto yy3;
 	} else {
-		if (yych <= '_') {
-			if (yych <= 'Z') goto yy2;
-			if (yych >= '_') goto yy2;
-		} else {
-			if (yych <= '`') goto yy575;
-			if (yych <= 'z') goto yy2;
-		}
+		if (yych <= 'C') goto yy646;
+		if (yych == 'S') goto yy647;
+		goto yy3;
 	}
+yy574:
+	yych = *++cur;
+	if (yych == 'F') goto yy648;
+	goto yy3;
 yy575:
-#line 198 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(var_char); }
-#line 3063 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'P') goto yy649;
+	goto yy3;
 yy576:
 	yych = *++cur;
-	if (yych == 'n') goto yy634;
+	if (yych == 'G') goto yy650;
 	goto yy3;
 yy577:
 	yych = *++cur;
-	if (yych == 'a') goto yy635;
+	if (yych == 'i') goto yy651;
 	goto yy3;
 yy578:
 	yych = *++cur;
-	if (yych == 'l') goto yy636;
+	if (yych == 'd') goto yy652;
 	goto yy3;
 yy579:
 	yych = *++cur;
-	if (yych == 'a') goto yy637;
+	if (yych == '2') goto yy653;
 	goto yy3;
 yy580:
 	yych = *++cur;
-	if (yych == 'a') goto yy638;
-	goto yy3;
+	if (yych <= '2') {
+		if (yych == '1') goto yy517;
+		goto yy3;
+	} else {
+		if (yych <= '3') goto yy654;
+		if (yych == '8') goto yy237;
+		goto yy3;
+	}
 yy581:
 	yych = *++cur;
-	if (yych == 'c') goto yy639;
+	if (yych == 'e') goto yy655;
 	goto yy3;
 yy582:
 	yych = *++cur;
-	if (yych == 'a') goto yy640;
+	if (yych == 'n') goto yy656;
 	goto yy3;
 yy583:
 	yych = *++cur;
-	if (yych == 'r') goto yy641;
+	if (yych == 'e') goto yy657;
 	goto yy3;
 yy584:
 	yych = *++cur;
-	if (yych == 'o') goto yy642;
+	if (yych == 'h') goto yy658;
 	goto yy3;
 yy585:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 200 "../src/parse/conf_lexer.re"
-	{ goto char_lit; }
-#line 3107 "src/parse/conf_lexer.cc"
+	if (yych == 'g') goto yy659;
+	goto yy3;
 yy586:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 121 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(fill_enable); }
-#line 3115 "src/parse/conf_lexer.cc"
+	if (yych == 'r') goto yy660;
+	goto yy3;
 yy587:
 	yych = *++cur;
-	if (yych == 't') goto yy643;
+	if (yych == 'u') goto yy661;
 	goto yy3;
 yy588:
 	yych = *++cur;
-	if (yych == 'v') goto yy644;
+	if (yych == 'L') goto yy662;
 	goto yy3;
 yy589:
 	yych = *++cur;
-	if (yych == 'd') goto yy645;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 253 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(label_next); }
+#line 3001 "src/parse/conf_lexer.cc"
 yy590:
 	yych = *++cur;
-	if (yych <= '@') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-			goto yy201;
-		} else {
-			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy139;
-			goto yy201;
-		}
-	} else {
-		if (yych <= '_') {
-			if (yych <= 'Z') goto yy2;
-			if (yych <= '^') goto yy201;
-			goto yy2;
-		} else {
-			if (yych <= '`') goto yy201;
-			if (yych <= 'z') goto yy2;
-			goto yy201;
-		}
-	}
+	if (yybm[0+yych] & 32) goto yy2;
+#line 251 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(label_fill); }
+#line 3007 "src/parse/conf_lexer.cc"
 yy591:
 	yych = *++cur;
-	if (yych == 'o') goto yy646;
-	goto yy345;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 252 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(label_loop); }
+#line 3013 "src/parse/conf_lexer.cc"
 yy592:
-	++cur;
-#line 213 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(cond_goto_param); }
-#line 3158 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 't') goto yy663;
+	goto yy3;
 yy593:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 209 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(cond_enum_prefix); }
-#line 3166 "src/parse/conf_lexer.cc"
+	if (yych == 'e') goto yy664;
+	goto yy3;
 yy594:
 	yych = *++cur;
-	if (yych == 'P') goto yy647;
-	goto yy3;
+	if (yych <= '0') goto yy420;
+	if (yych <= '9') goto yy597;
+	goto yy420;
 yy595:
-	yych = *++cur;
-	if (yych == 'Y') goto yy649;
-	goto yy3;
+	++cur;
 yy596:
-	yych = *++cur;
-	if (yych == 'T') goto yy650;
-	goto yy3;
+	cur = ctx;
+#line 254 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(label_start_force); }
+#line 3033 "src/parse/conf_lexer.cc"
 yy597:
-	yych = *++cur;
-	if (yych == 'T') goto yy651;
-	goto yy3;
+	++cur;
+	if (lim <= cur) YYFILL(1);
+	yych = *cur;
+	if (yybm[0+yych] & 128) goto yy597;
+	goto yy596;
 yy598:
 	yych = *++cur;
-	if (yych == 'R') goto yy652;
+	if (yych == 'b') goto yy665;
 	goto yy3;
 yy599:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 144 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_char_type); }
-#line 3194 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 224 "../src/parse/conf_lexer.re"
+	{ RET_CONF_FEATURE(table_driven); }
+#line 3049 "src/parse/conf_lexer.cc"
 yy600:
 	yych = *++cur;
-	if (yych == 'R') goto yy653;
+	if (yych == 'i') goto yy666;
 	goto yy3;
 yy601:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 148 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_debug); }
-#line 3206 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 229 "../src/parse/conf_lexer.re"
+	{ RET_CONF_NUM_NONNEG(unroll_loops); }
+#line 3059 "src/parse/conf_lexer.cc"
 yy602:
 	yych = *++cur;
-	if (yych == 'n') goto yy654;
+	if (yych == 'c') goto yy667;
 	goto yy3;
 yy603:
 	yych = *++cur;
-	if (yych == 'l') goto yy655;
-	goto yy345;
+	if (yych == 'm') goto yy668;
+	goto yy3;
 yy604:
 	yych = *++cur;
-	if (yych == 'C') goto yy656;
-	goto yy3;
+	if (yych <= 'n') {
+		if (yych == 'h') goto yy670;
+		goto yy3;
+	} else {
+		if (yych <= 'o') goto yy672;
+		if (yych == 't') goto yy673;
+		goto yy3;
+	}
 yy605:
 	yych = *++cur;
-	if (yych == 'N') goto yy657;
+	if (yych == 'i') goto yy674;
 	goto yy3;
 yy606:
 	yych = *++cur;
-	if (yych == 'A') goto yy658;
+	if (yych == 'm') goto yy675;
 	goto yy3;
 yy607:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 146 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_input); }
-#line 3234 "src/parse/conf_lexer.cc"
+	if (yych == 'm') goto yy676;
+	goto yy3;
 yy608:
 	yych = *++cur;
-	if (yych == 'H') goto yy659;
+	if (yych == 'e') goto yy677;
 	goto yy3;
 yy609:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 158 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_limit); }
-#line 3246 "src/parse/conf_lexer.cc"
+	if (yych == 't') goto yy678;
+	goto yy3;
 yy610:
 	yych = *++cur;
-	if (yych == 'R') goto yy660;
+	if (yych == 'a') goto yy679;
 	goto yy3;
 yy611:
 	yych = *++cur;
-	if (yych == 'L') goto yy661;
+	if (yych == 'i') goto yy680;
 	goto yy3;
 yy612:
 	yych = *++cur;
-	if (yych == 'A') goto yy662;
+	if (yych == 's') goto yy681;
 	goto yy3;
 yy613:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 162 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_mtag_neg); }
-#line 3266 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 123 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(fill_check); }
+#line 3115 "src/parse/conf_lexer.cc"
 yy614:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 163 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_mtag_pos); }
-#line 3274 "src/parse/conf_lexer.cc"
+	if (yych == 'e') goto yy682;
+	goto yy3;
 yy615:
 	yych = *++cur;
-	if (yych == 'R') goto yy663;
+	if (yych == 'e') goto yy683;
 	goto yy3;
 yy616:
 	yych = *++cur;
-	if (yych == 'C') goto yy664;
+	if (yych == 'i') goto yy684;
 	goto yy3;
 yy617:
 	yych = *++cur;
-	if (yych == 'N') goto yy665;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 232 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(case_inverted); }
+#line 3133 "src/parse/conf_lexer.cc"
 yy618:
 	yych = *++cur;
-	if (yych == 'A') goto yy666;
+	if (yych == 'l') goto yy685;
 	goto yy3;
 yy619:
 	yych = *++cur;
-	if (yych <= 'M') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= ':') goto yy2;
-			if (yych <= '@') goto yy620;
-			if (yych <= 'L') goto yy2;
-			goto yy667;
-		}
-	} else {
-		if (yych <= '^') {
-			if (yych == 'S') goto yy668;
-			if (yych <= 'Z') goto yy2;
-		} else {
-			if (yych == '`') goto yy620;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	if (yych == 'n') goto yy686;
+	goto yy3;
 yy620:
-#line 175 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_shift); }
-#line 3314 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 's') goto yy687;
+	goto yy3;
 yy621:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 179 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_stag_neg); }
-#line 3322 "src/parse/conf_lexer.cc"
+	if (yych == 'c') goto yy688;
+	goto yy420;
 yy622:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 180 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_stag_pos); }
-#line 3330 "src/parse/conf_lexer.cc"
+	if (yych == 'd') goto yy689;
+	goto yy420;
 yy623:
 	yych = *++cur;
-	if (yych == 'y') goto yy669;
+	if (yych == 'x') goto yy690;
 	goto yy3;
 yy624:
 	yych = *++cur;
-	if (yych == 'c') goto yy304;
+	if (yych == 'U') goto yy691;
 	goto yy3;
 yy625:
 	yych = *++cur;
-	if (yych == '-') goto yy670;
+	if (yych == 'T') goto yy692;
 	goto yy3;
 yy626:
 	yych = *++cur;
-	if (yych == '-') goto yy301;
+	if (yych == 'M') goto yy693;
+	if (yych == 'S') goto yy694;
 	goto yy3;
 yy627:
 	yych = *++cur;
-	if (yych == 'r') goto yy671;
+	if (yych == 'A') goto yy695;
 	goto yy3;
 yy628:
 	yych = *++cur;
-	if (yych == 's') goto yy672;
+	if (yych == 'E') goto yy696;
 	goto yy3;
 yy629:
 	yych = *++cur;
-	if (yych == 'b') goto yy673;
+	if (yych == 'O') goto yy697;
 	goto yy3;
 yy630:
 	yych = *++cur;
-	if (yych == 'r') goto yy674;
+	if (yych == 'G') goto yy698;
 	goto yy3;
 yy631:
-	yych = *++cur;
-	if (yych == 'l') goto yy675;
-	goto yy3;
+	yyaccept = 3;
+	yych = *(mar = ++cur);
+	if (yych <= '?') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= '9') goto yy2;
+			if (yych <= ':') goto yy699;
+		}
+	} else {
+		if (yych <= '^') {
+			if (yych <= '@') goto yy700;
+			if (yych <= 'Z') goto yy2;
+		} else {
+			if (yych == '`') goto yy632;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy632:
-	yych = *++cur;
-	if (yych == 'n') goto yy676;
-	goto yy3;
+#line 149 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_fill); }
+#line 3209 "src/parse/conf_lexer.cc"
 yy633:
 	yych = *++cur;
-	if (yych == 'e') goto yy677;
+	if (yych == 'C') goto yy701;
 	goto yy3;
 yy634:
 	yych = *++cur;
-	if (yych == 'd') goto yy678;
+	if (yych == 'O') goto yy702;
 	goto yy3;
 yy635:
 	yych = *++cur;
-	if (yych == 'b') goto yy679;
+	if (yych == 'T') goto yy703;
 	goto yy3;
 yy636:
 	yych = *++cur;
-	if (yych == 'l') goto yy680;
+	if (yych == 'T') goto yy704;
 	goto yy3;
 yy637:
 	yych = *++cur;
-	if (yych == 't') goto yy681;
+	if (yych == 'T') goto yy705;
 	goto yy3;
 yy638:
 	yych = *++cur;
-	if (yych == 't') goto yy682;
+	if (yych == 'T') goto yy706;
 	goto yy3;
 yy639:
 	yych = *++cur;
-	if (yych == 'o') goto yy683;
+	if (yych == 'E') goto yy707;
 	goto yy3;
 yy640:
 	yych = *++cur;
-	if (yych == 'b') goto yy684;
-	if (yych == 't') goto yy685;
+	if (yych == 'I') goto yy708;
 	goto yy3;
 yy641:
 	yych = *++cur;
-	if (yych == 'g') goto yy686;
+	if (yych == 'M') goto yy709;
 	goto yy3;
 yy642:
 	yych = *++cur;
-	if (yych == 'n') goto yy687;
+	if (yych == 'N') goto yy710;
+	if (yych == 'P') goto yy711;
 	goto yy3;
 yy643:
 	yych = *++cur;
-	if (yych == 'e') goto yy688;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 164 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_peek); }
+#line 3256 "src/parse/conf_lexer.cc"
 yy644:
 	yych = *++cur;
-	if (yych == 'e') goto yy689;
+	if (yych == 'O') goto yy712;
 	goto yy3;
 yy645:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 221 "../src/parse/conf_lexer.re"
-	{ RET_CONF_NUM_NONNEG(computed_gotos_threshold); }
-#line 3427 "src/parse/conf_lexer.cc"
+	if (yych == 'C') goto yy713;
+	goto yy3;
 yy646:
 	yych = *++cur;
-	if (yych == 'n') goto yy690;
-	goto yy345;
+	if (yych == 'O') goto yy714;
+	goto yy3;
 yy647:
 	yych = *++cur;
-	if (yych <= 'B') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= ':') goto yy2;
-			if (yych >= 'A') goto yy2;
-		}
-	} else {
-		if (yych <= '^') {
-			if (yych <= 'C') goto yy691;
-			if (yych <= 'Z') goto yy2;
-		} else {
-			if (yych == '`') goto yy648;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	if (yych == 'T') goto yy715;
+	goto yy3;
 yy648:
-#line 139 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_backup); }
-#line 3453 "src/parse/conf_lexer.cc"
-yy649:
 	yych = *++cur;
-	if (yych == 'P') goto yy692;
+	if (yych == 'T') goto yy716;
 	goto yy3;
+yy649:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 178 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_skip); }
+#line 3282 "src/parse/conf_lexer.cc"
 yy650:
 	yych = *++cur;
-	if (yych == 'A') goto yy693;
+	if (yych == 'N') goto yy718;
+	if (yych == 'P') goto yy719;
 	goto yy3;
 yy651:
 	yych = *++cur;
-	if (yych == 'A') goto yy694;
+	if (yych == 'c') goto yy720;
 	goto yy3;
 yy652:
 	yych = *++cur;
-	if (yych == 'K') goto yy695;
+	if (yych == 'i') goto yy721;
 	goto yy3;
 yy653:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 147 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_cursor); }
-#line 3477 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+	goto yy258;
 yy654:
 	yych = *++cur;
-	if (yych == 'a') goto yy696;
+	if (yych == '2') goto yy657;
 	goto yy3;
 yy655:
 	yych = *++cur;
-	if (yych == 'e') goto yy697;
-	goto yy345;
+	if (yych == 'd') goto yy722;
+	goto yy3;
 yy656:
 	yych = *++cur;
-	if (yych == 'E') goto yy698;
+	if (yych == 'g') goto yy723;
 	goto yy3;
 yy657:
 	yych = *++cur;
-	if (yych == 'D') goto yy699;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+	goto yy256;
 yy658:
 	yych = *++cur;
-	if (yych == 'T') goto yy701;
+	if (yych == 'a') goto yy724;
 	goto yy3;
 yy659:
 	yych = *++cur;
-	if (yych == 'A') goto yy702;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 247 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(indent_str); }
+#line 3325 "src/parse/conf_lexer.cc"
 yy660:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 159 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_marker); }
-#line 3509 "src/parse/conf_lexer.cc"
+	if (yych == 'e') goto yy725;
+	goto yy3;
 yy661:
 	yych = *++cur;
-	if (yych == 'L') goto yy703;
+	if (yych == 'p') goto yy726;
 	goto yy3;
 yy662:
 	yych = *++cur;
-	if (yych == 'T') goto yy704;
+	if (yych == 'a') goto yy727;
 	goto yy3;
 yy663:
 	yych = *++cur;
-	if (yych == 'E') goto yy705;
+	if (yych == 'u') goto yy728;
 	goto yy3;
 yy664:
 	yych = *++cur;
-	if (yych == 'E') goto yy707;
+	if (yych == 's') goto yy238;
 	goto yy3;
 yy665:
 	yych = *++cur;
-	if (yych == 'D') goto yy708;
+	if (yych == 'e') goto yy729;
 	goto yy3;
 yy666:
 	yych = *++cur;
-	if (yych == 'T') goto yy710;
+	if (yych == 'o') goto yy730;
 	goto yy3;
 yy667:
 	yych = *++cur;
-	if (yych == 'T') goto yy711;
+	if (yych == 'c') goto yy731;
 	goto yy3;
 yy668:
 	yych = *++cur;
-	if (yych == 'T') goto yy712;
-	goto yy3;
-yy669:
-	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
+	if (yych <= '@') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= '9') goto yy2;
+			if (yych <= ':') goto yy164;
+		}
+	} else {
+		if (yych <= '_') {
+			if (yych <= 'Z') goto yy2;
+			if (yych >= '_') goto yy2;
+		} else {
+			if (yych <= '`') goto yy669;
+			if (yych <= 'z') goto yy2;
+		}
 	}
-#line 235 "../src/parse/conf_lexer.re"
-	{ goto encoding_policy; }
-#line 3549 "src/parse/conf_lexer.cc"
+yy669:
+#line 202 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(var_bitmaps); }
+#line 3379 "src/parse/conf_lexer.cc"
 yy670:
 	yych = *++cur;
-	if (yych == 'g') goto yy713;
-	goto yy3;
+	if (yych <= '@') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= '9') goto yy2;
+			if (yych <= ':') goto yy165;
+		}
+	} else {
+		if (yych <= '_') {
+			if (yych <= 'Z') goto yy2;
+			if (yych >= '_') goto yy2;
+		} else {
+			if (yych <= '`') goto yy671;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy671:
-	yych = *++cur;
-	if (yych == 's') goto yy558;
-	goto yy3;
+#line 198 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(var_char); }
+#line 3401 "src/parse/conf_lexer.cc"
 yy672:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 137 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(invert_captures); }
-#line 3565 "src/parse/conf_lexer.cc"
+	if (yych == 'n') goto yy732;
+	goto yy3;
 yy673:
 	yych = *++cur;
-	if (yych == 'e') goto yy439;
+	if (yych == 'a') goto yy733;
 	goto yy3;
 yy674:
 	yych = *++cur;
-	if (yych == 'e') goto yy714;
+	if (yych == 'l') goto yy734;
 	goto yy3;
 yy675:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 216 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(state_next); }
-#line 3581 "src/parse/conf_lexer.cc"
+	if (yych == 'a') goto yy735;
+	goto yy3;
 yy676:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 136 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(tags_expression); }
-#line 3589 "src/parse/conf_lexer.cc"
+	if (yych == 'a') goto yy736;
+	goto yy3;
 yy677:
 	yych = *++cur;
-	if (yych == 'p') goto yy715;
+	if (yych == 'c') goto yy737;
 	goto yy3;
 yy678:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 190 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(var_cond); }
-#line 3601 "src/parse/conf_lexer.cc"
+	if (yych == 'a') goto yy738;
+	goto yy3;
 yy679:
 	yych = *++cur;
-	if (yych == 'l') goto yy716;
+	if (yych == 'r') goto yy739;
 	goto yy3;
 yy680:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 204 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(var_fill); }
-#line 3613 "src/parse/conf_lexer.cc"
+	if (yych == 'o') goto yy740;
+	goto yy3;
 yy681:
 	yych = *++cur;
-	if (yych == 'c') goto yy717;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 200 "../src/parse/conf_lexer.re"
+	{ goto char_lit; }
+#line 3443 "src/parse/conf_lexer.cc"
 yy682:
 	yych = *++cur;
-	if (yych == 'c') goto yy718;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 121 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(fill_enable); }
+#line 3449 "src/parse/conf_lexer.cc"
 yy683:
 	yych = *++cur;
-	if (yych == 'r') goto yy719;
+	if (yych == 't') goto yy741;
 	goto yy3;
 yy684:
 	yych = *++cur;
-	if (yych == 'l') goto yy720;
+	if (yych == 'v') goto yy742;
 	goto yy3;
 yy685:
 	yych = *++cur;
-	if (yych == 'e') goto yy721;
+	if (yych == 'd') goto yy743;
 	goto yy3;
 yy686:
 	yych = *++cur;
-	if (yych == 'e') goto yy722;
+	if (yych == 's') goto yy744;
 	goto yy3;
 yy687:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
+	if (yych <= '@') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+			goto yy249;
+		} else {
+			if (yych <= '9') goto yy2;
+			if (yych <= ':') goto yy173;
+			goto yy249;
+		}
+	} else {
+		if (yych <= '_') {
+			if (yych <= 'Z') goto yy2;
+			if (yych <= '^') goto yy249;
+			goto yy2;
+		} else {
+			if (yych <= '`') goto yy249;
+			if (yych <= 'z') goto yy2;
+			goto yy249;
+		}
 	}
-#line 199 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(char_conv); }
-#line 3645 "src/parse/conf_lexer.cc"
 yy688:
 	yych = *++cur;
-	if (yych == 'r') goto yy723;
-	goto yy3;
+	if (yych == 'o') goto yy745;
+	goto yy420;
 yy689:
-	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 223 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(case_insensitive); }
-#line 3657 "src/parse/conf_lexer.cc"
+	++cur;
+#line 213 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(cond_goto_param); }
+#line 3496 "src/parse/conf_lexer.cc"
 yy690:
 	yych = *++cur;
-	if (yych == 'd') goto yy724;
-	goto yy345;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 209 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(cond_enum_prefix); }
+#line 3502 "src/parse/conf_lexer.cc"
 yy691:
 	yych = *++cur;
-	if (yych == 'T') goto yy725;
+	if (yych == 'P') goto yy746;
 	goto yy3;
 yy692:
 	yych = *++cur;
-	if (yych == 'E') goto yy726;
+	if (yych == 'Y') goto yy748;
 	goto yy3;
 yy693:
 	yych = *++cur;
-	if (yych == 'G') goto yy727;
+	if (yych == 'T') goto yy749;
 	goto yy3;
 yy694:
 	yych = *++cur;
-	if (yych == 'G') goto yy728;
+	if (yych == 'T') goto yy750;
 	goto yy3;
 yy695:
 	yych = *++cur;
-	if (yych == 'E') goto yy729;
+	if (yych == 'R') goto yy751;
 	goto yy3;
 yy696:
 	yych = *++cur;
-	if (yych == 'k') goto yy730;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 144 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_char_type); }
+#line 3528 "src/parse/conf_lexer.cc"
 yy697:
 	yych = *++cur;
-	if (yych == 'n') goto yy731;
-	goto yy345;
+	if (yych == 'R') goto yy752;
+	goto yy3;
 yy698:
 	yych = *++cur;
-	if (yych == 'P') goto yy732;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 148 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_debug); }
+#line 3538 "src/parse/conf_lexer.cc"
 yy699:
 	yych = *++cur;
-	if (yych <= 'H') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy733;
-			if (yych >= 'A') goto yy2;
-		}
-	} else {
-		if (yych <= '^') {
-			if (yych <= 'I') goto yy734;
-			if (yych <= 'Z') goto yy2;
-		} else {
-			if (yych == '`') goto yy700;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	if (yych == 'n') goto yy753;
+	goto yy3;
 yy700:
-#line 153 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_cond_get); }
-#line 3716 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'l') goto yy754;
+	goto yy420;
 yy701:
 	yych = *++cur;
-	if (yych == 'E') goto yy735;
+	if (yych == 'C') goto yy755;
 	goto yy3;
 yy702:
 	yych = *++cur;
-	if (yych == 'N') goto yy737;
+	if (yych == 'N') goto yy756;
 	goto yy3;
 yy703:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 160 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_maxfill); }
-#line 3732 "src/parse/conf_lexer.cc"
+	if (yych == 'A') goto yy757;
+	goto yy3;
 yy704:
 	yych = *++cur;
-	if (yych == 'C') goto yy738;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 146 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_input); }
+#line 3564 "src/parse/conf_lexer.cc"
 yy705:
 	yych = *++cur;
-	if (yych <= 'C') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= ':') goto yy2;
-			if (yych <= '@') goto yy706;
-			if (yych <= 'B') goto yy2;
-			goto yy739;
-		}
-	} else {
-		if (yych <= '^') {
-			if (yych == 'T') goto yy740;
-			if (yych <= 'Z') goto yy2;
-		} else {
-			if (yych == '`') goto yy706;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	if (yych == 'H') goto yy758;
+	goto yy3;
 yy706:
-#line 165 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_restore); }
-#line 3760 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 158 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_limit); }
+#line 3574 "src/parse/conf_lexer.cc"
 yy707:
 	yych = *++cur;
-	if (yych == 'P') goto yy741;
+	if (yych == 'R') goto yy759;
 	goto yy3;
 yy708:
-	yyaccept = 4;
-	yych = *(mar = ++cur);
-	if (yych <= '@') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy742;
-			if (yych >= '@') goto yy743;
-		}
-	} else {
-		if (yych <= '^') {
-			if (yych == 'I') goto yy744;
-			if (yych <= 'Z') goto yy2;
-		} else {
-			if (yych == '`') goto yy709;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	yych = *++cur;
+	if (yych == 'L') goto yy760;
+	goto yy3;
 yy709:
-#line 169 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_cond_set); }
-#line 3788 "src/parse/conf_lexer.cc"
-yy710:
 	yych = *++cur;
-	if (yych == 'E') goto yy745;
+	if (yych == 'A') goto yy761;
 	goto yy3;
+yy710:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 162 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_mtag_neg); }
+#line 3592 "src/parse/conf_lexer.cc"
 yy711:
 	yych = *++cur;
-	if (yych == 'A') goto yy747;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 163 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_mtag_pos); }
+#line 3598 "src/parse/conf_lexer.cc"
 yy712:
 	yych = *++cur;
-	if (yych == 'A') goto yy748;
+	if (yych == 'R') goto yy762;
 	goto yy3;
 yy713:
 	yych = *++cur;
-	if (yych == 'o') goto yy749;
+	if (yych == 'C') goto yy763;
 	goto yy3;
 yy714:
 	yych = *++cur;
-	if (yych == 's') goto yy750;
+	if (yych == 'N') goto yy764;
 	goto yy3;
 yy715:
 	yych = *++cur;
-	if (yych == 't') goto yy751;
+	if (yych == 'A') goto yy765;
 	goto yy3;
 yy716:
 	yych = *++cur;
-	if (yych == 'e') goto yy752;
-	goto yy3;
+	if (yych <= 'M') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= ':') goto yy2;
+			if (yych <= '@') goto yy717;
+			if (yych <= 'L') goto yy2;
+			goto yy766;
+		}
+	} else {
+		if (yych <= '^') {
+			if (yych == 'S') goto yy767;
+			if (yych <= 'Z') goto yy2;
+		} else {
+			if (yych == '`') goto yy717;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy717:
-	yych = *++cur;
-	if (yych == 'h') goto yy753;
-	goto yy3;
+#line 175 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_shift); }
+#line 3638 "src/parse/conf_lexer.cc"
 yy718:
 	yych = *++cur;
-	if (yych == 'h') goto yy754;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 179 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_stag_neg); }
+#line 3644 "src/parse/conf_lexer.cc"
 yy719:
 	yych = *++cur;
-	if (yych == 'd') goto yy755;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 180 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_stag_pos); }
+#line 3650 "src/parse/conf_lexer.cc"
 yy720:
 	yych = *++cur;
-	if (yych == 'e') goto yy756;
+	if (yych == 'y') goto yy768;
 	goto yy3;
 yy721:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 194 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(var_state); }
-#line 3840 "src/parse/conf_lexer.cc"
+	if (yych == 'c') goto yy371;
+	goto yy3;
 yy722:
 	yych = *++cur;
-	if (yych == 't') goto yy757;
+	if (yych == '-') goto yy769;
 	goto yy3;
 yy723:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 122 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(fill_param_enable); }
-#line 3852 "src/parse/conf_lexer.cc"
+	if (yych == '-') goto yy367;
+	goto yy3;
 yy724:
-	++cur;
-#line 211 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(cond_div_param); }
-#line 3857 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'r') goto yy770;
+	goto yy3;
 yy725:
 	yych = *++cur;
-	if (yych == 'X') goto yy758;
+	if (yych == 's') goto yy771;
 	goto yy3;
 yy726:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 141 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_cond_type); }
-#line 3869 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 230 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(keyword_lookup); }
+#line 3680 "src/parse/conf_lexer.cc"
 yy727:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 142 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_mtag_copy); }
-#line 3877 "src/parse/conf_lexer.cc"
+	if (yych == 'b') goto yy772;
+	goto yy3;
 yy728:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 143 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_stag_copy); }
-#line 3885 "src/parse/conf_lexer.cc"
+	if (yych == 'r') goto yy773;
+	goto yy3;
 yy729:
 	yych = *++cur;
-	if (yych == 'R') goto yy759;
+	if (yych == 'l') goto yy774;
 	goto yy3;
 yy730:
 	yych = *++cur;
-	if (yych == 'e') goto yy760;
+	if (yych == 'n') goto yy775;
 	goto yy3;
 yy731:
-	++cur;
-#line 150 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(fill_param); }
-#line 3898 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'e') goto yy776;
+	goto yy3;
 yy732:
 	yych = *++cur;
-	if (yych == 'T') goto yy761;
+	if (yych == 'd') goto yy777;
 	goto yy3;
 yy733:
 	yych = *++cur;
-	if (yych == 'n') goto yy762;
+	if (yych == 'b') goto yy778;
 	goto yy3;
 yy734:
 	yych = *++cur;
-	if (yych == 'T') goto yy763;
+	if (yych == 'l') goto yy779;
 	goto yy3;
 yy735:
 	yych = *++cur;
-	if (yych <= '@') {
-		if (yych <= '/') {
-			if (yych == '-') goto yy2;
-		} else {
-			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy764;
-		}
-	} else {
-		if (yych <= '_') {
-			if (yych <= 'Z') goto yy2;
-			if (yych >= '_') goto yy2;
-		} else {
-			if (yych <= '`') goto yy736;
-			if (yych <= 'z') goto yy2;
-		}
-	}
+	if (yych == 't') goto yy780;
+	goto yy3;
 yy736:
-#line 155 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_state_get); }
-#line 3932 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 't') goto yy781;
+	goto yy3;
 yy737:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 157 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_less_than); }
-#line 3940 "src/parse/conf_lexer.cc"
+	if (yych == 'o') goto yy782;
+	goto yy3;
 yy738:
 	yych = *++cur;
-	if (yych == 'H') goto yy765;
+	if (yych == 'b') goto yy783;
+	if (yych == 't') goto yy784;
 	goto yy3;
 yy739:
 	yych = *++cur;
-	if (yych == 'T') goto yy766;
+	if (yych == 'g') goto yy785;
 	goto yy3;
 yy740:
 	yych = *++cur;
-	if (yych == 'A') goto yy767;
+	if (yych == 'n') goto yy786;
 	goto yy3;
 yy741:
 	yych = *++cur;
-	if (yych == 'T') goto yy768;
+	if (yych == 'e') goto yy787;
 	goto yy3;
 yy742:
 	yych = *++cur;
-	if (yych == 'n') goto yy769;
+	if (yych == 'e') goto yy788;
 	goto yy3;
 yy743:
 	yych = *++cur;
-	if (yych == 'c') goto yy770;
-	goto yy345;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 221 "../src/parse/conf_lexer.re"
+	{ RET_CONF_NUM_NONNEG(computed_gotos_threshold); }
+#line 3751 "src/parse/conf_lexer.cc"
 yy744:
 	yych = *++cur;
-	if (yych == 'T') goto yy771;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 234 "../src/parse/conf_lexer.re"
+	{ RET_CONF_FEATURE(collapse_chains); }
+#line 3757 "src/parse/conf_lexer.cc"
 yy745:
-	yyaccept = 5;
-	yych = *(mar = ++cur);
-	if (yych <= '?') {
+	yych = *++cur;
+	if (yych == 'n') goto yy789;
+	goto yy420;
+yy746:
+	yych = *++cur;
+	if (yych <= 'B') {
 		if (yych <= '/') {
 			if (yych == '-') goto yy2;
 		} else {
-			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy772;
+			if (yych <= ':') goto yy2;
+			if (yych >= 'A') goto yy2;
 		}
 	} else {
 		if (yych <= '^') {
-			if (yych <= '@') goto yy773;
+			if (yych <= 'C') goto yy790;
 			if (yych <= 'Z') goto yy2;
 		} else {
-			if (yych == '`') goto yy746;
+			if (yych == '`') goto yy747;
 			if (yych <= 'z') goto yy2;
 		}
 	}
-yy746:
-#line 172 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_state_set); }
-#line 3991 "src/parse/conf_lexer.cc"
 yy747:
-	yych = *++cur;
-	if (yych == 'G') goto yy774;
-	goto yy3;
+#line 139 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_backup); }
+#line 3783 "src/parse/conf_lexer.cc"
 yy748:
 	yych = *++cur;
-	if (yych == 'G') goto yy775;
+	if (yych == 'P') goto yy791;
 	goto yy3;
 yy749:
 	yych = *++cur;
-	if (yych == 't') goto yy776;
+	if (yych == 'A') goto yy792;
 	goto yy3;
 yy750:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 128 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(tags_posix_syntax); }
-#line 4011 "src/parse/conf_lexer.cc"
+	if (yych == 'A') goto yy793;
+	goto yy3;
 yy751:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 192 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(var_accept); }
-#line 4019 "src/parse/conf_lexer.cc"
+	if (yych == 'K') goto yy794;
+	goto yy3;
 yy752:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 191 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(var_cond_table); }
-#line 4027 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 147 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_cursor); }
+#line 3805 "src/parse/conf_lexer.cc"
 yy753:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 195 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(var_nmatch); }
-#line 4035 "src/parse/conf_lexer.cc"
+	if (yych == 'a') goto yy795;
+	goto yy3;
 yy754:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 196 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(var_pmatch); }
-#line 4043 "src/parse/conf_lexer.cc"
+	if (yych == 'e') goto yy796;
+	goto yy420;
 yy755:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 197 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(var_record); }
-#line 4051 "src/parse/conf_lexer.cc"
+	if (yych == 'E') goto yy797;
+	goto yy3;
 yy756:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 205 "../src/parse/conf_lexer.re"
-	{ return lex_conf_string(opts); }
-#line 4059 "src/parse/conf_lexer.cc"
+	if (yych == 'D') goto yy798;
+	goto yy3;
 yy757:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 193 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(var_computed_gotos_table); }
-#line 4067 "src/parse/conf_lexer.cc"
+	if (yych == 'T') goto yy800;
+	goto yy3;
 yy758:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 140 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_backup_ctx); }
-#line 4075 "src/parse/conf_lexer.cc"
+	if (yych == 'A') goto yy801;
+	goto yy3;
 yy759:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 145 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_ctxmarker); }
-#line 4083 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 159 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_marker); }
+#line 3835 "src/parse/conf_lexer.cc"
 yy760:
 	yych = *++cur;
-	if (yych == 'd') goto yy777;
+	if (yych == 'L') goto yy802;
 	goto yy3;
 yy761:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 152 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_accept_get); }
-#line 4095 "src/parse/conf_lexer.cc"
+	if (yych == 'T') goto yy803;
+	goto yy3;
 yy762:
 	yych = *++cur;
-	if (yych == 'a') goto yy778;
+	if (yych == 'E') goto yy804;
 	goto yy3;
 yy763:
 	yych = *++cur;
-	if (yych == 'I') goto yy779;
+	if (yych == 'E') goto yy806;
 	goto yy3;
 yy764:
 	yych = *++cur;
-	if (yych == 'n') goto yy780;
+	if (yych == 'D') goto yy807;
 	goto yy3;
 yy765:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 161 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_maxnmatch); }
-#line 4115 "src/parse/conf_lexer.cc"
+	if (yych == 'T') goto yy809;
+	goto yy3;
 yy766:
 	yych = *++cur;
-	if (yych == 'X') goto yy781;
+	if (yych == 'T') goto yy810;
 	goto yy3;
 yy767:
 	yych = *++cur;
-	if (yych == 'G') goto yy782;
+	if (yych == 'T') goto yy811;
 	goto yy3;
 yy768:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 168 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_accept_set); }
-#line 4131 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 244 "../src/parse/conf_lexer.re"
+	{ goto encoding_policy; }
+#line 3873 "src/parse/conf_lexer.cc"
 yy769:
 	yych = *++cur;
-	if (yych == 'a') goto yy783;
+	if (yych == 'g') goto yy812;
 	goto yy3;
 yy770:
 	yych = *++cur;
-	if (yych == 'o') goto yy784;
-	goto yy345;
+	if (yych == 's') goto yy653;
+	goto yy3;
 yy771:
 	yych = *++cur;
-	if (yych == 'I') goto yy785;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 137 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(invert_captures); }
+#line 3887 "src/parse/conf_lexer.cc"
 yy772:
 	yych = *++cur;
-	if (yych == 'n') goto yy786;
+	if (yych == 'e') goto yy524;
 	goto yy3;
 yy773:
 	yych = *++cur;
-	if (yych == 's') goto yy787;
-	goto yy345;
+	if (yych == 'e') goto yy813;
+	goto yy3;
 yy774:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 177 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_mtag_shift); }
-#line 4159 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 216 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(state_next); }
+#line 3901 "src/parse/conf_lexer.cc"
 yy775:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 176 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_stag_shift); }
-#line 4167 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 136 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(tags_expression); }
+#line 3907 "src/parse/conf_lexer.cc"
 yy776:
 	yych = *++cur;
-	if (yych == 'o') goto yy788;
+	if (yych == 'p') goto yy814;
 	goto yy3;
 yy777:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 151 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(fill_naked); }
-#line 4179 "src/parse/conf_lexer.cc"
+	if (yybm[0+yych] & 32) goto yy2;
+#line 190 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(var_cond); }
+#line 3917 "src/parse/conf_lexer.cc"
 yy778:
 	yych = *++cur;
-	if (yych == 'k') goto yy789;
+	if (yych == 'l') goto yy815;
 	goto yy3;
 yy779:
 	yych = *++cur;
-	if (yych == 'O') goto yy790;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 204 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(var_fill); }
+#line 3927 "src/parse/conf_lexer.cc"
 yy780:
 	yych = *++cur;
-	if (yych == 'a') goto yy791;
+	if (yych == 'c') goto yy816;
 	goto yy3;
 yy781:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 166 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_restore_ctx); }
-#line 4199 "src/parse/conf_lexer.cc"
+	if (yych == 'c') goto yy817;
+	goto yy3;
 yy782:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 167 "../src/parse/conf_lexer.re"
-	{ RET_CONF_CODE(api_restore_tag); }
-#line 4207 "src/parse/conf_lexer.cc"
+	if (yych == 'r') goto yy818;
+	goto yy3;
 yy783:
 	yych = *++cur;
-	if (yych == 'k') goto yy792;
+	if (yych == 'l') goto yy819;
 	goto yy3;
 yy784:
 	yych = *++cur;
-	if (yych == 'n') goto yy793;
-	goto yy345;
+	if (yych == 'e') goto yy820;
+	goto yy3;
 yy785:
 	yych = *++cur;
-	if (yych == 'O') goto yy794;
+	if (yych == 'e') goto yy821;
 	goto yy3;
 yy786:
 	yych = *++cur;
-	if (yych == 'a') goto yy795;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 199 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(char_conv); }
+#line 3957 "src/parse/conf_lexer.cc"
 yy787:
 	yych = *++cur;
-	if (yych == 't') goto yy796;
-	goto yy345;
+	if (yych == 'r') goto yy822;
+	goto yy3;
 yy788:
 	yych = *++cur;
-	if (yych == 's') goto yy200;
-	goto yy3;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 231 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(case_insensitive); }
+#line 3967 "src/parse/conf_lexer.cc"
 yy789:
 	yych = *++cur;
-	if (yych == 'e') goto yy797;
-	goto yy3;
+	if (yych == 'd') goto yy823;
+	goto yy420;
 yy790:
 	yych = *++cur;
-	if (yych == 'N') goto yy798;
+	if (yych == 'T') goto yy824;
 	goto yy3;
 yy791:
 	yych = *++cur;
-	if (yych == 'k') goto yy799;
+	if (yych == 'E') goto yy825;
 	goto yy3;
 yy792:
 	yych = *++cur;
-	if (yych == 'e') goto yy800;
+	if (yych == 'G') goto yy826;
 	goto yy3;
 yy793:
 	yych = *++cur;
-	if (yych == 'd') goto yy801;
-	goto yy345;
+	if (yych == 'G') goto yy827;
+	goto yy3;
 yy794:
 	yych = *++cur;
-	if (yych == 'N') goto yy802;
+	if (yych == 'E') goto yy828;
 	goto yy3;
 yy795:
 	yych = *++cur;
-	if (yych == 'k') goto yy803;
+	if (yych == 'k') goto yy829;
 	goto yy3;
 yy796:
 	yych = *++cur;
-	if (yych == 'a') goto yy804;
-	goto yy345;
+	if (yych == 'n') goto yy830;
+	goto yy420;
 yy797:
 	yych = *++cur;
-	if (yych == 'd') goto yy805;
+	if (yych == 'P') goto yy831;
 	goto yy3;
 yy798:
 	yych = *++cur;
-	if (yych <= '@') {
+	if (yych <= 'H') {
 		if (yych <= '/') {
 			if (yych == '-') goto yy2;
-			goto yy700;
 		} else {
 			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy733;
-			goto yy700;
+			if (yych <= ':') goto yy832;
+			if (yych >= 'A') goto yy2;
 		}
 	} else {
-		if (yych <= '_') {
+		if (yych <= '^') {
+			if (yych <= 'I') goto yy833;
 			if (yych <= 'Z') goto yy2;
-			if (yych <= '^') goto yy700;
-			goto yy2;
 		} else {
-			if (yych <= '`') goto yy700;
+			if (yych == '`') goto yy799;
 			if (yych <= 'z') goto yy2;
-			goto yy700;
 		}
 	}
 yy799:
-	yych = *++cur;
-	if (yych == 'e') goto yy806;
-	goto yy3;
+#line 153 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_cond_get); }
+#line 4026 "src/parse/conf_lexer.cc"
 yy800:
 	yych = *++cur;
-	if (yych == 'd') goto yy807;
+	if (yych == 'E') goto yy834;
 	goto yy3;
 yy801:
-	++cur;
-#line 170 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(cond_set_param); }
-#line 4302 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'N') goto yy836;
+	goto yy3;
 yy802:
-	yyaccept = 4;
-	yych = *(mar = ++cur);
-	if (yych <= '?') {
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 160 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_maxfill); }
+#line 4040 "src/parse/conf_lexer.cc"
+yy803:
+	yych = *++cur;
+	if (yych == 'C') goto yy837;
+	goto yy3;
+yy804:
+	yych = *++cur;
+	if (yych <= 'C') {
 		if (yych <= '/') {
 			if (yych == '-') goto yy2;
-			goto yy709;
 		} else {
-			if (yych <= '9') goto yy2;
-			if (yych <= ':') goto yy742;
-			goto yy709;
+			if (yych <= ':') goto yy2;
+			if (yych <= '@') goto yy805;
+			if (yych <= 'B') goto yy2;
+			goto yy838;
 		}
 	} else {
 		if (yych <= '^') {
-			if (yych <= '@') goto yy743;
+			if (yych == 'T') goto yy839;
 			if (yych <= 'Z') goto yy2;
-			goto yy709;
 		} else {
-			if (yych == '`') goto yy709;
+			if (yych == '`') goto yy805;
 			if (yych <= 'z') goto yy2;
-			goto yy709;
 		}
 	}
-yy803:
-	yych = *++cur;
-	if (yych == 'e') goto yy808;
-	goto yy3;
-yy804:
-	yych = *++cur;
-	if (yych == 't') goto yy809;
-	goto yy345;
 yy805:
-	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 154 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(cond_get_naked); }
-#line 4341 "src/parse/conf_lexer.cc"
+#line 165 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_restore); }
+#line 4068 "src/parse/conf_lexer.cc"
 yy806:
 	yych = *++cur;
-	if (yych == 'd') goto yy810;
+	if (yych == 'P') goto yy840;
 	goto yy3;
 yy807:
-	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
+	yyaccept = 4;
+	yych = *(mar = ++cur);
+	if (yych <= '@') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= '9') goto yy2;
+			if (yych <= ':') goto yy841;
+			if (yych >= '@') goto yy842;
+		}
+	} else {
+		if (yych <= '^') {
+			if (yych == 'I') goto yy843;
+			if (yych <= 'Z') goto yy2;
+		} else {
+			if (yych == '`') goto yy808;
+			if (yych <= 'z') goto yy2;
+		}
 	}
-#line 171 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(cond_set_naked); }
-#line 4353 "src/parse/conf_lexer.cc"
 yy808:
-	yych = *++cur;
-	if (yych == 'd') goto yy811;
-	goto yy3;
+#line 169 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_cond_set); }
+#line 4096 "src/parse/conf_lexer.cc"
 yy809:
 	yych = *++cur;
-	if (yych == 'e') goto yy812;
-	goto yy345;
+	if (yych == 'E') goto yy844;
+	goto yy3;
 yy810:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 156 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(state_get_naked); }
-#line 4369 "src/parse/conf_lexer.cc"
+	if (yych == 'A') goto yy846;
+	goto yy3;
 yy811:
 	yych = *++cur;
-	if (yybm[0+yych] & 32) {
-		goto yy2;
-	}
-#line 173 "../src/parse/conf_lexer.re"
-	{ RET_CONF_BOOL(state_set_naked); }
-#line 4377 "src/parse/conf_lexer.cc"
+	if (yych == 'A') goto yy847;
+	goto yy3;
 yy812:
-	++cur;
-#line 174 "../src/parse/conf_lexer.re"
-	{ RET_CONF_STR(state_set_param); }
-#line 4382 "src/parse/conf_lexer.cc"
-}
-#line 252 "../src/parse/conf_lexer.re"
-
-
-input:
-    CHECK_RET(lex_conf_assign());
-
-#line 4390 "src/parse/conf_lexer.cc"
-{
-	uint8_t yych;
-	if ((lim - cur) < 7) YYFILL(7);
-	yych = *cur;
-	if (yych <= 'd') {
-		if (yych <= 'b') goto yy814;
-		if (yych <= 'c') goto yy816;
-		goto yy817;
-	} else {
-		if (yych == 'r') goto yy818;
-	}
+	yych = *++cur;
+	if (yych == 'o') goto yy848;
+	goto yy3;
+yy813:
+	yych = *++cur;
+	if (yych == 's') goto yy849;
+	goto yy3;
 yy814:
-	++cur;
+	yych = *++cur;
+	if (yych == 't') goto yy850;
+	goto yy3;
 yy815:
-#line 257 "../src/parse/conf_lexer.re"
-	{
-        RET_FAIL(error_at_cur("bad configuration value (expected: 'default', 'custom', 'record')"));
-    }
-#line 4409 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'e') goto yy851;
+	goto yy3;
 yy816:
-	yych = *(mar = ++cur);
-	if (yych == 'u') goto yy819;
-	goto yy815;
+	yych = *++cur;
+	if (yych == 'h') goto yy852;
+	goto yy3;
 yy817:
-	yych = *(mar = ++cur);
-	if (yych == 'e') goto yy821;
-	goto yy815;
+	yych = *++cur;
+	if (yych == 'h') goto yy853;
+	goto yy3;
 yy818:
-	yych = *(mar = ++cur);
-	if (yych == 'e') goto yy822;
-	goto yy815;
+	yych = *++cur;
+	if (yych == 'd') goto yy854;
+	goto yy3;
 yy819:
 	yych = *++cur;
-	if (yych == 's') goto yy823;
+	if (yych == 'e') goto yy855;
+	goto yy3;
 yy820:
-	cur = mar;
-	goto yy815;
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 194 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(var_state); }
+#line 4146 "src/parse/conf_lexer.cc"
 yy821:
 	yych = *++cur;
-	if (yych == 'f') goto yy824;
-	goto yy820;
+	if (yych == 't') goto yy856;
+	goto yy3;
 yy822:
 	yych = *++cur;
-	if (yych == 'c') goto yy825;
-	goto yy820;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 122 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(fill_param_enable); }
+#line 4156 "src/parse/conf_lexer.cc"
 yy823:
-	yych = *++cur;
-	if (yych == 't') goto yy826;
-	goto yy820;
+	++cur;
+#line 211 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(cond_div_param); }
+#line 4161 "src/parse/conf_lexer.cc"
 yy824:
 	yych = *++cur;
-	if (yych == 'a') goto yy827;
-	goto yy820;
+	if (yych == 'X') goto yy857;
+	goto yy3;
 yy825:
 	yych = *++cur;
-	if (yych == 'o') goto yy828;
-	goto yy820;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 141 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_cond_type); }
+#line 4171 "src/parse/conf_lexer.cc"
 yy826:
 	yych = *++cur;
-	if (yych == 'o') goto yy829;
-	goto yy820;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 142 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_mtag_copy); }
+#line 4177 "src/parse/conf_lexer.cc"
 yy827:
 	yych = *++cur;
-	if (yych == 'u') goto yy830;
-	goto yy820;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 143 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_stag_copy); }
+#line 4183 "src/parse/conf_lexer.cc"
 yy828:
 	yych = *++cur;
-	if (yych == 'r') goto yy831;
-	goto yy820;
+	if (yych == 'R') goto yy858;
+	goto yy3;
 yy829:
 	yych = *++cur;
-	if (yych == 'm') goto yy832;
-	goto yy820;
+	if (yych == 'e') goto yy859;
+	goto yy3;
 yy830:
-	yych = *++cur;
-	if (yych == 'l') goto yy833;
-	goto yy820;
+	++cur;
+#line 150 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(fill_param); }
+#line 4196 "src/parse/conf_lexer.cc"
 yy831:
 	yych = *++cur;
-	if (yych == 'd') goto yy834;
-	goto yy820;
+	if (yych == 'T') goto yy860;
+	goto yy3;
 yy832:
-	++cur;
-#line 261 "../src/parse/conf_lexer.re"
-	{ SETOPT(api, Api::CUSTOM);  goto end; }
-#line 4476 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'n') goto yy861;
+	goto yy3;
 yy833:
 	yych = *++cur;
-	if (yych == 't') goto yy835;
-	goto yy820;
+	if (yych == 'T') goto yy862;
+	goto yy3;
 yy834:
-	++cur;
-#line 262 "../src/parse/conf_lexer.re"
-	{ SETOPT(api, Api::RECORD);  goto end; }
-#line 4485 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych <= '@') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= '9') goto yy2;
+			if (yych <= ':') goto yy863;
+		}
+	} else {
+		if (yych <= '_') {
+			if (yych <= 'Z') goto yy2;
+			if (yych >= '_') goto yy2;
+		} else {
+			if (yych <= '`') goto yy835;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy835:
-	++cur;
-#line 260 "../src/parse/conf_lexer.re"
-	{ SETOPT(api, Api::DEFAULT); goto end; }
-#line 4490 "src/parse/conf_lexer.cc"
-}
-#line 263 "../src/parse/conf_lexer.re"
-
-
-api_style:
-    CHECK_RET(lex_conf_assign());
-
-#line 4498 "src/parse/conf_lexer.cc"
-{
-	uint8_t yych;
-	if ((lim - cur) < 9) YYFILL(9);
-	yych = *cur;
-	if (yych == 'f') goto yy838;
-	++cur;
+#line 155 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_state_get); }
+#line 4230 "src/parse/conf_lexer.cc"
+yy836:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 157 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_less_than); }
+#line 4236 "src/parse/conf_lexer.cc"
 yy837:
-#line 268 "../src/parse/conf_lexer.re"
-	{
-        RET_FAIL(error_at_cur("bad configuration value (expected: 'functions', 'free-form')"));
-    }
-#line 4510 "src/parse/conf_lexer.cc"
+	yych = *++cur;
+	if (yych == 'H') goto yy864;
+	goto yy3;
 yy838:
-	yych = *(mar = ++cur);
-	if (yych == 'r') goto yy839;
-	if (yych == 'u') goto yy841;
-	goto yy837;
+	yych = *++cur;
+	if (yych == 'T') goto yy865;
+	goto yy3;
 yy839:
 	yych = *++cur;
-	if (yych == 'e') goto yy842;
+	if (yych == 'A') goto yy866;
+	goto yy3;
 yy840:
-	cur = mar;
-	goto yy837;
+	yych = *++cur;
+	if (yych == 'T') goto yy867;
+	goto yy3;
 yy841:
 	yych = *++cur;
-	if (yych == 'n') goto yy843;
-	goto yy840;
+	if (yych == 'n') goto yy868;
+	goto yy3;
 yy842:
 	yych = *++cur;
-	if (yych == 'e') goto yy844;
-	goto yy840;
+	if (yych == 'c') goto yy869;
+	goto yy420;
 yy843:
 	yych = *++cur;
-	if (yych == 'c') goto yy845;
-	goto yy840;
+	if (yych == 'T') goto yy870;
+	goto yy3;
 yy844:
-	yych = *++cur;
-	if (yych == '-') goto yy846;
-	goto yy840;
+	yyaccept = 5;
+	yych = *(mar = ++cur);
+	if (yych <= '?') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+		} else {
+			if (yych <= '9') goto yy2;
+			if (yych <= ':') goto yy871;
+		}
+	} else {
+		if (yych <= '^') {
+			if (yych <= '@') goto yy872;
+			if (yych <= 'Z') goto yy2;
+		} else {
+			if (yych == '`') goto yy845;
+			if (yych <= 'z') goto yy2;
+		}
+	}
 yy845:
-	yych = *++cur;
-	if (yych == 't') goto yy847;
-	goto yy840;
+#line 172 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_state_set); }
+#line 4287 "src/parse/conf_lexer.cc"
 yy846:
 	yych = *++cur;
-	if (yych == 'f') goto yy848;
-	goto yy840;
+	if (yych == 'G') goto yy873;
+	goto yy3;
 yy847:
 	yych = *++cur;
-	if (yych == 'i') goto yy849;
-	goto yy840;
+	if (yych == 'G') goto yy874;
+	goto yy3;
 yy848:
 	yych = *++cur;
-	if (yych == 'o') goto yy850;
-	goto yy840;
+	if (yych == 't') goto yy875;
+	goto yy3;
 yy849:
 	yych = *++cur;
-	if (yych == 'o') goto yy851;
-	goto yy840;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 128 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(tags_posix_syntax); }
+#line 4305 "src/parse/conf_lexer.cc"
 yy850:
 	yych = *++cur;
-	if (yych == 'r') goto yy852;
-	goto yy840;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 192 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(var_accept); }
+#line 4311 "src/parse/conf_lexer.cc"
 yy851:
 	yych = *++cur;
-	if (yych == 'n') goto yy853;
-	goto yy840;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 191 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(var_cond_table); }
+#line 4317 "src/parse/conf_lexer.cc"
 yy852:
 	yych = *++cur;
-	if (yych == 'm') goto yy854;
-	goto yy840;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 195 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(var_nmatch); }
+#line 4323 "src/parse/conf_lexer.cc"
 yy853:
 	yych = *++cur;
-	if (yych == 's') goto yy855;
-	goto yy840;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 196 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(var_pmatch); }
+#line 4329 "src/parse/conf_lexer.cc"
 yy854:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 197 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(var_record); }
+#line 4335 "src/parse/conf_lexer.cc"
+yy855:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 205 "../src/parse/conf_lexer.re"
+	{ return lex_conf_string(opts); }
+#line 4341 "src/parse/conf_lexer.cc"
+yy856:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 193 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(var_computed_gotos_table); }
+#line 4347 "src/parse/conf_lexer.cc"
+yy857:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 140 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_backup_ctx); }
+#line 4353 "src/parse/conf_lexer.cc"
+yy858:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 145 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_ctxmarker); }
+#line 4359 "src/parse/conf_lexer.cc"
+yy859:
+	yych = *++cur;
+	if (yych == 'd') goto yy876;
+	goto yy3;
+yy860:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 152 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_accept_get); }
+#line 4369 "src/parse/conf_lexer.cc"
+yy861:
+	yych = *++cur;
+	if (yych == 'a') goto yy877;
+	goto yy3;
+yy862:
+	yych = *++cur;
+	if (yych == 'I') goto yy878;
+	goto yy3;
+yy863:
+	yych = *++cur;
+	if (yych == 'n') goto yy879;
+	goto yy3;
+yy864:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 161 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_maxnmatch); }
+#line 4387 "src/parse/conf_lexer.cc"
+yy865:
+	yych = *++cur;
+	if (yych == 'X') goto yy880;
+	goto yy3;
+yy866:
+	yych = *++cur;
+	if (yych == 'G') goto yy881;
+	goto yy3;
+yy867:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 168 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_accept_set); }
+#line 4401 "src/parse/conf_lexer.cc"
+yy868:
+	yych = *++cur;
+	if (yych == 'a') goto yy882;
+	goto yy3;
+yy869:
+	yych = *++cur;
+	if (yych == 'o') goto yy883;
+	goto yy420;
+yy870:
+	yych = *++cur;
+	if (yych == 'I') goto yy884;
+	goto yy3;
+yy871:
+	yych = *++cur;
+	if (yych == 'n') goto yy885;
+	goto yy3;
+yy872:
+	yych = *++cur;
+	if (yych == 's') goto yy886;
+	goto yy420;
+yy873:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 177 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_mtag_shift); }
+#line 4427 "src/parse/conf_lexer.cc"
+yy874:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 176 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_stag_shift); }
+#line 4433 "src/parse/conf_lexer.cc"
+yy875:
+	yych = *++cur;
+	if (yych == 'o') goto yy887;
+	goto yy3;
+yy876:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 151 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(fill_naked); }
+#line 4443 "src/parse/conf_lexer.cc"
+yy877:
+	yych = *++cur;
+	if (yych == 'k') goto yy888;
+	goto yy3;
+yy878:
+	yych = *++cur;
+	if (yych == 'O') goto yy889;
+	goto yy3;
+yy879:
+	yych = *++cur;
+	if (yych == 'a') goto yy890;
+	goto yy3;
+yy880:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 166 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_restore_ctx); }
+#line 4461 "src/parse/conf_lexer.cc"
+yy881:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 167 "../src/parse/conf_lexer.re"
+	{ RET_CONF_CODE(api_restore_tag); }
+#line 4467 "src/parse/conf_lexer.cc"
+yy882:
+	yych = *++cur;
+	if (yych == 'k') goto yy891;
+	goto yy3;
+yy883:
+	yych = *++cur;
+	if (yych == 'n') goto yy892;
+	goto yy420;
+yy884:
+	yych = *++cur;
+	if (yych == 'O') goto yy893;
+	goto yy3;
+yy885:
+	yych = *++cur;
+	if (yych == 'a') goto yy894;
+	goto yy3;
+yy886:
+	yych = *++cur;
+	if (yych == 't') goto yy895;
+	goto yy420;
+yy887:
+	yych = *++cur;
+	if (yych == 's') goto yy248;
+	goto yy3;
+yy888:
+	yych = *++cur;
+	if (yych == 'e') goto yy896;
+	goto yy3;
+yy889:
+	yych = *++cur;
+	if (yych == 'N') goto yy897;
+	goto yy3;
+yy890:
+	yych = *++cur;
+	if (yych == 'k') goto yy898;
+	goto yy3;
+yy891:
+	yych = *++cur;
+	if (yych == 'e') goto yy899;
+	goto yy3;
+yy892:
+	yych = *++cur;
+	if (yych == 'd') goto yy900;
+	goto yy420;
+yy893:
+	yych = *++cur;
+	if (yych == 'N') goto yy901;
+	goto yy3;
+yy894:
+	yych = *++cur;
+	if (yych == 'k') goto yy902;
+	goto yy3;
+yy895:
+	yych = *++cur;
+	if (yych == 'a') goto yy903;
+	goto yy420;
+yy896:
+	yych = *++cur;
+	if (yych == 'd') goto yy904;
+	goto yy3;
+yy897:
+	yych = *++cur;
+	if (yych <= '@') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+			goto yy799;
+		} else {
+			if (yych <= '9') goto yy2;
+			if (yych <= ':') goto yy832;
+			goto yy799;
+		}
+	} else {
+		if (yych <= '_') {
+			if (yych <= 'Z') goto yy2;
+			if (yych <= '^') goto yy799;
+			goto yy2;
+		} else {
+			if (yych <= '`') goto yy799;
+			if (yych <= 'z') goto yy2;
+			goto yy799;
+		}
+	}
+yy898:
+	yych = *++cur;
+	if (yych == 'e') goto yy905;
+	goto yy3;
+yy899:
+	yych = *++cur;
+	if (yych == 'd') goto yy906;
+	goto yy3;
+yy900:
 	++cur;
+#line 170 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(cond_set_param); }
+#line 4562 "src/parse/conf_lexer.cc"
+yy901:
+	yyaccept = 4;
+	yych = *(mar = ++cur);
+	if (yych <= '?') {
+		if (yych <= '/') {
+			if (yych == '-') goto yy2;
+			goto yy808;
+		} else {
+			if (yych <= '9') goto yy2;
+			if (yych <= ':') goto yy841;
+			goto yy808;
+		}
+	} else {
+		if (yych <= '^') {
+			if (yych <= '@') goto yy842;
+			if (yych <= 'Z') goto yy2;
+			goto yy808;
+		} else {
+			if (yych == '`') goto yy808;
+			if (yych <= 'z') goto yy2;
+			goto yy808;
+		}
+	}
+yy902:
+	yych = *++cur;
+	if (yych == 'e') goto yy907;
+	goto yy3;
+yy903:
+	yych = *++cur;
+	if (yych == 't') goto yy908;
+	goto yy420;
+yy904:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 154 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(cond_get_naked); }
+#line 4599 "src/parse/conf_lexer.cc"
+yy905:
+	yych = *++cur;
+	if (yych == 'd') goto yy909;
+	goto yy3;
+yy906:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 171 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(cond_set_naked); }
+#line 4609 "src/parse/conf_lexer.cc"
+yy907:
+	yych = *++cur;
+	if (yych == 'd') goto yy910;
+	goto yy3;
+yy908:
+	yych = *++cur;
+	if (yych == 'e') goto yy911;
+	goto yy420;
+yy909:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 156 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(state_get_naked); }
+#line 4623 "src/parse/conf_lexer.cc"
+yy910:
+	yych = *++cur;
+	if (yybm[0+yych] & 32) goto yy2;
+#line 173 "../src/parse/conf_lexer.re"
+	{ RET_CONF_BOOL(state_set_naked); }
+#line 4629 "src/parse/conf_lexer.cc"
+yy911:
+	++cur;
+#line 174 "../src/parse/conf_lexer.re"
+	{ RET_CONF_STR(state_set_param); }
+#line 4634 "src/parse/conf_lexer.cc"
+}
+#line 261 "../src/parse/conf_lexer.re"
+
+
+input:
+    CHECK_RET(lex_conf_assign());
+
+#line 4642 "src/parse/conf_lexer.cc"
+{
+	uint8_t yych;
+	if ((lim - cur) < 7) YYFILL(7);
+	yych = *cur;
+	if (yych <= 'd') {
+		if (yych <= 'b') goto yy913;
+		if (yych <= 'c') goto yy915;
+		goto yy916;
+	} else {
+		if (yych == 'r') goto yy917;
+	}
+yy913:
+	++cur;
+yy914:
+#line 266 "../src/parse/conf_lexer.re"
+	{
+        RET_FAIL(error_at_cur("bad configuration value (expected: 'default', 'custom', 'record')"));
+    }
+#line 4661 "src/parse/conf_lexer.cc"
+yy915:
+	yych = *(mar = ++cur);
+	if (yych == 'u') goto yy918;
+	goto yy914;
+yy916:
+	yych = *(mar = ++cur);
+	if (yych == 'e') goto yy920;
+	goto yy914;
+yy917:
+	yych = *(mar = ++cur);
+	if (yych == 'e') goto yy921;
+	goto yy914;
+yy918:
+	yych = *++cur;
+	if (yych == 's') goto yy922;
+yy919:
+	cur = mar;
+	goto yy914;
+yy920:
+	yych = *++cur;
+	if (yych == 'f') goto yy923;
+	goto yy919;
+yy921:
+	yych = *++cur;
+	if (yych == 'c') goto yy924;
+	goto yy919;
+yy922:
+	yych = *++cur;
+	if (yych == 't') goto yy925;
+	goto yy919;
+yy923:
+	yych = *++cur;
+	if (yych == 'a') goto yy926;
+	goto yy919;
+yy924:
+	yych = *++cur;
+	if (yych == 'o') goto yy927;
+	goto yy919;
+yy925:
+	yych = *++cur;
+	if (yych == 'o') goto yy928;
+	goto yy919;
+yy926:
+	yych = *++cur;
+	if (yych == 'u') goto yy929;
+	goto yy919;
+yy927:
+	yych = *++cur;
+	if (yych == 'r') goto yy930;
+	goto yy919;
+yy928:
+	yych = *++cur;
+	if (yych == 'm') goto yy931;
+	goto yy919;
+yy929:
+	yych = *++cur;
+	if (yych == 'l') goto yy932;
+	goto yy919;
+yy930:
+	yych = *++cur;
+	if (yych == 'd') goto yy933;
+	goto yy919;
+yy931:
+	++cur;
+#line 270 "../src/parse/conf_lexer.re"
+	{ SETOPT(api, Api::CUSTOM);  goto end; }
+#line 4728 "src/parse/conf_lexer.cc"
+yy932:
+	yych = *++cur;
+	if (yych == 't') goto yy934;
+	goto yy919;
+yy933:
+	++cur;
+#line 271 "../src/parse/conf_lexer.re"
+	{ SETOPT(api, Api::RECORD);  goto end; }
+#line 4737 "src/parse/conf_lexer.cc"
+yy934:
+	++cur;
+#line 269 "../src/parse/conf_lexer.re"
+	{ SETOPT(api, Api::DEFAULT); goto end; }
+#line 4742 "src/parse/conf_lexer.cc"
+}
 #line 272 "../src/parse/conf_lexer.re"
+
+
+api_style:
+    CHECK_RET(lex_conf_assign());
+
+#line 4750 "src/parse/conf_lexer.cc"
+{
+	uint8_t yych;
+	if ((lim - cur) < 9) YYFILL(9);
+	yych = *cur;
+	if (yych == 'f') goto yy937;
+	++cur;
+yy936:
+#line 277 "../src/parse/conf_lexer.re"
+	{
+        RET_FAIL(error_at_cur("bad configuration value (expected: 'functions', 'free-form')"));
+    }
+#line 4762 "src/parse/conf_lexer.cc"
+yy937:
+	yych = *(mar = ++cur);
+	if (yych == 'r') goto yy938;
+	if (yych == 'u') goto yy940;
+	goto yy936;
+yy938:
+	yych = *++cur;
+	if (yych == 'e') goto yy941;
+yy939:
+	cur = mar;
+	goto yy936;
+yy940:
+	yych = *++cur;
+	if (yych == 'n') goto yy942;
+	goto yy939;
+yy941:
+	yych = *++cur;
+	if (yych == 'e') goto yy943;
+	goto yy939;
+yy942:
+	yych = *++cur;
+	if (yych == 'c') goto yy944;
+	goto yy939;
+yy943:
+	yych = *++cur;
+	if (yych == '-') goto yy945;
+	goto yy939;
+yy944:
+	yych = *++cur;
+	if (yych == 't') goto yy946;
+	goto yy939;
+yy945:
+	yych = *++cur;
+	if (yych == 'f') goto yy947;
+	goto yy939;
+yy946:
+	yych = *++cur;
+	if (yych == 'i') goto yy948;
+	goto yy939;
+yy947:
+	yych = *++cur;
+	if (yych == 'o') goto yy949;
+	goto yy939;
+yy948:
+	yych = *++cur;
+	if (yych == 'o') goto yy950;
+	goto yy939;
+yy949:
+	yych = *++cur;
+	if (yych == 'r') goto yy951;
+	goto yy939;
+yy950:
+	yych = *++cur;
+	if (yych == 'n') goto yy952;
+	goto yy939;
+yy951:
+	yych = *++cur;
+	if (yych == 'm') goto yy953;
+	goto yy939;
+yy952:
+	yych = *++cur;
+	if (yych == 's') goto yy954;
+	goto yy939;
+yy953:
+	++cur;
+#line 281 "../src/parse/conf_lexer.re"
 	{ SETOPT(api_style, ApiStyle::FREEFORM);  goto end; }
-#line 4578 "src/parse/conf_lexer.cc"
-yy855:
+#line 4830 "src/parse/conf_lexer.cc"
+yy954:
 	++cur;
-#line 271 "../src/parse/conf_lexer.re"
+#line 280 "../src/parse/conf_lexer.re"
 	{ SETOPT(api_style, ApiStyle::FUNCTIONS); goto end; }
-#line 4583 "src/parse/conf_lexer.cc"
+#line 4835 "src/parse/conf_lexer.cc"
 }
-#line 273 "../src/parse/conf_lexer.re"
+#line 282 "../src/parse/conf_lexer.re"
 
 
 encoding_policy:
     CHECK_RET(lex_conf_assign());
 
-#line 4591 "src/parse/conf_lexer.cc"
+#line 4843 "src/parse/conf_lexer.cc"
 {
 	uint8_t yych;
 	if ((lim - cur) < 10) YYFILL(10);
 	yych = *cur;
 	if (yych <= 'h') {
-		if (yych == 'f') goto yy858;
+		if (yych == 'f') goto yy957;
 	} else {
-		if (yych <= 'i') goto yy859;
-		if (yych == 's') goto yy860;
+		if (yych <= 'i') goto yy958;
+		if (yych == 's') goto yy959;
 	}
 	++cur;
-yy857:
-#line 278 "../src/parse/conf_lexer.re"
+yy956:
+#line 287 "../src/parse/conf_lexer.re"
 	{
         RET_FAIL(error_at_cur(
                 "bad configuration value (expected: 'ignore', 'substitute', 'fail')"));
     }
-#line 4609 "src/parse/conf_lexer.cc"
-yy858:
+#line 4861 "src/parse/conf_lexer.cc"
+yy957:
 	yych = *(mar = ++cur);
-	if (yych == 'a') goto yy861;
-	goto yy857;
-yy859:
+	if (yych == 'a') goto yy960;
+	goto yy956;
+yy958:
 	yych = *(mar = ++cur);
-	if (yych == 'g') goto yy863;
-	goto yy857;
-yy860:
+	if (yych == 'g') goto yy962;
+	goto yy956;
+yy959:
 	yych = *(mar = ++cur);
-	if (yych == 'u') goto yy864;
-	goto yy857;
-yy861:
+	if (yych == 'u') goto yy963;
+	goto yy956;
+yy960:
 	yych = *++cur;
-	if (yych == 'i') goto yy865;
-yy862:
+	if (yych == 'i') goto yy964;
+yy961:
 	cur = mar;
-	goto yy857;
-yy863:
+	goto yy956;
+yy962:
 	yych = *++cur;
-	if (yych == 'n') goto yy866;
-	goto yy862;
-yy864:
+	if (yych == 'n') goto yy965;
+	goto yy961;
+yy963:
 	yych = *++cur;
-	if (yych == 'b') goto yy867;
-	goto yy862;
-yy865:
+	if (yych == 'b') goto yy966;
+	goto yy961;
+yy964:
 	yych = *++cur;
-	if (yych == 'l') goto yy868;
-	goto yy862;
-yy866:
+	if (yych == 'l') goto yy967;
+	goto yy961;
+yy965:
 	yych = *++cur;
-	if (yych == 'o') goto yy869;
-	goto yy862;
-yy867:
+	if (yych == 'o') goto yy968;
+	goto yy961;
+yy966:
 	yych = *++cur;
-	if (yych == 's') goto yy870;
-	goto yy862;
-yy868:
+	if (yych == 's') goto yy969;
+	goto yy961;
+yy967:
 	++cur;
-#line 284 "../src/parse/conf_lexer.re"
+#line 293 "../src/parse/conf_lexer.re"
 	{ SETOPT(encoding_policy, Enc::Policy::FAIL);       goto end; }
-#line 4652 "src/parse/conf_lexer.cc"
-yy869:
+#line 4904 "src/parse/conf_lexer.cc"
+yy968:
 	yych = *++cur;
-	if (yych == 'r') goto yy871;
-	goto yy862;
-yy870:
+	if (yych == 'r') goto yy970;
+	goto yy961;
+yy969:
 	yych = *++cur;
-	if (yych == 't') goto yy872;
-	goto yy862;
-yy871:
+	if (yych == 't') goto yy971;
+	goto yy961;
+yy970:
 	yych = *++cur;
-	if (yych == 'e') goto yy873;
-	goto yy862;
-yy872:
+	if (yych == 'e') goto yy972;
+	goto yy961;
+yy971:
 	yych = *++cur;
-	if (yych == 'i') goto yy874;
-	goto yy862;
-yy873:
+	if (yych == 'i') goto yy973;
+	goto yy961;
+yy972:
 	++cur;
-#line 282 "../src/parse/conf_lexer.re"
+#line 291 "../src/parse/conf_lexer.re"
 	{ SETOPT(encoding_policy, Enc::Policy::IGNORE);     goto end; }
-#line 4673 "src/parse/conf_lexer.cc"
-yy874:
+#line 4925 "src/parse/conf_lexer.cc"
+yy973:
 	yych = *++cur;
-	if (yych != 't') goto yy862;
+	if (yych != 't') goto yy961;
 	yych = *++cur;
-	if (yych != 'u') goto yy862;
+	if (yych != 'u') goto yy961;
 	yych = *++cur;
-	if (yych != 't') goto yy862;
+	if (yych != 't') goto yy961;
 	yych = *++cur;
-	if (yych != 'e') goto yy862;
+	if (yych != 'e') goto yy961;
 	++cur;
-#line 283 "../src/parse/conf_lexer.re"
+#line 292 "../src/parse/conf_lexer.re"
 	{ SETOPT(encoding_policy, Enc::Policy::SUBSTITUTE); goto end; }
-#line 4686 "src/parse/conf_lexer.cc"
+#line 4938 "src/parse/conf_lexer.cc"
 }
-#line 285 "../src/parse/conf_lexer.re"
+#line 294 "../src/parse/conf_lexer.re"
 
 
 empty_class:
     CHECK_RET(lex_conf_assign());
 
-#line 4694 "src/parse/conf_lexer.cc"
+#line 4946 "src/parse/conf_lexer.cc"
 {
 	uint8_t yych;
 	if ((lim - cur) < 11) YYFILL(11);
 	yych = *cur;
-	if (yych == 'e') goto yy877;
-	if (yych == 'm') goto yy878;
+	if (yych == 'e') goto yy976;
+	if (yych == 'm') goto yy977;
 	++cur;
-yy876:
-#line 290 "../src/parse/conf_lexer.re"
+yy975:
+#line 299 "../src/parse/conf_lexer.re"
 	{
         RET_FAIL(error_at_cur(
                 "bad configuration value (expected: 'match-empty', 'match-none', 'error')"));
     }
-#line 4708 "src/parse/conf_lexer.cc"
-yy877:
+#line 4960 "src/parse/conf_lexer.cc"
+yy976:
 	yych = *(mar = ++cur);
-	if (yych == 'r') goto yy879;
-	goto yy876;
-yy878:
+	if (yych == 'r') goto yy978;
+	goto yy975;
+yy977:
 	yych = *(mar = ++cur);
-	if (yych == 'a') goto yy881;
-	goto yy876;
-yy879:
+	if (yych == 'a') goto yy980;
+	goto yy975;
+yy978:
 	yych = *++cur;
-	if (yych == 'r') goto yy882;
-yy880:
+	if (yych == 'r') goto yy981;
+yy979:
 	cur = mar;
-	goto yy876;
-yy881:
+	goto yy975;
+yy980:
 	yych = *++cur;
-	if (yych == 't') goto yy883;
-	goto yy880;
-yy882:
+	if (yych == 't') goto yy982;
+	goto yy979;
+yy981:
 	yych = *++cur;
-	if (yych == 'o') goto yy884;
-	goto yy880;
-yy883:
+	if (yych == 'o') goto yy983;
+	goto yy979;
+yy982:
 	yych = *++cur;
-	if (yych == 'c') goto yy885;
-	goto yy880;
-yy884:
+	if (yych == 'c') goto yy984;
+	goto yy979;
+yy983:
 	yych = *++cur;
-	if (yych == 'r') goto yy886;
-	goto yy880;
-yy885:
+	if (yych == 'r') goto yy985;
+	goto yy979;
+yy984:
 	yych = *++cur;
-	if (yych == 'h') goto yy887;
-	goto yy880;
-yy886:
+	if (yych == 'h') goto yy986;
+	goto yy979;
+yy985:
 	++cur;
-#line 296 "../src/parse/conf_lexer.re"
+#line 305 "../src/parse/conf_lexer.re"
 	{ SETOPT(empty_class, EmptyClass::ERROR);       goto end; }
-#line 4747 "src/parse/conf_lexer.cc"
-yy887:
+#line 4999 "src/parse/conf_lexer.cc"
+yy986:
 	yych = *++cur;
-	if (yych != '-') goto yy880;
+	if (yych != '-') goto yy979;
 	yych = *++cur;
-	if (yych == 'e') goto yy888;
-	if (yych == 'n') goto yy889;
-	goto yy880;
-yy888:
+	if (yych == 'e') goto yy987;
+	if (yych == 'n') goto yy988;
+	goto yy979;
+yy987:
 	yych = *++cur;
-	if (yych == 'm') goto yy890;
-	goto yy880;
-yy889:
+	if (yych == 'm') goto yy989;
+	goto yy979;
+yy988:
 	yych = *++cur;
-	if (yych == 'o') goto yy891;
-	goto yy880;
-yy890:
+	if (yych == 'o') goto yy990;
+	goto yy979;
+yy989:
 	yych = *++cur;
-	if (yych == 'p') goto yy892;
-	goto yy880;
-yy891:
+	if (yych == 'p') goto yy991;
+	goto yy979;
+yy990:
 	yych = *++cur;
-	if (yych == 'n') goto yy893;
-	goto yy880;
-yy892:
+	if (yych == 'n') goto yy992;
+	goto yy979;
+yy991:
 	yych = *++cur;
-	if (yych == 't') goto yy894;
-	goto yy880;
-yy893:
+	if (yych == 't') goto yy993;
+	goto yy979;
+yy992:
 	yych = *++cur;
-	if (yych == 'e') goto yy895;
-	goto yy880;
-yy894:
+	if (yych == 'e') goto yy994;
+	goto yy979;
+yy993:
 	yych = *++cur;
-	if (yych == 'y') goto yy896;
-	goto yy880;
-yy895:
+	if (yych == 'y') goto yy995;
+	goto yy979;
+yy994:
 	++cur;
-#line 295 "../src/parse/conf_lexer.re"
+#line 304 "../src/parse/conf_lexer.re"
 	{ SETOPT(empty_class, EmptyClass::MATCH_NONE);  goto end; }
-#line 4787 "src/parse/conf_lexer.cc"
-yy896:
+#line 5039 "src/parse/conf_lexer.cc"
+yy995:
 	++cur;
-#line 294 "../src/parse/conf_lexer.re"
+#line 303 "../src/parse/conf_lexer.re"
 	{ SETOPT(empty_class, EmptyClass::MATCH_EMPTY); goto end; }
-#line 4792 "src/parse/conf_lexer.cc"
+#line 5044 "src/parse/conf_lexer.cc"
 }
-#line 297 "../src/parse/conf_lexer.re"
+#line 306 "../src/parse/conf_lexer.re"
 
 
 char_lit:
     CHECK_RET(lex_conf_assign());
 
-#line 4800 "src/parse/conf_lexer.cc"
+#line 5052 "src/parse/conf_lexer.cc"
 {
 	uint8_t yych;
 	unsigned int yyaccept = 0;
 	if ((lim - cur) < 11) YYFILL(11);
 	yych = *cur;
-	if (yych == 'c') goto yy899;
-	if (yych == 'h') goto yy900;
+	if (yych == 'c') goto yy998;
+	if (yych == 'h') goto yy999;
 	++cur;
-yy898:
-#line 302 "../src/parse/conf_lexer.re"
+yy997:
+#line 311 "../src/parse/conf_lexer.re"
 	{
         RET_FAIL(error_at_cur("bad configuration value (expected: 'char', 'hex', 'char_or_hex')"));
     }
-#line 4814 "src/parse/conf_lexer.cc"
-yy899:
+#line 5066 "src/parse/conf_lexer.cc"
+yy998:
 	yyaccept = 0;
 	yych = *(mar = ++cur);
-	if (yych == 'h') goto yy901;
-	goto yy898;
-yy900:
+	if (yych == 'h') goto yy1000;
+	goto yy997;
+yy999:
 	yyaccept = 0;
 	yych = *(mar = ++cur);
-	if (yych == 'e') goto yy903;
-	goto yy898;
-yy901:
+	if (yych == 'e') goto yy1002;
+	goto yy997;
+yy1000:
 	yych = *++cur;
-	if (yych == 'a') goto yy904;
-yy902:
+	if (yych == 'a') goto yy1003;
+yy1001:
 	cur = mar;
-	if (yyaccept == 0) {
-		goto yy898;
-	} else {
-		goto yy907;
-	}
-yy903:
+	if (yyaccept == 0) goto yy997;
+	else goto yy1006;
+yy1002:
 	yych = *++cur;
-	if (yych == 'x') goto yy905;
-	goto yy902;
-yy904:
+	if (yych == 'x') goto yy1004;
+	goto yy1001;
+yy1003:
 	yych = *++cur;
-	if (yych == 'r') goto yy906;
-	goto yy902;
-yy905:
+	if (yych == 'r') goto yy1005;
+	goto yy1001;
+yy1004:
 	++cur;
-#line 306 "../src/parse/conf_lexer.re"
+#line 315 "../src/parse/conf_lexer.re"
 	{ SETOPT(char_literals, CharLit::HEX);         goto end; }
-#line 4847 "src/parse/conf_lexer.cc"
-yy906:
+#line 5096 "src/parse/conf_lexer.cc"
+yy1005:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych == '_') goto yy908;
-yy907:
-#line 305 "../src/parse/conf_lexer.re"
+	if (yych == '_') goto yy1007;
+yy1006:
+#line 314 "../src/parse/conf_lexer.re"
 	{ SETOPT(char_literals, CharLit::CHAR);        goto end; }
-#line 4855 "src/parse/conf_lexer.cc"
-yy908:
+#line 5104 "src/parse/conf_lexer.cc"
+yy1007:
 	yych = *++cur;
-	if (yych != 'o') goto yy902;
+	if (yych != 'o') goto yy1001;
 	yych = *++cur;
-	if (yych != 'r') goto yy902;
+	if (yych != 'r') goto yy1001;
 	yych = *++cur;
-	if (yych != '_') goto yy902;
+	if (yych != '_') goto yy1001;
 	yych = *++cur;
-	if (yych != 'h') goto yy902;
+	if (yych != 'h') goto yy1001;
 	yych = *++cur;
-	if (yych != 'e') goto yy902;
+	if (yych != 'e') goto yy1001;
 	yych = *++cur;
-	if (yych != 'x') goto yy902;
+	if (yych != 'x') goto yy1001;
 	++cur;
-#line 307 "../src/parse/conf_lexer.re"
+#line 316 "../src/parse/conf_lexer.re"
 	{ SETOPT(char_literals, CharLit::CHAR_OR_HEX); goto end; }
-#line 4872 "src/parse/conf_lexer.cc"
+#line 5121 "src/parse/conf_lexer.cc"
 }
-#line 308 "../src/parse/conf_lexer.re"
+#line 317 "../src/parse/conf_lexer.re"
 
 
 end:
@@ -4887,81 +5136,81 @@ end:
 
 Ret Input::lex_spaces() {
 loop: 
-#line 4891 "src/parse/conf_lexer.cc"
+#line 5140 "src/parse/conf_lexer.cc"
 {
 	uint8_t yych;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
 	if (yych <= '\f') {
-		if (yych <= 0x08) goto yy910;
-		if (yych <= '\t') goto yy911;
-		if (yych <= '\n') goto yy912;
+		if (yych <= 0x08) goto yy1009;
+		if (yych <= '\t') goto yy1010;
+		if (yych <= '\n') goto yy1011;
 	} else {
-		if (yych <= '\r') goto yy911;
-		if (yych == ' ') goto yy911;
+		if (yych <= '\r') goto yy1010;
+		if (yych == ' ') goto yy1010;
 	}
-yy910:
-#line 326 "../src/parse/conf_lexer.re"
+yy1009:
+#line 335 "../src/parse/conf_lexer.re"
 	{ return Ret::OK; }
-#line 4907 "src/parse/conf_lexer.cc"
-yy911:
+#line 5156 "src/parse/conf_lexer.cc"
+yy1010:
 	++cur;
-#line 325 "../src/parse/conf_lexer.re"
+#line 334 "../src/parse/conf_lexer.re"
 	{ goto loop; }
-#line 4912 "src/parse/conf_lexer.cc"
-yy912:
+#line 5161 "src/parse/conf_lexer.cc"
+yy1011:
 	++cur;
-#line 324 "../src/parse/conf_lexer.re"
+#line 333 "../src/parse/conf_lexer.re"
 	{ next_line(); goto loop; }
-#line 4917 "src/parse/conf_lexer.cc"
+#line 5166 "src/parse/conf_lexer.cc"
 }
-#line 327 "../src/parse/conf_lexer.re"
+#line 336 "../src/parse/conf_lexer.re"
 
 }
 
 Ret Input::lex_conf_assign() {
     CHECK_RET(lex_spaces());
 
-#line 4926 "src/parse/conf_lexer.cc"
+#line 5175 "src/parse/conf_lexer.cc"
 {
 	uint8_t yych;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
-	if (yych == '=') goto yy914;
+	if (yych == '=') goto yy1013;
 	++cur;
-#line 334 "../src/parse/conf_lexer.re"
+#line 343 "../src/parse/conf_lexer.re"
 	{ RET_FAIL(error_at_cur("missing '=' in configuration")); }
-#line 4935 "src/parse/conf_lexer.cc"
-yy914:
+#line 5184 "src/parse/conf_lexer.cc"
+yy1013:
 	++cur;
-#line 333 "../src/parse/conf_lexer.re"
+#line 342 "../src/parse/conf_lexer.re"
 	{ return lex_spaces(); }
-#line 4940 "src/parse/conf_lexer.cc"
+#line 5189 "src/parse/conf_lexer.cc"
 }
-#line 335 "../src/parse/conf_lexer.re"
+#line 344 "../src/parse/conf_lexer.re"
 
 }
 
 Ret Input::lex_conf_semicolon() {
     CHECK_RET(lex_spaces());
 
-#line 4949 "src/parse/conf_lexer.cc"
+#line 5198 "src/parse/conf_lexer.cc"
 {
 	uint8_t yych;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
-	if (yych == ';') goto yy916;
+	if (yych == ';') goto yy1015;
 	++cur;
-#line 342 "../src/parse/conf_lexer.re"
+#line 351 "../src/parse/conf_lexer.re"
 	{ RET_FAIL(error_at_cur("missing ending ';' in configuration")); }
-#line 4958 "src/parse/conf_lexer.cc"
-yy916:
+#line 5207 "src/parse/conf_lexer.cc"
+yy1015:
 	++cur;
-#line 341 "../src/parse/conf_lexer.re"
+#line 350 "../src/parse/conf_lexer.re"
 	{ return Ret::OK; }
-#line 4963 "src/parse/conf_lexer.cc"
+#line 5212 "src/parse/conf_lexer.cc"
 }
-#line 343 "../src/parse/conf_lexer.re"
+#line 352 "../src/parse/conf_lexer.re"
 
 }
 
@@ -4989,130 +5238,128 @@ Ret Input::lex_conf_string_legacy() {
     CHECK_RET(lex_conf_assign());
     tok = cur;
 
-#line 4993 "src/parse/conf_lexer.cc"
+#line 5242 "src/parse/conf_lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128,   0,   0, 128, 128,   0, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128,   0, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128,   0,   0, 128, 128,   0, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128,   0, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
 	};
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
 	if (yych <= ' ') {
 		if (yych <= '\n') {
-			if (yych <= 0x00) goto yy918;
-			if (yych <= 0x08) goto yy919;
+			if (yych <= 0x00) goto yy1017;
+			if (yych <= 0x08) goto yy1018;
 		} else {
-			if (yych == '\r') goto yy918;
-			if (yych <= 0x1F) goto yy919;
+			if (yych == '\r') goto yy1017;
+			if (yych <= 0x1F) goto yy1018;
 		}
 	} else {
 		if (yych <= '&') {
-			if (yych == '"') goto yy920;
-			goto yy919;
+			if (yych == '"') goto yy1019;
+			goto yy1018;
 		} else {
-			if (yych <= '\'') goto yy920;
-			if (yych != ';') goto yy919;
+			if (yych <= '\'') goto yy1019;
+			if (yych != ';') goto yy1018;
 		}
 	}
-yy918:
-#line 372 "../src/parse/conf_lexer.re"
+yy1017:
+#line 381 "../src/parse/conf_lexer.re"
 	{ tmp_str.clear(); goto end; }
-#line 5052 "src/parse/conf_lexer.cc"
-yy919:
+#line 5301 "src/parse/conf_lexer.cc"
+yy1018:
 	++cur;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy919;
-	}
-#line 370 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 128) goto yy1018;
+#line 379 "../src/parse/conf_lexer.re"
 	{ tmp_str.assign(tok, cur); goto end; }
-#line 5062 "src/parse/conf_lexer.cc"
-yy920:
+#line 5309 "src/parse/conf_lexer.cc"
+yy1019:
 	++cur;
 	cur -= 1;
-#line 371 "../src/parse/conf_lexer.re"
+#line 380 "../src/parse/conf_lexer.re"
 	{ tmp_str.clear(); goto loop; }
-#line 5068 "src/parse/conf_lexer.cc"
+#line 5315 "src/parse/conf_lexer.cc"
 }
-#line 373 "../src/parse/conf_lexer.re"
+#line 382 "../src/parse/conf_lexer.re"
 
 loop: // lex one or more double-quoted strings separated with spaces or newlines
     tok = cur;
 
-#line 5075 "src/parse/conf_lexer.cc"
+#line 5322 "src/parse/conf_lexer.cc"
 {
 	uint8_t yych;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
 	if (yych <= 0x1F) {
 		if (yych <= '\n') {
-			if (yych <= 0x08) goto yy922;
-			if (yych <= '\t') goto yy923;
-			goto yy924;
+			if (yych <= 0x08) goto yy1021;
+			if (yych <= '\t') goto yy1022;
+			goto yy1023;
 		} else {
-			if (yych == '\r') goto yy923;
+			if (yych == '\r') goto yy1022;
 		}
 	} else {
 		if (yych <= '"') {
-			if (yych <= ' ') goto yy923;
-			if (yych >= '"') goto yy925;
+			if (yych <= ' ') goto yy1022;
+			if (yych >= '"') goto yy1024;
 		} else {
-			if (yych == '\'') goto yy925;
+			if (yych == '\'') goto yy1024;
 		}
 	}
-yy922:
-#line 380 "../src/parse/conf_lexer.re"
+yy1021:
+#line 389 "../src/parse/conf_lexer.re"
 	{ goto end; }
-#line 5099 "src/parse/conf_lexer.cc"
-yy923:
+#line 5346 "src/parse/conf_lexer.cc"
+yy1022:
 	++cur;
-#line 379 "../src/parse/conf_lexer.re"
+#line 388 "../src/parse/conf_lexer.re"
 	{ goto loop; }
-#line 5104 "src/parse/conf_lexer.cc"
-yy924:
+#line 5351 "src/parse/conf_lexer.cc"
+yy1023:
 	++cur;
-#line 378 "../src/parse/conf_lexer.re"
+#line 387 "../src/parse/conf_lexer.re"
 	{ next_line(); goto loop; }
-#line 5109 "src/parse/conf_lexer.cc"
-yy925:
+#line 5356 "src/parse/conf_lexer.cc"
+yy1024:
 	++cur;
-#line 377 "../src/parse/conf_lexer.re"
+#line 386 "../src/parse/conf_lexer.re"
 	{ CHECK_RET(lex_conf_string_quoted(tok[0])); goto loop; }
-#line 5114 "src/parse/conf_lexer.cc"
+#line 5361 "src/parse/conf_lexer.cc"
 }
-#line 381 "../src/parse/conf_lexer.re"
+#line 390 "../src/parse/conf_lexer.re"
 
 end:
     return lex_conf_semicolon();
@@ -5208,53 +5455,51 @@ Ret Input::lex_conf_token(CONF_STYPE* yylval, int& token, Opt& opts) {
 start:
     tok = cur;
 
-#line 5212 "src/parse/conf_lexer.cc"
+#line 5459 "src/parse/conf_lexer.cc"
 {
 	uint8_t yych;
 	unsigned int yyaccept = 0;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 144,   0, 128, 128, 144, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		144, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		224, 224, 224, 224, 224, 224, 224, 224, 
-		224, 224, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 192, 
-		128, 192, 192, 192, 192, 192, 192, 192, 
-		192, 192, 192, 192, 192, 192, 192, 192, 
-		192, 192, 192, 192, 192, 192, 192, 192, 
-		192, 192, 192, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 144,   0, 128, 128, 144, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		144, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		224, 224, 224, 224, 224, 224, 224, 224,
+		224, 224, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 192,
+		128, 192, 192, 192, 192, 192, 192, 192,
+		192, 192, 192, 192, 192, 192, 192, 192,
+		192, 192, 192, 192, 192, 192, 192, 192,
+		192, 192, 192, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
 	};
 	if ((lim - cur) < 30) YYFILL(30);
 	yych = *cur;
-	if (yybm[0+yych] & 16) {
-		goto yy930;
-	}
+	if (yybm[0+yych] & 16) goto yy1029;
 	switch (yych) {
-		case 0x00: goto yy927;
+		case 0x00: goto yy1026;
 		case '\t':
-		case '\n': goto yy931;
+		case '\n': goto yy1030;
 		case ' ':
 		case '!':
 		case '&':
@@ -5268,12 +5513,12 @@ start:
 		case ']':
 		case '{':
 		case '|':
-		case '}': goto yy932;
+		case '}': goto yy1031;
 		case '"':
-		case '\'': goto yy933;
-		case '-': goto yy934;
-		case '/': goto yy935;
-		case '0': goto yy936;
+		case '\'': goto yy1032;
+		case '-': goto yy1033;
+		case '/': goto yy1034;
+		case '0': goto yy1035;
 		case '1':
 		case '2':
 		case '3':
@@ -5282,8 +5527,8 @@ start:
 		case '6':
 		case '7':
 		case '8':
-		case '9': goto yy938;
-		case ';': goto yy939;
+		case '9': goto yy1037;
+		case ';': goto yy1038;
 		case '_':
 		case 'j':
 		case 'k':
@@ -5291,4857 +5536,4814 @@ start:
 		case 'w':
 		case 'x':
 		case 'y':
-		case 'z': goto yy940;
-		case 'a': goto yy943;
-		case 'b': goto yy944;
-		case 'c': goto yy945;
-		case 'd': goto yy946;
-		case 'e': goto yy947;
-		case 'f': goto yy948;
-		case 'g': goto yy949;
-		case 'h': goto yy950;
-		case 'i': goto yy951;
-		case 'l': goto yy952;
-		case 'm': goto yy953;
-		case 'n': goto yy954;
-		case 'o': goto yy955;
-		case 'p': goto yy956;
-		case 'r': goto yy957;
-		case 's': goto yy958;
-		case 't': goto yy959;
-		case 'u': goto yy960;
-		case 'v': goto yy961;
-		default: goto yy928;
+		case 'z': goto yy1039;
+		case 'a': goto yy1042;
+		case 'b': goto yy1043;
+		case 'c': goto yy1044;
+		case 'd': goto yy1045;
+		case 'e': goto yy1046;
+		case 'f': goto yy1047;
+		case 'g': goto yy1048;
+		case 'h': goto yy1049;
+		case 'i': goto yy1050;
+		case 'l': goto yy1051;
+		case 'm': goto yy1052;
+		case 'n': goto yy1053;
+		case 'o': goto yy1054;
+		case 'p': goto yy1055;
+		case 'r': goto yy1056;
+		case 's': goto yy1057;
+		case 't': goto yy1058;
+		case 'u': goto yy1059;
+		case 'v': goto yy1060;
+		default: goto yy1027;
 	}
-yy927:
+yy1026:
 	++cur;
-#line 478 "../src/parse/conf_lexer.re"
+#line 487 "../src/parse/conf_lexer.re"
 	{ RET_FAIL(error_at_cur("unexpected end of input in configuration")); }
-#line 5321 "src/parse/conf_lexer.cc"
-yy928:
+#line 5566 "src/parse/conf_lexer.cc"
+yy1027:
 	++cur;
-yy929:
-#line 695 "../src/parse/conf_lexer.re"
+yy1028:
+#line 707 "../src/parse/conf_lexer.re"
 	{ RET_FAIL(error_at_tok("unexpected character: '%c'", cur[-1])); }
-#line 5327 "src/parse/conf_lexer.cc"
-yy930:
+#line 5572 "src/parse/conf_lexer.cc"
+yy1029:
 	++cur;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
-	if (yybm[0+yych] & 16) {
-		goto yy930;
-	}
-#line 482 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 16) goto yy1029;
+#line 491 "../src/parse/conf_lexer.re"
 	{ goto start; }
-#line 5337 "src/parse/conf_lexer.cc"
-yy931:
+#line 5580 "src/parse/conf_lexer.cc"
+yy1030:
 	++cur;
-#line 480 "../src/parse/conf_lexer.re"
+#line 489 "../src/parse/conf_lexer.re"
 	{ next_line(); goto start; }
-#line 5342 "src/parse/conf_lexer.cc"
-yy932:
+#line 5585 "src/parse/conf_lexer.cc"
+yy1031:
 	++cur;
-#line 498 "../src/parse/conf_lexer.re"
+#line 507 "../src/parse/conf_lexer.re"
 	{ RET_TOK(cur[-1]); }
-#line 5347 "src/parse/conf_lexer.cc"
-yy933:
+#line 5590 "src/parse/conf_lexer.cc"
+yy1032:
 	++cur;
-#line 491 "../src/parse/conf_lexer.re"
+#line 500 "../src/parse/conf_lexer.re"
 	{
         tmp_str.clear();
         CHECK_RET(lex_conf_string_quoted(cur[-1]));
         yylval->str = copystr(tmp_str, alc);
         RET_TOK(CONF_STRING);
     }
-#line 5357 "src/parse/conf_lexer.cc"
-yy934:
+#line 5600 "src/parse/conf_lexer.cc"
+yy1033:
 	yych = *++cur;
-	if (yych <= '0') goto yy929;
-	if (yych <= '9') goto yy962;
-	goto yy929;
-yy935:
+	if (yych <= '0') goto yy1028;
+	if (yych <= '9') goto yy1061;
+	goto yy1028;
+yy1034:
 	yyaccept = 0;
 	yych = *(mar = ++cur);
-	if (yych == '/') goto yy963;
-	goto yy929;
-yy936:
+	if (yych == '/') goto yy1062;
+	goto yy1028;
+yy1035:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-yy937:
-#line 484 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+yy1036:
+#line 493 "../src/parse/conf_lexer.re"
 	{
         if (!s_to_i32_unsafe(tok, cur, yylval->num)) {
             RET_FAIL(error_at_cur("configuration value overflow"));
         }
         RET_TOK(CONF_NUMBER);
     }
-#line 5381 "src/parse/conf_lexer.cc"
-yy938:
+#line 5622 "src/parse/conf_lexer.cc"
+yy1037:
 	++cur;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
-	if (yybm[0+yych] & 32) {
-		goto yy938;
-	}
-	if (yych == '_') goto yy940;
-	if (yych <= '`') goto yy937;
-	if (yych <= 'z') goto yy940;
-	goto yy937;
-yy939:
+	if (yybm[0+yych] & 32) goto yy1037;
+	if (yych == '_') goto yy1039;
+	if (yych <= '`') goto yy1036;
+	if (yych <= 'z') goto yy1039;
+	goto yy1036;
+yy1038:
 	++cur;
-#line 476 "../src/parse/conf_lexer.re"
+#line 485 "../src/parse/conf_lexer.re"
 	{ RET_TOK(CONF_EOF); }
-#line 5397 "src/parse/conf_lexer.cc"
-yy940:
+#line 5636 "src/parse/conf_lexer.cc"
+yy1039:
 	++cur;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
-yy941:
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-yy942:
-#line 691 "../src/parse/conf_lexer.re"
+yy1040:
+	if (yybm[0+yych] & 64) goto yy1039;
+yy1041:
+#line 703 "../src/parse/conf_lexer.re"
 	{
         RET_FAIL(error_at_tok("unknown variable or option: '%.*s'", int(cur - tok), tok));
     }
-#line 5411 "src/parse/conf_lexer.cc"
-yy943:
+#line 5648 "src/parse/conf_lexer.cc"
+yy1042:
 	yych = *++cur;
-	if (yych == 'p') goto yy965;
-	if (yych == 'r') goto yy966;
-	goto yy941;
-yy944:
+	if (yych == 'p') goto yy1064;
+	if (yych == 'r') goto yy1065;
+	goto yy1040;
+yy1043:
 	yych = *++cur;
-	if (yych == 'a') goto yy967;
-	if (yych == 'r') goto yy968;
-	goto yy941;
-yy945:
+	if (yych == 'a') goto yy1066;
+	if (yych == 'r') goto yy1067;
+	goto yy1040;
+yy1044:
 	yych = *++cur;
 	switch (yych) {
-		case 'a': goto yy969;
-		case 'h': goto yy970;
-		case 'o': goto yy971;
-		case 't': goto yy972;
-		case 'u': goto yy973;
-		default: goto yy941;
+		case 'a': goto yy1068;
+		case 'h': goto yy1069;
+		case 'o': goto yy1070;
+		case 't': goto yy1071;
+		case 'u': goto yy1072;
+		default: goto yy1040;
 	}
-yy946:
+yy1045:
 	yych = *++cur;
-	if (yych == 'a') goto yy974;
-	if (yych == 'e') goto yy975;
-	goto yy941;
-yy947:
+	if (yych == 'a') goto yy1073;
+	if (yych == 'e') goto yy1074;
+	goto yy1040;
+yy1046:
 	yych = *++cur;
-	if (yych == 'l') goto yy976;
-	if (yych == 'x') goto yy977;
-	goto yy941;
-yy948:
+	if (yych == 'l') goto yy1075;
+	if (yych == 'x') goto yy1076;
+	goto yy1040;
+yy1047:
 	yych = *++cur;
-	if (yych == 'i') goto yy978;
-	if (yych == 'n') goto yy979;
-	goto yy941;
-yy949:
+	if (yych == 'i') goto yy1077;
+	if (yych == 'n') goto yy1078;
+	goto yy1040;
+yy1048:
 	yych = *++cur;
-	if (yych == 'e') goto yy981;
-	goto yy941;
-yy950:
+	if (yych == 'e') goto yy1080;
+	goto yy1040;
+yy1049:
 	yych = *++cur;
-	if (yych == 'a') goto yy982;
-	goto yy941;
-yy951:
+	if (yych == 'a') goto yy1081;
+	goto yy1040;
+yy1050:
 	yych = *++cur;
-	if (yych == 'n') goto yy983;
-	goto yy941;
-yy952:
+	if (yych == 'n') goto yy1082;
+	goto yy1040;
+yy1051:
 	yych = *++cur;
 	switch (yych) {
-		case 'a': goto yy984;
-		case 'e': goto yy985;
-		case 'h': goto yy986;
-		case 'i': goto yy987;
-		case 'o': goto yy988;
-		default: goto yy941;
+		case 'a': goto yy1083;
+		case 'e': goto yy1084;
+		case 'h': goto yy1085;
+		case 'i': goto yy1086;
+		case 'o': goto yy1087;
+		default: goto yy1040;
 	}
-yy953:
+yy1052:
 	yych = *++cur;
 	if (yych <= 'n') {
-		if (yych == 'a') goto yy989;
-		goto yy941;
+		if (yych == 'a') goto yy1088;
+		goto yy1040;
 	} else {
-		if (yych <= 'o') goto yy990;
-		if (yych == 't') goto yy991;
-		goto yy941;
+		if (yych <= 'o') goto yy1089;
+		if (yych == 't') goto yy1090;
+		goto yy1040;
 	}
-yy954:
+yy1053:
 	yych = *++cur;
 	if (yych <= 'd') {
-		if (yych == 'a') goto yy992;
-		goto yy941;
+		if (yych == 'a') goto yy1091;
+		goto yy1040;
 	} else {
-		if (yych <= 'e') goto yy993;
-		if (yych == 'l') goto yy994;
-		goto yy941;
+		if (yych <= 'e') goto yy1092;
+		if (yych == 'l') goto yy1093;
+		goto yy1040;
 	}
-yy955:
+yy1054:
 	yych = *++cur;
-	if (yych == 'f') goto yy995;
-	goto yy941;
-yy956:
+	if (yych == 'f') goto yy1094;
+	goto yy1040;
+yy1055:
 	yych = *++cur;
-	if (yych == 'e') goto yy996;
-	goto yy941;
-yy957:
+	if (yych == 'e') goto yy1095;
+	goto yy1040;
+yy1056:
 	yych = *++cur;
 	if (yych <= 'g') {
-		if (yych == 'e') goto yy997;
-		goto yy941;
+		if (yych == 'e') goto yy1096;
+		goto yy1040;
 	} else {
-		if (yych <= 'h') goto yy998;
-		if (yych == 'o') goto yy999;
-		goto yy941;
+		if (yych <= 'h') goto yy1097;
+		if (yych == 'o') goto yy1098;
+		goto yy1040;
 	}
-yy958:
+yy1057:
 	yych = *++cur;
 	switch (yych) {
-		case 'e': goto yy1000;
-		case 'h': goto yy1001;
-		case 'i': goto yy1002;
-		case 'k': goto yy1003;
-		case 't': goto yy1004;
-		default: goto yy941;
+		case 'e': goto yy1099;
+		case 'h': goto yy1100;
+		case 'i': goto yy1101;
+		case 'k': goto yy1102;
+		case 't': goto yy1103;
+		default: goto yy1040;
 	}
-yy959:
+yy1058:
 	yych = *++cur;
 	if (yych <= 'n') {
-		if (yych == 'a') goto yy1005;
-		goto yy941;
+		if (yych == 'a') goto yy1104;
+		goto yy1040;
 	} else {
-		if (yych <= 'o') goto yy1006;
-		if (yych == 'y') goto yy1007;
-		goto yy941;
+		if (yych <= 'o') goto yy1105;
+		if (yych == 'y') goto yy1106;
+		goto yy1040;
 	}
-yy960:
+yy1059:
 	yych = *++cur;
-	if (yych == 'n') goto yy1008;
-	goto yy941;
-yy961:
+	if (yych == 'n') goto yy1107;
+	goto yy1040;
+yy1060:
 	yych = *++cur;
-	if (yych == 'a') goto yy1009;
-	if (yych == 'e') goto yy1010;
-	goto yy941;
-yy962:
+	if (yych == 'a') goto yy1108;
+	if (yych == 'e') goto yy1109;
+	goto yy1040;
+yy1061:
 	++cur;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
-	if (yych <= '/') goto yy937;
-	if (yych <= '9') goto yy962;
-	goto yy937;
-yy963:
+	if (yych <= '/') goto yy1036;
+	if (yych <= '9') goto yy1061;
+	goto yy1036;
+yy1062:
 	++cur;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy963;
-	}
-	if (yych >= 0x01) goto yy931;
-yy964:
+	if (yybm[0+yych] & 128) goto yy1062;
+	if (yych >= 0x01) goto yy1030;
+yy1063:
 	cur = mar;
-	if (yyaccept == 0) {
-		goto yy929;
-	} else {
-		goto yy942;
-	}
-yy965:
+	if (yyaccept == 0) goto yy1028;
+	else goto yy1041;
+yy1064:
 	yych = *++cur;
-	if (yych == 'i') goto yy1011;
-	goto yy941;
-yy966:
+	if (yych == 'i') goto yy1110;
+	goto yy1040;
+yy1065:
 	yych = *++cur;
-	if (yych == 'g') goto yy1012;
-	if (yych == 'r') goto yy1013;
-	goto yy941;
-yy967:
+	if (yych == 'g') goto yy1111;
+	if (yych == 'r') goto yy1112;
+	goto yy1040;
+yy1066:
 	yych = *++cur;
-	if (yych == 'c') goto yy1014;
-	goto yy941;
-yy968:
+	if (yych == 'c') goto yy1113;
+	goto yy1040;
+yy1067:
 	yych = *++cur;
-	if (yych == 'a') goto yy1015;
-	goto yy941;
-yy969:
+	if (yych == 'a') goto yy1114;
+	goto yy1040;
+yy1068:
 	yych = *++cur;
-	if (yych == 's') goto yy1016;
-	goto yy941;
-yy970:
+	if (yych == 's') goto yy1115;
+	goto yy1040;
+yy1069:
 	yych = *++cur;
-	if (yych == 'a') goto yy1017;
-	goto yy941;
-yy971:
+	if (yych == 'a') goto yy1116;
+	goto yy1040;
+yy1070:
 	yych = *++cur;
 	if (yych <= 'm') {
-		if (yych == 'd') goto yy1018;
-		goto yy941;
+		if (yych == 'd') goto yy1117;
+		goto yy1040;
 	} else {
-		if (yych <= 'n') goto yy1019;
-		if (yych == 'p') goto yy1020;
-		goto yy941;
+		if (yych <= 'n') goto yy1118;
+		if (yych == 'p') goto yy1119;
+		goto yy1040;
 	}
-yy972:
+yy1071:
 	yych = *++cur;
-	if (yych <= 'w') goto yy941;
-	if (yych <= 'x') goto yy1021;
-	if (yych <= 'y') goto yy1022;
-	goto yy941;
-yy973:
+	if (yych <= 'w') goto yy1040;
+	if (yych <= 'x') goto yy1120;
+	if (yych <= 'y') goto yy1121;
+	goto yy1040;
+yy1072:
 	yych = *++cur;
-	if (yych == 'r') goto yy1023;
-	goto yy941;
-yy974:
+	if (yych == 'r') goto yy1122;
+	goto yy1040;
+yy1073:
 	yych = *++cur;
-	if (yych == 't') goto yy1024;
-	goto yy941;
-yy975:
+	if (yych == 't') goto yy1123;
+	goto yy1040;
+yy1074:
 	yych = *++cur;
-	if (yych == 'b') goto yy1025;
-	if (yych == 'd') goto yy1026;
-	goto yy941;
-yy976:
+	if (yych == 'b') goto yy1124;
+	if (yych == 'd') goto yy1125;
+	goto yy1040;
+yy1075:
 	yych = *++cur;
-	if (yych == 'e') goto yy1027;
-	goto yy941;
-yy977:
+	if (yych == 'e') goto yy1126;
+	goto yy1040;
+yy1076:
 	yych = *++cur;
-	if (yych == 'p') goto yy1028;
-	goto yy941;
-yy978:
+	if (yych == 'p') goto yy1127;
+	goto yy1040;
+yy1077:
 	yych = *++cur;
-	if (yych == 'l') goto yy1029;
-	goto yy941;
-yy979:
+	if (yych == 'l') goto yy1128;
+	goto yy1040;
+yy1078:
 	yych = *++cur;
 	if (yych <= '_') {
-		if (yych <= '/') goto yy980;
-		if (yych <= '9') goto yy940;
-		if (yych >= '_') goto yy940;
+		if (yych <= '/') goto yy1079;
+		if (yych <= '9') goto yy1039;
+		if (yych >= '_') goto yy1039;
 	} else {
 		if (yych <= 'c') {
-			if (yych >= 'a') goto yy940;
+			if (yych >= 'a') goto yy1039;
 		} else {
-			if (yych <= 'd') goto yy1030;
-			if (yych <= 'z') goto yy940;
+			if (yych <= 'd') goto yy1129;
+			if (yych <= 'z') goto yy1039;
 		}
 	}
-yy980:
-#line 588 "../src/parse/conf_lexer.re"
+yy1079:
+#line 600 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::FN); }
-#line 5641 "src/parse/conf_lexer.cc"
-yy981:
+#line 5873 "src/parse/conf_lexer.cc"
+yy1080:
 	yych = *++cur;
-	if (yych == 't') goto yy1031;
-	goto yy941;
-yy982:
+	if (yych == 't') goto yy1130;
+	goto yy1040;
+yy1081:
 	yych = *++cur;
-	if (yych == 'v') goto yy1032;
-	goto yy941;
-yy983:
+	if (yych == 'v') goto yy1131;
+	goto yy1040;
+yy1082:
 	yych = *++cur;
 	if (yych <= 'h') {
-		if (yych == 'd') goto yy1033;
-		goto yy941;
+		if (yych == 'd') goto yy1132;
+		goto yy1040;
 	} else {
-		if (yych <= 'i') goto yy1034;
-		if (yych == 'p') goto yy1035;
-		goto yy941;
+		if (yych <= 'i') goto yy1133;
+		if (yych == 'p') goto yy1134;
+		goto yy1040;
 	}
-yy984:
+yy1083:
 	yych = *++cur;
-	if (yych == 'b') goto yy1036;
-	goto yy941;
-yy985:
+	if (yych == 'b') goto yy1135;
+	goto yy1040;
+yy1084:
 	yych = *++cur;
-	if (yych == 's') goto yy1037;
-	goto yy941;
-yy986:
+	if (yych == 's') goto yy1136;
+	goto yy1040;
+yy1085:
 	yych = *++cur;
-	if (yych == 's') goto yy1038;
-	goto yy941;
-yy987:
+	if (yych == 's') goto yy1137;
+	goto yy1040;
+yy1086:
 	yych = *++cur;
-	if (yych <= 'l') goto yy941;
-	if (yych <= 'm') goto yy1039;
-	if (yych <= 'n') goto yy1040;
-	goto yy941;
-yy988:
+	if (yych <= 'l') goto yy1040;
+	if (yych <= 'm') goto yy1138;
+	if (yych <= 'n') goto yy1139;
+	goto yy1040;
+yy1087:
 	yych = *++cur;
-	if (yych == 'o') goto yy1041;
-	goto yy941;
-yy989:
+	if (yych == 'o') goto yy1140;
+	goto yy1040;
+yy1088:
 	yych = *++cur;
-	if (yych == 'n') goto yy1042;
-	if (yych == 'r') goto yy1043;
-	goto yy941;
-yy990:
+	if (yych == 'n') goto yy1141;
+	if (yych == 'r') goto yy1142;
+	goto yy1040;
+yy1089:
 	yych = *++cur;
-	if (yych == 'n') goto yy1044;
-	goto yy941;
-yy991:
+	if (yych == 'n') goto yy1143;
+	goto yy1040;
+yy1090:
 	yych = *++cur;
-	if (yych == 'a') goto yy1045;
-	goto yy941;
-yy992:
+	if (yych == 'a') goto yy1144;
+	goto yy1040;
+yy1091:
 	yych = *++cur;
-	if (yych == 'm') goto yy1046;
-	goto yy941;
-yy993:
+	if (yych == 'm') goto yy1145;
+	goto yy1040;
+yy1092:
 	yych = *++cur;
 	if (yych <= 'f') {
-		if (yych == 'e') goto yy1047;
-		goto yy941;
+		if (yych == 'e') goto yy1146;
+		goto yy1040;
 	} else {
-		if (yych <= 'g') goto yy1048;
-		if (yych == 's') goto yy1049;
-		goto yy941;
+		if (yych <= 'g') goto yy1147;
+		if (yych == 's') goto yy1148;
+		goto yy1040;
 	}
-yy994:
+yy1093:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 639 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 651 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::NEWLINE); }
-#line 5716 "src/parse/conf_lexer.cc"
-yy995:
+#line 5946 "src/parse/conf_lexer.cc"
+yy1094:
 	yych = *++cur;
-	if (yych == 'f') goto yy1050;
-	goto yy941;
-yy996:
+	if (yych == 'f') goto yy1149;
+	goto yy1040;
+yy1095:
 	yych = *++cur;
-	if (yych == 'e') goto yy1051;
-	goto yy941;
-yy997:
+	if (yych == 'e') goto yy1150;
+	goto yy1040;
+yy1096:
 	yych = *++cur;
 	if (yych <= 'r') {
-		if (yych == 'c') goto yy1052;
-		goto yy941;
+		if (yych == 'c') goto yy1151;
+		goto yy1040;
 	} else {
-		if (yych <= 's') goto yy1053;
-		if (yych <= 't') goto yy1054;
-		goto yy941;
+		if (yych <= 's') goto yy1152;
+		if (yych <= 't') goto yy1153;
+		goto yy1040;
 	}
-yy998:
+yy1097:
 	yych = *++cur;
-	if (yych == 's') goto yy1055;
-	goto yy941;
-yy999:
+	if (yych == 's') goto yy1154;
+	goto yy1040;
+yy1098:
 	yych = *++cur;
-	if (yych == 'w') goto yy1056;
-	goto yy941;
-yy1000:
+	if (yych == 'w') goto yy1155;
+	goto yy1040;
+yy1099:
 	yych = *++cur;
-	if (yych == 't') goto yy1057;
-	goto yy941;
-yy1001:
+	if (yych == 't') goto yy1156;
+	goto yy1040;
+yy1100:
 	yych = *++cur;
-	if (yych == 'i') goto yy1058;
-	goto yy941;
-yy1002:
+	if (yych == 'i') goto yy1157;
+	goto yy1040;
+yy1101:
 	yych = *++cur;
-	if (yych == 'g') goto yy1059;
-	if (yych == 'z') goto yy1060;
-	goto yy941;
-yy1003:
+	if (yych == 'g') goto yy1158;
+	if (yych == 'z') goto yy1159;
+	goto yy1040;
+yy1102:
 	yych = *++cur;
-	if (yych == 'i') goto yy1061;
-	goto yy941;
-yy1004:
+	if (yych == 'i') goto yy1160;
+	goto yy1040;
+yy1103:
 	yych = *++cur;
 	if (yych <= 'l') {
-		if (yych == 'a') goto yy1062;
-		goto yy941;
+		if (yych == 'a') goto yy1161;
+		goto yy1040;
 	} else {
-		if (yych <= 'm') goto yy1063;
-		if (yych == 'o') goto yy1064;
-		goto yy941;
+		if (yych <= 'm') goto yy1162;
+		if (yych == 'o') goto yy1163;
+		goto yy1040;
 	}
-yy1005:
+yy1104:
 	yych = *++cur;
-	if (yych == 'g') goto yy1065;
-	goto yy941;
-yy1006:
+	if (yych == 'g') goto yy1164;
+	goto yy1040;
+yy1105:
 	yych = *++cur;
-	if (yych == 'p') goto yy1066;
-	goto yy941;
-yy1007:
+	if (yych == 'p') goto yy1165;
+	goto yy1040;
+yy1106:
 	yych = *++cur;
-	if (yych == 'p') goto yy1067;
-	goto yy941;
-yy1008:
+	if (yych == 'p') goto yy1166;
+	goto yy1040;
+yy1107:
 	yych = *++cur;
-	if (yych == 's') goto yy1068;
-	goto yy941;
-yy1009:
+	if (yych == 's') goto yy1167;
+	goto yy1040;
+yy1108:
 	yych = *++cur;
-	if (yych == 'l') goto yy1069;
-	if (yych == 'r') goto yy1070;
-	goto yy941;
-yy1010:
+	if (yych == 'l') goto yy1168;
+	if (yych == 'r') goto yy1169;
+	goto yy1040;
+yy1109:
 	yych = *++cur;
-	if (yych == 'r') goto yy1071;
-	goto yy941;
-yy1011:
+	if (yych == 'r') goto yy1170;
+	goto yy1040;
+yy1110:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych == '.') goto yy1072;
-	if (yych == '_') goto yy1073;
-	goto yy941;
-yy1012:
+	if (yych == '.') goto yy1171;
+	if (yych == '_') goto yy1172;
+	goto yy1040;
+yy1111:
 	yych = *++cur;
 	if (yych <= '`') {
 		if (yych <= '9') {
-			if (yych >= '0') goto yy940;
+			if (yych >= '0') goto yy1039;
 		} else {
-			if (yych == '_') goto yy940;
+			if (yych == '_') goto yy1039;
 		}
 	} else {
 		if (yych <= 's') {
-			if (yych == 'n') goto yy1074;
-			goto yy940;
+			if (yych == 'n') goto yy1173;
+			goto yy1039;
 		} else {
-			if (yych <= 't') goto yy1075;
-			if (yych <= 'z') goto yy940;
+			if (yych <= 't') goto yy1174;
+			if (yych <= 'z') goto yy1039;
 		}
 	}
-#line 569 "../src/parse/conf_lexer.re"
+#line 581 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::ARG); }
-#line 5820 "src/parse/conf_lexer.cc"
-yy1013:
+#line 6050 "src/parse/conf_lexer.cc"
+yy1112:
 	yych = *++cur;
-	if (yych == 'a') goto yy1076;
-	goto yy941;
-yy1014:
+	if (yych == 'a') goto yy1175;
+	goto yy1040;
+yy1113:
 	yych = *++cur;
-	if (yych == 'k') goto yy1077;
-	goto yy941;
-yy1015:
+	if (yych == 'k') goto yy1176;
+	goto yy1040;
+yy1114:
 	yych = *++cur;
-	if (yych == 'n') goto yy1078;
-	goto yy941;
-yy1016:
+	if (yych == 'n') goto yy1177;
+	goto yy1040;
+yy1115:
 	yych = *++cur;
-	if (yych == 'e') goto yy1079;
-	goto yy941;
-yy1017:
+	if (yych == 'e') goto yy1178;
+	goto yy1040;
+yy1116:
 	yych = *++cur;
-	if (yych == 'r') goto yy1081;
-	goto yy941;
-yy1018:
+	if (yych == 'r') goto yy1180;
+	goto yy1040;
+yy1117:
 	yych = *++cur;
-	if (yych == 'e') goto yy1083;
-	goto yy941;
-yy1019:
+	if (yych == 'e') goto yy1182;
+	goto yy1040;
+yy1118:
 	yych = *++cur;
-	if (yych == 'd') goto yy1084;
-	goto yy941;
-yy1020:
+	if (yych == 'd') goto yy1183;
+	goto yy1040;
+yy1119:
 	yych = *++cur;
-	if (yych == 'y') goto yy1085;
-	goto yy941;
-yy1021:
+	if (yych == 'y') goto yy1184;
+	goto yy1040;
+yy1120:
 	yych = *++cur;
-	if (yych == 'm') goto yy1086;
-	goto yy941;
-yy1022:
+	if (yych == 'm') goto yy1185;
+	goto yy1040;
+yy1121:
 	yych = *++cur;
-	if (yych == 'p') goto yy1087;
-	goto yy941;
-yy1023:
+	if (yych == 'p') goto yy1186;
+	goto yy1040;
+yy1122:
 	yych = *++cur;
-	if (yych == 's') goto yy1088;
-	goto yy941;
-yy1024:
+	if (yych == 's') goto yy1187;
+	goto yy1040;
+yy1123:
 	yych = *++cur;
-	if (yych == 'e') goto yy1089;
-	goto yy941;
-yy1025:
+	if (yych == 'e') goto yy1188;
+	goto yy1040;
+yy1124:
 	yych = *++cur;
-	if (yych == 'u') goto yy1090;
-	goto yy941;
-yy1026:
+	if (yych == 'u') goto yy1189;
+	goto yy1040;
+yy1125:
 	yych = *++cur;
-	if (yych == 'e') goto yy1091;
-	goto yy941;
-yy1027:
+	if (yych == 'e') goto yy1190;
+	goto yy1040;
+yy1126:
 	yych = *++cur;
-	if (yych == 'm') goto yy1092;
-	goto yy941;
-yy1028:
+	if (yych == 'm') goto yy1191;
+	goto yy1040;
+yy1127:
 	yych = *++cur;
-	if (yych == 'r') goto yy1093;
-	goto yy941;
-yy1029:
+	if (yych == 'r') goto yy1192;
+	goto yy1040;
+yy1128:
 	yych = *++cur;
-	if (yych == 'e') goto yy1094;
-	goto yy941;
-yy1030:
+	if (yych == 'e') goto yy1193;
+	goto yy1040;
+yy1129:
 	yych = *++cur;
-	if (yych == 'e') goto yy1095;
-	goto yy941;
-yy1031:
+	if (yych == 'e') goto yy1194;
+	goto yy1040;
+yy1130:
 	yych = *++cur;
 	if (yych <= 'b') {
-		if (yych == 'a') goto yy1096;
-		goto yy941;
+		if (yych == 'a') goto yy1195;
+		goto yy1040;
 	} else {
-		if (yych <= 'c') goto yy1097;
-		if (yych == 's') goto yy1098;
-		goto yy941;
+		if (yych <= 'c') goto yy1196;
+		if (yych == 's') goto yy1197;
+		goto yy1040;
 	}
-yy1032:
+yy1131:
 	yych = *++cur;
-	if (yych == 'e') goto yy1099;
-	goto yy941;
-yy1033:
+	if (yych == 'e') goto yy1198;
+	goto yy1040;
+yy1132:
 	yych = *++cur;
-	if (yych == 'e') goto yy1100;
-	goto yy941;
-yy1034:
+	if (yych == 'e') goto yy1199;
+	goto yy1040;
+yy1133:
 	yych = *++cur;
-	if (yych == 't') goto yy1101;
-	goto yy941;
-yy1035:
+	if (yych == 't') goto yy1200;
+	goto yy1040;
+yy1134:
 	yych = *++cur;
-	if (yych == 'u') goto yy1102;
-	goto yy941;
-yy1036:
+	if (yych == 'u') goto yy1201;
+	goto yy1040;
+yy1135:
 	yych = *++cur;
-	if (yych == 'e') goto yy1103;
-	goto yy941;
-yy1037:
+	if (yych == 'e') goto yy1202;
+	goto yy1040;
+yy1136:
 	yych = *++cur;
-	if (yych == 's') goto yy1104;
-	goto yy941;
-yy1038:
+	if (yych == 's') goto yy1203;
+	goto yy1040;
+yy1137:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 600 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 612 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::LHS); }
-#line 5934 "src/parse/conf_lexer.cc"
-yy1039:
+#line 6162 "src/parse/conf_lexer.cc"
+yy1138:
 	yych = *++cur;
-	if (yych == 'i') goto yy1105;
-	goto yy941;
-yy1040:
+	if (yych == 'i') goto yy1204;
+	goto yy1040;
+yy1139:
 	yych = *++cur;
-	if (yych == 'e') goto yy1106;
-	goto yy941;
-yy1041:
+	if (yych == 'e') goto yy1205;
+	goto yy1040;
+yy1140:
 	yych = *++cur;
-	if (yych == 'p') goto yy1107;
-	goto yy941;
-yy1042:
+	if (yych == 'p') goto yy1206;
+	goto yy1040;
+yy1141:
 	yych = *++cur;
-	if (yych == 'y') goto yy1108;
-	goto yy941;
-yy1043:
+	if (yych == 'y') goto yy1207;
+	goto yy1040;
+yy1142:
 	yych = *++cur;
-	if (yych == 'k') goto yy1109;
-	goto yy941;
-yy1044:
+	if (yych == 'k') goto yy1208;
+	goto yy1040;
+yy1143:
 	yych = *++cur;
-	if (yych == 'a') goto yy1110;
-	goto yy941;
-yy1045:
+	if (yych == 'a') goto yy1209;
+	goto yy1040;
+yy1144:
 	yych = *++cur;
-	if (yych == 'g') goto yy1111;
-	goto yy941;
-yy1046:
+	if (yych == 'g') goto yy1210;
+	goto yy1040;
+yy1145:
 	yych = *++cur;
-	if (yych == 'e') goto yy1112;
-	goto yy941;
-yy1047:
+	if (yych == 'e') goto yy1211;
+	goto yy1040;
+yy1146:
 	yych = *++cur;
-	if (yych == 'd') goto yy1113;
-	goto yy941;
-yy1048:
+	if (yych == 'd') goto yy1212;
+	goto yy1040;
+yy1147:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 607 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 619 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::NEG); }
-#line 5978 "src/parse/conf_lexer.cc"
-yy1049:
+#line 6204 "src/parse/conf_lexer.cc"
+yy1148:
 	yych = *++cur;
-	if (yych == 't') goto yy1114;
-	goto yy941;
-yy1050:
+	if (yych == 't') goto yy1213;
+	goto yy1040;
+yy1149:
 	yych = *++cur;
-	if (yych == 's') goto yy1115;
-	goto yy941;
-yy1051:
+	if (yych == 's') goto yy1214;
+	goto yy1040;
+yy1150:
 	yych = *++cur;
-	if (yych == 'k') goto yy1116;
-	goto yy941;
-yy1052:
+	if (yych == 'k') goto yy1215;
+	goto yy1040;
+yy1151:
 	yych = *++cur;
-	if (yych == 'o') goto yy1117;
-	goto yy941;
-yy1053:
+	if (yych == 'o') goto yy1216;
+	goto yy1040;
+yy1152:
 	yych = *++cur;
-	if (yych == 't') goto yy1118;
-	goto yy941;
-yy1054:
+	if (yych == 't') goto yy1217;
+	goto yy1040;
+yy1153:
 	yych = *++cur;
-	if (yych == 'v') goto yy1119;
-	goto yy941;
-yy1055:
+	if (yych == 'v') goto yy1218;
+	goto yy1040;
+yy1154:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 616 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 628 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::RHS); }
-#line 6010 "src/parse/conf_lexer.cc"
-yy1056:
+#line 6234 "src/parse/conf_lexer.cc"
+yy1155:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 617 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 629 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::ROW); }
-#line 6018 "src/parse/conf_lexer.cc"
-yy1057:
+#line 6240 "src/parse/conf_lexer.cc"
+yy1156:
 	yych = *++cur;
 	if (yych <= 'b') {
-		if (yych == 'a') goto yy1120;
-		goto yy941;
+		if (yych == 'a') goto yy1219;
+		goto yy1040;
 	} else {
-		if (yych <= 'c') goto yy1121;
-		if (yych == 's') goto yy1122;
-		goto yy941;
+		if (yych <= 'c') goto yy1220;
+		if (yych == 's') goto yy1221;
+		goto yy1040;
 	}
-yy1058:
+yy1157:
 	yych = *++cur;
-	if (yych == 'f') goto yy1123;
-	goto yy941;
-yy1059:
+	if (yych == 'f') goto yy1222;
+	goto yy1040;
+yy1158:
 	yych = *++cur;
-	if (yych == 'i') goto yy1124;
-	goto yy941;
-yy1060:
+	if (yych == 'i') goto yy1223;
+	goto yy1040;
+yy1159:
 	yych = *++cur;
-	if (yych == 'e') goto yy1125;
-	goto yy941;
-yy1061:
+	if (yych == 'e') goto yy1224;
+	goto yy1040;
+yy1160:
 	yych = *++cur;
-	if (yych == 'p') goto yy1126;
-	goto yy941;
-yy1062:
+	if (yych == 'p') goto yy1225;
+	goto yy1040;
+yy1161:
 	yych = *++cur;
 	if (yych <= 'q') {
-		if (yych == 'g') goto yy1127;
-		goto yy941;
+		if (yych == 'g') goto yy1226;
+		goto yy1040;
 	} else {
-		if (yych <= 'r') goto yy1128;
-		if (yych == 't') goto yy1129;
-		goto yy941;
+		if (yych <= 'r') goto yy1227;
+		if (yych == 't') goto yy1228;
+		goto yy1040;
 	}
-yy1063:
+yy1162:
 	yych = *++cur;
-	if (yych == 't') goto yy1130;
-	goto yy941;
-yy1064:
+	if (yych == 't') goto yy1229;
+	goto yy1040;
+yy1163:
 	yych = *++cur;
-	if (yych == 'r') goto yy1131;
-	goto yy941;
-yy1065:
+	if (yych == 'r') goto yy1230;
+	goto yy1040;
+yy1164:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 631 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 643 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::TAG); }
-#line 6070 "src/parse/conf_lexer.cc"
-yy1066:
+#line 6290 "src/parse/conf_lexer.cc"
+yy1165:
 	yych = *++cur;
-	if (yych == 'i') goto yy1132;
-	goto yy941;
-yy1067:
+	if (yych == 'i') goto yy1231;
+	goto yy1040;
+yy1166:
 	yych = *++cur;
-	if (yych == 'e') goto yy1133;
-	goto yy941;
-yy1068:
+	if (yych == 'e') goto yy1232;
+	goto yy1040;
+yy1167:
 	yych = *++cur;
-	if (yych == 'a') goto yy1135;
-	goto yy941;
-yy1069:
+	if (yych == 'a') goto yy1234;
+	goto yy1040;
+yy1168:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 634 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 646 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::VAL); }
-#line 6090 "src/parse/conf_lexer.cc"
-yy1070:
+#line 6308 "src/parse/conf_lexer.cc"
+yy1169:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 635 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 647 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::VAR); }
-#line 6098 "src/parse/conf_lexer.cc"
-yy1071:
+#line 6314 "src/parse/conf_lexer.cc"
+yy1170:
 	yych = *++cur;
-	if (yych == 's') goto yy1136;
-	goto yy941;
-yy1072:
+	if (yych == 's') goto yy1235;
+	goto yy1040;
+yy1171:
 	yych = *++cur;
 	if (yych <= 'o') {
-		if (yych == 'g') goto yy1137;
-		goto yy964;
+		if (yych == 'g') goto yy1236;
+		goto yy1063;
 	} else {
-		if (yych <= 'p') goto yy1138;
-		if (yych == 'r') goto yy1139;
-		goto yy964;
+		if (yych <= 'p') goto yy1237;
+		if (yych == 'r') goto yy1238;
+		goto yy1063;
 	}
-yy1073:
+yy1172:
 	yych = *++cur;
-	if (yych == 's') goto yy1140;
-	goto yy941;
-yy1074:
+	if (yych == 's') goto yy1239;
+	goto yy1040;
+yy1173:
 	yych = *++cur;
-	if (yych == 'a') goto yy1141;
-	goto yy941;
-yy1075:
+	if (yych == 'a') goto yy1240;
+	goto yy1040;
+yy1174:
 	yych = *++cur;
-	if (yych == 'y') goto yy1142;
-	goto yy941;
-yy1076:
+	if (yych == 'y') goto yy1241;
+	goto yy1040;
+yy1175:
 	yych = *++cur;
-	if (yych == 'y') goto yy1143;
-	goto yy941;
-yy1077:
+	if (yych == 'y') goto yy1242;
+	goto yy1040;
+yy1176:
 	yych = *++cur;
-	if (yych == 'u') goto yy1144;
-	goto yy941;
-yy1078:
+	if (yych == 'u') goto yy1243;
+	goto yy1040;
+yy1177:
 	yych = *++cur;
-	if (yych == 'c') goto yy1145;
-	goto yy941;
-yy1079:
+	if (yych == 'c') goto yy1244;
+	goto yy1040;
+yy1178:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1080;
-		if (yych <= '9') goto yy940;
+		if (yych <= '/') goto yy1179;
+		if (yych <= '9') goto yy1039;
 	} else {
-		if (yych <= '_') goto yy1146;
-		if (yych <= '`') goto yy1080;
-		if (yych <= 'z') goto yy940;
+		if (yych <= '_') goto yy1245;
+		if (yych <= '`') goto yy1179;
+		if (yych <= 'z') goto yy1039;
 	}
-yy1080:
-#line 576 "../src/parse/conf_lexer.re"
+yy1179:
+#line 588 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::CASE); }
-#line 6150 "src/parse/conf_lexer.cc"
-yy1081:
+#line 6366 "src/parse/conf_lexer.cc"
+yy1180:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1082;
-		if (yych <= '9') goto yy940;
+		if (yych <= '/') goto yy1181;
+		if (yych <= '9') goto yy1039;
 	} else {
-		if (yych <= '_') goto yy1147;
-		if (yych <= '`') goto yy1082;
-		if (yych <= 'z') goto yy940;
+		if (yych <= '_') goto yy1246;
+		if (yych <= '`') goto yy1181;
+		if (yych <= 'z') goto yy1039;
 	}
-yy1082:
-#line 577 "../src/parse/conf_lexer.re"
+yy1181:
+#line 589 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::CHAR); }
-#line 6164 "src/parse/conf_lexer.cc"
-yy1083:
+#line 6380 "src/parse/conf_lexer.cc"
+yy1182:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych == ':') goto yy1148;
-	if (yych == '_') goto yy1149;
-	goto yy941;
-yy1084:
+	if (yych == ':') goto yy1247;
+	if (yych == '_') goto yy1248;
+	goto yy1040;
+yy1183:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 578 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 590 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::COND); }
-#line 6178 "src/parse/conf_lexer.cc"
-yy1085:
+#line 6392 "src/parse/conf_lexer.cc"
+yy1184:
 	yych = *++cur;
-	if (yych == 'm') goto yy1150;
-	if (yych == 's') goto yy1151;
-	goto yy941;
-yy1086:
+	if (yych == 'm') goto yy1249;
+	if (yych == 's') goto yy1250;
+	goto yy1040;
+yy1185:
 	yych = *++cur;
-	if (yych == 'a') goto yy1152;
-	goto yy941;
-yy1087:
+	if (yych == 'a') goto yy1251;
+	goto yy1040;
+yy1186:
 	yych = *++cur;
-	if (yych == 'e') goto yy1153;
-	goto yy941;
-yy1088:
+	if (yych == 'e') goto yy1252;
+	goto yy1040;
+yy1187:
 	yych = *++cur;
-	if (yych == 'o') goto yy1154;
-	goto yy941;
-yy1089:
+	if (yych == 'o') goto yy1253;
+	goto yy1040;
+yy1188:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 584 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 596 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::DATE); }
-#line 6203 "src/parse/conf_lexer.cc"
-yy1090:
+#line 6415 "src/parse/conf_lexer.cc"
+yy1189:
 	yych = *++cur;
-	if (yych == 'g') goto yy1155;
-	goto yy941;
-yy1091:
+	if (yych == 'g') goto yy1254;
+	goto yy1040;
+yy1190:
 	yych = *++cur;
-	if (yych == 'n') goto yy1156;
-	goto yy941;
-yy1092:
+	if (yych == 'n') goto yy1255;
+	goto yy1040;
+yy1191:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 586 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 598 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::ELEM); }
-#line 6219 "src/parse/conf_lexer.cc"
-yy1093:
-	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 587 "../src/parse/conf_lexer.re"
+#line 6429 "src/parse/conf_lexer.cc"
+yy1192:
+	yych = *++cur;
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 599 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::EXPR); }
-#line 6227 "src/parse/conf_lexer.cc"
-yy1094:
+#line 6435 "src/parse/conf_lexer.cc"
+yy1193:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 589 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 601 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::FILE); }
-#line 6235 "src/parse/conf_lexer.cc"
-yy1095:
+#line 6441 "src/parse/conf_lexer.cc"
+yy1194:
 	yych = *++cur;
-	if (yych == 'c') goto yy1157;
-	if (yych == 'f') goto yy1158;
-	goto yy941;
-yy1096:
+	if (yych == 'c') goto yy1256;
+	if (yych == 'f') goto yy1257;
+	goto yy1040;
+yy1195:
 	yych = *++cur;
-	if (yych == 'c') goto yy1159;
-	goto yy941;
-yy1097:
+	if (yych == 'c') goto yy1258;
+	goto yy1040;
+yy1196:
 	yych = *++cur;
-	if (yych == 'o') goto yy1160;
-	goto yy941;
-yy1098:
+	if (yych == 'o') goto yy1259;
+	goto yy1040;
+yy1197:
 	yych = *++cur;
-	if (yych == 't') goto yy1161;
-	goto yy941;
-yy1099:
+	if (yych == 't') goto yy1260;
+	goto yy1040;
+yy1198:
 	yych = *++cur;
-	if (yych == '_') goto yy1162;
-	goto yy941;
-yy1100:
+	if (yych == '_') goto yy1261;
+	goto yy1040;
+yy1199:
 	yych = *++cur;
-	if (yych == 'n') goto yy1163;
-	if (yych == 'x') goto yy1164;
-	goto yy941;
-yy1101:
+	if (yych == 'n') goto yy1262;
+	if (yych == 'x') goto yy1263;
+	goto yy1040;
+yy1200:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 596 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 608 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::INIT); }
-#line 6269 "src/parse/conf_lexer.cc"
-yy1102:
+#line 6473 "src/parse/conf_lexer.cc"
+yy1201:
 	yych = *++cur;
-	if (yych == 't') goto yy1165;
-	goto yy941;
-yy1103:
+	if (yych == 't') goto yy1264;
+	goto yy1040;
+yy1202:
 	yych = *++cur;
-	if (yych == 'l') goto yy1166;
-	goto yy941;
-yy1104:
+	if (yych == 'l') goto yy1265;
+	goto yy1040;
+yy1203:
 	yych = *++cur;
-	if (yych == 't') goto yy1167;
-	goto yy941;
-yy1105:
+	if (yych == 't') goto yy1266;
+	goto yy1040;
+yy1204:
 	yych = *++cur;
-	if (yych == 't') goto yy1168;
-	goto yy941;
-yy1106:
+	if (yych == 't') goto yy1267;
+	goto yy1040;
+yy1205:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 601 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 613 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::LINE); }
-#line 6293 "src/parse/conf_lexer.cc"
-yy1107:
+#line 6495 "src/parse/conf_lexer.cc"
+yy1206:
 	yych = *++cur;
-	if (yych == '_') goto yy1169;
-	goto yy941;
-yy1108:
+	if (yych == '_') goto yy1268;
+	goto yy1040;
+yy1207:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 688 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 700 "../src/parse/conf_lexer.re"
 	{ RET_LOPT(StxLOpt::MANY); }
-#line 6305 "src/parse/conf_lexer.cc"
-yy1109:
+#line 6505 "src/parse/conf_lexer.cc"
+yy1208:
 	yych = *++cur;
-	if (yych == 'e') goto yy1170;
-	goto yy941;
-yy1110:
+	if (yych == 'e') goto yy1269;
+	goto yy1040;
+yy1209:
 	yych = *++cur;
-	if (yych == 'd') goto yy1171;
-	goto yy941;
-yy1111:
+	if (yych == 'd') goto yy1270;
+	goto yy1040;
+yy1210:
 	yych = *++cur;
-	if (yych == 'n') goto yy1172;
-	if (yych == 'p') goto yy1173;
-	goto yy941;
-yy1112:
+	if (yych == 'n') goto yy1271;
+	if (yych == 'p') goto yy1272;
+	goto yy1040;
+yy1211:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 606 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 618 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::NAME); }
-#line 6326 "src/parse/conf_lexer.cc"
-yy1113:
+#line 6524 "src/parse/conf_lexer.cc"
+yy1212:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 608 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 620 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::NEED); }
-#line 6334 "src/parse/conf_lexer.cc"
-yy1114:
+#line 6530 "src/parse/conf_lexer.cc"
+yy1213:
 	yych = *++cur;
-	if (yych == 'e') goto yy1174;
-	goto yy941;
-yy1115:
+	if (yych == 'e') goto yy1273;
+	goto yy1040;
+yy1214:
 	yych = *++cur;
-	if (yych == 'e') goto yy1175;
-	goto yy941;
-yy1116:
+	if (yych == 'e') goto yy1274;
+	goto yy1040;
+yy1215:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 610 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 622 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::PEEK); }
-#line 6350 "src/parse/conf_lexer.cc"
-yy1117:
+#line 6544 "src/parse/conf_lexer.cc"
+yy1216:
 	yych = *++cur;
-	if (yych == 'r') goto yy1176;
-	goto yy941;
-yy1118:
+	if (yych == 'r') goto yy1275;
+	goto yy1040;
+yy1217:
 	yych = *++cur;
-	if (yych == 'o') goto yy1177;
-	goto yy941;
-yy1119:
+	if (yych == 'o') goto yy1276;
+	goto yy1040;
+yy1218:
 	yych = *++cur;
-	if (yych == 'a') goto yy1178;
-	goto yy941;
-yy1120:
+	if (yych == 'a') goto yy1277;
+	goto yy1040;
+yy1219:
 	yych = *++cur;
-	if (yych == 'c') goto yy1179;
-	goto yy941;
-yy1121:
+	if (yych == 'c') goto yy1278;
+	goto yy1040;
+yy1220:
 	yych = *++cur;
-	if (yych == 'o') goto yy1180;
-	goto yy941;
-yy1122:
+	if (yych == 'o') goto yy1279;
+	goto yy1040;
+yy1221:
 	yych = *++cur;
-	if (yych == 't') goto yy1181;
-	goto yy941;
-yy1123:
+	if (yych == 't') goto yy1280;
+	goto yy1040;
+yy1222:
 	yych = *++cur;
-	if (yych == 't') goto yy1182;
-	goto yy941;
-yy1124:
+	if (yych == 't') goto yy1281;
+	goto yy1040;
+yy1223:
 	yych = *++cur;
-	if (yych == 'l') goto yy1183;
-	goto yy941;
-yy1125:
+	if (yych == 'l') goto yy1282;
+	goto yy1040;
+yy1224:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 622 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 634 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::SIZE); }
-#line 6390 "src/parse/conf_lexer.cc"
-yy1126:
+#line 6582 "src/parse/conf_lexer.cc"
+yy1225:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 626 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 638 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::SKIP); }
-#line 6398 "src/parse/conf_lexer.cc"
-yy1127:
+#line 6588 "src/parse/conf_lexer.cc"
+yy1226:
 	yych = *++cur;
-	if (yych == 'n') goto yy1184;
-	if (yych == 'p') goto yy1185;
-	goto yy941;
-yy1128:
+	if (yych == 'n') goto yy1283;
+	if (yych == 'p') goto yy1284;
+	goto yy1040;
+yy1227:
 	yych = *++cur;
-	if (yych == 't') goto yy1186;
-	goto yy941;
-yy1129:
+	if (yych == 't') goto yy1285;
+	goto yy1040;
+yy1228:
 	yych = *++cur;
-	if (yych == 'e') goto yy1187;
-	goto yy941;
-yy1130:
+	if (yych == 'e') goto yy1286;
+	goto yy1040;
+yy1229:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 630 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 642 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::STMT); }
-#line 6419 "src/parse/conf_lexer.cc"
-yy1131:
+#line 6607 "src/parse/conf_lexer.cc"
+yy1230:
 	yych = *++cur;
-	if (yych == 'a') goto yy1188;
-	goto yy941;
-yy1132:
+	if (yych == 'a') goto yy1287;
+	goto yy1040;
+yy1231:
 	yych = *++cur;
-	if (yych == 'n') goto yy1189;
-	goto yy941;
-yy1133:
+	if (yych == 'n') goto yy1288;
+	goto yy1040;
+yy1232:
 	yych = *++cur;
 	if (yych <= '_') {
-		if (yych <= '/') goto yy1134;
-		if (yych <= '9') goto yy940;
-		if (yych >= '_') goto yy940;
+		if (yych <= '/') goto yy1233;
+		if (yych <= '9') goto yy1039;
+		if (yych >= '_') goto yy1039;
 	} else {
 		if (yych <= 'b') {
-			if (yych >= 'a') goto yy940;
+			if (yych >= 'a') goto yy1039;
 		} else {
-			if (yych <= 'c') goto yy1190;
-			if (yych <= 'z') goto yy940;
+			if (yych <= 'c') goto yy1289;
+			if (yych <= 'z') goto yy1039;
 		}
 	}
-yy1134:
-#line 632 "../src/parse/conf_lexer.re"
+yy1233:
+#line 644 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::TYPE); }
-#line 6445 "src/parse/conf_lexer.cc"
-yy1135:
+#line 6633 "src/parse/conf_lexer.cc"
+yy1234:
 	yych = *++cur;
-	if (yych == 'f') goto yy1191;
-	goto yy941;
-yy1136:
+	if (yych == 'f') goto yy1290;
+	goto yy1040;
+yy1235:
 	yych = *++cur;
-	if (yych == 'i') goto yy1192;
-	goto yy941;
-yy1137:
+	if (yych == 'i') goto yy1291;
+	goto yy1040;
+yy1236:
 	yych = *++cur;
-	if (yych == 'e') goto yy1193;
-	goto yy964;
-yy1138:
+	if (yych == 'e') goto yy1292;
+	goto yy1063;
+yy1237:
 	yych = *++cur;
-	if (yych == 'o') goto yy1194;
-	goto yy964;
-yy1139:
+	if (yych == 'o') goto yy1293;
+	goto yy1063;
+yy1238:
 	yych = *++cur;
-	if (yych == 'e') goto yy1195;
-	goto yy964;
-yy1140:
+	if (yych == 'e') goto yy1294;
+	goto yy1063;
+yy1239:
 	yych = *++cur;
-	if (yych == 't') goto yy1196;
-	goto yy941;
-yy1141:
+	if (yych == 't') goto yy1295;
+	goto yy1040;
+yy1240:
 	yych = *++cur;
-	if (yych == 'm') goto yy1197;
-	goto yy941;
-yy1142:
+	if (yych == 'm') goto yy1296;
+	goto yy1040;
+yy1241:
 	yych = *++cur;
-	if (yych == 'p') goto yy1198;
-	goto yy941;
-yy1143:
+	if (yych == 'p') goto yy1297;
+	goto yy1040;
+yy1242:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 572 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 584 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::ARRAY); }
-#line 6485 "src/parse/conf_lexer.cc"
-yy1144:
+#line 6671 "src/parse/conf_lexer.cc"
+yy1243:
 	yych = *++cur;
-	if (yych == 'p') goto yy1199;
-	goto yy941;
-yy1145:
+	if (yych == 'p') goto yy1298;
+	goto yy1040;
+yy1244:
 	yych = *++cur;
-	if (yych == 'h') goto yy1201;
-	goto yy941;
-yy1146:
+	if (yych == 'h') goto yy1300;
+	goto yy1040;
+yy1245:
 	yych = *++cur;
-	if (yych == 'r') goto yy1202;
-	goto yy941;
-yy1147:
+	if (yych == 'r') goto yy1301;
+	goto yy1040;
+yy1246:
 	yych = *++cur;
-	if (yych == 'l') goto yy1203;
-	goto yy941;
-yy1148:
+	if (yych == 'l') goto yy1302;
+	goto yy1040;
+yy1247:
 	yych = *++cur;
 	if (yych <= 'h') {
 		if (yych <= 'a') {
 			if (yych <= '^') {
-				if (yych <= '/') goto yy964;
-				if (yych <= '9') goto yy1204;
-				goto yy964;
+				if (yych <= '/') goto yy1063;
+				if (yych <= '9') goto yy1303;
+				goto yy1063;
 			} else {
-				if (yych <= '_') goto yy1204;
-				if (yych <= '`') goto yy964;
-				goto yy1207;
+				if (yych <= '_') goto yy1303;
+				if (yych <= '`') goto yy1063;
+				goto yy1306;
 			}
 		} else {
 			if (yych <= 'd') {
-				if (yych == 'c') goto yy1208;
-				goto yy1204;
+				if (yych == 'c') goto yy1307;
+				goto yy1303;
 			} else {
-				if (yych <= 'e') goto yy1209;
-				if (yych <= 'f') goto yy1210;
-				if (yych <= 'g') goto yy1211;
-				goto yy1204;
+				if (yych <= 'e') goto yy1308;
+				if (yych <= 'f') goto yy1309;
+				if (yych <= 'g') goto yy1310;
+				goto yy1303;
 			}
 		}
 	} else {
 		if (yych <= 's') {
 			if (yych <= 'l') {
-				if (yych <= 'i') goto yy1212;
-				if (yych <= 'k') goto yy1204;
-				goto yy1213;
+				if (yych <= 'i') goto yy1311;
+				if (yych <= 'k') goto yy1303;
+				goto yy1312;
 			} else {
-				if (yych <= 'q') goto yy1204;
-				if (yych <= 'r') goto yy1214;
-				goto yy1215;
+				if (yych <= 'q') goto yy1303;
+				if (yych <= 'r') goto yy1313;
+				goto yy1314;
 			}
 		} else {
 			if (yych <= 'v') {
-				if (yych <= 't') goto yy1216;
-				if (yych <= 'u') goto yy1204;
-				goto yy1217;
+				if (yych <= 't') goto yy1315;
+				if (yych <= 'u') goto yy1303;
+				goto yy1316;
 			} else {
-				if (yych == 'y') goto yy1218;
-				if (yych <= 'z') goto yy1204;
-				goto yy964;
+				if (yych == 'y') goto yy1317;
+				if (yych <= 'z') goto yy1303;
+				goto yy1063;
 			}
 		}
 	}
-yy1149:
+yy1248:
 	yych = *++cur;
-	if (yych == 'm') goto yy1219;
-	goto yy941;
-yy1150:
+	if (yych == 'm') goto yy1318;
+	goto yy1040;
+yy1249:
 	yych = *++cur;
-	if (yych == 't') goto yy1220;
-	goto yy941;
-yy1151:
+	if (yych == 't') goto yy1319;
+	goto yy1040;
+yy1250:
 	yych = *++cur;
-	if (yych == 't') goto yy1221;
-	goto yy941;
-yy1152:
+	if (yych == 't') goto yy1320;
+	goto yy1040;
+yy1251:
 	yych = *++cur;
-	if (yych == 'r') goto yy1222;
-	goto yy941;
-yy1153:
+	if (yych == 'r') goto yy1321;
+	goto yy1040;
+yy1252:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 581 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 593 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::CTYPE); }
-#line 6572 "src/parse/conf_lexer.cc"
-yy1154:
+#line 6756 "src/parse/conf_lexer.cc"
+yy1253:
 	yych = *++cur;
-	if (yych == 'r') goto yy1223;
-	goto yy941;
-yy1155:
+	if (yych == 'r') goto yy1322;
+	goto yy1040;
+yy1254:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 585 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 597 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::DEBUG); }
-#line 6584 "src/parse/conf_lexer.cc"
-yy1156:
+#line 6766 "src/parse/conf_lexer.cc"
+yy1255:
 	yych = *++cur;
-	if (yych == 't') goto yy1224;
-	goto yy941;
-yy1157:
+	if (yych == 't') goto yy1323;
+	goto yy1040;
+yy1256:
 	yych = *++cur;
-	if (yych == 'l') goto yy1225;
-	goto yy941;
-yy1158:
+	if (yych == 'l') goto yy1324;
+	goto yy1040;
+yy1257:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 591 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 603 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::FNDEF); }
-#line 6600 "src/parse/conf_lexer.cc"
-yy1159:
+#line 6780 "src/parse/conf_lexer.cc"
+yy1258:
 	yych = *++cur;
-	if (yych == 'c') goto yy1226;
-	goto yy941;
-yy1160:
+	if (yych == 'c') goto yy1325;
+	goto yy1040;
+yy1259:
 	yych = *++cur;
-	if (yych == 'n') goto yy1227;
-	goto yy941;
-yy1161:
+	if (yych == 'n') goto yy1326;
+	goto yy1040;
+yy1260:
 	yych = *++cur;
-	if (yych == 'a') goto yy1228;
-	goto yy941;
-yy1162:
+	if (yych == 'a') goto yy1327;
+	goto yy1040;
+yy1261:
 	yych = *++cur;
 	switch (yych) {
-		case 'a': goto yy1229;
-		case 'c': goto yy1230;
-		case 'd': goto yy1231;
-		case 'i': goto yy1232;
-		case 'r': goto yy1233;
-		case 't': goto yy1234;
-		case 'v': goto yy1235;
-		default: goto yy941;
+		case 'a': goto yy1328;
+		case 'c': goto yy1329;
+		case 'd': goto yy1330;
+		case 'i': goto yy1331;
+		case 'r': goto yy1332;
+		case 't': goto yy1333;
+		case 'v': goto yy1334;
+		default: goto yy1040;
 	}
-yy1163:
+yy1262:
 	yych = *++cur;
-	if (yych == 't') goto yy1236;
-	goto yy941;
-yy1164:
+	if (yych == 't') goto yy1335;
+	goto yy1040;
+yy1263:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 595 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 607 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::INDEX); }
-#line 6636 "src/parse/conf_lexer.cc"
-yy1165:
+#line 6814 "src/parse/conf_lexer.cc"
+yy1264:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 597 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 609 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::INPUT); }
-#line 6644 "src/parse/conf_lexer.cc"
-yy1166:
+#line 6820 "src/parse/conf_lexer.cc"
+yy1265:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 598 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 610 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::LABEL); }
-#line 6652 "src/parse/conf_lexer.cc"
-yy1167:
+#line 6826 "src/parse/conf_lexer.cc"
+yy1266:
 	yych = *++cur;
-	if (yych == 'h') goto yy1237;
-	goto yy941;
-yy1168:
+	if (yych == 'h') goto yy1336;
+	goto yy1040;
+yy1267:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 602 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 614 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::LIMIT); }
-#line 6664 "src/parse/conf_lexer.cc"
-yy1169:
+#line 6836 "src/parse/conf_lexer.cc"
+yy1268:
 	yych = *++cur;
-	if (yych == 'l') goto yy1238;
-	goto yy941;
-yy1170:
+	if (yych == 'l') goto yy1337;
+	goto yy1040;
+yy1269:
 	yych = *++cur;
-	if (yych == 'r') goto yy1239;
-	goto yy941;
-yy1171:
+	if (yych == 'r') goto yy1338;
+	goto yy1040;
+yy1270:
 	yych = *++cur;
-	if (yych == 'i') goto yy1240;
-	goto yy941;
-yy1172:
+	if (yych == 'i') goto yy1339;
+	goto yy1040;
+yy1271:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 604 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 616 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::MTAGN); }
-#line 6684 "src/parse/conf_lexer.cc"
-yy1173:
+#line 6854 "src/parse/conf_lexer.cc"
+yy1272:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 605 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 617 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::MTAGP); }
-#line 6692 "src/parse/conf_lexer.cc"
-yy1174:
+#line 6860 "src/parse/conf_lexer.cc"
+yy1273:
 	yych = *++cur;
-	if (yych == 'd') goto yy1241;
-	goto yy941;
-yy1175:
+	if (yych == 'd') goto yy1340;
+	goto yy1040;
+yy1274:
 	yych = *++cur;
-	if (yych == 't') goto yy1242;
-	goto yy941;
-yy1176:
+	if (yych == 't') goto yy1341;
+	goto yy1040;
+yy1275:
 	yych = *++cur;
-	if (yych == 'd') goto yy1243;
-	goto yy941;
-yy1177:
+	if (yych == 'd') goto yy1342;
+	goto yy1040;
+yy1276:
 	yych = *++cur;
-	if (yych == 'r') goto yy1244;
-	goto yy941;
-yy1178:
+	if (yych == 'r') goto yy1343;
+	goto yy1040;
+yy1277:
 	yych = *++cur;
-	if (yych == 'l') goto yy1245;
-	goto yy941;
-yy1179:
+	if (yych == 'l') goto yy1344;
+	goto yy1040;
+yy1278:
 	yych = *++cur;
-	if (yych == 'c') goto yy1246;
-	goto yy941;
-yy1180:
+	if (yych == 'c') goto yy1345;
+	goto yy1040;
+yy1279:
 	yych = *++cur;
-	if (yych == 'n') goto yy1247;
-	goto yy941;
-yy1181:
+	if (yych == 'n') goto yy1346;
+	goto yy1040;
+yy1280:
 	yych = *++cur;
-	if (yych == 'a') goto yy1248;
-	goto yy941;
-yy1182:
+	if (yych == 'a') goto yy1347;
+	goto yy1040;
+yy1281:
 	yych = *++cur;
 	if (yych <= '`') {
 		if (yych <= '9') {
-			if (yych >= '0') goto yy940;
+			if (yych >= '0') goto yy1039;
 		} else {
-			if (yych == '_') goto yy940;
+			if (yych == '_') goto yy1039;
 		}
 	} else {
 		if (yych <= 'r') {
-			if (yych == 'm') goto yy1249;
-			goto yy940;
+			if (yych == 'm') goto yy1348;
+			goto yy1039;
 		} else {
-			if (yych <= 's') goto yy1250;
-			if (yych <= 'z') goto yy940;
+			if (yych <= 's') goto yy1349;
+			if (yych <= 'z') goto yy1039;
 		}
 	}
-#line 623 "../src/parse/conf_lexer.re"
+#line 635 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::SHIFT); }
-#line 6744 "src/parse/conf_lexer.cc"
-yy1183:
+#line 6912 "src/parse/conf_lexer.cc"
+yy1282:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 621 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 633 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::SIGIL); }
-#line 6752 "src/parse/conf_lexer.cc"
-yy1184:
+#line 6918 "src/parse/conf_lexer.cc"
+yy1283:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 627 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 639 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::STAGN); }
-#line 6760 "src/parse/conf_lexer.cc"
-yy1185:
+#line 6924 "src/parse/conf_lexer.cc"
+yy1284:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 628 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 640 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::STAGP); }
-#line 6768 "src/parse/conf_lexer.cc"
-yy1186:
+#line 6930 "src/parse/conf_lexer.cc"
+yy1285:
 	yych = *++cur;
-	if (yych == '_') goto yy1251;
-	goto yy941;
-yy1187:
+	if (yych == '_') goto yy1350;
+	goto yy1040;
+yy1286:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 629 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 641 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::STATE); }
-#line 6780 "src/parse/conf_lexer.cc"
-yy1188:
+#line 6940 "src/parse/conf_lexer.cc"
+yy1287:
 	yych = *++cur;
-	if (yych == 'b') goto yy1252;
-	goto yy941;
-yy1189:
+	if (yych == 'b') goto yy1351;
+	goto yy1040;
+yy1288:
 	yych = *++cur;
-	if (yych == 'd') goto yy1253;
-	goto yy941;
-yy1190:
+	if (yych == 'd') goto yy1352;
+	goto yy1040;
+yy1289:
 	yych = *++cur;
-	if (yych == 'a') goto yy1254;
-	goto yy941;
-yy1191:
+	if (yych == 'a') goto yy1353;
+	goto yy1040;
+yy1290:
 	yych = *++cur;
-	if (yych == 'e') goto yy1255;
-	goto yy941;
-yy1192:
+	if (yych == 'e') goto yy1354;
+	goto yy1040;
+yy1291:
 	yych = *++cur;
-	if (yych == 'o') goto yy1256;
-	goto yy941;
-yy1193:
+	if (yych == 'o') goto yy1355;
+	goto yy1040;
+yy1292:
 	yych = *++cur;
-	if (yych == 'n') goto yy1257;
-	goto yy964;
-yy1194:
+	if (yych == 'n') goto yy1356;
+	goto yy1063;
+yy1293:
 	yych = *++cur;
-	if (yych == 'i') goto yy1258;
-	goto yy964;
-yy1195:
+	if (yych == 'i') goto yy1357;
+	goto yy1063;
+yy1294:
 	yych = *++cur;
-	if (yych == 'c') goto yy1259;
-	goto yy964;
-yy1196:
+	if (yych == 'c') goto yy1358;
+	goto yy1063;
+yy1295:
 	yych = *++cur;
-	if (yych == 'y') goto yy1260;
-	goto yy941;
-yy1197:
+	if (yych == 'y') goto yy1359;
+	goto yy1040;
+yy1296:
 	yych = *++cur;
-	if (yych == 'e') goto yy1261;
-	goto yy941;
-yy1198:
+	if (yych == 'e') goto yy1360;
+	goto yy1040;
+yy1297:
 	yych = *++cur;
-	if (yych == 'e') goto yy1262;
-	goto yy941;
-yy1199:
+	if (yych == 'e') goto yy1361;
+	goto yy1040;
+yy1298:
 	yych = *++cur;
 	if (yych <= '_') {
-		if (yych <= '/') goto yy1200;
-		if (yych <= '9') goto yy940;
-		if (yych >= '_') goto yy940;
+		if (yych <= '/') goto yy1299;
+		if (yych <= '9') goto yy1039;
+		if (yych >= '_') goto yy1039;
 	} else {
 		if (yych <= 'b') {
-			if (yych >= 'a') goto yy940;
+			if (yych >= 'a') goto yy1039;
 		} else {
-			if (yych <= 'c') goto yy1263;
-			if (yych <= 'z') goto yy940;
+			if (yych <= 'c') goto yy1362;
+			if (yych <= 'z') goto yy1039;
 		}
 	}
-yy1200:
-#line 573 "../src/parse/conf_lexer.re"
+yy1299:
+#line 585 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::BACKUP); }
-#line 6842 "src/parse/conf_lexer.cc"
-yy1201:
+#line 7002 "src/parse/conf_lexer.cc"
+yy1300:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 575 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 587 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::BRANCH); }
-#line 6850 "src/parse/conf_lexer.cc"
-yy1202:
+#line 7008 "src/parse/conf_lexer.cc"
+yy1301:
 	yych = *++cur;
-	if (yych == 'a') goto yy1264;
-	goto yy941;
-yy1203:
+	if (yych == 'a') goto yy1363;
+	goto yy1040;
+yy1302:
 	yych = *++cur;
-	if (yych == 'i') goto yy1265;
-	goto yy941;
-yy1204:
+	if (yych == 'i') goto yy1364;
+	goto yy1040;
+yy1303:
 	++cur;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
-yy1205:
+yy1304:
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1206;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1305;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1206;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1305;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1206:
-#line 564 "../src/parse/conf_lexer.re"
+yy1305:
+#line 576 "../src/parse/conf_lexer.re"
 	{
         RET_FAIL(error_at_tok("unknown configuration: '%.*s'", int(cur - tok), tok));
     }
-#line 6876 "src/parse/conf_lexer.cc"
-yy1207:
+#line 7034 "src/parse/conf_lexer.cc"
+yy1306:
 	yych = *++cur;
 	if (yych <= 'q') {
-		if (yych == 'b') goto yy1266;
-		goto yy1205;
+		if (yych == 'b') goto yy1365;
+		goto yy1304;
 	} else {
-		if (yych <= 'r') goto yy1267;
-		if (yych <= 's') goto yy1268;
-		goto yy1205;
+		if (yych <= 'r') goto yy1366;
+		if (yych <= 's') goto yy1367;
+		goto yy1304;
 	}
-yy1208:
+yy1307:
 	yych = *++cur;
-	if (yych == 'o') goto yy1269;
-	goto yy1205;
-yy1209:
+	if (yych == 'h') goto yy1368;
+	if (yych == 'o') goto yy1369;
+	goto yy1304;
+yy1308:
 	yych = *++cur;
-	if (yych == 'n') goto yy1270;
-	goto yy1205;
-yy1210:
+	if (yych == 'n') goto yy1370;
+	goto yy1304;
+yy1309:
 	yych = *++cur;
-	if (yych == 'i') goto yy1271;
-	if (yych == 'n') goto yy1272;
-	goto yy1205;
-yy1211:
+	if (yych == 'i') goto yy1371;
+	if (yych == 'n') goto yy1372;
+	goto yy1304;
+yy1310:
 	yych = *++cur;
-	if (yych == 'o') goto yy1273;
-	goto yy1205;
-yy1212:
+	if (yych == 'o') goto yy1373;
+	goto yy1304;
+yy1311:
 	yych = *++cur;
-	if (yych == 'f') goto yy1274;
-	goto yy1205;
-yy1213:
+	if (yych == 'f') goto yy1374;
+	goto yy1304;
+yy1312:
 	yych = *++cur;
-	if (yych == 'i') goto yy1275;
-	if (yych == 'o') goto yy1276;
-	goto yy1205;
-yy1214:
+	if (yych == 'i') goto yy1375;
+	if (yych == 'o') goto yy1376;
+	goto yy1304;
+yy1313:
 	yych = *++cur;
-	if (yych == 'e') goto yy1277;
-	goto yy1205;
-yy1215:
+	if (yych == 'e') goto yy1377;
+	goto yy1304;
+yy1314:
 	yych = *++cur;
-	if (yych == 'w') goto yy1278;
-	goto yy1205;
-yy1216:
+	if (yych == 'w') goto yy1378;
+	goto yy1304;
+yy1315:
 	yych = *++cur;
-	if (yych == 'a') goto yy1279;
-	if (yych == 'y') goto yy1280;
-	goto yy1205;
-yy1217:
+	if (yych == 'a') goto yy1379;
+	if (yych == 'y') goto yy1380;
+	goto yy1304;
+yy1316:
 	yych = *++cur;
-	if (yych == 'a') goto yy1281;
-	goto yy1205;
-yy1218:
+	if (yych == 'a') goto yy1381;
+	goto yy1304;
+yy1317:
 	yych = *++cur;
-	if (yych == 'y') goto yy1282;
-	goto yy1205;
-yy1219:
+	if (yych == 'y') goto yy1382;
+	goto yy1304;
+yy1318:
 	yych = *++cur;
-	if (yych == 'o') goto yy1283;
-	goto yy941;
-yy1220:
+	if (yych == 'o') goto yy1383;
+	goto yy1040;
+yy1319:
 	yych = *++cur;
-	if (yych == 'a') goto yy1284;
-	goto yy941;
-yy1221:
+	if (yych == 'a') goto yy1384;
+	goto yy1040;
+yy1320:
 	yych = *++cur;
-	if (yych == 'a') goto yy1285;
-	goto yy941;
-yy1222:
+	if (yych == 'a') goto yy1385;
+	goto yy1040;
+yy1321:
 	yych = *++cur;
-	if (yych == 'k') goto yy1286;
-	goto yy941;
-yy1223:
+	if (yych == 'k') goto yy1386;
+	goto yy1040;
+yy1322:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 583 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 595 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::CURSOR); }
-#line 6957 "src/parse/conf_lexer.cc"
-yy1224:
+#line 7114 "src/parse/conf_lexer.cc"
+yy1323:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 641 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 653 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::DEDENT); }
-#line 6965 "src/parse/conf_lexer.cc"
-yy1225:
+#line 7120 "src/parse/conf_lexer.cc"
+yy1324:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 590 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 602 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::FNDECL); }
-#line 6973 "src/parse/conf_lexer.cc"
-yy1226:
+#line 7126 "src/parse/conf_lexer.cc"
+yy1325:
 	yych = *++cur;
-	if (yych == 'e') goto yy1287;
-	goto yy941;
-yy1227:
+	if (yych == 'e') goto yy1387;
+	goto yy1040;
+yy1326:
 	yych = *++cur;
-	if (yych == 'd') goto yy1288;
-	goto yy941;
-yy1228:
+	if (yych == 'd') goto yy1388;
+	goto yy1040;
+yy1327:
 	yych = *++cur;
-	if (yych == 't') goto yy1289;
-	goto yy941;
-yy1229:
+	if (yych == 't') goto yy1389;
+	goto yy1040;
+yy1328:
 	yych = *++cur;
-	if (yych == 'r') goto yy1290;
-	goto yy941;
-yy1230:
+	if (yych == 'r') goto yy1390;
+	goto yy1040;
+yy1329:
 	yych = *++cur;
-	if (yych == 'o') goto yy1291;
-	goto yy941;
-yy1231:
+	if (yych == 'o') goto yy1391;
+	goto yy1040;
+yy1330:
 	yych = *++cur;
-	if (yych == 'a') goto yy1292;
-	goto yy941;
-yy1232:
+	if (yych == 'a') goto yy1392;
+	goto yy1040;
+yy1331:
 	yych = *++cur;
-	if (yych == 'n') goto yy1293;
-	goto yy941;
-yy1233:
+	if (yych == 'n') goto yy1393;
+	goto yy1040;
+yy1332:
 	yych = *++cur;
-	if (yych == 'e') goto yy1294;
-	goto yy941;
-yy1234:
+	if (yych == 'e') goto yy1394;
+	goto yy1040;
+yy1333:
 	yych = *++cur;
-	if (yych == 'y') goto yy1295;
-	goto yy941;
-yy1235:
+	if (yych == 'y') goto yy1395;
+	goto yy1040;
+yy1334:
 	yych = *++cur;
-	if (yych == 'e') goto yy1296;
-	goto yy941;
-yy1236:
+	if (yych == 'e') goto yy1396;
+	goto yy1040;
+yy1335:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 640 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 652 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::INDENT); }
-#line 7021 "src/parse/conf_lexer.cc"
-yy1237:
+#line 7172 "src/parse/conf_lexer.cc"
+yy1336:
 	yych = *++cur;
-	if (yych == 'a') goto yy1297;
-	goto yy941;
-yy1238:
+	if (yych == 'a') goto yy1397;
+	goto yy1040;
+yy1337:
 	yych = *++cur;
-	if (yych == 'a') goto yy1298;
-	goto yy941;
-yy1239:
+	if (yych == 'a') goto yy1398;
+	goto yy1040;
+yy1338:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 603 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 615 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::MARKER); }
-#line 7037 "src/parse/conf_lexer.cc"
-yy1240:
+#line 7186 "src/parse/conf_lexer.cc"
+yy1339:
 	yych = *++cur;
-	if (yych == 'c') goto yy1299;
-	goto yy941;
-yy1241:
+	if (yych == 'c') goto yy1399;
+	goto yy1040;
+yy1340:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 689 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 701 "../src/parse/conf_lexer.re"
 	{ RET_LOPT(StxLOpt::NESTED); }
-#line 7049 "src/parse/conf_lexer.cc"
-yy1242:
+#line 7196 "src/parse/conf_lexer.cc"
+yy1341:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 609 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 621 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::OFFSET); }
-#line 7057 "src/parse/conf_lexer.cc"
-yy1243:
+#line 7202 "src/parse/conf_lexer.cc"
+yy1342:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 611 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 623 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::RECORD); }
-#line 7065 "src/parse/conf_lexer.cc"
-yy1244:
+#line 7208 "src/parse/conf_lexer.cc"
+yy1343:
 	yych = *++cur;
-	if (yych == 'e') goto yy1300;
-	goto yy941;
-yy1245:
+	if (yych == 'e') goto yy1400;
+	goto yy1040;
+yy1344:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 615 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 627 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::RETVAL); }
-#line 7077 "src/parse/conf_lexer.cc"
-yy1246:
+#line 7218 "src/parse/conf_lexer.cc"
+yy1345:
 	yych = *++cur;
-	if (yych == 'e') goto yy1301;
-	goto yy941;
-yy1247:
+	if (yych == 'e') goto yy1401;
+	goto yy1040;
+yy1346:
 	yych = *++cur;
-	if (yych == 'd') goto yy1302;
-	goto yy941;
-yy1248:
+	if (yych == 'd') goto yy1402;
+	goto yy1040;
+yy1347:
 	yych = *++cur;
-	if (yych == 't') goto yy1303;
-	goto yy941;
-yy1249:
+	if (yych == 't') goto yy1403;
+	goto yy1040;
+yy1348:
 	yych = *++cur;
-	if (yych == 't') goto yy1304;
-	goto yy941;
-yy1250:
+	if (yych == 't') goto yy1404;
+	goto yy1040;
+yy1349:
 	yych = *++cur;
-	if (yych == 't') goto yy1305;
-	goto yy941;
-yy1251:
+	if (yych == 't') goto yy1405;
+	goto yy1040;
+yy1350:
 	yych = *++cur;
-	if (yych == 'c') goto yy1306;
-	goto yy941;
-yy1252:
+	if (yych == 'c') goto yy1406;
+	goto yy1040;
+yy1351:
 	yych = *++cur;
-	if (yych == 'l') goto yy1307;
-	goto yy941;
-yy1253:
+	if (yych == 'l') goto yy1407;
+	goto yy1040;
+yy1352:
 	yych = *++cur;
-	if (yych == 'e') goto yy1308;
-	goto yy941;
-yy1254:
+	if (yych == 'e') goto yy1408;
+	goto yy1040;
+yy1353:
 	yych = *++cur;
-	if (yych == 's') goto yy1309;
-	goto yy941;
-yy1255:
+	if (yych == 's') goto yy1409;
+	goto yy1040;
+yy1354:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 674 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 686 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::UNSAFE); }
-#line 7121 "src/parse/conf_lexer.cc"
-yy1256:
+#line 7260 "src/parse/conf_lexer.cc"
+yy1355:
 	yych = *++cur;
-	if (yych == 'n') goto yy1310;
-	goto yy941;
-yy1257:
+	if (yych == 'n') goto yy1410;
+	goto yy1040;
+yy1356:
 	yych = *++cur;
-	if (yych == 'e') goto yy1311;
-	goto yy964;
-yy1258:
+	if (yych == 'e') goto yy1411;
+	goto yy1063;
+yy1357:
 	yych = *++cur;
-	if (yych == 'n') goto yy1312;
-	goto yy964;
-yy1259:
+	if (yych == 'n') goto yy1412;
+	goto yy1063;
+yy1358:
 	yych = *++cur;
-	if (yych == 'o') goto yy1313;
-	goto yy964;
-yy1260:
+	if (yych == 'o') goto yy1413;
+	goto yy1063;
+yy1359:
 	yych = *++cur;
-	if (yych == 'l') goto yy1314;
-	goto yy941;
-yy1261:
+	if (yych == 'l') goto yy1414;
+	goto yy1040;
+yy1360:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 570 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 582 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::ARGNAME); }
-#line 7149 "src/parse/conf_lexer.cc"
-yy1262:
+#line 7286 "src/parse/conf_lexer.cc"
+yy1361:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 571 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 583 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::ARGTYPE); }
-#line 7157 "src/parse/conf_lexer.cc"
-yy1263:
+#line 7292 "src/parse/conf_lexer.cc"
+yy1362:
 	yych = *++cur;
-	if (yych == 't') goto yy1315;
-	goto yy941;
-yy1264:
+	if (yych == 't') goto yy1415;
+	goto yy1040;
+yy1363:
 	yych = *++cur;
-	if (yych == 'n') goto yy1316;
-	goto yy941;
-yy1265:
+	if (yych == 'n') goto yy1416;
+	goto yy1040;
+yy1364:
 	yych = *++cur;
-	if (yych == 't') goto yy1317;
-	goto yy941;
-yy1266:
+	if (yych == 't') goto yy1417;
+	goto yy1040;
+yy1365:
 	yych = *++cur;
-	if (yych == 'o') goto yy1318;
-	goto yy1205;
-yy1267:
+	if (yych == 'o') goto yy1418;
+	goto yy1304;
+yy1366:
 	yych = *++cur;
-	if (yych == 'r') goto yy1319;
-	goto yy1205;
-yy1268:
+	if (yych == 'r') goto yy1419;
+	goto yy1304;
+yy1367:
 	yych = *++cur;
-	if (yych == 's') goto yy1320;
-	goto yy1205;
-yy1269:
+	if (yych == 's') goto yy1420;
+	goto yy1304;
+yy1368:
 	yych = *++cur;
-	if (yych == 'n') goto yy1321;
-	goto yy1205;
-yy1270:
+	if (yych == 'a') goto yy1421;
+	goto yy1304;
+yy1369:
 	yych = *++cur;
-	if (yych == 'u') goto yy1322;
-	goto yy1205;
-yy1271:
+	if (yych == 'n') goto yy1422;
+	goto yy1304;
+yy1370:
 	yych = *++cur;
-	if (yych == 'n') goto yy1323;
-	goto yy1205;
-yy1272:
+	if (yych == 'u') goto yy1423;
+	goto yy1304;
+yy1371:
 	yych = *++cur;
-	if (yych <= 'b') goto yy1205;
-	if (yych <= 'c') goto yy1324;
-	if (yych <= 'd') goto yy1325;
-	goto yy1205;
-yy1273:
+	if (yych == 'n') goto yy1424;
+	goto yy1304;
+yy1372:
 	yych = *++cur;
-	if (yych == 't') goto yy1326;
-	goto yy1205;
-yy1274:
+	if (yych <= 'b') goto yy1304;
+	if (yych <= 'c') goto yy1425;
+	if (yych <= 'd') goto yy1426;
+	goto yy1304;
+yy1373:
 	yych = *++cur;
-	if (yych == '_') goto yy1327;
-	goto yy1205;
-yy1275:
+	if (yych == 't') goto yy1427;
+	goto yy1304;
+yy1374:
 	yych = *++cur;
-	if (yych == 'n') goto yy1328;
-	goto yy1205;
-yy1276:
+	if (yych == '_') goto yy1428;
+	goto yy1304;
+yy1375:
 	yych = *++cur;
-	if (yych == 'o') goto yy1329;
-	goto yy1205;
-yy1277:
+	if (yych == 'n') goto yy1429;
+	goto yy1304;
+yy1376:
 	yych = *++cur;
-	if (yych == 'c') goto yy1330;
-	goto yy1205;
-yy1278:
+	if (yych == 'o') goto yy1430;
+	goto yy1304;
+yy1377:
 	yych = *++cur;
-	if (yych == 'i') goto yy1331;
-	goto yy1205;
-yy1279:
+	if (yych == 'c') goto yy1431;
+	goto yy1304;
+yy1378:
 	yych = *++cur;
-	if (yych == 'i') goto yy1332;
-	goto yy1205;
-yy1280:
+	if (yych == 'i') goto yy1432;
+	goto yy1304;
+yy1379:
 	yych = *++cur;
-	if (yych == 'p') goto yy1333;
-	goto yy1205;
-yy1281:
+	if (yych == 'i') goto yy1433;
+	goto yy1304;
+yy1380:
 	yych = *++cur;
-	if (yych == 'r') goto yy1334;
-	goto yy1205;
-yy1282:
+	if (yych == 'p') goto yy1434;
+	goto yy1304;
+yy1381:
+	yych = *++cur;
+	if (yych == 'r') goto yy1435;
+	goto yy1304;
+yy1382:
 	yych = *++cur;
 	switch (yych) {
-		case 'b': goto yy1335;
-		case 'c': goto yy1336;
-		case 'd': goto yy1337;
-		case 'g': goto yy1338;
-		case 'l': goto yy1339;
-		case 'm': goto yy1340;
-		case 'p': goto yy1341;
-		case 'r': goto yy1342;
-		case 's': goto yy1343;
-		default: goto yy1205;
+		case 'b': goto yy1436;
+		case 'c': goto yy1437;
+		case 'd': goto yy1438;
+		case 'g': goto yy1439;
+		case 'l': goto yy1440;
+		case 'm': goto yy1441;
+		case 'p': goto yy1442;
+		case 'r': goto yy1443;
+		case 's': goto yy1444;
+		default: goto yy1304;
 	}
-yy1283:
+yy1383:
 	yych = *++cur;
-	if (yych == 'd') goto yy1344;
-	goto yy941;
-yy1284:
+	if (yych == 'd') goto yy1445;
+	goto yy1040;
+yy1384:
 	yych = *++cur;
-	if (yych == 'g') goto yy1345;
-	goto yy941;
-yy1285:
+	if (yych == 'g') goto yy1446;
+	goto yy1040;
+yy1385:
 	yych = *++cur;
-	if (yych == 'g') goto yy1346;
-	goto yy941;
-yy1286:
+	if (yych == 'g') goto yy1447;
+	goto yy1040;
+yy1386:
 	yych = *++cur;
-	if (yych == 'e') goto yy1347;
-	goto yy941;
-yy1287:
+	if (yych == 'e') goto yy1448;
+	goto yy1040;
+yy1387:
 	yych = *++cur;
-	if (yych == 'p') goto yy1348;
-	goto yy941;
-yy1288:
+	if (yych == 'p') goto yy1449;
+	goto yy1040;
+yy1388:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 593 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 605 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::GETCOND); }
-#line 7277 "src/parse/conf_lexer.cc"
-yy1289:
+#line 7414 "src/parse/conf_lexer.cc"
+yy1389:
 	yych = *++cur;
-	if (yych == 'e') goto yy1349;
-	goto yy941;
-yy1290:
+	if (yych == 'e') goto yy1450;
+	goto yy1040;
+yy1390:
 	yych = *++cur;
-	if (yych == 'g') goto yy1350;
-	goto yy941;
-yy1291:
+	if (yych == 'g') goto yy1451;
+	goto yy1040;
+yy1391:
 	yych = *++cur;
-	if (yych == 'n') goto yy1351;
-	goto yy941;
-yy1292:
+	if (yych == 'n') goto yy1452;
+	goto yy1040;
+yy1392:
 	yych = *++cur;
-	if (yych == 't') goto yy1352;
-	goto yy941;
-yy1293:
+	if (yych == 't') goto yy1453;
+	goto yy1040;
+yy1393:
 	yych = *++cur;
-	if (yych == 'i') goto yy1353;
-	goto yy941;
-yy1294:
+	if (yych == 'i') goto yy1454;
+	goto yy1040;
+yy1394:
 	yych = *++cur;
-	if (yych == 't') goto yy1354;
-	goto yy941;
-yy1295:
+	if (yych == 't') goto yy1455;
+	goto yy1040;
+yy1395:
 	yych = *++cur;
-	if (yych == 'p') goto yy1355;
-	goto yy941;
-yy1296:
+	if (yych == 'p') goto yy1456;
+	goto yy1040;
+yy1396:
 	yych = *++cur;
-	if (yych == 'r') goto yy1356;
-	goto yy941;
-yy1297:
+	if (yych == 'r') goto yy1457;
+	goto yy1040;
+yy1397:
 	yych = *++cur;
-	if (yych == 'n') goto yy1357;
-	goto yy941;
-yy1298:
+	if (yych == 'n') goto yy1458;
+	goto yy1040;
+yy1398:
 	yych = *++cur;
-	if (yych == 'b') goto yy1358;
-	goto yy941;
-yy1299:
+	if (yych == 'b') goto yy1459;
+	goto yy1040;
+yy1399:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 675 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 687 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::MONADIC); }
-#line 7325 "src/parse/conf_lexer.cc"
-yy1300:
+#line 7460 "src/parse/conf_lexer.cc"
+yy1400:
 	yych = *++cur;
 	if (yych <= '`') {
 		if (yych <= '9') {
-			if (yych >= '0') goto yy940;
+			if (yych >= '0') goto yy1039;
 		} else {
-			if (yych == '_') goto yy940;
+			if (yych == '_') goto yy1039;
 		}
 	} else {
 		if (yych <= 's') {
-			if (yych == 'c') goto yy1359;
-			goto yy940;
+			if (yych == 'c') goto yy1460;
+			goto yy1039;
 		} else {
-			if (yych <= 't') goto yy1360;
-			if (yych <= 'z') goto yy940;
+			if (yych <= 't') goto yy1461;
+			if (yych <= 'z') goto yy1039;
 		}
 	}
-#line 612 "../src/parse/conf_lexer.re"
+#line 624 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::RESTORE); }
-#line 7345 "src/parse/conf_lexer.cc"
-yy1301:
+#line 7480 "src/parse/conf_lexer.cc"
+yy1401:
 	yych = *++cur;
-	if (yych == 'p') goto yy1361;
-	goto yy941;
-yy1302:
+	if (yych == 'p') goto yy1462;
+	goto yy1040;
+yy1402:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 619 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 631 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::SETCOND); }
-#line 7357 "src/parse/conf_lexer.cc"
-yy1303:
+#line 7490 "src/parse/conf_lexer.cc"
+yy1403:
 	yych = *++cur;
-	if (yych == 'e') goto yy1362;
-	goto yy941;
-yy1304:
+	if (yych == 'e') goto yy1463;
+	goto yy1040;
+yy1404:
 	yych = *++cur;
-	if (yych == 'a') goto yy1363;
-	goto yy941;
-yy1305:
+	if (yych == 'a') goto yy1464;
+	goto yy1040;
+yy1405:
 	yych = *++cur;
-	if (yych == 'a') goto yy1364;
-	goto yy941;
-yy1306:
+	if (yych == 'a') goto yy1465;
+	goto yy1040;
+yy1406:
 	yych = *++cur;
-	if (yych == 'o') goto yy1365;
-	goto yy941;
-yy1307:
+	if (yych == 'o') goto yy1466;
+	goto yy1040;
+yy1407:
 	yych = *++cur;
-	if (yych == 'e') goto yy1366;
-	goto yy941;
-yy1308:
+	if (yych == 'e') goto yy1467;
+	goto yy1040;
+yy1408:
 	yych = *++cur;
-	if (yych == 'n') goto yy1367;
-	goto yy941;
-yy1309:
+	if (yych == 'n') goto yy1468;
+	goto yy1040;
+yy1409:
 	yych = *++cur;
-	if (yych == 't') goto yy1368;
-	goto yy941;
-yy1310:
+	if (yych == 't') goto yy1469;
+	goto yy1040;
+yy1410:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 636 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 648 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::VER); }
-#line 7393 "src/parse/conf_lexer.cc"
-yy1311:
+#line 7524 "src/parse/conf_lexer.cc"
+yy1411:
 	yych = *++cur;
-	if (yych == 'r') goto yy1369;
-	goto yy964;
-yy1312:
+	if (yych == 'r') goto yy1470;
+	goto yy1063;
+yy1412:
 	yych = *++cur;
-	if (yych == 't') goto yy1370;
-	goto yy964;
-yy1313:
+	if (yych == 't') goto yy1471;
+	goto yy1063;
+yy1413:
 	yych = *++cur;
-	if (yych == 'r') goto yy1371;
-	goto yy964;
-yy1314:
+	if (yych == 'r') goto yy1472;
+	goto yy1063;
+yy1414:
 	yych = *++cur;
-	if (yych == 'e') goto yy1372;
-	goto yy941;
-yy1315:
+	if (yych == 'e') goto yy1473;
+	goto yy1040;
+yy1415:
 	yych = *++cur;
-	if (yych == 'x') goto yy1373;
-	goto yy941;
-yy1316:
+	if (yych == 'x') goto yy1474;
+	goto yy1040;
+yy1416:
 	yych = *++cur;
-	if (yych == 'g') goto yy1374;
-	goto yy941;
-yy1317:
+	if (yych == 'g') goto yy1475;
+	goto yy1040;
+yy1417:
 	yych = *++cur;
-	if (yych == 'e') goto yy1375;
-	goto yy941;
-yy1318:
+	if (yych == 'e') goto yy1476;
+	goto yy1040;
+yy1418:
 	yych = *++cur;
-	if (yych == 'r') goto yy1376;
-	goto yy1205;
-yy1319:
+	if (yych == 'r') goto yy1477;
+	goto yy1304;
+yy1419:
 	yych = *++cur;
-	if (yych == 'a') goto yy1377;
-	goto yy1205;
-yy1320:
+	if (yych == 'a') goto yy1478;
+	goto yy1304;
+yy1420:
 	yych = *++cur;
-	if (yych == 'i') goto yy1378;
-	goto yy1205;
-yy1321:
+	if (yych == 'i') goto yy1479;
+	goto yy1304;
+yy1421:
 	yych = *++cur;
-	if (yych == 's') goto yy1379;
-	goto yy1205;
-yy1322:
+	if (yych == 'r') goto yy1480;
+	goto yy1304;
+yy1422:
 	yych = *++cur;
-	if (yych == 'm') goto yy1380;
-	goto yy1205;
-yy1323:
+	if (yych == 'd') goto yy1481;
+	if (yych == 's') goto yy1482;
+	goto yy1304;
+yy1423:
 	yych = *++cur;
-	if (yych == 'g') goto yy1382;
-	goto yy1205;
-yy1324:
+	if (yych == 'm') goto yy1483;
+	goto yy1304;
+yy1424:
 	yych = *++cur;
-	if (yych == 'a') goto yy1383;
-	goto yy1205;
-yy1325:
+	if (yych == 'g') goto yy1485;
+	goto yy1304;
+yy1425:
 	yych = *++cur;
-	if (yych == 'e') goto yy1384;
-	goto yy1205;
-yy1326:
+	if (yych == 'a') goto yy1486;
+	goto yy1304;
+yy1426:
 	yych = *++cur;
-	if (yych == 'o') goto yy1385;
-	goto yy1205;
-yy1327:
+	if (yych == 'e') goto yy1487;
+	goto yy1304;
+yy1427:
 	yych = *++cur;
-	if (yych == 't') goto yy1387;
-	goto yy1205;
-yy1328:
+	if (yych == 'o') goto yy1488;
+	goto yy1304;
+yy1428:
 	yych = *++cur;
-	if (yych == 'e') goto yy1388;
-	goto yy1205;
-yy1329:
+	if (yych == 't') goto yy1490;
+	goto yy1304;
+yy1429:
 	yych = *++cur;
-	if (yych == 'p') goto yy1389;
-	goto yy1205;
-yy1330:
+	if (yych == 'e') goto yy1491;
+	goto yy1304;
+yy1430:
 	yych = *++cur;
-	if (yych == 'u') goto yy1391;
-	goto yy1205;
-yy1331:
+	if (yych == 'p') goto yy1492;
+	goto yy1304;
+yy1431:
 	yych = *++cur;
-	if (yych == 't') goto yy1392;
-	goto yy1205;
-yy1332:
+	if (yych == 'u') goto yy1494;
+	goto yy1304;
+yy1432:
 	yych = *++cur;
-	if (yych == 'l') goto yy1393;
-	goto yy1205;
-yy1333:
+	if (yych == 't') goto yy1495;
+	goto yy1304;
+yy1433:
 	yych = *++cur;
-	if (yych == 'e') goto yy1394;
-	goto yy1205;
-yy1334:
+	if (yych == 'l') goto yy1496;
+	goto yy1304;
+yy1434:
 	yych = *++cur;
-	if (yych == '_') goto yy1395;
-	goto yy1205;
-yy1335:
+	if (yych == 'e') goto yy1497;
+	goto yy1304;
+yy1435:
 	yych = *++cur;
-	if (yych == 'a') goto yy1396;
-	goto yy1205;
-yy1336:
+	if (yych == '_') goto yy1498;
+	goto yy1304;
+yy1436:
 	yych = *++cur;
-	if (yych == 'o') goto yy1397;
-	goto yy1205;
-yy1337:
+	if (yych == 'a') goto yy1499;
+	goto yy1304;
+yy1437:
 	yych = *++cur;
-	if (yych == 'e') goto yy1398;
-	goto yy1205;
-yy1338:
+	if (yych == 'o') goto yy1500;
+	goto yy1304;
+yy1438:
 	yych = *++cur;
-	if (yych == 'e') goto yy1399;
-	goto yy1205;
-yy1339:
+	if (yych == 'e') goto yy1501;
+	goto yy1304;
+yy1439:
 	yych = *++cur;
-	if (yych == 'e') goto yy1400;
-	goto yy1205;
-yy1340:
+	if (yych == 'e') goto yy1502;
+	goto yy1304;
+yy1440:
 	yych = *++cur;
-	if (yych == 't') goto yy1401;
-	goto yy1205;
-yy1341:
+	if (yych == 'e') goto yy1503;
+	goto yy1304;
+yy1441:
 	yych = *++cur;
-	if (yych == 'e') goto yy1402;
-	goto yy1205;
-yy1342:
+	if (yych == 't') goto yy1504;
+	goto yy1304;
+yy1442:
 	yych = *++cur;
-	if (yych == 'e') goto yy1403;
-	goto yy1205;
-yy1343:
+	if (yych == 'e') goto yy1505;
+	goto yy1304;
+yy1443:
+	yych = *++cur;
+	if (yych == 'e') goto yy1506;
+	goto yy1304;
+yy1444:
 	yych = *++cur;
 	switch (yych) {
-		case 'e': goto yy1404;
-		case 'h': goto yy1405;
-		case 'k': goto yy1406;
-		case 't': goto yy1407;
-		default: goto yy1205;
+		case 'e': goto yy1507;
+		case 'h': goto yy1508;
+		case 'k': goto yy1509;
+		case 't': goto yy1510;
+		default: goto yy1304;
 	}
-yy1344:
+yy1445:
 	yych = *++cur;
-	if (yych == 'e') goto yy1408;
-	goto yy941;
-yy1345:
+	if (yych == 'e') goto yy1511;
+	goto yy1040;
+yy1446:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 579 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 591 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::COPYMTAG); }
-#line 7542 "src/parse/conf_lexer.cc"
-yy1346:
+#line 7676 "src/parse/conf_lexer.cc"
+yy1447:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 580 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 592 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::COPYSTAG); }
-#line 7550 "src/parse/conf_lexer.cc"
-yy1347:
+#line 7682 "src/parse/conf_lexer.cc"
+yy1448:
 	yych = *++cur;
-	if (yych == 'r') goto yy1409;
-	goto yy941;
-yy1348:
+	if (yych == 'r') goto yy1512;
+	goto yy1040;
+yy1449:
 	yych = *++cur;
-	if (yych == 't') goto yy1410;
-	goto yy941;
-yy1349:
+	if (yych == 't') goto yy1513;
+	goto yy1040;
+yy1450:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 594 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 606 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::GETSTATE); }
-#line 7566 "src/parse/conf_lexer.cc"
-yy1350:
+#line 7696 "src/parse/conf_lexer.cc"
+yy1451:
 	yych = *++cur;
-	if (yych == 's') goto yy1411;
-	goto yy941;
-yy1351:
+	if (yych == 's') goto yy1514;
+	goto yy1040;
+yy1452:
 	yych = *++cur;
-	if (yych == 'd') goto yy1412;
-	goto yy941;
-yy1352:
+	if (yych == 'd') goto yy1515;
+	goto yy1040;
+yy1453:
 	yych = *++cur;
-	if (yych == 'e') goto yy1413;
-	goto yy941;
-yy1353:
+	if (yych == 'e') goto yy1516;
+	goto yy1040;
+yy1454:
 	yych = *++cur;
-	if (yych == 't') goto yy1414;
-	goto yy941;
-yy1354:
+	if (yych == 't') goto yy1517;
+	goto yy1040;
+yy1455:
 	yych = *++cur;
-	if (yych == 'v') goto yy1415;
-	goto yy941;
-yy1355:
+	if (yych == 'v') goto yy1518;
+	goto yy1040;
+yy1456:
 	yych = *++cur;
-	if (yych == 'e') goto yy1416;
-	goto yy941;
-yy1356:
+	if (yych == 'e') goto yy1519;
+	goto yy1040;
+yy1457:
 	yych = *++cur;
-	if (yych == 's') goto yy1417;
-	goto yy941;
-yy1357:
+	if (yych == 's') goto yy1520;
+	goto yy1040;
+yy1458:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 599 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 611 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::LESSTHAN); }
-#line 7602 "src/parse/conf_lexer.cc"
-yy1358:
+#line 7730 "src/parse/conf_lexer.cc"
+yy1459:
 	yych = *++cur;
-	if (yych == 'e') goto yy1418;
-	goto yy941;
-yy1359:
+	if (yych == 'e') goto yy1521;
+	goto yy1040;
+yy1460:
 	yych = *++cur;
-	if (yych == 't') goto yy1419;
-	goto yy941;
-yy1360:
+	if (yych == 't') goto yy1522;
+	goto yy1040;
+yy1461:
 	yych = *++cur;
-	if (yych == 'a') goto yy1420;
-	goto yy941;
-yy1361:
+	if (yych == 'a') goto yy1523;
+	goto yy1040;
+yy1462:
 	yych = *++cur;
-	if (yych == 't') goto yy1421;
-	goto yy941;
-yy1362:
+	if (yych == 't') goto yy1524;
+	goto yy1040;
+yy1463:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 620 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 632 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::SETSTATE); }
-#line 7626 "src/parse/conf_lexer.cc"
-yy1363:
+#line 7752 "src/parse/conf_lexer.cc"
+yy1464:
 	yych = *++cur;
-	if (yych == 'g') goto yy1422;
-	goto yy941;
-yy1364:
+	if (yych == 'g') goto yy1525;
+	goto yy1040;
+yy1465:
 	yych = *++cur;
-	if (yych == 'g') goto yy1423;
-	goto yy941;
-yy1365:
+	if (yych == 'g') goto yy1526;
+	goto yy1040;
+yy1466:
 	yych = *++cur;
-	if (yych == 'n') goto yy1424;
-	goto yy941;
-yy1366:
+	if (yych == 'n') goto yy1527;
+	goto yy1040;
+yy1467:
 	yych = *++cur;
-	if (yych == '_') goto yy1425;
-	goto yy941;
-yy1367:
+	if (yych == '_') goto yy1528;
+	goto yy1040;
+yy1468:
 	yych = *++cur;
-	if (yych == 't') goto yy1426;
-	goto yy941;
-yy1368:
+	if (yych == 't') goto yy1529;
+	goto yy1040;
+yy1469:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 633 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 645 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::TYPECAST); }
-#line 7654 "src/parse/conf_lexer.cc"
-yy1369:
+#line 7778 "src/parse/conf_lexer.cc"
+yy1470:
 	yych = *++cur;
-	if (yych == 'i') goto yy1427;
-	goto yy964;
-yy1370:
+	if (yych == 'i') goto yy1530;
+	goto yy1063;
+yy1471:
 	yych = *++cur;
-	if (yych == 'e') goto yy1428;
-	goto yy964;
-yy1371:
+	if (yych == 'e') goto yy1531;
+	goto yy1063;
+yy1472:
 	yych = *++cur;
-	if (yych == 'd') goto yy1429;
-	goto yy964;
-yy1372:
+	if (yych == 'd') goto yy1532;
+	goto yy1063;
+yy1473:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych == '.') goto yy1430;
-	goto yy941;
-yy1373:
+	if (yych == '.') goto yy1533;
+	goto yy1040;
+yy1474:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 574 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 586 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::BACKUPCTX); }
-#line 7679 "src/parse/conf_lexer.cc"
-yy1374:
+#line 7801 "src/parse/conf_lexer.cc"
+yy1475:
 	yych = *++cur;
-	if (yych == 'e') goto yy1431;
-	goto yy941;
-yy1375:
+	if (yych == 'e') goto yy1534;
+	goto yy1040;
+yy1476:
 	yych = *++cur;
-	if (yych == 'r') goto yy1432;
-	goto yy941;
-yy1376:
+	if (yych == 'r') goto yy1535;
+	goto yy1040;
+yy1477:
 	yych = *++cur;
-	if (yych == 't') goto yy1433;
-	goto yy1205;
-yy1377:
+	if (yych == 't') goto yy1536;
+	goto yy1304;
+yy1478:
 	yych = *++cur;
-	if (yych == 'y') goto yy1435;
-	goto yy1205;
-yy1378:
+	if (yych == 'y') goto yy1538;
+	goto yy1304;
+yy1479:
 	yych = *++cur;
-	if (yych == 'g') goto yy1436;
-	goto yy1205;
-yy1379:
+	if (yych == 'g') goto yy1539;
+	goto yy1304;
+yy1480:
 	yych = *++cur;
-	if (yych == 't') goto yy1437;
-	goto yy1205;
-yy1380:
+	if (yych == '_') goto yy1540;
+	goto yy1304;
+yy1481:
+	yych = *++cur;
+	if (yych == '_') goto yy1541;
+	goto yy1304;
+yy1482:
+	yych = *++cur;
+	if (yych == 't') goto yy1542;
+	goto yy1304;
+yy1483:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1381;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1484;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych <= '_') goto yy1438;
-		if (yych <= '`') goto yy1381;
-		if (yych <= 'z') goto yy1204;
+		if (yych <= '_') goto yy1543;
+		if (yych <= '`') goto yy1484;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1381:
-#line 522 "../src/parse/conf_lexer.re"
+yy1484:
+#line 532 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_enum); }
-#line 7717 "src/parse/conf_lexer.cc"
-yy1382:
+#line 7847 "src/parse/conf_lexer.cc"
+yy1485:
 	yych = *++cur;
-	if (yych == 'e') goto yy1439;
-	goto yy1205;
-yy1383:
+	if (yych == 'e') goto yy1544;
+	goto yy1304;
+yy1486:
 	yych = *++cur;
-	if (yych == 'l') goto yy1440;
-	goto yy1205;
-yy1384:
+	if (yych == 'l') goto yy1545;
+	goto yy1304;
+yy1487:
 	yych = *++cur;
-	if (yych == 'c') goto yy1441;
-	if (yych == 'f') goto yy1442;
-	goto yy1205;
-yy1385:
+	if (yych == 'c') goto yy1546;
+	if (yych == 'f') goto yy1547;
+	goto yy1304;
+yy1488:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1386;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1489;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1386;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1489;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1386:
-#line 521 "../src/parse/conf_lexer.re"
+yy1489:
+#line 531 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_goto); }
-#line 7743 "src/parse/conf_lexer.cc"
-yy1387:
+#line 7873 "src/parse/conf_lexer.cc"
+yy1490:
 	yych = *++cur;
-	if (yych == 'h') goto yy1444;
-	goto yy1205;
-yy1388:
+	if (yych == 'h') goto yy1549;
+	goto yy1304;
+yy1491:
 	yych = *++cur;
-	if (yych == '_') goto yy1445;
-	goto yy1205;
-yy1389:
+	if (yych == '_') goto yy1550;
+	goto yy1304;
+yy1492:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1390;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1493;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1390;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1493;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1390:
-#line 520 "../src/parse/conf_lexer.re"
+yy1493:
+#line 530 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_loop); }
-#line 7764 "src/parse/conf_lexer.cc"
-yy1391:
+#line 7894 "src/parse/conf_lexer.cc"
+yy1494:
 	yych = *++cur;
-	if (yych == 'r') goto yy1446;
-	goto yy1205;
-yy1392:
+	if (yych == 'r') goto yy1551;
+	goto yy1304;
+yy1495:
 	yych = *++cur;
-	if (yych == 'c') goto yy1447;
-	goto yy1205;
-yy1393:
+	if (yych == 'c') goto yy1552;
+	goto yy1304;
+yy1496:
 	yych = *++cur;
-	if (yych == 'c') goto yy1448;
-	goto yy1205;
-yy1394:
+	if (yych == 'c') goto yy1553;
+	goto yy1304;
+yy1497:
 	yych = *++cur;
-	if (yych == '_') goto yy1449;
-	goto yy1205;
-yy1395:
+	if (yych == '_') goto yy1554;
+	goto yy1304;
+yy1498:
 	yych = *++cur;
-	if (yych == 'g') goto yy1450;
-	if (yych == 'l') goto yy1451;
-	goto yy1205;
-yy1396:
+	if (yych == 'g') goto yy1555;
+	if (yych == 'l') goto yy1556;
+	goto yy1304;
+yy1499:
 	yych = *++cur;
-	if (yych == 'c') goto yy1452;
-	goto yy1205;
-yy1397:
+	if (yych == 'c') goto yy1557;
+	goto yy1304;
+yy1500:
 	yych = *++cur;
-	if (yych == 'p') goto yy1453;
-	goto yy1205;
-yy1398:
+	if (yych == 'p') goto yy1558;
+	goto yy1304;
+yy1501:
 	yych = *++cur;
-	if (yych == 'b') goto yy1454;
-	goto yy1205;
-yy1399:
+	if (yych == 'b') goto yy1559;
+	goto yy1304;
+yy1502:
 	yych = *++cur;
-	if (yych == 't') goto yy1455;
-	goto yy1205;
-yy1400:
+	if (yych == 't') goto yy1560;
+	goto yy1304;
+yy1503:
 	yych = *++cur;
-	if (yych == 's') goto yy1456;
-	goto yy1205;
-yy1401:
+	if (yych == 's') goto yy1561;
+	goto yy1304;
+yy1504:
 	yych = *++cur;
-	if (yych == 'a') goto yy1457;
-	goto yy1205;
-yy1402:
+	if (yych == 'a') goto yy1562;
+	goto yy1304;
+yy1505:
 	yych = *++cur;
-	if (yych == 'e') goto yy1458;
-	goto yy1205;
-yy1403:
+	if (yych == 'e') goto yy1563;
+	goto yy1304;
+yy1506:
 	yych = *++cur;
-	if (yych == 's') goto yy1459;
-	goto yy1205;
-yy1404:
+	if (yych == 's') goto yy1564;
+	goto yy1304;
+yy1507:
 	yych = *++cur;
-	if (yych == 't') goto yy1460;
-	goto yy1205;
-yy1405:
+	if (yych == 't') goto yy1565;
+	goto yy1304;
+yy1508:
 	yych = *++cur;
-	if (yych == 'i') goto yy1461;
-	goto yy1205;
-yy1406:
+	if (yych == 'i') goto yy1566;
+	goto yy1304;
+yy1509:
 	yych = *++cur;
-	if (yych == 'i') goto yy1462;
-	goto yy1205;
-yy1407:
+	if (yych == 'i') goto yy1567;
+	goto yy1304;
+yy1510:
 	yych = *++cur;
-	if (yych == 'a') goto yy1463;
-	goto yy1205;
-yy1408:
+	if (yych == 'a') goto yy1568;
+	goto yy1304;
+yy1511:
 	yych = *++cur;
-	if (yych == 'l') goto yy1464;
-	goto yy941;
-yy1409:
+	if (yych == 'l') goto yy1569;
+	goto yy1040;
+yy1512:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 582 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 594 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::CTXMARKER); }
-#line 7845 "src/parse/conf_lexer.cc"
-yy1410:
+#line 7973 "src/parse/conf_lexer.cc"
+yy1513:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 592 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 604 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::GETACCEPT); }
-#line 7853 "src/parse/conf_lexer.cc"
-yy1411:
+#line 7979 "src/parse/conf_lexer.cc"
+yy1514:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 683 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 695 "../src/parse/conf_lexer.re"
 	{ RET_LOPT(StxLOpt::HAVE_ARGS); }
-#line 7861 "src/parse/conf_lexer.cc"
-yy1412:
+#line 7985 "src/parse/conf_lexer.cc"
+yy1515:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 684 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 696 "../src/parse/conf_lexer.re"
 	{ RET_LOPT(StxLOpt::HAVE_COND); }
-#line 7869 "src/parse/conf_lexer.cc"
-yy1413:
+#line 7991 "src/parse/conf_lexer.cc"
+yy1516:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 671 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 683 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::HAVE_DATE); }
-#line 7877 "src/parse/conf_lexer.cc"
-yy1414:
+#line 7997 "src/parse/conf_lexer.cc"
+yy1517:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 685 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 697 "../src/parse/conf_lexer.re"
 	{ RET_LOPT(StxLOpt::HAVE_INIT); }
-#line 7885 "src/parse/conf_lexer.cc"
-yy1415:
+#line 8003 "src/parse/conf_lexer.cc"
+yy1518:
 	yych = *++cur;
-	if (yych == 'a') goto yy1465;
-	goto yy941;
-yy1416:
+	if (yych == 'a') goto yy1570;
+	goto yy1040;
+yy1519:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 687 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 699 "../src/parse/conf_lexer.re"
 	{ RET_LOPT(StxLOpt::HAVE_TYPE); }
-#line 7897 "src/parse/conf_lexer.cc"
-yy1417:
+#line 8013 "src/parse/conf_lexer.cc"
+yy1520:
 	yych = *++cur;
-	if (yych == 'i') goto yy1466;
-	goto yy941;
-yy1418:
+	if (yych == 'i') goto yy1571;
+	goto yy1040;
+yy1521:
 	yych = *++cur;
-	if (yych == 'l') goto yy1467;
-	goto yy941;
-yy1419:
+	if (yych == 'l') goto yy1572;
+	goto yy1040;
+yy1522:
 	yych = *++cur;
-	if (yych == 'x') goto yy1468;
-	goto yy941;
-yy1420:
+	if (yych == 'x') goto yy1573;
+	goto yy1040;
+yy1523:
 	yych = *++cur;
-	if (yych == 'g') goto yy1469;
-	goto yy941;
-yy1421:
+	if (yych == 'g') goto yy1574;
+	goto yy1040;
+yy1524:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 618 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 630 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::SETACCEPT); }
-#line 7921 "src/parse/conf_lexer.cc"
-yy1422:
+#line 8035 "src/parse/conf_lexer.cc"
+yy1525:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 624 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 636 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::SHIFTMTAG); }
-#line 7929 "src/parse/conf_lexer.cc"
-yy1423:
+#line 8041 "src/parse/conf_lexer.cc"
+yy1526:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 625 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 637 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::SHIFTSTAG); }
-#line 7937 "src/parse/conf_lexer.cc"
-yy1424:
+#line 8047 "src/parse/conf_lexer.cc"
+yy1527:
 	yych = *++cur;
-	if (yych == 'd') goto yy1470;
-	goto yy941;
-yy1425:
+	if (yych == 'd') goto yy1575;
+	goto yy1040;
+yy1528:
 	yych = *++cur;
-	if (yych == 's') goto yy1471;
-	goto yy941;
-yy1426:
+	if (yych == 's') goto yy1576;
+	goto yy1040;
+yy1529:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 642 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 654 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::TOPINDENT); }
-#line 7953 "src/parse/conf_lexer.cc"
-yy1427:
+#line 8061 "src/parse/conf_lexer.cc"
+yy1530:
 	yych = *++cur;
-	if (yych == 'c') goto yy1472;
-	goto yy964;
-yy1428:
+	if (yych == 'c') goto yy1577;
+	goto yy1063;
+yy1531:
 	yych = *++cur;
-	if (yych == 'r') goto yy1473;
-	goto yy964;
-yy1429:
+	if (yych == 'r') goto yy1578;
+	goto yy1063;
+yy1532:
 	++cur;
-#line 666 "../src/parse/conf_lexer.re"
+#line 678 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::API_RECORD); }
-#line 7966 "src/parse/conf_lexer.cc"
-yy1430:
+#line 8074 "src/parse/conf_lexer.cc"
+yy1533:
 	yych = *++cur;
-	if (yych == 'f') goto yy1474;
-	goto yy964;
-yy1431:
+	if (yych == 'f') goto yy1579;
+	goto yy1063;
+yy1534:
 	yych = *++cur;
-	if (yych == 's') goto yy1475;
-	goto yy941;
-yy1432:
+	if (yych == 's') goto yy1580;
+	goto yy1040;
+yy1535:
 	yych = *++cur;
-	if (yych == 'a') goto yy1476;
-	goto yy941;
-yy1433:
+	if (yych == 'a') goto yy1581;
+	goto yy1040;
+yy1536:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1434;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1537;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1434;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1537;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1434:
-#line 531 "../src/parse/conf_lexer.re"
+yy1537:
+#line 541 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_abort); }
-#line 7991 "src/parse/conf_lexer.cc"
-yy1435:
+#line 8099 "src/parse/conf_lexer.cc"
+yy1538:
 	yych = *++cur;
-	if (yych == '_') goto yy1477;
-	goto yy1205;
-yy1436:
+	if (yych == '_') goto yy1582;
+	goto yy1304;
+yy1539:
 	yych = *++cur;
-	if (yych == 'n') goto yy1478;
-	goto yy1205;
-yy1437:
+	if (yych == 'n') goto yy1583;
+	goto yy1304;
+yy1540:
 	yych = *++cur;
-	if (yych == '_') goto yy1480;
-	goto yy1205;
-yy1438:
+	if (yych == 'i') goto yy1585;
+	goto yy1304;
+yy1541:
 	yych = *++cur;
-	if (yych == 'e') goto yy1481;
-	goto yy1205;
-yy1439:
+	if (yych == 'l') goto yy1586;
+	if (yych == 'u') goto yy1587;
+	goto yy1304;
+yy1542:
 	yych = *++cur;
-	if (yych == 'r') goto yy1482;
-	goto yy1205;
-yy1440:
+	if (yych == '_') goto yy1588;
+	goto yy1304;
+yy1543:
 	yych = *++cur;
-	if (yych == 'l') goto yy1483;
-	goto yy1205;
-yy1441:
+	if (yych == 'e') goto yy1589;
+	goto yy1304;
+yy1544:
 	yych = *++cur;
-	if (yych == 'l') goto yy1485;
-	goto yy1205;
-yy1442:
+	if (yych == 'r') goto yy1590;
+	goto yy1304;
+yy1545:
+	yych = *++cur;
+	if (yych == 'l') goto yy1591;
+	goto yy1304;
+yy1546:
+	yych = *++cur;
+	if (yych == 'l') goto yy1593;
+	goto yy1304;
+yy1547:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1443;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1548;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1443;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1548;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1443:
-#line 525 "../src/parse/conf_lexer.re"
+yy1548:
+#line 535 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_fndef); }
-#line 8032 "src/parse/conf_lexer.cc"
-yy1444:
+#line 8149 "src/parse/conf_lexer.cc"
+yy1549:
 	yych = *++cur;
-	if (yych == 'e') goto yy1487;
-	goto yy1205;
-yy1445:
+	if (yych == 'e') goto yy1595;
+	goto yy1304;
+yy1550:
 	yych = *++cur;
-	if (yych == 'i') goto yy1488;
-	goto yy1205;
-yy1446:
+	if (yych == 'i') goto yy1596;
+	goto yy1304;
+yy1551:
 	yych = *++cur;
-	if (yych == 's') goto yy1489;
-	goto yy1205;
-yy1447:
+	if (yych == 's') goto yy1597;
+	goto yy1304;
+yy1552:
 	yych = *++cur;
-	if (yych == 'h') goto yy1490;
-	goto yy1205;
-yy1448:
+	if (yych == 'h') goto yy1598;
+	goto yy1304;
+yy1553:
 	yych = *++cur;
-	if (yych == 'a') goto yy1492;
-	goto yy1205;
-yy1449:
+	if (yych == 'a') goto yy1600;
+	goto yy1304;
+yy1554:
 	yych = *++cur;
 	if (yych <= 'i') {
-		if (yych == 'c') goto yy1493;
-		if (yych <= 'h') goto yy1205;
-		goto yy1494;
+		if (yych == 'c') goto yy1601;
+		if (yych <= 'h') goto yy1304;
+		goto yy1602;
 	} else {
 		if (yych <= 'u') {
-			if (yych <= 't') goto yy1205;
-			goto yy1495;
+			if (yych <= 't') goto yy1304;
+			goto yy1603;
 		} else {
-			if (yych == 'y') goto yy1496;
-			goto yy1205;
+			if (yych == 'y') goto yy1604;
+			goto yy1304;
 		}
 	}
-yy1450:
+yy1555:
 	yych = *++cur;
-	if (yych == 'l') goto yy1497;
-	goto yy1205;
-yy1451:
+	if (yych == 'l') goto yy1605;
+	goto yy1304;
+yy1556:
 	yych = *++cur;
-	if (yych == 'o') goto yy1498;
-	goto yy1205;
-yy1452:
+	if (yych == 'o') goto yy1606;
+	goto yy1304;
+yy1557:
 	yych = *++cur;
-	if (yych == 'k') goto yy1499;
-	goto yy1205;
-yy1453:
+	if (yych == 'k') goto yy1607;
+	goto yy1304;
+yy1558:
 	yych = *++cur;
-	if (yych == 'y') goto yy1500;
-	goto yy1205;
-yy1454:
+	if (yych == 'y') goto yy1608;
+	goto yy1304;
+yy1559:
 	yych = *++cur;
-	if (yych == 'u') goto yy1501;
-	goto yy1205;
-yy1455:
+	if (yych == 'u') goto yy1609;
+	goto yy1304;
+yy1560:
 	yych = *++cur;
 	if (yych <= 'b') {
-		if (yych == 'a') goto yy1502;
-		goto yy1205;
+		if (yych == 'a') goto yy1610;
+		goto yy1304;
 	} else {
-		if (yych <= 'c') goto yy1503;
-		if (yych == 's') goto yy1504;
-		goto yy1205;
+		if (yych <= 'c') goto yy1611;
+		if (yych == 's') goto yy1612;
+		goto yy1304;
 	}
-yy1456:
+yy1561:
 	yych = *++cur;
-	if (yych == 's') goto yy1505;
-	goto yy1205;
-yy1457:
+	if (yych == 's') goto yy1613;
+	goto yy1304;
+yy1562:
 	yych = *++cur;
-	if (yych == 'g') goto yy1506;
-	goto yy1205;
-yy1458:
+	if (yych == 'g') goto yy1614;
+	goto yy1304;
+yy1563:
 	yych = *++cur;
-	if (yych == 'k') goto yy1507;
-	goto yy1205;
-yy1459:
+	if (yych == 'k') goto yy1615;
+	goto yy1304;
+yy1564:
 	yych = *++cur;
-	if (yych == 't') goto yy1509;
-	goto yy1205;
-yy1460:
+	if (yych == 't') goto yy1617;
+	goto yy1304;
+yy1565:
 	yych = *++cur;
 	if (yych <= 'b') {
-		if (yych == 'a') goto yy1510;
-		goto yy1205;
+		if (yych == 'a') goto yy1618;
+		goto yy1304;
 	} else {
-		if (yych <= 'c') goto yy1511;
-		if (yych == 's') goto yy1512;
-		goto yy1205;
+		if (yych <= 'c') goto yy1619;
+		if (yych == 's') goto yy1620;
+		goto yy1304;
 	}
-yy1461:
+yy1566:
 	yych = *++cur;
-	if (yych == 'f') goto yy1513;
-	goto yy1205;
-yy1462:
+	if (yych == 'f') goto yy1621;
+	goto yy1304;
+yy1567:
 	yych = *++cur;
-	if (yych == 'p') goto yy1514;
-	goto yy1205;
-yy1463:
+	if (yych == 'p') goto yy1622;
+	goto yy1304;
+yy1568:
 	yych = *++cur;
-	if (yych == 'g') goto yy1516;
-	goto yy1205;
-yy1464:
+	if (yych == 'g') goto yy1624;
+	goto yy1304;
+yy1569:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych == '.') goto yy1517;
-	goto yy941;
-yy1465:
+	if (yych == '.') goto yy1625;
+	goto yy1040;
+yy1570:
 	yych = *++cur;
-	if (yych == 'l') goto yy1518;
-	goto yy941;
-yy1466:
+	if (yych == 'l') goto yy1626;
+	goto yy1040;
+yy1571:
 	yych = *++cur;
-	if (yych == 'o') goto yy1519;
-	goto yy941;
-yy1467:
+	if (yych == 'o') goto yy1627;
+	goto yy1040;
+yy1572:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 676 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 688 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::LOOP_LABEL); }
-#line 8156 "src/parse/conf_lexer.cc"
-yy1468:
+#line 8271 "src/parse/conf_lexer.cc"
+yy1573:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 613 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 625 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::RESTORECTX); }
-#line 8164 "src/parse/conf_lexer.cc"
-yy1469:
+#line 8277 "src/parse/conf_lexer.cc"
+yy1574:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 614 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 626 "../src/parse/conf_lexer.re"
 	{ RET_VAR(StxVarId::RESTORETAG); }
-#line 8172 "src/parse/conf_lexer.cc"
-yy1470:
+#line 8283 "src/parse/conf_lexer.cc"
+yy1575:
 	yych = *++cur;
-	if (yych == 'i') goto yy1520;
-	goto yy941;
-yy1471:
+	if (yych == 'i') goto yy1628;
+	goto yy1040;
+yy1576:
 	yych = *++cur;
-	if (yych == 't') goto yy1521;
-	goto yy941;
-yy1472:
+	if (yych == 't') goto yy1629;
+	goto yy1040;
+yy1577:
 	++cur;
-#line 665 "../src/parse/conf_lexer.re"
+#line 677 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::API_CUSTOM); }
-#line 8185 "src/parse/conf_lexer.cc"
-yy1473:
+#line 8296 "src/parse/conf_lexer.cc"
+yy1578:
 	yych = *++cur;
-	if (yych == 's') goto yy1522;
-	goto yy964;
-yy1474:
+	if (yych == 's') goto yy1630;
+	goto yy1063;
+yy1579:
 	yych = *++cur;
-	if (yych == 'r') goto yy1523;
-	if (yych == 'u') goto yy1524;
-	goto yy964;
-yy1475:
+	if (yych == 'r') goto yy1631;
+	if (yych == 'u') goto yy1632;
+	goto yy1063;
+yy1580:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 673 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 685 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::CASE_RANGES); }
-#line 8202 "src/parse/conf_lexer.cc"
-yy1476:
+#line 8311 "src/parse/conf_lexer.cc"
+yy1581:
 	yych = *++cur;
-	if (yych == 'l') goto yy1525;
-	goto yy941;
-yy1477:
+	if (yych == 'l') goto yy1633;
+	goto yy1040;
+yy1582:
 	yych = *++cur;
 	if (yych <= 'f') {
-		if (yych == 'e') goto yy1526;
-		goto yy1205;
+		if (yych == 'e') goto yy1634;
+		goto yy1304;
 	} else {
-		if (yych <= 'g') goto yy1527;
-		if (yych == 'l') goto yy1528;
-		goto yy1205;
+		if (yych <= 'g') goto yy1635;
+		if (yych == 'l') goto yy1636;
+		goto yy1304;
 	}
-yy1478:
+yy1583:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1479;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1584;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1479;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1584;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1479:
-#line 512 "../src/parse/conf_lexer.re"
+yy1584:
+#line 522 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_assign); }
-#line 8229 "src/parse/conf_lexer.cc"
-yy1480:
+#line 8338 "src/parse/conf_lexer.cc"
+yy1585:
 	yych = *++cur;
-	if (yych == 'g') goto yy1529;
-	if (yych == 'l') goto yy1530;
-	goto yy1205;
-yy1481:
+	if (yych == 'n') goto yy1637;
+	goto yy1304;
+yy1586:
 	yych = *++cur;
-	if (yych == 'l') goto yy1531;
-	goto yy1205;
-yy1482:
+	if (yych == 'i') goto yy1638;
+	goto yy1304;
+yy1587:
+	yych = *++cur;
+	if (yych == 'n') goto yy1639;
+	goto yy1304;
+yy1588:
+	yych = *++cur;
+	if (yych == 'g') goto yy1640;
+	if (yych == 'l') goto yy1641;
+	goto yy1304;
+yy1589:
+	yych = *++cur;
+	if (yych == 'l') goto yy1642;
+	goto yy1304;
+yy1590:
 	yych = *++cur;
-	if (yych == 'p') goto yy1532;
-	goto yy1205;
-yy1483:
+	if (yych == 'p') goto yy1643;
+	goto yy1304;
+yy1591:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1484;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1592;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1484;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1592;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1484:
-#line 526 "../src/parse/conf_lexer.re"
+yy1592:
+#line 536 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_fncall); }
-#line 8255 "src/parse/conf_lexer.cc"
-yy1485:
+#line 8376 "src/parse/conf_lexer.cc"
+yy1593:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1486;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1594;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1486;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1594;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1486:
-#line 524 "../src/parse/conf_lexer.re"
+yy1594:
+#line 534 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_fndecl); }
-#line 8268 "src/parse/conf_lexer.cc"
-yy1487:
+#line 8389 "src/parse/conf_lexer.cc"
+yy1595:
 	yych = *++cur;
-	if (yych == 'n') goto yy1533;
-	goto yy1205;
-yy1488:
+	if (yych == 'n') goto yy1644;
+	goto yy1304;
+yy1596:
 	yych = *++cur;
-	if (yych == 'n') goto yy1534;
-	goto yy1205;
-yy1489:
+	if (yych == 'n') goto yy1645;
+	goto yy1304;
+yy1597:
 	yych = *++cur;
-	if (yych == 'i') goto yy1535;
-	goto yy1205;
-yy1490:
+	if (yych == 'i') goto yy1646;
+	goto yy1304;
+yy1598:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1491;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1599;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych <= '_') goto yy1536;
-		if (yych <= '`') goto yy1491;
-		if (yych <= 'z') goto yy1204;
+		if (yych <= '_') goto yy1647;
+		if (yych <= '`') goto yy1599;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1491:
-#line 515 "../src/parse/conf_lexer.re"
+yy1599:
+#line 525 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_switch); }
-#line 8294 "src/parse/conf_lexer.cc"
-yy1492:
+#line 8415 "src/parse/conf_lexer.cc"
+yy1600:
 	yych = *++cur;
-	if (yych == 'l') goto yy1537;
-	goto yy1205;
-yy1493:
+	if (yych == 'l') goto yy1648;
+	goto yy1304;
+yy1601:
 	yych = *++cur;
-	if (yych == 'o') goto yy1538;
-	goto yy1205;
-yy1494:
+	if (yych == 'o') goto yy1649;
+	goto yy1304;
+yy1602:
 	yych = *++cur;
-	if (yych == 'n') goto yy1539;
-	goto yy1205;
-yy1495:
+	if (yych == 'n') goto yy1650;
+	goto yy1304;
+yy1603:
 	yych = *++cur;
-	if (yych == 'i') goto yy1540;
-	goto yy1205;
-yy1496:
+	if (yych == 'i') goto yy1651;
+	goto yy1304;
+yy1604:
 	yych = *++cur;
-	if (yych == 'y') goto yy1541;
-	goto yy1205;
-yy1497:
+	if (yych == 'y') goto yy1652;
+	goto yy1304;
+yy1605:
 	yych = *++cur;
-	if (yych == 'o') goto yy1542;
-	goto yy1205;
-yy1498:
+	if (yych == 'o') goto yy1653;
+	goto yy1304;
+yy1606:
 	yych = *++cur;
-	if (yych == 'c') goto yy1543;
-	goto yy1205;
-yy1499:
+	if (yych == 'c') goto yy1654;
+	goto yy1304;
+yy1607:
 	yych = *++cur;
-	if (yych == 'u') goto yy1544;
-	goto yy1205;
-yy1500:
+	if (yych == 'u') goto yy1655;
+	goto yy1304;
+yy1608:
 	yych = *++cur;
-	if (yych == 'm') goto yy1545;
-	if (yych == 's') goto yy1546;
-	goto yy1205;
-yy1501:
+	if (yych == 'm') goto yy1656;
+	if (yych == 's') goto yy1657;
+	goto yy1304;
+yy1609:
 	yych = *++cur;
-	if (yych == 'g') goto yy1547;
-	goto yy1205;
-yy1502:
+	if (yych == 'g') goto yy1658;
+	goto yy1304;
+yy1610:
 	yych = *++cur;
-	if (yych == 'c') goto yy1549;
-	goto yy1205;
-yy1503:
+	if (yych == 'c') goto yy1660;
+	goto yy1304;
+yy1611:
 	yych = *++cur;
-	if (yych == 'o') goto yy1550;
-	goto yy1205;
-yy1504:
+	if (yych == 'o') goto yy1661;
+	goto yy1304;
+yy1612:
 	yych = *++cur;
-	if (yych == 't') goto yy1551;
-	goto yy1205;
-yy1505:
+	if (yych == 't') goto yy1662;
+	goto yy1304;
+yy1613:
 	yych = *++cur;
-	if (yych == 't') goto yy1552;
-	goto yy1205;
-yy1506:
+	if (yych == 't') goto yy1663;
+	goto yy1304;
+yy1614:
 	yych = *++cur;
-	if (yych == 'n') goto yy1553;
-	if (yych == 'p') goto yy1555;
-	goto yy1205;
-yy1507:
+	if (yych == 'n') goto yy1664;
+	if (yych == 'p') goto yy1666;
+	goto yy1304;
+yy1615:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1508;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1616;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych <= '_') goto yy1557;
-		if (yych <= '`') goto yy1508;
-		if (yych <= 'z') goto yy1204;
+		if (yych <= '_') goto yy1668;
+		if (yych <= '`') goto yy1616;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1508:
-#line 533 "../src/parse/conf_lexer.re"
+yy1616:
+#line 543 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yypeek); }
-#line 8370 "src/parse/conf_lexer.cc"
-yy1509:
+#line 8491 "src/parse/conf_lexer.cc"
+yy1617:
 	yych = *++cur;
-	if (yych == 'o') goto yy1558;
-	goto yy1205;
-yy1510:
+	if (yych == 'o') goto yy1669;
+	goto yy1304;
+yy1618:
 	yych = *++cur;
-	if (yych == 'c') goto yy1559;
-	goto yy1205;
-yy1511:
+	if (yych == 'c') goto yy1670;
+	goto yy1304;
+yy1619:
 	yych = *++cur;
-	if (yych == 'o') goto yy1560;
-	goto yy1205;
-yy1512:
+	if (yych == 'o') goto yy1671;
+	goto yy1304;
+yy1620:
 	yych = *++cur;
-	if (yych == 't') goto yy1561;
-	goto yy1205;
-yy1513:
+	if (yych == 't') goto yy1672;
+	goto yy1304;
+yy1621:
 	yych = *++cur;
-	if (yych == 't') goto yy1562;
-	goto yy1205;
-yy1514:
+	if (yych == 't') goto yy1673;
+	goto yy1304;
+yy1622:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1515;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1623;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych <= '_') goto yy1563;
-		if (yych <= '`') goto yy1515;
-		if (yych <= 'z') goto yy1204;
+		if (yych <= '_') goto yy1674;
+		if (yych <= '`') goto yy1623;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1515:
-#line 534 "../src/parse/conf_lexer.re"
+yy1623:
+#line 544 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yyskip); }
-#line 8404 "src/parse/conf_lexer.cc"
-yy1516:
+#line 8525 "src/parse/conf_lexer.cc"
+yy1624:
 	yych = *++cur;
-	if (yych == 'n') goto yy1564;
-	if (yych == 'p') goto yy1566;
-	goto yy1205;
-yy1517:
+	if (yych == 'n') goto yy1675;
+	if (yych == 'p') goto yy1677;
+	goto yy1304;
+yy1625:
 	yych = *++cur;
 	if (yych <= 'k') {
-		if (yych == 'g') goto yy1568;
-		goto yy964;
+		if (yych == 'g') goto yy1679;
+		goto yy1063;
 	} else {
-		if (yych <= 'l') goto yy1569;
-		if (yych == 'r') goto yy1570;
-		goto yy964;
+		if (yych <= 'l') goto yy1680;
+		if (yych == 'r') goto yy1681;
+		goto yy1063;
 	}
-yy1518:
+yy1626:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 686 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 698 "../src/parse/conf_lexer.re"
 	{ RET_LOPT(StxLOpt::HAVE_RETVAL); }
-#line 8427 "src/parse/conf_lexer.cc"
-yy1519:
+#line 8546 "src/parse/conf_lexer.cc"
+yy1627:
 	yych = *++cur;
-	if (yych == 'n') goto yy1571;
-	goto yy941;
-yy1520:
+	if (yych == 'n') goto yy1682;
+	goto yy1040;
+yy1628:
 	yych = *++cur;
-	if (yych == 't') goto yy1572;
-	goto yy941;
-yy1521:
+	if (yych == 't') goto yy1683;
+	goto yy1040;
+yy1629:
 	yych = *++cur;
-	if (yych == 'a') goto yy1573;
-	goto yy941;
-yy1522:
+	if (yych == 'a') goto yy1684;
+	goto yy1040;
+yy1630:
 	++cur;
-#line 664 "../src/parse/conf_lexer.re"
+#line 676 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::API_DEFAULT); }
-#line 8444 "src/parse/conf_lexer.cc"
-yy1523:
+#line 8563 "src/parse/conf_lexer.cc"
+yy1631:
 	yych = *++cur;
-	if (yych == 'e') goto yy1574;
-	goto yy964;
-yy1524:
+	if (yych == 'e') goto yy1685;
+	goto yy1063;
+yy1632:
 	yych = *++cur;
-	if (yych == 'n') goto yy1575;
-	goto yy964;
-yy1525:
+	if (yych == 'n') goto yy1686;
+	goto yy1063;
+yy1633:
 	yych = *++cur;
-	if (yych == 's') goto yy1576;
-	goto yy941;
-yy1526:
+	if (yych == 's') goto yy1687;
+	goto yy1040;
+yy1634:
 	yych = *++cur;
-	if (yych == 'l') goto yy1577;
-	goto yy1205;
-yy1527:
+	if (yych == 'l') goto yy1688;
+	goto yy1304;
+yy1635:
 	yych = *++cur;
-	if (yych == 'l') goto yy1578;
-	goto yy1205;
-yy1528:
+	if (yych == 'l') goto yy1689;
+	goto yy1304;
+yy1636:
 	yych = *++cur;
-	if (yych == 'o') goto yy1579;
-	goto yy1205;
-yy1529:
+	if (yych == 'o') goto yy1690;
+	goto yy1304;
+yy1637:
 	yych = *++cur;
-	if (yych == 'l') goto yy1580;
-	goto yy1205;
-yy1530:
+	if (yych == 'd') goto yy1691;
+	goto yy1304;
+yy1638:
 	yych = *++cur;
-	if (yych == 'o') goto yy1581;
-	goto yy1205;
-yy1531:
+	if (yych == 'k') goto yy1692;
+	goto yy1304;
+yy1639:
 	yych = *++cur;
-	if (yych == 'e') goto yy1582;
-	goto yy1205;
-yy1532:
+	if (yych == 'l') goto yy1693;
+	goto yy1304;
+yy1640:
 	yych = *++cur;
-	if (yych == 'r') goto yy1583;
-	goto yy1205;
-yy1533:
+	if (yych == 'l') goto yy1694;
+	goto yy1304;
+yy1641:
 	yych = *++cur;
-	if (yych == '_') goto yy1584;
-	goto yy1205;
-yy1534:
+	if (yych == 'o') goto yy1695;
+	goto yy1304;
+yy1642:
 	yych = *++cur;
-	if (yych == 'f') goto yy1585;
-	goto yy1205;
-yy1535:
+	if (yych == 'e') goto yy1696;
+	goto yy1304;
+yy1643:
 	yych = *++cur;
-	if (yych == 'v') goto yy1586;
-	goto yy1205;
-yy1536:
+	if (yych == 'r') goto yy1697;
+	goto yy1304;
+yy1644:
 	yych = *++cur;
-	if (yych == 'c') goto yy1587;
-	goto yy1205;
-yy1537:
+	if (yych == '_') goto yy1698;
+	goto yy1304;
+yy1645:
 	yych = *++cur;
-	if (yych == 'l') goto yy1588;
-	goto yy1205;
-yy1538:
+	if (yych == 'f') goto yy1699;
+	goto yy1304;
+yy1646:
 	yych = *++cur;
-	if (yych == 'n') goto yy1590;
-	goto yy1205;
-yy1539:
+	if (yych == 'v') goto yy1700;
+	goto yy1304;
+yy1647:
 	yych = *++cur;
-	if (yych == 't') goto yy1591;
-	goto yy1205;
-yy1540:
+	if (yych == 'c') goto yy1701;
+	goto yy1304;
+yy1648:
 	yych = *++cur;
-	if (yych == 'n') goto yy1593;
-	goto yy1205;
-yy1541:
+	if (yych == 'l') goto yy1702;
+	goto yy1304;
+yy1649:
 	yych = *++cur;
-	if (yych == 'b') goto yy1594;
-	if (yych == 't') goto yy1595;
-	goto yy1205;
-yy1542:
+	if (yych == 'n') goto yy1704;
+	goto yy1304;
+yy1650:
 	yych = *++cur;
-	if (yych == 'b') goto yy1596;
-	goto yy1205;
-yy1543:
+	if (yych == 't') goto yy1705;
+	goto yy1304;
+yy1651:
 	yych = *++cur;
-	if (yych == 'a') goto yy1597;
-	goto yy1205;
-yy1544:
+	if (yych == 'n') goto yy1707;
+	goto yy1304;
+yy1652:
 	yych = *++cur;
-	if (yych == 'p') goto yy1598;
-	goto yy1205;
-yy1545:
+	if (yych == 'b') goto yy1708;
+	if (yych == 't') goto yy1709;
+	goto yy1304;
+yy1653:
 	yych = *++cur;
-	if (yych == 't') goto yy1600;
-	goto yy1205;
-yy1546:
+	if (yych == 'b') goto yy1710;
+	goto yy1304;
+yy1654:
 	yych = *++cur;
-	if (yych == 't') goto yy1601;
-	goto yy1205;
-yy1547:
+	if (yych == 'a') goto yy1711;
+	goto yy1304;
+yy1655:
+	yych = *++cur;
+	if (yych == 'p') goto yy1712;
+	goto yy1304;
+yy1656:
+	yych = *++cur;
+	if (yych == 't') goto yy1714;
+	goto yy1304;
+yy1657:
+	yych = *++cur;
+	if (yych == 't') goto yy1715;
+	goto yy1304;
+yy1658:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1548;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1659;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1548;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1659;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1548:
-#line 532 "../src/parse/conf_lexer.re"
+yy1659:
+#line 542 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yydebug); }
-#line 8554 "src/parse/conf_lexer.cc"
-yy1549:
+#line 8685 "src/parse/conf_lexer.cc"
+yy1660:
 	yych = *++cur;
-	if (yych == 'c') goto yy1602;
-	goto yy1205;
-yy1550:
+	if (yych == 'c') goto yy1716;
+	goto yy1304;
+yy1661:
 	yych = *++cur;
-	if (yych == 'n') goto yy1603;
-	goto yy1205;
-yy1551:
+	if (yych == 'n') goto yy1717;
+	goto yy1304;
+yy1662:
 	yych = *++cur;
-	if (yych == 'a') goto yy1604;
-	goto yy1205;
-yy1552:
+	if (yych == 'a') goto yy1718;
+	goto yy1304;
+yy1663:
 	yych = *++cur;
-	if (yych == 'h') goto yy1605;
-	goto yy1205;
-yy1553:
+	if (yych == 'h') goto yy1719;
+	goto yy1304;
+yy1664:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1554;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1665;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1554;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1665;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1554:
-#line 544 "../src/parse/conf_lexer.re"
+yy1665:
+#line 554 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yymtagn); }
-#line 8583 "src/parse/conf_lexer.cc"
-yy1555:
+#line 8714 "src/parse/conf_lexer.cc"
+yy1666:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1556;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1667;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1556;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1667;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1556:
-#line 546 "../src/parse/conf_lexer.re"
+yy1667:
+#line 556 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yymtagp); }
-#line 8596 "src/parse/conf_lexer.cc"
-yy1557:
+#line 8727 "src/parse/conf_lexer.cc"
+yy1668:
 	yych = *++cur;
-	if (yych == 'y') goto yy1606;
-	goto yy1205;
-yy1558:
+	if (yych == 'y') goto yy1720;
+	goto yy1304;
+yy1669:
 	yych = *++cur;
-	if (yych == 'r') goto yy1607;
-	goto yy1205;
-yy1559:
+	if (yych == 'r') goto yy1721;
+	goto yy1304;
+yy1670:
 	yych = *++cur;
-	if (yych == 'c') goto yy1608;
-	goto yy1205;
-yy1560:
+	if (yych == 'c') goto yy1722;
+	goto yy1304;
+yy1671:
 	yych = *++cur;
-	if (yych == 'n') goto yy1609;
-	goto yy1205;
-yy1561:
+	if (yych == 'n') goto yy1723;
+	goto yy1304;
+yy1672:
 	yych = *++cur;
-	if (yych == 'a') goto yy1610;
-	goto yy1205;
-yy1562:
+	if (yych == 'a') goto yy1724;
+	goto yy1304;
+yy1673:
 	yych = *++cur;
 	if (yych <= '`') {
 		if (yych <= '9') {
-			if (yych >= '0') goto yy1204;
+			if (yych >= '0') goto yy1303;
 		} else {
-			if (yych == '_') goto yy1204;
+			if (yych == '_') goto yy1303;
 		}
 	} else {
 		if (yych <= 'r') {
-			if (yych == 'm') goto yy1611;
-			goto yy1204;
+			if (yych == 'm') goto yy1725;
+			goto yy1303;
 		} else {
-			if (yych <= 's') goto yy1612;
-			if (yych <= 'z') goto yy1204;
+			if (yych <= 's') goto yy1726;
+			if (yych <= 'z') goto yy1303;
 		}
 	}
-#line 540 "../src/parse/conf_lexer.re"
+#line 550 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yyshift); }
-#line 8636 "src/parse/conf_lexer.cc"
-yy1563:
+#line 8767 "src/parse/conf_lexer.cc"
+yy1674:
 	yych = *++cur;
-	if (yych == 'y') goto yy1613;
-	goto yy1205;
-yy1564:
+	if (yych == 'y') goto yy1727;
+	goto yy1304;
+yy1675:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1565;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1676;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1565;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1676;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1565:
-#line 543 "../src/parse/conf_lexer.re"
+yy1676:
+#line 553 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yystagn); }
-#line 8653 "src/parse/conf_lexer.cc"
-yy1566:
+#line 8784 "src/parse/conf_lexer.cc"
+yy1677:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1567;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1678;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1567;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1678;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1567:
-#line 545 "../src/parse/conf_lexer.re"
+yy1678:
+#line 555 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yystagp); }
-#line 8666 "src/parse/conf_lexer.cc"
-yy1568:
+#line 8797 "src/parse/conf_lexer.cc"
+yy1679:
 	yych = *++cur;
-	if (yych == 'o') goto yy1614;
-	goto yy964;
-yy1569:
+	if (yych == 'o') goto yy1728;
+	goto yy1063;
+yy1680:
 	yych = *++cur;
-	if (yych == 'o') goto yy1615;
-	goto yy964;
-yy1570:
+	if (yych == 'o') goto yy1729;
+	goto yy1063;
+yy1681:
 	yych = *++cur;
-	if (yych == 'e') goto yy1616;
-	goto yy964;
-yy1571:
+	if (yych == 'e') goto yy1730;
+	goto yy1063;
+yy1682:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 672 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 684 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::HAVE_VER); }
-#line 8686 "src/parse/conf_lexer.cc"
-yy1572:
+#line 8815 "src/parse/conf_lexer.cc"
+yy1683:
 	yych = *++cur;
-	if (yych == 'i') goto yy1617;
-	goto yy941;
-yy1573:
+	if (yych == 'i') goto yy1731;
+	goto yy1040;
+yy1684:
 	yych = *++cur;
-	if (yych == 't') goto yy1618;
-	goto yy941;
-yy1574:
+	if (yych == 't') goto yy1732;
+	goto yy1040;
+yy1685:
 	yych = *++cur;
-	if (yych == 'e') goto yy1619;
-	goto yy964;
-yy1575:
+	if (yych == 'e') goto yy1733;
+	goto yy1063;
+yy1686:
 	yych = *++cur;
-	if (yych == 'c') goto yy1620;
-	goto yy964;
-yy1576:
+	if (yych == 'c') goto yy1734;
+	goto yy1063;
+yy1687:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 682 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 694 "../src/parse/conf_lexer.re"
 	{ RET_LOPT(StxLOpt::CHAR_LITERALS); }
-#line 8710 "src/parse/conf_lexer.cc"
-yy1577:
+#line 8837 "src/parse/conf_lexer.cc"
+yy1688:
 	yych = *++cur;
-	if (yych == 'e') goto yy1621;
-	goto yy1205;
-yy1578:
+	if (yych == 'e') goto yy1735;
+	goto yy1304;
+yy1689:
 	yych = *++cur;
-	if (yych == 'o') goto yy1622;
-	goto yy1205;
-yy1579:
+	if (yych == 'o') goto yy1736;
+	goto yy1304;
+yy1690:
 	yych = *++cur;
-	if (yych == 'c') goto yy1623;
-	goto yy1205;
-yy1580:
+	if (yych == 'c') goto yy1737;
+	goto yy1304;
+yy1691:
 	yych = *++cur;
-	if (yych == 'o') goto yy1624;
-	goto yy1205;
-yy1581:
+	if (yych == 'e') goto yy1738;
+	goto yy1304;
+yy1692:
 	yych = *++cur;
-	if (yych == 'c') goto yy1625;
-	goto yy1205;
-yy1582:
+	if (yych == 'e') goto yy1739;
+	goto yy1304;
+yy1693:
 	yych = *++cur;
-	if (yych == 'm') goto yy1626;
-	goto yy1205;
-yy1583:
+	if (yych == 'i') goto yy1740;
+	goto yy1304;
+yy1694:
+	yych = *++cur;
+	if (yych == 'o') goto yy1741;
+	goto yy1304;
+yy1695:
+	yych = *++cur;
+	if (yych == 'c') goto yy1742;
+	goto yy1304;
+yy1696:
+	yych = *++cur;
+	if (yych == 'm') goto yy1743;
+	goto yy1304;
+yy1697:
 	yych = *++cur;
-	if (yych == 'i') goto yy1628;
-	goto yy1205;
-yy1584:
+	if (yych == 'i') goto yy1745;
+	goto yy1304;
+yy1698:
 	yych = *++cur;
-	if (yych == 'e') goto yy1629;
-	goto yy1205;
-yy1585:
+	if (yych == 'e') goto yy1746;
+	goto yy1304;
+yy1699:
 	yych = *++cur;
-	if (yych == 'o') goto yy1630;
-	goto yy1205;
-yy1586:
+	if (yych == 'o') goto yy1747;
+	goto yy1304;
+yy1700:
 	yych = *++cur;
-	if (yych == 'e') goto yy1632;
-	goto yy1205;
-yy1587:
+	if (yych == 'e') goto yy1749;
+	goto yy1304;
+yy1701:
 	yych = *++cur;
-	if (yych == 'a') goto yy1633;
-	goto yy1205;
-yy1588:
+	if (yych == 'a') goto yy1750;
+	goto yy1304;
+yy1702:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1589;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1703;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1589;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1703;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1589:
-#line 527 "../src/parse/conf_lexer.re"
+yy1703:
+#line 537 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_tailcall); }
-#line 8767 "src/parse/conf_lexer.cc"
-yy1590:
+#line 8906 "src/parse/conf_lexer.cc"
+yy1704:
 	yych = *++cur;
-	if (yych == 'd') goto yy1634;
-	goto yy1205;
-yy1591:
+	if (yych == 'd') goto yy1751;
+	goto yy1304;
+yy1705:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1592;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1706;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1592;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1706;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1592:
-#line 507 "../src/parse/conf_lexer.re"
+yy1706:
+#line 517 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_type_int); }
-#line 8784 "src/parse/conf_lexer.cc"
-yy1593:
+#line 8923 "src/parse/conf_lexer.cc"
+yy1707:
 	yych = *++cur;
-	if (yych == 't') goto yy1635;
-	goto yy1205;
-yy1594:
+	if (yych == 't') goto yy1752;
+	goto yy1304;
+yy1708:
 	yych = *++cur;
-	if (yych == 'm') goto yy1637;
-	goto yy1205;
-yy1595:
+	if (yych == 'm') goto yy1754;
+	goto yy1304;
+yy1709:
 	yych = *++cur;
-	if (yych == 'a') goto yy1639;
-	goto yy1205;
-yy1596:
+	if (yych == 'a') goto yy1756;
+	goto yy1304;
+yy1710:
 	yych = *++cur;
-	if (yych == 'a') goto yy1640;
-	goto yy1205;
-yy1597:
+	if (yych == 'a') goto yy1757;
+	goto yy1304;
+yy1711:
 	yych = *++cur;
-	if (yych == 'l') goto yy1641;
-	goto yy1205;
-yy1598:
+	if (yych == 'l') goto yy1758;
+	goto yy1304;
+yy1712:
 	yych = *++cur;
 	if (yych <= '_') {
-		if (yych <= '/') goto yy1599;
-		if (yych <= '9') goto yy1204;
-		if (yych >= '_') goto yy1643;
+		if (yych <= '/') goto yy1713;
+		if (yych <= '9') goto yy1303;
+		if (yych >= '_') goto yy1760;
 	} else {
 		if (yych <= 'b') {
-			if (yych >= 'a') goto yy1204;
+			if (yych >= 'a') goto yy1303;
 		} else {
-			if (yych <= 'c') goto yy1644;
-			if (yych <= 'z') goto yy1204;
+			if (yych <= 'c') goto yy1761;
+			if (yych <= 'z') goto yy1303;
 		}
 	}
-yy1599:
-#line 535 "../src/parse/conf_lexer.re"
+yy1713:
+#line 545 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yybackup); }
-#line 8822 "src/parse/conf_lexer.cc"
-yy1600:
+#line 8961 "src/parse/conf_lexer.cc"
+yy1714:
 	yych = *++cur;
-	if (yych == 'a') goto yy1645;
-	goto yy1205;
-yy1601:
+	if (yych == 'a') goto yy1762;
+	goto yy1304;
+yy1715:
 	yych = *++cur;
-	if (yych == 'a') goto yy1646;
-	goto yy1205;
-yy1602:
+	if (yych == 'a') goto yy1763;
+	goto yy1304;
+yy1716:
 	yych = *++cur;
-	if (yych == 'e') goto yy1647;
-	goto yy1205;
-yy1603:
+	if (yych == 'e') goto yy1764;
+	goto yy1304;
+yy1717:
 	yych = *++cur;
-	if (yych == 'd') goto yy1648;
-	goto yy1205;
-yy1604:
+	if (yych == 'd') goto yy1765;
+	goto yy1304;
+yy1718:
 	yych = *++cur;
-	if (yych == 't') goto yy1650;
-	goto yy1205;
-yy1605:
+	if (yych == 't') goto yy1767;
+	goto yy1304;
+yy1719:
 	yych = *++cur;
-	if (yych == 'a') goto yy1651;
-	goto yy1205;
-yy1606:
+	if (yych == 'a') goto yy1768;
+	goto yy1304;
+yy1720:
 	yych = *++cur;
-	if (yych == 'y') goto yy1652;
-	goto yy1205;
-yy1607:
+	if (yych == 'y') goto yy1769;
+	goto yy1304;
+yy1721:
 	yych = *++cur;
-	if (yych == 'e') goto yy1653;
-	goto yy1205;
-yy1608:
+	if (yych == 'e') goto yy1770;
+	goto yy1304;
+yy1722:
 	yych = *++cur;
-	if (yych == 'e') goto yy1654;
-	goto yy1205;
-yy1609:
+	if (yych == 'e') goto yy1771;
+	goto yy1304;
+yy1723:
 	yych = *++cur;
-	if (yych == 'd') goto yy1655;
-	goto yy1205;
-yy1610:
+	if (yych == 'd') goto yy1772;
+	goto yy1304;
+yy1724:
 	yych = *++cur;
-	if (yych == 't') goto yy1657;
-	goto yy1205;
-yy1611:
+	if (yych == 't') goto yy1774;
+	goto yy1304;
+yy1725:
 	yych = *++cur;
-	if (yych == 't') goto yy1658;
-	goto yy1205;
-yy1612:
+	if (yych == 't') goto yy1775;
+	goto yy1304;
+yy1726:
 	yych = *++cur;
-	if (yych == 't') goto yy1659;
-	goto yy1205;
-yy1613:
+	if (yych == 't') goto yy1776;
+	goto yy1304;
+yy1727:
 	yych = *++cur;
-	if (yych == 'y') goto yy1660;
-	goto yy1205;
-yy1614:
+	if (yych == 'y') goto yy1777;
+	goto yy1304;
+yy1728:
 	yych = *++cur;
-	if (yych == 't') goto yy1661;
-	goto yy964;
-yy1615:
+	if (yych == 't') goto yy1778;
+	goto yy1063;
+yy1729:
 	yych = *++cur;
-	if (yych == 'o') goto yy1662;
-	goto yy964;
-yy1616:
+	if (yych == 'o') goto yy1779;
+	goto yy1063;
+yy1730:
 	yych = *++cur;
-	if (yych == 'c') goto yy1663;
-	goto yy964;
-yy1617:
+	if (yych == 'c') goto yy1780;
+	goto yy1063;
+yy1731:
 	yych = *++cur;
-	if (yych == 'o') goto yy1664;
-	goto yy941;
-yy1618:
+	if (yych == 'o') goto yy1781;
+	goto yy1040;
+yy1732:
 	yych = *++cur;
-	if (yych == 'e') goto yy1665;
-	goto yy941;
-yy1619:
+	if (yych == 'e') goto yy1782;
+	goto yy1040;
+yy1733:
 	yych = *++cur;
-	if (yych == 'f') goto yy1666;
-	goto yy964;
-yy1620:
+	if (yych == 'f') goto yy1783;
+	goto yy1063;
+yy1734:
 	yych = *++cur;
-	if (yych == 't') goto yy1667;
-	goto yy964;
-yy1621:
+	if (yych == 't') goto yy1784;
+	goto yy1063;
+yy1735:
 	yych = *++cur;
-	if (yych == 'm') goto yy1668;
-	goto yy1205;
-yy1622:
+	if (yych == 'm') goto yy1785;
+	goto yy1304;
+yy1736:
 	yych = *++cur;
-	if (yych == 'b') goto yy1670;
-	goto yy1205;
-yy1623:
+	if (yych == 'b') goto yy1787;
+	goto yy1304;
+yy1737:
 	yych = *++cur;
-	if (yych == 'a') goto yy1671;
-	goto yy1205;
-yy1624:
+	if (yych == 'a') goto yy1788;
+	goto yy1304;
+yy1738:
 	yych = *++cur;
-	if (yych == 'b') goto yy1672;
-	goto yy1205;
-yy1625:
+	if (yych == 'x') goto yy1789;
+	goto yy1304;
+yy1739:
 	yych = *++cur;
-	if (yych == 'a') goto yy1673;
-	goto yy1205;
-yy1626:
+	if (yych == 'l') goto yy1791;
+	goto yy1304;
+yy1740:
+	yych = *++cur;
+	if (yych == 'k') goto yy1792;
+	goto yy1304;
+yy1741:
+	yych = *++cur;
+	if (yych == 'b') goto yy1793;
+	goto yy1304;
+yy1742:
+	yych = *++cur;
+	if (yych == 'a') goto yy1794;
+	goto yy1304;
+yy1743:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1627;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1744;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1627;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1744;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1627:
-#line 523 "../src/parse/conf_lexer.re"
+yy1744:
+#line 533 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_enum_elem); }
-#line 8939 "src/parse/conf_lexer.cc"
-yy1628:
+#line 9090 "src/parse/conf_lexer.cc"
+yy1745:
 	yych = *++cur;
-	if (yych == 'n') goto yy1674;
-	goto yy1205;
-yy1629:
+	if (yych == 'n') goto yy1795;
+	goto yy1304;
+yy1746:
 	yych = *++cur;
-	if (yych == 'l') goto yy1675;
-	goto yy1205;
-yy1630:
+	if (yych == 'l') goto yy1796;
+	goto yy1304;
+yy1747:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1631;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1748;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1631;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1748;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1631:
-#line 530 "../src/parse/conf_lexer.re"
+yy1748:
+#line 540 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_line_info); }
-#line 8960 "src/parse/conf_lexer.cc"
-yy1632:
+#line 9111 "src/parse/conf_lexer.cc"
+yy1749:
 	yych = *++cur;
-	if (yych == '_') goto yy1676;
-	goto yy1205;
-yy1633:
+	if (yych == '_') goto yy1797;
+	goto yy1304;
+yy1750:
 	yych = *++cur;
-	if (yych == 's') goto yy1677;
-	goto yy1205;
-yy1634:
+	if (yych == 's') goto yy1798;
+	goto yy1304;
+yy1751:
 	yych = *++cur;
-	if (yych == '_') goto yy1678;
-	goto yy1205;
-yy1635:
+	if (yych == '_') goto yy1799;
+	goto yy1304;
+yy1752:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1636;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1753;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1636;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1753;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1636:
-#line 508 "../src/parse/conf_lexer.re"
+yy1753:
+#line 518 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_type_uint); }
-#line 8985 "src/parse/conf_lexer.cc"
-yy1637:
+#line 9136 "src/parse/conf_lexer.cc"
+yy1754:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1638;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1755;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1638;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1755;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1638:
-#line 510 "../src/parse/conf_lexer.re"
+yy1755:
+#line 520 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_type_yybm); }
-#line 8998 "src/parse/conf_lexer.cc"
-yy1639:
+#line 9149 "src/parse/conf_lexer.cc"
+yy1756:
 	yych = *++cur;
-	if (yych == 'r') goto yy1679;
-	goto yy1205;
-yy1640:
+	if (yych == 'r') goto yy1800;
+	goto yy1304;
+yy1757:
 	yych = *++cur;
-	if (yych == 'l') goto yy1680;
-	goto yy1205;
-yy1641:
+	if (yych == 'l') goto yy1801;
+	goto yy1304;
+yy1758:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1642;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1759;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1642;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1759;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1642:
-#line 500 "../src/parse/conf_lexer.re"
+yy1759:
+#line 509 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_var_local); }
-#line 9019 "src/parse/conf_lexer.cc"
-yy1643:
+#line 9170 "src/parse/conf_lexer.cc"
+yy1760:
 	yych = *++cur;
-	if (yych == 'y') goto yy1682;
-	goto yy1205;
-yy1644:
+	if (yych == 'y') goto yy1803;
+	goto yy1304;
+yy1761:
 	yych = *++cur;
-	if (yych == 't') goto yy1683;
-	goto yy1205;
-yy1645:
+	if (yych == 't') goto yy1804;
+	goto yy1304;
+yy1762:
 	yych = *++cur;
-	if (yych == 'g') goto yy1684;
-	goto yy1205;
-yy1646:
+	if (yych == 'g') goto yy1805;
+	goto yy1304;
+yy1763:
 	yych = *++cur;
-	if (yych == 'g') goto yy1686;
-	goto yy1205;
-yy1647:
+	if (yych == 'g') goto yy1807;
+	goto yy1304;
+yy1764:
 	yych = *++cur;
-	if (yych == 'p') goto yy1688;
-	goto yy1205;
-yy1648:
+	if (yych == 'p') goto yy1809;
+	goto yy1304;
+yy1765:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1649;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1766;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1649;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1766;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1649:
-#line 558 "../src/parse/conf_lexer.re"
+yy1766:
+#line 568 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yygetcond); }
-#line 9052 "src/parse/conf_lexer.cc"
-yy1650:
+#line 9203 "src/parse/conf_lexer.cc"
+yy1767:
 	yych = *++cur;
-	if (yych == 'e') goto yy1689;
-	goto yy1205;
-yy1651:
+	if (yych == 'e') goto yy1810;
+	goto yy1304;
+yy1768:
 	yych = *++cur;
-	if (yych == 'n') goto yy1691;
-	goto yy1205;
-yy1652:
+	if (yych == 'n') goto yy1812;
+	goto yy1304;
+yy1769:
 	yych = *++cur;
-	if (yych == 's') goto yy1693;
-	goto yy1205;
-yy1653:
+	if (yych == 's') goto yy1814;
+	goto yy1304;
+yy1770:
 	yych = *++cur;
 	if (yych <= '`') {
 		if (yych <= '9') {
-			if (yych >= '0') goto yy1204;
+			if (yych >= '0') goto yy1303;
 		} else {
-			if (yych == '_') goto yy1204;
+			if (yych == '_') goto yy1303;
 		}
 	} else {
 		if (yych <= 's') {
-			if (yych == 'c') goto yy1694;
-			goto yy1204;
+			if (yych == 'c') goto yy1815;
+			goto yy1303;
 		} else {
-			if (yych <= 't') goto yy1695;
-			if (yych <= 'z') goto yy1204;
+			if (yych <= 't') goto yy1816;
+			if (yych <= 'z') goto yy1303;
 		}
 	}
-#line 537 "../src/parse/conf_lexer.re"
+#line 547 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yyrestore); }
-#line 9084 "src/parse/conf_lexer.cc"
-yy1654:
+#line 9235 "src/parse/conf_lexer.cc"
+yy1771:
 	yych = *++cur;
-	if (yych == 'p') goto yy1696;
-	goto yy1205;
-yy1655:
+	if (yych == 'p') goto yy1817;
+	goto yy1304;
+yy1772:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1656;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1773;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1656;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1773;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1656:
-#line 559 "../src/parse/conf_lexer.re"
+yy1773:
+#line 569 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yysetcond); }
-#line 9101 "src/parse/conf_lexer.cc"
-yy1657:
+#line 9252 "src/parse/conf_lexer.cc"
+yy1774:
 	yych = *++cur;
-	if (yych == 'e') goto yy1697;
-	goto yy1205;
-yy1658:
+	if (yych == 'e') goto yy1818;
+	goto yy1304;
+yy1775:
 	yych = *++cur;
-	if (yych == 'a') goto yy1699;
-	goto yy1205;
-yy1659:
+	if (yych == 'a') goto yy1820;
+	goto yy1304;
+yy1776:
 	yych = *++cur;
-	if (yych == 'a') goto yy1700;
-	goto yy1205;
-yy1660:
+	if (yych == 'a') goto yy1821;
+	goto yy1304;
+yy1777:
 	yych = *++cur;
-	if (yych == 'b') goto yy1701;
-	if (yych == 'p') goto yy1702;
-	goto yy1205;
-yy1661:
+	if (yych == 'b') goto yy1822;
+	if (yych == 'p') goto yy1823;
+	goto yy1304;
+yy1778:
 	yych = *++cur;
-	if (yych == 'o') goto yy1703;
-	goto yy964;
-yy1662:
+	if (yych == 'o') goto yy1824;
+	goto yy1063;
+yy1779:
 	yych = *++cur;
-	if (yych == 'p') goto yy1704;
-	goto yy964;
-yy1663:
+	if (yych == 'p') goto yy1825;
+	goto yy1063;
+yy1780:
 	yych = *++cur;
-	if (yych == 'u') goto yy1705;
-	goto yy964;
-yy1664:
+	if (yych == 'u') goto yy1826;
+	goto yy1063;
+yy1781:
 	yych = *++cur;
-	if (yych == 'n') goto yy1706;
-	goto yy941;
-yy1665:
+	if (yych == 'n') goto yy1827;
+	goto yy1040;
+yy1782:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 670 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 682 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::STORABLE_STATE); }
-#line 9142 "src/parse/conf_lexer.cc"
-yy1666:
+#line 9291 "src/parse/conf_lexer.cc"
+yy1783:
 	yych = *++cur;
-	if (yych == 'o') goto yy1707;
-	goto yy964;
-yy1667:
+	if (yych == 'o') goto yy1828;
+	goto yy1063;
+yy1784:
 	yych = *++cur;
-	if (yych == 'i') goto yy1708;
-	goto yy964;
-yy1668:
+	if (yych == 'i') goto yy1829;
+	goto yy1063;
+yy1785:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1669;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1786;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1669;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1786;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1669:
-#line 506 "../src/parse/conf_lexer.re"
+yy1786:
+#line 515 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_array_elem); }
-#line 9163 "src/parse/conf_lexer.cc"
-yy1670:
+#line 9312 "src/parse/conf_lexer.cc"
+yy1787:
 	yych = *++cur;
-	if (yych == 'a') goto yy1709;
-	goto yy1205;
-yy1671:
+	if (yych == 'a') goto yy1830;
+	goto yy1304;
+yy1788:
 	yych = *++cur;
-	if (yych == 'l') goto yy1710;
-	goto yy1205;
-yy1672:
+	if (yych == 'l') goto yy1831;
+	goto yy1304;
+yy1789:
 	yych = *++cur;
-	if (yych == 'a') goto yy1712;
-	goto yy1205;
-yy1673:
+	if (yych <= '^') {
+		if (yych <= '/') goto yy1790;
+		if (yych <= '9') goto yy1303;
+	} else {
+		if (yych == '`') goto yy1790;
+		if (yych <= 'z') goto yy1303;
+	}
+yy1790:
+#line 516 "../src/parse/conf_lexer.re"
+	{ RET_CODE(code_char_index); }
+#line 9333 "src/parse/conf_lexer.cc"
+yy1791:
 	yych = *++cur;
-	if (yych == 'l') goto yy1713;
-	goto yy1205;
-yy1674:
+	if (yych == 'y') goto yy1833;
+	goto yy1304;
+yy1792:
 	yych = *++cur;
-	if (yych == 't') goto yy1715;
-	goto yy1205;
-yy1675:
+	if (yych == 'e') goto yy1835;
+	goto yy1304;
+yy1793:
 	yych = *++cur;
-	if (yych == 's') goto yy1717;
-	goto yy1205;
-yy1676:
+	if (yych == 'a') goto yy1836;
+	goto yy1304;
+yy1794:
 	yych = *++cur;
-	if (yych == 'f') goto yy1718;
-	goto yy1205;
-yy1677:
+	if (yych == 'l') goto yy1837;
+	goto yy1304;
+yy1795:
 	yych = *++cur;
-	if (yych == 'e') goto yy1719;
-	goto yy1205;
-yy1678:
+	if (yych == 't') goto yy1839;
+	goto yy1304;
+yy1796:
 	yych = *++cur;
-	if (yych == 'e') goto yy1720;
-	goto yy1205;
-yy1679:
+	if (yych == 's') goto yy1841;
+	goto yy1304;
+yy1797:
 	yych = *++cur;
-	if (yych == 'g') goto yy1721;
-	goto yy1205;
-yy1680:
+	if (yych == 'f') goto yy1842;
+	goto yy1304;
+yy1798:
+	yych = *++cur;
+	if (yych == 'e') goto yy1843;
+	goto yy1304;
+yy1799:
+	yych = *++cur;
+	if (yych == 'e') goto yy1844;
+	goto yy1304;
+yy1800:
+	yych = *++cur;
+	if (yych == 'g') goto yy1845;
+	goto yy1304;
+yy1801:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1681;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1802;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1681;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1802;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1681:
-#line 501 "../src/parse/conf_lexer.re"
+yy1802:
+#line 510 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_var_global); }
-#line 9216 "src/parse/conf_lexer.cc"
-yy1682:
+#line 9386 "src/parse/conf_lexer.cc"
+yy1803:
 	yych = *++cur;
-	if (yych == 'y') goto yy1722;
-	goto yy1205;
-yy1683:
+	if (yych == 'y') goto yy1846;
+	goto yy1304;
+yy1804:
 	yych = *++cur;
-	if (yych == 'x') goto yy1723;
-	goto yy1205;
-yy1684:
+	if (yych == 'x') goto yy1847;
+	goto yy1304;
+yy1805:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1685;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1806;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1685;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1806;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1685:
-#line 547 "../src/parse/conf_lexer.re"
+yy1806:
+#line 557 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yycopymtag); }
-#line 9237 "src/parse/conf_lexer.cc"
-yy1686:
+#line 9407 "src/parse/conf_lexer.cc"
+yy1807:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1687;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1808;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1687;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1808;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1687:
-#line 548 "../src/parse/conf_lexer.re"
+yy1808:
+#line 558 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yycopystag); }
-#line 9250 "src/parse/conf_lexer.cc"
-yy1688:
+#line 9420 "src/parse/conf_lexer.cc"
+yy1809:
 	yych = *++cur;
-	if (yych == 't') goto yy1725;
-	goto yy1205;
-yy1689:
+	if (yych == 't') goto yy1849;
+	goto yy1304;
+yy1810:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1690;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1811;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1690;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1811;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1690:
-#line 560 "../src/parse/conf_lexer.re"
+yy1811:
+#line 570 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yygetstate); }
-#line 9267 "src/parse/conf_lexer.cc"
-yy1691:
+#line 9437 "src/parse/conf_lexer.cc"
+yy1812:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1692;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1813;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1692;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1813;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1692:
-#line 562 "../src/parse/conf_lexer.re"
+yy1813:
+#line 572 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yylessthan); }
-#line 9280 "src/parse/conf_lexer.cc"
-yy1693:
+#line 9450 "src/parse/conf_lexer.cc"
+yy1814:
 	yych = *++cur;
-	if (yych == 'k') goto yy1727;
-	goto yy1205;
-yy1694:
+	if (yych == 'k') goto yy1851;
+	goto yy1304;
+yy1815:
 	yych = *++cur;
-	if (yych == 't') goto yy1728;
-	goto yy1205;
-yy1695:
+	if (yych == 't') goto yy1852;
+	goto yy1304;
+yy1816:
 	yych = *++cur;
-	if (yych == 'a') goto yy1729;
-	goto yy1205;
-yy1696:
+	if (yych == 'a') goto yy1853;
+	goto yy1304;
+yy1817:
 	yych = *++cur;
-	if (yych == 't') goto yy1730;
-	goto yy1205;
-yy1697:
+	if (yych == 't') goto yy1854;
+	goto yy1304;
+yy1818:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1698;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1819;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1698;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1819;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1698:
-#line 561 "../src/parse/conf_lexer.re"
+yy1819:
+#line 571 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yysetstate); }
-#line 9309 "src/parse/conf_lexer.cc"
-yy1699:
+#line 9479 "src/parse/conf_lexer.cc"
+yy1820:
 	yych = *++cur;
-	if (yych == 'g') goto yy1732;
-	goto yy1205;
-yy1700:
+	if (yych == 'g') goto yy1856;
+	goto yy1304;
+yy1821:
 	yych = *++cur;
-	if (yych == 'g') goto yy1734;
-	goto yy1205;
-yy1701:
+	if (yych == 'g') goto yy1858;
+	goto yy1304;
+yy1822:
 	yych = *++cur;
-	if (yych == 'a') goto yy1736;
-	goto yy1205;
-yy1702:
+	if (yych == 'a') goto yy1860;
+	goto yy1304;
+yy1823:
 	yych = *++cur;
-	if (yych == 'e') goto yy1737;
-	goto yy1205;
-yy1703:
+	if (yych == 'e') goto yy1861;
+	goto yy1304;
+yy1824:
 	yych = *++cur;
-	if (yych == '_') goto yy1738;
-	goto yy964;
-yy1704:
+	if (yych == '_') goto yy1862;
+	goto yy1063;
+yy1825:
 	yych = *++cur;
-	if (yych == '_') goto yy1739;
-	goto yy964;
-yy1705:
+	if (yych == '_') goto yy1863;
+	goto yy1063;
+yy1826:
 	yych = *++cur;
-	if (yych == 'r') goto yy1740;
-	goto yy964;
-yy1706:
+	if (yych == 'r') goto yy1864;
+	goto yy1063;
+yy1827:
 	yych = *++cur;
-	if (yych == 's') goto yy1741;
-	goto yy941;
-yy1707:
+	if (yych == 's') goto yy1865;
+	goto yy1040;
+yy1828:
 	yych = *++cur;
-	if (yych == 'r') goto yy1742;
-	goto yy964;
-yy1708:
+	if (yych == 'r') goto yy1866;
+	goto yy1063;
+yy1829:
 	yych = *++cur;
-	if (yych == 'o') goto yy1743;
-	goto yy964;
-yy1709:
+	if (yych == 'o') goto yy1867;
+	goto yy1063;
+yy1830:
 	yych = *++cur;
-	if (yych == 'l') goto yy1744;
-	goto yy1205;
-yy1710:
+	if (yych == 'l') goto yy1868;
+	goto yy1304;
+yy1831:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1711;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1832;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1711;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1832;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1711:
-#line 504 "../src/parse/conf_lexer.re"
+yy1832:
+#line 513 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_array_local); }
-#line 9366 "src/parse/conf_lexer.cc"
-yy1712:
+#line 9536 "src/parse/conf_lexer.cc"
+yy1833:
 	yych = *++cur;
-	if (yych == 'l') goto yy1746;
-	goto yy1205;
-yy1713:
+	if (yych <= '^') {
+		if (yych <= '/') goto yy1834;
+		if (yych <= '9') goto yy1303;
+	} else {
+		if (yych == '`') goto yy1834;
+		if (yych <= 'z') goto yy1303;
+	}
+yy1834:
+#line 573 "../src/parse/conf_lexer.re"
+	{ RET_CODE(code_cond_likely); }
+#line 9549 "src/parse/conf_lexer.cc"
+yy1835:
+	yych = *++cur;
+	if (yych == 'l') goto yy1870;
+	goto yy1304;
+yy1836:
+	yych = *++cur;
+	if (yych == 'l') goto yy1871;
+	goto yy1304;
+yy1837:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1714;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1838;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1714;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1838;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1714:
-#line 502 "../src/parse/conf_lexer.re"
+yy1838:
+#line 511 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_const_local); }
-#line 9383 "src/parse/conf_lexer.cc"
-yy1715:
+#line 9570 "src/parse/conf_lexer.cc"
+yy1839:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1716;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1840;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1716;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1840;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1716:
-#line 529 "../src/parse/conf_lexer.re"
+yy1840:
+#line 539 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_fingerprint); }
-#line 9396 "src/parse/conf_lexer.cc"
-yy1717:
+#line 9583 "src/parse/conf_lexer.cc"
+yy1841:
 	yych = *++cur;
-	if (yych == 'e') goto yy1748;
-	goto yy1205;
-yy1718:
+	if (yych == 'e') goto yy1873;
+	goto yy1304;
+yy1842:
 	yych = *++cur;
-	if (yych == 'u') goto yy1750;
-	goto yy1205;
-yy1719:
+	if (yych == 'u') goto yy1875;
+	goto yy1304;
+yy1843:
 	yych = *++cur;
-	if (yych == '_') goto yy1751;
-	if (yych == 's') goto yy1752;
-	goto yy1205;
-yy1720:
+	if (yych == '_') goto yy1876;
+	if (yych == 's') goto yy1877;
+	goto yy1304;
+yy1844:
 	yych = *++cur;
-	if (yych == 'n') goto yy1754;
-	goto yy1205;
-yy1721:
+	if (yych == 'n') goto yy1879;
+	goto yy1304;
+yy1845:
 	yych = *++cur;
-	if (yych == 'e') goto yy1755;
-	goto yy1205;
-yy1722:
+	if (yych == 'e') goto yy1880;
+	goto yy1304;
+yy1846:
 	yych = *++cur;
-	if (yych == 'p') goto yy1756;
-	if (yych == 's') goto yy1757;
-	goto yy1205;
-yy1723:
+	if (yych == 'p') goto yy1881;
+	if (yych == 's') goto yy1882;
+	goto yy1304;
+yy1847:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1724;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1848;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1724;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1848;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1724:
-#line 536 "../src/parse/conf_lexer.re"
+yy1848:
+#line 546 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yybackupctx); }
-#line 9435 "src/parse/conf_lexer.cc"
-yy1725:
+#line 9622 "src/parse/conf_lexer.cc"
+yy1849:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1726;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1850;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1726;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1850;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1726:
-#line 556 "../src/parse/conf_lexer.re"
+yy1850:
+#line 566 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yygetaccept); }
-#line 9448 "src/parse/conf_lexer.cc"
-yy1727:
+#line 9635 "src/parse/conf_lexer.cc"
+yy1851:
 	yych = *++cur;
-	if (yych == 'i') goto yy1758;
-	goto yy1205;
-yy1728:
+	if (yych == 'i') goto yy1883;
+	goto yy1304;
+yy1852:
 	yych = *++cur;
-	if (yych == 'x') goto yy1759;
-	goto yy1205;
-yy1729:
+	if (yych == 'x') goto yy1884;
+	goto yy1304;
+yy1853:
 	yych = *++cur;
-	if (yych == 'g') goto yy1761;
-	goto yy1205;
-yy1730:
+	if (yych == 'g') goto yy1886;
+	goto yy1304;
+yy1854:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1731;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1855;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1731;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1855;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1731:
-#line 557 "../src/parse/conf_lexer.re"
+yy1855:
+#line 567 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yysetaccept); }
-#line 9473 "src/parse/conf_lexer.cc"
-yy1732:
+#line 9660 "src/parse/conf_lexer.cc"
+yy1856:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1733;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1857;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1733;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1857;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1733:
-#line 541 "../src/parse/conf_lexer.re"
+yy1857:
+#line 551 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yyshiftmtag); }
-#line 9486 "src/parse/conf_lexer.cc"
-yy1734:
+#line 9673 "src/parse/conf_lexer.cc"
+yy1858:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1735;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1859;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1735;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1859;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1735:
-#line 542 "../src/parse/conf_lexer.re"
+yy1859:
+#line 552 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yyshiftstag); }
-#line 9499 "src/parse/conf_lexer.cc"
-yy1736:
+#line 9686 "src/parse/conf_lexer.cc"
+yy1860:
 	yych = *++cur;
-	if (yych == 'c') goto yy1763;
-	goto yy1205;
-yy1737:
+	if (yych == 'c') goto yy1888;
+	goto yy1304;
+yy1861:
 	yych = *++cur;
-	if (yych == 'e') goto yy1764;
-	goto yy1205;
-yy1738:
+	if (yych == 'e') goto yy1889;
+	goto yy1304;
+yy1862:
 	yych = *++cur;
-	if (yych == 'l') goto yy1765;
-	goto yy964;
-yy1739:
+	if (yych == 'l') goto yy1890;
+	goto yy1063;
+yy1863:
 	yych = *++cur;
-	if (yych == 's') goto yy1766;
-	goto yy964;
-yy1740:
+	if (yych == 's') goto yy1891;
+	goto yy1063;
+yy1864:
 	yych = *++cur;
-	if (yych == 's') goto yy1767;
-	goto yy964;
-yy1741:
+	if (yych == 's') goto yy1892;
+	goto yy1063;
+yy1865:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy940;
-	}
-#line 669 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1039;
+#line 681 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::START_CONDITIONS); }
-#line 9527 "src/parse/conf_lexer.cc"
-yy1742:
+#line 9712 "src/parse/conf_lexer.cc"
+yy1866:
 	yych = *++cur;
-	if (yych == 'm') goto yy1768;
-	goto yy964;
-yy1743:
+	if (yych == 'm') goto yy1893;
+	goto yy1063;
+yy1867:
 	yych = *++cur;
-	if (yych == 'n') goto yy1769;
-	goto yy964;
-yy1744:
+	if (yych == 'n') goto yy1894;
+	goto yy1063;
+yy1868:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1745;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1869;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1745;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1869;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1745:
-#line 505 "../src/parse/conf_lexer.re"
+yy1869:
+#line 514 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_array_global); }
-#line 9548 "src/parse/conf_lexer.cc"
-yy1746:
+#line 9733 "src/parse/conf_lexer.cc"
+yy1870:
+	yych = *++cur;
+	if (yych == 'y') goto yy1895;
+	goto yy1304;
+yy1871:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1747;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1872;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1747;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1872;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1747:
-#line 503 "../src/parse/conf_lexer.re"
+yy1872:
+#line 512 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_const_global); }
-#line 9561 "src/parse/conf_lexer.cc"
-yy1748:
+#line 9750 "src/parse/conf_lexer.cc"
+yy1873:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1749;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1874;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych <= '_') goto yy1770;
-		if (yych <= '`') goto yy1749;
-		if (yych <= 'z') goto yy1204;
+		if (yych <= '_') goto yy1897;
+		if (yych <= '`') goto yy1874;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1749:
-#line 513 "../src/parse/conf_lexer.re"
+yy1874:
+#line 523 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_if_then_else); }
-#line 9575 "src/parse/conf_lexer.cc"
-yy1750:
+#line 9764 "src/parse/conf_lexer.cc"
+yy1875:
 	yych = *++cur;
-	if (yych == 'n') goto yy1771;
-	goto yy1205;
-yy1751:
+	if (yych == 'n') goto yy1898;
+	goto yy1304;
+yy1876:
 	yych = *++cur;
-	if (yych == 'd') goto yy1772;
-	if (yych == 'r') goto yy1773;
-	goto yy1205;
-yy1752:
+	if (yych == 'd') goto yy1899;
+	if (yych == 'r') goto yy1900;
+	goto yy1304;
+yy1877:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1753;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1878;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych <= '_') goto yy1774;
-		if (yych <= '`') goto yy1753;
-		if (yych <= 'z') goto yy1204;
+		if (yych <= '_') goto yy1901;
+		if (yych <= '`') goto yy1878;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1753:
-#line 516 "../src/parse/conf_lexer.re"
+yy1878:
+#line 526 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_switch_cases); }
-#line 9598 "src/parse/conf_lexer.cc"
-yy1754:
+#line 9787 "src/parse/conf_lexer.cc"
+yy1879:
 	yych = *++cur;
-	if (yych == 'u') goto yy1775;
-	goto yy1205;
-yy1755:
+	if (yych == 'u') goto yy1902;
+	goto yy1304;
+yy1880:
 	yych = *++cur;
-	if (yych == 't') goto yy1776;
-	goto yy1205;
-yy1756:
+	if (yych == 't') goto yy1903;
+	goto yy1304;
+yy1881:
 	yych = *++cur;
-	if (yych == 'e') goto yy1778;
-	goto yy1205;
-yy1757:
+	if (yych == 'e') goto yy1905;
+	goto yy1304;
+yy1882:
 	yych = *++cur;
-	if (yych == 'k') goto yy1779;
-	goto yy1205;
-yy1758:
+	if (yych == 'k') goto yy1906;
+	goto yy1304;
+yy1883:
 	yych = *++cur;
-	if (yych == 'p') goto yy1780;
-	goto yy1205;
-yy1759:
+	if (yych == 'p') goto yy1907;
+	goto yy1304;
+yy1884:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1760;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1885;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1760;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1885;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1760:
-#line 538 "../src/parse/conf_lexer.re"
+yy1885:
+#line 548 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yyrestorectx); }
-#line 9631 "src/parse/conf_lexer.cc"
-yy1761:
+#line 9820 "src/parse/conf_lexer.cc"
+yy1886:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1762;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1887;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1762;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1887;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1762:
-#line 539 "../src/parse/conf_lexer.re"
+yy1887:
+#line 549 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yyrestoretag); }
-#line 9644 "src/parse/conf_lexer.cc"
-yy1763:
+#line 9833 "src/parse/conf_lexer.cc"
+yy1888:
 	yych = *++cur;
-	if (yych == 'k') goto yy1782;
-	goto yy1205;
-yy1764:
+	if (yych == 'k') goto yy1909;
+	goto yy1304;
+yy1889:
 	yych = *++cur;
-	if (yych == 'k') goto yy1783;
-	goto yy1205;
-yy1765:
+	if (yych == 'k') goto yy1910;
+	goto yy1304;
+yy1890:
 	yych = *++cur;
-	if (yych == 'a') goto yy1785;
-	goto yy964;
-yy1766:
+	if (yych == 'a') goto yy1912;
+	goto yy1063;
+yy1891:
 	yych = *++cur;
-	if (yych == 'w') goto yy1786;
-	goto yy964;
-yy1767:
+	if (yych == 'w') goto yy1913;
+	goto yy1063;
+yy1892:
 	yych = *++cur;
-	if (yych == 'i') goto yy1787;
-	goto yy964;
-yy1768:
+	if (yych == 'i') goto yy1914;
+	goto yy1063;
+yy1893:
 	++cur;
-#line 668 "../src/parse/conf_lexer.re"
+#line 680 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::API_STYLE_FREEFORM); }
-#line 9669 "src/parse/conf_lexer.cc"
-yy1769:
+#line 9858 "src/parse/conf_lexer.cc"
+yy1894:
 	yych = *++cur;
-	if (yych == 's') goto yy1788;
-	goto yy964;
-yy1770:
+	if (yych == 's') goto yy1915;
+	goto yy1063;
+yy1895:
 	yych = *++cur;
-	if (yych == 'o') goto yy1789;
-	goto yy1205;
-yy1771:
+	if (yych <= '^') {
+		if (yych <= '/') goto yy1896;
+		if (yych <= '9') goto yy1303;
+	} else {
+		if (yych == '`') goto yy1896;
+		if (yych <= 'z') goto yy1303;
+	}
+yy1896:
+#line 574 "../src/parse/conf_lexer.re"
+	{ RET_CODE(code_cond_unlikely); }
+#line 9875 "src/parse/conf_lexer.cc"
+yy1897:
 	yych = *++cur;
-	if (yych == 'c') goto yy1790;
-	goto yy1205;
-yy1772:
+	if (yych == 'o') goto yy1916;
+	goto yy1304;
+yy1898:
 	yych = *++cur;
-	if (yych == 'e') goto yy1791;
-	goto yy1205;
-yy1773:
+	if (yych == 'c') goto yy1917;
+	goto yy1304;
+yy1899:
 	yych = *++cur;
-	if (yych == 'a') goto yy1792;
-	goto yy1205;
-yy1774:
+	if (yych == 'e') goto yy1918;
+	goto yy1304;
+yy1900:
 	yych = *++cur;
-	if (yych == 'o') goto yy1793;
-	goto yy1205;
-yy1775:
+	if (yych == 'a') goto yy1919;
+	goto yy1304;
+yy1901:
 	yych = *++cur;
-	if (yych == 'm') goto yy1794;
-	goto yy1205;
-yy1776:
+	if (yych == 'o') goto yy1920;
+	goto yy1304;
+yy1902:
+	yych = *++cur;
+	if (yych == 'm') goto yy1921;
+	goto yy1304;
+yy1903:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1777;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1904;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1777;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1904;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1777:
-#line 511 "../src/parse/conf_lexer.re"
+yy1904:
+#line 521 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_type_yytarget); }
-#line 9710 "src/parse/conf_lexer.cc"
-yy1778:
+#line 9912 "src/parse/conf_lexer.cc"
+yy1905:
 	yych = *++cur;
-	if (yych == 'e') goto yy1796;
-	goto yy1205;
-yy1779:
+	if (yych == 'e') goto yy1923;
+	goto yy1304;
+yy1906:
 	yych = *++cur;
-	if (yych == 'i') goto yy1797;
-	goto yy1205;
-yy1780:
+	if (yych == 'i') goto yy1924;
+	goto yy1304;
+yy1907:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1781;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1908;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1781;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1908;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1781:
-#line 550 "../src/parse/conf_lexer.re"
+yy1908:
+#line 560 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yypeek_yyskip); }
-#line 9731 "src/parse/conf_lexer.cc"
-yy1782:
+#line 9933 "src/parse/conf_lexer.cc"
+yy1909:
 	yych = *++cur;
-	if (yych == 'u') goto yy1798;
-	goto yy1205;
-yy1783:
+	if (yych == 'u') goto yy1925;
+	goto yy1304;
+yy1910:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1784;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1911;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1784;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1911;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1784:
-#line 549 "../src/parse/conf_lexer.re"
+yy1911:
+#line 559 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yyskip_yypeek); }
-#line 9748 "src/parse/conf_lexer.cc"
-yy1785:
+#line 9950 "src/parse/conf_lexer.cc"
+yy1912:
 	yych = *++cur;
-	if (yych == 'b') goto yy1799;
-	goto yy964;
-yy1786:
+	if (yych == 'b') goto yy1926;
+	goto yy1063;
+yy1913:
 	yych = *++cur;
-	if (yych == 'i') goto yy1800;
-	goto yy964;
-yy1787:
+	if (yych == 'i') goto yy1927;
+	goto yy1063;
+yy1914:
 	yych = *++cur;
-	if (yych == 'v') goto yy1801;
-	goto yy964;
-yy1788:
+	if (yych == 'v') goto yy1928;
+	goto yy1063;
+yy1915:
 	++cur;
-#line 667 "../src/parse/conf_lexer.re"
+#line 679 "../src/parse/conf_lexer.re"
 	{ RET_GOPT(StxGOpt::API_STYLE_FUNCTIONS); }
-#line 9765 "src/parse/conf_lexer.cc"
-yy1789:
+#line 9967 "src/parse/conf_lexer.cc"
+yy1916:
 	yych = *++cur;
-	if (yych == 'n') goto yy1802;
-	goto yy1205;
-yy1790:
+	if (yych == 'n') goto yy1929;
+	goto yy1304;
+yy1917:
 	yych = *++cur;
-	if (yych == 't') goto yy1803;
-	goto yy1205;
-yy1791:
+	if (yych == 't') goto yy1930;
+	goto yy1304;
+yy1918:
 	yych = *++cur;
-	if (yych == 'f') goto yy1804;
-	goto yy1205;
-yy1792:
+	if (yych == 'f') goto yy1931;
+	goto yy1304;
+yy1919:
 	yych = *++cur;
-	if (yych == 'n') goto yy1805;
-	goto yy1205;
-yy1793:
+	if (yych == 'n') goto yy1932;
+	goto yy1304;
+yy1920:
 	yych = *++cur;
-	if (yych == 'n') goto yy1806;
-	goto yy1205;
-yy1794:
+	if (yych == 'n') goto yy1933;
+	goto yy1304;
+yy1921:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1795;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1922;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1795;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1922;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1795:
-#line 509 "../src/parse/conf_lexer.re"
+yy1922:
+#line 519 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_type_cond_enum); }
-#line 9798 "src/parse/conf_lexer.cc"
-yy1796:
+#line 10000 "src/parse/conf_lexer.cc"
+yy1923:
 	yych = *++cur;
-	if (yych == 'k') goto yy1807;
-	goto yy1205;
-yy1797:
+	if (yych == 'k') goto yy1934;
+	goto yy1304;
+yy1924:
 	yych = *++cur;
-	if (yych == 'p') goto yy1809;
-	goto yy1205;
-yy1798:
+	if (yych == 'p') goto yy1936;
+	goto yy1304;
+yy1925:
 	yych = *++cur;
-	if (yych == 'p') goto yy1811;
-	goto yy1205;
-yy1799:
+	if (yych == 'p') goto yy1938;
+	goto yy1304;
+yy1926:
 	yych = *++cur;
-	if (yych == 'e') goto yy1813;
-	goto yy964;
-yy1800:
+	if (yych == 'e') goto yy1940;
+	goto yy1063;
+yy1927:
 	yych = *++cur;
-	if (yych == 't') goto yy1814;
-	goto yy964;
-yy1801:
+	if (yych == 't') goto yy1941;
+	goto yy1063;
+yy1928:
 	yych = *++cur;
-	if (yych == 'e') goto yy1815;
-	goto yy964;
-yy1802:
+	if (yych == 'e') goto yy1942;
+	goto yy1063;
+yy1929:
 	yych = *++cur;
-	if (yych == 'e') goto yy1816;
-	goto yy1205;
-yy1803:
+	if (yych == 'e') goto yy1943;
+	goto yy1304;
+yy1930:
 	yych = *++cur;
-	if (yych == 'i') goto yy1817;
-	goto yy1205;
-yy1804:
+	if (yych == 'i') goto yy1944;
+	goto yy1304;
+yy1931:
 	yych = *++cur;
-	if (yych == 'a') goto yy1818;
-	goto yy1205;
-yy1805:
+	if (yych == 'a') goto yy1945;
+	goto yy1304;
+yy1932:
 	yych = *++cur;
-	if (yych == 'g') goto yy1819;
-	goto yy1205;
-yy1806:
+	if (yych == 'g') goto yy1946;
+	goto yy1304;
+yy1933:
 	yych = *++cur;
-	if (yych == 'e') goto yy1820;
-	goto yy1205;
-yy1807:
+	if (yych == 'e') goto yy1947;
+	goto yy1304;
+yy1934:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1808;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1935;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych <= '_') goto yy1821;
-		if (yych <= '`') goto yy1808;
-		if (yych <= 'z') goto yy1204;
+		if (yych <= '_') goto yy1948;
+		if (yych <= '`') goto yy1935;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1808:
-#line 553 "../src/parse/conf_lexer.re"
+yy1935:
+#line 563 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yybackup_yypeek); }
-#line 9856 "src/parse/conf_lexer.cc"
-yy1809:
+#line 10058 "src/parse/conf_lexer.cc"
+yy1936:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1810;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1937;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1810;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1937;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1810:
-#line 552 "../src/parse/conf_lexer.re"
+yy1937:
+#line 562 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yybackup_yyskip); }
-#line 9869 "src/parse/conf_lexer.cc"
-yy1811:
+#line 10071 "src/parse/conf_lexer.cc"
+yy1938:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1812;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1939;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych <= '_') goto yy1822;
-		if (yych <= '`') goto yy1812;
-		if (yych <= 'z') goto yy1204;
+		if (yych <= '_') goto yy1949;
+		if (yych <= '`') goto yy1939;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1812:
-#line 551 "../src/parse/conf_lexer.re"
+yy1939:
+#line 561 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yyskip_yybackup); }
-#line 9883 "src/parse/conf_lexer.cc"
-yy1813:
+#line 10085 "src/parse/conf_lexer.cc"
+yy1940:
 	yych = *++cur;
-	if (yych == 'l') goto yy1823;
-	goto yy964;
-yy1814:
+	if (yych == 'l') goto yy1950;
+	goto yy1063;
+yy1941:
 	yych = *++cur;
-	if (yych == 'c') goto yy1824;
-	goto yy964;
-yy1815:
+	if (yych == 'c') goto yy1951;
+	goto yy1063;
+yy1942:
 	yych = *++cur;
-	if (yych == '_') goto yy1825;
-	goto yy964;
-yy1816:
+	if (yych == '_') goto yy1952;
+	goto yy1063;
+yy1943:
 	yych = *++cur;
-	if (yych == 'l') goto yy1826;
-	goto yy1205;
-yy1817:
+	if (yych == 'l') goto yy1953;
+	goto yy1304;
+yy1944:
 	yych = *++cur;
-	if (yych == 'o') goto yy1827;
-	goto yy1205;
-yy1818:
+	if (yych == 'o') goto yy1954;
+	goto yy1304;
+yy1945:
 	yych = *++cur;
-	if (yych == 'u') goto yy1828;
-	goto yy1205;
-yy1819:
+	if (yych == 'u') goto yy1955;
+	goto yy1304;
+yy1946:
 	yych = *++cur;
-	if (yych == 'e') goto yy1829;
-	goto yy1205;
-yy1820:
+	if (yych == 'e') goto yy1956;
+	goto yy1304;
+yy1947:
 	yych = *++cur;
-	if (yych == 'l') goto yy1831;
-	goto yy1205;
-yy1821:
+	if (yych == 'l') goto yy1958;
+	goto yy1304;
+yy1948:
 	yych = *++cur;
-	if (yych == 'y') goto yy1832;
-	goto yy1205;
-yy1822:
+	if (yych == 'y') goto yy1959;
+	goto yy1304;
+yy1949:
 	yych = *++cur;
-	if (yych == 'y') goto yy1833;
-	goto yy1205;
-yy1823:
+	if (yych == 'y') goto yy1960;
+	goto yy1304;
+yy1950:
 	++cur;
-#line 652 "../src/parse/conf_lexer.re"
+#line 664 "../src/parse/conf_lexer.re"
 	{ RET_COND(globopts->code_model == CodeModel::GOTO_LABEL); }
-#line 9928 "src/parse/conf_lexer.cc"
-yy1824:
+#line 10130 "src/parse/conf_lexer.cc"
+yy1951:
 	yych = *++cur;
-	if (yych == 'h') goto yy1834;
-	goto yy964;
-yy1825:
+	if (yych == 'h') goto yy1961;
+	goto yy1063;
+yy1952:
 	yych = *++cur;
-	if (yych == 'f') goto yy1835;
-	goto yy964;
-yy1826:
+	if (yych == 'f') goto yy1962;
+	goto yy1063;
+yy1953:
 	yych = *++cur;
-	if (yych == 'i') goto yy1836;
-	goto yy1205;
-yy1827:
+	if (yych == 'i') goto yy1963;
+	goto yy1304;
+yy1954:
 	yych = *++cur;
-	if (yych == 'n') goto yy1837;
-	goto yy1205;
-yy1828:
+	if (yych == 'n') goto yy1964;
+	goto yy1304;
+yy1955:
 	yych = *++cur;
-	if (yych == 'l') goto yy1838;
-	goto yy1205;
-yy1829:
+	if (yych == 'l') goto yy1965;
+	goto yy1304;
+yy1956:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1830;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1957;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1830;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1957;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1830:
-#line 518 "../src/parse/conf_lexer.re"
+yy1957:
+#line 528 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_switch_case_range); }
-#line 9961 "src/parse/conf_lexer.cc"
-yy1831:
+#line 10163 "src/parse/conf_lexer.cc"
+yy1958:
 	yych = *++cur;
-	if (yych == 'i') goto yy1839;
-	goto yy1205;
-yy1832:
+	if (yych == 'i') goto yy1966;
+	goto yy1304;
+yy1959:
 	yych = *++cur;
-	if (yych == 'y') goto yy1840;
-	goto yy1205;
-yy1833:
+	if (yych == 'y') goto yy1967;
+	goto yy1304;
+yy1960:
 	yych = *++cur;
-	if (yych == 'y') goto yy1841;
-	goto yy1205;
-yy1834:
+	if (yych == 'y') goto yy1968;
+	goto yy1304;
+yy1961:
 	++cur;
-#line 653 "../src/parse/conf_lexer.re"
+#line 665 "../src/parse/conf_lexer.re"
 	{ RET_COND(globopts->code_model == CodeModel::LOOP_SWITCH); }
-#line 9978 "src/parse/conf_lexer.cc"
-yy1835:
+#line 10180 "src/parse/conf_lexer.cc"
+yy1962:
 	yych = *++cur;
-	if (yych == 'u') goto yy1842;
-	goto yy964;
-yy1836:
+	if (yych == 'u') goto yy1969;
+	goto yy1063;
+yy1963:
 	yych = *++cur;
-	if (yych == 'n') goto yy1843;
-	goto yy1205;
-yy1837:
+	if (yych == 'n') goto yy1970;
+	goto yy1304;
+yy1964:
 	yych = *++cur;
-	if (yych == 's') goto yy1844;
-	goto yy1205;
-yy1838:
+	if (yych == 's') goto yy1971;
+	goto yy1304;
+yy1965:
 	yych = *++cur;
-	if (yych == 't') goto yy1846;
-	goto yy1205;
-yy1839:
+	if (yych == 't') goto yy1973;
+	goto yy1304;
+yy1966:
 	yych = *++cur;
-	if (yych == 'n') goto yy1848;
-	goto yy1205;
-yy1840:
+	if (yych == 'n') goto yy1975;
+	goto yy1304;
+yy1967:
 	yych = *++cur;
-	if (yych == 's') goto yy1849;
-	goto yy1205;
-yy1841:
+	if (yych == 's') goto yy1976;
+	goto yy1304;
+yy1968:
 	yych = *++cur;
-	if (yych == 'p') goto yy1850;
-	goto yy1205;
-yy1842:
+	if (yych == 'p') goto yy1977;
+	goto yy1304;
+yy1969:
 	yych = *++cur;
-	if (yych == 'n') goto yy1851;
-	goto yy964;
-yy1843:
+	if (yych == 'n') goto yy1978;
+	goto yy1063;
+yy1970:
 	yych = *++cur;
-	if (yych == 'e') goto yy1852;
-	goto yy1205;
-yy1844:
+	if (yych == 'e') goto yy1979;
+	goto yy1304;
+yy1971:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1845;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1972;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1845;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1972;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1845:
-#line 528 "../src/parse/conf_lexer.re"
+yy1972:
+#line 538 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_recursive_functions); }
-#line 10027 "src/parse/conf_lexer.cc"
-yy1846:
+#line 10229 "src/parse/conf_lexer.cc"
+yy1973:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1847;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1974;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1847;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1974;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1847:
-#line 519 "../src/parse/conf_lexer.re"
+yy1974:
+#line 529 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_switch_case_default); }
-#line 10040 "src/parse/conf_lexer.cc"
-yy1848:
+#line 10242 "src/parse/conf_lexer.cc"
+yy1975:
 	yych = *++cur;
-	if (yych == 'e') goto yy1854;
-	goto yy1205;
-yy1849:
+	if (yych == 'e') goto yy1981;
+	goto yy1304;
+yy1976:
 	yych = *++cur;
-	if (yych == 'k') goto yy1856;
-	goto yy1205;
-yy1850:
+	if (yych == 'k') goto yy1983;
+	goto yy1304;
+yy1977:
 	yych = *++cur;
-	if (yych == 'e') goto yy1857;
-	goto yy1205;
-yy1851:
+	if (yych == 'e') goto yy1984;
+	goto yy1304;
+yy1978:
 	yych = *++cur;
-	if (yych == 'c') goto yy1858;
-	goto yy964;
-yy1852:
+	if (yych == 'c') goto yy1985;
+	goto yy1063;
+yy1979:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1853;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1980;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1853;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1980;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1853:
-#line 514 "../src/parse/conf_lexer.re"
+yy1980:
+#line 524 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_if_then_else_oneline); }
-#line 10069 "src/parse/conf_lexer.cc"
-yy1854:
+#line 10271 "src/parse/conf_lexer.cc"
+yy1981:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1855;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1982;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1855;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1982;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1855:
-#line 517 "../src/parse/conf_lexer.re"
+yy1982:
+#line 527 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_switch_cases_oneline); }
-#line 10082 "src/parse/conf_lexer.cc"
-yy1856:
+#line 10284 "src/parse/conf_lexer.cc"
+yy1983:
 	yych = *++cur;
-	if (yych == 'i') goto yy1859;
-	goto yy1205;
-yy1857:
+	if (yych == 'i') goto yy1986;
+	goto yy1304;
+yy1984:
 	yych = *++cur;
-	if (yych == 'e') goto yy1860;
-	goto yy1205;
-yy1858:
+	if (yych == 'e') goto yy1987;
+	goto yy1304;
+yy1985:
 	yych = *++cur;
-	if (yych == 't') goto yy1861;
-	goto yy964;
-yy1859:
+	if (yych == 't') goto yy1988;
+	goto yy1063;
+yy1986:
 	yych = *++cur;
-	if (yych == 'p') goto yy1862;
-	goto yy1205;
-yy1860:
+	if (yych == 'p') goto yy1989;
+	goto yy1304;
+yy1987:
 	yych = *++cur;
-	if (yych == 'k') goto yy1864;
-	goto yy1205;
-yy1861:
+	if (yych == 'k') goto yy1991;
+	goto yy1304;
+yy1988:
 	yych = *++cur;
-	if (yych == 'i') goto yy1866;
-	goto yy964;
-yy1862:
+	if (yych == 'i') goto yy1993;
+	goto yy1063;
+yy1989:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1863;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1990;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1863;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1990;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1863:
-#line 555 "../src/parse/conf_lexer.re"
+yy1990:
+#line 565 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yybackup_yypeek_yyskip); }
-#line 10119 "src/parse/conf_lexer.cc"
-yy1864:
+#line 10321 "src/parse/conf_lexer.cc"
+yy1991:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '/') goto yy1865;
-		if (yych <= '9') goto yy1204;
+		if (yych <= '/') goto yy1992;
+		if (yych <= '9') goto yy1303;
 	} else {
-		if (yych == '`') goto yy1865;
-		if (yych <= 'z') goto yy1204;
+		if (yych == '`') goto yy1992;
+		if (yych <= 'z') goto yy1303;
 	}
-yy1865:
-#line 554 "../src/parse/conf_lexer.re"
+yy1992:
+#line 564 "../src/parse/conf_lexer.re"
 	{ RET_CODE(code_yyskip_yybackup_yypeek); }
-#line 10132 "src/parse/conf_lexer.cc"
-yy1866:
+#line 10334 "src/parse/conf_lexer.cc"
+yy1993:
 	yych = *++cur;
-	if (yych != 'o') goto yy964;
+	if (yych != 'o') goto yy1063;
 	yych = *++cur;
-	if (yych != 'n') goto yy964;
+	if (yych != 'n') goto yy1063;
 	yych = *++cur;
-	if (yych != 's') goto yy964;
+	if (yych != 's') goto yy1063;
 	++cur;
-#line 654 "../src/parse/conf_lexer.re"
+#line 666 "../src/parse/conf_lexer.re"
 	{ RET_COND(globopts->code_model == CodeModel::REC_FUNC); }
-#line 10143 "src/parse/conf_lexer.cc"
+#line 10345 "src/parse/conf_lexer.cc"
 }
-#line 696 "../src/parse/conf_lexer.re"
+#line 708 "../src/parse/conf_lexer.re"
 
 
     UNREACHABLE();
@@ -10174,841 +10376,835 @@ start:
     tok = cur;
     location = cur_loc();
 
-#line 10178 "src/parse/conf_lexer.cc"
+#line 10380 "src/parse/conf_lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 192,   0, 128, 128, 192, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		192, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 192,   0, 128, 128, 192, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		192, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
 	};
 	if ((lim - cur) < 24) YYFILL(24);
 	yych = *cur;
-	if (yybm[0+yych] & 64) {
-		goto yy1871;
-	}
+	if (yybm[0+yych] & 64) goto yy1998;
 	if (yych <= 'b') {
 		if (yych <= '\n') {
-			if (yych <= 0x00) goto yy1868;
-			if (yych <= 0x08) goto yy1869;
-			goto yy1872;
+			if (yych <= 0x00) goto yy1995;
+			if (yych <= 0x08) goto yy1996;
+			goto yy1999;
 		} else {
-			if (yych == '/') goto yy1873;
-			if (yych <= 'a') goto yy1869;
-			goto yy1874;
+			if (yych == '/') goto yy2000;
+			if (yych <= 'a') goto yy1996;
+			goto yy2001;
 		}
 	} else {
 		if (yych <= 'r') {
-			if (yych <= 'c') goto yy1875;
-			if (yych == 'i') goto yy1876;
-			goto yy1869;
+			if (yych <= 'c') goto yy2002;
+			if (yych == 'i') goto yy2003;
+			goto yy1996;
 		} else {
-			if (yych <= 's') goto yy1877;
-			if (yych == 'w') goto yy1878;
-			goto yy1869;
+			if (yych <= 's') goto yy2004;
+			if (yych == 'w') goto yy2005;
+			goto yy1996;
 		}
 	}
-yy1868:
+yy1995:
 	++cur;
-#line 728 "../src/parse/conf_lexer.re"
+#line 740 "../src/parse/conf_lexer.re"
 	{ return Ret::OK; }
-#line 10245 "src/parse/conf_lexer.cc"
-yy1869:
+#line 10445 "src/parse/conf_lexer.cc"
+yy1996:
 	++cur;
-yy1870:
-#line 751 "../src/parse/conf_lexer.re"
+yy1997:
+#line 763 "../src/parse/conf_lexer.re"
 	{ RET_FAIL(error_at_tok("unexpected character: '%c'", cur[-1])); }
-#line 10251 "src/parse/conf_lexer.cc"
-yy1871:
+#line 10451 "src/parse/conf_lexer.cc"
+yy1998:
 	++cur;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
-	if (yybm[0+yych] & 64) {
-		goto yy1871;
-	}
-#line 732 "../src/parse/conf_lexer.re"
+	if (yybm[0+yych] & 64) goto yy1998;
+#line 744 "../src/parse/conf_lexer.re"
 	{ goto start; }
-#line 10261 "src/parse/conf_lexer.cc"
-yy1872:
+#line 10459 "src/parse/conf_lexer.cc"
+yy1999:
 	++cur;
-#line 730 "../src/parse/conf_lexer.re"
+#line 742 "../src/parse/conf_lexer.re"
 	{ next_line(); goto start; }
-#line 10266 "src/parse/conf_lexer.cc"
-yy1873:
+#line 10464 "src/parse/conf_lexer.cc"
+yy2000:
 	yych = *(mar = ++cur);
-	if (yych == '/') goto yy1879;
-	goto yy1870;
-yy1874:
+	if (yych == '/') goto yy2006;
+	goto yy1997;
+yy2001:
 	yych = *(mar = ++cur);
-	if (yych == 'a') goto yy1881;
-	goto yy1870;
-yy1875:
+	if (yych == 'a') goto yy2008;
+	goto yy1997;
+yy2002:
 	yych = *(mar = ++cur);
-	if (yych == 'o') goto yy1882;
-	goto yy1870;
-yy1876:
+	if (yych == 'o') goto yy2009;
+	goto yy1997;
+yy2003:
 	yych = *(mar = ++cur);
-	if (yych <= 'l') goto yy1870;
-	if (yych <= 'm') goto yy1883;
-	if (yych <= 'n') goto yy1884;
-	goto yy1870;
-yy1877:
+	if (yych <= 'l') goto yy1997;
+	if (yych <= 'm') goto yy2010;
+	if (yych <= 'n') goto yy2011;
+	goto yy1997;
+yy2004:
 	yych = *(mar = ++cur);
 	if (yych <= 's') {
-		if (yych == 'e') goto yy1885;
-		goto yy1870;
+		if (yych == 'e') goto yy2012;
+		goto yy1997;
 	} else {
-		if (yych <= 't') goto yy1886;
-		if (yych <= 'u') goto yy1887;
-		goto yy1870;
+		if (yych <= 't') goto yy2013;
+		if (yych <= 'u') goto yy2014;
+		goto yy1997;
 	}
-yy1878:
+yy2005:
 	yych = *(mar = ++cur);
-	if (yych == 'r') goto yy1888;
-	goto yy1870;
-yy1879:
+	if (yych == 'r') goto yy2015;
+	goto yy1997;
+yy2006:
 	++cur;
 	if (lim <= cur) YYFILL(1);
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy1879;
-	}
-	if (yych >= 0x01) goto yy1872;
-yy1880:
+	if (yybm[0+yych] & 128) goto yy2006;
+	if (yych >= 0x01) goto yy1999;
+yy2007:
 	cur = mar;
-	goto yy1870;
-yy1881:
+	goto yy1997;
+yy2008:
 	yych = *++cur;
-	if (yych == 'c') goto yy1889;
-	goto yy1880;
-yy1882:
+	if (yych == 'c') goto yy2016;
+	goto yy2007;
+yy2009:
 	yych = *++cur;
-	if (yych == 'd') goto yy1890;
-	if (yych == 'n') goto yy1891;
-	goto yy1880;
-yy1883:
+	if (yych == 'd') goto yy2017;
+	if (yych == 'n') goto yy2018;
+	goto yy2007;
+yy2010:
 	yych = *++cur;
-	if (yych == 'p') goto yy1892;
-	goto yy1880;
-yy1884:
+	if (yych == 'p') goto yy2019;
+	goto yy2007;
+yy2011:
 	yych = *++cur;
-	if (yych == 'd') goto yy1893;
-	goto yy1880;
-yy1885:
+	if (yych == 'd') goto yy2020;
+	goto yy2007;
+yy2012:
 	yych = *++cur;
-	if (yych == 'm') goto yy1894;
-	goto yy1880;
-yy1886:
+	if (yych == 'm') goto yy2021;
+	goto yy2007;
+yy2013:
 	yych = *++cur;
-	if (yych == 'a') goto yy1895;
-	goto yy1880;
-yy1887:
+	if (yych == 'a') goto yy2022;
+	goto yy2007;
+yy2014:
 	yych = *++cur;
-	if (yych == 'p') goto yy1896;
-	goto yy1880;
-yy1888:
+	if (yych == 'p') goto yy2023;
+	goto yy2007;
+yy2015:
 	yych = *++cur;
-	if (yych == 'a') goto yy1897;
-	goto yy1880;
-yy1889:
+	if (yych == 'a') goto yy2024;
+	goto yy2007;
+yy2016:
 	yych = *++cur;
-	if (yych == 'k') goto yy1898;
-	goto yy1880;
-yy1890:
+	if (yych == 'k') goto yy2025;
+	goto yy2007;
+yy2017:
 	yych = *++cur;
-	if (yych == 'e') goto yy1899;
-	goto yy1880;
-yy1891:
+	if (yych == 'e') goto yy2026;
+	goto yy2007;
+yy2018:
 	yych = *++cur;
-	if (yych == 'f') goto yy1900;
-	goto yy1880;
-yy1892:
+	if (yych == 'f') goto yy2027;
+	goto yy2007;
+yy2019:
 	yych = *++cur;
-	if (yych == 'l') goto yy1901;
-	goto yy1880;
-yy1893:
+	if (yych == 'l') goto yy2028;
+	goto yy2007;
+yy2020:
 	yych = *++cur;
-	if (yych == 'e') goto yy1902;
-	goto yy1880;
-yy1894:
+	if (yych == 'e') goto yy2029;
+	goto yy2007;
+yy2021:
 	yych = *++cur;
-	if (yych == 'i') goto yy1903;
-	goto yy1880;
-yy1895:
+	if (yych == 'i') goto yy2030;
+	goto yy2007;
+yy2022:
 	yych = *++cur;
-	if (yych == 'n') goto yy1904;
-	goto yy1880;
-yy1896:
+	if (yych == 'n') goto yy2031;
+	goto yy2007;
+yy2023:
 	yych = *++cur;
-	if (yych == 'p') goto yy1905;
-	goto yy1880;
-yy1897:
+	if (yych == 'p') goto yy2032;
+	goto yy2007;
+yy2024:
 	yych = *++cur;
-	if (yych == 'p') goto yy1906;
-	goto yy1880;
-yy1898:
+	if (yych == 'p') goto yy2033;
+	goto yy2007;
+yy2025:
 	yych = *++cur;
-	if (yych == 't') goto yy1907;
-	goto yy1880;
-yy1899:
+	if (yych == 't') goto yy2034;
+	goto yy2007;
+yy2026:
 	yych = *++cur;
-	if (yych == ':') goto yy1908;
-	goto yy1880;
-yy1900:
+	if (yych == ':') goto yy2035;
+	goto yy2007;
+yy2027:
 	yych = *++cur;
-	if (yych == ':') goto yy1909;
-	goto yy1880;
-yy1901:
+	if (yych == ':') goto yy2036;
+	goto yy2007;
+yy2028:
 	yych = *++cur;
-	if (yych == 'i') goto yy1910;
-	goto yy1880;
-yy1902:
+	if (yych == 'i') goto yy2037;
+	goto yy2007;
+yy2029:
 	yych = *++cur;
-	if (yych == 'n') goto yy1911;
-	goto yy1880;
-yy1903:
+	if (yych == 'n') goto yy2038;
+	goto yy2007;
+yy2030:
 	yych = *++cur;
-	if (yych == 'c') goto yy1912;
-	goto yy1880;
-yy1904:
+	if (yych == 'c') goto yy2039;
+	goto yy2007;
+yy2031:
 	yych = *++cur;
-	if (yych == 'd') goto yy1913;
-	goto yy1880;
-yy1905:
+	if (yych == 'd') goto yy2040;
+	goto yy2007;
+yy2032:
 	yych = *++cur;
-	if (yych == 'o') goto yy1914;
-	goto yy1880;
-yy1906:
+	if (yych == 'o') goto yy2041;
+	goto yy2007;
+yy2033:
 	yych = *++cur;
-	if (yych == '_') goto yy1915;
-	goto yy1880;
-yy1907:
+	if (yych == '_') goto yy2042;
+	goto yy2007;
+yy2034:
 	yych = *++cur;
-	if (yych == 'i') goto yy1916;
-	goto yy1880;
-yy1908:
+	if (yych == 'i') goto yy2043;
+	goto yy2007;
+yy2035:
 	++cur;
 	cur -= 5;
-#line 749 "../src/parse/conf_lexer.re"
+#line 761 "../src/parse/conf_lexer.re"
 	{ if (conf_parse(*this, opts) != 0) return Ret::FAIL; goto start; }
-#line 10424 "src/parse/conf_lexer.cc"
-yy1909:
+#line 10620 "src/parse/conf_lexer.cc"
+yy2036:
 	++cur;
-#line 734 "../src/parse/conf_lexer.re"
+#line 746 "../src/parse/conf_lexer.re"
 	{ CHECK_RET(lex_conf(opts)); goto start; }
-#line 10429 "src/parse/conf_lexer.cc"
-yy1910:
+#line 10625 "src/parse/conf_lexer.cc"
+yy2037:
 	yych = *++cur;
-	if (yych == 'c') goto yy1917;
-	goto yy1880;
-yy1911:
+	if (yych == 'c') goto yy2044;
+	goto yy2007;
+yy2038:
 	yych = *++cur;
-	if (yych == 't') goto yy1918;
-	goto yy1880;
-yy1912:
+	if (yych == 't') goto yy2045;
+	goto yy2007;
+yy2039:
 	yych = *++cur;
-	if (yych == 'o') goto yy1919;
-	goto yy1880;
-yy1913:
+	if (yych == 'o') goto yy2046;
+	goto yy2007;
+yy2040:
 	yych = *++cur;
-	if (yych == 'a') goto yy1920;
-	goto yy1880;
-yy1914:
+	if (yych == 'a') goto yy2047;
+	goto yy2007;
+yy2041:
 	yych = *++cur;
-	if (yych == 'r') goto yy1921;
-	goto yy1880;
-yy1915:
+	if (yych == 'r') goto yy2048;
+	goto yy2007;
+yy2042:
 	yych = *++cur;
-	if (yych == 'b') goto yy1922;
-	goto yy1880;
-yy1916:
+	if (yych == 'b') goto yy2049;
+	goto yy2007;
+yy2043:
 	yych = *++cur;
-	if (yych == 'c') goto yy1923;
-	goto yy1880;
-yy1917:
+	if (yych == 'c') goto yy2050;
+	goto yy2007;
+yy2044:
 	yych = *++cur;
-	if (yych == 'i') goto yy1924;
-	goto yy1880;
-yy1918:
+	if (yych == 'i') goto yy2051;
+	goto yy2007;
+yy2045:
 	yych = *++cur;
-	if (yych == 'a') goto yy1925;
-	goto yy1880;
-yy1919:
+	if (yych == 'a') goto yy2052;
+	goto yy2007;
+yy2046:
 	yych = *++cur;
-	if (yych == 'l') goto yy1926;
-	goto yy1880;
-yy1920:
+	if (yych == 'l') goto yy2053;
+	goto yy2007;
+yy2047:
 	yych = *++cur;
-	if (yych == 'l') goto yy1927;
-	goto yy1880;
-yy1921:
+	if (yych == 'l') goto yy2054;
+	goto yy2007;
+yy2048:
 	yych = *++cur;
-	if (yych == 't') goto yy1928;
-	goto yy1880;
-yy1922:
+	if (yych == 't') goto yy2055;
+	goto yy2007;
+yy2049:
 	yych = *++cur;
-	if (yych == 'l') goto yy1929;
-	goto yy1880;
-yy1923:
+	if (yych == 'l') goto yy2056;
+	goto yy2007;
+yy2050:
 	yych = *++cur;
-	if (yych == 'k') goto yy1930;
-	goto yy1880;
-yy1924:
+	if (yych == 'k') goto yy2057;
+	goto yy2007;
+yy2051:
 	yych = *++cur;
-	if (yych == 't') goto yy1931;
-	goto yy1880;
-yy1925:
+	if (yych == 't') goto yy2058;
+	goto yy2007;
+yy2052:
 	yych = *++cur;
-	if (yych == 't') goto yy1932;
-	goto yy1880;
-yy1926:
+	if (yych == 't') goto yy2059;
+	goto yy2007;
+yy2053:
 	yych = *++cur;
-	if (yych == 'o') goto yy1933;
-	goto yy1880;
-yy1927:
+	if (yych == 'o') goto yy2060;
+	goto yy2007;
+yy2054:
 	yych = *++cur;
-	if (yych == 'o') goto yy1934;
-	goto yy1880;
-yy1928:
+	if (yych == 'o') goto yy2061;
+	goto yy2007;
+yy2055:
 	yych = *++cur;
-	if (yych == 'e') goto yy1935;
-	goto yy1880;
-yy1929:
+	if (yych == 'e') goto yy2062;
+	goto yy2007;
+yy2056:
 	yych = *++cur;
-	if (yych == 'o') goto yy1936;
-	goto yy1880;
-yy1930:
+	if (yych == 'o') goto yy2063;
+	goto yy2007;
+yy2057:
 	yych = *++cur;
-	if (yych == '_') goto yy1937;
-	goto yy1880;
-yy1931:
+	if (yych == '_') goto yy2064;
+	goto yy2007;
+yy2058:
 	yych = *++cur;
-	if (yych == '_') goto yy1938;
-	goto yy1880;
-yy1932:
+	if (yych == '_') goto yy2065;
+	goto yy2007;
+yy2059:
 	yych = *++cur;
-	if (yych == 'i') goto yy1939;
-	goto yy1880;
-yy1933:
+	if (yych == 'i') goto yy2066;
+	goto yy2007;
+yy2060:
 	yych = *++cur;
-	if (yych == 'n') goto yy1940;
-	goto yy1880;
-yy1934:
+	if (yych == 'n') goto yy2067;
+	goto yy2007;
+yy2061:
 	yych = *++cur;
-	if (yych == 'n') goto yy1941;
-	goto yy1880;
-yy1935:
+	if (yych == 'n') goto yy2068;
+	goto yy2007;
+yy2062:
 	yych = *++cur;
-	if (yych == 'd') goto yy1942;
-	goto yy1880;
-yy1936:
+	if (yych == 'd') goto yy2069;
+	goto yy2007;
+yy2063:
 	yych = *++cur;
-	if (yych == 'c') goto yy1943;
-	goto yy1880;
-yy1937:
+	if (yych == 'c') goto yy2070;
+	goto yy2007;
+yy2064:
 	yych = *++cur;
-	if (yych == 'q') goto yy1944;
-	goto yy1880;
-yy1938:
+	if (yych == 'q') goto yy2071;
+	goto yy2007;
+yy2065:
 	yych = *++cur;
-	if (yych == 'b') goto yy1945;
-	goto yy1880;
-yy1939:
+	if (yych == 'b') goto yy2072;
+	goto yy2007;
+yy2066:
 	yych = *++cur;
-	if (yych == 'o') goto yy1946;
-	goto yy1880;
-yy1940:
+	if (yych == 'o') goto yy2073;
+	goto yy2007;
+yy2067:
 	yych = *++cur;
-	if (yych == 's') goto yy1947;
-	goto yy1880;
-yy1941:
+	if (yych == 's') goto yy2074;
+	goto yy2007;
+yy2068:
 	yych = *++cur;
-	if (yych == 'e') goto yy1948;
-	goto yy1880;
-yy1942:
+	if (yych == 'e') goto yy2075;
+	goto yy2007;
+yy2069:
 	yych = *++cur;
-	if (yych == '_') goto yy1949;
-	goto yy1880;
-yy1943:
+	if (yych == '_') goto yy2076;
+	goto yy2007;
+yy2070:
 	yych = *++cur;
-	if (yych == 'k') goto yy1950;
-	goto yy1880;
-yy1944:
+	if (yych == 'k') goto yy2077;
+	goto yy2007;
+yy2071:
 	yych = *++cur;
-	if (yych == 'u') goto yy1951;
-	goto yy1880;
-yy1945:
+	if (yych == 'u') goto yy2078;
+	goto yy2007;
+yy2072:
 	yych = *++cur;
-	if (yych == 'o') goto yy1952;
-	goto yy1880;
-yy1946:
+	if (yych == 'o') goto yy2079;
+	goto yy2007;
+yy2073:
 	yych = *++cur;
-	if (yych == 'n') goto yy1953;
-	goto yy1880;
-yy1947:
+	if (yych == 'n') goto yy2080;
+	goto yy2007;
+yy2074:
 	++cur;
-#line 742 "../src/parse/conf_lexer.re"
+#line 754 "../src/parse/conf_lexer.re"
 	{ SAVE_CONF_BOOL(semicolons); }
-#line 10582 "src/parse/conf_lexer.cc"
-yy1948:
+#line 10778 "src/parse/conf_lexer.cc"
+yy2075:
 	yych = *++cur;
-	if (yych == '_') goto yy1954;
-	goto yy1880;
-yy1949:
+	if (yych == '_') goto yy2081;
+	goto yy2007;
+yy2076:
 	yych = *++cur;
 	switch (yych) {
-		case 'a': goto yy1955;
-		case 'c': goto yy1956;
-		case 'f': goto yy1957;
-		case 't': goto yy1958;
-		default: goto yy1880;
+		case 'a': goto yy2082;
+		case 'c': goto yy2083;
+		case 'f': goto yy2084;
+		case 't': goto yy2085;
+		default: goto yy2007;
 	}
-yy1950:
-	yych = *++cur;
-	if (yych == 's') goto yy1959;
-	goto yy1880;
-yy1951:
-	yych = *++cur;
-	if (yych == 'o') goto yy1960;
-	goto yy1880;
-yy1952:
-	yych = *++cur;
-	if (yych == 'o') goto yy1961;
-	goto yy1880;
-yy1953:
-	yych = *++cur;
-	if (yych == '_') goto yy1962;
-	goto yy1880;
-yy1954:
-	yych = *++cur;
-	if (yych == 's') goto yy1963;
-	goto yy1880;
-yy1955:
-	yych = *++cur;
-	if (yych == 'p') goto yy1964;
-	goto yy1880;
-yy1956:
-	yych = *++cur;
-	if (yych == 'o') goto yy1965;
-	goto yy1880;
-yy1957:
-	yych = *++cur;
-	if (yych == 'e') goto yy1966;
-	goto yy1880;
-yy1958:
+yy2077:
+	yych = *++cur;
+	if (yych == 's') goto yy2086;
+	goto yy2007;
+yy2078:
+	yych = *++cur;
+	if (yych == 'o') goto yy2087;
+	goto yy2007;
+yy2079:
+	yych = *++cur;
+	if (yych == 'o') goto yy2088;
+	goto yy2007;
+yy2080:
+	yych = *++cur;
+	if (yych == '_') goto yy2089;
+	goto yy2007;
+yy2081:
+	yych = *++cur;
+	if (yych == 's') goto yy2090;
+	goto yy2007;
+yy2082:
+	yych = *++cur;
+	if (yych == 'p') goto yy2091;
+	goto yy2007;
+yy2083:
+	yych = *++cur;
+	if (yych == 'o') goto yy2092;
+	goto yy2007;
+yy2084:
+	yych = *++cur;
+	if (yych == 'e') goto yy2093;
+	goto yy2007;
+yy2085:
+	yych = *++cur;
+	if (yych == 'a') goto yy2094;
+	goto yy2007;
+yy2086:
+	yych = *++cur;
+	if (yych == '_') goto yy2095;
+	goto yy2007;
+yy2087:
+	yych = *++cur;
+	if (yych == 't') goto yy2096;
+	goto yy2007;
+yy2088:
+	yych = *++cur;
+	if (yych == 'l') goto yy2097;
+	goto yy2007;
+yy2089:
+	yych = *++cur;
+	if (yych == 's') goto yy2098;
+	goto yy2007;
+yy2090:
+	yych = *++cur;
+	if (yych == 'i') goto yy2099;
+	goto yy2007;
+yy2091:
+	yych = *++cur;
+	if (yych == 'i') goto yy2100;
+	goto yy2007;
+yy2092:
+	yych = *++cur;
+	if (yych == 'd') goto yy2101;
+	goto yy2007;
+yy2093:
+	yych = *++cur;
+	if (yych == 'a') goto yy2102;
+	goto yy2007;
+yy2094:
+	yych = *++cur;
+	if (yych == 'r') goto yy2103;
+	goto yy2007;
+yy2095:
+	yych = *++cur;
+	if (yych == 'i') goto yy2104;
+	goto yy2007;
+yy2096:
+	yych = *++cur;
+	if (yych == 'e') goto yy2105;
+	goto yy2007;
+yy2097:
+	yych = *++cur;
+	if (yych == '_') goto yy2106;
+	goto yy2007;
+yy2098:
+	yych = *++cur;
+	if (yych == 'e') goto yy2107;
+	goto yy2007;
+yy2099:
+	yych = *++cur;
+	if (yych == 'n') goto yy2108;
+	goto yy2007;
+yy2100:
+	yych = *++cur;
+	if (yych == '_') goto yy2109;
+	if (yych == 's') goto yy2110;
+	goto yy2007;
+yy2101:
 	yych = *++cur;
-	if (yych == 'a') goto yy1967;
-	goto yy1880;
-yy1959:
-	yych = *++cur;
-	if (yych == '_') goto yy1968;
-	goto yy1880;
-yy1960:
-	yych = *++cur;
-	if (yych == 't') goto yy1969;
-	goto yy1880;
-yy1961:
-	yych = *++cur;
-	if (yych == 'l') goto yy1970;
-	goto yy1880;
-yy1962:
-	yych = *++cur;
-	if (yych == 's') goto yy1971;
-	goto yy1880;
-yy1963:
-	yych = *++cur;
-	if (yych == 'i') goto yy1972;
-	goto yy1880;
-yy1964:
-	yych = *++cur;
-	if (yych == 'i') goto yy1973;
-	goto yy1880;
-yy1965:
-	yych = *++cur;
-	if (yych == 'd') goto yy1974;
-	goto yy1880;
-yy1966:
-	yych = *++cur;
-	if (yych == 'a') goto yy1975;
-	goto yy1880;
-yy1967:
-	yych = *++cur;
-	if (yych == 'r') goto yy1976;
-	goto yy1880;
-yy1968:
-	yych = *++cur;
-	if (yych == 'i') goto yy1977;
-	goto yy1880;
-yy1969:
-	yych = *++cur;
-	if (yych == 'e') goto yy1978;
-	goto yy1880;
-yy1970:
-	yych = *++cur;
-	if (yych == '_') goto yy1979;
-	goto yy1880;
-yy1971:
-	yych = *++cur;
-	if (yych == 'e') goto yy1980;
-	goto yy1880;
-yy1972:
-	yych = *++cur;
-	if (yych == 'n') goto yy1981;
-	goto yy1880;
-yy1973:
-	yych = *++cur;
-	if (yych == '_') goto yy1982;
-	if (yych == 's') goto yy1983;
-	goto yy1880;
-yy1974:
-	yych = *++cur;
-	if (yych == 'e') goto yy1984;
-	goto yy1880;
-yy1975:
-	yych = *++cur;
-	if (yych == 't') goto yy1985;
-	goto yy1880;
-yy1976:
-	yych = *++cur;
-	if (yych == 'g') goto yy1986;
-	goto yy1880;
-yy1977:
-	yych = *++cur;
-	if (yych == 'n') goto yy1987;
-	goto yy1880;
-yy1978:
-	yych = *++cur;
-	if (yych == 'd') goto yy1988;
-	goto yy1880;
-yy1979:
-	yych = *++cur;
-	if (yych == 'c') goto yy1989;
-	goto yy1880;
-yy1980:
-	yych = *++cur;
-	if (yych == 'n') goto yy1990;
-	goto yy1880;
-yy1981:
-	yych = *++cur;
-	if (yych == 'g') goto yy1991;
-	goto yy1880;
-yy1982:
-	yych = *++cur;
-	if (yych == 's') goto yy1992;
-	goto yy1880;
-yy1983:
+	if (yych == 'e') goto yy2111;
+	goto yy2007;
+yy2102:
+	yych = *++cur;
+	if (yych == 't') goto yy2112;
+	goto yy2007;
+yy2103:
+	yych = *++cur;
+	if (yych == 'g') goto yy2113;
+	goto yy2007;
+yy2104:
+	yych = *++cur;
+	if (yych == 'n') goto yy2114;
+	goto yy2007;
+yy2105:
+	yych = *++cur;
+	if (yych == 'd') goto yy2115;
+	goto yy2007;
+yy2106:
+	yych = *++cur;
+	if (yych == 'c') goto yy2116;
+	goto yy2007;
+yy2107:
+	yych = *++cur;
+	if (yych == 'n') goto yy2117;
+	goto yy2007;
+yy2108:
+	yych = *++cur;
+	if (yych == 'g') goto yy2118;
+	goto yy2007;
+yy2109:
+	yych = *++cur;
+	if (yych == 's') goto yy2119;
+	goto yy2007;
+yy2110:
 	++cur;
-#line 736 "../src/parse/conf_lexer.re"
+#line 748 "../src/parse/conf_lexer.re"
 	{ SAVE_CONF_LIST(supported_apis); }
-#line 10733 "src/parse/conf_lexer.cc"
-yy1984:
+#line 10929 "src/parse/conf_lexer.cc"
+yy2111:
 	yych = *++cur;
-	if (yych == '_') goto yy1993;
-	goto yy1880;
-yy1985:
+	if (yych == '_') goto yy2120;
+	goto yy2007;
+yy2112:
 	yych = *++cur;
-	if (yych == 'u') goto yy1994;
-	goto yy1880;
-yy1986:
+	if (yych == 'u') goto yy2121;
+	goto yy2007;
+yy2113:
 	yych = *++cur;
-	if (yych == 'e') goto yy1995;
-	goto yy1880;
-yy1987:
+	if (yych == 'e') goto yy2122;
+	goto yy2007;
+yy2114:
 	yych = *++cur;
-	if (yych == '_') goto yy1996;
-	goto yy1880;
-yy1988:
+	if (yych == '_') goto yy2123;
+	goto yy2007;
+yy2115:
 	yych = *++cur;
-	if (yych == '_') goto yy1997;
-	goto yy1880;
-yy1989:
+	if (yych == '_') goto yy2124;
+	goto yy2007;
+yy2116:
 	yych = *++cur;
-	if (yych == 'o') goto yy1998;
-	goto yy1880;
-yy1990:
+	if (yych == 'o') goto yy2125;
+	goto yy2007;
+yy2117:
 	yych = *++cur;
-	if (yych == 's') goto yy1999;
-	goto yy1880;
-yy1991:
+	if (yych == 's') goto yy2126;
+	goto yy2007;
+yy2118:
 	yych = *++cur;
-	if (yych == 'l') goto yy2000;
-	goto yy1880;
-yy1992:
+	if (yych == 'l') goto yy2127;
+	goto yy2007;
+yy2119:
 	yych = *++cur;
-	if (yych == 't') goto yy2001;
-	goto yy1880;
-yy1993:
+	if (yych == 't') goto yy2128;
+	goto yy2007;
+yy2120:
 	yych = *++cur;
-	if (yych == 'm') goto yy2002;
-	goto yy1880;
-yy1994:
+	if (yych == 'm') goto yy2129;
+	goto yy2007;
+yy2121:
 	yych = *++cur;
-	if (yych == 'r') goto yy2003;
-	goto yy1880;
-yy1995:
+	if (yych == 'r') goto yy2130;
+	goto yy2007;
+yy2122:
 	yych = *++cur;
-	if (yych == 't') goto yy2004;
-	goto yy1880;
-yy1996:
+	if (yych == 't') goto yy2131;
+	goto yy2007;
+yy2123:
 	yych = *++cur;
-	if (yych == 'b') goto yy2005;
-	goto yy1880;
-yy1997:
+	if (yych == 'b') goto yy2132;
+	goto yy2007;
+yy2124:
 	yych = *++cur;
-	if (yych == 's') goto yy2006;
-	goto yy1880;
-yy1998:
+	if (yych == 's') goto yy2133;
+	goto yy2007;
+yy2125:
 	yych = *++cur;
-	if (yych == 'n') goto yy2007;
-	goto yy1880;
-yy1999:
+	if (yych == 'n') goto yy2134;
+	goto yy2007;
+yy2126:
 	yych = *++cur;
-	if (yych == 'i') goto yy2008;
-	goto yy1880;
-yy2000:
+	if (yych == 'i') goto yy2135;
+	goto yy2007;
+yy2127:
 	yych = *++cur;
-	if (yych == 'e') goto yy2009;
-	goto yy1880;
-yy2001:
+	if (yych == 'e') goto yy2136;
+	goto yy2007;
+yy2128:
 	yych = *++cur;
-	if (yych == 'y') goto yy2010;
-	goto yy1880;
-yy2002:
+	if (yych == 'y') goto yy2137;
+	goto yy2007;
+yy2129:
 	yych = *++cur;
-	if (yych == 'o') goto yy2011;
-	goto yy1880;
-yy2003:
+	if (yych == 'o') goto yy2138;
+	goto yy2007;
+yy2130:
 	yych = *++cur;
-	if (yych == 'e') goto yy2012;
-	goto yy1880;
-yy2004:
+	if (yych == 'e') goto yy2139;
+	goto yy2007;
+yy2131:
 	yych = *++cur;
-	if (yych == 's') goto yy2013;
-	goto yy1880;
-yy2005:
+	if (yych == 's') goto yy2140;
+	goto yy2007;
+yy2132:
 	yych = *++cur;
-	if (yych == 'r') goto yy2014;
-	goto yy1880;
-yy2006:
+	if (yych == 'r') goto yy2141;
+	goto yy2007;
+yy2133:
 	yych = *++cur;
-	if (yych == 't') goto yy2015;
-	goto yy1880;
-yy2007:
+	if (yych == 't') goto yy2142;
+	goto yy2007;
+yy2134:
 	yych = *++cur;
-	if (yych == 'v') goto yy2016;
-	goto yy1880;
-yy2008:
+	if (yych == 'v') goto yy2143;
+	goto yy2007;
+yy2135:
 	yych = *++cur;
-	if (yych == 't') goto yy2017;
-	goto yy1880;
-yy2009:
+	if (yych == 't') goto yy2144;
+	goto yy2007;
+yy2136:
 	yych = *++cur;
-	if (yych == '_') goto yy2018;
-	goto yy1880;
-yy2010:
+	if (yych == '_') goto yy2145;
+	goto yy2007;
+yy2137:
 	yych = *++cur;
-	if (yych == 'l') goto yy2019;
-	goto yy1880;
-yy2011:
+	if (yych == 'l') goto yy2146;
+	goto yy2007;
+yy2138:
 	yych = *++cur;
-	if (yych == 'd') goto yy2020;
-	goto yy1880;
-yy2012:
+	if (yych == 'd') goto yy2147;
+	goto yy2007;
+yy2139:
 	yych = *++cur;
-	if (yych == 's') goto yy2021;
-	goto yy1880;
-yy2013:
+	if (yych == 's') goto yy2148;
+	goto yy2007;
+yy2140:
 	++cur;
-#line 739 "../src/parse/conf_lexer.re"
+#line 751 "../src/parse/conf_lexer.re"
 	{ SAVE_CONF_LIST(supported_targets); }
-#line 10854 "src/parse/conf_lexer.cc"
-yy2014:
+#line 11050 "src/parse/conf_lexer.cc"
+yy2141:
 	yych = *++cur;
-	if (yych == 'a') goto yy2022;
-	goto yy1880;
-yy2015:
+	if (yych == 'a') goto yy2149;
+	goto yy2007;
+yy2142:
 	yych = *++cur;
-	if (yych == 'r') goto yy2023;
-	goto yy1880;
-yy2016:
+	if (yych == 'r') goto yy2150;
+	goto yy2007;
+yy2143:
 	yych = *++cur;
-	if (yych == 'e') goto yy2024;
-	goto yy1880;
-yy2017:
+	if (yych == 'e') goto yy2151;
+	goto yy2007;
+yy2144:
 	yych = *++cur;
-	if (yych == 'i') goto yy2025;
-	goto yy1880;
-yy2018:
+	if (yych == 'i') goto yy2152;
+	goto yy2007;
+yy2145:
 	yych = *++cur;
-	if (yych == 'q') goto yy2026;
-	goto yy1880;
-yy2019:
+	if (yych == 'q') goto yy2153;
+	goto yy2007;
+yy2146:
 	yych = *++cur;
-	if (yych == 'e') goto yy2027;
-	goto yy1880;
-yy2020:
+	if (yych == 'e') goto yy2154;
+	goto yy2007;
+yy2147:
 	yych = *++cur;
-	if (yych == 'e') goto yy2028;
-	goto yy1880;
-yy2021:
+	if (yych == 'e') goto yy2155;
+	goto yy2007;
+yy2148:
 	++cur;
-#line 740 "../src/parse/conf_lexer.re"
+#line 752 "../src/parse/conf_lexer.re"
 	{ SAVE_CONF_LIST(supported_features); }
-#line 10887 "src/parse/conf_lexer.cc"
-yy2022:
+#line 11083 "src/parse/conf_lexer.cc"
+yy2149:
 	yych = *++cur;
-	if (yych == 'c') goto yy2029;
-	goto yy1880;
-yy2023:
+	if (yych == 'c') goto yy2156;
+	goto yy2007;
+yy2150:
 	yych = *++cur;
-	if (yych == 'i') goto yy2030;
-	goto yy1880;
-yy2024:
+	if (yych == 'i') goto yy2157;
+	goto yy2007;
+yy2151:
 	yych = *++cur;
-	if (yych == 'r') goto yy2031;
-	goto yy1880;
-yy2025:
+	if (yych == 'r') goto yy2158;
+	goto yy2007;
+yy2152:
 	yych = *++cur;
-	if (yych == 'v') goto yy2032;
-	goto yy1880;
-yy2026:
+	if (yych == 'v') goto yy2159;
+	goto yy2007;
+yy2153:
 	yych = *++cur;
-	if (yych == 'u') goto yy2033;
-	goto yy1880;
-yy2027:
+	if (yych == 'u') goto yy2160;
+	goto yy2007;
+yy2154:
 	yych = *++cur;
-	if (yych == 's') goto yy2034;
-	goto yy1880;
-yy2028:
+	if (yych == 's') goto yy2161;
+	goto yy2007;
+yy2155:
 	yych = *++cur;
-	if (yych == 'l') goto yy2035;
-	goto yy1880;
-yy2029:
+	if (yych == 'l') goto yy2162;
+	goto yy2007;
+yy2156:
 	yych = *++cur;
-	if (yych == 'e') goto yy2036;
-	goto yy1880;
-yy2030:
+	if (yych == 'e') goto yy2163;
+	goto yy2007;
+yy2157:
 	yych = *++cur;
-	if (yych == 'n') goto yy2037;
-	goto yy1880;
-yy2031:
+	if (yych == 'n') goto yy2164;
+	goto yy2007;
+yy2158:
 	yych = *++cur;
-	if (yych == 's') goto yy2038;
-	goto yy1880;
-yy2032:
+	if (yych == 's') goto yy2165;
+	goto yy2007;
+yy2159:
 	yych = *++cur;
-	if (yych == 'e') goto yy2039;
-	goto yy1880;
-yy2033:
+	if (yych == 'e') goto yy2166;
+	goto yy2007;
+yy2160:
 	yych = *++cur;
-	if (yych == 'o') goto yy2040;
-	goto yy1880;
-yy2034:
+	if (yych == 'o') goto yy2167;
+	goto yy2007;
+yy2161:
 	++cur;
-#line 737 "../src/parse/conf_lexer.re"
+#line 749 "../src/parse/conf_lexer.re"
 	{ SAVE_CONF_LIST(supported_api_styles); }
-#line 10940 "src/parse/conf_lexer.cc"
-yy2035:
+#line 11136 "src/parse/conf_lexer.cc"
+yy2162:
 	yych = *++cur;
-	if (yych == 's') goto yy2041;
-	goto yy1880;
-yy2036:
+	if (yych == 's') goto yy2168;
+	goto yy2007;
+yy2163:
 	yych = *++cur;
-	if (yych == 's') goto yy2042;
-	goto yy1880;
-yy2037:
+	if (yych == 's') goto yy2169;
+	goto yy2007;
+yy2164:
 	yych = *++cur;
-	if (yych == 'g') goto yy2043;
-	goto yy1880;
-yy2038:
+	if (yych == 'g') goto yy2170;
+	goto yy2007;
+yy2165:
 	yych = *++cur;
-	if (yych == 'i') goto yy2044;
-	goto yy1880;
-yy2039:
+	if (yych == 'i') goto yy2171;
+	goto yy2007;
+yy2166:
 	++cur;
-#line 746 "../src/parse/conf_lexer.re"
+#line 758 "../src/parse/conf_lexer.re"
 	{ SAVE_CONF_BOOL(indentation_sensitive); }
-#line 10961 "src/parse/conf_lexer.cc"
-yy2040:
+#line 11157 "src/parse/conf_lexer.cc"
+yy2167:
 	yych = *++cur;
-	if (yych == 't') goto yy2045;
-	goto yy1880;
-yy2041:
+	if (yych == 't') goto yy2172;
+	goto yy2007;
+yy2168:
 	++cur;
-#line 738 "../src/parse/conf_lexer.re"
+#line 750 "../src/parse/conf_lexer.re"
 	{ SAVE_CONF_LIST(supported_code_models); }
-#line 10970 "src/parse/conf_lexer.cc"
-yy2042:
+#line 11166 "src/parse/conf_lexer.cc"
+yy2169:
 	++cur;
-#line 747 "../src/parse/conf_lexer.re"
+#line 759 "../src/parse/conf_lexer.re"
 	{ SAVE_CONF_BOOL(wrap_blocks_in_braces); }
-#line 10975 "src/parse/conf_lexer.cc"
-yy2043:
+#line 11171 "src/parse/conf_lexer.cc"
+yy2170:
 	yych = *++cur;
-	if (yych == 's') goto yy2046;
-	goto yy1880;
-yy2044:
+	if (yych == 's') goto yy2173;
+	goto yy2007;
+yy2171:
 	yych = *++cur;
-	if (yych == 'o') goto yy2047;
-	goto yy1880;
-yy2045:
+	if (yych == 'o') goto yy2174;
+	goto yy2007;
+yy2172:
 	yych = *++cur;
-	if (yych == 'e') goto yy2048;
-	goto yy1880;
-yy2046:
+	if (yych == 'e') goto yy2175;
+	goto yy2007;
+yy2173:
 	++cur;
-#line 744 "../src/parse/conf_lexer.re"
+#line 756 "../src/parse/conf_lexer.re"
 	{ SAVE_CONF_BOOL(backtick_quoted_strings); }
-#line 10992 "src/parse/conf_lexer.cc"
-yy2047:
+#line 11188 "src/parse/conf_lexer.cc"
+yy2174:
 	yych = *++cur;
-	if (yych == 'n') goto yy2049;
-	goto yy1880;
-yy2048:
+	if (yych == 'n') goto yy2176;
+	goto yy2007;
+yy2175:
 	yych = *++cur;
-	if (yych == 's') goto yy2050;
-	goto yy1880;
-yy2049:
+	if (yych == 's') goto yy2177;
+	goto yy2007;
+yy2176:
 	++cur;
-#line 743 "../src/parse/conf_lexer.re"
+#line 755 "../src/parse/conf_lexer.re"
 	{ SAVE_CONF_BOOL(implicit_bool_conversion); }
-#line 11005 "src/parse/conf_lexer.cc"
-yy2050:
+#line 11201 "src/parse/conf_lexer.cc"
+yy2177:
 	++cur;
-#line 745 "../src/parse/conf_lexer.re"
+#line 757 "../src/parse/conf_lexer.re"
 	{ SAVE_CONF_BOOL(standalone_single_quotes); }
-#line 11010 "src/parse/conf_lexer.cc"
+#line 11206 "src/parse/conf_lexer.cc"
 }
-#line 752 "../src/parse/conf_lexer.re"
+#line 764 "../src/parse/conf_lexer.re"
 
 
     UNREACHABLE();
@@ -1,4 +1,4 @@
-/* Generated by re2c 3.0 */
+/* Generated by re2c 3.1 */
 #line 1 "../src/parse/lexer.re"
 #include <ctype.h>
 #include <stdint.h>
@@ -54,39 +54,39 @@ loop:
 {
 	uint8_t yych;
 	unsigned int yyaccept = 0;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 160,   0, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		160, 128,   0, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		192, 192, 192, 192, 192, 192, 192, 192, 
-		192, 192, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128,   0, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 160,   0, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		160, 128,   0, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		192, 192, 192, 192, 192, 192, 192, 192,
+		192, 192, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128,   0, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
 	};
 	if ((lim - cur) < 18) if (!fill(18)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
@@ -108,7 +108,7 @@ loop:
 		}
 	}
 	++cur;
-#line 262 "../src/parse/lexer.re"
+#line 267 "../src/parse/lexer.re"
 	{
         if (is_eof()) {
             out.gen_raw(tok, ptr);
@@ -120,23 +120,21 @@ loop:
 yy1:
 	++cur;
 yy2:
-#line 282 "../src/parse/lexer.re"
+#line 287 "../src/parse/lexer.re"
 	{ goto loop; }
 #line 126 "src/parse/lexer.cc"
 yy3:
 	yyaccept = 0;
 	yych = *(mar = ++cur);
-	if (yybm[0+yych] & 32) {
-		goto yy8;
-	}
+	if (yybm[0+yych] & 32) goto yy8;
 	if (yych == '#') goto yy10;
 yy4:
-#line 277 "../src/parse/lexer.re"
+#line 282 "../src/parse/lexer.re"
 	{
         next_line();
         goto loop;
     }
-#line 140 "src/parse/lexer.cc"
+#line 138 "src/parse/lexer.cc"
 yy5:
 	yych = *++cur;
 	if (yych == '\n') goto yy3;
@@ -155,31 +153,23 @@ yy8:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 32) {
-		goto yy8;
-	}
+	if (yybm[0+yych] & 32) goto yy8;
 	if (yych == '#') goto yy10;
 yy9:
 	cur = mar;
 	if (yyaccept <= 2) {
 		if (yyaccept <= 1) {
-			if (yyaccept == 0) {
-				goto yy4;
-			} else {
-				goto yy2;
-			}
+			if (yyaccept == 0) goto yy4;
+			else goto yy2;
 		} else {
-			goto yy56;
+			goto yy59;
 		}
 	} else {
 		if (yyaccept <= 4) {
-			if (yyaccept == 3) {
-				goto yy128;
-			} else {
-				goto yy130;
-			}
+			if (yyaccept == 3) goto yy137;
+			else goto yy139;
 		} else {
-			goto yy156;
+			goto yy167;
 		}
 	}
 yy10:
@@ -196,52 +186,57 @@ yy10:
 	}
 yy11:
 	yych = *++cur;
-	if (yych <= 'h') {
-		if (yych <= '\r') {
-			if (yych == '\n') {
+	if (yych <= 'i') {
+		if (yych <= 'b') {
+			if (yych <= '\n') {
+				if (yych <= '\t') goto yy9;
 				yyt1 = cur;
 				goto yy14;
+			} else {
+				if (yych == '\r') {
+					yyt1 = cur;
+					goto yy15;
+				}
+				goto yy9;
 			}
-			if (yych <= '\f') goto yy9;
-			yyt1 = cur;
-			goto yy15;
 		} else {
-			if (yych <= 'c') {
-				if (yych <= 'b') goto yy9;
-				goto yy16;
+			if (yych <= 'f') {
+				if (yych <= 'c') goto yy16;
+				goto yy9;
 			} else {
-				if (yych <= 'f') goto yy9;
 				if (yych <= 'g') goto yy17;
-				goto yy18;
+				if (yych <= 'h') goto yy18;
+				goto yy19;
 			}
 		}
 	} else {
-		if (yych <= 'q') {
-			if (yych <= 'k') {
-				if (yych <= 'i') goto yy19;
-				goto yy9;
+		if (yych <= 'p') {
+			if (yych <= 'l') {
+				if (yych <= 'k') goto yy9;
+				goto yy20;
 			} else {
-				if (yych <= 'l') goto yy20;
 				if (yych <= 'm') goto yy21;
-				goto yy9;
+				if (yych <= 'o') goto yy9;
+				goto yy22;
 			}
 		} else {
 			if (yych <= 's') {
-				if (yych <= 'r') goto yy22;
-				goto yy23;
+				if (yych <= 'q') goto yy9;
+				if (yych <= 'r') goto yy23;
+				goto yy24;
 			} else {
-				if (yych == 'u') goto yy24;
+				if (yych == 'u') goto yy25;
 				goto yy9;
 			}
 		}
 	}
 yy12:
 	yych = *++cur;
-	if (yych == '!') goto yy25;
+	if (yych == '!') goto yy26;
 	goto yy9;
 yy13:
 	yych = *++cur;
-	if (yych == 'i') goto yy26;
+	if (yych == 'i') goto yy27;
 	goto yy9;
 yy14:
 	++cur;
@@ -252,207 +247,224 @@ yy14:
         CHECK_RET(lex_opt_name(block_name));
         RET_BLOCK(InputBlock::GLOBAL);
     }
-#line 256 "src/parse/lexer.cc"
+#line 251 "src/parse/lexer.cc"
 yy15:
 	yych = *++cur;
 	if (yych == '\n') goto yy14;
 	goto yy9;
 yy16:
 	yych = *++cur;
-	if (yych == 'o') goto yy27;
+	if (yych == 'o') goto yy28;
 	goto yy9;
 yy17:
 	yych = *++cur;
-	if (yych == 'e') goto yy28;
+	if (yych == 'e') goto yy29;
 	goto yy9;
 yy18:
 	yych = *++cur;
-	if (yych == 'e') goto yy29;
+	if (yych == 'e') goto yy30;
 	goto yy9;
 yy19:
 	yych = *++cur;
-	if (yych == 'g') goto yy30;
-	if (yych == 'n') goto yy31;
+	if (yych == 'g') goto yy31;
+	if (yych == 'n') goto yy32;
 	goto yy9;
 yy20:
 	yych = *++cur;
-	if (yych == 'o') goto yy32;
+	if (yych == 'o') goto yy33;
 	goto yy9;
 yy21:
 	yych = *++cur;
-	if (yych == 'a') goto yy33;
-	if (yych == 't') goto yy34;
+	if (yych == 'a') goto yy34;
+	if (yych == 't') goto yy35;
 	goto yy9;
 yy22:
 	yych = *++cur;
-	if (yych == 'u') goto yy35;
+	if (yych == 'r') goto yy36;
 	goto yy9;
 yy23:
 	yych = *++cur;
-	if (yych == 't') goto yy36;
+	if (yych == 'u') goto yy37;
 	goto yy9;
 yy24:
 	yych = *++cur;
-	if (yych == 's') goto yy37;
+	if (yych == 't') goto yy38;
 	goto yy9;
 yy25:
+	yych = *++cur;
+	if (yych == 's') goto yy39;
+	goto yy9;
+yy26:
 	yych = *++cur;
 	switch (yych) {
-		case 'c': goto yy38;
-		case 'g': goto yy39;
-		case 'h': goto yy40;
-		case 'i': goto yy41;
-		case 'l': goto yy42;
-		case 'm': goto yy43;
-		case 'r': goto yy44;
-		case 's': goto yy45;
-		case 't': goto yy46;
-		case 'u': goto yy47;
+		case 'c': goto yy40;
+		case 'g': goto yy41;
+		case 'h': goto yy42;
+		case 'i': goto yy43;
+		case 'l': goto yy44;
+		case 'm': goto yy45;
+		case 'p': goto yy46;
+		case 'r': goto yy47;
+		case 's': goto yy48;
+		case 't': goto yy49;
+		case 'u': goto yy50;
 		default: goto yy9;
 	}
-yy26:
-	yych = *++cur;
-	if (yych == 'n') goto yy48;
-	goto yy9;
 yy27:
 	yych = *++cur;
-	if (yych == 'n') goto yy49;
+	if (yych == 'n') goto yy51;
 	goto yy9;
 yy28:
 	yych = *++cur;
-	if (yych == 't') goto yy50;
+	if (yych == 'n') goto yy52;
 	goto yy9;
 yy29:
 	yych = *++cur;
-	if (yych == 'a') goto yy51;
+	if (yych == 't') goto yy53;
 	goto yy9;
 yy30:
 	yych = *++cur;
-	if (yych == 'n') goto yy52;
+	if (yych == 'a') goto yy54;
 	goto yy9;
 yy31:
 	yych = *++cur;
-	if (yych == 'c') goto yy53;
+	if (yych == 'n') goto yy55;
 	goto yy9;
 yy32:
 	yych = *++cur;
-	if (yych == 'c') goto yy54;
+	if (yych == 'c') goto yy56;
 	goto yy9;
 yy33:
 	yych = *++cur;
-	if (yych == 'x') goto yy55;
+	if (yych == 'c') goto yy57;
 	goto yy9;
 yy34:
 	yych = *++cur;
-	if (yych == 'a') goto yy57;
+	if (yych == 'x') goto yy58;
 	goto yy9;
 yy35:
 	yych = *++cur;
-	if (yych == 'l') goto yy58;
+	if (yych == 'a') goto yy60;
 	goto yy9;
 yy36:
 	yych = *++cur;
-	if (yych == 'a') goto yy59;
+	if (yych == 'o') goto yy61;
 	goto yy9;
 yy37:
 	yych = *++cur;
-	if (yych == 'e') goto yy60;
+	if (yych == 'l') goto yy62;
 	goto yy9;
 yy38:
 	yych = *++cur;
-	if (yych == 'o') goto yy61;
+	if (yych == 'a') goto yy63;
 	goto yy9;
 yy39:
 	yych = *++cur;
-	if (yych == 'e') goto yy62;
+	if (yych == 'e') goto yy64;
 	goto yy9;
 yy40:
 	yych = *++cur;
-	if (yych == 'e') goto yy63;
+	if (yych == 'o') goto yy65;
 	goto yy9;
 yy41:
 	yych = *++cur;
-	if (yych == 'g') goto yy64;
-	if (yych == 'n') goto yy65;
+	if (yych == 'e') goto yy66;
 	goto yy9;
 yy42:
 	yych = *++cur;
-	if (yych == 'o') goto yy66;
+	if (yych == 'e') goto yy67;
 	goto yy9;
 yy43:
 	yych = *++cur;
-	if (yych == 'a') goto yy67;
-	if (yych == 't') goto yy68;
+	if (yych == 'g') goto yy68;
+	if (yych == 'n') goto yy69;
 	goto yy9;
 yy44:
 	yych = *++cur;
-	if (yych == 'e') goto yy69;
-	if (yych == 'u') goto yy70;
+	if (yych == 'o') goto yy70;
 	goto yy9;
 yy45:
 	yych = *++cur;
-	if (yych == 't') goto yy71;
+	if (yych == 'a') goto yy71;
+	if (yych == 't') goto yy72;
 	goto yy9;
 yy46:
 	yych = *++cur;
-	if (yych == 'y') goto yy72;
+	if (yych == 'r') goto yy73;
 	goto yy9;
 yy47:
 	yych = *++cur;
-	if (yych == 's') goto yy73;
+	if (yych == 'e') goto yy74;
+	if (yych == 'u') goto yy75;
 	goto yy9;
 yy48:
 	yych = *++cur;
-	if (yych == 'e') goto yy74;
+	if (yych == 't') goto yy76;
 	goto yy9;
 yy49:
 	yych = *++cur;
-	if (yych == 'd') goto yy75;
+	if (yych == 'y') goto yy77;
 	goto yy9;
 yy50:
 	yych = *++cur;
-	if (yych == 's') goto yy76;
+	if (yych == 's') goto yy78;
 	goto yy9;
 yy51:
 	yych = *++cur;
-	if (yych == 'd') goto yy77;
+	if (yych == 'e') goto yy79;
 	goto yy9;
 yy52:
 	yych = *++cur;
-	if (yych == 'o') goto yy78;
+	if (yych == 'd') goto yy80;
 	goto yy9;
 yy53:
 	yych = *++cur;
-	if (yych == 'l') goto yy79;
+	if (yych == 's') goto yy81;
 	goto yy9;
 yy54:
 	yych = *++cur;
-	if (yych == 'a') goto yy80;
+	if (yych == 'd') goto yy82;
 	goto yy9;
 yy55:
+	yych = *++cur;
+	if (yych == 'o') goto yy83;
+	goto yy9;
+yy56:
+	yych = *++cur;
+	if (yych == 'l') goto yy84;
+	goto yy9;
+yy57:
+	yych = *++cur;
+	if (yych == 'a') goto yy85;
+	goto yy9;
+yy58:
 	yyaccept = 2;
 	yych = *(mar = ++cur);
-	if (yych == 'n') goto yy81;
-yy56:
+	if (yych == 'n') goto yy86;
+yy59:
 #line 178 "../src/parse/lexer.re"
 	{
         CHECK_RET(lex_special_block(out, CodeKind::MAXFILL, DCONF_FORMAT));
         goto next;
     }
-#line 443 "src/parse/lexer.cc"
-yy57:
+#line 451 "src/parse/lexer.cc"
+yy60:
 	yych = *++cur;
-	if (yych == 'g') goto yy82;
+	if (yych == 'g') goto yy87;
 	goto yy9;
-yy58:
+yy61:
 	yych = *++cur;
-	if (yych == 'e') goto yy83;
+	if (yych == 'f') goto yy88;
 	goto yy9;
-yy59:
+yy62:
 	yych = *++cur;
-	if (yych == 'g') goto yy84;
+	if (yych == 'e') goto yy89;
 	goto yy9;
-yy60:
+yy63:
+	yych = *++cur;
+	if (yych == 'g') goto yy90;
+	goto yy9;
+yy64:
 	++cur;
 #line 172 "../src/parse/lexer.re"
 	{
@@ -460,195 +472,207 @@ yy60:
         CHECK_RET(lex_opt_name(block_name));
         RET_BLOCK(InputBlock::USE);
     }
-#line 464 "src/parse/lexer.cc"
-yy61:
-	yych = *++cur;
-	if (yych == 'n') goto yy85;
-	goto yy9;
-yy62:
-	yych = *++cur;
-	if (yych == 't') goto yy86;
-	goto yy9;
-yy63:
-	yych = *++cur;
-	if (yych == 'a') goto yy87;
-	goto yy9;
-yy64:
-	yych = *++cur;
-	if (yych == 'n') goto yy88;
-	goto yy9;
+#line 476 "src/parse/lexer.cc"
 yy65:
 	yych = *++cur;
-	if (yych == 'c') goto yy89;
+	if (yych == 'n') goto yy91;
 	goto yy9;
 yy66:
 	yych = *++cur;
-	if (yych == 'c') goto yy90;
+	if (yych == 't') goto yy92;
 	goto yy9;
 yy67:
 	yych = *++cur;
-	if (yych == 'x') goto yy91;
+	if (yych == 'a') goto yy93;
 	goto yy9;
 yy68:
 	yych = *++cur;
-	if (yych == 'a') goto yy92;
+	if (yych == 'n') goto yy94;
 	goto yy9;
 yy69:
 	yych = *++cur;
-	if (yych == '2') goto yy93;
+	if (yych == 'c') goto yy95;
 	goto yy9;
 yy70:
 	yych = *++cur;
-	if (yych == 'l') goto yy94;
+	if (yych == 'c') goto yy96;
 	goto yy9;
 yy71:
 	yych = *++cur;
-	if (yych == 'a') goto yy95;
+	if (yych == 'x') goto yy97;
 	goto yy9;
 yy72:
 	yych = *++cur;
-	if (yych == 'p') goto yy96;
+	if (yych == 'a') goto yy98;
 	goto yy9;
 yy73:
 	yych = *++cur;
-	if (yych == 'e') goto yy97;
+	if (yych == 'o') goto yy99;
 	goto yy9;
 yy74:
 	yych = *++cur;
-	if (yych <= '0') goto yy99;
-	if (yych <= '9') goto yy9;
-	goto yy99;
+	if (yych == '2') goto yy100;
+	goto yy9;
 yy75:
 	yych = *++cur;
-	if (yych == 'i') goto yy100;
+	if (yych == 'l') goto yy101;
 	goto yy9;
 yy76:
 	yych = *++cur;
-	if (yych == 't') goto yy101;
+	if (yych == 'a') goto yy102;
 	goto yy9;
 yy77:
 	yych = *++cur;
-	if (yych == 'e') goto yy102;
+	if (yych == 'p') goto yy103;
 	goto yy9;
 yy78:
 	yych = *++cur;
-	if (yych == 'r') goto yy103;
+	if (yych == 'e') goto yy104;
 	goto yy9;
 yy79:
 	yych = *++cur;
-	if (yych == 'u') goto yy104;
-	goto yy9;
+	if (yych <= '0') goto yy106;
+	if (yych <= '9') goto yy9;
+	goto yy106;
 yy80:
 	yych = *++cur;
-	if (yych == 'l') goto yy105;
+	if (yych == 'i') goto yy107;
 	goto yy9;
 yy81:
 	yych = *++cur;
-	if (yych == 'm') goto yy106;
+	if (yych == 't') goto yy108;
 	goto yy9;
 yy82:
 	yych = *++cur;
-	if (yych == 's') goto yy107;
+	if (yych == 'e') goto yy109;
 	goto yy9;
 yy83:
 	yych = *++cur;
-	if (yych == 's') goto yy108;
+	if (yych == 'r') goto yy110;
 	goto yy9;
 yy84:
 	yych = *++cur;
-	if (yych == 's') goto yy109;
+	if (yych == 'u') goto yy111;
 	goto yy9;
 yy85:
 	yych = *++cur;
-	if (yych == 'd') goto yy110;
+	if (yych == 'l') goto yy112;
 	goto yy9;
 yy86:
 	yych = *++cur;
-	if (yych == 's') goto yy111;
+	if (yych == 'm') goto yy113;
 	goto yy9;
 yy87:
 	yych = *++cur;
-	if (yych == 'd') goto yy112;
+	if (yych == 's') goto yy114;
 	goto yy9;
 yy88:
 	yych = *++cur;
-	if (yych == 'o') goto yy113;
+	if (yych == 'i') goto yy115;
 	goto yy9;
 yy89:
 	yych = *++cur;
-	if (yych == 'l') goto yy114;
+	if (yych == 's') goto yy116;
 	goto yy9;
 yy90:
 	yych = *++cur;
-	if (yych == 'a') goto yy115;
+	if (yych == 's') goto yy117;
 	goto yy9;
 yy91:
 	yych = *++cur;
-	if (yych == ':') goto yy116;
-	if (yych == 'n') goto yy117;
+	if (yych == 'd') goto yy118;
 	goto yy9;
 yy92:
 	yych = *++cur;
-	if (yych == 'g') goto yy118;
+	if (yych == 's') goto yy119;
 	goto yy9;
 yy93:
 	yych = *++cur;
-	if (yych == 'c') goto yy119;
+	if (yych == 'd') goto yy120;
 	goto yy9;
 yy94:
 	yych = *++cur;
-	if (yych == 'e') goto yy120;
+	if (yych == 'o') goto yy121;
 	goto yy9;
 yy95:
 	yych = *++cur;
-	if (yych == 'g') goto yy121;
+	if (yych == 'l') goto yy122;
 	goto yy9;
 yy96:
 	yych = *++cur;
-	if (yych == 'e') goto yy122;
+	if (yych == 'a') goto yy123;
 	goto yy9;
 yy97:
 	yych = *++cur;
-	if (yych == ':') goto yy123;
+	if (yych == ':') goto yy124;
+	if (yych == 'n') goto yy125;
 	goto yy9;
 yy98:
+	yych = *++cur;
+	if (yych == 'g') goto yy126;
+	goto yy9;
+yy99:
+	yych = *++cur;
+	if (yych == 'f') goto yy127;
+	goto yy9;
+yy100:
+	yych = *++cur;
+	if (yych == 'c') goto yy128;
+	goto yy9;
+yy101:
+	yych = *++cur;
+	if (yych == 'e') goto yy129;
+	goto yy9;
+yy102:
+	yych = *++cur;
+	if (yych == 'g') goto yy130;
+	goto yy9;
+yy103:
+	yych = *++cur;
+	if (yych == 'e') goto yy131;
+	goto yy9;
+yy104:
+	yych = *++cur;
+	if (yych == ':') goto yy132;
+	goto yy9;
+yy105:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-yy99:
+yy106:
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy98;
+		if (yych == '\t') goto yy105;
 		goto yy9;
 	} else {
-		if (yych <= ' ') goto yy98;
+		if (yych <= ' ') goto yy105;
 		if (yych <= '0') goto yy9;
 		if (yych <= '9') {
 			yyt1 = cur;
-			goto yy124;
+			goto yy133;
 		}
 		goto yy9;
 	}
-yy100:
+yy107:
 	yych = *++cur;
-	if (yych == 't') goto yy125;
+	if (yych == 't') goto yy134;
 	goto yy9;
-yy101:
+yy108:
 	yych = *++cur;
-	if (yych == 'a') goto yy126;
+	if (yych == 'a') goto yy135;
 	goto yy9;
-yy102:
+yy109:
 	yych = *++cur;
-	if (yych == 'r') goto yy127;
+	if (yych == 'r') goto yy136;
 	goto yy9;
-yy103:
+yy110:
 	yych = *++cur;
-	if (yych == 'e') goto yy129;
+	if (yych == 'e') goto yy138;
 	goto yy9;
-yy104:
+yy111:
 	yych = *++cur;
-	if (yych == 'd') goto yy131;
+	if (yych == 'd') goto yy140;
 	goto yy9;
-yy105:
+yy112:
 	++cur;
 #line 160 "../src/parse/lexer.re"
 	{
@@ -656,21 +680,25 @@ yy105:
         CHECK_RET(lex_opt_name(block_name));
         RET_BLOCK(InputBlock::LOCAL);
     }
-#line 660 "src/parse/lexer.cc"
-yy106:
+#line 684 "src/parse/lexer.cc"
+yy113:
 	yych = *++cur;
-	if (yych == 'a') goto yy132;
+	if (yych == 'a') goto yy141;
 	goto yy9;
-yy107:
+yy114:
 	++cur;
-#line 194 "../src/parse/lexer.re"
+#line 199 "../src/parse/lexer.re"
 	{
         uint32_t allow = DCONF_FORMAT | DCONF_SEPARATOR;
         CHECK_RET(lex_special_block(out, CodeKind::MTAGS, allow));
         goto next;
     }
-#line 673 "src/parse/lexer.cc"
-yy108:
+#line 697 "src/parse/lexer.cc"
+yy115:
+	yych = *++cur;
+	if (yych == 'l') goto yy142;
+	goto yy9;
+yy116:
 	++cur;
 #line 166 "../src/parse/lexer.re"
 	{
@@ -678,53 +706,57 @@ yy108:
         CHECK_RET(lex_opt_name(block_name));
         RET_BLOCK(InputBlock::RULES);
     }
-#line 682 "src/parse/lexer.cc"
-yy109:
+#line 710 "src/parse/lexer.cc"
+yy117:
 	++cur;
-#line 188 "../src/parse/lexer.re"
+#line 193 "../src/parse/lexer.re"
 	{
         uint32_t allow = DCONF_FORMAT | DCONF_SEPARATOR;
         CHECK_RET(lex_special_block(out, CodeKind::STAGS, allow));
         goto next;
     }
-#line 691 "src/parse/lexer.cc"
-yy110:
+#line 719 "src/parse/lexer.cc"
+yy118:
 	yych = *++cur;
-	if (yych == 'i') goto yy133;
+	if (yych == 'i') goto yy143;
 	goto yy9;
-yy111:
+yy119:
 	yych = *++cur;
-	if (yych == 't') goto yy134;
+	if (yych == 't') goto yy144;
 	goto yy9;
-yy112:
+yy120:
 	yych = *++cur;
-	if (yych == 'e') goto yy135;
+	if (yych == 'e') goto yy145;
 	goto yy9;
-yy113:
+yy121:
 	yych = *++cur;
-	if (yych == 'r') goto yy136;
+	if (yych == 'r') goto yy146;
 	goto yy9;
-yy114:
+yy122:
 	yych = *++cur;
-	if (yych == 'u') goto yy137;
+	if (yych == 'u') goto yy147;
 	goto yy9;
-yy115:
+yy123:
 	yych = *++cur;
-	if (yych == 'l') goto yy138;
+	if (yych == 'l') goto yy148;
 	goto yy9;
-yy116:
+yy124:
 	yych = *++cur;
-	if (yych == 'r') goto yy139;
+	if (yych == 'r') goto yy149;
 	goto yy9;
-yy117:
+yy125:
 	yych = *++cur;
-	if (yych == 'm') goto yy140;
+	if (yych == 'm') goto yy150;
 	goto yy9;
-yy118:
+yy126:
 	yych = *++cur;
-	if (yych == 's') goto yy141;
+	if (yych == 's') goto yy151;
 	goto yy9;
-yy119:
+yy127:
+	yych = *++cur;
+	if (yych == 'i') goto yy152;
+	goto yy9;
+yy128:
 	++cur;
 #line 154 "../src/parse/lexer.re"
 	{
@@ -732,299 +764,315 @@ yy119:
         CHECK_RET(lex_opt_name(block_name));
         RET_BLOCK(InputBlock::GLOBAL);
     }
-#line 736 "src/parse/lexer.cc"
-yy120:
+#line 768 "src/parse/lexer.cc"
+yy129:
 	yych = *++cur;
-	if (yych == 's') goto yy142;
+	if (yych == 's') goto yy153;
 	goto yy9;
-yy121:
+yy130:
 	yych = *++cur;
-	if (yych == 's') goto yy143;
+	if (yych == 's') goto yy154;
 	goto yy9;
-yy122:
+yy131:
 	yych = *++cur;
-	if (yych == 's') goto yy144;
+	if (yych == 's') goto yy155;
 	goto yy9;
-yy123:
+yy132:
 	yych = *++cur;
-	if (yych == 'r') goto yy145;
+	if (yych == 'r') goto yy156;
 	goto yy9;
-yy124:
+yy133:
 	++cur;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 64) {
-		goto yy124;
-	}
+	if (yybm[0+yych] & 64) goto yy133;
 	if (yych <= '\f') {
 		if (yych <= 0x08) goto yy9;
-		if (yych <= '\t') goto yy146;
-		if (yych <= '\n') goto yy147;
+		if (yych <= '\t') goto yy157;
+		if (yych <= '\n') goto yy158;
 		goto yy9;
 	} else {
-		if (yych <= '\r') goto yy148;
-		if (yych == ' ') goto yy146;
+		if (yych <= '\r') goto yy159;
+		if (yych == ' ') goto yy157;
 		goto yy9;
 	}
-yy125:
+yy134:
 	yych = *++cur;
-	if (yych == 'i') goto yy149;
+	if (yych == 'i') goto yy160;
 	goto yy9;
-yy126:
+yy135:
 	yych = *++cur;
-	if (yych == 't') goto yy150;
+	if (yych == 't') goto yy161;
 	goto yy9;
-yy127:
+yy136:
 	yyaccept = 3;
 	yych = *(mar = ++cur);
-	if (yych == ':') goto yy151;
-yy128:
-#line 236 "../src/parse/lexer.re"
+	if (yych == ':') goto yy162;
+yy137:
+#line 241 "../src/parse/lexer.re"
 	{
         RET_FAIL(error_at_cur("ill-formed `header` directive: expected `:on` or `:off`"));
     }
-#line 787 "src/parse/lexer.cc"
-yy129:
+#line 817 "src/parse/lexer.cc"
+yy138:
 	yyaccept = 4;
 	yych = *(mar = ++cur);
 	if (yych <= 0x1F) {
 		if (yych <= '\n') {
 			if (yych >= '\t') {
 				yyt1 = cur;
-				goto yy152;
+				goto yy163;
 			}
 		} else {
 			if (yych == '\r') {
 				yyt1 = cur;
-				goto yy152;
+				goto yy163;
 			}
 		}
 	} else {
 		if (yych <= '%') {
 			if (yych <= ' ') {
 				yyt1 = cur;
-				goto yy152;
+				goto yy163;
 			}
 			if (yych >= '%') {
 				yyt1 = cur;
-				goto yy153;
+				goto yy164;
 			}
 		} else {
 			if (yych == '*') {
 				yyt1 = cur;
-				goto yy154;
+				goto yy165;
 			}
 		}
 	}
-yy130:
-#line 257 "../src/parse/lexer.re"
+yy139:
+#line 262 "../src/parse/lexer.re"
 	{
         RET_FAIL(error_at_cur("ill-formed `ignore` block: "
                 "expected a space, a newline, or the end of block"));
     }
-#line 826 "src/parse/lexer.cc"
-yy131:
+#line 856 "src/parse/lexer.cc"
+yy140:
 	yych = *++cur;
-	if (yych == 'e') goto yy155;
+	if (yych == 'e') goto yy166;
 	goto yy9;
-yy132:
+yy141:
 	yych = *++cur;
-	if (yych == 't') goto yy157;
+	if (yych == 't') goto yy168;
 	goto yy9;
-yy133:
+yy142:
 	yych = *++cur;
-	if (yych == 't') goto yy158;
+	if (yych == 'e') goto yy169;
 	goto yy9;
-yy134:
+yy143:
 	yych = *++cur;
-	if (yych == 'a') goto yy159;
+	if (yych == 't') goto yy170;
 	goto yy9;
-yy135:
+yy144:
 	yych = *++cur;
-	if (yych == 'r') goto yy160;
+	if (yych == 'a') goto yy171;
 	goto yy9;
-yy136:
+yy145:
 	yych = *++cur;
-	if (yych == 'e') goto yy161;
+	if (yych == 'r') goto yy172;
 	goto yy9;
-yy137:
+yy146:
 	yych = *++cur;
-	if (yych == 'd') goto yy162;
+	if (yych == 'e') goto yy173;
 	goto yy9;
-yy138:
+yy147:
 	yych = *++cur;
-	if (yych == ':') goto yy163;
+	if (yych == 'd') goto yy174;
 	goto yy9;
-yy139:
+yy148:
 	yych = *++cur;
-	if (yych == 'e') goto yy164;
+	if (yych == ':') goto yy175;
 	goto yy9;
-yy140:
+yy149:
 	yych = *++cur;
-	if (yych == 'a') goto yy165;
+	if (yych == 'e') goto yy176;
 	goto yy9;
-yy141:
+yy150:
 	yych = *++cur;
-	if (yych == ':') goto yy166;
+	if (yych == 'a') goto yy177;
 	goto yy9;
-yy142:
+yy151:
 	yych = *++cur;
-	if (yych == ':') goto yy167;
+	if (yych == ':') goto yy178;
 	goto yy9;
-yy143:
+yy152:
 	yych = *++cur;
-	if (yych == ':') goto yy168;
+	if (yych == 'l') goto yy179;
 	goto yy9;
-yy144:
+yy153:
 	yych = *++cur;
-	if (yych == ':') goto yy169;
+	if (yych == ':') goto yy180;
 	goto yy9;
-yy145:
+yy154:
 	yych = *++cur;
-	if (yych == 'e') goto yy170;
+	if (yych == ':') goto yy181;
 	goto yy9;
-yy146:
+yy155:
+	yych = *++cur;
+	if (yych == ':') goto yy182;
+	goto yy9;
+yy156:
+	yych = *++cur;
+	if (yych == 'e') goto yy183;
+	goto yy9;
+yy157:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy146;
+		if (yych == '\t') goto yy157;
 		goto yy9;
 	} else {
-		if (yych <= ' ') goto yy146;
-		if (yych == '"') goto yy171;
+		if (yych <= ' ') goto yy157;
+		if (yych == '"') goto yy184;
 		goto yy9;
 	}
-yy147:
+yy158:
 	++cur;
 	cur = yyt1;
-#line 270 "../src/parse/lexer.re"
+#line 275 "../src/parse/lexer.re"
 	{
         out.gen_raw(tok, ptr);
         out.gen_stmt(code_newline(alc));
         CHECK_RET(set_sourceline());
         goto next;
     }
-#line 909 "src/parse/lexer.cc"
-yy148:
+#line 947 "src/parse/lexer.cc"
+yy159:
 	yych = *++cur;
-	if (yych == '\n') goto yy147;
+	if (yych == '\n') goto yy158;
 	goto yy9;
-yy149:
+yy160:
 	yych = *++cur;
-	if (yych == 'o') goto yy172;
+	if (yych == 'o') goto yy185;
 	goto yy9;
-yy150:
+yy161:
 	yych = *++cur;
-	if (yych == 'e') goto yy173;
+	if (yych == 'e') goto yy186;
 	goto yy9;
-yy151:
+yy162:
 	yych = *++cur;
-	if (yych == 'o') goto yy174;
+	if (yych == 'o') goto yy187;
 	goto yy9;
-yy152:
+yy163:
 	++cur;
 	cur = yyt1;
-#line 251 "../src/parse/lexer.re"
+#line 256 "../src/parse/lexer.re"
 	{
         out.gen_raw(tok, ptr);
         // allows arbitrary garbage before the end of the comment
         CHECK_RET(lex_block_end(out, true));
         goto next;
     }
-#line 936 "src/parse/lexer.cc"
-yy153:
+#line 974 "src/parse/lexer.cc"
+yy164:
 	yych = *++cur;
-	if (yych == '}') goto yy152;
+	if (yych == '}') goto yy163;
 	goto yy9;
-yy154:
+yy165:
 	yych = *++cur;
-	if (yych == '/') goto yy152;
+	if (yych == '/') goto yy163;
 	goto yy9;
-yy155:
+yy166:
 	yyaccept = 5;
 	yych = *(mar = ++cur);
-	if (yych == '\t') goto yy175;
-	if (yych == ' ') goto yy175;
-yy156:
-#line 247 "../src/parse/lexer.re"
+	if (yych == '\t') goto yy188;
+	if (yych == ' ') goto yy188;
+yy167:
+#line 252 "../src/parse/lexer.re"
 	{
         RET_FAIL(error_at_cur("ill-formed `include` directive: expected filename in quotes"));
     }
-#line 955 "src/parse/lexer.cc"
-yy157:
+#line 993 "src/parse/lexer.cc"
+yy168:
 	yych = *++cur;
-	if (yych == 'c') goto yy176;
+	if (yych == 'c') goto yy189;
 	goto yy9;
-yy158:
+yy169:
+	++cur;
+#line 188 "../src/parse/lexer.re"
+	{
+        CHECK_RET(lex_special_block(out, CodeKind::PROFILE, 0));
+        goto next;
+    }
+#line 1005 "src/parse/lexer.cc"
+yy170:
 	yych = *++cur;
-	if (yych == 'i') goto yy177;
+	if (yych == 'i') goto yy190;
 	goto yy9;
-yy159:
+yy171:
 	yych = *++cur;
-	if (yych == 't') goto yy178;
+	if (yych == 't') goto yy191;
 	goto yy9;
-yy160:
+yy172:
 	yych = *++cur;
-	if (yych == ':') goto yy179;
+	if (yych == ':') goto yy192;
 	goto yy9;
-yy161:
+yy173:
 	yych = *++cur;
-	if (yych == ':') goto yy180;
+	if (yych == ':') goto yy193;
 	goto yy9;
-yy162:
+yy174:
 	yych = *++cur;
-	if (yych == 'e') goto yy181;
+	if (yych == 'e') goto yy194;
 	goto yy9;
-yy163:
+yy175:
 	yych = *++cur;
-	if (yych == 'r') goto yy182;
+	if (yych == 'r') goto yy195;
 	goto yy9;
-yy164:
+yy176:
 	yych = *++cur;
-	if (yych == '2') goto yy183;
+	if (yych == '2') goto yy196;
 	goto yy9;
-yy165:
+yy177:
 	yych = *++cur;
-	if (yych == 't') goto yy184;
+	if (yych == 't') goto yy197;
 	goto yy9;
-yy166:
+yy178:
 	yych = *++cur;
-	if (yych == 'r') goto yy185;
+	if (yych == 'r') goto yy198;
 	goto yy9;
-yy167:
+yy179:
 	yych = *++cur;
-	if (yych == 'r') goto yy186;
+	if (yych == 'e') goto yy199;
 	goto yy9;
-yy168:
+yy180:
+	yych = *++cur;
+	if (yych == 'r') goto yy200;
+	goto yy9;
+yy181:
 	yych = *++cur;
-	if (yych == 'r') goto yy187;
+	if (yych == 'r') goto yy201;
 	goto yy9;
-yy169:
+yy182:
 	yych = *++cur;
-	if (yych == 'r') goto yy188;
+	if (yych == 'r') goto yy202;
 	goto yy9;
-yy170:
+yy183:
 	yych = *++cur;
-	if (yych == '2') goto yy189;
+	if (yych == '2') goto yy203;
 	goto yy9;
-yy171:
+yy184:
 	++cur;
 	if ((lim - cur) < 3) if (!fill(3)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy171;
-	}
+	if (yybm[0+yych] & 128) goto yy184;
 	if (yych <= '\n') goto yy9;
-	if (yych <= '"') goto yy190;
-	goto yy191;
-yy172:
+	if (yych <= '"') goto yy204;
+	goto yy205;
+yy185:
 	yych = *++cur;
-	if (yych == 'n') goto yy192;
+	if (yych == 'n') goto yy206;
 	goto yy9;
-yy173:
+yy186:
 	++cur;
-#line 208 "../src/parse/lexer.re"
+#line 213 "../src/parse/lexer.re"
 	{
         out.state_goto = true;
         if (!opts->storable_state) {
@@ -1037,106 +1085,110 @@ yy173:
         CHECK_RET(lex_special_block(out, CodeKind::STATE_GOTO, 0));
         goto next;
     }
-#line 1041 "src/parse/lexer.cc"
-yy174:
+#line 1089 "src/parse/lexer.cc"
+yy187:
 	yych = *++cur;
-	if (yych == 'f') goto yy193;
-	if (yych == 'n') goto yy194;
+	if (yych == 'f') goto yy207;
+	if (yych == 'n') goto yy208;
 	goto yy9;
-yy175:
+yy188:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy175;
+		if (yych == '\t') goto yy188;
 		goto yy9;
 	} else {
-		if (yych <= ' ') goto yy175;
+		if (yych <= ' ') goto yy188;
 		if (yych == '"') {
 			yyt1 = cur;
-			goto yy195;
+			goto yy209;
 		}
 		goto yy9;
 	}
-yy176:
+yy189:
 	yych = *++cur;
-	if (yych == 'h') goto yy196;
+	if (yych == 'h') goto yy210;
 	goto yy9;
-yy177:
+yy190:
 	yych = *++cur;
-	if (yych == 'o') goto yy197;
+	if (yych == 'o') goto yy211;
 	goto yy9;
-yy178:
+yy191:
 	yych = *++cur;
-	if (yych == 'e') goto yy198;
+	if (yych == 'e') goto yy212;
 	goto yy9;
-yy179:
+yy192:
 	yych = *++cur;
-	if (yych == 'r') goto yy199;
+	if (yych == 'r') goto yy213;
 	goto yy9;
-yy180:
+yy193:
 	yych = *++cur;
-	if (yych == 'r') goto yy200;
+	if (yych == 'r') goto yy214;
 	goto yy9;
-yy181:
+yy194:
 	yych = *++cur;
-	if (yych == ':') goto yy201;
+	if (yych == ':') goto yy215;
 	goto yy9;
-yy182:
+yy195:
 	yych = *++cur;
-	if (yych == 'e') goto yy202;
+	if (yych == 'e') goto yy216;
 	goto yy9;
-yy183:
+yy196:
 	yych = *++cur;
-	if (yych == 'c') goto yy203;
+	if (yych == 'c') goto yy217;
 	goto yy9;
-yy184:
+yy197:
 	yych = *++cur;
-	if (yych == 'c') goto yy204;
+	if (yych == 'c') goto yy218;
 	goto yy9;
-yy185:
+yy198:
 	yych = *++cur;
-	if (yych == 'e') goto yy205;
+	if (yych == 'e') goto yy219;
 	goto yy9;
-yy186:
+yy199:
 	yych = *++cur;
-	if (yych == 'e') goto yy206;
+	if (yych == ':') goto yy220;
 	goto yy9;
-yy187:
+yy200:
 	yych = *++cur;
-	if (yych == 'e') goto yy207;
+	if (yych == 'e') goto yy221;
 	goto yy9;
-yy188:
+yy201:
 	yych = *++cur;
-	if (yych == 'e') goto yy208;
+	if (yych == 'e') goto yy222;
 	goto yy9;
-yy189:
+yy202:
 	yych = *++cur;
-	if (yych == 'c') goto yy60;
+	if (yych == 'e') goto yy223;
 	goto yy9;
-yy190:
+yy203:
 	yych = *++cur;
-	if (yych == '\n') goto yy147;
-	if (yych == '\r') goto yy148;
+	if (yych == 'c') goto yy64;
 	goto yy9;
-yy191:
+yy204:
+	yych = *++cur;
+	if (yych == '\n') goto yy158;
+	if (yych == '\r') goto yy159;
+	goto yy9;
+yy205:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x00) goto yy9;
 	if (yych == '\n') goto yy9;
-	goto yy171;
-yy192:
+	goto yy184;
+yy206:
 	yych = *++cur;
-	if (yych == 's') goto yy209;
+	if (yych == 's') goto yy224;
 	goto yy9;
-yy193:
+yy207:
 	yych = *++cur;
-	if (yych == 'f') goto yy210;
+	if (yych == 'f') goto yy225;
 	goto yy9;
-yy194:
+yy208:
 	++cur;
-#line 221 "../src/parse/lexer.re"
+#line 226 "../src/parse/lexer.re"
 	{
         out.gen_raw(tok, ptr);
         out.header_mode(true);
@@ -1144,78 +1196,82 @@ yy194:
         CHECK_RET(lex_block_end(out));
         goto next;
     }
-#line 1148 "src/parse/lexer.cc"
-yy195:
+#line 1200 "src/parse/lexer.cc"
+yy209:
 	++cur;
 	if ((lim - cur) < 3) if (!fill(3)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '!') {
 		if (yych <= 0x00) goto yy9;
 		if (yych == '\n') goto yy9;
-		goto yy195;
+		goto yy209;
 	} else {
-		if (yych <= '"') goto yy211;
-		if (yych == '\\') goto yy212;
-		goto yy195;
+		if (yych <= '"') goto yy226;
+		if (yych == '\\') goto yy227;
+		goto yy209;
 	}
-yy196:
+yy210:
 	++cur;
 #line 183 "../src/parse/lexer.re"
 	{
         CHECK_RET(lex_special_block(out, CodeKind::MAXNMATCH, DCONF_FORMAT));
         goto next;
     }
-#line 1169 "src/parse/lexer.cc"
-yy197:
+#line 1221 "src/parse/lexer.cc"
+yy211:
 	yych = *++cur;
-	if (yych == 'n') goto yy122;
+	if (yych == 'n') goto yy131;
 	goto yy9;
-yy198:
+yy212:
 	yych = *++cur;
-	if (yych == ':') goto yy213;
+	if (yych == ':') goto yy228;
 	goto yy9;
-yy199:
+yy213:
 	yych = *++cur;
-	if (yych == 'e') goto yy214;
+	if (yych == 'e') goto yy229;
 	goto yy9;
-yy200:
+yy214:
 	yych = *++cur;
-	if (yych == 'e') goto yy215;
+	if (yych == 'e') goto yy230;
 	goto yy9;
-yy201:
+yy215:
 	yych = *++cur;
-	if (yych == 'r') goto yy216;
+	if (yych == 'r') goto yy231;
 	goto yy9;
-yy202:
+yy216:
 	yych = *++cur;
-	if (yych == '2') goto yy217;
+	if (yych == '2') goto yy232;
 	goto yy9;
-yy203:
+yy217:
 	++cur;
-	goto yy56;
-yy204:
+	goto yy59;
+yy218:
 	yych = *++cur;
-	if (yych == 'h') goto yy218;
+	if (yych == 'h') goto yy233;
 	goto yy9;
-yy205:
+yy219:
 	yych = *++cur;
-	if (yych == '2') goto yy219;
+	if (yych == '2') goto yy234;
 	goto yy9;
-yy206:
+yy220:
 	yych = *++cur;
-	if (yych == '2') goto yy220;
+	if (yych == 'r') goto yy235;
 	goto yy9;
-yy207:
+yy221:
 	yych = *++cur;
-	if (yych == '2') goto yy221;
+	if (yych == '2') goto yy236;
 	goto yy9;
-yy208:
+yy222:
 	yych = *++cur;
-	if (yych == '2') goto yy222;
+	if (yych == '2') goto yy237;
 	goto yy9;
-yy209:
+yy223:
+	yych = *++cur;
+	if (yych == '2') goto yy238;
+	goto yy9;
+yy224:
 	++cur;
-#line 200 "../src/parse/lexer.re"
+#line 205 "../src/parse/lexer.re"
 	{
         out.cond_enum_autogen = false;
         out.warn_condition_order = false; // see note [condition order]
@@ -1223,10 +1279,10 @@ yy209:
         CHECK_RET(lex_special_block(out, CodeKind::COND_ENUM, allow));
         goto next;
     }
-#line 1227 "src/parse/lexer.cc"
-yy210:
+#line 1283 "src/parse/lexer.cc"
+yy225:
 	++cur;
-#line 229 "../src/parse/lexer.re"
+#line 234 "../src/parse/lexer.re"
 	{
         out.gen_raw(tok, ptr);
         out.header_mode(false);
@@ -1234,18 +1290,18 @@ yy210:
         CHECK_RET(lex_block_end(out));
         goto next;
     }
-#line 1238 "src/parse/lexer.cc"
-yy211:
+#line 1294 "src/parse/lexer.cc"
+yy226:
 	yych = *++cur;
 	if (yych <= 0x1F) {
 		if (yych <= '\n') {
 			if (yych <= 0x08) goto yy9;
 			yyt2 = cur;
-			goto yy223;
+			goto yy239;
 		} else {
 			if (yych == '\r') {
 				yyt2 = cur;
-				goto yy223;
+				goto yy239;
 			}
 			goto yy9;
 		}
@@ -1253,72 +1309,76 @@ yy211:
 		if (yych <= '%') {
 			if (yych <= ' ') {
 				yyt2 = cur;
-				goto yy223;
+				goto yy239;
 			}
 			if (yych <= '$') goto yy9;
 			yyt2 = cur;
-			goto yy224;
+			goto yy240;
 		} else {
 			if (yych == '*') {
 				yyt2 = cur;
-				goto yy225;
+				goto yy241;
 			}
 			goto yy9;
 		}
 	}
-yy212:
+yy227:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x00) goto yy9;
 	if (yych == '\n') goto yy9;
-	goto yy195;
-yy213:
+	goto yy209;
+yy228:
 	yych = *++cur;
-	if (yych == 'r') goto yy226;
+	if (yych == 'r') goto yy242;
 	goto yy9;
-yy214:
+yy229:
 	yych = *++cur;
-	if (yych == '2') goto yy227;
+	if (yych == '2') goto yy243;
 	goto yy9;
-yy215:
+yy230:
 	yych = *++cur;
-	if (yych == '2') goto yy228;
+	if (yych == '2') goto yy244;
 	goto yy9;
-yy216:
+yy231:
 	yych = *++cur;
-	if (yych == 'e') goto yy229;
+	if (yych == 'e') goto yy245;
 	goto yy9;
-yy217:
+yy232:
 	yych = *++cur;
-	if (yych == 'c') goto yy105;
+	if (yych == 'c') goto yy112;
 	goto yy9;
-yy218:
+yy233:
 	yych = *++cur;
-	if (yych == ':') goto yy230;
+	if (yych == ':') goto yy246;
 	goto yy9;
-yy219:
+yy234:
 	yych = *++cur;
-	if (yych == 'c') goto yy107;
+	if (yych == 'c') goto yy114;
 	goto yy9;
-yy220:
+yy235:
 	yych = *++cur;
-	if (yych == 'c') goto yy108;
+	if (yych == 'e') goto yy247;
 	goto yy9;
-yy221:
+yy236:
 	yych = *++cur;
-	if (yych == 'c') goto yy109;
+	if (yych == 'c') goto yy116;
 	goto yy9;
-yy222:
+yy237:
 	yych = *++cur;
-	if (yych == 'c') goto yy209;
+	if (yych == 'c') goto yy117;
 	goto yy9;
-yy223:
+yy238:
+	yych = *++cur;
+	if (yych == 'c') goto yy224;
+	goto yy9;
+yy239:
 	++cur;
 	x = yyt1;
 	y = yyt2;
 	cur = yyt2;
-#line 240 "../src/parse/lexer.re"
+#line 245 "../src/parse/lexer.re"
 	{
         out.gen_raw(tok, ptr);
         CHECK_RET(lex_block_end(out));
@@ -1326,59 +1386,67 @@ yy223:
         if (globopts->line_dirs) out.gen_stmt(code_line_info_input(alc, cur_loc()));
         goto next;
     }
-#line 1330 "src/parse/lexer.cc"
-yy224:
+#line 1390 "src/parse/lexer.cc"
+yy240:
 	yych = *++cur;
-	if (yych == '}') goto yy223;
+	if (yych == '}') goto yy239;
 	goto yy9;
-yy225:
+yy241:
 	yych = *++cur;
-	if (yych == '/') goto yy223;
+	if (yych == '/') goto yy239;
 	goto yy9;
-yy226:
+yy242:
 	yych = *++cur;
-	if (yych == 'e') goto yy231;
+	if (yych == 'e') goto yy248;
 	goto yy9;
-yy227:
+yy243:
 	yych = *++cur;
-	if (yych == 'c') goto yy127;
+	if (yych == 'c') goto yy136;
 	goto yy9;
-yy228:
+yy244:
 	yych = *++cur;
-	if (yych == 'c') goto yy129;
+	if (yych == 'c') goto yy138;
 	goto yy9;
-yy229:
+yy245:
 	yych = *++cur;
-	if (yych == '2') goto yy232;
+	if (yych == '2') goto yy249;
 	goto yy9;
-yy230:
+yy246:
 	yych = *++cur;
-	if (yych == 'r') goto yy233;
+	if (yych == 'r') goto yy250;
 	goto yy9;
-yy231:
+yy247:
 	yych = *++cur;
-	if (yych == '2') goto yy234;
+	if (yych == '2') goto yy251;
 	goto yy9;
-yy232:
+yy248:
 	yych = *++cur;
-	if (yych == 'c') goto yy155;
+	if (yych == '2') goto yy252;
 	goto yy9;
-yy233:
+yy249:
 	yych = *++cur;
-	if (yych == 'e') goto yy235;
+	if (yych == 'c') goto yy166;
 	goto yy9;
-yy234:
+yy250:
 	yych = *++cur;
-	if (yych == 'c') goto yy173;
+	if (yych == 'e') goto yy253;
 	goto yy9;
-yy235:
+yy251:
+	yych = *++cur;
+	if (yych == 'c') goto yy169;
+	goto yy9;
+yy252:
+	yych = *++cur;
+	if (yych == 'c') goto yy186;
+	goto yy9;
+yy253:
 	yych = *++cur;
 	if (yych != '2') goto yy9;
 	yych = *++cur;
-	if (yych == 'c') goto yy196;
+	if (yych == 'c') goto yy210;
 	goto yy9;
 }
-#line 283 "../src/parse/lexer.re"
+#line 288 "../src/parse/lexer.re"
 
 }
 
@@ -1387,157 +1455,155 @@ yy235:
 Ret Input::lex_opt_name(std::string& name) {
     tok = cur;
 
-#line 1391 "src/parse/lexer.cc"
+#line 1459 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128,   0,   0,   0,   0,   0,   0, 
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128,   0,   0,   0,   0, 128, 
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128,   0,   0,   0,   0,   0,   0,
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128,   0,   0,   0,   0, 128,
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *(mar = cur);
 	if (yych <= ' ') {
 		if (yych <= '\f') {
-			if (yych <= 0x08) goto yy237;
+			if (yych <= 0x08) goto yy255;
 			if (yych <= '\n') {
 				yyt1 = cur;
-				goto yy238;
+				goto yy256;
 			}
 		} else {
 			if (yych <= '\r') {
 				yyt1 = cur;
-				goto yy238;
+				goto yy256;
 			}
 			if (yych >= ' ') {
 				yyt1 = cur;
-				goto yy238;
+				goto yy256;
 			}
 		}
 	} else {
 		if (yych <= ')') {
 			if (yych == '%') {
 				yyt1 = cur;
-				goto yy239;
+				goto yy257;
 			}
 		} else {
 			if (yych <= '*') {
 				yyt1 = cur;
-				goto yy241;
+				goto yy259;
 			}
-			if (yych == ':') goto yy242;
+			if (yych == ':') goto yy260;
 		}
 	}
-yy237:
-#line 291 "../src/parse/lexer.re"
+yy255:
+#line 296 "../src/parse/lexer.re"
 	{
         RET_FAIL(error_at_cur(
                 "ill-formed start of a block: expected a space, a newline, a colon "
                 "followed by a block name, or the end of block"));
     }
-#line 1468 "src/parse/lexer.cc"
-yy238:
+#line 1536 "src/parse/lexer.cc"
+yy256:
 	++cur;
 	cur = yyt1;
-#line 297 "../src/parse/lexer.re"
+#line 302 "../src/parse/lexer.re"
 	{ name.clear();              return Ret::OK; }
-#line 1474 "src/parse/lexer.cc"
-yy239:
+#line 1542 "src/parse/lexer.cc"
+yy257:
 	yych = *++cur;
-	if (yych == '}') goto yy238;
-yy240:
+	if (yych == '}') goto yy256;
+yy258:
 	cur = mar;
-	goto yy237;
-yy241:
+	goto yy255;
+yy259:
 	yych = *++cur;
-	if (yych == '/') goto yy238;
-	goto yy240;
-yy242:
+	if (yych == '/') goto yy256;
+	goto yy258;
+yy260:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '@') goto yy240;
-		if (yych >= '[') goto yy240;
+		if (yych <= '@') goto yy258;
+		if (yych >= '[') goto yy258;
 	} else {
-		if (yych == '`') goto yy240;
-		if (yych >= '{') goto yy240;
+		if (yych == '`') goto yy258;
+		if (yych >= '{') goto yy258;
 	}
-yy243:
+yy261:
 	++cur;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy243;
-	}
+	if (yybm[0+yych] & 128) goto yy261;
 	if (yych <= 0x1F) {
 		if (yych <= '\n') {
-			if (yych <= 0x08) goto yy240;
+			if (yych <= 0x08) goto yy258;
 			yyt1 = cur;
 		} else {
-			if (yych != '\r') goto yy240;
+			if (yych != '\r') goto yy258;
 			yyt1 = cur;
 		}
 	} else {
 		if (yych <= '%') {
 			if (yych <= ' ') {
 				yyt1 = cur;
-				goto yy244;
+				goto yy262;
 			}
-			if (yych <= '$') goto yy240;
+			if (yych <= '$') goto yy258;
 			yyt1 = cur;
-			goto yy245;
+			goto yy263;
 		} else {
 			if (yych == '*') {
 				yyt1 = cur;
-				goto yy246;
+				goto yy264;
 			}
-			goto yy240;
+			goto yy258;
 		}
 	}
-yy244:
+yy262:
 	++cur;
 	cur = yyt1;
-#line 298 "../src/parse/lexer.re"
+#line 303 "../src/parse/lexer.re"
 	{ name.assign(tok + 1, cur); return Ret::OK; }
-#line 1531 "src/parse/lexer.cc"
-yy245:
+#line 1597 "src/parse/lexer.cc"
+yy263:
 	yych = *++cur;
-	if (yych == '}') goto yy244;
-	goto yy240;
-yy246:
+	if (yych == '}') goto yy262;
+	goto yy258;
+yy264:
 	yych = *++cur;
-	if (yych == '/') goto yy244;
-	goto yy240;
+	if (yych == '/') goto yy262;
+	goto yy258;
 }
-#line 299 "../src/parse/lexer.re"
+#line 304 "../src/parse/lexer.re"
 
 }
 
@@ -1546,117 +1612,115 @@ Ret Input::lex_name_list(BlockNameList** ptail) {
 loop:
     tok = cur;
 
-#line 1550 "src/parse/lexer.cc"
+#line 1616 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128,   0,   0,   0,   0,   0,   0, 
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128,   0,   0,   0,   0, 128, 
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128,   0,   0,   0,   0,   0,   0,
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128,   0,   0,   0,   0, 128,
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *(mar = cur);
 	if (yych <= ' ') {
 		if (yych <= '\f') {
-			if (yych <= 0x08) goto yy248;
+			if (yych <= 0x08) goto yy266;
 			if (yych <= '\n') {
 				yyt1 = cur;
-				goto yy249;
+				goto yy267;
 			}
 		} else {
 			if (yych <= '\r') {
 				yyt1 = cur;
-				goto yy249;
+				goto yy267;
 			}
 			if (yych >= ' ') {
 				yyt1 = cur;
-				goto yy249;
+				goto yy267;
 			}
 		}
 	} else {
 		if (yych <= ')') {
 			if (yych == '%') {
 				yyt1 = cur;
-				goto yy250;
+				goto yy268;
 			}
 		} else {
 			if (yych <= '*') {
 				yyt1 = cur;
-				goto yy252;
+				goto yy270;
 			}
-			if (yych == ':') goto yy253;
+			if (yych == ':') goto yy271;
 		}
 	}
-yy248:
-#line 307 "../src/parse/lexer.re"
+yy266:
+#line 312 "../src/parse/lexer.re"
 	{
         RET_FAIL(error_at_cur(
                 "ill-formed start of a block: expected a space, a newline, a colon followed by a"
                 " list of colon-separated block names, or the end of block `*" "/`"));
     }
-#line 1627 "src/parse/lexer.cc"
-yy249:
+#line 1693 "src/parse/lexer.cc"
+yy267:
 	++cur;
 	cur = yyt1;
-#line 313 "../src/parse/lexer.re"
+#line 318 "../src/parse/lexer.re"
 	{ *ptail = nullptr; return Ret::OK; }
-#line 1633 "src/parse/lexer.cc"
-yy250:
+#line 1699 "src/parse/lexer.cc"
+yy268:
 	yych = *++cur;
-	if (yych == '}') goto yy249;
-yy251:
+	if (yych == '}') goto yy267;
+yy269:
 	cur = mar;
-	goto yy248;
-yy252:
+	goto yy266;
+yy270:
 	yych = *++cur;
-	if (yych == '/') goto yy249;
-	goto yy251;
-yy253:
+	if (yych == '/') goto yy267;
+	goto yy269;
+yy271:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '@') goto yy251;
-		if (yych >= '[') goto yy251;
+		if (yych <= '@') goto yy269;
+		if (yych >= '[') goto yy269;
 	} else {
-		if (yych == '`') goto yy251;
-		if (yych >= '{') goto yy251;
+		if (yych == '`') goto yy269;
+		if (yych >= '{') goto yy269;
 	}
-yy254:
+yy272:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy254;
-	}
-#line 315 "../src/parse/lexer.re"
+	if (yybm[0+yych] & 128) goto yy272;
+#line 320 "../src/parse/lexer.re"
 	{
         BlockNameList *l = alc.alloct<BlockNameList>(1);
         l->name = newcstr(tok + 1, cur, alc);
@@ -1673,116 +1737,112 @@ yy254:
 
         goto loop;
     }
-#line 1677 "src/parse/lexer.cc"
+#line 1741 "src/parse/lexer.cc"
 }
-#line 331 "../src/parse/lexer.re"
+#line 336 "../src/parse/lexer.re"
 
 }
 
 Ret Input::lex_block_end(Output& out, bool allow_garbage) {
     bool multiline = false;
 loop: 
-#line 1686 "src/parse/lexer.cc"
+#line 1750 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0, 128,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		128,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0, 128,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		128,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy258;
-	}
+	if (yybm[0+yych] & 128) goto yy276;
 	if (yych <= '\r') {
-		if (yych <= 0x08) goto yy256;
-		if (yych <= '\n') goto yy259;
-		if (yych >= '\r') goto yy260;
+		if (yych <= 0x08) goto yy274;
+		if (yych <= '\n') goto yy277;
+		if (yych >= '\r') goto yy278;
 	} else {
 		if (yych <= '%') {
-			if (yych >= '%') goto yy261;
+			if (yych >= '%') goto yy279;
 		} else {
-			if (yych == '*') goto yy262;
+			if (yych == '*') goto yy280;
 		}
 	}
-yy256:
+yy274:
 	++cur;
-yy257:
-#line 337 "../src/parse/lexer.re"
+yy275:
+#line 342 "../src/parse/lexer.re"
 	{
         if (allow_garbage && !is_eof()) goto loop;
         RET_FAIL(error_at_cur(
                 "ill-formed end of block: expected optional whitespaces followed by `*" "/`"));
     }
-#line 1748 "src/parse/lexer.cc"
-yy258:
+#line 1810 "src/parse/lexer.cc"
+yy276:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy258;
-	}
-#line 348 "../src/parse/lexer.re"
+	if (yybm[0+yych] & 128) goto yy276;
+#line 353 "../src/parse/lexer.re"
 	{ goto loop; }
-#line 1758 "src/parse/lexer.cc"
-yy259:
+#line 1818 "src/parse/lexer.cc"
+yy277:
 	++cur;
-#line 349 "../src/parse/lexer.re"
+#line 354 "../src/parse/lexer.re"
 	{ next_line(); multiline = true; goto loop; }
-#line 1763 "src/parse/lexer.cc"
-yy260:
+#line 1823 "src/parse/lexer.cc"
+yy278:
 	yych = *++cur;
-	if (yych == '\n') goto yy259;
-	goto yy257;
-yy261:
+	if (yych == '\n') goto yy277;
+	goto yy275;
+yy279:
 	yych = *++cur;
-	if (yych == '}') goto yy263;
-	goto yy257;
-yy262:
+	if (yych == '}') goto yy281;
+	goto yy275;
+yy280:
 	yych = *++cur;
-	if (yych != '/') goto yy257;
-yy263:
+	if (yych != '/') goto yy275;
+yy281:
 	++cur;
-#line 342 "../src/parse/lexer.re"
+#line 347 "../src/parse/lexer.re"
 	{
         if (multiline && globopts->line_dirs) {
             out.gen_stmt(code_line_info_input(out.allocator, cur_loc()));
         }
         return Ret::OK;
     }
-#line 1784 "src/parse/lexer.cc"
+#line 1844 "src/parse/lexer.cc"
 }
-#line 350 "../src/parse/lexer.re"
+#line 355 "../src/parse/lexer.re"
 
 }
 
@@ -1794,156 +1854,152 @@ Ret Input::lex_special_block(Output& out, CodeKind kind, uint32_t mask) {
     CHECK_RET(lex_name_list(&blocks));
 
 loop: 
-#line 1798 "src/parse/lexer.cc"
+#line 1858 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0, 128,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		128,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0, 128,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		128,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	if ((lim - cur) < 9) if (!fill(9)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy267;
-	}
+	if (yybm[0+yych] & 128) goto yy285;
 	if (yych <= '%') {
 		if (yych <= '\f') {
-			if (yych <= 0x08) goto yy265;
-			if (yych <= '\n') goto yy268;
+			if (yych <= 0x08) goto yy283;
+			if (yych <= '\n') goto yy286;
 		} else {
-			if (yych <= '\r') goto yy269;
-			if (yych >= '%') goto yy270;
+			if (yych <= '\r') goto yy287;
+			if (yych >= '%') goto yy288;
 		}
 	} else {
 		if (yych <= 'e') {
-			if (yych == '*') goto yy271;
+			if (yych == '*') goto yy289;
 		} else {
-			if (yych <= 'f') goto yy272;
-			if (yych == 's') goto yy273;
+			if (yych <= 'f') goto yy290;
+			if (yych == 's') goto yy291;
 		}
 	}
-yy265:
+yy283:
 	++cur;
-yy266:
-#line 361 "../src/parse/lexer.re"
+yy284:
+#line 366 "../src/parse/lexer.re"
 	{
         RET_FAIL(error_at_cur(
                 "ill-formed directive: expected optional configurations followed by the end of"
                 " block `*" "/`"));
     }
-#line 1865 "src/parse/lexer.cc"
-yy267:
+#line 1923 "src/parse/lexer.cc"
+yy285:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy267;
-	}
-#line 385 "../src/parse/lexer.re"
+	if (yybm[0+yych] & 128) goto yy285;
+#line 390 "../src/parse/lexer.re"
 	{ goto loop; }
-#line 1875 "src/parse/lexer.cc"
-yy268:
+#line 1931 "src/parse/lexer.cc"
+yy286:
 	++cur;
-#line 387 "../src/parse/lexer.re"
+#line 392 "../src/parse/lexer.re"
 	{ next_line(); goto loop; }
-#line 1880 "src/parse/lexer.cc"
-yy269:
+#line 1936 "src/parse/lexer.cc"
+yy287:
 	yych = *++cur;
-	if (yych == '\n') goto yy268;
-	goto yy266;
-yy270:
+	if (yych == '\n') goto yy286;
+	goto yy284;
+yy288:
 	yych = *++cur;
-	if (yych == '}') goto yy274;
-	goto yy266;
-yy271:
+	if (yych == '}') goto yy292;
+	goto yy284;
+yy289:
 	yych = *++cur;
-	if (yych == '/') goto yy274;
-	goto yy266;
-yy272:
+	if (yych == '/') goto yy292;
+	goto yy284;
+yy290:
 	yych = *(mar = ++cur);
-	if (yych == 'o') goto yy275;
-	goto yy266;
-yy273:
+	if (yych == 'o') goto yy293;
+	goto yy284;
+yy291:
 	yych = *(mar = ++cur);
-	if (yych == 'e') goto yy277;
-	goto yy266;
-yy274:
+	if (yych == 'e') goto yy295;
+	goto yy284;
+yy292:
 	++cur;
-#line 389 "../src/parse/lexer.re"
+#line 394 "../src/parse/lexer.re"
 	{
         if (globopts->line_dirs) out.gen_stmt(code_line_info_output(alc));
         out.gen_stmt(code_fmt(alc, kind, blocks, fmt, sep));
         if (globopts->line_dirs) out.gen_stmt(code_line_info_input(alc, cur_loc()));
         return Ret::OK;
     }
-#line 1910 "src/parse/lexer.cc"
-yy275:
+#line 1966 "src/parse/lexer.cc"
+yy293:
 	yych = *++cur;
-	if (yych == 'r') goto yy278;
-yy276:
+	if (yych == 'r') goto yy296;
+yy294:
 	cur = mar;
-	goto yy266;
-yy277:
+	goto yy284;
+yy295:
 	yych = *++cur;
-	if (yych == 'p') goto yy279;
-	goto yy276;
-yy278:
+	if (yych == 'p') goto yy297;
+	goto yy294;
+yy296:
 	yych = *++cur;
-	if (yych == 'm') goto yy280;
-	goto yy276;
-yy279:
+	if (yych == 'm') goto yy298;
+	goto yy294;
+yy297:
 	yych = *++cur;
-	if (yych == 'a') goto yy281;
-	goto yy276;
-yy280:
+	if (yych == 'a') goto yy299;
+	goto yy294;
+yy298:
 	yych = *++cur;
-	if (yych == 'a') goto yy282;
-	goto yy276;
-yy281:
+	if (yych == 'a') goto yy300;
+	goto yy294;
+yy299:
 	yych = *++cur;
-	if (yych == 'r') goto yy283;
-	goto yy276;
-yy282:
+	if (yych == 'r') goto yy301;
+	goto yy294;
+yy300:
 	yych = *++cur;
-	if (yych == 't') goto yy284;
-	goto yy276;
-yy283:
+	if (yych == 't') goto yy302;
+	goto yy294;
+yy301:
 	yych = *++cur;
-	if (yych == 'a') goto yy285;
-	goto yy276;
-yy284:
+	if (yych == 'a') goto yy303;
+	goto yy294;
+yy302:
 	++cur;
-#line 367 "../src/parse/lexer.re"
+#line 372 "../src/parse/lexer.re"
 	{
         if ((mask & DCONF_FORMAT) == 0) {
             RET_FAIL(error_at_cur("unexpected configuration 'format'"));
@@ -1952,16 +2008,16 @@ yy284:
         fmt = copystr(tmp_str, alc);
         goto loop;
     }
-#line 1956 "src/parse/lexer.cc"
-yy285:
+#line 2012 "src/parse/lexer.cc"
+yy303:
 	yych = *++cur;
-	if (yych != 't') goto yy276;
+	if (yych != 't') goto yy294;
 	yych = *++cur;
-	if (yych != 'o') goto yy276;
+	if (yych != 'o') goto yy294;
 	yych = *++cur;
-	if (yych != 'r') goto yy276;
+	if (yych != 'r') goto yy294;
 	++cur;
-#line 376 "../src/parse/lexer.re"
+#line 381 "../src/parse/lexer.re"
 	{
         if ((mask & DCONF_SEPARATOR) == 0) {
             RET_FAIL(error_at_cur("unexpected configuration 'separator'"));
@@ -1970,9 +2026,9 @@ yy285:
         sep = copystr(tmp_str, alc);
         goto loop;
     }
-#line 1974 "src/parse/lexer.cc"
+#line 2030 "src/parse/lexer.cc"
 }
-#line 395 "../src/parse/lexer.re"
+#line 400 "../src/parse/lexer.re"
 
 }
 
@@ -1984,121 +2040,119 @@ scan:
     tok = cur;
     location = cur_loc();
 
-#line 1988 "src/parse/lexer.cc"
+#line 2044 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	unsigned int yyaccept = 0;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 144,   0, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		144, 128,   0, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		224, 224, 224, 224, 224, 224, 224, 224, 
-		224, 224, 128, 128, 128, 128, 128, 128, 
-		128, 160, 160, 160, 160, 160, 160, 160, 
-		160, 160, 160, 160, 160, 160, 160, 160, 
-		160, 160, 160, 160, 160, 160, 160, 160, 
-		160, 160, 160, 128,   0, 128, 128, 160, 
-		128, 160, 160, 160, 160, 160, 160, 160, 
-		160, 160, 160, 160, 160, 160, 160, 160, 
-		160, 160, 160, 160, 160, 160, 160, 160, 
-		160, 160, 160, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 144,   0, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		144, 128,   0, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		224, 224, 224, 224, 224, 224, 224, 224,
+		224, 224, 128, 128, 128, 128, 128, 128,
+		128, 160, 160, 160, 160, 160, 160, 160,
+		160, 160, 160, 160, 160, 160, 160, 160,
+		160, 160, 160, 160, 160, 160, 160, 160,
+		160, 160, 160, 128,   0, 128, 128, 160,
+		128, 160, 160, 160, 160, 160, 160, 160,
+		160, 160, 160, 160, 160, 160, 160, 160,
+		160, 160, 160, 160, 160, 160, 160, 160,
+		160, 160, 160, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
 	};
 	if ((lim - cur) < 9) if (!fill(9)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 16) {
-		goto yy289;
-	}
+	if (yybm[0+yych] & 16) goto yy307;
 	if (yych <= '9') {
 		if (yych <= '$') {
 			if (yych <= '\r') {
-				if (yych <= 0x08) goto yy287;
-				if (yych <= '\n') goto yy290;
-				if (yych >= '\r') goto yy292;
+				if (yych <= 0x08) goto yy305;
+				if (yych <= '\n') goto yy308;
+				if (yych >= '\r') goto yy310;
 			} else {
 				if (yych <= '!') {
-					if (yych >= ' ') goto yy293;
+					if (yych >= ' ') goto yy311;
 				} else {
-					if (yych <= '"') goto yy295;
-					if (yych <= '#') goto yy296;
-					goto yy297;
+					if (yych <= '"') goto yy313;
+					if (yych <= '#') goto yy314;
+					goto yy315;
 				}
 			}
 		} else {
 			if (yych <= '*') {
 				if (yych <= '&') {
-					if (yych <= '%') goto yy298;
+					if (yych <= '%') goto yy316;
 				} else {
-					if (yych <= '\'') goto yy299;
-					if (yych <= ')') goto yy297;
-					goto yy300;
+					if (yych <= '\'') goto yy317;
+					if (yych <= ')') goto yy315;
+					goto yy318;
 				}
 			} else {
 				if (yych <= '-') {
-					if (yych <= '+') goto yy297;
+					if (yych <= '+') goto yy315;
 				} else {
-					if (yych <= '.') goto yy301;
-					if (yych <= '/') goto yy302;
-					goto yy303;
+					if (yych <= '.') goto yy319;
+					if (yych <= '/') goto yy320;
+					goto yy321;
 				}
 			}
 		}
 	} else {
 		if (yych <= '[') {
 			if (yych <= '=') {
-				if (yych <= ':') goto yy304;
-				if (yych <= ';') goto yy297;
-				if (yych <= '<') goto yy305;
-				goto yy306;
+				if (yych <= ':') goto yy322;
+				if (yych <= ';') goto yy315;
+				if (yych <= '<') goto yy323;
+				goto yy324;
 			} else {
 				if (yych <= '?') {
-					if (yych >= '?') goto yy297;
+					if (yych >= '?') goto yy315;
 				} else {
-					if (yych <= '@') goto yy296;
-					if (yych <= 'Z') goto yy307;
-					goto yy309;
+					if (yych <= '@') goto yy314;
+					if (yych <= 'Z') goto yy325;
+					goto yy327;
 				}
 			}
 		} else {
 			if (yych <= 'q') {
 				if (yych <= '^') {
-					if (yych <= '\\') goto yy297;
+					if (yych <= '\\') goto yy315;
 				} else {
-					if (yych != '`') goto yy307;
+					if (yych != '`') goto yy325;
 				}
 			} else {
 				if (yych <= 'z') {
-					if (yych <= 'r') goto yy310;
-					goto yy307;
+					if (yych <= 'r') goto yy328;
+					goto yy325;
 				} else {
-					if (yych <= '{') goto yy311;
-					if (yych <= '|') goto yy297;
+					if (yych <= '{') goto yy329;
+					if (yych <= '|') goto yy315;
 				}
 			}
 		}
 	}
-yy287:
+yy305:
 	++cur;
-yy288:
-#line 545 "../src/parse/lexer.re"
+yy306:
+#line 550 "../src/parse/lexer.re"
 	{
         if (globopts->flex_syntax && globopts->input_encoding == Enc::Type::UTF8) {
             // Try to lex this as a raw UTF-8 code point (not captured by the `name` rule above
@@ -2112,28 +2166,26 @@ yy288:
         }
         RET_FAIL(error_at_tok("unexpected character: '%c'", *tok));
     }
-#line 2116 "src/parse/lexer.cc"
-yy289:
+#line 2170 "src/parse/lexer.cc"
+yy307:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 16) {
-		goto yy289;
-	}
-#line 532 "../src/parse/lexer.re"
+	if (yybm[0+yych] & 16) goto yy307;
+#line 537 "../src/parse/lexer.re"
 	{ goto scan; }
-#line 2126 "src/parse/lexer.cc"
-yy290:
+#line 2178 "src/parse/lexer.cc"
+yy308:
 	yyaccept = 0;
 	yych = *(mar = ++cur);
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy313;
+		if (yych == '\t') goto yy331;
 	} else {
-		if (yych <= ' ') goto yy313;
-		if (yych == '#') goto yy315;
+		if (yych <= ' ') goto yy331;
+		if (yych == '#') goto yy333;
 	}
-yy291:
-#line 536 "../src/parse/lexer.re"
+yy309:
+#line 541 "../src/parse/lexer.re"
 	{
         next_line();
         if (mode == LexMode::FLEX_NAME) {
@@ -2142,65 +2194,65 @@ yy291:
         }
         goto scan;
     }
-#line 2146 "src/parse/lexer.cc"
-yy292:
+#line 2198 "src/parse/lexer.cc"
+yy310:
 	yych = *++cur;
-	if (yych == '\n') goto yy290;
-	goto yy288;
-yy293:
+	if (yych == '\n') goto yy308;
+	goto yy306;
+yy311:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych == 'i') goto yy316;
-	if (yych == 'u') goto yy317;
-yy294:
-#line 432 "../src/parse/lexer.re"
+	if (yych == 'i') goto yy334;
+	if (yych == 'u') goto yy335;
+yy312:
+#line 437 "../src/parse/lexer.re"
 	{ RET_TOK(*tok); }
-#line 2159 "src/parse/lexer.cc"
-yy295:
+#line 2211 "src/parse/lexer.cc"
+yy313:
 	++cur;
-#line 423 "../src/parse/lexer.re"
+#line 428 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_str(ast, '"',   yylval->regexp)); RET_TOK(TOKEN_REGEXP); }
-#line 2164 "src/parse/lexer.cc"
-yy296:
+#line 2216 "src/parse/lexer.cc"
+yy314:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '@') goto yy288;
-		if (yych <= 'Z') goto yy318;
-		goto yy288;
+		if (yych <= '@') goto yy306;
+		if (yych <= 'Z') goto yy336;
+		goto yy306;
 	} else {
-		if (yych == '`') goto yy288;
-		if (yych <= 'z') goto yy318;
-		goto yy288;
+		if (yych == '`') goto yy306;
+		if (yych <= 'z') goto yy336;
+		goto yy306;
 	}
-yy297:
+yy315:
 	++cur;
-	goto yy294;
-yy298:
+	goto yy312;
+yy316:
 	yych = *++cur;
-	if (yych == '}') goto yy320;
-	goto yy288;
-yy299:
+	if (yych == '}') goto yy338;
+	goto yy306;
+yy317:
 	++cur;
-#line 422 "../src/parse/lexer.re"
+#line 427 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_str(ast, '\'',  yylval->regexp)); RET_TOK(TOKEN_REGEXP); }
-#line 2187 "src/parse/lexer.cc"
-yy300:
+#line 2239 "src/parse/lexer.cc"
+yy318:
 	yych = *++cur;
-	if (yych == '/') goto yy320;
-	goto yy294;
-yy301:
+	if (yych == '/') goto yy338;
+	goto yy312;
+yy319:
 	++cur;
-#line 530 "../src/parse/lexer.re"
+#line 535 "../src/parse/lexer.re"
 	{ yylval->regexp = ast.dot(tok_loc()); RET_TOK(TOKEN_REGEXP); }
-#line 2196 "src/parse/lexer.cc"
-yy302:
+#line 2248 "src/parse/lexer.cc"
+yy320:
 	yych = *++cur;
-	if (yych == '*') goto yy321;
-	if (yych == '/') goto yy322;
-	goto yy294;
-yy303:
+	if (yych == '*') goto yy339;
+	if (yych == '/') goto yy340;
+	goto yy312;
+yy321:
 	++cur;
-#line 497 "../src/parse/lexer.re"
+#line 502 "../src/parse/lexer.re"
 	{
         if (!globopts->flex_syntax) {
             RET_FAIL(error_at_tok("unexpected character: '%c'", *tok));
@@ -2209,30 +2261,28 @@ yy303:
         yylval->regexp = ast.str(tok_loc(), false);
         RET_TOK(TOKEN_REGEXP);
     }
-#line 2213 "src/parse/lexer.cc"
-yy304:
+#line 2265 "src/parse/lexer.cc"
+yy322:
 	yych = *++cur;
-	if (yych == '=') goto yy323;
-	goto yy288;
-yy305:
+	if (yych == '=') goto yy341;
+	goto yy306;
+yy323:
 	++cur;
-#line 415 "../src/parse/lexer.re"
+#line 420 "../src/parse/lexer.re"
 	{ return lex_clist(ast, token); }
-#line 2222 "src/parse/lexer.cc"
-yy306:
+#line 2274 "src/parse/lexer.cc"
+yy324:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych == '>') goto yy325;
-	goto yy294;
-yy307:
+	if (yych == '>') goto yy343;
+	goto yy312;
+yy325:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-yy308:
-	if (yybm[0+yych] & 32) {
-		goto yy307;
-	}
-#line 476 "../src/parse/lexer.re"
+yy326:
+	if (yybm[0+yych] & 32) goto yy325;
+#line 481 "../src/parse/lexer.re"
 	{
         bool yes;
         CHECK_RET(lex_namedef_context_re2c(yes));
@@ -2253,274 +2303,261 @@ yy308:
         yylval->regexp = ast.str(tok_loc(), false);
         RET_TOK(TOKEN_REGEXP);
     }
-#line 2257 "src/parse/lexer.cc"
-yy309:
+#line 2307 "src/parse/lexer.cc"
+yy327:
 	yych = *++cur;
-	if (yych == '^') goto yy326;
-#line 424 "../src/parse/lexer.re"
+	if (yych == '^') goto yy344;
+#line 429 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_cls(ast, false, yylval->regexp)); RET_TOK(TOKEN_REGEXP); }
-#line 2263 "src/parse/lexer.cc"
-yy310:
+#line 2313 "src/parse/lexer.cc"
+yy328:
 	yych = *++cur;
-	if (yych == 'e') goto yy327;
-	goto yy308;
-yy311:
+	if (yych == 'e') goto yy345;
+	goto yy326;
+yy329:
 	yyaccept = 2;
 	yych = *(mar = ++cur);
-	if (yybm[0+yych] & 64) {
-		goto yy330;
-	}
+	if (yybm[0+yych] & 64) goto yy348;
 	if (yych <= 'Z') {
-		if (yych == ',') goto yy328;
-		if (yych >= 'A') goto yy331;
+		if (yych == ',') goto yy346;
+		if (yych >= 'A') goto yy349;
 	} else {
 		if (yych <= '_') {
-			if (yych >= '_') goto yy331;
+			if (yych >= '_') goto yy349;
 		} else {
-			if (yych <= '`') goto yy312;
-			if (yych <= 'z') goto yy331;
+			if (yych <= '`') goto yy330;
+			if (yych <= 'z') goto yy349;
 		}
 	}
-yy312:
-#line 407 "../src/parse/lexer.re"
+yy330:
+#line 412 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_code_in_braces(yylval, ast)); RET_TOK(TOKEN_CODE); }
-#line 2288 "src/parse/lexer.cc"
-yy313:
+#line 2336 "src/parse/lexer.cc"
+yy331:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy313;
+		if (yych == '\t') goto yy331;
 	} else {
-		if (yych <= ' ') goto yy313;
-		if (yych == '#') goto yy315;
+		if (yych <= ' ') goto yy331;
+		if (yych == '#') goto yy333;
 	}
-yy314:
+yy332:
 	cur = mar;
 	if (yyaccept <= 3) {
 		if (yyaccept <= 1) {
-			if (yyaccept == 0) {
-				goto yy291;
-			} else {
-				goto yy294;
-			}
+			if (yyaccept == 0) goto yy309;
+			else goto yy312;
 		} else {
-			if (yyaccept == 2) {
-				goto yy312;
-			} else {
-				goto yy324;
-			}
+			if (yyaccept == 2) goto yy330;
+			else goto yy342;
 		}
 	} else {
 		if (yyaccept <= 5) {
-			if (yyaccept == 4) {
-				goto yy329;
-			} else {
-				goto yy344;
-			}
+			if (yyaccept == 4) goto yy347;
+			else goto yy362;
 		} else {
-			goto yy363;
+			goto yy381;
 		}
 	}
-yy315:
+yy333:
 	++cur;
 	if ((lim - cur) < 5) if (!fill(5)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy315;
-		goto yy314;
+		if (yych == '\t') goto yy333;
+		goto yy332;
 	} else {
-		if (yych <= ' ') goto yy315;
-		if (yych == 'l') goto yy332;
-		goto yy314;
+		if (yych <= ' ') goto yy333;
+		if (yych == 'l') goto yy350;
+		goto yy332;
 	}
-yy316:
+yy334:
 	yych = *++cur;
-	if (yych == 'n') goto yy333;
-	goto yy314;
-yy317:
+	if (yych == 'n') goto yy351;
+	goto yy332;
+yy335:
 	yych = *++cur;
-	if (yych == 's') goto yy334;
-	goto yy314;
-yy318:
+	if (yych == 's') goto yy352;
+	goto yy332;
+yy336:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 'Z') {
-		if (yych <= '/') goto yy319;
-		if (yych <= '9') goto yy318;
-		if (yych >= 'A') goto yy318;
+		if (yych <= '/') goto yy337;
+		if (yych <= '9') goto yy336;
+		if (yych >= 'A') goto yy336;
 	} else {
 		if (yych <= '_') {
-			if (yych >= '_') goto yy318;
+			if (yych >= '_') goto yy336;
 		} else {
-			if (yych <= '`') goto yy319;
-			if (yych <= 'z') goto yy318;
+			if (yych <= '`') goto yy337;
+			if (yych <= 'z') goto yy336;
 		}
 	}
-yy319:
-#line 427 "../src/parse/lexer.re"
+yy337:
+#line 432 "../src/parse/lexer.re"
 	{
         yylval->regexp = ast.tag(tok_loc(), ast.cstr_global(tok + 1, cur), tok[0] == '#');
         RET_TOK(TOKEN_REGEXP);
     }
-#line 2368 "src/parse/lexer.cc"
-yy320:
+#line 2407 "src/parse/lexer.cc"
+yy338:
 	++cur;
-#line 420 "../src/parse/lexer.re"
+#line 425 "../src/parse/lexer.re"
 	{ tok = cur; RET_TOK(0); }
-#line 2373 "src/parse/lexer.cc"
-yy321:
+#line 2412 "src/parse/lexer.cc"
+yy339:
 	++cur;
-#line 418 "../src/parse/lexer.re"
+#line 423 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_c_comment());   goto scan; }
-#line 2378 "src/parse/lexer.cc"
-yy322:
+#line 2417 "src/parse/lexer.cc"
+yy340:
 	++cur;
-#line 417 "../src/parse/lexer.re"
+#line 422 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_cpp_comment()); goto scan; }
-#line 2383 "src/parse/lexer.cc"
-yy323:
+#line 2422 "src/parse/lexer.cc"
+yy341:
 	yyaccept = 3;
 	yych = *(mar = ++cur);
-	if (yych == '>') goto yy325;
-yy324:
-#line 408 "../src/parse/lexer.re"
+	if (yych == '>') goto yy343;
+yy342:
+#line 413 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_code_indented(yylval, ast));  RET_TOK(TOKEN_CODE); }
-#line 2391 "src/parse/lexer.cc"
-yy325:
+#line 2430 "src/parse/lexer.cc"
+yy343:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '@') {
 		if (yych <= '\t') {
-			if (yych <= 0x08) goto yy314;
-			goto yy325;
+			if (yych <= 0x08) goto yy332;
+			goto yy343;
 		} else {
-			if (yych == ' ') goto yy325;
-			goto yy314;
+			if (yych == ' ') goto yy343;
+			goto yy332;
 		}
 	} else {
 		if (yych <= '_') {
 			if (yych <= 'Z') {
 				yyt1 = cur;
-				goto yy335;
+				goto yy353;
 			}
-			if (yych <= '^') goto yy314;
+			if (yych <= '^') goto yy332;
 			yyt1 = cur;
-			goto yy335;
+			goto yy353;
 		} else {
-			if (yych <= '`') goto yy314;
+			if (yych <= '`') goto yy332;
 			if (yych <= 'z') {
 				yyt1 = cur;
-				goto yy335;
+				goto yy353;
 			}
-			goto yy314;
+			goto yy332;
 		}
 	}
-yy326:
+yy344:
 	++cur;
-#line 425 "../src/parse/lexer.re"
+#line 430 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_cls(ast, true,  yylval->regexp)); RET_TOK(TOKEN_REGEXP); }
-#line 2426 "src/parse/lexer.cc"
-yy327:
+#line 2465 "src/parse/lexer.cc"
+yy345:
 	yych = *++cur;
-	if (yych == '2') goto yy337;
-	goto yy308;
-yy328:
+	if (yych == '2') goto yy355;
+	goto yy326;
+yy346:
 	++cur;
-yy329:
-#line 461 "../src/parse/lexer.re"
+yy347:
+#line 466 "../src/parse/lexer.re"
 	{
         RET_FAIL(error_at_tok(
                 "illegal closure form, use '{n}', '{n,}', '{n,m}' where n and m are numbers"));
     }
-#line 2439 "src/parse/lexer.cc"
-yy330:
+#line 2478 "src/parse/lexer.cc"
+yy348:
 	++cur;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 64) {
-		goto yy330;
-	}
+	if (yybm[0+yych] & 64) goto yy348;
 	if (yych == ',') {
 		yyt1 = cur;
-		goto yy338;
+		goto yy356;
 	}
-	if (yych == '}') goto yy339;
-	goto yy314;
-yy331:
+	if (yych == '}') goto yy357;
+	goto yy332;
+yy349:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '^') {
 		if (yych <= '9') {
-			if (yych <= '/') goto yy314;
-			goto yy331;
+			if (yych <= '/') goto yy332;
+			goto yy349;
 		} else {
-			if (yych <= '@') goto yy314;
-			if (yych <= 'Z') goto yy331;
-			goto yy314;
+			if (yych <= '@') goto yy332;
+			if (yych <= 'Z') goto yy349;
+			goto yy332;
 		}
 	} else {
 		if (yych <= 'z') {
-			if (yych == '`') goto yy314;
-			goto yy331;
+			if (yych == '`') goto yy332;
+			goto yy349;
 		} else {
-			if (yych == '}') goto yy340;
-			goto yy314;
+			if (yych == '}') goto yy358;
+			goto yy332;
 		}
 	}
-yy332:
+yy350:
 	yych = *++cur;
-	if (yych == 'i') goto yy341;
-	goto yy314;
-yy333:
+	if (yych == 'i') goto yy359;
+	goto yy332;
+yy351:
 	yych = *++cur;
-	if (yych == 'c') goto yy342;
-	goto yy314;
-yy334:
+	if (yych == 'c') goto yy360;
+	goto yy332;
+yy352:
 	yych = *++cur;
-	if (yych == 'e') goto yy343;
-	goto yy314;
-yy335:
+	if (yych == 'e') goto yy361;
+	goto yy332;
+yy353:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 'Z') {
-		if (yych <= '/') goto yy336;
-		if (yych <= '9') goto yy335;
-		if (yych >= 'A') goto yy335;
+		if (yych <= '/') goto yy354;
+		if (yych <= '9') goto yy353;
+		if (yych >= 'A') goto yy353;
 	} else {
 		if (yych <= '_') {
-			if (yych >= '_') goto yy335;
+			if (yych >= '_') goto yy353;
 		} else {
-			if (yych <= '`') goto yy336;
-			if (yych <= 'z') goto yy335;
+			if (yych <= '`') goto yy354;
+			if (yych <= 'z') goto yy353;
 		}
 	}
-yy336:
+yy354:
 	p = yyt1;
-#line 410 "../src/parse/lexer.re"
+#line 415 "../src/parse/lexer.re"
 	{
         yylval->cstr = ast.cstr_global(p, cur);
         RET_TOK(tok[0] == ':' ? TOKEN_CJUMP : TOKEN_CNEXT);
     }
-#line 2510 "src/parse/lexer.cc"
-yy337:
+#line 2547 "src/parse/lexer.cc"
+yy355:
 	yych = *++cur;
-	if (yych == 'c') goto yy345;
-	goto yy308;
-yy338:
+	if (yych == 'c') goto yy363;
+	goto yy326;
+yy356:
 	yyaccept = 4;
 	yych = *(mar = ++cur);
-	if (yych <= '/') goto yy329;
-	if (yych <= '9') goto yy346;
-	if (yych == '}') goto yy347;
-	goto yy329;
-yy339:
+	if (yych <= '/') goto yy347;
+	if (yych <= '9') goto yy364;
+	if (yych == '}') goto yy365;
+	goto yy347;
+yy357:
 	++cur;
-#line 434 "../src/parse/lexer.re"
+#line 439 "../src/parse/lexer.re"
 	{
         if (!s_to_u32_unsafe (tok + 1, cur - 1, yylval->bounds.min)) {
             RET_FAIL(error_at_tok("repetition count overflow"));
@@ -2528,10 +2565,10 @@ yy339:
         yylval->bounds.max = yylval->bounds.min;
         RET_TOK(TOKEN_CLOSESIZE);
     }
-#line 2532 "src/parse/lexer.cc"
-yy340:
+#line 2569 "src/parse/lexer.cc"
+yy358:
 	++cur;
-#line 466 "../src/parse/lexer.re"
+#line 471 "../src/parse/lexer.re"
 	{
         if (!globopts->flex_syntax) {
             RET_FAIL(error_at_tok("curly braces for names only allowed with -F switch"));
@@ -2539,43 +2576,43 @@ yy340:
         yylval->cstr = ast.cstr_local(tok + 1, cur - 1);
         RET_TOK(TOKEN_ID);
     }
-#line 2543 "src/parse/lexer.cc"
-yy341:
+#line 2580 "src/parse/lexer.cc"
+yy359:
 	yych = *++cur;
-	if (yych == 'n') goto yy348;
-	goto yy314;
-yy342:
+	if (yych == 'n') goto yy366;
+	goto yy332;
+yy360:
 	yych = *++cur;
-	if (yych == 'l') goto yy349;
-	goto yy314;
-yy343:
+	if (yych == 'l') goto yy367;
+	goto yy332;
+yy361:
 	yyaccept = 5;
 	yych = *(mar = ++cur);
-	if (yych == ':') goto yy350;
-yy344:
-#line 523 "../src/parse/lexer.re"
+	if (yych == ':') goto yy368;
+yy362:
+#line 528 "../src/parse/lexer.re"
 	{
         RET_FAIL(error_at_tok(
                 "ill-formed use directive: expected `!use` followed by a colon, a block name,"
                 " optional spaces, a semicolon, and finally a space, a newline, or the end of"
                 " block"));
     }
-#line 2564 "src/parse/lexer.cc"
-yy345:
+#line 2601 "src/parse/lexer.cc"
+yy363:
 	yych = *++cur;
-	if (yych == ':') goto yy351;
-	goto yy308;
-yy346:
+	if (yych == ':') goto yy369;
+	goto yy326;
+yy364:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yych <= '/') goto yy314;
-	if (yych <= '9') goto yy346;
-	if (yych == '}') goto yy352;
-	goto yy314;
-yy347:
+	if (yych <= '/') goto yy332;
+	if (yych <= '9') goto yy364;
+	if (yych == '}') goto yy370;
+	goto yy332;
+yy365:
 	++cur;
-#line 453 "../src/parse/lexer.re"
+#line 458 "../src/parse/lexer.re"
 	{
         if (!s_to_u32_unsafe (tok + 1, cur - 2, yylval->bounds.min)) {
             RET_FAIL(error_at_tok("repetition lower bound overflow"));
@@ -2583,41 +2620,41 @@ yy347:
         yylval->bounds.max = std::numeric_limits<uint32_t>::max();
         RET_TOK(TOKEN_CLOSESIZE);
     }
-#line 2587 "src/parse/lexer.cc"
-yy348:
+#line 2624 "src/parse/lexer.cc"
+yy366:
 	yych = *++cur;
-	if (yych == 'e') goto yy353;
-	goto yy314;
-yy349:
+	if (yych == 'e') goto yy371;
+	goto yy332;
+yy367:
 	yych = *++cur;
-	if (yych == 'u') goto yy354;
-	goto yy314;
-yy350:
+	if (yych == 'u') goto yy372;
+	goto yy332;
+yy368:
 	yych = *++cur;
 	if (yych <= '^') {
-		if (yych <= '@') goto yy314;
+		if (yych <= '@') goto yy332;
 		if (yych <= 'Z') {
 			yyt1 = cur;
-			goto yy355;
+			goto yy373;
 		}
-		goto yy314;
+		goto yy332;
 	} else {
-		if (yych == '`') goto yy314;
+		if (yych == '`') goto yy332;
 		if (yych <= 'z') {
 			yyt1 = cur;
-			goto yy355;
+			goto yy373;
 		}
-		goto yy314;
+		goto yy332;
 	}
-yy351:
+yy369:
 	++cur;
-#line 474 "../src/parse/lexer.re"
+#line 479 "../src/parse/lexer.re"
 	{ RET_TOK(TOKEN_CONF); }
-#line 2617 "src/parse/lexer.cc"
-yy352:
+#line 2654 "src/parse/lexer.cc"
+yy370:
 	++cur;
 	p = yyt1;
-#line 442 "../src/parse/lexer.re"
+#line 447 "../src/parse/lexer.re"
 	{
         if (!s_to_u32_unsafe(tok + 1, p, yylval->bounds.min)) {
             RET_FAIL(error_at_tok("repetition lower bound overflow"));
@@ -2628,17 +2665,17 @@ yy352:
         }
         RET_TOK(TOKEN_CLOSESIZE);
     }
-#line 2632 "src/parse/lexer.cc"
-yy353:
+#line 2669 "src/parse/lexer.cc"
+yy371:
 	yych = *++cur;
-	if (yych <= '0') goto yy357;
-	if (yych <= '9') goto yy314;
-	goto yy357;
-yy354:
+	if (yych <= '0') goto yy375;
+	if (yych <= '9') goto yy332;
+	goto yy375;
+yy372:
 	yych = *++cur;
-	if (yych == 'd') goto yy358;
-	goto yy314;
-yy355:
+	if (yych == 'd') goto yy376;
+	goto yy332;
+yy373:
 	++cur;
 	if ((lim - cur) < 3) if (!fill(3)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
@@ -2646,311 +2683,309 @@ yy355:
 		if (yych <= 0x1F) {
 			if (yych == '\t') {
 				yyt2 = cur;
-				goto yy359;
+				goto yy377;
 			}
-			goto yy314;
+			goto yy332;
 		} else {
 			if (yych <= ' ') {
 				yyt2 = cur;
-				goto yy359;
+				goto yy377;
 			}
-			if (yych <= '/') goto yy314;
-			if (yych <= '9') goto yy355;
-			goto yy314;
+			if (yych <= '/') goto yy332;
+			if (yych <= '9') goto yy373;
+			goto yy332;
 		}
 	} else {
 		if (yych <= '^') {
 			if (yych <= ';') {
 				yyt2 = cur;
-				goto yy360;
+				goto yy378;
 			}
-			if (yych <= '@') goto yy314;
-			if (yych <= 'Z') goto yy355;
-			goto yy314;
+			if (yych <= '@') goto yy332;
+			if (yych <= 'Z') goto yy373;
+			goto yy332;
 		} else {
-			if (yych == '`') goto yy314;
-			if (yych <= 'z') goto yy355;
-			goto yy314;
+			if (yych == '`') goto yy332;
+			if (yych <= 'z') goto yy373;
+			goto yy332;
 		}
 	}
-yy356:
+yy374:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-yy357:
+yy375:
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy356;
-		goto yy314;
+		if (yych == '\t') goto yy374;
+		goto yy332;
 	} else {
-		if (yych <= ' ') goto yy356;
-		if (yych <= '0') goto yy314;
+		if (yych <= ' ') goto yy374;
+		if (yych <= '0') goto yy332;
 		if (yych <= '9') {
 			yyt1 = cur;
-			goto yy361;
+			goto yy379;
 		}
-		goto yy314;
+		goto yy332;
 	}
-yy358:
+yy376:
 	yych = *++cur;
-	if (yych == 'e') goto yy362;
-	goto yy314;
-yy359:
+	if (yych == 'e') goto yy380;
+	goto yy332;
+yy377:
 	++cur;
 	if ((lim - cur) < 3) if (!fill(3)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy359;
-		goto yy314;
+		if (yych == '\t') goto yy377;
+		goto yy332;
 	} else {
-		if (yych <= ' ') goto yy359;
-		if (yych != ';') goto yy314;
+		if (yych <= ' ') goto yy377;
+		if (yych != ';') goto yy332;
 	}
-yy360:
+yy378:
 	yych = *++cur;
 	if (yych <= 0x1F) {
 		if (yych <= '\n') {
-			if (yych <= 0x08) goto yy314;
+			if (yych <= 0x08) goto yy332;
 			yyt3 = cur;
-			goto yy364;
+			goto yy382;
 		} else {
 			if (yych == '\r') {
 				yyt3 = cur;
-				goto yy364;
+				goto yy382;
 			}
-			goto yy314;
+			goto yy332;
 		}
 	} else {
 		if (yych <= '%') {
 			if (yych <= ' ') {
 				yyt3 = cur;
-				goto yy364;
+				goto yy382;
 			}
-			if (yych <= '$') goto yy314;
+			if (yych <= '$') goto yy332;
 			yyt3 = cur;
-			goto yy365;
+			goto yy383;
 		} else {
 			if (yych == '*') {
 				yyt3 = cur;
-				goto yy366;
+				goto yy384;
 			}
-			goto yy314;
+			goto yy332;
 		}
 	}
-yy361:
+yy379:
 	++cur;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '\r') {
 		if (yych <= '\t') {
-			if (yych <= 0x08) goto yy314;
-			goto yy367;
+			if (yych <= 0x08) goto yy332;
+			goto yy385;
 		} else {
-			if (yych <= '\n') goto yy368;
-			if (yych <= '\f') goto yy314;
-			goto yy369;
+			if (yych <= '\n') goto yy386;
+			if (yych <= '\f') goto yy332;
+			goto yy387;
 		}
 	} else {
 		if (yych <= ' ') {
-			if (yych <= 0x1F) goto yy314;
-			goto yy367;
+			if (yych <= 0x1F) goto yy332;
+			goto yy385;
 		} else {
-			if (yych <= '/') goto yy314;
-			if (yych <= '9') goto yy361;
-			goto yy314;
+			if (yych <= '/') goto yy332;
+			if (yych <= '9') goto yy379;
+			goto yy332;
 		}
 	}
-yy362:
+yy380:
 	yyaccept = 6;
 	yych = *(mar = ++cur);
-	if (yych == '\t') goto yy370;
-	if (yych == ' ') goto yy370;
-yy363:
-#line 510 "../src/parse/lexer.re"
+	if (yych == '\t') goto yy388;
+	if (yych == ' ') goto yy388;
+yy381:
+#line 515 "../src/parse/lexer.re"
 	{
         RET_FAIL(error_at_tok(
                 "ill-formed include directive: expected `!include` followed by spaces, a"
                 " double-quoted file path, optional spaces, a semicolon, and finally a space, a"
                 " newline, or the end of block"));
     }
-#line 2776 "src/parse/lexer.cc"
-yy364:
+#line 2813 "src/parse/lexer.cc"
+yy382:
 	++cur;
 	x = yyt1;
 	y = yyt2;
 	cur = yyt3;
-#line 517 "../src/parse/lexer.re"
+#line 522 "../src/parse/lexer.re"
 	{
         // Save the name of the used block in a temporary buffer (ensure it is empty).
         CHECK(ast.temp_blockname.empty());
         ast.temp_blockname.assign(x, y);
         RET_TOK(TOKEN_BLOCK);
     }
-#line 2789 "src/parse/lexer.cc"
-yy365:
+#line 2826 "src/parse/lexer.cc"
+yy383:
 	yych = *++cur;
-	if (yych == '}') goto yy364;
-	goto yy314;
-yy366:
+	if (yych == '}') goto yy382;
+	goto yy332;
+yy384:
 	yych = *++cur;
-	if (yych == '/') goto yy364;
-	goto yy314;
-yy367:
+	if (yych == '/') goto yy382;
+	goto yy332;
+yy385:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy367;
-		goto yy314;
+		if (yych == '\t') goto yy385;
+		goto yy332;
 	} else {
-		if (yych <= ' ') goto yy367;
-		if (yych == '"') goto yy371;
-		goto yy314;
+		if (yych <= ' ') goto yy385;
+		if (yych == '"') goto yy389;
+		goto yy332;
 	}
-yy368:
+yy386:
 	++cur;
 	cur = yyt1;
-#line 534 "../src/parse/lexer.re"
+#line 539 "../src/parse/lexer.re"
 	{ CHECK_RET(set_sourceline()); RET_TOK(TOKEN_LINE_INFO); }
-#line 2815 "src/parse/lexer.cc"
-yy369:
+#line 2852 "src/parse/lexer.cc"
+yy387:
 	yych = *++cur;
-	if (yych == '\n') goto yy368;
-	goto yy314;
-yy370:
+	if (yych == '\n') goto yy386;
+	goto yy332;
+yy388:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy370;
-		goto yy314;
+		if (yych == '\t') goto yy388;
+		goto yy332;
 	} else {
-		if (yych <= ' ') goto yy370;
+		if (yych <= ' ') goto yy388;
 		if (yych == '"') {
 			yyt1 = cur;
-			goto yy372;
+			goto yy390;
 		}
-		goto yy314;
+		goto yy332;
 	}
-yy371:
+yy389:
 	++cur;
 	if ((lim - cur) < 3) if (!fill(3)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy371;
-	}
-	if (yych <= '\n') goto yy314;
-	if (yych <= '"') goto yy373;
-	goto yy374;
-yy372:
+	if (yybm[0+yych] & 128) goto yy389;
+	if (yych <= '\n') goto yy332;
+	if (yych <= '"') goto yy391;
+	goto yy392;
+yy390:
 	++cur;
 	if ((lim - cur) < 4) if (!fill(4)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '!') {
-		if (yych <= 0x00) goto yy314;
-		if (yych == '\n') goto yy314;
-		goto yy372;
+		if (yych <= 0x00) goto yy332;
+		if (yych == '\n') goto yy332;
+		goto yy390;
 	} else {
-		if (yych <= '"') goto yy375;
-		if (yych == '\\') goto yy376;
-		goto yy372;
+		if (yych <= '"') goto yy393;
+		if (yych == '\\') goto yy394;
+		goto yy390;
 	}
-yy373:
+yy391:
 	yych = *++cur;
-	if (yych == '\n') goto yy368;
-	if (yych == '\r') goto yy369;
-	goto yy314;
-yy374:
+	if (yych == '\n') goto yy386;
+	if (yych == '\r') goto yy387;
+	goto yy332;
+yy392:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yych <= 0x00) goto yy314;
-	if (yych == '\n') goto yy314;
-	goto yy371;
-yy375:
+	if (yych <= 0x00) goto yy332;
+	if (yych == '\n') goto yy332;
+	goto yy389;
+yy393:
 	yych = *++cur;
 	if (yych <= 0x1F) {
 		if (yych == '\t') {
 			yyt2 = cur;
-			goto yy377;
+			goto yy395;
 		}
-		goto yy314;
+		goto yy332;
 	} else {
 		if (yych <= ' ') {
 			yyt2 = cur;
-			goto yy377;
+			goto yy395;
 		}
 		if (yych == ';') {
 			yyt2 = cur;
-			goto yy378;
+			goto yy396;
 		}
-		goto yy314;
+		goto yy332;
 	}
-yy376:
+yy394:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yych <= 0x00) goto yy314;
-	if (yych == '\n') goto yy314;
-	goto yy372;
-yy377:
+	if (yych <= 0x00) goto yy332;
+	if (yych == '\n') goto yy332;
+	goto yy390;
+yy395:
 	++cur;
 	if ((lim - cur) < 3) if (!fill(3)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy377;
-		goto yy314;
+		if (yych == '\t') goto yy395;
+		goto yy332;
 	} else {
-		if (yych <= ' ') goto yy377;
-		if (yych != ';') goto yy314;
+		if (yych <= ' ') goto yy395;
+		if (yych != ';') goto yy332;
 	}
-yy378:
+yy396:
 	yych = *++cur;
 	if (yych <= 0x1F) {
 		if (yych <= '\n') {
-			if (yych <= 0x08) goto yy314;
+			if (yych <= 0x08) goto yy332;
 			yyt3 = cur;
 		} else {
-			if (yych != '\r') goto yy314;
+			if (yych != '\r') goto yy332;
 			yyt3 = cur;
 		}
 	} else {
 		if (yych <= '%') {
 			if (yych <= ' ') {
 				yyt3 = cur;
-				goto yy379;
+				goto yy397;
 			}
-			if (yych <= '$') goto yy314;
+			if (yych <= '$') goto yy332;
 			yyt3 = cur;
-			goto yy380;
+			goto yy398;
 		} else {
 			if (yych == '*') {
 				yyt3 = cur;
-				goto yy381;
+				goto yy399;
 			}
-			goto yy314;
+			goto yy332;
 		}
 	}
-yy379:
+yy397:
 	++cur;
 	x = yyt1;
 	y = yyt2;
 	cur = yyt3;
-#line 506 "../src/parse/lexer.re"
+#line 511 "../src/parse/lexer.re"
 	{
         CHECK_RET(include(getstr(x + 1, y - 1), tok));
         goto scan;
     }
-#line 2944 "src/parse/lexer.cc"
-yy380:
+#line 2979 "src/parse/lexer.cc"
+yy398:
 	yych = *++cur;
-	if (yych == '}') goto yy379;
-	goto yy314;
-yy381:
+	if (yych == '}') goto yy397;
+	goto yy332;
+yy399:
 	yych = *++cur;
-	if (yych == '/') goto yy379;
-	goto yy314;
+	if (yych == '/') goto yy397;
+	goto yy332;
 }
-#line 558 "../src/parse/lexer.re"
+#line 563 "../src/parse/lexer.re"
 
 }
 
@@ -2958,165 +2993,161 @@ yy381:
 
 Ret Input::lex_namedef_context_re2c(bool& yes) {
 
-#line 2962 "src/parse/lexer.cc"
+#line 2997 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0, 128,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		128,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0, 128,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		128,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *(mar = cur);
 	if (yych <= 0x1F) {
 		if (yych == '\t') {
 			yyt1 = cur;
-			goto yy384;
+			goto yy402;
 		}
 	} else {
 		if (yych <= ' ') {
 			yyt1 = cur;
-			goto yy384;
+			goto yy402;
 		}
 		if (yych == '=') {
 			yyt1 = cur;
-			goto yy386;
+			goto yy404;
 		}
 	}
-yy383:
-#line 566 "../src/parse/lexer.re"
+yy401:
+#line 571 "../src/parse/lexer.re"
 	{ yes = false; return Ret::OK; }
-#line 3019 "src/parse/lexer.cc"
-yy384:
+#line 3054 "src/parse/lexer.cc"
+yy402:
 	++cur;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy384;
-	}
-	if (yych == '=') goto yy386;
-yy385:
+	if (yybm[0+yych] & 128) goto yy402;
+	if (yych == '=') goto yy404;
+yy403:
 	cur = mar;
-	goto yy383;
-yy386:
+	goto yy401;
+yy404:
 	yych = *++cur;
-	if (yych == '>') goto yy385;
+	if (yych == '>') goto yy403;
 	++cur;
 	cur = yyt1;
-#line 565 "../src/parse/lexer.re"
+#line 570 "../src/parse/lexer.re"
 	{ yes = true;  return Ret::OK; }
-#line 3038 "src/parse/lexer.cc"
+#line 3071 "src/parse/lexer.cc"
 }
-#line 567 "../src/parse/lexer.re"
+#line 572 "../src/parse/lexer.re"
 
 }
 
 Ret Input::lex_namedef_context_flex(bool& yes) {
 
-#line 3046 "src/parse/lexer.cc"
+#line 3079 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0, 128,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		128,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0, 128,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		128,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych == '\t') {
 		yyt1 = cur;
-		goto yy388;
+		goto yy406;
 	}
 	if (yych == ' ') {
 		yyt1 = cur;
-		goto yy388;
+		goto yy406;
 	}
-#line 574 "../src/parse/lexer.re"
+#line 579 "../src/parse/lexer.re"
 	{ yes = false; return Ret::OK; }
-#line 3095 "src/parse/lexer.cc"
-yy388:
+#line 3128 "src/parse/lexer.cc"
+yy406:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy388;
-	}
+	if (yybm[0+yych] & 128) goto yy406;
 	if (yych <= '<') {
-		if (yych == ':') goto yy389;
+		if (yych == ':') goto yy407;
 	} else {
-		if (yych <= '=') goto yy389;
-		if (yych == '{') goto yy389;
+		if (yych <= '=') goto yy407;
+		if (yych == '{') goto yy407;
 	}
 	cur = yyt1;
-#line 573 "../src/parse/lexer.re"
+#line 578 "../src/parse/lexer.re"
 	{ yes = true;  return Ret::OK; }
-#line 3112 "src/parse/lexer.cc"
-yy389:
+#line 3143 "src/parse/lexer.cc"
+yy407:
 	++cur;
 	cur = yyt1;
-#line 572 "../src/parse/lexer.re"
+#line 577 "../src/parse/lexer.re"
 	{ yes = false; return Ret::OK; }
-#line 3118 "src/parse/lexer.cc"
+#line 3149 "src/parse/lexer.cc"
 }
-#line 575 "../src/parse/lexer.re"
+#line 580 "../src/parse/lexer.re"
 
 }
 
@@ -3126,254 +3157,248 @@ Ret Input::lex_clist(Ast& ast, int& token) {
     // Due to the re2c grammar parser must reduce each condition list before shifing a new one.
     CHECK(cl.empty());
 
-#line 3130 "src/parse/lexer.cc"
+#line 3161 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0, 128,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		128,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0, 128,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		128,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
-	goto yy390;
-yy391:
+	goto yy408;
+yy409:
 	++cur;
-yy390:
+yy408:
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy391;
-	}
-	if (yych <= 0x1F) goto yy392;
-	if (yych <= '!') goto yy393;
-	if (yych == '>') goto yy394;
-yy392:
-#line 586 "../src/parse/lexer.re"
+	if (yybm[0+yych] & 128) goto yy409;
+	if (yych <= 0x1F) goto yy410;
+	if (yych <= '!') goto yy411;
+	if (yych == '>') goto yy412;
+yy410:
+#line 591 "../src/parse/lexer.re"
 	{ goto cond; }
-#line 3182 "src/parse/lexer.cc"
-yy393:
+#line 3211 "src/parse/lexer.cc"
+yy411:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yych == '\t') goto yy393;
-	if (yych == ' ') goto yy393;
-#line 584 "../src/parse/lexer.re"
+	if (yych == '\t') goto yy411;
+	if (yych == ' ') goto yy411;
+#line 589 "../src/parse/lexer.re"
 	{ token = TOKEN_CSETUP; goto cond; }
-#line 3191 "src/parse/lexer.cc"
-yy394:
+#line 3220 "src/parse/lexer.cc"
+yy412:
 	++cur;
-#line 585 "../src/parse/lexer.re"
+#line 590 "../src/parse/lexer.re"
 	{ token = TOKEN_CZERO;  goto end; }
-#line 3196 "src/parse/lexer.cc"
+#line 3225 "src/parse/lexer.cc"
 }
-#line 587 "../src/parse/lexer.re"
+#line 592 "../src/parse/lexer.re"
 
 cond:
     tok = cur;
 
-#line 3203 "src/parse/lexer.cc"
+#line 3232 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128,   0,   0,   0,   0,   0,   0, 
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128,   0,   0,   0,   0, 128, 
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128,   0,   0,   0,   0,   0,   0,
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128,   0,   0,   0,   0, 128,
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 'Z') {
-		if (yych == '*') goto yy397;
-		if (yych >= 'A') goto yy398;
+		if (yych == '*') goto yy415;
+		if (yych >= 'A') goto yy416;
 	} else {
 		if (yych <= '_') {
-			if (yych >= '_') goto yy398;
+			if (yych >= '_') goto yy416;
 		} else {
-			if (yych <= '`') goto yy396;
-			if (yych <= 'z') goto yy398;
+			if (yych <= '`') goto yy414;
+			if (yych <= 'z') goto yy416;
 		}
 	}
-yy396:
+yy414:
 	++cur;
-#line 593 "../src/parse/lexer.re"
+#line 598 "../src/parse/lexer.re"
 	{ goto error; }
-#line 3257 "src/parse/lexer.cc"
-yy397:
+#line 3286 "src/parse/lexer.cc"
+yy415:
 	++cur;
-#line 592 "../src/parse/lexer.re"
+#line 597 "../src/parse/lexer.re"
 	{ if (!cl.empty()) goto error; cl.insert("*"); goto next; }
-#line 3262 "src/parse/lexer.cc"
-yy398:
+#line 3291 "src/parse/lexer.cc"
+yy416:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy398;
-	}
-#line 591 "../src/parse/lexer.re"
+	if (yybm[0+yych] & 128) goto yy416;
+#line 596 "../src/parse/lexer.re"
 	{ cl.insert(getstr(tok, cur)); goto next; }
-#line 3272 "src/parse/lexer.cc"
+#line 3299 "src/parse/lexer.cc"
 }
-#line 594 "../src/parse/lexer.re"
+#line 599 "../src/parse/lexer.re"
 
 next: 
-#line 3277 "src/parse/lexer.cc"
+#line 3304 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0, 128,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		128,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0, 128,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		128,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= ' ') {
-		if (yych == '\t') goto yy401;
-		if (yych >= ' ') goto yy401;
+		if (yych == '\t') goto yy419;
+		if (yych >= ' ') goto yy419;
 	} else {
 		if (yych <= ',') {
-			if (yych >= ',') goto yy402;
+			if (yych >= ',') goto yy420;
 		} else {
-			if (yych == '>') goto yy403;
+			if (yych == '>') goto yy421;
 		}
 	}
 	++cur;
-yy400:
-#line 598 "../src/parse/lexer.re"
+yy418:
+#line 603 "../src/parse/lexer.re"
 	{ goto error; }
-#line 3330 "src/parse/lexer.cc"
-yy401:
+#line 3357 "src/parse/lexer.cc"
+yy419:
 	yych = *(mar = ++cur);
 	if (yych <= ' ') {
-		if (yych == '\t') goto yy404;
-		if (yych <= 0x1F) goto yy400;
-		goto yy404;
+		if (yych == '\t') goto yy422;
+		if (yych <= 0x1F) goto yy418;
+		goto yy422;
 	} else {
 		if (yych <= ',') {
-			if (yych <= '+') goto yy400;
+			if (yych <= '+') goto yy418;
 		} else {
-			if (yych == '>') goto yy403;
-			goto yy400;
+			if (yych == '>') goto yy421;
+			goto yy418;
 		}
 	}
-yy402:
+yy420:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy402;
-	}
-#line 596 "../src/parse/lexer.re"
+	if (yybm[0+yych] & 128) goto yy420;
+#line 601 "../src/parse/lexer.re"
 	{ goto cond; }
-#line 3354 "src/parse/lexer.cc"
-yy403:
+#line 3379 "src/parse/lexer.cc"
+yy421:
 	++cur;
-#line 597 "../src/parse/lexer.re"
+#line 602 "../src/parse/lexer.re"
 	{ goto end; }
-#line 3359 "src/parse/lexer.cc"
-yy404:
+#line 3384 "src/parse/lexer.cc"
+yy422:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= ' ') {
-		if (yych == '\t') goto yy404;
-		if (yych >= ' ') goto yy404;
+		if (yych == '\t') goto yy422;
+		if (yych >= ' ') goto yy422;
 	} else {
 		if (yych <= ',') {
-			if (yych >= ',') goto yy402;
+			if (yych >= ',') goto yy420;
 		} else {
-			if (yych == '>') goto yy403;
+			if (yych == '>') goto yy421;
 		}
 	}
 	cur = mar;
-	goto yy400;
+	goto yy418;
 }
-#line 599 "../src/parse/lexer.re"
+#line 604 "../src/parse/lexer.re"
 
 end:
     // semantic value `yylval` is implicitly passed in temporary condition list
@@ -3437,88 +3462,88 @@ Ret Input::process_semact(YYSTYPE* yylval, Ast& ast, const uint8_t* p, const uin
 Ret Input::lex_code_indented(YYSTYPE* yylval, Ast& ast) {
     tok = cur;
 code: 
-#line 3441 "src/parse/lexer.cc"
+#line 3466 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '\'') {
 		if (yych <= '\r') {
-			if (yych == '\n') goto yy407;
-			if (yych >= '\r') goto yy408;
+			if (yych == '\n') goto yy425;
+			if (yych >= '\r') goto yy426;
 		} else {
-			if (yych == '"') goto yy409;
-			if (yych >= '\'') goto yy409;
+			if (yych == '"') goto yy427;
+			if (yych >= '\'') goto yy427;
 		}
 	} else {
 		if (yych <= '`') {
-			if (yych == '/') goto yy410;
-			if (yych >= '`') goto yy409;
+			if (yych == '/') goto yy428;
+			if (yych >= '`') goto yy427;
 		} else {
 			if (yych <= '{') {
-				if (yych >= '{') goto yy411;
+				if (yych >= '{') goto yy429;
 			} else {
-				if (yych == '}') goto yy411;
+				if (yych == '}') goto yy429;
 			}
 		}
 	}
 	++cur;
-yy406:
-#line 667 "../src/parse/lexer.re"
+yy424:
+#line 672 "../src/parse/lexer.re"
 	{ goto code; }
-#line 3470 "src/parse/lexer.cc"
-yy407:
+#line 3495 "src/parse/lexer.cc"
+yy425:
 	++cur;
-#line 662 "../src/parse/lexer.re"
+#line 667 "../src/parse/lexer.re"
 	{ next_line(); goto indent; }
-#line 3475 "src/parse/lexer.cc"
-yy408:
+#line 3500 "src/parse/lexer.cc"
+yy426:
 	yych = *++cur;
-	if (yych == '\n') goto yy407;
-	goto yy406;
-yy409:
+	if (yych == '\n') goto yy425;
+	goto yy424;
+yy427:
 	++cur;
-#line 665 "../src/parse/lexer.re"
+#line 670 "../src/parse/lexer.re"
 	{ CHECK_RET(try_lex_literal_in_code(cur[-1])); goto code; }
-#line 3484 "src/parse/lexer.cc"
-yy410:
+#line 3509 "src/parse/lexer.cc"
+yy428:
 	yych = *++cur;
-	if (yych == '*') goto yy412;
-	if (yych == '/') goto yy413;
-	goto yy406;
-yy411:
+	if (yych == '*') goto yy430;
+	if (yych == '/') goto yy431;
+	goto yy424;
+yy429:
 	++cur;
-#line 666 "../src/parse/lexer.re"
+#line 671 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at_cur("Curly braces are not allowed after ':='")); }
-#line 3494 "src/parse/lexer.cc"
-yy412:
+#line 3519 "src/parse/lexer.cc"
+yy430:
 	++cur;
-#line 664 "../src/parse/lexer.re"
+#line 669 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_c_comment()); goto code; }
-#line 3499 "src/parse/lexer.cc"
-yy413:
+#line 3524 "src/parse/lexer.cc"
+yy431:
 	++cur;
-#line 663 "../src/parse/lexer.re"
+#line 668 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_cpp_comment()); goto indent; }
-#line 3504 "src/parse/lexer.cc"
+#line 3529 "src/parse/lexer.cc"
 }
-#line 668 "../src/parse/lexer.re"
+#line 673 "../src/parse/lexer.re"
 
 indent: 
-#line 3509 "src/parse/lexer.cc"
+#line 3534 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '\f') {
-		if (yych <= 0x08) goto yy415;
-		if (yych <= '\n') goto yy416;
+		if (yych <= 0x08) goto yy433;
+		if (yych <= '\n') goto yy434;
 	} else {
-		if (yych <= '\r') goto yy416;
-		if (yych == ' ') goto yy416;
+		if (yych <= '\r') goto yy434;
+		if (yych == ' ') goto yy434;
 	}
-yy415:
-#line 671 "../src/parse/lexer.re"
+yy433:
+#line 676 "../src/parse/lexer.re"
 	{
         const uint8_t* p = tok, *q = cur - 1;
         if (!globopts->indentation_sensitive) {
@@ -3527,117 +3552,115 @@ yy415:
         }
         return process_semact(yylval, ast, p, q);
     }
-#line 3531 "src/parse/lexer.cc"
-yy416:
+#line 3556 "src/parse/lexer.cc"
+yy434:
 	++cur;
 	cur -= 1;
-#line 670 "../src/parse/lexer.re"
+#line 675 "../src/parse/lexer.re"
 	{ goto code; }
-#line 3537 "src/parse/lexer.cc"
+#line 3562 "src/parse/lexer.cc"
 }
-#line 679 "../src/parse/lexer.re"
+#line 684 "../src/parse/lexer.re"
 
 }
 
 Ret Input::lex_code_in_braces(YYSTYPE* yylval, Ast& ast) {
     uint32_t depth = 1;
 code: 
-#line 3546 "src/parse/lexer.cc"
+#line 3571 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 160,   0, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		160, 128,   0, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		192, 192, 192, 192, 192, 192, 192, 192, 
-		192, 192, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128,   0, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 160,   0, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		160, 128,   0, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		192, 192, 192, 192, 192, 192, 192, 192,
+		192, 192, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128,   0, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
 	};
 	if ((lim - cur) < 3) if (!fill(3)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '\'') {
 		if (yych <= '\r') {
-			if (yych == '\n') goto yy419;
-			if (yych >= '\r') goto yy421;
+			if (yych == '\n') goto yy437;
+			if (yych >= '\r') goto yy439;
 		} else {
-			if (yych == '"') goto yy422;
-			if (yych >= '\'') goto yy422;
+			if (yych == '"') goto yy440;
+			if (yych >= '\'') goto yy440;
 		}
 	} else {
 		if (yych <= '`') {
-			if (yych == '/') goto yy423;
-			if (yych >= '`') goto yy422;
+			if (yych == '/') goto yy441;
+			if (yych >= '`') goto yy440;
 		} else {
 			if (yych <= '{') {
-				if (yych >= '{') goto yy424;
+				if (yych >= '{') goto yy442;
 			} else {
-				if (yych == '}') goto yy425;
+				if (yych == '}') goto yy443;
 			}
 		}
 	}
 	++cur;
-yy418:
-#line 706 "../src/parse/lexer.re"
+yy436:
+#line 711 "../src/parse/lexer.re"
 	{ goto code; }
-#line 3609 "src/parse/lexer.cc"
-yy419:
+#line 3634 "src/parse/lexer.cc"
+yy437:
 	yych = *(mar = ++cur);
-	if (yybm[0+yych] & 32) {
-		goto yy426;
-	}
-	if (yych == '#') goto yy428;
-yy420:
-#line 702 "../src/parse/lexer.re"
+	if (yybm[0+yych] & 32) goto yy444;
+	if (yych == '#') goto yy446;
+yy438:
+#line 707 "../src/parse/lexer.re"
 	{ next_line(); goto code; }
-#line 3619 "src/parse/lexer.cc"
-yy421:
+#line 3642 "src/parse/lexer.cc"
+yy439:
 	yych = *++cur;
-	if (yych == '\n') goto yy419;
-	goto yy418;
-yy422:
+	if (yych == '\n') goto yy437;
+	goto yy436;
+yy440:
 	++cur;
-#line 705 "../src/parse/lexer.re"
+#line 710 "../src/parse/lexer.re"
 	{ CHECK_RET(try_lex_literal_in_code(cur[-1])); goto code; }
-#line 3628 "src/parse/lexer.cc"
-yy423:
+#line 3651 "src/parse/lexer.cc"
+yy441:
 	yych = *++cur;
-	if (yych == '*') goto yy429;
-	if (yych == '/') goto yy430;
-	goto yy418;
-yy424:
+	if (yych == '*') goto yy447;
+	if (yych == '/') goto yy448;
+	goto yy436;
+yy442:
 	++cur;
-#line 700 "../src/parse/lexer.re"
+#line 705 "../src/parse/lexer.re"
 	{ ++depth; goto code; }
-#line 3638 "src/parse/lexer.cc"
-yy425:
+#line 3661 "src/parse/lexer.cc"
+yy443:
 	++cur;
-#line 685 "../src/parse/lexer.re"
+#line 690 "../src/parse/lexer.re"
 	{
         --depth;
         if (depth > 0) goto code;
@@ -3652,125 +3675,119 @@ yy425:
         }
         return process_semact(yylval, ast, p, q);
     }
-#line 3656 "src/parse/lexer.cc"
-yy426:
+#line 3679 "src/parse/lexer.cc"
+yy444:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 32) {
-		goto yy426;
-	}
-	if (yych == '#') goto yy428;
-yy427:
+	if (yybm[0+yych] & 32) goto yy444;
+	if (yych == '#') goto yy446;
+yy445:
 	cur = mar;
-	goto yy420;
-yy428:
+	goto yy438;
+yy446:
 	++cur;
 	if ((lim - cur) < 5) if (!fill(5)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy428;
-		goto yy427;
+		if (yych == '\t') goto yy446;
+		goto yy445;
 	} else {
-		if (yych <= ' ') goto yy428;
-		if (yych == 'l') goto yy431;
-		goto yy427;
+		if (yych <= ' ') goto yy446;
+		if (yych == 'l') goto yy449;
+		goto yy445;
 	}
-yy429:
+yy447:
 	++cur;
-#line 703 "../src/parse/lexer.re"
+#line 708 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_c_comment()); goto code; }
-#line 3684 "src/parse/lexer.cc"
-yy430:
+#line 3705 "src/parse/lexer.cc"
+yy448:
 	++cur;
-#line 704 "../src/parse/lexer.re"
+#line 709 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_cpp_comment()); goto code; }
-#line 3689 "src/parse/lexer.cc"
-yy431:
+#line 3710 "src/parse/lexer.cc"
+yy449:
 	yych = *++cur;
-	if (yych != 'i') goto yy427;
+	if (yych != 'i') goto yy445;
 	yych = *++cur;
-	if (yych != 'n') goto yy427;
+	if (yych != 'n') goto yy445;
 	yych = *++cur;
-	if (yych != 'e') goto yy427;
+	if (yych != 'e') goto yy445;
 	yych = *++cur;
-	if (yych <= '0') goto yy433;
-	if (yych <= '9') goto yy427;
-	goto yy433;
-yy432:
+	if (yych <= '0') goto yy451;
+	if (yych <= '9') goto yy445;
+	goto yy451;
+yy450:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-yy433:
+yy451:
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy432;
-		goto yy427;
+		if (yych == '\t') goto yy450;
+		goto yy445;
 	} else {
-		if (yych <= ' ') goto yy432;
-		if (yych <= '0') goto yy427;
-		if (yych >= ':') goto yy427;
+		if (yych <= ' ') goto yy450;
+		if (yych <= '0') goto yy445;
+		if (yych >= ':') goto yy445;
 		yyt1 = cur;
 	}
-yy434:
+yy452:
 	++cur;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 64) {
-		goto yy434;
-	}
+	if (yybm[0+yych] & 64) goto yy452;
 	if (yych <= '\f') {
-		if (yych <= 0x08) goto yy427;
-		if (yych <= '\t') goto yy435;
-		if (yych <= '\n') goto yy436;
-		goto yy427;
+		if (yych <= 0x08) goto yy445;
+		if (yych <= '\t') goto yy453;
+		if (yych <= '\n') goto yy454;
+		goto yy445;
 	} else {
-		if (yych <= '\r') goto yy437;
-		if (yych != ' ') goto yy427;
+		if (yych <= '\r') goto yy455;
+		if (yych != ' ') goto yy445;
 	}
-yy435:
+yy453:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy435;
-		goto yy427;
+		if (yych == '\t') goto yy453;
+		goto yy445;
 	} else {
-		if (yych <= ' ') goto yy435;
-		if (yych == '"') goto yy438;
-		goto yy427;
+		if (yych <= ' ') goto yy453;
+		if (yych == '"') goto yy456;
+		goto yy445;
 	}
-yy436:
+yy454:
 	++cur;
 	cur = yyt1;
-#line 701 "../src/parse/lexer.re"
+#line 706 "../src/parse/lexer.re"
 	{ CHECK_RET(set_sourceline()); goto code; }
-#line 3748 "src/parse/lexer.cc"
-yy437:
+#line 3767 "src/parse/lexer.cc"
+yy455:
 	yych = *++cur;
-	if (yych == '\n') goto yy436;
-	goto yy427;
-yy438:
+	if (yych == '\n') goto yy454;
+	goto yy445;
+yy456:
 	++cur;
 	if ((lim - cur) < 3) if (!fill(3)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 128) {
-		goto yy438;
-	}
-	if (yych <= '\n') goto yy427;
-	if (yych >= '#') goto yy439;
+	if (yybm[0+yych] & 128) goto yy456;
+	if (yych <= '\n') goto yy445;
+	if (yych >= '#') goto yy457;
 	yych = *++cur;
-	if (yych == '\n') goto yy436;
-	if (yych == '\r') goto yy437;
-	goto yy427;
-yy439:
+	if (yych == '\n') goto yy454;
+	if (yych == '\r') goto yy455;
+	goto yy445;
+yy457:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yych <= 0x00) goto yy427;
-	if (yych == '\n') goto yy427;
-	goto yy438;
+	if (yych <= 0x00) goto yy445;
+	if (yych == '\n') goto yy445;
+	goto yy456;
 }
-#line 707 "../src/parse/lexer.re"
+#line 712 "../src/parse/lexer.re"
 
 }
 
@@ -3779,87 +3796,87 @@ Ret Input::try_lex_literal_in_code(uint8_t quote) {
     // brace or newline that would otherwise be erroneously lexed as block terminator symbols.
     if (quote == '"') {
 loop_dquote: 
-#line 3783 "src/parse/lexer.cc"
+#line 3800 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '\r') {
-		if (yych == '\n') goto yy442;
-		if (yych >= '\r') goto yy443;
+		if (yych == '\n') goto yy460;
+		if (yych >= '\r') goto yy461;
 	} else {
 		if (yych <= '"') {
-			if (yych >= '"') goto yy444;
+			if (yych >= '"') goto yy462;
 		} else {
-			if (yych == '\\') goto yy445;
+			if (yych == '\\') goto yy463;
 		}
 	}
 	++cur;
-yy441:
-#line 718 "../src/parse/lexer.re"
+yy459:
+#line 723 "../src/parse/lexer.re"
 	{ goto loop_dquote; }
-#line 3802 "src/parse/lexer.cc"
-yy442:
+#line 3819 "src/parse/lexer.cc"
+yy460:
 	++cur;
-#line 717 "../src/parse/lexer.re"
+#line 722 "../src/parse/lexer.re"
 	{ next_line(); goto loop_dquote; }
-#line 3807 "src/parse/lexer.cc"
-yy443:
+#line 3824 "src/parse/lexer.cc"
+yy461:
 	yych = *++cur;
-	if (yych == '\n') goto yy442;
-	goto yy441;
-yy444:
+	if (yych == '\n') goto yy460;
+	goto yy459;
+yy462:
 	++cur;
-#line 715 "../src/parse/lexer.re"
+#line 720 "../src/parse/lexer.re"
 	{ return Ret::OK; }
-#line 3816 "src/parse/lexer.cc"
-yy445:
+#line 3833 "src/parse/lexer.cc"
+yy463:
 	yych = *++cur;
-	if (yych == '"') goto yy446;
-	if (yych != '\\') goto yy441;
-yy446:
+	if (yych == '"') goto yy464;
+	if (yych != '\\') goto yy459;
+yy464:
 	++cur;
-#line 716 "../src/parse/lexer.re"
+#line 721 "../src/parse/lexer.re"
 	{ goto loop_dquote; }
-#line 3825 "src/parse/lexer.cc"
+#line 3842 "src/parse/lexer.cc"
 }
-#line 719 "../src/parse/lexer.re"
+#line 724 "../src/parse/lexer.re"
 
     } else if (quote == '`') {
         if (!globopts->backtick_quoted_strings) return Ret::OK; // skip
 loop_backtick: 
-#line 3832 "src/parse/lexer.cc"
+#line 3849 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '\f') {
-		if (yych == '\n') goto yy449;
+		if (yych == '\n') goto yy467;
 	} else {
-		if (yych <= '\r') goto yy450;
-		if (yych == '`') goto yy451;
+		if (yych <= '\r') goto yy468;
+		if (yych == '`') goto yy469;
 	}
 	++cur;
-yy448:
-#line 725 "../src/parse/lexer.re"
+yy466:
+#line 730 "../src/parse/lexer.re"
 	{ goto loop_backtick; }
-#line 3847 "src/parse/lexer.cc"
-yy449:
+#line 3864 "src/parse/lexer.cc"
+yy467:
 	++cur;
-#line 724 "../src/parse/lexer.re"
+#line 729 "../src/parse/lexer.re"
 	{ next_line(); goto loop_backtick; }
-#line 3852 "src/parse/lexer.cc"
-yy450:
+#line 3869 "src/parse/lexer.cc"
+yy468:
 	yych = *++cur;
-	if (yych == '\n') goto yy449;
-	goto yy448;
-yy451:
+	if (yych == '\n') goto yy467;
+	goto yy466;
+yy469:
 	++cur;
-#line 723 "../src/parse/lexer.re"
+#line 728 "../src/parse/lexer.re"
 	{ return Ret::OK; }
-#line 3861 "src/parse/lexer.cc"
+#line 3878 "src/parse/lexer.cc"
 }
-#line 726 "../src/parse/lexer.re"
+#line 731 "../src/parse/lexer.re"
 
     } else if (quote == '\'') {
         // Single-quoted char literals may contain closing curly brace, e.g. '}'.
@@ -3867,338 +3884,332 @@ yy451:
         // might erroneously lex the closing single quote as the beginning of another literal, e.g.
         // in 'a'}'b' we would recognize '}' as a literal rather than the closing brace of a block.
     
-#line 3871 "src/parse/lexer.cc"
+#line 3888 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		192, 192, 192, 192, 192, 192, 192, 192, 
-		128, 128,   0,   0,   0,   0,   0,   0, 
-		  0, 128, 128, 128, 128, 128, 128,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0, 128, 128, 128, 128, 128, 128,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
-		  0,   0,   0,   0,   0,   0,   0,   0, 
+	static const unsigned char yybm[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		192, 192, 192, 192, 192, 192, 192, 192,
+		128, 128,   0,   0,   0,   0,   0,   0,
+		  0, 128, 128, 128, 128, 128, 128,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0, 128, 128, 128, 128, 128, 128,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0
 	};
 	if ((lim - cur) < 11) if (!fill(11)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *(mar = cur);
 	if (yych <= 0xDF) {
 		if (yych <= '\\') {
-			if (yych <= '[') goto yy454;
-			goto yy456;
+			if (yych <= '[') goto yy472;
+			goto yy474;
 		} else {
-			if (yych <= 0x7F) goto yy454;
-			if (yych >= 0xC2) goto yy457;
+			if (yych <= 0x7F) goto yy472;
+			if (yych >= 0xC2) goto yy475;
 		}
 	} else {
 		if (yych <= 0xF0) {
-			if (yych <= 0xE0) goto yy458;
-			if (yych <= 0xEF) goto yy459;
-			goto yy460;
+			if (yych <= 0xE0) goto yy476;
+			if (yych <= 0xEF) goto yy477;
+			goto yy478;
 		} else {
-			if (yych <= 0xF3) goto yy461;
-			if (yych <= 0xF4) goto yy462;
+			if (yych <= 0xF3) goto yy479;
+			if (yych <= 0xF4) goto yy480;
 		}
 	}
-yy453:
-#line 746 "../src/parse/lexer.re"
+yy471:
+#line 751 "../src/parse/lexer.re"
 	{ return globopts->standalone_single_quotes ? Ret::OK : Ret::FAIL; }
-#line 3931 "src/parse/lexer.cc"
-yy454:
+#line 3948 "src/parse/lexer.cc"
+yy472:
 	yych = *++cur;
-	if (yych == '\'') goto yy463;
-yy455:
+	if (yych == '\'') goto yy481;
+yy473:
 	cur = mar;
-	goto yy453;
-yy456:
+	goto yy471;
+yy474:
 	yych = *++cur;
 	if (yych <= 'b') {
 		if (yych <= '>') {
 			if (yych <= '/') {
-				if (yych == '\'') goto yy465;
-				goto yy455;
+				if (yych == '\'') goto yy483;
+				goto yy473;
 			} else {
-				if (yych <= '0') goto yy466;
-				if (yych <= '7') goto yy467;
-				goto yy455;
+				if (yych <= '0') goto yy484;
+				if (yych <= '7') goto yy485;
+				goto yy473;
 			}
 		} else {
 			if (yych <= 'U') {
-				if (yych <= '?') goto yy454;
-				if (yych <= 'T') goto yy455;
-				goto yy468;
+				if (yych <= '?') goto yy472;
+				if (yych <= 'T') goto yy473;
+				goto yy486;
 			} else {
-				if (yych == '\\') goto yy454;
-				if (yych <= '`') goto yy455;
-				goto yy454;
+				if (yych == '\\') goto yy472;
+				if (yych <= '`') goto yy473;
+				goto yy472;
 			}
 		}
 	} else {
 		if (yych <= 'r') {
 			if (yych <= 'm') {
-				if (yych == 'f') goto yy454;
-				goto yy455;
+				if (yych == 'f') goto yy472;
+				goto yy473;
 			} else {
-				if (yych <= 'n') goto yy454;
-				if (yych <= 'o') goto yy469;
-				if (yych <= 'q') goto yy455;
-				goto yy454;
+				if (yych <= 'n') goto yy472;
+				if (yych <= 'o') goto yy487;
+				if (yych <= 'q') goto yy473;
+				goto yy472;
 			}
 		} else {
 			if (yych <= 'u') {
-				if (yych <= 's') goto yy455;
-				if (yych <= 't') goto yy454;
-				goto yy470;
+				if (yych <= 's') goto yy473;
+				if (yych <= 't') goto yy472;
+				goto yy488;
 			} else {
-				if (yych <= 'v') goto yy454;
-				if (yych == 'x') goto yy471;
-				goto yy455;
+				if (yych <= 'v') goto yy472;
+				if (yych == 'x') goto yy489;
+				goto yy473;
 			}
 		}
 	}
-yy457:
+yy475:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy455;
-	if (yych <= 0xBF) goto yy454;
-	goto yy455;
-yy458:
+	if (yych <= 0x7F) goto yy473;
+	if (yych <= 0xBF) goto yy472;
+	goto yy473;
+yy476:
 	yych = *++cur;
-	if (yych <= 0x9F) goto yy455;
-	if (yych <= 0xBF) goto yy457;
-	goto yy455;
-yy459:
+	if (yych <= 0x9F) goto yy473;
+	if (yych <= 0xBF) goto yy475;
+	goto yy473;
+yy477:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy455;
-	if (yych <= 0xBF) goto yy457;
-	goto yy455;
-yy460:
+	if (yych <= 0x7F) goto yy473;
+	if (yych <= 0xBF) goto yy475;
+	goto yy473;
+yy478:
 	yych = *++cur;
-	if (yych <= 0x8F) goto yy455;
-	if (yych <= 0xBF) goto yy459;
-	goto yy455;
-yy461:
+	if (yych <= 0x8F) goto yy473;
+	if (yych <= 0xBF) goto yy477;
+	goto yy473;
+yy479:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy455;
-	if (yych <= 0xBF) goto yy459;
-	goto yy455;
-yy462:
+	if (yych <= 0x7F) goto yy473;
+	if (yych <= 0xBF) goto yy477;
+	goto yy473;
+yy480:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy455;
-	if (yych <= 0x8F) goto yy459;
-	goto yy455;
-yy463:
+	if (yych <= 0x7F) goto yy473;
+	if (yych <= 0x8F) goto yy477;
+	goto yy473;
+yy481:
 	++cur;
-yy464:
-#line 743 "../src/parse/lexer.re"
+yy482:
+#line 748 "../src/parse/lexer.re"
 	{ // any UTF-8 encoded Unicode symbol, unescaped
             return Ret::OK;
         }
-#line 4021 "src/parse/lexer.cc"
-yy465:
+#line 4038 "src/parse/lexer.cc"
+yy483:
 	yych = *++cur;
-	if (yych == '\'') goto yy463;
-	goto yy464;
-yy466:
+	if (yych == '\'') goto yy481;
+	goto yy482;
+yy484:
 	yych = *++cur;
-	if (yych == '\'') goto yy463;
-	if (yych <= '/') goto yy455;
-	if (yych <= '7') goto yy472;
-	goto yy455;
-yy467:
+	if (yych == '\'') goto yy481;
+	if (yych <= '/') goto yy473;
+	if (yych <= '7') goto yy490;
+	goto yy473;
+yy485:
 	yych = *++cur;
-	if (yych <= '/') goto yy455;
-	if (yych <= '7') goto yy472;
-	goto yy455;
-yy468:
+	if (yych <= '/') goto yy473;
+	if (yych <= '7') goto yy490;
+	goto yy473;
+yy486:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy455;
-		if (yych <= '9') goto yy473;
-		goto yy455;
+		if (yych <= '/') goto yy473;
+		if (yych <= '9') goto yy491;
+		goto yy473;
 	} else {
-		if (yych <= 'F') goto yy473;
-		if (yych <= '`') goto yy455;
-		if (yych <= 'f') goto yy473;
-		goto yy455;
+		if (yych <= 'F') goto yy491;
+		if (yych <= '`') goto yy473;
+		if (yych <= 'f') goto yy491;
+		goto yy473;
 	}
-yy469:
+yy487:
 	yych = *++cur;
-	if (yych == '{') goto yy474;
-	goto yy455;
-yy470:
+	if (yych == '{') goto yy492;
+	goto yy473;
+yy488:
 	yych = *++cur;
 	if (yych <= 'F') {
-		if (yych <= '/') goto yy455;
-		if (yych <= '9') goto yy475;
-		if (yych <= '@') goto yy455;
-		goto yy475;
+		if (yych <= '/') goto yy473;
+		if (yych <= '9') goto yy493;
+		if (yych <= '@') goto yy473;
+		goto yy493;
 	} else {
 		if (yych <= 'f') {
-			if (yych <= '`') goto yy455;
-			goto yy475;
+			if (yych <= '`') goto yy473;
+			goto yy493;
 		} else {
-			if (yych == '{') goto yy476;
-			goto yy455;
+			if (yych == '{') goto yy494;
+			goto yy473;
 		}
 	}
-yy471:
+yy489:
 	yych = *++cur;
 	if (yych <= 'F') {
-		if (yych <= '/') goto yy455;
-		if (yych <= '9') goto yy477;
-		if (yych <= '@') goto yy455;
-		goto yy477;
+		if (yych <= '/') goto yy473;
+		if (yych <= '9') goto yy495;
+		if (yych <= '@') goto yy473;
+		goto yy495;
 	} else {
 		if (yych <= 'f') {
-			if (yych <= '`') goto yy455;
-			goto yy477;
+			if (yych <= '`') goto yy473;
+			goto yy495;
 		} else {
-			if (yych == '{') goto yy476;
-			goto yy455;
+			if (yych == '{') goto yy494;
+			goto yy473;
 		}
 	}
-yy472:
+yy490:
 	yych = *++cur;
-	if (yych <= '/') goto yy455;
-	if (yych <= '7') goto yy454;
-	goto yy455;
-yy473:
+	if (yych <= '/') goto yy473;
+	if (yych <= '7') goto yy472;
+	goto yy473;
+yy491:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy455;
-		if (yych <= '9') goto yy478;
-		goto yy455;
+		if (yych <= '/') goto yy473;
+		if (yych <= '9') goto yy496;
+		goto yy473;
 	} else {
-		if (yych <= 'F') goto yy478;
-		if (yych <= '`') goto yy455;
-		if (yych <= 'f') goto yy478;
-		goto yy455;
+		if (yych <= 'F') goto yy496;
+		if (yych <= '`') goto yy473;
+		if (yych <= 'f') goto yy496;
+		goto yy473;
 	}
-yy474:
+yy492:
 	yych = *++cur;
-	if (yybm[0+yych] & 64) {
-		goto yy479;
-	}
-	goto yy455;
-yy475:
+	if (yybm[0+yych] & 64) goto yy497;
+	goto yy473;
+yy493:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy455;
-		if (yych <= '9') goto yy480;
-		goto yy455;
+		if (yych <= '/') goto yy473;
+		if (yych <= '9') goto yy498;
+		goto yy473;
 	} else {
-		if (yych <= 'F') goto yy480;
-		if (yych <= '`') goto yy455;
-		if (yych <= 'f') goto yy480;
-		goto yy455;
+		if (yych <= 'F') goto yy498;
+		if (yych <= '`') goto yy473;
+		if (yych <= 'f') goto yy498;
+		goto yy473;
 	}
-yy476:
+yy494:
 	yych = *++cur;
-	if (yych == '}') goto yy455;
-	goto yy482;
-yy477:
+	if (yych == '}') goto yy473;
+	goto yy500;
+yy495:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy455;
-		if (yych <= '9') goto yy454;
-		goto yy455;
+		if (yych <= '/') goto yy473;
+		if (yych <= '9') goto yy472;
+		goto yy473;
 	} else {
-		if (yych <= 'F') goto yy454;
-		if (yych <= '`') goto yy455;
-		if (yych <= 'f') goto yy454;
-		goto yy455;
+		if (yych <= 'F') goto yy472;
+		if (yych <= '`') goto yy473;
+		if (yych <= 'f') goto yy472;
+		goto yy473;
 	}
-yy478:
+yy496:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy455;
-		if (yych <= '9') goto yy483;
-		goto yy455;
+		if (yych <= '/') goto yy473;
+		if (yych <= '9') goto yy501;
+		goto yy473;
 	} else {
-		if (yych <= 'F') goto yy483;
-		if (yych <= '`') goto yy455;
-		if (yych <= 'f') goto yy483;
-		goto yy455;
+		if (yych <= 'F') goto yy501;
+		if (yych <= '`') goto yy473;
+		if (yych <= 'f') goto yy501;
+		goto yy473;
 	}
-yy479:
+yy497:
 	++cur;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 64) {
-		goto yy479;
-	}
-	if (yych == '}') goto yy454;
-	goto yy455;
-yy480:
+	if (yybm[0+yych] & 64) goto yy497;
+	if (yych == '}') goto yy472;
+	goto yy473;
+yy498:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy455;
-		if (yych <= '9') goto yy477;
-		goto yy455;
+		if (yych <= '/') goto yy473;
+		if (yych <= '9') goto yy495;
+		goto yy473;
 	} else {
-		if (yych <= 'F') goto yy477;
-		if (yych <= '`') goto yy455;
-		if (yych <= 'f') goto yy477;
-		goto yy455;
+		if (yych <= 'F') goto yy495;
+		if (yych <= '`') goto yy473;
+		if (yych <= 'f') goto yy495;
+		goto yy473;
 	}
-yy481:
+yy499:
 	++cur;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-yy482:
-	if (yybm[0+yych] & 128) {
-		goto yy481;
-	}
-	if (yych == '}') goto yy454;
-	goto yy455;
-yy483:
+yy500:
+	if (yybm[0+yych] & 128) goto yy499;
+	if (yych == '}') goto yy472;
+	goto yy473;
+yy501:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy455;
-		if (yych >= ':') goto yy455;
+		if (yych <= '/') goto yy473;
+		if (yych >= ':') goto yy473;
 	} else {
-		if (yych <= 'F') goto yy484;
-		if (yych <= '`') goto yy455;
-		if (yych >= 'g') goto yy455;
+		if (yych <= 'F') goto yy502;
+		if (yych <= '`') goto yy473;
+		if (yych >= 'g') goto yy473;
 	}
-yy484:
+yy502:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy455;
-		if (yych <= '9') goto yy475;
-		goto yy455;
+		if (yych <= '/') goto yy473;
+		if (yych <= '9') goto yy493;
+		goto yy473;
 	} else {
-		if (yych <= 'F') goto yy475;
-		if (yych <= '`') goto yy455;
-		if (yych <= 'f') goto yy475;
-		goto yy455;
+		if (yych <= 'F') goto yy493;
+		if (yych <= '`') goto yy473;
+		if (yych <= 'f') goto yy493;
+		goto yy473;
 	}
 }
-#line 747 "../src/parse/lexer.re"
+#line 752 "../src/parse/lexer.re"
 
     }
     return Ret::FAIL;
@@ -4206,68 +4217,68 @@ yy484:
 
 Ret Input::lex_c_comment() {
 loop: 
-#line 4210 "src/parse/lexer.cc"
+#line 4221 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '\f') {
-		if (yych == '\n') goto yy487;
+		if (yych == '\n') goto yy505;
 	} else {
-		if (yych <= '\r') goto yy488;
-		if (yych == '*') goto yy489;
+		if (yych <= '\r') goto yy506;
+		if (yych == '*') goto yy507;
 	}
 	++cur;
-yy486:
-#line 756 "../src/parse/lexer.re"
+yy504:
+#line 761 "../src/parse/lexer.re"
 	{ goto loop; }
-#line 4225 "src/parse/lexer.cc"
-yy487:
+#line 4236 "src/parse/lexer.cc"
+yy505:
 	++cur;
-#line 755 "../src/parse/lexer.re"
+#line 760 "../src/parse/lexer.re"
 	{ next_line(); goto loop; }
-#line 4230 "src/parse/lexer.cc"
-yy488:
+#line 4241 "src/parse/lexer.cc"
+yy506:
 	yych = *++cur;
-	if (yych == '\n') goto yy487;
-	goto yy486;
-yy489:
+	if (yych == '\n') goto yy505;
+	goto yy504;
+yy507:
 	yych = *++cur;
-	if (yych != '/') goto yy486;
+	if (yych != '/') goto yy504;
 	++cur;
-#line 754 "../src/parse/lexer.re"
+#line 759 "../src/parse/lexer.re"
 	{ return Ret::OK; }
-#line 4241 "src/parse/lexer.cc"
+#line 4252 "src/parse/lexer.cc"
 }
-#line 757 "../src/parse/lexer.re"
+#line 762 "../src/parse/lexer.re"
 
 }
 
 Ret Input::lex_cpp_comment() {
 loop: 
-#line 4249 "src/parse/lexer.cc"
+#line 4260 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yych == '\n') goto yy492;
-	if (yych == '\r') goto yy493;
+	if (yych == '\n') goto yy510;
+	if (yych == '\r') goto yy511;
 	++cur;
-yy491:
-#line 763 "../src/parse/lexer.re"
+yy509:
+#line 768 "../src/parse/lexer.re"
 	{ goto loop; }
-#line 4260 "src/parse/lexer.cc"
-yy492:
+#line 4271 "src/parse/lexer.cc"
+yy510:
 	++cur;
-#line 762 "../src/parse/lexer.re"
+#line 767 "../src/parse/lexer.re"
 	{ next_line(); return Ret::OK; }
-#line 4265 "src/parse/lexer.cc"
-yy493:
+#line 4276 "src/parse/lexer.cc"
+yy511:
 	yych = *++cur;
-	if (yych == '\n') goto yy492;
-	goto yy491;
+	if (yych == '\n') goto yy510;
+	goto yy509;
 }
-#line 764 "../src/parse/lexer.re"
+#line 769 "../src/parse/lexer.re"
 
 }
 
@@ -4278,43 +4289,43 @@ Ret Input::lex_cls(Ast& ast, bool neg, const AstNode*& a) {
 fst:
     tok = cur;
 
-#line 4282 "src/parse/lexer.cc"
+#line 4293 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yych == ']') goto yy495;
-#line 775 "../src/parse/lexer.re"
+	if (yych == ']') goto yy513;
+#line 780 "../src/parse/lexer.re"
 	{ CHECK_RET(lex_cls_chr(l)); goto snd; }
-#line 4290 "src/parse/lexer.cc"
-yy495:
+#line 4301 "src/parse/lexer.cc"
+yy513:
 	++cur;
-#line 774 "../src/parse/lexer.re"
+#line 779 "../src/parse/lexer.re"
 	{ a = ast.cls(loc0, neg); return Ret::OK; }
-#line 4295 "src/parse/lexer.cc"
+#line 4306 "src/parse/lexer.cc"
 }
-#line 776 "../src/parse/lexer.re"
+#line 781 "../src/parse/lexer.re"
 
 snd: 
-#line 4300 "src/parse/lexer.cc"
+#line 4311 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *(mar = cur);
-	if (yych == '-') goto yy498;
-yy497:
-#line 778 "../src/parse/lexer.re"
+	if (yych == '-') goto yy516;
+yy515:
+#line 783 "../src/parse/lexer.re"
 	{ u = l; goto add; }
-#line 4309 "src/parse/lexer.cc"
-yy498:
+#line 4320 "src/parse/lexer.cc"
+yy516:
 	yych = *++cur;
-	if (yych != ']') goto yy499;
+	if (yych != ']') goto yy517;
 	cur = mar;
-	goto yy497;
-yy499:
+	goto yy515;
+yy517:
 	++cur;
 	cur -= 1;
-#line 779 "../src/parse/lexer.re"
+#line 784 "../src/parse/lexer.re"
 	{
         CHECK_RET(lex_cls_chr(u));
         if (l > u) {
@@ -4323,9 +4334,9 @@ yy499:
         }
         goto add;
     }
-#line 4327 "src/parse/lexer.cc"
+#line 4338 "src/parse/lexer.cc"
 }
-#line 787 "../src/parse/lexer.re"
+#line 792 "../src/parse/lexer.re"
 
 add:
     ast.temp_ranges.push_back(AstRange(l, u, loc));
@@ -4336,319 +4347,316 @@ add:
 Ret Input::lex_cls_chr(uint32_t& c) {
     tok = cur;
     const loc_t& loc = cur_loc();
-#line 822 "../src/parse/lexer.re"
+#line 827 "../src/parse/lexer.re"
 
     if (globopts->input_encoding == Enc::Type::ASCII) {
         
-#line 4344 "src/parse/lexer.cc"
+#line 4355 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	unsigned int yyaccept = 0;
 	if ((lim - cur) < 10) if (!fill(10)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '\f') {
-		if (yych == '\n') goto yy502;
+		if (yych == '\n') goto yy520;
 	} else {
-		if (yych <= '\r') goto yy503;
-		if (yych == '\\') goto yy504;
+		if (yych <= '\r') goto yy521;
+		if (yych == '\\') goto yy522;
 	}
 	++cur;
-yy501:
-#line 804 "../src/parse/lexer.re"
+yy519:
+#line 809 "../src/parse/lexer.re"
 	{ c = decode(tok); return Ret::OK; }
-#line 4360 "src/parse/lexer.cc"
-yy502:
+#line 4371 "src/parse/lexer.cc"
+yy520:
 	++cur;
-#line 798 "../src/parse/lexer.re"
+#line 803 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(loc, "newline in character class")); }
-#line 4365 "src/parse/lexer.cc"
-yy503:
+#line 4376 "src/parse/lexer.cc"
+yy521:
 	yych = *++cur;
-	if (yych == '\n') goto yy502;
-	goto yy501;
-yy504:
+	if (yych == '\n') goto yy520;
+	goto yy519;
+yy522:
 	yych = *++cur;
 	if (yych <= '\\') {
 		if (yych <= '/') {
 			if (yych <= '\f') {
-				if (yych <= 0x00) goto yy505;
-				if (yych == '\n') goto yy502;
-				goto yy506;
+				if (yych <= 0x00) goto yy523;
+				if (yych == '\n') goto yy520;
+				goto yy524;
 			} else {
-				if (yych <= '\r') goto yy508;
-				if (yych == '-') goto yy509;
-				goto yy506;
+				if (yych <= '\r') goto yy526;
+				if (yych == '-') goto yy527;
+				goto yy524;
 			}
 		} else {
 			if (yych <= 'U') {
-				if (yych <= '3') goto yy510;
-				if (yych <= '7') goto yy512;
-				if (yych <= 'T') goto yy506;
-				goto yy513;
+				if (yych <= '3') goto yy528;
+				if (yych <= '7') goto yy530;
+				if (yych <= 'T') goto yy524;
+				goto yy531;
 			} else {
-				if (yych == 'X') goto yy515;
-				if (yych <= '[') goto yy506;
-				goto yy516;
+				if (yych == 'X') goto yy533;
+				if (yych <= '[') goto yy524;
+				goto yy534;
 			}
 		}
 	} else {
 		if (yych <= 'n') {
 			if (yych <= 'b') {
-				if (yych <= ']') goto yy517;
-				if (yych <= '`') goto yy506;
-				if (yych <= 'a') goto yy518;
-				goto yy519;
+				if (yych <= ']') goto yy535;
+				if (yych <= '`') goto yy524;
+				if (yych <= 'a') goto yy536;
+				goto yy537;
 			} else {
-				if (yych == 'f') goto yy520;
-				if (yych <= 'm') goto yy506;
-				goto yy521;
+				if (yych == 'f') goto yy538;
+				if (yych <= 'm') goto yy524;
+				goto yy539;
 			}
 		} else {
 			if (yych <= 't') {
-				if (yych == 'r') goto yy522;
-				if (yych <= 's') goto yy506;
-				goto yy523;
+				if (yych == 'r') goto yy540;
+				if (yych <= 's') goto yy524;
+				goto yy541;
 			} else {
 				if (yych <= 'v') {
-					if (yych <= 'u') goto yy515;
-					goto yy524;
+					if (yych <= 'u') goto yy533;
+					goto yy542;
 				} else {
-					if (yych == 'x') goto yy525;
-					goto yy506;
+					if (yych == 'x') goto yy543;
+					goto yy524;
 				}
 			}
 		}
 	}
-yy505:
-#line 801 "../src/parse/lexer.re"
+yy523:
+#line 806 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(loc, "syntax error in escape sequence")); }
-#line 4426 "src/parse/lexer.cc"
-yy506:
+#line 4437 "src/parse/lexer.cc"
+yy524:
 	++cur;
-yy507:
-#line 817 "../src/parse/lexer.re"
+yy525:
+#line 822 "../src/parse/lexer.re"
 	{
         msg.warn.useless_escape(loc, tok, cur);
         c = decode(tok + 1);
         return Ret::OK;
     }
-#line 4436 "src/parse/lexer.cc"
-yy508:
+#line 4447 "src/parse/lexer.cc"
+yy526:
 	yych = *++cur;
-	if (yych == '\n') goto yy502;
-	goto yy507;
-yy509:
+	if (yych == '\n') goto yy520;
+	goto yy525;
+yy527:
 	++cur;
-#line 815 "../src/parse/lexer.re"
+#line 820 "../src/parse/lexer.re"
 	{ c = '-'_u8; return Ret::OK; }
-#line 4445 "src/parse/lexer.cc"
-yy510:
+#line 4456 "src/parse/lexer.cc"
+yy528:
 	yyaccept = 0;
 	yych = *(mar = ++cur);
-	if (yych <= '/') goto yy511;
-	if (yych <= '7') goto yy526;
-yy511:
-#line 800 "../src/parse/lexer.re"
+	if (yych <= '/') goto yy529;
+	if (yych <= '7') goto yy544;
+yy529:
+#line 805 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(loc, "syntax error in octal escape sequence")); }
-#line 4454 "src/parse/lexer.cc"
-yy512:
+#line 4465 "src/parse/lexer.cc"
+yy530:
 	++cur;
-	goto yy511;
-yy513:
+	goto yy529;
+yy531:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy514;
-		if (yych <= '9') goto yy528;
+		if (yych <= '/') goto yy532;
+		if (yych <= '9') goto yy546;
 	} else {
-		if (yych <= 'F') goto yy528;
-		if (yych <= '`') goto yy514;
-		if (yych <= 'f') goto yy528;
+		if (yych <= 'F') goto yy546;
+		if (yych <= '`') goto yy532;
+		if (yych <= 'f') goto yy546;
 	}
-yy514:
-#line 799 "../src/parse/lexer.re"
+yy532:
+#line 804 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(loc, "syntax error in hexadecimal escape sequence")); }
-#line 4472 "src/parse/lexer.cc"
-yy515:
+#line 4483 "src/parse/lexer.cc"
+yy533:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy514;
-		if (yych <= '9') goto yy529;
-		goto yy514;
+		if (yych <= '/') goto yy532;
+		if (yych <= '9') goto yy547;
+		goto yy532;
 	} else {
-		if (yych <= 'F') goto yy529;
-		if (yych <= '`') goto yy514;
-		if (yych <= 'f') goto yy529;
-		goto yy514;
+		if (yych <= 'F') goto yy547;
+		if (yych <= '`') goto yy532;
+		if (yych <= 'f') goto yy547;
+		goto yy532;
 	}
-yy516:
+yy534:
 	++cur;
-#line 814 "../src/parse/lexer.re"
+#line 819 "../src/parse/lexer.re"
 	{ c = '\\'_u8; return Ret::OK; }
-#line 4490 "src/parse/lexer.cc"
-yy517:
+#line 4501 "src/parse/lexer.cc"
+yy535:
 	++cur;
-#line 816 "../src/parse/lexer.re"
+#line 821 "../src/parse/lexer.re"
 	{ c = ']'_u8; return Ret::OK; }
-#line 4495 "src/parse/lexer.cc"
-yy518:
+#line 4506 "src/parse/lexer.cc"
+yy536:
 	++cur;
-#line 807 "../src/parse/lexer.re"
+#line 812 "../src/parse/lexer.re"
 	{ c = '\a'_u8; return Ret::OK; }
-#line 4500 "src/parse/lexer.cc"
-yy519:
+#line 4511 "src/parse/lexer.cc"
+yy537:
 	++cur;
-#line 808 "../src/parse/lexer.re"
+#line 813 "../src/parse/lexer.re"
 	{ c = '\b'_u8; return Ret::OK; }
-#line 4505 "src/parse/lexer.cc"
-yy520:
+#line 4516 "src/parse/lexer.cc"
+yy538:
 	++cur;
-#line 809 "../src/parse/lexer.re"
+#line 814 "../src/parse/lexer.re"
 	{ c = '\f'_u8; return Ret::OK; }
-#line 4510 "src/parse/lexer.cc"
-yy521:
+#line 4521 "src/parse/lexer.cc"
+yy539:
 	++cur;
-#line 810 "../src/parse/lexer.re"
+#line 815 "../src/parse/lexer.re"
 	{ c = '\n'_u8; return Ret::OK; }
-#line 4515 "src/parse/lexer.cc"
-yy522:
+#line 4526 "src/parse/lexer.cc"
+yy540:
 	++cur;
-#line 811 "../src/parse/lexer.re"
+#line 816 "../src/parse/lexer.re"
 	{ c = '\r'_u8; return Ret::OK; }
-#line 4520 "src/parse/lexer.cc"
-yy523:
+#line 4531 "src/parse/lexer.cc"
+yy541:
 	++cur;
-#line 812 "../src/parse/lexer.re"
+#line 817 "../src/parse/lexer.re"
 	{ c = '\t'_u8; return Ret::OK; }
-#line 4525 "src/parse/lexer.cc"
-yy524:
+#line 4536 "src/parse/lexer.cc"
+yy542:
 	++cur;
-#line 813 "../src/parse/lexer.re"
+#line 818 "../src/parse/lexer.re"
 	{ c = '\v'_u8; return Ret::OK; }
-#line 4530 "src/parse/lexer.cc"
-yy525:
+#line 4541 "src/parse/lexer.cc"
+yy543:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy514;
-		if (yych <= '9') goto yy530;
-		goto yy514;
+		if (yych <= '/') goto yy532;
+		if (yych <= '9') goto yy548;
+		goto yy532;
 	} else {
-		if (yych <= 'F') goto yy530;
-		if (yych <= '`') goto yy514;
-		if (yych <= 'f') goto yy530;
-		goto yy514;
+		if (yych <= 'F') goto yy548;
+		if (yych <= '`') goto yy532;
+		if (yych <= 'f') goto yy548;
+		goto yy532;
 	}
-yy526:
+yy544:
 	yych = *++cur;
-	if (yych <= '/') goto yy527;
-	if (yych <= '7') goto yy531;
-yy527:
+	if (yych <= '/') goto yy545;
+	if (yych <= '7') goto yy549;
+yy545:
 	cur = mar;
-	if (yyaccept == 0) {
-		goto yy511;
-	} else {
-		goto yy514;
-	}
-yy528:
+	if (yyaccept == 0) goto yy529;
+	else goto yy532;
+yy546:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy527;
-		if (yych <= '9') goto yy532;
-		goto yy527;
+		if (yych <= '/') goto yy545;
+		if (yych <= '9') goto yy550;
+		goto yy545;
 	} else {
-		if (yych <= 'F') goto yy532;
-		if (yych <= '`') goto yy527;
-		if (yych <= 'f') goto yy532;
-		goto yy527;
+		if (yych <= 'F') goto yy550;
+		if (yych <= '`') goto yy545;
+		if (yych <= 'f') goto yy550;
+		goto yy545;
 	}
-yy529:
+yy547:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy527;
-		if (yych <= '9') goto yy533;
-		goto yy527;
+		if (yych <= '/') goto yy545;
+		if (yych <= '9') goto yy551;
+		goto yy545;
 	} else {
-		if (yych <= 'F') goto yy533;
-		if (yych <= '`') goto yy527;
-		if (yych <= 'f') goto yy533;
-		goto yy527;
+		if (yych <= 'F') goto yy551;
+		if (yych <= '`') goto yy545;
+		if (yych <= 'f') goto yy551;
+		goto yy545;
 	}
-yy530:
+yy548:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy527;
-		if (yych <= '9') goto yy534;
-		goto yy527;
+		if (yych <= '/') goto yy545;
+		if (yych <= '9') goto yy552;
+		goto yy545;
 	} else {
-		if (yych <= 'F') goto yy534;
-		if (yych <= '`') goto yy527;
-		if (yych <= 'f') goto yy534;
-		goto yy527;
+		if (yych <= 'F') goto yy552;
+		if (yych <= '`') goto yy545;
+		if (yych <= 'f') goto yy552;
+		goto yy545;
 	}
-yy531:
+yy549:
 	++cur;
-#line 806 "../src/parse/lexer.re"
+#line 811 "../src/parse/lexer.re"
 	{ c = unesc_oct(tok, cur); return Ret::OK; }
-#line 4595 "src/parse/lexer.cc"
-yy532:
+#line 4603 "src/parse/lexer.cc"
+yy550:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy527;
-		if (yych <= '9') goto yy535;
-		goto yy527;
+		if (yych <= '/') goto yy545;
+		if (yych <= '9') goto yy553;
+		goto yy545;
 	} else {
-		if (yych <= 'F') goto yy535;
-		if (yych <= '`') goto yy527;
-		if (yych <= 'f') goto yy535;
-		goto yy527;
+		if (yych <= 'F') goto yy553;
+		if (yych <= '`') goto yy545;
+		if (yych <= 'f') goto yy553;
+		goto yy545;
 	}
-yy533:
+yy551:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy527;
-		if (yych <= '9') goto yy530;
-		goto yy527;
+		if (yych <= '/') goto yy545;
+		if (yych <= '9') goto yy548;
+		goto yy545;
 	} else {
-		if (yych <= 'F') goto yy530;
-		if (yych <= '`') goto yy527;
-		if (yych <= 'f') goto yy530;
-		goto yy527;
+		if (yych <= 'F') goto yy548;
+		if (yych <= '`') goto yy545;
+		if (yych <= 'f') goto yy548;
+		goto yy545;
 	}
-yy534:
+yy552:
 	++cur;
-#line 805 "../src/parse/lexer.re"
+#line 810 "../src/parse/lexer.re"
 	{ c = unesc_hex(tok, cur); return Ret::OK; }
-#line 4624 "src/parse/lexer.cc"
-yy535:
+#line 4632 "src/parse/lexer.cc"
+yy553:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy527;
-		if (yych >= ':') goto yy527;
+		if (yych <= '/') goto yy545;
+		if (yych >= ':') goto yy545;
 	} else {
-		if (yych <= 'F') goto yy536;
-		if (yych <= '`') goto yy527;
-		if (yych >= 'g') goto yy527;
+		if (yych <= 'F') goto yy554;
+		if (yych <= '`') goto yy545;
+		if (yych >= 'g') goto yy545;
 	}
-yy536:
+yy554:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy527;
-		if (yych <= '9') goto yy529;
-		goto yy527;
+		if (yych <= '/') goto yy545;
+		if (yych <= '9') goto yy547;
+		goto yy545;
 	} else {
-		if (yych <= 'F') goto yy529;
-		if (yych <= '`') goto yy527;
-		if (yych <= 'f') goto yy529;
-		goto yy527;
+		if (yych <= 'F') goto yy547;
+		if (yych <= '`') goto yy545;
+		if (yych <= 'f') goto yy547;
+		goto yy545;
 	}
 }
-#line 824 "../src/parse/lexer.re"
+#line 829 "../src/parse/lexer.re"
 
     } else {
         
-#line 4652 "src/parse/lexer.cc"
+#line 4660 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	unsigned int yyaccept = 0;
@@ -4656,79 +4664,79 @@ yy536:
 	yych = *cur;
 	if (yych <= 0x7F) {
 		if (yych <= '\f') {
-			if (yych == '\n') goto yy540;
+			if (yych == '\n') goto yy558;
 		} else {
-			if (yych <= '\r') goto yy541;
-			if (yych == '\\') goto yy542;
+			if (yych <= '\r') goto yy559;
+			if (yych == '\\') goto yy560;
 		}
 	} else {
 		if (yych <= 0xEF) {
-			if (yych <= 0xC1) goto yy544;
-			if (yych <= 0xDF) goto yy546;
-			if (yych <= 0xE0) goto yy547;
-			goto yy548;
+			if (yych <= 0xC1) goto yy562;
+			if (yych <= 0xDF) goto yy564;
+			if (yych <= 0xE0) goto yy565;
+			goto yy566;
 		} else {
-			if (yych <= 0xF0) goto yy549;
-			if (yych <= 0xF3) goto yy550;
-			if (yych <= 0xF4) goto yy551;
-			goto yy544;
+			if (yych <= 0xF0) goto yy567;
+			if (yych <= 0xF3) goto yy568;
+			if (yych <= 0xF4) goto yy569;
+			goto yy562;
 		}
 	}
-yy538:
+yy556:
 	++cur;
-yy539:
-#line 804 "../src/parse/lexer.re"
+yy557:
+#line 809 "../src/parse/lexer.re"
 	{ c = decode(tok); return Ret::OK; }
-#line 4683 "src/parse/lexer.cc"
-yy540:
+#line 4691 "src/parse/lexer.cc"
+yy558:
 	++cur;
-#line 798 "../src/parse/lexer.re"
+#line 803 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(loc, "newline in character class")); }
-#line 4688 "src/parse/lexer.cc"
-yy541:
+#line 4696 "src/parse/lexer.cc"
+yy559:
 	yych = *++cur;
-	if (yych == '\n') goto yy540;
-	goto yy539;
-yy542:
+	if (yych == '\n') goto yy558;
+	goto yy557;
+yy560:
 	yyaccept = 0;
 	yych = *(mar = ++cur);
 	if (yych <= 'b') {
 		if (yych <= '7') {
 			if (yych <= '\r') {
 				if (yych <= '\t') {
-					if (yych >= 0x01) goto yy552;
+					if (yych >= 0x01) goto yy570;
 				} else {
-					if (yych <= '\n') goto yy540;
-					if (yych <= '\f') goto yy552;
-					goto yy554;
+					if (yych <= '\n') goto yy558;
+					if (yych <= '\f') goto yy570;
+					goto yy572;
 				}
 			} else {
 				if (yych <= '-') {
-					if (yych <= ',') goto yy552;
-					goto yy555;
+					if (yych <= ',') goto yy570;
+					goto yy573;
 				} else {
-					if (yych <= '/') goto yy552;
-					if (yych <= '3') goto yy556;
-					goto yy558;
+					if (yych <= '/') goto yy570;
+					if (yych <= '3') goto yy574;
+					goto yy576;
 				}
 			}
 		} else {
 			if (yych <= '[') {
 				if (yych <= 'U') {
-					if (yych <= 'T') goto yy552;
-					goto yy559;
+					if (yych <= 'T') goto yy570;
+					goto yy577;
 				} else {
-					if (yych == 'X') goto yy561;
-					goto yy552;
+					if (yych == 'X') goto yy579;
+					goto yy570;
 				}
 			} else {
 				if (yych <= ']') {
-					if (yych <= '\\') goto yy562;
-					goto yy563;
+					if (yych <= '\\') goto yy580;
+					goto yy581;
 				} else {
-					if (yych <= '`') goto yy552;
-					if (yych <= 'a') goto yy564;
-					goto yy565;
+					if (yych <= '`') goto yy570;
+					if (yych <= 'a') goto yy582;
+					goto yy583;
 				}
 			}
 		}
@@ -4736,358 +4744,352 @@ yy542:
 		if (yych <= 'v') {
 			if (yych <= 'q') {
 				if (yych <= 'f') {
-					if (yych <= 'e') goto yy552;
-					goto yy566;
+					if (yych <= 'e') goto yy570;
+					goto yy584;
 				} else {
-					if (yych == 'n') goto yy567;
-					goto yy552;
+					if (yych == 'n') goto yy585;
+					goto yy570;
 				}
 			} else {
 				if (yych <= 's') {
-					if (yych <= 'r') goto yy568;
-					goto yy552;
-				} else {
-					if (yych <= 't') goto yy569;
-					if (yych <= 'u') goto yy561;
+					if (yych <= 'r') goto yy586;
 					goto yy570;
+				} else {
+					if (yych <= 't') goto yy587;
+					if (yych <= 'u') goto yy579;
+					goto yy588;
 				}
 			}
 		} else {
 			if (yych <= 0xDF) {
 				if (yych <= 'x') {
-					if (yych <= 'w') goto yy552;
-					goto yy571;
+					if (yych <= 'w') goto yy570;
+					goto yy589;
 				} else {
-					if (yych <= 0x7F) goto yy552;
-					if (yych >= 0xC2) goto yy572;
+					if (yych <= 0x7F) goto yy570;
+					if (yych >= 0xC2) goto yy590;
 				}
 			} else {
 				if (yych <= 0xF0) {
-					if (yych <= 0xE0) goto yy574;
-					if (yych <= 0xEF) goto yy575;
-					goto yy576;
+					if (yych <= 0xE0) goto yy592;
+					if (yych <= 0xEF) goto yy593;
+					goto yy594;
 				} else {
-					if (yych <= 0xF3) goto yy577;
-					if (yych <= 0xF4) goto yy578;
+					if (yych <= 0xF3) goto yy595;
+					if (yych <= 0xF4) goto yy596;
 				}
 			}
 		}
 	}
-yy543:
-#line 801 "../src/parse/lexer.re"
+yy561:
+#line 806 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(loc, "syntax error in escape sequence")); }
-#line 4780 "src/parse/lexer.cc"
-yy544:
+#line 4788 "src/parse/lexer.cc"
+yy562:
 	++cur;
-yy545:
-#line 802 "../src/parse/lexer.re"
+yy563:
+#line 807 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(loc, "syntax error")); }
-#line 4786 "src/parse/lexer.cc"
-yy546:
+#line 4794 "src/parse/lexer.cc"
+yy564:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy545;
-	if (yych <= 0xBF) goto yy538;
-	goto yy545;
-yy547:
+	if (yych <= 0x7F) goto yy563;
+	if (yych <= 0xBF) goto yy556;
+	goto yy563;
+yy565:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych <= 0x9F) goto yy545;
-	if (yych <= 0xBF) goto yy579;
-	goto yy545;
-yy548:
+	if (yych <= 0x9F) goto yy563;
+	if (yych <= 0xBF) goto yy597;
+	goto yy563;
+yy566:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych <= 0x7F) goto yy545;
-	if (yych <= 0xBF) goto yy579;
-	goto yy545;
-yy549:
+	if (yych <= 0x7F) goto yy563;
+	if (yych <= 0xBF) goto yy597;
+	goto yy563;
+yy567:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych <= 0x8F) goto yy545;
-	if (yych <= 0xBF) goto yy580;
-	goto yy545;
-yy550:
+	if (yych <= 0x8F) goto yy563;
+	if (yych <= 0xBF) goto yy598;
+	goto yy563;
+yy568:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych <= 0x7F) goto yy545;
-	if (yych <= 0xBF) goto yy580;
-	goto yy545;
-yy551:
+	if (yych <= 0x7F) goto yy563;
+	if (yych <= 0xBF) goto yy598;
+	goto yy563;
+yy569:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych <= 0x7F) goto yy545;
-	if (yych <= 0x8F) goto yy580;
-	goto yy545;
-yy552:
+	if (yych <= 0x7F) goto yy563;
+	if (yych <= 0x8F) goto yy598;
+	goto yy563;
+yy570:
 	++cur;
-yy553:
-#line 817 "../src/parse/lexer.re"
+yy571:
+#line 822 "../src/parse/lexer.re"
 	{
         msg.warn.useless_escape(loc, tok, cur);
         c = decode(tok + 1);
         return Ret::OK;
     }
-#line 4831 "src/parse/lexer.cc"
-yy554:
+#line 4839 "src/parse/lexer.cc"
+yy572:
 	yych = *++cur;
-	if (yych == '\n') goto yy540;
-	goto yy553;
-yy555:
+	if (yych == '\n') goto yy558;
+	goto yy571;
+yy573:
 	++cur;
-#line 815 "../src/parse/lexer.re"
+#line 820 "../src/parse/lexer.re"
 	{ c = '-'_u8; return Ret::OK; }
-#line 4840 "src/parse/lexer.cc"
-yy556:
+#line 4848 "src/parse/lexer.cc"
+yy574:
 	yyaccept = 2;
 	yych = *(mar = ++cur);
-	if (yych <= '/') goto yy557;
-	if (yych <= '7') goto yy581;
-yy557:
-#line 800 "../src/parse/lexer.re"
+	if (yych <= '/') goto yy575;
+	if (yych <= '7') goto yy599;
+yy575:
+#line 805 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(loc, "syntax error in octal escape sequence")); }
-#line 4849 "src/parse/lexer.cc"
-yy558:
+#line 4857 "src/parse/lexer.cc"
+yy576:
 	++cur;
-	goto yy557;
-yy559:
+	goto yy575;
+yy577:
 	yyaccept = 3;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy560;
-		if (yych <= '9') goto yy582;
+		if (yych <= '/') goto yy578;
+		if (yych <= '9') goto yy600;
 	} else {
-		if (yych <= 'F') goto yy582;
-		if (yych <= '`') goto yy560;
-		if (yych <= 'f') goto yy582;
+		if (yych <= 'F') goto yy600;
+		if (yych <= '`') goto yy578;
+		if (yych <= 'f') goto yy600;
 	}
-yy560:
-#line 799 "../src/parse/lexer.re"
+yy578:
+#line 804 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(loc, "syntax error in hexadecimal escape sequence")); }
-#line 4867 "src/parse/lexer.cc"
-yy561:
+#line 4875 "src/parse/lexer.cc"
+yy579:
 	yyaccept = 3;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy560;
-		if (yych <= '9') goto yy583;
-		goto yy560;
+		if (yych <= '/') goto yy578;
+		if (yych <= '9') goto yy601;
+		goto yy578;
 	} else {
-		if (yych <= 'F') goto yy583;
-		if (yych <= '`') goto yy560;
-		if (yych <= 'f') goto yy583;
-		goto yy560;
+		if (yych <= 'F') goto yy601;
+		if (yych <= '`') goto yy578;
+		if (yych <= 'f') goto yy601;
+		goto yy578;
 	}
-yy562:
+yy580:
 	++cur;
-#line 814 "../src/parse/lexer.re"
+#line 819 "../src/parse/lexer.re"
 	{ c = '\\'_u8; return Ret::OK; }
-#line 4885 "src/parse/lexer.cc"
-yy563:
+#line 4893 "src/parse/lexer.cc"
+yy581:
 	++cur;
-#line 816 "../src/parse/lexer.re"
+#line 821 "../src/parse/lexer.re"
 	{ c = ']'_u8; return Ret::OK; }
-#line 4890 "src/parse/lexer.cc"
-yy564:
+#line 4898 "src/parse/lexer.cc"
+yy582:
 	++cur;
-#line 807 "../src/parse/lexer.re"
+#line 812 "../src/parse/lexer.re"
 	{ c = '\a'_u8; return Ret::OK; }
-#line 4895 "src/parse/lexer.cc"
-yy565:
+#line 4903 "src/parse/lexer.cc"
+yy583:
 	++cur;
-#line 808 "../src/parse/lexer.re"
+#line 813 "../src/parse/lexer.re"
 	{ c = '\b'_u8; return Ret::OK; }
-#line 4900 "src/parse/lexer.cc"
-yy566:
+#line 4908 "src/parse/lexer.cc"
+yy584:
 	++cur;
-#line 809 "../src/parse/lexer.re"
+#line 814 "../src/parse/lexer.re"
 	{ c = '\f'_u8; return Ret::OK; }
-#line 4905 "src/parse/lexer.cc"
-yy567:
+#line 4913 "src/parse/lexer.cc"
+yy585:
 	++cur;
-#line 810 "../src/parse/lexer.re"
+#line 815 "../src/parse/lexer.re"
 	{ c = '\n'_u8; return Ret::OK; }
-#line 4910 "src/parse/lexer.cc"
-yy568:
+#line 4918 "src/parse/lexer.cc"
+yy586:
 	++cur;
-#line 811 "../src/parse/lexer.re"
+#line 816 "../src/parse/lexer.re"
 	{ c = '\r'_u8; return Ret::OK; }
-#line 4915 "src/parse/lexer.cc"
-yy569:
+#line 4923 "src/parse/lexer.cc"
+yy587:
 	++cur;
-#line 812 "../src/parse/lexer.re"
+#line 817 "../src/parse/lexer.re"
 	{ c = '\t'_u8; return Ret::OK; }
-#line 4920 "src/parse/lexer.cc"
-yy570:
+#line 4928 "src/parse/lexer.cc"
+yy588:
 	++cur;
-#line 813 "../src/parse/lexer.re"
+#line 818 "../src/parse/lexer.re"
 	{ c = '\v'_u8; return Ret::OK; }
-#line 4925 "src/parse/lexer.cc"
-yy571:
+#line 4933 "src/parse/lexer.cc"
+yy589:
 	yyaccept = 3;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy560;
-		if (yych <= '9') goto yy584;
-		goto yy560;
+		if (yych <= '/') goto yy578;
+		if (yych <= '9') goto yy602;
+		goto yy578;
 	} else {
-		if (yych <= 'F') goto yy584;
-		if (yych <= '`') goto yy560;
-		if (yych <= 'f') goto yy584;
-		goto yy560;
+		if (yych <= 'F') goto yy602;
+		if (yych <= '`') goto yy578;
+		if (yych <= 'f') goto yy602;
+		goto yy578;
 	}
-yy572:
+yy590:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy573;
-	if (yych <= 0xBF) goto yy552;
-yy573:
+	if (yych <= 0x7F) goto yy591;
+	if (yych <= 0xBF) goto yy570;
+yy591:
 	cur = mar;
 	if (yyaccept <= 1) {
-		if (yyaccept == 0) {
-			goto yy543;
-		} else {
-			goto yy545;
-		}
+		if (yyaccept == 0) goto yy561;
+		else goto yy563;
 	} else {
-		if (yyaccept == 2) {
-			goto yy557;
-		} else {
-			goto yy560;
-		}
+		if (yyaccept == 2) goto yy575;
+		else goto yy578;
 	}
-yy574:
+yy592:
 	yych = *++cur;
-	if (yych <= 0x9F) goto yy573;
-	if (yych <= 0xBF) goto yy572;
-	goto yy573;
-yy575:
+	if (yych <= 0x9F) goto yy591;
+	if (yych <= 0xBF) goto yy590;
+	goto yy591;
+yy593:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy573;
-	if (yych <= 0xBF) goto yy572;
-	goto yy573;
-yy576:
+	if (yych <= 0x7F) goto yy591;
+	if (yych <= 0xBF) goto yy590;
+	goto yy591;
+yy594:
 	yych = *++cur;
-	if (yych <= 0x8F) goto yy573;
-	if (yych <= 0xBF) goto yy575;
-	goto yy573;
-yy577:
+	if (yych <= 0x8F) goto yy591;
+	if (yych <= 0xBF) goto yy593;
+	goto yy591;
+yy595:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy573;
-	if (yych <= 0xBF) goto yy575;
-	goto yy573;
-yy578:
+	if (yych <= 0x7F) goto yy591;
+	if (yych <= 0xBF) goto yy593;
+	goto yy591;
+yy596:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy573;
-	if (yych <= 0x8F) goto yy575;
-	goto yy573;
-yy579:
+	if (yych <= 0x7F) goto yy591;
+	if (yych <= 0x8F) goto yy593;
+	goto yy591;
+yy597:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy573;
-	if (yych <= 0xBF) goto yy538;
-	goto yy573;
-yy580:
+	if (yych <= 0x7F) goto yy591;
+	if (yych <= 0xBF) goto yy556;
+	goto yy591;
+yy598:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy573;
-	if (yych <= 0xBF) goto yy579;
-	goto yy573;
-yy581:
+	if (yych <= 0x7F) goto yy591;
+	if (yych <= 0xBF) goto yy597;
+	goto yy591;
+yy599:
 	yych = *++cur;
-	if (yych <= '/') goto yy573;
-	if (yych <= '7') goto yy585;
-	goto yy573;
-yy582:
+	if (yych <= '/') goto yy591;
+	if (yych <= '7') goto yy603;
+	goto yy591;
+yy600:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy573;
-		if (yych <= '9') goto yy586;
-		goto yy573;
+		if (yych <= '/') goto yy591;
+		if (yych <= '9') goto yy604;
+		goto yy591;
 	} else {
-		if (yych <= 'F') goto yy586;
-		if (yych <= '`') goto yy573;
-		if (yych <= 'f') goto yy586;
-		goto yy573;
+		if (yych <= 'F') goto yy604;
+		if (yych <= '`') goto yy591;
+		if (yych <= 'f') goto yy604;
+		goto yy591;
 	}
-yy583:
+yy601:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy573;
-		if (yych <= '9') goto yy587;
-		goto yy573;
+		if (yych <= '/') goto yy591;
+		if (yych <= '9') goto yy605;
+		goto yy591;
 	} else {
-		if (yych <= 'F') goto yy587;
-		if (yych <= '`') goto yy573;
-		if (yych <= 'f') goto yy587;
-		goto yy573;
+		if (yych <= 'F') goto yy605;
+		if (yych <= '`') goto yy591;
+		if (yych <= 'f') goto yy605;
+		goto yy591;
 	}
-yy584:
+yy602:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy573;
-		if (yych <= '9') goto yy588;
-		goto yy573;
+		if (yych <= '/') goto yy591;
+		if (yych <= '9') goto yy606;
+		goto yy591;
 	} else {
-		if (yych <= 'F') goto yy588;
-		if (yych <= '`') goto yy573;
-		if (yych <= 'f') goto yy588;
-		goto yy573;
+		if (yych <= 'F') goto yy606;
+		if (yych <= '`') goto yy591;
+		if (yych <= 'f') goto yy606;
+		goto yy591;
 	}
-yy585:
+yy603:
 	++cur;
-#line 806 "../src/parse/lexer.re"
+#line 811 "../src/parse/lexer.re"
 	{ c = unesc_oct(tok, cur); return Ret::OK; }
-#line 5038 "src/parse/lexer.cc"
-yy586:
+#line 5040 "src/parse/lexer.cc"
+yy604:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy573;
-		if (yych <= '9') goto yy589;
-		goto yy573;
+		if (yych <= '/') goto yy591;
+		if (yych <= '9') goto yy607;
+		goto yy591;
 	} else {
-		if (yych <= 'F') goto yy589;
-		if (yych <= '`') goto yy573;
-		if (yych <= 'f') goto yy589;
-		goto yy573;
+		if (yych <= 'F') goto yy607;
+		if (yych <= '`') goto yy591;
+		if (yych <= 'f') goto yy607;
+		goto yy591;
 	}
-yy587:
+yy605:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy573;
-		if (yych <= '9') goto yy584;
-		goto yy573;
+		if (yych <= '/') goto yy591;
+		if (yych <= '9') goto yy602;
+		goto yy591;
 	} else {
-		if (yych <= 'F') goto yy584;
-		if (yych <= '`') goto yy573;
-		if (yych <= 'f') goto yy584;
-		goto yy573;
+		if (yych <= 'F') goto yy602;
+		if (yych <= '`') goto yy591;
+		if (yych <= 'f') goto yy602;
+		goto yy591;
 	}
-yy588:
+yy606:
 	++cur;
-#line 805 "../src/parse/lexer.re"
+#line 810 "../src/parse/lexer.re"
 	{ c = unesc_hex(tok, cur); return Ret::OK; }
-#line 5067 "src/parse/lexer.cc"
-yy589:
+#line 5069 "src/parse/lexer.cc"
+yy607:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy573;
-		if (yych >= ':') goto yy573;
+		if (yych <= '/') goto yy591;
+		if (yych >= ':') goto yy591;
 	} else {
-		if (yych <= 'F') goto yy590;
-		if (yych <= '`') goto yy573;
-		if (yych >= 'g') goto yy573;
+		if (yych <= 'F') goto yy608;
+		if (yych <= '`') goto yy591;
+		if (yych >= 'g') goto yy591;
 	}
-yy590:
+yy608:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy573;
-		if (yych <= '9') goto yy583;
-		goto yy573;
+		if (yych <= '/') goto yy591;
+		if (yych <= '9') goto yy601;
+		goto yy591;
 	} else {
-		if (yych <= 'F') goto yy583;
-		if (yych <= '`') goto yy573;
-		if (yych <= 'f') goto yy583;
-		goto yy573;
+		if (yych <= 'F') goto yy601;
+		if (yych <= '`') goto yy591;
+		if (yych <= 'f') goto yy601;
+		goto yy591;
 	}
 }
-#line 826 "../src/parse/lexer.re"
+#line 831 "../src/parse/lexer.re"
 
     }
 }
@@ -5096,304 +5098,301 @@ Ret Input::lex_str_chr(uint8_t quote, AstChar& ast, bool& stop) {
     tok = cur;
     stop = false;
     ast.loc = cur_loc();
-#line 857 "../src/parse/lexer.re"
+#line 862 "../src/parse/lexer.re"
 
     if (globopts->input_encoding == Enc::Type::ASCII) {
         
-#line 5104 "src/parse/lexer.cc"
+#line 5106 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	unsigned int yyaccept = 0;
 	if ((lim - cur) < 10) if (!fill(10)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '\f') {
-		if (yych == '\n') goto yy593;
+		if (yych == '\n') goto yy611;
 	} else {
-		if (yych <= '\r') goto yy594;
-		if (yych == '\\') goto yy595;
+		if (yych <= '\r') goto yy612;
+		if (yych == '\\') goto yy613;
 	}
 	++cur;
-yy592:
-#line 841 "../src/parse/lexer.re"
+yy610:
+#line 846 "../src/parse/lexer.re"
 	{ ast.chr = decode(tok); stop = (tok[0] == quote); return Ret::OK; }
-#line 5120 "src/parse/lexer.cc"
-yy593:
+#line 5122 "src/parse/lexer.cc"
+yy611:
 	++cur;
-#line 835 "../src/parse/lexer.re"
+#line 840 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(ast.loc, "newline in character string")); }
-#line 5125 "src/parse/lexer.cc"
-yy594:
+#line 5127 "src/parse/lexer.cc"
+yy612:
 	yych = *++cur;
-	if (yych == '\n') goto yy593;
-	goto yy592;
-yy595:
+	if (yych == '\n') goto yy611;
+	goto yy610;
+yy613:
 	yych = *++cur;
 	if (yych <= '`') {
 		if (yych <= '3') {
 			if (yych <= '\n') {
-				if (yych <= 0x00) goto yy596;
-				if (yych <= '\t') goto yy597;
-				goto yy593;
+				if (yych <= 0x00) goto yy614;
+				if (yych <= '\t') goto yy615;
+				goto yy611;
 			} else {
-				if (yych == '\r') goto yy599;
-				if (yych <= '/') goto yy597;
-				goto yy600;
+				if (yych == '\r') goto yy617;
+				if (yych <= '/') goto yy615;
+				goto yy618;
 			}
 		} else {
 			if (yych <= 'W') {
-				if (yych <= '7') goto yy602;
-				if (yych == 'U') goto yy603;
-				goto yy597;
+				if (yych <= '7') goto yy620;
+				if (yych == 'U') goto yy621;
+				goto yy615;
 			} else {
-				if (yych <= 'X') goto yy605;
-				if (yych == '\\') goto yy606;
-				goto yy597;
+				if (yych <= 'X') goto yy623;
+				if (yych == '\\') goto yy624;
+				goto yy615;
 			}
 		}
 	} else {
 		if (yych <= 'q') {
 			if (yych <= 'e') {
-				if (yych <= 'a') goto yy607;
-				if (yych <= 'b') goto yy608;
-				goto yy597;
+				if (yych <= 'a') goto yy625;
+				if (yych <= 'b') goto yy626;
+				goto yy615;
 			} else {
-				if (yych <= 'f') goto yy609;
-				if (yych == 'n') goto yy610;
-				goto yy597;
+				if (yych <= 'f') goto yy627;
+				if (yych == 'n') goto yy628;
+				goto yy615;
 			}
 		} else {
 			if (yych <= 'u') {
-				if (yych <= 'r') goto yy611;
-				if (yych <= 's') goto yy597;
-				if (yych <= 't') goto yy612;
-				goto yy605;
+				if (yych <= 'r') goto yy629;
+				if (yych <= 's') goto yy615;
+				if (yych <= 't') goto yy630;
+				goto yy623;
 			} else {
-				if (yych <= 'v') goto yy613;
-				if (yych == 'x') goto yy614;
-				goto yy597;
+				if (yych <= 'v') goto yy631;
+				if (yych == 'x') goto yy632;
+				goto yy615;
 			}
 		}
 	}
-yy596:
-#line 838 "../src/parse/lexer.re"
+yy614:
+#line 843 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(ast.loc, "syntax error in escape sequence")); }
-#line 5181 "src/parse/lexer.cc"
-yy597:
+#line 5183 "src/parse/lexer.cc"
+yy615:
 	++cur;
-yy598:
-#line 852 "../src/parse/lexer.re"
+yy616:
+#line 857 "../src/parse/lexer.re"
 	{
         ast.chr = decode(tok + 1);
         if (tok[1] != quote) msg.warn.useless_escape(ast.loc, tok, cur);
         return Ret::OK;
     }
-#line 5191 "src/parse/lexer.cc"
-yy599:
+#line 5193 "src/parse/lexer.cc"
+yy617:
 	yych = *++cur;
-	if (yych == '\n') goto yy593;
-	goto yy598;
-yy600:
+	if (yych == '\n') goto yy611;
+	goto yy616;
+yy618:
 	yyaccept = 0;
 	yych = *(mar = ++cur);
-	if (yych <= '/') goto yy601;
-	if (yych <= '7') goto yy615;
-yy601:
-#line 837 "../src/parse/lexer.re"
+	if (yych <= '/') goto yy619;
+	if (yych <= '7') goto yy633;
+yy619:
+#line 842 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(ast.loc, "syntax error in octal escape sequence")); }
-#line 5204 "src/parse/lexer.cc"
-yy602:
+#line 5206 "src/parse/lexer.cc"
+yy620:
 	++cur;
-	goto yy601;
-yy603:
+	goto yy619;
+yy621:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy604;
-		if (yych <= '9') goto yy617;
+		if (yych <= '/') goto yy622;
+		if (yych <= '9') goto yy635;
 	} else {
-		if (yych <= 'F') goto yy617;
-		if (yych <= '`') goto yy604;
-		if (yych <= 'f') goto yy617;
+		if (yych <= 'F') goto yy635;
+		if (yych <= '`') goto yy622;
+		if (yych <= 'f') goto yy635;
 	}
-yy604:
-#line 836 "../src/parse/lexer.re"
+yy622:
+#line 841 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(ast.loc, "syntax error in hexadecimal escape sequence")); }
-#line 5222 "src/parse/lexer.cc"
-yy605:
+#line 5224 "src/parse/lexer.cc"
+yy623:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy604;
-		if (yych <= '9') goto yy618;
-		goto yy604;
+		if (yych <= '/') goto yy622;
+		if (yych <= '9') goto yy636;
+		goto yy622;
 	} else {
-		if (yych <= 'F') goto yy618;
-		if (yych <= '`') goto yy604;
-		if (yych <= 'f') goto yy618;
-		goto yy604;
+		if (yych <= 'F') goto yy636;
+		if (yych <= '`') goto yy622;
+		if (yych <= 'f') goto yy636;
+		goto yy622;
 	}
-yy606:
+yy624:
 	++cur;
-#line 851 "../src/parse/lexer.re"
+#line 856 "../src/parse/lexer.re"
 	{ ast.chr = '\\'_u8; return Ret::OK; }
-#line 5240 "src/parse/lexer.cc"
-yy607:
+#line 5242 "src/parse/lexer.cc"
+yy625:
 	++cur;
-#line 844 "../src/parse/lexer.re"
+#line 849 "../src/parse/lexer.re"
 	{ ast.chr = '\a'_u8; return Ret::OK; }
-#line 5245 "src/parse/lexer.cc"
-yy608:
+#line 5247 "src/parse/lexer.cc"
+yy626:
 	++cur;
-#line 845 "../src/parse/lexer.re"
+#line 850 "../src/parse/lexer.re"
 	{ ast.chr = '\b'_u8; return Ret::OK; }
-#line 5250 "src/parse/lexer.cc"
-yy609:
+#line 5252 "src/parse/lexer.cc"
+yy627:
 	++cur;
-#line 846 "../src/parse/lexer.re"
+#line 851 "../src/parse/lexer.re"
 	{ ast.chr = '\f'_u8; return Ret::OK; }
-#line 5255 "src/parse/lexer.cc"
-yy610:
+#line 5257 "src/parse/lexer.cc"
+yy628:
 	++cur;
-#line 847 "../src/parse/lexer.re"
+#line 852 "../src/parse/lexer.re"
 	{ ast.chr = '\n'_u8; return Ret::OK; }
-#line 5260 "src/parse/lexer.cc"
-yy611:
+#line 5262 "src/parse/lexer.cc"
+yy629:
 	++cur;
-#line 848 "../src/parse/lexer.re"
+#line 853 "../src/parse/lexer.re"
 	{ ast.chr = '\r'_u8; return Ret::OK; }
-#line 5265 "src/parse/lexer.cc"
-yy612:
+#line 5267 "src/parse/lexer.cc"
+yy630:
 	++cur;
-#line 849 "../src/parse/lexer.re"
+#line 854 "../src/parse/lexer.re"
 	{ ast.chr = '\t'_u8; return Ret::OK; }
-#line 5270 "src/parse/lexer.cc"
-yy613:
+#line 5272 "src/parse/lexer.cc"
+yy631:
 	++cur;
-#line 850 "../src/parse/lexer.re"
+#line 855 "../src/parse/lexer.re"
 	{ ast.chr = '\v'_u8; return Ret::OK; }
-#line 5275 "src/parse/lexer.cc"
-yy614:
+#line 5277 "src/parse/lexer.cc"
+yy632:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy604;
-		if (yych <= '9') goto yy619;
-		goto yy604;
+		if (yych <= '/') goto yy622;
+		if (yych <= '9') goto yy637;
+		goto yy622;
 	} else {
-		if (yych <= 'F') goto yy619;
-		if (yych <= '`') goto yy604;
-		if (yych <= 'f') goto yy619;
-		goto yy604;
+		if (yych <= 'F') goto yy637;
+		if (yych <= '`') goto yy622;
+		if (yych <= 'f') goto yy637;
+		goto yy622;
 	}
-yy615:
+yy633:
 	yych = *++cur;
-	if (yych <= '/') goto yy616;
-	if (yych <= '7') goto yy620;
-yy616:
+	if (yych <= '/') goto yy634;
+	if (yych <= '7') goto yy638;
+yy634:
 	cur = mar;
-	if (yyaccept == 0) {
-		goto yy601;
-	} else {
-		goto yy604;
-	}
-yy617:
+	if (yyaccept == 0) goto yy619;
+	else goto yy622;
+yy635:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy616;
-		if (yych <= '9') goto yy621;
-		goto yy616;
+		if (yych <= '/') goto yy634;
+		if (yych <= '9') goto yy639;
+		goto yy634;
 	} else {
-		if (yych <= 'F') goto yy621;
-		if (yych <= '`') goto yy616;
-		if (yych <= 'f') goto yy621;
-		goto yy616;
+		if (yych <= 'F') goto yy639;
+		if (yych <= '`') goto yy634;
+		if (yych <= 'f') goto yy639;
+		goto yy634;
 	}
-yy618:
+yy636:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy616;
-		if (yych <= '9') goto yy622;
-		goto yy616;
+		if (yych <= '/') goto yy634;
+		if (yych <= '9') goto yy640;
+		goto yy634;
 	} else {
-		if (yych <= 'F') goto yy622;
-		if (yych <= '`') goto yy616;
-		if (yych <= 'f') goto yy622;
-		goto yy616;
+		if (yych <= 'F') goto yy640;
+		if (yych <= '`') goto yy634;
+		if (yych <= 'f') goto yy640;
+		goto yy634;
 	}
-yy619:
+yy637:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy616;
-		if (yych <= '9') goto yy623;
-		goto yy616;
+		if (yych <= '/') goto yy634;
+		if (yych <= '9') goto yy641;
+		goto yy634;
 	} else {
-		if (yych <= 'F') goto yy623;
-		if (yych <= '`') goto yy616;
-		if (yych <= 'f') goto yy623;
-		goto yy616;
+		if (yych <= 'F') goto yy641;
+		if (yych <= '`') goto yy634;
+		if (yych <= 'f') goto yy641;
+		goto yy634;
 	}
-yy620:
+yy638:
 	++cur;
-#line 843 "../src/parse/lexer.re"
+#line 848 "../src/parse/lexer.re"
 	{ ast.chr = unesc_oct(tok, cur); return Ret::OK; }
-#line 5340 "src/parse/lexer.cc"
-yy621:
+#line 5339 "src/parse/lexer.cc"
+yy639:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy616;
-		if (yych <= '9') goto yy624;
-		goto yy616;
+		if (yych <= '/') goto yy634;
+		if (yych <= '9') goto yy642;
+		goto yy634;
 	} else {
-		if (yych <= 'F') goto yy624;
-		if (yych <= '`') goto yy616;
-		if (yych <= 'f') goto yy624;
-		goto yy616;
+		if (yych <= 'F') goto yy642;
+		if (yych <= '`') goto yy634;
+		if (yych <= 'f') goto yy642;
+		goto yy634;
 	}
-yy622:
+yy640:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy616;
-		if (yych <= '9') goto yy619;
-		goto yy616;
+		if (yych <= '/') goto yy634;
+		if (yych <= '9') goto yy637;
+		goto yy634;
 	} else {
-		if (yych <= 'F') goto yy619;
-		if (yych <= '`') goto yy616;
-		if (yych <= 'f') goto yy619;
-		goto yy616;
+		if (yych <= 'F') goto yy637;
+		if (yych <= '`') goto yy634;
+		if (yych <= 'f') goto yy637;
+		goto yy634;
 	}
-yy623:
+yy641:
 	++cur;
-#line 842 "../src/parse/lexer.re"
+#line 847 "../src/parse/lexer.re"
 	{ ast.chr = unesc_hex(tok, cur); return Ret::OK; }
-#line 5369 "src/parse/lexer.cc"
-yy624:
+#line 5368 "src/parse/lexer.cc"
+yy642:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy616;
-		if (yych >= ':') goto yy616;
+		if (yych <= '/') goto yy634;
+		if (yych >= ':') goto yy634;
 	} else {
-		if (yych <= 'F') goto yy625;
-		if (yych <= '`') goto yy616;
-		if (yych >= 'g') goto yy616;
+		if (yych <= 'F') goto yy643;
+		if (yych <= '`') goto yy634;
+		if (yych >= 'g') goto yy634;
 	}
-yy625:
+yy643:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy616;
-		if (yych <= '9') goto yy618;
-		goto yy616;
+		if (yych <= '/') goto yy634;
+		if (yych <= '9') goto yy636;
+		goto yy634;
 	} else {
-		if (yych <= 'F') goto yy618;
-		if (yych <= '`') goto yy616;
-		if (yych <= 'f') goto yy618;
-		goto yy616;
+		if (yych <= 'F') goto yy636;
+		if (yych <= '`') goto yy634;
+		if (yych <= 'f') goto yy636;
+		goto yy634;
 	}
 }
-#line 859 "../src/parse/lexer.re"
+#line 864 "../src/parse/lexer.re"
 
     } else {
         
-#line 5397 "src/parse/lexer.cc"
+#line 5396 "src/parse/lexer.cc"
 {
 	uint8_t yych;
 	unsigned int yyaccept = 0;
@@ -5401,421 +5400,415 @@ yy625:
 	yych = *cur;
 	if (yych <= 0x7F) {
 		if (yych <= '\f') {
-			if (yych == '\n') goto yy629;
+			if (yych == '\n') goto yy647;
 		} else {
-			if (yych <= '\r') goto yy630;
-			if (yych == '\\') goto yy631;
+			if (yych <= '\r') goto yy648;
+			if (yych == '\\') goto yy649;
 		}
 	} else {
 		if (yych <= 0xEF) {
-			if (yych <= 0xC1) goto yy633;
-			if (yych <= 0xDF) goto yy635;
-			if (yych <= 0xE0) goto yy636;
-			goto yy637;
+			if (yych <= 0xC1) goto yy651;
+			if (yych <= 0xDF) goto yy653;
+			if (yych <= 0xE0) goto yy654;
+			goto yy655;
 		} else {
-			if (yych <= 0xF0) goto yy638;
-			if (yych <= 0xF3) goto yy639;
-			if (yych <= 0xF4) goto yy640;
-			goto yy633;
+			if (yych <= 0xF0) goto yy656;
+			if (yych <= 0xF3) goto yy657;
+			if (yych <= 0xF4) goto yy658;
+			goto yy651;
 		}
 	}
-yy627:
+yy645:
 	++cur;
-yy628:
-#line 841 "../src/parse/lexer.re"
+yy646:
+#line 846 "../src/parse/lexer.re"
 	{ ast.chr = decode(tok); stop = (tok[0] == quote); return Ret::OK; }
-#line 5428 "src/parse/lexer.cc"
-yy629:
+#line 5427 "src/parse/lexer.cc"
+yy647:
 	++cur;
-#line 835 "../src/parse/lexer.re"
+#line 840 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(ast.loc, "newline in character string")); }
-#line 5433 "src/parse/lexer.cc"
-yy630:
+#line 5432 "src/parse/lexer.cc"
+yy648:
 	yych = *++cur;
-	if (yych == '\n') goto yy629;
-	goto yy628;
-yy631:
+	if (yych == '\n') goto yy647;
+	goto yy646;
+yy649:
 	yyaccept = 0;
 	yych = *(mar = ++cur);
 	if (yych <= 'f') {
 		if (yych <= 'T') {
 			if (yych <= '\f') {
-				if (yych <= 0x00) goto yy632;
-				if (yych == '\n') goto yy629;
-				goto yy641;
+				if (yych <= 0x00) goto yy650;
+				if (yych == '\n') goto yy647;
+				goto yy659;
 			} else {
 				if (yych <= '/') {
-					if (yych <= '\r') goto yy643;
-					goto yy641;
+					if (yych <= '\r') goto yy661;
+					goto yy659;
 				} else {
-					if (yych <= '3') goto yy644;
-					if (yych <= '7') goto yy646;
-					goto yy641;
+					if (yych <= '3') goto yy662;
+					if (yych <= '7') goto yy664;
+					goto yy659;
 				}
 			}
 		} else {
 			if (yych <= '\\') {
 				if (yych <= 'W') {
-					if (yych <= 'U') goto yy647;
-					goto yy641;
+					if (yych <= 'U') goto yy665;
+					goto yy659;
 				} else {
-					if (yych <= 'X') goto yy649;
-					if (yych <= '[') goto yy641;
-					goto yy650;
+					if (yych <= 'X') goto yy667;
+					if (yych <= '[') goto yy659;
+					goto yy668;
 				}
 			} else {
 				if (yych <= 'a') {
-					if (yych <= '`') goto yy641;
-					goto yy651;
+					if (yych <= '`') goto yy659;
+					goto yy669;
 				} else {
-					if (yych <= 'b') goto yy652;
-					if (yych <= 'e') goto yy641;
-					goto yy653;
+					if (yych <= 'b') goto yy670;
+					if (yych <= 'e') goto yy659;
+					goto yy671;
 				}
 			}
 		}
 	} else {
 		if (yych <= 'w') {
 			if (yych <= 'r') {
-				if (yych == 'n') goto yy654;
-				if (yych <= 'q') goto yy641;
-				goto yy655;
+				if (yych == 'n') goto yy672;
+				if (yych <= 'q') goto yy659;
+				goto yy673;
 			} else {
 				if (yych <= 't') {
-					if (yych <= 's') goto yy641;
-					goto yy656;
+					if (yych <= 's') goto yy659;
+					goto yy674;
 				} else {
-					if (yych <= 'u') goto yy649;
-					if (yych <= 'v') goto yy657;
-					goto yy641;
+					if (yych <= 'u') goto yy667;
+					if (yych <= 'v') goto yy675;
+					goto yy659;
 				}
 			}
 		} else {
 			if (yych <= 0xE0) {
 				if (yych <= 0x7F) {
-					if (yych <= 'x') goto yy658;
-					goto yy641;
+					if (yych <= 'x') goto yy676;
+					goto yy659;
 				} else {
-					if (yych <= 0xC1) goto yy632;
-					if (yych <= 0xDF) goto yy659;
-					goto yy661;
+					if (yych <= 0xC1) goto yy650;
+					if (yych <= 0xDF) goto yy677;
+					goto yy679;
 				}
 			} else {
 				if (yych <= 0xF0) {
-					if (yych <= 0xEF) goto yy662;
-					goto yy663;
+					if (yych <= 0xEF) goto yy680;
+					goto yy681;
 				} else {
-					if (yych <= 0xF3) goto yy664;
-					if (yych <= 0xF4) goto yy665;
+					if (yych <= 0xF3) goto yy682;
+					if (yych <= 0xF4) goto yy683;
 				}
 			}
 		}
 	}
-yy632:
-#line 838 "../src/parse/lexer.re"
+yy650:
+#line 843 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(ast.loc, "syntax error in escape sequence")); }
-#line 5518 "src/parse/lexer.cc"
-yy633:
+#line 5517 "src/parse/lexer.cc"
+yy651:
 	++cur;
-yy634:
-#line 839 "../src/parse/lexer.re"
+yy652:
+#line 844 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(ast.loc, "syntax error")); }
-#line 5524 "src/parse/lexer.cc"
-yy635:
+#line 5523 "src/parse/lexer.cc"
+yy653:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy634;
-	if (yych <= 0xBF) goto yy627;
-	goto yy634;
-yy636:
+	if (yych <= 0x7F) goto yy652;
+	if (yych <= 0xBF) goto yy645;
+	goto yy652;
+yy654:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych <= 0x9F) goto yy634;
-	if (yych <= 0xBF) goto yy666;
-	goto yy634;
-yy637:
+	if (yych <= 0x9F) goto yy652;
+	if (yych <= 0xBF) goto yy684;
+	goto yy652;
+yy655:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych <= 0x7F) goto yy634;
-	if (yych <= 0xBF) goto yy666;
-	goto yy634;
-yy638:
+	if (yych <= 0x7F) goto yy652;
+	if (yych <= 0xBF) goto yy684;
+	goto yy652;
+yy656:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych <= 0x8F) goto yy634;
-	if (yych <= 0xBF) goto yy667;
-	goto yy634;
-yy639:
+	if (yych <= 0x8F) goto yy652;
+	if (yych <= 0xBF) goto yy685;
+	goto yy652;
+yy657:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych <= 0x7F) goto yy634;
-	if (yych <= 0xBF) goto yy667;
-	goto yy634;
-yy640:
+	if (yych <= 0x7F) goto yy652;
+	if (yych <= 0xBF) goto yy685;
+	goto yy652;
+yy658:
 	yyaccept = 1;
 	yych = *(mar = ++cur);
-	if (yych <= 0x7F) goto yy634;
-	if (yych <= 0x8F) goto yy667;
-	goto yy634;
-yy641:
+	if (yych <= 0x7F) goto yy652;
+	if (yych <= 0x8F) goto yy685;
+	goto yy652;
+yy659:
 	++cur;
-yy642:
-#line 852 "../src/parse/lexer.re"
+yy660:
+#line 857 "../src/parse/lexer.re"
 	{
         ast.chr = decode(tok + 1);
         if (tok[1] != quote) msg.warn.useless_escape(ast.loc, tok, cur);
         return Ret::OK;
     }
-#line 5569 "src/parse/lexer.cc"
-yy643:
+#line 5568 "src/parse/lexer.cc"
+yy661:
 	yych = *++cur;
-	if (yych == '\n') goto yy629;
-	goto yy642;
-yy644:
+	if (yych == '\n') goto yy647;
+	goto yy660;
+yy662:
 	yyaccept = 2;
 	yych = *(mar = ++cur);
-	if (yych <= '/') goto yy645;
-	if (yych <= '7') goto yy668;
-yy645:
-#line 837 "../src/parse/lexer.re"
+	if (yych <= '/') goto yy663;
+	if (yych <= '7') goto yy686;
+yy663:
+#line 842 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(ast.loc, "syntax error in octal escape sequence")); }
-#line 5582 "src/parse/lexer.cc"
-yy646:
+#line 5581 "src/parse/lexer.cc"
+yy664:
 	++cur;
-	goto yy645;
-yy647:
+	goto yy663;
+yy665:
 	yyaccept = 3;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy648;
-		if (yych <= '9') goto yy669;
+		if (yych <= '/') goto yy666;
+		if (yych <= '9') goto yy687;
 	} else {
-		if (yych <= 'F') goto yy669;
-		if (yych <= '`') goto yy648;
-		if (yych <= 'f') goto yy669;
+		if (yych <= 'F') goto yy687;
+		if (yych <= '`') goto yy666;
+		if (yych <= 'f') goto yy687;
 	}
-yy648:
-#line 836 "../src/parse/lexer.re"
+yy666:
+#line 841 "../src/parse/lexer.re"
 	{ RET_FAIL(error_at(ast.loc, "syntax error in hexadecimal escape sequence")); }
-#line 5600 "src/parse/lexer.cc"
-yy649:
+#line 5599 "src/parse/lexer.cc"
+yy667:
 	yyaccept = 3;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy648;
-		if (yych <= '9') goto yy670;
-		goto yy648;
+		if (yych <= '/') goto yy666;
+		if (yych <= '9') goto yy688;
+		goto yy666;
 	} else {
-		if (yych <= 'F') goto yy670;
-		if (yych <= '`') goto yy648;
-		if (yych <= 'f') goto yy670;
-		goto yy648;
+		if (yych <= 'F') goto yy688;
+		if (yych <= '`') goto yy666;
+		if (yych <= 'f') goto yy688;
+		goto yy666;
 	}
-yy650:
+yy668:
 	++cur;
-#line 851 "../src/parse/lexer.re"
+#line 856 "../src/parse/lexer.re"
 	{ ast.chr = '\\'_u8; return Ret::OK; }
-#line 5618 "src/parse/lexer.cc"
-yy651:
+#line 5617 "src/parse/lexer.cc"
+yy669:
 	++cur;
-#line 844 "../src/parse/lexer.re"
+#line 849 "../src/parse/lexer.re"
 	{ ast.chr = '\a'_u8; return Ret::OK; }
-#line 5623 "src/parse/lexer.cc"
-yy652:
+#line 5622 "src/parse/lexer.cc"
+yy670:
 	++cur;
-#line 845 "../src/parse/lexer.re"
+#line 850 "../src/parse/lexer.re"
 	{ ast.chr = '\b'_u8; return Ret::OK; }
-#line 5628 "src/parse/lexer.cc"
-yy653:
+#line 5627 "src/parse/lexer.cc"
+yy671:
 	++cur;
-#line 846 "../src/parse/lexer.re"
+#line 851 "../src/parse/lexer.re"
 	{ ast.chr = '\f'_u8; return Ret::OK; }
-#line 5633 "src/parse/lexer.cc"
-yy654:
+#line 5632 "src/parse/lexer.cc"
+yy672:
 	++cur;
-#line 847 "../src/parse/lexer.re"
+#line 852 "../src/parse/lexer.re"
 	{ ast.chr = '\n'_u8; return Ret::OK; }
-#line 5638 "src/parse/lexer.cc"
-yy655:
+#line 5637 "src/parse/lexer.cc"
+yy673:
 	++cur;
-#line 848 "../src/parse/lexer.re"
+#line 853 "../src/parse/lexer.re"
 	{ ast.chr = '\r'_u8; return Ret::OK; }
-#line 5643 "src/parse/lexer.cc"
-yy656:
+#line 5642 "src/parse/lexer.cc"
+yy674:
 	++cur;
-#line 849 "../src/parse/lexer.re"
+#line 854 "../src/parse/lexer.re"
 	{ ast.chr = '\t'_u8; return Ret::OK; }
-#line 5648 "src/parse/lexer.cc"
-yy657:
+#line 5647 "src/parse/lexer.cc"
+yy675:
 	++cur;
-#line 850 "../src/parse/lexer.re"
+#line 855 "../src/parse/lexer.re"
 	{ ast.chr = '\v'_u8; return Ret::OK; }
-#line 5653 "src/parse/lexer.cc"
-yy658:
+#line 5652 "src/parse/lexer.cc"
+yy676:
 	yyaccept = 3;
 	yych = *(mar = ++cur);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy648;
-		if (yych <= '9') goto yy671;
-		goto yy648;
+		if (yych <= '/') goto yy666;
+		if (yych <= '9') goto yy689;
+		goto yy666;
 	} else {
-		if (yych <= 'F') goto yy671;
-		if (yych <= '`') goto yy648;
-		if (yych <= 'f') goto yy671;
-		goto yy648;
+		if (yych <= 'F') goto yy689;
+		if (yych <= '`') goto yy666;
+		if (yych <= 'f') goto yy689;
+		goto yy666;
 	}
-yy659:
+yy677:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy660;
-	if (yych <= 0xBF) goto yy641;
-yy660:
+	if (yych <= 0x7F) goto yy678;
+	if (yych <= 0xBF) goto yy659;
+yy678:
 	cur = mar;
 	if (yyaccept <= 1) {
-		if (yyaccept == 0) {
-			goto yy632;
-		} else {
-			goto yy634;
-		}
+		if (yyaccept == 0) goto yy650;
+		else goto yy652;
 	} else {
-		if (yyaccept == 2) {
-			goto yy645;
-		} else {
-			goto yy648;
-		}
+		if (yyaccept == 2) goto yy663;
+		else goto yy666;
 	}
-yy661:
+yy679:
 	yych = *++cur;
-	if (yych <= 0x9F) goto yy660;
-	if (yych <= 0xBF) goto yy659;
-	goto yy660;
-yy662:
+	if (yych <= 0x9F) goto yy678;
+	if (yych <= 0xBF) goto yy677;
+	goto yy678;
+yy680:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy660;
-	if (yych <= 0xBF) goto yy659;
-	goto yy660;
-yy663:
+	if (yych <= 0x7F) goto yy678;
+	if (yych <= 0xBF) goto yy677;
+	goto yy678;
+yy681:
 	yych = *++cur;
-	if (yych <= 0x8F) goto yy660;
-	if (yych <= 0xBF) goto yy662;
-	goto yy660;
-yy664:
+	if (yych <= 0x8F) goto yy678;
+	if (yych <= 0xBF) goto yy680;
+	goto yy678;
+yy682:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy660;
-	if (yych <= 0xBF) goto yy662;
-	goto yy660;
-yy665:
+	if (yych <= 0x7F) goto yy678;
+	if (yych <= 0xBF) goto yy680;
+	goto yy678;
+yy683:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy660;
-	if (yych <= 0x8F) goto yy662;
-	goto yy660;
-yy666:
+	if (yych <= 0x7F) goto yy678;
+	if (yych <= 0x8F) goto yy680;
+	goto yy678;
+yy684:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy660;
-	if (yych <= 0xBF) goto yy627;
-	goto yy660;
-yy667:
+	if (yych <= 0x7F) goto yy678;
+	if (yych <= 0xBF) goto yy645;
+	goto yy678;
+yy685:
 	yych = *++cur;
-	if (yych <= 0x7F) goto yy660;
-	if (yych <= 0xBF) goto yy666;
-	goto yy660;
-yy668:
+	if (yych <= 0x7F) goto yy678;
+	if (yych <= 0xBF) goto yy684;
+	goto yy678;
+yy686:
 	yych = *++cur;
-	if (yych <= '/') goto yy660;
-	if (yych <= '7') goto yy672;
-	goto yy660;
-yy669:
+	if (yych <= '/') goto yy678;
+	if (yych <= '7') goto yy690;
+	goto yy678;
+yy687:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy660;
-		if (yych <= '9') goto yy673;
-		goto yy660;
+		if (yych <= '/') goto yy678;
+		if (yych <= '9') goto yy691;
+		goto yy678;
 	} else {
-		if (yych <= 'F') goto yy673;
-		if (yych <= '`') goto yy660;
-		if (yych <= 'f') goto yy673;
-		goto yy660;
+		if (yych <= 'F') goto yy691;
+		if (yych <= '`') goto yy678;
+		if (yych <= 'f') goto yy691;
+		goto yy678;
 	}
-yy670:
+yy688:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy660;
-		if (yych <= '9') goto yy674;
-		goto yy660;
+		if (yych <= '/') goto yy678;
+		if (yych <= '9') goto yy692;
+		goto yy678;
 	} else {
-		if (yych <= 'F') goto yy674;
-		if (yych <= '`') goto yy660;
-		if (yych <= 'f') goto yy674;
-		goto yy660;
+		if (yych <= 'F') goto yy692;
+		if (yych <= '`') goto yy678;
+		if (yych <= 'f') goto yy692;
+		goto yy678;
 	}
-yy671:
+yy689:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy660;
-		if (yych <= '9') goto yy675;
-		goto yy660;
+		if (yych <= '/') goto yy678;
+		if (yych <= '9') goto yy693;
+		goto yy678;
 	} else {
-		if (yych <= 'F') goto yy675;
-		if (yych <= '`') goto yy660;
-		if (yych <= 'f') goto yy675;
-		goto yy660;
+		if (yych <= 'F') goto yy693;
+		if (yych <= '`') goto yy678;
+		if (yych <= 'f') goto yy693;
+		goto yy678;
 	}
-yy672:
+yy690:
 	++cur;
-#line 843 "../src/parse/lexer.re"
+#line 848 "../src/parse/lexer.re"
 	{ ast.chr = unesc_oct(tok, cur); return Ret::OK; }
-#line 5766 "src/parse/lexer.cc"
-yy673:
+#line 5759 "src/parse/lexer.cc"
+yy691:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy660;
-		if (yych <= '9') goto yy676;
-		goto yy660;
+		if (yych <= '/') goto yy678;
+		if (yych <= '9') goto yy694;
+		goto yy678;
 	} else {
-		if (yych <= 'F') goto yy676;
-		if (yych <= '`') goto yy660;
-		if (yych <= 'f') goto yy676;
-		goto yy660;
+		if (yych <= 'F') goto yy694;
+		if (yych <= '`') goto yy678;
+		if (yych <= 'f') goto yy694;
+		goto yy678;
 	}
-yy674:
+yy692:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy660;
-		if (yych <= '9') goto yy671;
-		goto yy660;
+		if (yych <= '/') goto yy678;
+		if (yych <= '9') goto yy689;
+		goto yy678;
 	} else {
-		if (yych <= 'F') goto yy671;
-		if (yych <= '`') goto yy660;
-		if (yych <= 'f') goto yy671;
-		goto yy660;
+		if (yych <= 'F') goto yy689;
+		if (yych <= '`') goto yy678;
+		if (yych <= 'f') goto yy689;
+		goto yy678;
 	}
-yy675:
+yy693:
 	++cur;
-#line 842 "../src/parse/lexer.re"
+#line 847 "../src/parse/lexer.re"
 	{ ast.chr = unesc_hex(tok, cur); return Ret::OK; }
-#line 5795 "src/parse/lexer.cc"
-yy676:
+#line 5788 "src/parse/lexer.cc"
+yy694:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy660;
-		if (yych >= ':') goto yy660;
+		if (yych <= '/') goto yy678;
+		if (yych >= ':') goto yy678;
 	} else {
-		if (yych <= 'F') goto yy677;
-		if (yych <= '`') goto yy660;
-		if (yych >= 'g') goto yy660;
+		if (yych <= 'F') goto yy695;
+		if (yych <= '`') goto yy678;
+		if (yych >= 'g') goto yy678;
 	}
-yy677:
+yy695:
 	yych = *++cur;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy660;
-		if (yych <= '9') goto yy670;
-		goto yy660;
+		if (yych <= '/') goto yy678;
+		if (yych <= '9') goto yy688;
+		goto yy678;
 	} else {
-		if (yych <= 'F') goto yy670;
-		if (yych <= '`') goto yy660;
-		if (yych <= 'f') goto yy670;
-		goto yy660;
+		if (yych <= 'F') goto yy688;
+		if (yych <= '`') goto yy678;
+		if (yych <= 'f') goto yy688;
+		goto yy678;
 	}
 }
-#line 861 "../src/parse/lexer.re"
+#line 866 "../src/parse/lexer.re"
 
     }
 }
@@ -5838,95 +5831,93 @@ Ret Input::set_sourceline() {
 sourceline:
     tok = cur;
 
-#line 5842 "src/parse/lexer.cc"
+#line 5835 "src/parse/lexer.cc"
 {
 	uint8_t yych;
-	static const unsigned char yybm[] = {
-		  0, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128,   0, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128,   0, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		192, 192, 192, 192, 192, 192, 192, 192, 
-		192, 192, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128,   0, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
-		128, 128, 128, 128, 128, 128, 128, 128, 
+	static const unsigned char yybm[256] = {
+		  0, 128, 128, 128, 128, 128, 128, 128,
+		128, 128,   0, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128,   0, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		192, 192, 192, 192, 192, 192, 192, 192,
+		192, 192, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128,   0, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128,
+		128, 128, 128, 128, 128, 128, 128, 128
 	};
 	if ((lim - cur) < 2) if (!fill(2)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
 	if (yych <= '\r') {
 		if (yych <= '\t') {
-			if (yych >= 0x01) goto yy679;
+			if (yych >= 0x01) goto yy697;
 		} else {
-			if (yych <= '\n') goto yy681;
-			if (yych <= '\f') goto yy679;
-			goto yy682;
+			if (yych <= '\n') goto yy699;
+			if (yych <= '\f') goto yy697;
+			goto yy700;
 		}
 	} else {
 		if (yych <= '"') {
-			if (yych <= '!') goto yy679;
-			goto yy683;
+			if (yych <= '!') goto yy697;
+			goto yy701;
 		} else {
-			if (yych <= '0') goto yy679;
-			if (yych <= '9') goto yy684;
-			goto yy679;
+			if (yych <= '0') goto yy697;
+			if (yych <= '9') goto yy702;
+			goto yy697;
 		}
 	}
 	++cur;
-#line 902 "../src/parse/lexer.re"
+#line 907 "../src/parse/lexer.re"
 	{ --cur; return Ret::OK; }
-#line 5902 "src/parse/lexer.cc"
-yy679:
+#line 5895 "src/parse/lexer.cc"
+yy697:
 	++cur;
-yy680:
-#line 903 "../src/parse/lexer.re"
+yy698:
+#line 908 "../src/parse/lexer.re"
 	{ goto sourceline; }
-#line 5908 "src/parse/lexer.cc"
-yy681:
+#line 5901 "src/parse/lexer.cc"
+yy699:
 	++cur;
-#line 901 "../src/parse/lexer.re"
+#line 906 "../src/parse/lexer.re"
 	{ pos = tok = cur; return Ret::OK; }
-#line 5913 "src/parse/lexer.cc"
-yy682:
+#line 5906 "src/parse/lexer.cc"
+yy700:
 	yych = *++cur;
-	if (yych == '\n') goto yy681;
-	goto yy680;
-yy683:
+	if (yych == '\n') goto yy699;
+	goto yy698;
+yy701:
 	yych = *(mar = ++cur);
-	if (yych <= 0x00) goto yy680;
-	if (yych == '\n') goto yy680;
-	goto yy686;
-yy684:
+	if (yych <= 0x00) goto yy698;
+	if (yych == '\n') goto yy698;
+	goto yy704;
+yy702:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yybm[0+yych] & 64) {
-		goto yy684;
-	}
-#line 883 "../src/parse/lexer.re"
+	if (yybm[0+yych] & 64) goto yy702;
+#line 888 "../src/parse/lexer.re"
 	{
         uint32_t l;
         if (!s_to_u32_unsafe(tok, cur, l)) {
@@ -5935,24 +5926,22 @@ yy684:
         set_line(l);
         goto sourceline;
     }
-#line 5939 "src/parse/lexer.cc"
-yy685:
+#line 5930 "src/parse/lexer.cc"
+yy703:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-yy686:
-	if (yybm[0+yych] & 128) {
-		goto yy685;
-	}
-	if (yych <= '\n') goto yy687;
-	if (yych <= '"') goto yy688;
-	goto yy689;
-yy687:
+yy704:
+	if (yybm[0+yych] & 128) goto yy703;
+	if (yych <= '\n') goto yy705;
+	if (yych <= '"') goto yy706;
+	goto yy707;
+yy705:
 	cur = mar;
-	goto yy680;
-yy688:
+	goto yy698;
+yy706:
 	++cur;
-#line 892 "../src/parse/lexer.re"
+#line 897 "../src/parse/lexer.re"
 	{
         InputFile &in = get_input();
         std::string &name = in.escaped_name;
@@ -5961,16 +5950,16 @@ yy688:
         msg.filenames.push_back(name);
         goto sourceline;
     }
-#line 5965 "src/parse/lexer.cc"
-yy689:
+#line 5954 "src/parse/lexer.cc"
+yy707:
 	++cur;
 	if (lim <= cur) if (!fill(1)) RET_FAIL(error_at_cur("unexpected end of input"));
 	yych = *cur;
-	if (yych <= 0x00) goto yy687;
-	if (yych == '\n') goto yy687;
-	goto yy685;
+	if (yych <= 0x00) goto yy705;
+	if (yych == '\n') goto yy705;
+	goto yy703;
 }
-#line 904 "../src/parse/lexer.re"
+#line 909 "../src/parse/lexer.re"
 
 }
 
@@ -1,4 +1,4 @@
-/* Generated by re2c 3.0 */
+/* Generated by re2c 3.1 */
 
 #ifndef _RE2C_PARSE_LEX_
 #define _RE2C_PARSE_LEX_
@@ -3,7 +3,6 @@
 
 #include <stddef.h>
 #include <string.h>
-#include <map>
 #include <vector>
 #include <queue>
 
@@ -12,6 +11,7 @@
 #include "src/dfa/determinization.h"
 #include "src/nfa/nfa.h"
 #include "src/util/check.h"
+#include "src/util/containers.h"
 
 namespace re2c {
 namespace libre2c {
@@ -109,7 +109,7 @@ struct zhistory_t {
         int32_t prec2;
         int32_t prec;
     };
-    using cache_t = std::map<uint64_t, cache_entry_t>;
+    using cache_t = hash_table_t<cache_entry_t>;
 
     std::vector<node_t> nodes;
     cache_t cache;
@@ -46,7 +46,7 @@ int regexec_dfa(
 
         if (i == Tdfa::NIL || c == 0) break;
 
-        apply_regops(regs, s->tcmd[j], p - string - 1);
+        apply_regops(regs, s->cmd(j), p - string - 1);
     }
 
     if (s->rule == Rule::NONE && x != nullptr) {
@@ -54,7 +54,7 @@ int regexec_dfa(
         p = q;
 
         // apply fallback tags
-        apply_regops(regs, s->tcmd[dfa->nchars + 1], p - string - 1);
+        apply_regops(regs, s->cmd(dfa->nchars + 1), p - string - 1);
     }
 
     if (s->rule == Rule::NONE) {
@@ -63,7 +63,7 @@ int regexec_dfa(
 
     const regoff_t mlen = p - string - 1;
     const getoff_dfa_t fn = { dfa, regs, mlen };
-    apply_regops(regs, s->tcmd[dfa->nchars], mlen);
+    apply_regops(regs, s->cmd(dfa->nchars), mlen);
     tags_to_submatch(dfa->tags, nmatch, pmatch, mlen, fn);
     return 0;
 }
@@ -113,20 +113,20 @@ subhistory_t* regparse_dfa(const regex_t* preg, const char* string, size_t nmatc
 
         if (i == Tdfa::NIL || c == 0) break;
 
-        apply_regops_with_history(regtrie, s->tcmd[j], p - string - 1);
+        apply_regops_with_history(regtrie, s->cmd(j), p - string - 1);
     }
 
     regoff_t mlen;
     if (s->rule != Rule::NONE) {
         // already in final state, apply final tags
         mlen = p - string - 1;
-        apply_regops_with_history(regtrie, s->tcmd[dfa->nchars], mlen);
+        apply_regops_with_history(regtrie, s->cmd(dfa->nchars), mlen);
     } else if (x != nullptr) {
         // rollback to a final state, apply fallback tags
         s = x;
         p = q;
         mlen = p - string - 1;
-        apply_regops_with_history(regtrie, s->tcmd[dfa->nchars + 1], mlen);
+        apply_regops_with_history(regtrie, s->cmd(dfa->nchars + 1), mlen);
     } else {
         // no final state on the way => no match
         return nullptr;
@@ -144,10 +144,10 @@ int32_t zprecedence1(ctx_t& ctx, hidx_t idx1, hidx_t idx2, int32_t& prec1, int32
     if (invert) std::swap(k1, k2);
     const uint64_t key = (static_cast<uint64_t>(k1) << 32) | k2;
 
-    zhistory_t::cache_t::const_iterator i = cache.find(key);
-    if (i != cache.end()) {
+    const zhistory_t::cache_entry_t* i = cache.find(key);
+    if (i) {
         // use previously computed precedence values from cache
-        const zhistory_t::cache_entry_t& val = i->second;
+        const zhistory_t::cache_entry_t& val = *i;
         prec1 = val.prec1;
         prec2 = val.prec2;
         prec = val.prec;
@@ -163,7 +163,7 @@ int32_t zprecedence1(ctx_t& ctx, hidx_t idx1, hidx_t idx2, int32_t& prec1, int32
             std::swap(val.prec1, val.prec2);
             val.prec = -val.prec;
         }
-        cache.insert(std::make_pair(key, val));
+        cache.insert(key, val);
     }
 
     return prec;
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <queue>
 #include <set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -19,6 +20,9 @@ namespace re2c {
 
 class Msg;
 
+static bool can_hoist_tags(const State* s, const opt_t* opts);
+static bool can_hoist_skip(const State* s, const opt_t* opts);
+
 static bool is_eof(const opt_t* opts, uint32_t ub) {
     return opts->fill_eof != NOEOF && static_cast<uint32_t>(opts->fill_eof) == ub;
 }
@@ -30,8 +34,7 @@ Adfa::Adfa(Tdfa&& dfa,
            const std::string& nm,
            const std::string& cn,
            const std::string& su,
-           const opt_t* opts,
-           Msg& msg)
+           const opt_t* opts)
     : // Move ownership from TDFA to ADFA.
       charset(std::move(dfa.charset)),
       rules(std::move(dfa.rules)),
@@ -44,7 +47,6 @@ Adfa::Adfa(Tdfa&& dfa,
       loc(loc),
       name(nm),
       cond(cn),
-      msg(msg),
 
       accepts(),
 
@@ -72,6 +74,9 @@ Adfa::Adfa(Tdfa&& dfa,
       oldstyle_ctxmarker(false),
 
       bitmap(nullptr),
+      table(nullptr),
+      classes(nullptr),
+      profile(nullptr),
       setup(su),
 
       initial_label(nullptr) {
@@ -382,6 +387,15 @@ void Adfa::prepare(const opt_t* opts) {
         hoist_tags(opts);
     }
 
+    // see note [unrolled loops]
+    if (opts->unroll_loops > 1
+            && opts->fill_enable
+            && opts->fill_check
+            && opts->fill_eof == NOEOF
+            && opts->target != Target::DOT) {
+        unroll_loops(opts);
+    }
+
     // Find states that require an YYFILL label. Do this before splitting, as the move part of the
     // split states needs to keep a pointer to the match part.
     for (State* s = head; s; s = s->next) {
@@ -415,9 +429,303 @@ void Adfa::prepare(const opt_t* opts) {
     if (opts->eager_skip) {
         hoist_tags_and_skip(opts);
     }
+
+    // see note [fast path]
+    if (opts->fast_path && opts->fill_enable && opts->fill_check && opts->target == Target::CODE) {
+        fast_path();
+    }
+}
+
+// Make a copy of the given state without YYFILL check and insert it after the `prev` state.
+State* Adfa::copy_state(const State* s, State* prev) {
+    State* c = new State;
+    add_state(c, prev);
+    c->rule = s->rule;
+    c->rule_tags = s->rule_tags;
+    c->fall_tags = s->fall_tags;
+    c->fallback = s->fallback;
+    c->is_base = s->is_base;
+    c->action = s->action;
+    c->go = s->go;
+    c->go.span = allocate<Span>(s->go.span_count);
+    memcpy(c->go.span, s->go.span, s->go.span_count * sizeof(Span));
+    return c;
+}
+
+// note [unrolled loops]
+//
+// Without the end-of-input rule a state that loops to itself on some characters (identifier tails,
+// whitespace, string literal bodies, comments) is a fill point that checks the length of the
+// remaining input on every iteration of the loop (see note [finding strongly connected components
+// of DFA]). With `--unroll-loops <n>` option such states are unrolled: a state is followed by n - 1
+// copies without the check, the self-loop transitions of the state go to the first copy, those of
+// each copy go to the next one, and those of the last copy go back to the state. The check in the
+// state is extended by n - 1 characters to cover the copies (this also increases YYMAXFILL), so the
+// length is checked once per n characters instead of on every character. Exit transitions of the
+// copies are the same as those of the state, so the lexer can leave the loop at any character.
+//
+// Unrolling is done on the DFA, so it works in all code models and for all target languages. It
+// has no effect with the end-of-input rule (the length is checked only on the sentinel character)
+// or without YYFILL checks. States that get a vectorized loop with `--simd-loops` are not unrolled
+// (see note [SIMD loops]), so the two options can be used together.
+
+void Adfa::unroll_loops(const opt_t* opts) {
+    const uint32_t n = opts->unroll_loops;
+    std::vector<State*> copies;
+
+    for (State* s = head; s; s = s->next) {
+        if (s->fill == 0
+                || (s->action.kind != Action::Kind::MATCH && s->action.kind != Action::Kind::SAVE)) {
+            continue;
+        }
+
+        // The state is not split yet, and with `--eager-skip` skip is not hoisted yet. The move
+        // part of the split state gets the transitions of this state, and skip is hoisted out of
+        // them if possible (see `hoist_tags_and_skip`), in which case there is no vectorized loop.
+        const bool skip = opts->eager_skip && can_hoist_tags(s, opts) && can_hoist_skip(s, opts);
+        SimdClass cls;
+        if (!skip && simd_loop(opts, *this, s, cls)) continue;
+        bool self_loop = false;
+        for (uint32_t i = 0; i < s->go.span_count; ++i) {
+            self_loop |= s->go.span[i].to == s;
+        }
+        if (!self_loop) continue;
+
+        copies.assign(1, s);
+        for (uint32_t i = 1; i < n; ++i) {
+            copies.push_back(copy_state(s, copies.back()));
+        }
+        for (uint32_t i = 0; i < n; ++i) {
+            CodeGo& go = copies[i]->go;
+            for (uint32_t j = 0; j < go.span_count; ++j) {
+                if (go.span[j].to == s) go.span[j].to = copies[(i + 1) % n];
+            }
+        }
+        s->fill += n - 1;
+        s = copies.back();
+    }
+}
+
+// Check if the self-loop of a state is vectorized with `--simd-loops` and find the character class
+// of the loop (see note [SIMD loops]). Both codegen and loop unrolling use this check, so that
+// states with a vectorized loop are not unrolled.
+bool simd_loop(const opt_t* opts, const Adfa& dfa, const State* s, SimdClass& cls) {
+    if (!opts->simd_loops
+            || opts->target != Target::CODE
+            || opts->api != Api::DEFAULT
+            || opts->debug
+            || opts->profile_gen
+            || dfa.upper_char > 0x100) {
+        return false;
+    }
+
+    const CodeGo& go = s->go;
+    if (s->action.kind != Action::Kind::MATCH || go.tags != TCID0 || go.skip) return false;
+
+    // The loop needs YYLIMIT to stay within bounds.
+    if (opts->fill_eof == NOEOF && (!opts->fill_enable || !opts->fill_check || s->fill == 0)) {
+        return false;
+    }
+
+    // Find the state that dispatches on the peeked character: after tunneling (see note [tag
+    // hoisting, skip hoisting and tunneling]) it is often a move state that follows the loop state.
+    const CodeGo* dgo = &go;
+    if (go.span_count == 1 && go.span[0].tags == TCID0) {
+        const State* m = go.span[0].to;
+        if (m->action.kind != Action::Kind::MOVE || m->go.tags != TCID0 || m->go.skip) return false;
+        dgo = &m->go;
+    }
+
+    // Find the loop characters.
+    bool loop[0x100] = {};
+    bool found = false;
+    for (uint32_t i = 0, lb = 0; i < dgo->span_count; lb = dgo->span[i++].ub) {
+        const Span& x = dgo->span[i];
+        if (x.to != s) continue;
+        if (x.tags != TCID0) return false;
+        for (uint32_t c = lb; c < x.ub && c < 0x100; ++c) loop[c] = true;
+        found = true;
+    }
+    if (!found) return false;
+    if (opts->fill_eof != NOEOF) loop[opts->fill_eof] = false;
+
+    // Split loop characters and exit characters into ranges.
+    uint32_t lower[2][0x100], upper[2][0x100], nranges[2] = {0, 0};
+    for (uint32_t c = 0; c < 0x100; ++c) {
+        const uint32_t j = loop[c] ? 0 : 1;
+        if (c == 0 || loop[c] != loop[c - 1]) lower[j][nranges[j]++] = c;
+        upper[j][nranges[j] - 1] = c;
+    }
+
+    // No loop characters are left if the only one is the end-of-input sentinel.
+    if (nranges[0] == 0 || nranges[1] == 0) return false;
+    const uint32_t k = nranges[1] < nranges[0] ? 1 : 0;
+    if (nranges[k] > CodeGoLoop::MAX_RANGES) return false;
+
+    cls.nranges = nranges[k];
+    memcpy(cls.lower, lower[k], nranges[k] * sizeof(uint32_t));
+    memcpy(cls.upper, upper[k], nranges[k] * sizeof(uint32_t));
+    cls.exit = k == 1;
+    return true;
+}
+
+// note [fast path]
+//
+// Without the end-of-input rule every state in a non-trivial strongly connected component (SCC) of
+// the DFA is a fill point that checks the length of the remaining input on each visit and calls
+// YYFILL if it is too short (see note [finding strongly connected components of DFA]). A call in
+// the loop body is expensive even if it is never made: the C compiler has to assume that it may
+// change the lexer state, so it cannot keep YYCURSOR and YYLIMIT in registers.
+//
+// With `--fast-path` option each SCC (except for the SCC of the initial state) is duplicated. The
+// copy (fast path) has no YYFILL calls, and it checks the length only in its heads: the states
+// entered from outside of the SCC and the targets of back edges in depth-first order, so that every
+// cycle in the copy goes through a head. A head checks that the remaining input is long enough to
+// go through all states of the SCC and still have the maximum YYFILL argument in it, and if not, it
+// goes to the same state of the original SCC (slow path). The check is done before the head
+// consumes a character, so the slow path starts from the beginning of the state. All transitions
+// to the heads (including those on the slow path) go to the fast path, so the lexer returns to it
+// in the next head after YYFILL.
+//
+// Only the calls are removed, not the checks: a head is visited on every iteration of a loop, and
+// the SCC of the initial state keeps its fill points. So the fast path is slower than a lexer
+// without YYFILL, even if YYFILL is never called.
+
+void Adfa::fast_path() {
+    static constexpr uint32_t NONE = ~0u;
+
+    std::vector<State*> states;
+    std::unordered_map<const State*, uint32_t> index;
+    for (State* s = head; s; s = s->next) {
+        index[s] = static_cast<uint32_t>(states.size());
+        states.push_back(s);
+    }
+    const uint32_t nstates = static_cast<uint32_t>(states.size());
+
+    // Tarjan's algorithm.
+    std::vector<uint32_t> order(nstates, NONE), low(nstates, 0), scc(nstates, NONE), stack;
+    std::vector<std::pair<uint32_t, uint32_t>> dfs; // state and the next span to visit
+    uint32_t counter = 0, nscc = 0;
+    for (uint32_t r = 0; r < nstates; ++r) {
+        if (order[r] != NONE) continue;
+        order[r] = low[r] = counter++;
+        stack.push_back(r);
+        dfs.push_back({r, 0});
+        while (!dfs.empty()) {
+            const uint32_t i = dfs.back().first;
+            const CodeGo& go = states[i]->go;
+            if (dfs.back().second < go.span_count) {
+                const uint32_t j = index[go.span[dfs.back().second++].to];
+                if (order[j] == NONE) {
+                    order[j] = low[j] = counter++;
+                    stack.push_back(j);
+                    dfs.push_back({j, 0});
+                } else if (scc[j] == NONE) {
+                    low[i] = std::min(low[i], order[j]);
+                }
+                continue;
+            }
+            dfs.pop_back();
+            if (!dfs.empty()) {
+                const uint32_t p = dfs.back().first;
+                low[p] = std::min(low[p], low[i]);
+            }
+            if (low[i] == order[i]) {
+                uint32_t j;
+                do {
+                    j = stack.back();
+                    stack.pop_back();
+                    scc[j] = nscc;
+                } while (j != i);
+                ++nscc;
+            }
+        }
+    }
+
+    std::vector<std::vector<State*>> members(nscc);
+    for (uint32_t i = 0; i < nstates; ++i) members[scc[i]].push_back(states[i]);
+
+    std::unordered_map<const State*, State*> fast;
+    for (uint32_t c = 0; c < nscc; ++c) {
+        const std::vector<State*>& scc_states = members[c];
+        if (scc_states.size() < 2 || scc[0] == c) continue;
+        auto inside = [&](const State* s) {
+            auto i = index.find(s);
+            return i != index.end() && scc[i->second] == c;
+        };
+
+        // Find the heads, starting with the states entered from outside.
+        std::vector<State*> heads;
+        for (State* s = head; s; s = s->next) {
+            if (inside(s)) continue;
+            for (uint32_t i = 0; i < s->go.span_count; ++i) {
+                State* to = s->go.span[i].to;
+                if (inside(to) && std::find(heads.begin(), heads.end(), to) == heads.end()) {
+                    heads.push_back(to);
+                }
+            }
+        }
+        std::unordered_map<const State*, uint32_t> color; // 1 - on stack, 2 - visited
+        const size_t nentries = heads.size();
+        for (size_t k = 0; k < nentries; ++k) {
+            if (color[heads[k]] != 0) continue;
+            color[heads[k]] = 1;
+            std::vector<std::pair<State*, uint32_t>> path{{heads[k], 0}};
+            while (!path.empty()) {
+                State* s = path.back().first;
+                if (path.back().second < s->go.span_count) {
+                    State* to = s->go.span[path.back().second++].to;
+                    if (!inside(to)) continue;
+                    uint32_t& cl = color[to];
+                    if (cl == 0) {
+                        cl = 1;
+                        path.push_back({to, 0});
+                    } else if (cl == 1) {
+                        if (std::find(heads.begin(), heads.end(), to) == heads.end()) {
+                            heads.push_back(to);
+                        }
+                    }
+                    continue;
+                }
+                color[s] = 2;
+                path.pop_back();
+            }
+        }
+
+        if (heads.empty()) continue;
+        size_t maxfill = 0;
+        for (const State* s : scc_states) maxfill = std::max(maxfill, s->fill);
+
+        // Insert the fast path before the first state of the SCC.
+        State* prev = head;
+        while (prev->next != scc_states[0]) prev = prev->next;
+        for (State* s : scc_states) {
+            fast[s] = prev = copy_state(s, prev);
+        }
+        for (State* s : scc_states) {
+            State* f = fast[s];
+            for (uint32_t i = 0; i < f->go.span_count; ++i) {
+                if (inside(f->go.span[i].to)) f->go.span[i].to = fast[f->go.span[i].to];
+            }
+        }
+        for (State* h : heads) {
+            fast[h]->slow_path = h;
+            fast[h]->fast_need = scc_states.size() + maxfill + 1;
+        }
+
+        // Redirect all other transitions to the heads to the fast path.
+        for (State* s = head; s; s = s->next) {
+            for (uint32_t i = 0; i < s->go.span_count; ++i) {
+                State*& to = s->go.span[i].to;
+                if (inside(to) && std::find(heads.begin(), heads.end(), to) != heads.end()) {
+                    to = fast[to];
+                }
+            }
+        }
+    }
 }
 
-Ret Adfa::calc_stats(OutputBlock& out) {
+Ret Adfa::calc_stats(OutputBlock& out, Msg& msg) {
     const opt_t* opts = out.opts;
 
     // calculate `YYMAXFILL`
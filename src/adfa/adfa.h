@@ -64,6 +64,9 @@ struct State {
     Label* fill_label;
     size_t fill;
 
+    State* slow_path; // for a head of the fast path: the same state on the slow path
+    size_t fast_need; // for a head of the fast path: the input length needed to stay on it
+
     size_t rule;
     tcid_t rule_tags;
     tcid_t fall_tags;
@@ -90,7 +93,6 @@ struct Adfa {
     const loc_t loc;
     const std::string name;
     const std::string cond;
-    Msg& msg;
 
     uniq_vector_t<AcceptTrans> accepts;
 
@@ -118,6 +120,9 @@ struct Adfa {
     bool oldstyle_ctxmarker;
 
     CodeBitmap* bitmap;
+    CodeTable* table; // tables for table-driven code (shared by all DFAs in a block)
+    CodeClasses* classes; // equivalence classes of code units (with `--class-switch`)
+    CodeProfile* profile; // profile counters (with `--profile-gen`)
     std::string setup;
 
     Label* initial_label;
@@ -129,13 +134,12 @@ struct Adfa {
          const std::string& nm,
          const std::string& cn,
          const std::string& su,
-         const opt_t* opts,
-         Msg& msg);
+         const opt_t* opts);
 
     ~Adfa();
     void reorder();
     void prepare(const opt_t* opts);
-    Ret calc_stats(OutputBlock& out) NODISCARD;
+    Ret calc_stats(OutputBlock& out, Msg& msg) NODISCARD;
 
   private:
     void add_state(State*, State*);
@@ -143,10 +147,23 @@ struct Adfa {
     void find_base_state(const opt_t* opts);
     void hoist_tags(const opt_t* opts);
     void hoist_tags_and_skip(const opt_t* opts);
+    State* copy_state(const State* s, State* prev);
+    void unroll_loops(const opt_t* opts);
+    void fast_path();
 
     FORBID_COPY(Adfa);
 };
 
+// Character class of a vectorized self-loop (see note [SIMD loops]).
+struct SimdClass {
+    uint32_t nranges;
+    uint32_t lower[CodeGoLoop::MAX_RANGES];
+    uint32_t upper[CodeGoLoop::MAX_RANGES];
+    bool exit; // ranges describe the characters that exit the loop (not the loop ones)
+};
+
+bool simd_loop(const opt_t* opts, const Adfa& dfa, const State* s, SimdClass& cls);
+
 inline void Action::set_initial() {
     if (kind == Kind::MATCH) {
         // ordinary state with no special action
@@ -192,6 +209,8 @@ inline State::State()
       fill_state(nullptr),
       fill_label(nullptr),
       fill(0),
+      slow_path(nullptr),
+      fast_need(0),
       rule(Rule::NONE),
       rule_tags(TCID0),
       fall_tags(TCID0),
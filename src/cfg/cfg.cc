@@ -59,9 +59,9 @@ void cfg_t::map_actions_to_bblocks(cfg_context_t& ctx) {
     // bblocks for tagged transitions
     for (size_t i = 0; i < ctx.nstate; ++i) {
         cfg_ix_t* trans2bb = &ctx.trans2bb[i * ctx.nsym];
-        tcmd_t** cmd = dfa.states[i]->tcmd;
+        const TdfaState* s = dfa.states[i];
         for (size_t c = 0; c < ctx.nsym; ++c) {
-            trans2bb[c] = cmd[c] == nullptr ? 0 : nbb++;
+            trans2bb[c] = s->cmd(c) == nullptr ? 0 : nbb++;
         }
     }
     nbbarc = nbb;
@@ -69,7 +69,7 @@ void cfg_t::map_actions_to_bblocks(cfg_context_t& ctx) {
     // bblock for final tagged epsilon-transition
     for (size_t i = 0; i < ctx.nstate; ++i) {
         TdfaState* s = dfa.states[i];
-        ctx.final2bb[i] = (s->rule != Rule::NONE && s->tcmd[ctx.nsym]) ? nbb++ : 0;
+        ctx.final2bb[i] = (s->rule != Rule::NONE && s->cmd(ctx.nsym)) ? nbb++ : 0;
     }
     nbbfin = nbb;
 
@@ -77,7 +77,7 @@ void cfg_t::map_actions_to_bblocks(cfg_context_t& ctx) {
     for (size_t i = 0; i < ctx.nstate; ++i) {
         const TdfaState* s = dfa.states[i];
         // (check final tags: fallback tags may be empty)
-        ctx.fback2bb[i] = s->fallback && s->tcmd[ctx.nsym] ? nbb++ : 0;
+        ctx.fback2bb[i] = s->fallback && s->cmd(ctx.nsym) ? nbb++ : 0;
     }
     nbbfall = nbb;
 }
@@ -151,7 +151,7 @@ void successors(cfg_context_t& ctx, size_t x0, bool self) {
         const size_t x = ctx.worklist.back();
         ctx.worklist.pop_back();
 
-        const size_t* a = ctx.dfa.states[x]->arcs;
+        const uint32_t* a = ctx.dfa.states[x]->arcs;
         const cfg_ix_t* trans2bb = &ctx.trans2bb[ctx.nsym * x];
         uint32_t* trans_mark = &ctx.trans_mark[ctx.nsym * x];
 
@@ -206,7 +206,7 @@ void fallback(cfg_context_t& ctx, size_t x0) {
         const size_t x = ctx.worklist.back();
         ctx.worklist.pop_back();
 
-        const size_t* a = ctx.dfa.states[x]->arcs;
+        const uint32_t* a = ctx.dfa.states[x]->arcs;
         const cfg_ix_t* trans2bb = &ctx.trans2bb[ctx.nsym * x];
         uint32_t* trans_mark = &ctx.trans_mark[ctx.nsym * x];
 
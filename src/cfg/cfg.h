@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "src/regexp/tag.h"
+#include "src/util/bitset.h"
 #include "src/util/forbid_copy.h"
 
 namespace re2c {
@@ -68,12 +69,12 @@ struct cfg_t {
     explicit cfg_t(Tdfa& a);
     ~cfg_t();
     static tagver_t compact(const cfg_t& cfg, tagver_t* ver2new);
-    static void liveness_analysis(const cfg_t& cfg, bool* live);
-    static void live_through_bblock(const tcmd_t* cmd, bool* live);
-    static tcmd_t* dce_for_bblock(tcmd_t* cmd, bool* live);
-    static void dead_code_elimination(cfg_t& cfg, const bool* live);
-    static void interference(const cfg_t& cfg, const bool* live, bool* interf);
-    static tagver_t variable_allocation(const cfg_t& cfg, const bool* interf, tagver_t* ver2new);
+    static void liveness_analysis(const cfg_t& cfg, bitmatrix_t& live);
+    static void live_through_bblock(const tcmd_t* cmd, bitword_t* live);
+    static void dead_code_elimination(cfg_t& cfg, const bitmatrix_t& live);
+    static void interference(const cfg_t& cfg, const bitmatrix_t& live, bitmatrix_t& interf);
+    static tagver_t variable_allocation(
+            const cfg_t& cfg, const bitmatrix_t& interf, tagver_t* ver2new);
     static void renaming(cfg_t& cfg, const tagver_t* ver2new, tagver_t maxver);
     static void normalization(cfg_t& cfg);
 
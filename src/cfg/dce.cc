@@ -5,15 +5,15 @@
 
 namespace re2c {
 
-void cfg_t::dead_code_elimination(cfg_t& cfg, const bool* live) {
-    const size_t nver = static_cast<size_t>(cfg.dfa.maxtagver) + 1;
+void cfg_t::dead_code_elimination(cfg_t& cfg, const bitmatrix_t& live) {
     // final and fallback tags can't be dead by construction
-    cfg_bb_t* b = cfg.bblocks, *e = b + cfg.nbbarc;
+    cfg_bb_t* b = cfg.bblocks;
 
     // Ignore possible local liveness: by construction TDFA has no bblock-local versions.
-    for (; b < e; ++b, live += nver) {
+    for (cfg_ix_t i = 0; i < cfg.nbbarc; ++i, ++b) {
+        const bitword_t* l = live.row(i);
         for (tcmd_t* p, **pp = &b->cmd; (p = *pp);) {
-            if (!live[p->lhs]) {
+            if (!bit_test(l, static_cast<size_t>(p->lhs))) {
                 *pp = p->next;
             } else {
                 pp = &p->next;
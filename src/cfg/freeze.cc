@@ -1,8 +1,12 @@
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 #include <vector>
 
 #include "src/dfa/dfa.h"
 #include "src/dfa/tcmd.h"
+#include "src/util/containers.h"
+#include "src/util/hash64.h"
 
 namespace re2c {
 
@@ -13,31 +17,51 @@ namespace re2c {
 // tagged transition at once). So we bring each command to some 'normal form' and insert it into
 // common index. After that commands can be addressed and compared by index. They also become
 // immutable, because different commands may share representation in memory.
+//
+// Rows of command indices are immutable as well, so identical rows are interned: in a typical DFA
+// most states have no tagged transitions at all and share the row of TCID0.
+
+namespace {
+
+struct tcid_row_eq_t {
+    size_t size;
+    bool operator()(const tcid_t* x, const tcid_t* y) const {
+        return memcmp(x, y, size * sizeof(tcid_t)) == 0;
+    }
+};
+
+} // anonymous namespace
 
 void freeze_tags(Tdfa& dfa) {
     tcpool_t& pool = dfa.tcpool;
     const size_t nsym = dfa.nchars;
+    const size_t nrow = nsym + 2; // +2 for final and fallback epsilon-transitions
+
+    lookup_t<const tcid_t*> rows;
+    tcid_row_eq_t eq = {nrow};
+    tcid_t* buf = new tcid_t[nrow];
 
     for (TdfaState* s : dfa.states) {
-        tcmd_t** cmd = s->tcmd,
-                 **const fin = cmd + nsym,
-                         **const fall = fin + 1;
-        tcid_t* id = s->tcid = new tcid_t[nsym + 2];
-
-        // transition commands
-        for(; cmd < fin; ++cmd) {
-            *id++ = pool.insert(*cmd);
+        // transition commands, final epsilon-transition command, fallback epsilon-transition
+        // command (a state without a row of commands has only empty commands)
+        for (size_t c = 0; c < nrow; ++c) {
+            buf[c] = pool.insert(s->cmd(c));
         }
 
-        // final epsilon-transition command
-        *id++ = pool.insert(*fin);
-
-        // fallback epsilon-transition command
-        *id++ = pool.insert(*fall);
+        const uint64_t h = hash64(0, buf, nrow * sizeof(tcid_t));
+        uint32_t idx = rows.find_with(h, buf, eq);
+        if (idx == lookup_t<const tcid_t*>::NIL) {
+            tcid_t* row = dfa.ir_alc.alloct<tcid_t>(nrow);
+            memcpy(row, buf, nrow * sizeof(tcid_t));
+            idx = rows.push(h, row);
+        }
+        s->tcid = rows[idx];
 
-        delete[] s->tcmd;
+        // the row of commands stays in the TDFA allocator, but it must not be used any more
         s->tcmd = nullptr;
     }
+
+    delete[] buf;
 }
 
 } // namespace re2c
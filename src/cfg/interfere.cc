@@ -1,4 +1,3 @@
-#include <string.h>
 #include <set>
 #include <vector>
 
@@ -6,37 +5,36 @@
 #include "src/dfa/dfa.h"
 #include "src/dfa/tcmd.h"
 #include "src/regexp/tag.h"
+#include "src/util/check.h"
 
 namespace re2c {
 
 using vals_t = std::vector<tagver_t>;
 static void interfere(const tcmd_t* cmd,
-                      const bool* live,
-                      bool* interf,
-                      bool* buf,
-                      vals_t* vals,
-                      size_t nver);
-
-void cfg_t::interference(const cfg_t& cfg, const bool* live, bool* interf) {
-    const tagver_t maxver = cfg.dfa.maxtagver + 1;
-    const size_t nver = static_cast<size_t>(maxver);
-    bool* buf = new bool[nver];
+                      const bitword_t* live,
+                      bitmatrix_t& interf,
+                      bitword_t* buf,
+                      vals_t* vals);
+
+void cfg_t::interference(const cfg_t& cfg, const bitmatrix_t& live, bitmatrix_t& interf) {
+    const size_t nver = static_cast<size_t>(cfg.dfa.maxtagver) + 1;
+    bitword_t* buf = new bitword_t[interf.words()];
     vals_t* vals = new vals_t[nver]();
-    const cfg_bb_t* b = cfg.bblocks, *e = b + cfg.nbbfall;
+    DCHECK(live.words() == interf.words());
 
-    memset(interf, 0, nver * nver * sizeof(bool));
-    for (; b < e; ++b, live += nver) {
-        interfere(b->cmd, live, interf, buf, vals, nver);
+    interf.clear();
+    for (cfg_ix_t i = 0; i < cfg.nbbfall; ++i) {
+        interfere(cfg.bblocks[i].cmd, live.row(i), interf, buf, vals);
     }
 
     // versions of tags with/without history interfere
     const std::set<tagver_t>& mt = cfg.dfa.mtagvers;
     for (tagver_t ver : mt) {
-        for (tagver_t u = ver, v = 0; v < maxver; ++v) {
-            if (mt.find(v) == mt.end()) {
-                const size_t uidx = static_cast<size_t>(u);
-                const size_t vidx = static_cast<size_t>(v);
-                interf[vidx * nver + uidx] = interf[uidx * nver + vidx] = true;
+        const size_t u = static_cast<size_t>(ver);
+        for (size_t v = 0; v < nver; ++v) {
+            if (mt.find(static_cast<tagver_t>(v)) == mt.end()) {
+                interf.set(u, v);
+                interf.set(v, u);
             }
         }
     }
@@ -46,11 +44,12 @@ void cfg_t::interference(const cfg_t& cfg, const bool* live, bool* interf) {
 }
 
 void interfere(const tcmd_t* cmd,
-               const bool* live,
-               bool* interf,
-               bool* buf,
-               vals_t* vals,
-               size_t nver) {
+               const bitword_t* live,
+               bitmatrix_t& interf,
+               bitword_t* buf,
+               vals_t* vals) {
+    const size_t nw = interf.words();
+
     // initialize value of RHS for all commands in this basic block
     for (const tcmd_t* p = cmd; p; p = p->next) {
         const tagver_t r = p->rhs;
@@ -66,14 +65,14 @@ void interfere(const tcmd_t* cmd,
         vals_t& vl = vals[l], &vr = vals[r];
 
         // alive after this command
-        memcpy(buf, live, nver * sizeof(bool));
+        bits_copy(buf, live, nw);
         cfg_t::live_through_bblock(p->next, buf);
 
         // a register does not interfere with itself
-        buf[l] = false;
+        bit_reset(buf, static_cast<size_t>(l));
 
         // if copy command, exclude RHS
-        if (tcmd_t::iscopy(p)) buf[r] = false;
+        if (tcmd_t::iscopy(p)) bit_reset(buf, static_cast<size_t>(r));
 
         // update value of current command's LHS
         if (tcmd_t::iscopy(p)) {
@@ -95,15 +94,14 @@ void interfere(const tcmd_t* cmd,
         // setting to the same value), then it indeed interferes with current LHS.
         for (const tcmd_t* q = cmd; q != p; q = q->next) {
             if (vals[q->lhs] == vl) {
-                buf[q->lhs] = false;
+                bit_reset(buf, static_cast<size_t>(q->lhs));
             }
         }
 
+        // the set of live versions is usually sparse, so iterate only over the set bits
         const size_t u = static_cast<size_t>(l);
-        for (size_t v = 0; v < nver; ++v) {
-            if (!buf[v]) continue;
-            interf[u * nver + v] = interf[v * nver + u] = true;
-        }
+        bits_union(interf.row(u), buf, nw);
+        bits_for_each(buf, nw, [&](size_t v) { interf.set(v, u); });
     }
 }
 
@@ -27,17 +27,17 @@ static cfg_ix_t* postorder(const cfg_t& cfg, bool* done, cfg_ix_t* ord, cfg_ix_t
     return ++ord;
 }
 
-void cfg_t::live_through_bblock(const tcmd_t* cmd, bool* live) {
+void cfg_t::live_through_bblock(const tcmd_t* cmd, bitword_t* live) {
     if (!cmd) return;
 
     live_through_bblock(cmd->next, live);
 
-    const tagver_t l = cmd->lhs, r = cmd->rhs;
-    if (live[l]) {
+    const size_t l = static_cast<size_t>(cmd->lhs), r = static_cast<size_t>(cmd->rhs);
+    if (bit_test(live, l)) {
         // first reset, than set: LHS might be equal to history
-        live[l] = false;
+        bit_reset(live, l);
         if (r != TAGVER_ZERO) {
-            live[r] = true;
+            bit_set(live, r);
         }
     }
 }
@@ -63,30 +63,35 @@ void cfg_t::live_through_bblock(const tcmd_t* cmd, bool* live) {
 // the final version itself. Absence of backup means that final version is not overwritten, but
 // still we should prevent it from merging with other tags (otherwise it may become overwritten).
 
-void cfg_t::liveness_analysis(const cfg_t& cfg, bool* live) {
+void cfg_t::liveness_analysis(const cfg_t& cfg, bitmatrix_t& live) {
     const std::vector<Tag>& tags = cfg.dfa.tags;
-    const size_t nver = static_cast<size_t>(cfg.dfa.maxtagver) + 1;
+    const size_t nw = live.words();
     const cfg_ix_t
     narc = cfg.nbbarc,
     nfin = cfg.nbbfin,
     nfall = cfg.nbbfall;
     const tagver_t* fins = cfg.dfa.finvers;
-    bool* buf1 = new bool[nver];
-    bool* buf2 = new bool[nver];
+    bitword_t* buf1 = new bitword_t[nw];
+    bitword_t* buf2 = new bitword_t[nw];
     bool* done = new bool[narc];
     cfg_ix_t* pord = new cfg_ix_t[narc];
-    memset(live, 0, nfall * nver * sizeof(bool));
+    live.clear();
 
     for (cfg_ix_t i = narc; i < nfin; ++i) {
         const cfg_bb_t* b = cfg.bblocks + i;
         const Rule* r = b->rule;
-        bool* l = &live[i * nver];
+        bitword_t* l = live.row(i);
 
         // all final bblocks have USE tags, but no successors
         DCHECK(r && b->succb == b->succe);
 
         for (size_t t = r->ltag; t < r->htag; ++t) {
-            l[fins[t]] = !fixed(tags[t]);
+            const size_t v = static_cast<size_t>(fins[t]);
+            if (fixed(tags[t])) {
+                bit_reset(l, v);
+            } else {
+                bit_set(l, v);
+            }
         }
     }
 
@@ -100,26 +105,26 @@ void cfg_t::liveness_analysis(const cfg_t& cfg, bool* live) {
         for (cfg_ix_t a = 0; a < narc; ++a) {
             const cfg_ix_t i = pord[a];
             const cfg_bb_t* b = cfg.bblocks + i;
-            bool* old = &live[i * nver];
+            bitword_t* old = live.row(i);
 
             // transition bblocks have no USE tags
             DCHECK(!b->rule);
 
-            memcpy(buf1, old, nver * sizeof(bool));
+            bits_copy(buf1, old, nw);
             for (cfg_ix_t* j = b->succb; j < b->succe; ++j) {
-                const bool* l = &live[*j * nver];
                 const tcmd_t* cmd = cfg.bblocks[*j].cmd;
-                memcpy(buf2, l, nver * sizeof(bool));
-
-                cfg_t::live_through_bblock(cmd, buf2);
-
-                for (size_t v = 0; v < nver; ++v) {
-                    buf1[v] |= buf2[v];
+                if (!cmd) {
+                    // no commands, liveness passes through unchanged
+                    bits_union(buf1, live.row(*j), nw);
+                    continue;
                 }
+                bits_copy(buf2, live.row(*j), nw);
+                cfg_t::live_through_bblock(cmd, buf2);
+                bits_union(buf1, buf2, nw);
             }
 
-            if (memcmp(old, buf1, nver * sizeof(bool)) != 0) {
-                memcpy(old, buf1, nver * sizeof(bool));
+            if (!bits_equal(old, buf1, nw)) {
+                bits_copy(old, buf1, nw);
                 loop = true;
             }
         }
@@ -128,33 +133,35 @@ void cfg_t::liveness_analysis(const cfg_t& cfg, bool* live) {
     for (cfg_ix_t i = nfin; i < nfall; ++i) {
         const cfg_bb_t* b = cfg.bblocks + i;
         const Rule* r = b->rule;
-        bool* l = &live[i * nver];
+        bitword_t* l = live.row(i);
 
         // all fallback bblocks have USE tags
         DCHECK(r);
 
         for (size_t t = r->ltag; t < r->htag; ++t) {
-            l[fins[t]] = !fixed(tags[t]);
+            const size_t v = static_cast<size_t>(fins[t]);
+            if (fixed(tags[t])) {
+                bit_reset(l, v);
+            } else {
+                bit_set(l, v);
+            }
         }
 
         // Need two passes: same version may occur as both LHS and RHS (this is not the same as
         // backward propagation of liveness through bblock).
-        memcpy(buf1, l, nver * sizeof(bool));
+        bits_copy(buf1, l, nw);
         for (const tcmd_t* p = b->cmd; p; p = p->next) {
-            buf1[p->lhs] = false;
+            bit_reset(buf1, static_cast<size_t>(p->lhs));
         }
         for (const tcmd_t* p = b->cmd; p; p = p->next) {
             const tagver_t v = p->rhs;
             if (v != TAGVER_ZERO) {
-                buf1[v] = true;
+                bit_set(buf1, static_cast<size_t>(v));
             }
         }
 
         for (cfg_ix_t* j = b->succb; j < b->succe; ++j) {
-            bool* liv = &live[*j * nver];
-            for (size_t v = 0; v < nver; ++v) {
-                liv[v] |= buf1[v];
-            }
+            bits_union(live.row(*j), buf1, nw);
         }
     }
 
@@ -6,6 +6,7 @@
 #include "src/dfa/dfa.h"
 #include "src/options/opt.h"
 #include "src/regexp/tag.h"
+#include "src/util/bitset.h"
 
 namespace re2c {
 
@@ -22,8 +23,9 @@ void compact_and_optimize_tags(const opt_t* opts, Tdfa& dfa) {
 
         if (opts->optimize_tags && maxver > 0) {
             nver = static_cast<size_t>(maxver) + 1;
-            bool* live = new bool[cfg.nbbfall * nver];
-            bool* interf = new bool[nver * nver];
+            // The number of versions can only decrease on each pass, so the initial size is enough.
+            bitmatrix_t live(cfg.nbbfall, nver);
+            bitmatrix_t interf(nver, nver);
 
             static constexpr uint32_t NPASS = 2;
             for (uint32_t n = 0; n < NPASS; ++n) {
@@ -42,9 +44,6 @@ void compact_and_optimize_tags(const opt_t* opts, Tdfa& dfa) {
 
                 cfg_t::normalization(cfg);
             }
-
-            delete[] live;
-            delete[] interf;
         }
 
         delete[] ver2new;
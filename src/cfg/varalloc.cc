@@ -15,7 +15,8 @@ namespace re2c {
 // clique cover in arbitrary graph is NP-complete. We build just some cover, not necessarily the
 // minimal one. The algorithm takes quadratic time in the number of tags.
 
-tagver_t cfg_t::variable_allocation(const cfg_t& cfg, const bool* interf, tagver_t* ver2new) {
+tagver_t cfg_t::variable_allocation(
+        const cfg_t& cfg, const bitmatrix_t& interf, tagver_t* ver2new) {
     const size_t END = static_cast<size_t>(std::numeric_limits<tagver_t>::max());
     const size_t nver = static_cast<size_t>(cfg.dfa.maxtagver) + 1;
 
@@ -43,7 +44,7 @@ tagver_t cfg_t::variable_allocation(const cfg_t& cfg, const bool* interf, tagver
             if (rx != END) {
                 if (ry != END) continue;
                 for (z = rx; z != END; z = next[z]) {
-                    if (interf[z * nver + y]) break;
+                    if (interf.test(z, y)) break;
                 }
                 if (z == END) {
                     repr[y] = rx;
@@ -52,14 +53,14 @@ tagver_t cfg_t::variable_allocation(const cfg_t& cfg, const bool* interf, tagver
                 }
             } else if (ry != END) {
                 for (z = ry; z != END; z = next[z]) {
-                    if (interf[z * nver + x]) break;
+                    if (interf.test(z, x)) break;
                 }
                 if (z == END) {
                     repr[x] = ry;
                     next[x] = next[ry];
                     next[ry] = x;
                 }
-            } else if (!interf[x * nver + y]) {
+            } else if (!interf.test(x, y)) {
                 repr[x] = repr[y] = x;
                 next[x] = y;
             }
@@ -75,7 +76,7 @@ tagver_t cfg_t::variable_allocation(const cfg_t& cfg, const bool* interf, tagver
 
             for (x = rx; x != END; x = next[x]) {
                 for (y = ry; y != END; y = next[y]) {
-                    if (interf[x * nver + y]) break;
+                    if (interf.test(x, y)) break;
                 }
                 if (y != END) break;
             }
@@ -103,7 +104,7 @@ tagver_t cfg_t::variable_allocation(const cfg_t& cfg, const bool* interf, tagver
 
             // check interference with class members
             for (y = rx; y != END; y = next[y]) {
-                if (interf[x * nver + y]) break;
+                if (interf.test(x, y)) break;
             }
 
             // no interference; add to class
@@ -0,0 +1,198 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "config.h"
+#include "src/codegen/cache.h"
+#include "src/msg/msg.h"
+#include "src/options/opt.h"
+#include "src/util/file_utils.h"
+#include "src/util/hash64.h"
+#include "src/util/string_utils.h"
+
+namespace re2c {
+
+static const char* CACHE_MAGIC = "re2c-cache-2";
+
+static uint64_t hash_str(uint64_t h, const std::string& s) {
+    // include terminating null, so that the boundaries between strings affect the hash
+    return fnv64(h, s.c_str(), s.length() + 1);
+}
+
+static bool file_exists(const std::string& fname) {
+    FILE* f = fopen(fname.c_str(), "rb");
+    if (f == nullptr) return false;
+    fclose(f);
+    return true;
+}
+
+// Helpers to parse a cache entry: a header line followed by a list of dependencies (hash and path
+// on each line), a list of paths that must not exist (one path per line) and a list of output
+// files (size and path on one line, contents on the following).
+static bool read_line(const std::string& s, size_t& pos, std::string& line) {
+    const size_t end = s.find('\n', pos);
+    if (end == std::string::npos) return false;
+    line = s.substr(pos, end - pos);
+    pos = end + 1;
+    return true;
+}
+
+static bool read_num_and_str(
+        const std::string& s, size_t& pos, uint64_t& num, std::string& str, bool hex) {
+    std::string line;
+    if (!read_line(s, pos, line)) return false;
+    const size_t sep = line.find(' ');
+    if (sep == std::string::npos) return false;
+    if (sscanf(line.c_str(), hex ? "%" SCNx64 : "%" SCNu64, &num) != 1) return false;
+    str = line.substr(sep + 1);
+    return true;
+}
+
+bool MemoryCache::read(const std::string& slot, const std::string& name, std::string& data) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto i = entries.find(slot);
+    if (i == entries.end() || i->second.name != name) return false;
+    data = i->second.data;
+    return true;
+}
+
+void MemoryCache::write(const std::string& slot, const std::string& name, std::string&& data) {
+    std::lock_guard<std::mutex> lock(mutex);
+    entry_t& e = entries[slot];
+    e.name = name;
+    e.data = std::move(data);
+}
+
+Cache::Cache(const conopt_t* globopts, MemoryCache* memcache)
+    : globopts(globopts), memcache(memcache), entry(), slot() {}
+
+Ret Cache::lookup(
+        const std::vector<std::string>& args, bool& hit, std::vector<std::string>& files) {
+    hit = false;
+
+    // The cache is only used if the output is fully determined by the input files and options.
+    if ((globopts->cache_dir.empty() && memcache == nullptr)
+            || globopts->source_file == "<stdin>"
+            || globopts->output_file.empty()
+            || globopts->target == Target::SKELETON
+            || globopts->date) {
+        return Ret::OK;
+    }
+
+    std::string source;
+    if (!read_file(globopts->source_file, source)) {
+        RET_FAIL(error("cannot open file: %s", globopts->source_file.c_str()));
+    }
+
+    uint64_t key = FNV64_INIT;
+    key = hash_str(key, PACKAGE_VERSION);
+    key = hash_str(key, RE2C_PROG);
+    for (const std::string& arg : args) {
+        key = hash_str(key, arg);
+    }
+    key = hash_str(key, source);
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016" PRIx64 ".cache", key);
+    if (memcache != nullptr) {
+        entry = name;
+        slot.clear();
+        for (const std::string& arg : args) {
+            slot += arg;
+            slot += '\0';
+        }
+        slot += globopts->output_file;
+    } else {
+        entry = globopts->cache_dir;
+        if (entry.back() != '/' && entry.back() != '\\') entry += '/';
+        entry += name;
+    }
+
+    std::string data, line, path;
+    size_t pos = 0;
+    uint64_t n, num, hash;
+    const bool found = memcache != nullptr
+        ? memcache->read(slot, entry, data) : read_file(entry, data);
+    if (!found) return Ret::OK; // no entry (or cannot read it)
+    if (!read_line(data, pos, line) || line != CACHE_MAGIC) return Ret::OK;
+
+    // check that no dependencies have changed
+    if (!read_line(data, pos, line) || sscanf(line.c_str(), "%" SCNu64, &n) != 1) return Ret::OK;
+    for (uint64_t i = 0; i < n; ++i) {
+        if (!read_num_and_str(data, pos, num, path, true)
+                || !hash_file(path, hash)
+                || hash != num) {
+            return Ret::OK;
+        }
+    }
+
+    // check that no include file has appeared earlier in the search order
+    if (!read_line(data, pos, line) || sscanf(line.c_str(), "%" SCNu64, &n) != 1) return Ret::OK;
+    for (uint64_t i = 0; i < n; ++i) {
+        if (!read_line(data, pos, path) || file_exists(path)) return Ret::OK;
+    }
+
+    // first validate the entry and collect the output files, then write them
+    std::vector<std::pair<std::string, std::string>> outputs;
+    if (!read_line(data, pos, line) || sscanf(line.c_str(), "%" SCNu64, &n) != 1) return Ret::OK;
+    for (uint64_t i = 0; i < n; ++i) {
+        if (!read_num_and_str(data, pos, num, path, false) || data.size() - pos < num) {
+            return Ret::OK;
+        }
+        outputs.push_back(std::make_pair(path, data.substr(pos, num)));
+        pos += num;
+    }
+    for (const std::pair<std::string, std::string>& out : outputs) {
+        if (!write_file(out.first, out.second)) {
+            RET_FAIL(error("cannot write output file %s", out.first.c_str()));
+        }
+    }
+    files.clear();
+    for (const std::pair<std::string, std::string>& out : outputs) files.push_back(out.first);
+
+    hit = true;
+    return Ret::OK;
+}
+
+void Cache::store(const std::map<std::string, uint64_t>& deps,
+                  const std::set<std::string>& misses,
+                  const std::vector<std::string>& outputs) const {
+    if (entry.empty()) return;
+
+    std::string data = CACHE_MAGIC;
+    char buf[32];
+
+    data += "\n" + to_string(deps.size()) + "\n";
+    for (const std::pair<const std::string, uint64_t>& dep : deps) {
+        snprintf(buf, sizeof(buf), "%016" PRIx64 " ", dep.second);
+        data += buf + dep.first + "\n";
+    }
+
+    data += to_string(misses.size()) + "\n";
+    for (const std::string& path : misses) {
+        data += path + "\n";
+    }
+
+    data += to_string(outputs.size()) + "\n";
+    std::string content;
+    for (const std::string& path : outputs) {
+        if (!read_file(path, content)) return;
+        data += to_string(content.size()) + " " + path + "\n" + content;
+    }
+
+    // Failure to store an entry is not an error: the cache is only an optimization.
+    if (memcache != nullptr) {
+        memcache->write(slot, entry, std::move(data));
+    } else {
+        write_file(entry, data);
+    }
+}
+
+} // namespace re2c
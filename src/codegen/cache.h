@@ -0,0 +1,87 @@
+#ifndef _RE2C_CODEGEN_CACHE_
+#define _RE2C_CODEGEN_CACHE_
+
+#include <stdint.h>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/constants.h"
+#include "src/util/attribute.h"
+#include "src/util/forbid_copy.h"
+
+namespace re2c {
+
+struct conopt_t;
+
+// note [compilation cache]
+//
+// With `--cache-dir` option re2c stores the generated files in a cache directory, so that the next
+// run with the same input can skip compilation and copy the files from the cache. Cache entries are
+// keyed by re2c version, command-line arguments and the contents of the source file. Each entry
+// also records the paths and hashes of all files read during compilation (the source file, include
+// files, syntax file and profile), and it is only used if none of them has changed. Files are hashed
+// when they are opened, before their contents are compiled: if a file is edited during compilation,
+// the entry records the old hash, and the next run does not use it. Include files are
+// searched for in several directories, so the entry also records the paths where an include file
+// was not found: if a file appears at one of them, it would shadow the one found before, and the
+// entry cannot be used.
+//
+// Codegen is not independent for different blocks (labels, condition numbers, YYMAXFILL and other
+// directives depend on the whole program), so the cache works on the level of the source file
+// rather than a block. An entry is not stored if there were any warnings (they would not be
+// reproduced on a cache hit), or if some of the output goes to stdout or to files that the cache
+// does not track (skeleton data files).
+//
+// The compile server (see note [compile server]) keeps cache entries in memory instead of the cache
+// directory, so that it does not need `--cache-dir`. It keeps only the latest entry for the same
+// arguments and output file, as the older ones are for previous versions of the source file. The
+// entries are owned by the server (`MemoryCache`) and guarded by a mutex, so that the cache does not
+// depend on compilations being sequential.
+class MemoryCache;
+
+class Cache {
+    const conopt_t* globopts;
+    MemoryCache* memcache; // null unless the in-memory cache is used
+    std::string entry; // path to the cache entry file (empty if the cache is not used)
+    std::string slot;  // arguments and output file (only for the in-memory cache)
+
+  public:
+    Cache(const conopt_t* globopts, MemoryCache* memcache);
+    Ret lookup(const std::vector<std::string>& args, bool& hit, std::vector<std::string>& files)
+        NODISCARD;
+    void store(const std::map<std::string, uint64_t>& deps,
+               const std::set<std::string>& misses,
+               const std::vector<std::string>& outputs) const;
+
+    FORBID_COPY(Cache);
+};
+
+// In-memory cache entries. There is one entry per slot (a combination of arguments and output
+// file), so that an entry for a new version of the source file replaces the old one instead of
+// being added to it, and memory does not grow with every edit.
+class MemoryCache {
+    struct entry_t {
+        std::string name; // entry name (it depends on the contents of the source file)
+        std::string data;
+
+        entry_t(): name(), data() {}
+    };
+
+    std::mutex mutex;
+    std::unordered_map<std::string, entry_t> entries;
+
+  public:
+    MemoryCache(): mutex(), entries() {}
+    bool read(const std::string& slot, const std::string& name, std::string& data);
+    void write(const std::string& slot, const std::string& name, std::string&& data);
+
+    FORBID_COPY(MemoryCache);
+};
+
+} // namespace re2c
+
+#endif // _RE2C_CODEGEN_CACHE_
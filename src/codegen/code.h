@@ -15,6 +15,7 @@
 namespace re2c {
 
 // forward decls
+struct Adfa;
 struct Code;
 struct CodeGo;
 struct CodeGoIf;
@@ -60,6 +61,13 @@ struct CodeBitmap {
     bool used;
 };
 
+// Equivalence classes of code units of one DFA (with `--class-switch`), see note [class switch].
+struct CodeClasses {
+    uint32_t nclasses;
+    uint32_t* classes; // equivalence class of each code unit
+    bool used;
+};
+
 struct Span {
     uint32_t ub;
     State* to;
@@ -81,11 +89,19 @@ struct CodeGoSw {
     CodeGoCase* cases;
     CodeGoCase* defcase;
     uint32_t ncases;
+    bool classes; // switch on the equivalence class of the character rather than the character
 };
 
 struct CodeCmp {
+    enum class Hint: uint32_t {
+        NONE,
+        LIKELY,
+        UNLIKELY
+    };
+
     const char* cmp;
     uint32_t val;
+    Hint hint; // branch probability hint (with `--profile-use`)
 };
 
 // binary if
@@ -150,6 +166,70 @@ struct CodeGoCp {
     CodeGoCpTable* table;
 };
 
+// A chain of transitions on single characters collapsed into one comparison, see note
+// [collapsed chains].
+struct CodeGoChain {
+    uint32_t length;       // number of characters (and transitions) in the chain
+    const uint32_t* chars; // chain characters, starting with the current one
+    const State* to;       // destination of the last transition
+};
+
+// Vectorized loop that skips characters on which a state loops to itself, see note [SIMD loops].
+struct CodeGoLoop {
+    static constexpr uint32_t MAX_RANGES = 4;
+
+    uint32_t nranges;      // number of character ranges
+    const uint32_t* lower; // lower bounds of the ranges
+    const uint32_t* upper; // upper bounds of the ranges (inclusive)
+    bool exit;             // ranges describe the characters that exit the loop (not the loop ones)
+    size_t need;           // characters that must remain before YYLIMIT after the loop
+};
+
+// Transitions of a state in table-driven code, see note [table-driven code].
+struct CodeGoTable {
+    uint32_t span_count; // number of transitions
+    const Span* span;    // transitions of this state (or of the move state that follows it)
+    uint32_t base;       // offset of the row for this state in the transition table
+    bool eof;            // one of the transitions is on the end-of-input symbol
+    bool shared;         // the state has no code of its own and is run by the shared interpreter
+};
+
+// Tagged transition in table-driven code. It is generated as a separate case of the state switch
+// that executes tag operations and goes on to the destination state.
+struct CodeTableJump {
+    const Adfa* dfa;
+    CodeJump jump;
+    uint32_t index; // case number
+};
+
+// Tables for table-driven code of one block, see note [table-driven code].
+struct CodeTable {
+    uint32_t nclasses;      // number of equivalence classes of code units
+    uint32_t* classes;      // equivalence class of each code unit
+    uint32_t nstates;       // size of `base` and `fallback` tables
+    uint32_t* base;         // row offset in the transition table for each state number
+    uint32_t* fallback;     // fallback state on YYFILL failure for each state number (or null)
+    size_t ntrans;          // size of the transition table
+    uint32_t* trans;        // transition table (next state number and a skip bit)
+    uint32_t njumps;        // number of tagged transitions
+    CodeTableJump* jumps;   // tagged transitions
+};
+
+// Profile counters of a state, see note [profiling].
+struct CodeGoProf {
+    uint32_t visits;  // index of the state visit counter
+    uint32_t ntrans;  // number of distinct destination states
+    const State** to; // destination states
+    uint32_t trans;   // index of the transition counter for the first destination (others follow)
+};
+
+// Profile counters of a DFA that are not attached to a state, see note [profiling].
+struct CodeProfile {
+    uint32_t fill;      // index of the YYFILL counter
+    uint32_t backtrack; // index of the backtracking counter
+    uint32_t rules;     // index of the match counter for the first rule (others follow)
+};
+
 struct CodeGo {
     enum class Kind: uint32_t {
         EMPTY,
@@ -164,6 +244,12 @@ struct CodeGo {
     Span* span;
     tcid_t tags;
     bool skip;
+    CodeGoChain* chain;
+    CodeGoLoop* loop;
+    CodeGoTable* table;
+    CodeGoProf* prof;
+    const uint64_t* freq; // execution count of each span (with `--profile-use`)
+    const uint64_t* weight; // expected count of each span (with `re2c:char-weights`)
     union {
         CodeGoSwIf* goswif;
         CodeGoBm* gobm;
@@ -756,6 +842,7 @@ inline CodeCmp* code_cmp(OutAllocator& alc, const char* cmp, uint32_t val) {
     CodeCmp* x = alc.alloct<CodeCmp>(1);
     x->cmp = cmp;
     x->val = val;
+    x->hint = CodeCmp::Hint::NONE;
     return x;
 }
 
@@ -48,7 +48,7 @@ inline bool is_space_nonl(uint32_t c) {
 }
 
 template<typename T>
-void argsubst(std::ostringstream& os,
+void argsubst(std::ostream& os,
               const std::string& str,
               const std::string& stub,
               const char* arg,
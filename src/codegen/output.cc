@@ -1,5 +1,6 @@
 #include <ctype.h>
 #include <stdio.h>
+#include <string.h>
 #include <iomanip>
 
 #include "config.h"
@@ -54,6 +55,8 @@ Output::Output(OutAllocator& alc, Msg& msg)
       need_header(false),
       done_mtag_defs(false),
       skeletons(),
+      profile_keys(),
+      profile(),
       scratchbuf(allocator),
       current_block(nullptr),
       total_opts(nullptr),
@@ -213,12 +216,62 @@ Scratchbuf& Scratchbuf::exact_uint(size_t width) {
 }
 
 const char* Scratchbuf::flush() {
-    const size_t len = os.str().length();
+    const size_t len = size();
     char* e = alc.alloct<char>(len + 1);
-    memcpy(e, os.str().c_str(), len);
+    os.rdbuf()->sgetn(e, static_cast<std::streamsize>(len));
     e[len] = 0;
     os.str("");
     return e;
 }
 
+OutputStreambuf::OutputStreambuf(FILE* file)
+    : file(file), buf(new char[BUFSIZE]), pending_cr(false) {
+    setp(buf, buf + BUFSIZE);
+}
+
+OutputStreambuf::~OutputStreambuf() {
+    delete[] buf;
+}
+
+void OutputStreambuf::write_chunk() {
+    const char* p = pbase(), *e = pptr();
+
+    if (pending_cr && p < e) {
+        if (*p != '\n') fputc('\r', file);
+        pending_cr = false;
+    }
+    for (const char* q; (q = static_cast<const char*>(memchr(p, '\r', static_cast<size_t>(e - p))));
+            p = q + 1) {
+        fwrite(p, 1, static_cast<size_t>(q - p), file);
+        if (q + 1 == e) {
+            pending_cr = true;
+        } else if (q[1] != '\n') {
+            fputc('\r', file);
+        }
+    }
+    fwrite(p, 1, static_cast<size_t>(e - p), file);
+
+    setp(buf, buf + BUFSIZE);
+}
+
+OutputStreambuf::int_type OutputStreambuf::overflow(int_type c) {
+    write_chunk();
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+    return traits_type::not_eof(c);
+}
+
+int OutputStreambuf::sync() {
+    write_chunk();
+    return 0;
+}
+
+void OutputStreambuf::finish() {
+    write_chunk();
+    if (pending_cr) fputc('\r', file);
+    pending_cr = false;
+}
+
 } // namespace re2c
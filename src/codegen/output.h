@@ -2,12 +2,16 @@
 #define _RE2C_CODEGEN_OUTPUT_
 
 #include <stdint.h>
+#include <stdio.h>
 #include <set>
 #include <string>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 #include <map>
 #include <memory>
+#include <streambuf>
+#include <ostream>
 
 #include "src/constants.h"
 #include "src/codegen/code.h"
@@ -28,13 +32,17 @@ struct OutputBlock;
 struct State;
 using Adfas = std::vector<std::unique_ptr<Adfa>>;
 
+// Scratch buffer for formatting short code fragments that are stored in the output allocator. The
+// stream is opened for reading as well as writing, so that `flush` can copy the formatted text
+// directly from the stream buffer to the allocator without constructing temporary strings.
 class Scratchbuf {
     OutAllocator& alc;
     std::ostringstream os;
 
   public:
-    explicit Scratchbuf(OutAllocator& alc): alc(alc), os() {}
-    bool empty() const { return os.str().empty(); }
+    explicit Scratchbuf(OutAllocator& alc): alc(alc), os(std::ios_base::in | std::ios_base::out) {}
+    size_t size() { return static_cast<size_t>(static_cast<std::streamoff>(os.tellp())); }
+    bool empty() { return size() == 0; }
     std::ostringstream& stream() { return os; }
     Scratchbuf& i32(int32_t u) { os << u; return *this; }
     Scratchbuf& u32(uint32_t u) { os << u; return *this; }
@@ -55,8 +63,33 @@ using blocks_t = std::vector<OutputBlock*>;
 using blocks_citer_t = blocks_t::const_iterator;
 using tagnames_t = std::set<std::string>;
 
+// Stream buffer that writes the rendered code to the output file in large chunks, so that the
+// generated code is never held in memory as a whole. All newlines are converted to LF on the way:
+// some of them originate in user-defined code (semantic actions and code fragments in
+// configurations and directives) and may be CR LF, others are generated by re2c itself.
+class OutputStreambuf: public std::streambuf {
+    static constexpr size_t BUFSIZE = 64 * 1024;
+
+    FILE* file;
+    char* buf;
+    bool pending_cr; // CR at the end of the previous chunk (may be followed by LF in the next one)
+
+    void write_chunk();
+
+  protected:
+    int_type overflow(int_type c) override;
+    int sync() override;
+
+  public:
+    explicit OutputStreambuf(FILE* file);
+    ~OutputStreambuf() override;
+    void finish();
+    FORBID_COPY(OutputStreambuf);
+};
+
 struct RenderContext {
-    std::ostringstream os;
+    OutputStreambuf buf;
+    std::ostream os;
     const Msg& msg;
     const opt_t* opts;
     const std::string& file;
@@ -64,8 +97,15 @@ struct RenderContext {
     uint32_t ind;
     bool oneline_mode;
 
-    RenderContext(const Msg& msg, const std::string& file)
-        : os(), msg(msg), opts(nullptr), file(file), line(1), ind(0), oneline_mode(false) {}
+    RenderContext(const Msg& msg, const std::string& file, FILE* f)
+        : buf(f),
+          os(&buf),
+          msg(msg),
+          opts(nullptr),
+          file(file),
+          line(1),
+          ind(0),
+          oneline_mode(false) {}
     FORBID_COPY(RenderContext);
 };
 
@@ -143,6 +183,8 @@ struct Output {
     bool need_header;
     bool done_mtag_defs;
     std::set<std::string> skeletons;
+    std::vector<const char*> profile_keys; // names of profile counters (with `--profile-gen`)
+    std::unordered_map<std::string, uint64_t> profile; // profile counters (with `--profile-use`)
     Scratchbuf scratchbuf;
     OutputBlock* current_block;
 
@@ -174,12 +216,16 @@ State* fallback_state_with_eof_rule(
         const Adfa& dfa, const opt_t* opts, const State* state, tcid_t* ptags);
 std::string bitmap_name(const opt_t* opts, const std::string& cond);
 CodeList* gen_bitmap(Output& output, const CodeBitmap* bitmap, const std::string& cond);
+CodeList* gen_tables(Output& output, const CodeTable* table);
+std::string class_table_name(const std::string& cond);
+CodeList* gen_class_table(Output& output, const Adfa& dfa);
 void gen_tags(Scratchbuf& buf, const opt_t* opts, Code* code, const tagnames_t& tags);
 CodeList* gen_goto_after_fill(
         Output& output, const Adfa& dfa, const State* from, const CodeJump* jump);
 void gen_dfa_as_blocks_with_labels(Output& output, const Adfa& dfa, CodeList* stmts);
 void gen_dfa_as_switch_cases(Output& output, Adfa& dfa, CodeCases* cases);
-void wrap_dfas_in_loop_switch(Output& output, CodeList* stmts, CodeCases* cases);
+void wrap_dfas_in_loop_switch(
+        Output& output, CodeList* stmts, CodeCases* cases, const CodeTable* table);
 void expand_fintags(Output& output, const Tag& tag, std::vector<const char*>& fintags);
 std::string vartag_name(tagver_t ver, const std::string& prefix, bool is_mtag);
 std::string vartag_expr(tagver_t ver, const opt_t* opts, bool is_mtag);
@@ -1,5 +1,14 @@
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "src/adfa/adfa.h"
 #include "src/codegen/output.h"
@@ -63,11 +72,71 @@ static CodeGoIf* code_goif(OutAllocator& alc,
                            CodeGoIf::Kind kind,
                            const Span* sp,
                            uint32_t nsp,
+                           const uint64_t* freq,
                            State* next,
                            bool skip,
                            uint32_t eof,
                            const opt_t* opts);
 
+// Total execution count of the given spans (zero if there is no profile or character weights).
+static uint64_t span_freq(const uint64_t* freq, uint32_t nsp) {
+    uint64_t w = 0;
+    if (freq) {
+        for (uint32_t i = 0; i < nsp; ++i) w += freq[i];
+    }
+    return w;
+}
+
+// Hint the branch probability of a condition that holds `w` times out of `total`. Span counts are
+// only estimates (see note [profile-guided optimizations]), but a zero estimate is exact (and a zero
+// character weight says that the code units never occur). So a hint is given only if the condition
+// was always true or always false in the profile.
+static void hint_cmp(CodeCmp* cmp, uint64_t w, uint64_t total) {
+    if (total == 0) {
+        return;
+    } else if (w == total) {
+        cmp->hint = CodeCmp::Hint::LIKELY;
+    } else if (w == 0) {
+        cmp->hint = CodeCmp::Hint::UNLIKELY;
+    }
+}
+
+// Destination state of the transitions that take at least three quarters of the total execution
+// count, if there is such a state.
+static const State* dominant_state(const Span* sp, uint32_t nsp, const uint64_t* freq) {
+    const uint64_t total = span_freq(freq, nsp);
+    if (total == 0) return nullptr;
+
+    for (uint32_t i = 0; i < nsp; ++i) {
+        uint64_t w = 0;
+        for (uint32_t j = i; j < nsp; ++j) {
+            if (sp[j].to == sp[i].to) w += freq[j];
+        }
+        if (w >= total - total / 4) return sp[i].to;
+    }
+    return nullptr;
+}
+
+// Split point for a binary if-tree that balances the execution counts of both halves. Of the
+// equally balanced split points it chooses the one with fewer spans in the heavier half, so that a
+// hot span is separated from others in as few comparisons as possible.
+static uint32_t weighted_split(const uint64_t* freq, uint32_t nsp, uint64_t total) {
+    uint32_t split = nsp / 2, size = nsp;
+    uint64_t diff = total, left = 0;
+    for (uint32_t l = 1; l < nsp; ++l) {
+        left += freq[l - 1];
+        const uint64_t right = total - left;
+        const uint64_t d = left > right ? left - right : right - left;
+        const uint32_t n = left >= right ? l : nsp - l;
+        if (d < diff || (d == diff && n < size)) {
+            split = l;
+            diff = d;
+            size = n;
+        }
+    }
+    return split;
+}
+
 static bool is_eof(uint32_t eof, uint32_t ub) {
     return eof != NOEOF && eof + 1 == ub;
 }
@@ -122,6 +191,7 @@ static CodeGoSw* code_gosw(
 
     DCHECK(static_cast<uint32_t>(ranges_end - ranges) == 2 * span_count);
     go->ncases = static_cast<uint32_t>(cases - go->cases);
+    go->classes = false;
 
     // find default case
     DCHECK(span_count > 0);
@@ -136,22 +206,113 @@ static CodeGoSw* code_gosw(
     return go;
 }
 
+// note [class switch]
+//
+// With `--class-switch` option a switch on the current character is replaced with a switch on its
+// equivalence class. Two code units are in the same class if no state of the DFA distinguishes
+// between them, so each range of code units in the switch maps to a (usually much shorter) range of
+// classes. Classes are numbered densely from zero in the order of code units, so a state switch has
+// a few consecutive case values that the compiler can turn into a jump table (instead of a tree of
+// comparisons on character ranges). This matters most for the loop/switch code model, where all
+// dispatch goes through switch statements.
+//
+// Each DFA has its own table `yycc` (or `yycc_<cond>` with conditions) that maps code units to
+// classes; the table is generated only if some state uses it. Class switch is used only for 1-byte
+// code units, so there are at most 256 classes and the table has the same element type as bitmaps.
+// The table is indexed with the current character converted to an unsigned type by the
+// `code:char_index` template, as the code unit type may be signed (e.g. `char` in C).
+
+static void class_table(OutAllocator& alc, Adfa& dfa, const opt_t* opts) {
+    if (opts->target == Target::DOT || dfa.upper_char > 0x100) return;
+
+    // Split code units into classes by the boundaries of all transitions in the DFA.
+    bool bound[0x101] = {};
+    for (const State* s = dfa.head; s; s = s->next) {
+        for (uint32_t i = 0; i < s->go.span_count; ++i) {
+            bound[std::min(s->go.span[i].ub, 0x100u)] = true;
+        }
+    }
+
+    CodeClasses* x = alc.alloct<CodeClasses>(1);
+    x->classes = alc.alloct<uint32_t>(0x100);
+    x->nclasses = 0;
+    for (uint32_t c = 0; c < 0x100; ++c) {
+        if (c == 0 || bound[c]) ++x->nclasses;
+        x->classes[c] = x->nclasses - 1;
+    }
+    x->used = false;
+    dfa.classes = x;
+}
+
+// Map ranges of code units in the switch cases to ranges of classes, see note [class switch].
+static void class_switch(OutAllocator& alc, CodeGoSw* go, CodeClasses* classes) {
+    const uint32_t* cls = classes->classes;
+    for (CodeGoCase* c = go->cases, *e = c + go->ncases; c < e; ++c) {
+        const CodeRanges* r = c->ranges;
+        int64_t* ranges = alc.alloct<int64_t>(r->size * 2);
+        for (uint32_t i = 0; i < r->size; ++i) {
+            ranges[2 * i] = cls[r->elems[2 * i]];
+            ranges[2 * i + 1] = cls[r->elems[2 * i + 1] - 1] + 1;
+        }
+        c->ranges = code_ranges(alc, VarType::UINT, ranges, ranges + r->size * 2);
+    }
+    go->classes = true;
+    classes->used = true;
+}
+
+// Split point for a binary if-tree that minimizes the expected number of comparisons, that is the
+// sum of span counts multiplied by their depth in the tree (an optimal alphabetic tree). Of the
+// optimal trees it chooses one with the minimal sum of depths, so that spans with zero counts are
+// balanced. The dynamic programming algorithm is cubic in the number of spans.
+static uint32_t optimal_split(const uint64_t* freq, uint32_t nsp) {
+    // (weighted depth, depth) of an optimal tree for spans [i, j)
+    using cost_t = std::pair<uint64_t, uint64_t>;
+    std::vector<cost_t> cost((nsp + 1) * (nsp + 1), cost_t(0, 0));
+    auto at = [&](uint32_t i, uint32_t j) -> cost_t& { return cost[i * (nsp + 1) + j]; };
+
+    std::vector<uint64_t> sum(nsp + 1, 0);
+    for (uint32_t i = 0; i < nsp; ++i) sum[i + 1] = sum[i] + freq[i];
+
+    uint32_t split = nsp / 2;
+    for (uint32_t len = 2; len <= nsp; ++len) {
+        for (uint32_t i = 0, j = len; j <= nsp; ++i, ++j) {
+            cost_t best(UINT64_MAX, UINT64_MAX);
+            for (uint32_t k = i + 1; k < j; ++k) {
+                const cost_t c(at(i, k).first + at(k, j).first, at(i, k).second + at(k, j).second);
+                if (c < best) {
+                    best = c;
+                    if (len == nsp) split = k;
+                }
+            }
+            at(i, j) = cost_t(best.first + sum[j] - sum[i], best.second + len);
+        }
+    }
+    return split;
+}
+
 static CodeGoIfB* code_goifb(OutAllocator& alc,
                              const Span* s,
                              uint32_t n,
+                             const uint64_t* freq,
                              State* next,
                              bool skip,
                              uint32_t eof,
                              const opt_t* opts) {
-    const uint32_t l = n / 2;
+    const uint64_t total = span_freq(freq, n);
+    const uint32_t l = total == 0 ? n / 2
+            : n <= 64 ? optimal_split(freq, n) : weighted_split(freq, n, total);
     const uint32_t h = n - l;
+    const uint64_t* lfreq = freq;
+    const uint64_t* hfreq = freq ? freq + l : nullptr;
     CodeGoIf::Kind tkind = l > 4 ? CodeGoIf::Kind::BINARY : CodeGoIf::Kind::LINEAR;
     CodeGoIf::Kind ekind = h > 4 ? CodeGoIf::Kind::BINARY : CodeGoIf::Kind::LINEAR;
 
     CodeGoIfB* x = alc.alloct<CodeGoIfB>(1);
-    x->cond = code_cmp(alc, "<=", s[l - 1].ub - 1);
-    x->gothen = code_goif(alc, tkind, &s[0], l, next, skip, eof, opts);
-    x->goelse = code_goif(alc, ekind, &s[l], h, next, skip, eof, opts);
+    CodeCmp* cmp = code_cmp(alc, "<=", s[l - 1].ub - 1);
+    hint_cmp(cmp, span_freq(lfreq, l), total);
+    x->cond = cmp;
+    x->gothen = code_goif(alc, tkind, &s[0], l, lfreq, next, skip, eof, opts);
+    x->goelse = code_goif(alc, ekind, &s[l], h, hfreq, next, skip, eof, opts);
     return x;
 }
 
@@ -181,6 +342,7 @@ static void add_branch(CodeGoIfL* go,
 static CodeGoIfL* code_goifl(OutAllocator& alc,
                              const Span* s,
                              uint32_t n,
+                             const uint64_t* freq,
                              State* next,
                              bool skip,
                              uint32_t eof,
@@ -195,6 +357,11 @@ static CodeGoIfL* code_goifl(OutAllocator& alc,
     // (in functional languages it is an expression and early returns are not possible).
     bool may_elide = opts->code_model != CodeModel::REC_FUNC || n == 1;
 
+    // Execution counts for branch hints: `rest` is the count of the remaining spans, and `low` is
+    // the count of the spans below `s[0]` that have already been merged with it.
+    uint64_t rest = span_freq(freq, n), low = 0;
+    auto f = [&](uint32_t i) { return freq ? freq[i] + (i == 0 ? low : 0) : 0; };
+
     for (;;) {
         if (n == 1 && s[0].to == next && may_elide) {
             add_branch(x, nullptr, nullptr, next, s[0], skip, eof, opts);
@@ -204,6 +371,7 @@ static CodeGoIfL* code_goifl(OutAllocator& alc,
             break;
         } else if (n == 2 && s[0].to == next && may_elide) {
             CodeCmp* cmp = code_cmp(alc, ">=", s[0].ub);
+            hint_cmp(cmp, f(1), rest);
             add_branch(x, cmp, s[1].to, next, s[1], skip, eof, opts);
             add_branch(x, nullptr, nullptr, next, s[0], skip, eof, opts);
             break;
@@ -214,6 +382,7 @@ static CodeGoIfL* code_goifl(OutAllocator& alc,
                 && s[2].tags == s[0].tags
                 && may_elide) {
             CodeCmp* cmp = code_cmp(alc, "!=", s[0].ub);
+            hint_cmp(cmp, f(0) + f(2), rest);
             add_branch(x, cmp, s[0].to, next, s[0], skip, eof, opts);
             add_branch(x, nullptr, nullptr, next, s[1], skip, eof, opts);
             break;
@@ -222,14 +391,22 @@ static CodeGoIfL* code_goifl(OutAllocator& alc,
                 && s[2].to == s[0].to
                 && s[2].tags == s[0].tags) {
             CodeCmp* cmp = code_cmp(alc, "==", s[0].ub);
+            hint_cmp(cmp, f(1), rest);
             add_branch(x, cmp, s[1].to, next, s[1], skip, eof, opts);
+            rest -= f(1);
+            low = f(0);
             n -= 2;
             s += 2;
+            if (freq) freq += 2;
         } else {
             CodeCmp* cmp = code_cmp(alc, "<=", s[0].ub - 1);
+            hint_cmp(cmp, f(0), rest);
             add_branch(x, cmp, s[0].to, next, s[0], skip, eof, opts);
+            rest -= f(0);
+            low = 0;
             n -= 1;
             s += 1;
+            if (freq) freq += 1;
         }
     }
 
@@ -240,6 +417,7 @@ static CodeGoIf* code_goif(OutAllocator& alc,
                            CodeGoIf::Kind kind,
                            const Span* sp,
                            uint32_t nsp,
+                           const uint64_t* freq,
                            State* next,
                            bool skip,
                            uint32_t eof,
@@ -247,9 +425,9 @@ static CodeGoIf* code_goif(OutAllocator& alc,
     CodeGoIf* x = alc.alloct<CodeGoIf>(1);
     x->kind = kind;
     if (kind == CodeGoIf::Kind::BINARY) {
-        x->goifb = code_goifb(alc, sp, nsp, next, skip, eof, opts);
+        x->goifb = code_goifb(alc, sp, nsp, freq, next, skip, eof, opts);
     } else {
-        x->goifl = code_goifl(alc, sp, nsp, next, skip, eof, opts);
+        x->goifl = code_goifl(alc, sp, nsp, freq, next, skip, eof, opts);
     }
     return x;
 }
@@ -257,21 +435,29 @@ static CodeGoIf* code_goif(OutAllocator& alc,
 static CodeGoSwIf* code_goswif(OutAllocator& alc, 
                                const Span* sp,
                                uint32_t nsp,
+                               const uint64_t* freq,
+                               bool hot,
                                State* next,
                                bool skip,
                                uint32_t eof,
                                const opt_t* opts) {
     CodeGoSwIf* x = alc.alloct<CodeGoSwIf>(1);
-    if ((!opts->nested_ifs && nsp > 2)
+    if (hot) {
+        // One destination takes most of the executions: a weighted if-tree reaches it in a few
+        // well-predicted comparisons, while a switch is an indirect jump.
+        x->kind = CodeGoSwIf::Kind::IF;
+        const CodeGoIf::Kind kind = nsp > 4 ? CodeGoIf::Kind::BINARY : CodeGoIf::Kind::LINEAR;
+        x->goif = code_goif(alc, kind, sp, nsp, freq, next, skip, eof, opts);
+    } else if ((!opts->nested_ifs && nsp > 2)
             || (nsp > 8 && (sp[nsp - 2].ub - sp[0].ub <= 3 * (nsp - 2)))) {
         x->kind = CodeGoSwIf::Kind::SWITCH;
         x->gosw = code_gosw(alc, sp, nsp, skip, eof);
     } else if (nsp > 5) {
         x->kind = CodeGoSwIf::Kind::IF;
-        x->goif = code_goif(alc, CodeGoIf::Kind::BINARY, sp, nsp, next, skip, eof, opts);
+        x->goif = code_goif(alc, CodeGoIf::Kind::BINARY, sp, nsp, freq, next, skip, eof, opts);
     } else {
         x->kind = CodeGoSwIf::Kind::IF;
-        x->goif = code_goif(alc, CodeGoIf::Kind::LINEAR, sp, nsp, next, skip, eof, opts);
+        x->goif = code_goif(alc, CodeGoIf::Kind::LINEAR, sp, nsp, freq, next, skip, eof, opts);
     }
     return x;
 }
@@ -318,11 +504,12 @@ static CodeGoBm* code_gobm(OutAllocator& alc,
     Span* bspan = allocate<Span>(span_count); // temporary
     uint32_t bspan_count = unmap (bspan, span, span_count, bm->state);
     x->lgo = bspan_count == 0 ? nullptr
-            : code_goswif(alc, bspan, bspan_count, next, false, eof, opts);
+            : code_goswif(alc, bspan, bspan_count, nullptr, false, next, false, eof, opts);
     // If there are any low spans, then next state for high spans must be NULL to trigger explicit
     // goto generation in linear `if`.
     x->hgo = hspan_count == 0 ? nullptr
-            : code_goswif(alc, hspan, hspan_count, x->lgo ? nullptr : next, false, eof, opts);
+            : code_goswif(alc, hspan, hspan_count, nullptr, false, x->lgo ? nullptr : next, false,
+                    eof, opts);
     x->bitmap->state->label->used = true;
     operator delete(bspan);
 
@@ -355,7 +542,7 @@ static CodeGoCp* code_gocp(OutAllocator& alc,
                            const opt_t* opts) {
     CodeGoCp* x = alc.alloct<CodeGoCp>(1);
     x->hgo = hspan_count == 0 ? nullptr
-            : code_goswif(alc, hspan, hspan_count, next, false, eof, opts);
+            : code_goswif(alc, hspan, hspan_count, nullptr, false, next, false, eof, opts);
     x->table = code_gocp_table(alc, span, span_count);
     return x;
 }
@@ -396,6 +583,9 @@ static void code_go(OutAllocator& alc, const Adfa& dfa, const opt_t* opts, State
     CodeGo* go = &from->go;
     Span* span = go->span;
 
+    // A head of the fast path may go to the slow path (see note [fast path]).
+    if (from->slow_path) from->slow_path->label->used = true;
+
     if (go->span_count == 0) return;
 
     // With end-of-input rule $, mark states that are targets of fallback transitions as used.
@@ -450,24 +640,37 @@ static void code_go(OutAllocator& alc, const Adfa& dfa, const opt_t* opts, State
     const uint32_t dspan_count = go->span_count - hspan_count - bitmap_count;
     const bool part_skip = opts->eager_skip && !go->skip;
 
+    // With a profile, a state that mostly goes to one destination uses weighted if-trees rather
+    // than computed gotos or a bitmap (unless the bitmap checks the hot destination).
+    const State* hot = dominant_state(go->span, go->span_count, go->freq);
+
     if (opts->target == Target::DOT) {
         go->kind = CodeGo::Kind::DOT;
         go->godot = code_gosw(alc, go->span, go->span_count, false, eof);
     } else if (opts->computed_gotos
                && !part_skip
+               && !go->prof
+               && !hot
                && dspan_count >= opts->computed_gotos_threshold
                && !low_spans_have_tags) {
         go->kind = CodeGo::Kind::CPGOTO;
         go->gocp = code_gocp(
                 alc, go->span, go->span_count, hspan, hspan_count, from->next, eof, opts);
-    } else if (opts->bitmaps && !part_skip && bitmap_count > 0) {
+    } else if (opts->bitmaps
+               && !part_skip
+               && bitmap_count > 0
+               && (!hot || hot == bm->state)) {
         go->kind = CodeGo::Kind::BITMAP;
         go->gobm = code_gobm(
                 alc, go->span, go->span_count, hspan, hspan_count, bm, from->next, eof, opts);
         dfa.bitmap->used = true;
     } else {
         go->kind = CodeGo::Kind::SWITCH_IF;
-        go->goswif = code_goswif(alc, go->span, go->span_count, from->next, part_skip, eof, opts);
+        go->goswif = code_goswif(alc, go->span, go->span_count, go->freq ? go->freq : go->weight,
+                hot != nullptr, from->next, part_skip, eof, opts);
+        if (dfa.classes && go->goswif->kind == CodeGoSwIf::Kind::SWITCH) {
+            class_switch(alc, go->goswif->gosw, dfa.classes);
+        }
     }
 }
 
@@ -477,6 +680,12 @@ void init_go(CodeGo* go) {
     go->span = nullptr;
     go->tags = TCID0;
     go->skip = false;
+    go->chain = nullptr;
+    go->loop = nullptr;
+    go->table = nullptr;
+    go->prof = nullptr;
+    go->freq = nullptr;
+    go->weight = nullptr;
 }
 
 bool consume(const State* s) {
@@ -494,6 +703,622 @@ bool consume(const State* s) {
     return true;
 }
 
+// note [collapsed chains]
+//
+// With `--collapse-chains` option re2c looks for chains of transitions on single characters, such
+// as the ones that match keywords (`r-e-t-u-r-n`), and adds a fast path to the first state of each
+// chain: the next few characters are combined into one integer with shifts and compared with the
+// whole chain at once. On success the cursor is moved to the last character of the chain and the
+// lexer jumps to the state at the end of the chain; otherwise it falls back to the usual dispatch
+// on the current character. This is the "multibyte switch" idea from IDEAS.md limited to one
+// comparison per state. Chains are at most 8 characters long, so that the combined value fits
+// into a 64-bit integer. C compilers merge the byte loads and shifts into a single 2-, 4- or
+// 8-byte load where the target allows unaligned access.
+//
+// A state is a link in a chain if it has exactly one transition on a single character to a state
+// which it does not go to on any other character. Intermediate states of a chain must have no
+// effect other than skipping and peeking the current character: no YYFILL, tags, backups, or
+// debug output. Then the fast path is equivalent to going through the chain state by state.
+//
+// Bounds are ensured by the existing YYFILL checks: the characters that the fast path reads are
+// exactly the ones that the first and the intermediate states would peek, and the intermediate
+// states have no YYFILL check, so the last check before the chain covers all of them. This only
+// holds for the classic YYFILL scheme with YYMAXFILL padding, so chains are collapsed only if
+// YYFILL is enabled and the end-of-input rule is not used. The fast path indexes the cursor, so it
+// needs the default API and 1-byte code units.
+//
+// A chain does not start in a state that continues some other chain, otherwise a failed fast path
+// in the first state would be repeated in every following state. Chains that are longer than the
+// limit are split into several consecutive parts.
+
+static constexpr uint32_t MAX_CHAIN_LENGTH = 8;
+
+// If state `s` has exactly one transition on a single character to a state that it does not go to
+// on other characters, returns the destination state and stores the character in `pc`.
+static State* chain_link(const State* s, uint32_t* pc) {
+    const CodeGo& go = s->go;
+    if (go.tags != TCID0 || go.skip) return nullptr;
+
+    const Span* link = nullptr;
+    for (uint32_t i = 0, lb = 0; i < go.span_count; lb = go.span[i++].ub) {
+        const Span& x = go.span[i];
+        if (x.ub - lb != 1) continue;
+
+        bool unique = true;
+        for (uint32_t j = 0; j < go.span_count && unique; ++j) {
+            unique = j == i || go.span[j].to != x.to;
+        }
+        if (!unique) continue;
+
+        if (link != nullptr) return nullptr; // the chain branches here
+        link = &x;
+        *pc = lb;
+    }
+    return link != nullptr && link->tags == TCID0 ? link->to : nullptr;
+}
+
+// Intermediate state of a chain that can be skipped by the fast path.
+static bool chain_inner(const State* s) {
+    uint32_t c;
+    return s->action.kind == Action::Kind::MATCH && s->fill == 0 && chain_link(s, &c) != nullptr;
+}
+
+static void collapse_chains(OutAllocator& alc, const Adfa& dfa, const opt_t* opts) {
+    if (opts->target != Target::CODE
+            || opts->api != Api::DEFAULT
+            || !opts->fill_enable
+            || opts->fill_eof != NOEOF
+            || opts->debug
+            || opts->profile_gen
+            || dfa.upper_char > 0x100) {
+        return;
+    }
+
+    // Find states that continue some chain.
+    std::unordered_set<const State*> inner;
+    uint32_t c;
+    for (State* s = dfa.head; s; s = s->next) {
+        State* x = consume(s) ? chain_link(s, &c) : nullptr;
+        if (x && chain_inner(x)) inner.insert(x);
+    }
+
+    uint32_t chars[MAX_CHAIN_LENGTH];
+    for (State* s = dfa.head; s; s = s->next) {
+        if (!consume(s) || inner.find(s) != inner.end()) continue;
+
+        for (State* h = s; h && !h->go.chain;) {
+            State* x = chain_link(h, &chars[0]);
+            uint32_t n = 1;
+            for (; x && n < MAX_CHAIN_LENGTH && chain_inner(x); ++n) {
+                x = chain_link(x, &chars[n]);
+            }
+            if (n < 2) break;
+
+            CodeGoChain* chain = alc.alloct<CodeGoChain>(1);
+            uint32_t* cs = alc.alloct<uint32_t>(n);
+            memcpy(cs, chars, n * sizeof(uint32_t));
+            chain->length = n;
+            chain->chars = cs;
+            chain->to = x;
+            h->go.chain = chain;
+            x->label->used = true;
+
+            // Continue a long chain with the next part.
+            h = n == MAX_CHAIN_LENGTH && chain_inner(x) ? x : nullptr;
+        }
+    }
+}
+
+// note [SIMD loops]
+//
+// With `--simd-loops` option states that loop to themselves on a class of characters (identifier
+// tails, whitespace, string literal bodies, comments) get a vectorized loop that skips the longest
+// run of such characters before the usual dispatch. The loop loads 16 bytes at a time (32 with
+// AVX2), tests all of them against the class with a few vector comparisons, and finds the first
+// character that exits the loop with a count-trailing-zeros on the movemask of the result (on
+// targets other than x86 the mask is scanned in 64-bit words). The dispatch then continues on that
+// character as if the state has gone through its self-loop the same number of times. The code uses
+// GCC vector extensions, which are supported by GCC and Clang: they are compiled to SSE2/AVX2 or
+// NEON instructions, or to SWAR operations on 64-bit words on targets without SIMD. For other
+// compilers the loop is disabled with the preprocessor.
+//
+// Skipping a self-loop is equivalent to going through it only if the state has no effect other
+// than skipping and peeking the current character, so the state must not have tags, backups or
+// debug output. The loop must not read past YYLIMIT, so it is generated only if YYLIMIT is used
+// (either with YYFILL checks or with the end-of-input rule). Each block read by the loop must end
+// before YYLIMIT, and with YYFILL the block must also leave as many characters as the YYFILL check
+// in the state requires, so that the state invariant holds after the loop. With the end-of-input
+// rule the sentinel character always exits the loop, so that it is handled by the usual code.
+//
+// The character class is represented by at most a few ranges. Either the loop class or its
+// complement (the exit class) is used, whichever has fewer ranges.
+
+static void simd_loops(OutAllocator& alc, const Adfa& dfa, const opt_t* opts) {
+    SimdClass cls;
+    for (State* s = dfa.head; s; s = s->next) {
+        if (!simd_loop(opts, dfa, s, cls)) continue;
+
+        CodeGoLoop* x = alc.alloct<CodeGoLoop>(1);
+        uint32_t* bounds = alc.alloct<uint32_t>(2 * cls.nranges);
+        memcpy(bounds, cls.lower, cls.nranges * sizeof(uint32_t));
+        memcpy(bounds + cls.nranges, cls.upper, cls.nranges * sizeof(uint32_t));
+        x->nranges = cls.nranges;
+        x->lower = bounds;
+        x->upper = bounds + cls.nranges;
+        x->exit = cls.exit;
+        x->need = opts->fill_eof == NOEOF ? s->fill : 0;
+        s->go.loop = x;
+    }
+}
+
+// note [table-driven code]
+//
+// With `--table-driven` option (which requires loop/switch code model) states that dispatch on the
+// current character look up the next state in a transition table instead of matching the character
+// in nested switch and if statements. The size of the generated code is then proportional to the
+// number of states rather than the number of transitions, which matters for very large lexers
+// (e.g. with hundreds of keywords or large Unicode classes) that take a long time to compile and
+// put a lot of pressure on the instruction cache.
+//
+// Code units are split into equivalence classes: two code units are in the same class if no table
+// state in the block distinguishes between them. Table `yyclass` maps code units to classes, and
+// table `yytrans` has a row of entries for each distinct set of transitions (states with identical
+// transitions share one row). Each entry is the next state number shifted left by one, with the
+// low bit set if the transition skips the current character. A state dispatches with a lookup in
+// its row `yytrans[<row> + yyclass[yych]]`.
+//
+// States that have no code of their own besides the peek and the dispatch (move states and match
+// states without YYFILL checks) are not generated as switch cases at all: they are run by the
+// default case of the switch, which finds the row of a state in table `yybase`. With the
+// end-of-input rule the default case also handles YYFILL, and it finds the fallback state in table
+// `yyfallback`. Transitions that have tag operations go to separate switch cases that perform the
+// operations and continue to the destination state.
+//
+// Table-driven code is generated only for 1-byte code units and without debug output. The other
+// states (final states, states that save the backup position or dispatch on `yyaccept`, states
+// with collapsed chains or SIMD loops) are generated in the usual way. So this is a partial table
+// mode: only the transitions are in tables, and there are no tables for rule actions or tag
+// commands, which would need an interpreter for the code that re2c now emits as is. With `--skeleton` each DFA
+// has its own tables, as it is a separate lexer.
+
+static bool table_kind(const State* s) {
+    switch (s->action.kind) {
+    case Action::Kind::MATCH:
+    case Action::Kind::SAVE:
+    case Action::Kind::MOVE:
+        return !s->go.chain && !s->go.loop;
+    default:
+        return false;
+    }
+}
+
+static void table_dispatch(OutAllocator& alc, const Adfa& dfa, const opt_t* opts) {
+    if (opts->target == Target::DOT
+            || opts->debug
+            || opts->profile_gen
+            || dfa.upper_char > 0x100) {
+        return;
+    }
+
+    for (State* s = dfa.head; s; s = s->next) {
+        if (!table_kind(s) || s->go.span_count < 2) continue;
+        CodeGoTable* x = alc.alloct<CodeGoTable>(1);
+        x->span_count = s->go.span_count;
+        x->span = s->go.span;
+        x->base = 0;
+        x->eof = opts->fill_eof != NOEOF;
+        x->shared = false;
+        s->go.table = x;
+    }
+
+    // After tunneling (see note [tag hoisting, skip hoisting and tunneling]) a match state often
+    // peeks the character and goes on to a move state that dispatches on it: such a match state
+    // can dispatch on the transitions of the move state directly.
+    for (State* s = dfa.head; s; s = s->next) {
+        const CodeGo& go = s->go;
+        if (!table_kind(s) || go.span_count != 1 || go.span[0].tags != TCID0) continue;
+        const State* m = go.span[0].to;
+        if (m->action.kind != Action::Kind::MOVE || !m->go.table || m->go.tags != TCID0
+                || m->go.skip) {
+            continue;
+        }
+        CodeGoTable* x = alc.alloct<CodeGoTable>(1);
+        *x = *m->go.table;
+        s->go.table = x;
+    }
+
+    // Mark transition targets as used, as well as fallback states and YYFILL states (they are
+    // needed for the end-of-input rule). All of them must have their own cases in the switch.
+    for (State* s = dfa.head; s; s = s->next) {
+        const CodeGoTable* x = s->go.table;
+        if (!x) continue;
+        for (uint32_t i = 0; i < x->span_count; ++i) {
+            x->span[i].to->label->used = true;
+        }
+        if (x->eof) {
+            State* f = fallback_state_with_eof_rule(dfa, opts, s, nullptr);
+            if (f) f->label->used = true;
+            if (opts->fill_enable && s->fill_state) s->fill_state->label->used = true;
+        }
+    }
+}
+
+using table_jumps_t = std::map<std::tuple<const Adfa*, const State*, tcid_t, bool>, uint32_t>;
+
+// Find or add a switch case for a tagged transition in table-driven code.
+static uint32_t table_jump(uint32_t& counter,
+                           table_jumps_t& idx,
+                           std::vector<CodeTableJump>& jumps,
+                           const Adfa& dfa,
+                           const State* to,
+                           tcid_t tags,
+                           bool skip) {
+    const auto key = std::make_tuple(&dfa, to, tags, skip);
+    auto i = idx.find(key);
+    if (i != idx.end()) return i->second;
+
+    CodeTableJump j;
+    j.dfa = &dfa;
+    j.jump = {to, tags, skip, /*eof*/ false, /*elide*/ false};
+    j.index = counter++;
+    jumps.push_back(j);
+    idx.insert({key, j.index});
+    return j.index;
+}
+
+// Build tables for the given DFAs. New switch cases for tagged transitions are numbered from the
+// given counter.
+static void table_build(
+        Output& output, Adfas::const_iterator first, Adfas::const_iterator last, uint32_t& counter) {
+    OutAllocator& alc = output.allocator;
+    const opt_t* opts = output.block().opts;
+
+    // Split code units into equivalence classes by the boundaries of all table transitions.
+    bool bound[0x101] = {};
+    bool found = false;
+    for (Adfas::const_iterator i = first; i != last; ++i) {
+        const std::unique_ptr<Adfa>& dfa = *i;
+        for (const State* s = dfa->head; s; s = s->next) {
+            const CodeGoTable* x = s->go.table;
+            if (!x) continue;
+            for (uint32_t j = 0; j < x->span_count; ++j) {
+                bound[std::min(x->span[j].ub, 0x100u)] = true;
+            }
+            found = true;
+        }
+    }
+    if (!found) return;
+
+    CodeTable* t = alc.alloct<CodeTable>(1);
+    t->classes = alc.alloct<uint32_t>(0x100);
+    uint32_t lower[0x100];
+    t->nclasses = 0;
+    for (uint32_t c = 0; c < 0x100; ++c) {
+        if (c == 0 || bound[c]) lower[t->nclasses++] = c;
+        t->classes[c] = t->nclasses - 1;
+    }
+
+    // Build rows of the transition table, sharing identical rows between states.
+    table_jumps_t jidx;
+    std::vector<CodeTableJump> jumps;
+    std::map<std::vector<uint32_t>, uint32_t> rows;
+    std::vector<uint32_t> trans, row(t->nclasses);
+    for (Adfas::const_iterator i = first; i != last; ++i) {
+        const std::unique_ptr<Adfa>& dfa = *i;
+        for (const State* s = dfa->head; s; s = s->next) {
+            CodeGoTable* x = s->go.table;
+            if (!x) continue;
+            const Span* sp = x->span;
+            for (uint32_t k = 0; k < t->nclasses; ++k) {
+                while (sp->ub <= lower[k]) ++sp;
+                const State* to = sp->to;
+                // If skip is hoisted out of transitions into the state, it is done before lookup.
+                const bool skip = consume(to) && !s->go.skip;
+                row[k] = sp->tags == TCID0
+                        ? to->label->index << 1 | (skip ? 1 : 0)
+                        : table_jump(counter, jidx, jumps, *dfa, to, sp->tags, skip) << 1;
+            }
+            auto r = rows.insert({row, static_cast<uint32_t>(trans.size())});
+            if (r.second) trans.insert(trans.end(), row.begin(), row.end());
+            x->base = r.first->second;
+        }
+    }
+    t->ntrans = trans.size();
+    t->trans = alc.alloct<uint32_t>(t->ntrans);
+    memcpy(t->trans, trans.data(), t->ntrans * sizeof(uint32_t));
+
+    // Find states that can be run by the shared default case (those that have no hoisted skip and
+    // tag operations). The first state of each DFA keeps its case, as it is the entry point for the
+    // condition. With the end-of-input rule and storable state YYFILL must return from the lexer
+    // with the state index, so it needs a case.
+    std::vector<std::pair<const Adfa*, State*>> shared;
+    t->nstates = 0;
+    for (Adfas::const_iterator i = first; i != last; ++i) {
+        const std::unique_ptr<Adfa>& dfa = *i;
+        for (State* s = dfa->head; s; s = s->next) {
+            CodeGoTable* x = s->go.table;
+            if (!x
+                    || s == dfa->head
+                    || !s->label->used
+                    || s->go.skip
+                    || s->go.tags != TCID0
+                    || (x->eof && opts->storable_state)) {
+                continue;
+            }
+            if (s->action.kind == Action::Kind::MOVE
+                    || (s->action.kind == Action::Kind::MATCH
+                            && !(opts->fill_enable && opts->fill_eof == NOEOF && s->fill > 0))) {
+                x->shared = true;
+                shared.push_back({dfa.get(), s});
+                t->nstates = std::max(t->nstates, s->label->index + 1);
+            }
+        }
+    }
+    t->base = alc.alloct<uint32_t>(t->nstates);
+    memset(t->base, 0, t->nstates * sizeof(uint32_t));
+    t->fallback = nullptr;
+    if (opts->fill_eof != NOEOF) {
+        t->fallback = alc.alloct<uint32_t>(t->nstates);
+        memset(t->fallback, 0, t->nstates * sizeof(uint32_t));
+    }
+    for (const auto& p : shared) {
+        const State* s = p.second;
+        t->base[s->label->index] = s->go.table->base;
+        if (t->fallback) {
+            tcid_t falltags;
+            const State* f = fallback_state_with_eof_rule(*p.first, opts, s, &falltags);
+            t->fallback[s->label->index] = falltags == TCID0
+                    ? f->label->index
+                    : table_jump(counter, jidx, jumps, *p.first, f, falltags, false);
+        }
+    }
+
+    t->njumps = static_cast<uint32_t>(jumps.size());
+    t->jumps = alc.alloct<CodeTableJump>(t->njumps);
+    std::copy(jumps.begin(), jumps.end(), t->jumps);
+
+    for (Adfas::const_iterator i = first; i != last; ++i) {
+        (*i)->table = t;
+    }
+}
+
+// note [profiling]
+//
+// With `--profile-gen` option the generated lexer counts how many times each DFA state is entered,
+// each transition between two states is taken, each rule is matched, YYFILL is called, and the
+// lexer backtracks to the last accepting state. All counters are elements of one static array
+// `yyprof` shared by all lexers in the output file. The `profile:re2c` directive expands to the
+// array, the names of its elements and a function `yyprofdump(FILE*)` that writes non-zero counters
+// to a file, one per line, in the following format (here <dfa> is the name of the DFA that is made
+// of the block line and the condition name, <from> and <to> are state numbers and <rule> is a rule
+// number):
+//
+//     <dfa> state <state> <count>
+//     <dfa> trans <from> <to> <count>
+//     <dfa> rule <rule> <count>
+//     <dfa> fill <count>
+//     <dfa> backtrack <count>
+//
+// A state number is the position of the state in ADFA after `Adfa::prepare`, before codegen. It
+// does not depend on code layout, so that a profile can be mapped back to the DFA states when the
+// lexer is generated again with different options. Backtracking is counted in the state that
+// restores the cursor from YYMARKER and dispatches on `yyaccept`, and the state visit is counted
+// after its label, so that the initial state is counted once per lexer invocation.
+//
+// Optimizations that go through several states or transitions at once (collapsed chains, SIMD
+// loops, computed gotos and table-driven dispatch) are disabled, so that every step is counted.
+
+static void profile_counters(Output& output, Adfa& dfa) {
+    OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
+    std::vector<const char*>& keys = output.profile_keys;
+
+    CodeProfile* p = alc.alloct<CodeProfile>(1);
+    p->fill = static_cast<uint32_t>(keys.size());
+    keys.push_back(o.str(dfa.name).cstr(" fill").flush());
+    p->backtrack = static_cast<uint32_t>(keys.size());
+    keys.push_back(o.str(dfa.name).cstr(" backtrack").flush());
+    p->rules = static_cast<uint32_t>(keys.size());
+    for (size_t i = 0; i < dfa.rules.size(); ++i) {
+        keys.push_back(o.str(dfa.name).cstr(" rule ").u64(i).flush());
+    }
+    dfa.profile = p;
+
+    std::unordered_map<const State*, uint32_t> ids;
+    uint32_t id = 0;
+    for (const State* s = dfa.head; s; s = s->next) ids[s] = id++;
+
+    for (State* s = dfa.head; s; s = s->next) {
+        const CodeGo& go = s->go;
+        const uint32_t from = ids[s];
+
+        CodeGoProf* x = alc.alloct<CodeGoProf>(1);
+        x->visits = static_cast<uint32_t>(keys.size());
+        keys.push_back(o.str(dfa.name).cstr(" state ").u32(from).flush());
+
+        const State** to = alc.alloct<const State*>(go.span_count);
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < go.span_count; ++i) {
+            const State* t = go.span[i].to;
+            if (std::find(to, to + n, t) == to + n) to[n++] = t;
+        }
+        x->ntrans = n;
+        x->to = to;
+        x->trans = static_cast<uint32_t>(keys.size());
+        for (uint32_t i = 0; i < n; ++i) {
+            keys.push_back(o.str(dfa.name).cstr(" trans ").u32(from).cstr(" ").u32(ids[to[i]])
+                    .flush());
+        }
+        s->go.prof = x;
+    }
+}
+
+// note [profile-guided optimizations]
+//
+// With `--profile-use FILE` option re2c reads a profile written by a lexer generated with
+// `--profile-gen` (see note [profiling]) and optimizes the lexer for the profiled workload. The
+// lexer must be generated from the same source with the same options (except for the profiling
+// ones), otherwise state numbers in the profile do not match the DFA. A DFA that has no counts in
+// the profile is generated as usual.
+//
+// Transition counts are distributed between the spans that go to the same destination state in
+// proportion to their width, which gives an execution count for each span. The counts are used in
+// the following ways:
+//
+//   - In goto/label mode states are laid out so that each state is followed by its hottest
+//     successor that has not been placed yet, which turns the hottest transitions into
+//     fall-through (see `code_goifl`). If all successors are placed, layout continues with the
+//     hottest remaining state. States that are not visited in the profile go last in their
+//     usual order. The initial state stays first, and split states stay next to their move part.
+//
+//   - Binary if-trees are split so that both halves have equal counts rather than an equal number
+//     of spans, and the states where one destination takes most of the counts use weighted
+//     if-trees instead of a switch, computed gotos or a bitmap.
+//
+//   - Comparisons that are always true or always false in the profile are wrapped in the
+//     `code:cond_likely` and `code:cond_unlikely` templates from the syntax file (for C they
+//     expand to `__builtin_expect`, other languages do not define them and get plain
+//     comparisons). Only these are certain: a span count is an estimate, unless
+//     it is zero (estimates are rounded up, so they are zero only for the untaken transitions).
+
+static uint64_t span_width(const Span* span, uint32_t i) {
+    return span[i].ub - (i == 0 ? 0 : span[i - 1].ub);
+}
+
+static void profile_use(Output& output, Adfa& dfa, const opt_t* opts) {
+    OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
+
+    auto count = [&](const char* key) -> uint64_t {
+        auto i = output.profile.find(key);
+        return i == output.profile.end() ? 0 : i->second;
+    };
+
+    std::vector<State*> states;
+    std::unordered_map<const State*, uint32_t> ids;
+    for (State* s = dfa.head; s; s = s->next) {
+        ids[s] = static_cast<uint32_t>(states.size());
+        states.push_back(s);
+    }
+    const uint32_t nstates = static_cast<uint32_t>(states.size());
+
+    std::vector<uint64_t> visits(nstates);
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < nstates; ++i) {
+        visits[i] = count(o.str(dfa.name).cstr(" state ").u32(i).flush());
+        total += visits[i];
+    }
+    if (total == 0) return;
+
+    auto trans = [&](uint32_t from, const State* to) {
+        return count(o.str(dfa.name).cstr(" trans ").u32(from).cstr(" ").u32(ids[to]).flush());
+    };
+
+    for (uint32_t i = 0; i < nstates; ++i) {
+        CodeGo& go = states[i]->go;
+        if (visits[i] == 0 || go.span_count == 0) continue;
+
+        uint64_t* freq = alc.alloct<uint64_t>(go.span_count);
+        for (uint32_t j = 0; j < go.span_count; ++j) {
+            const State* to = go.span[j].to;
+            uint64_t width = 0;
+            for (uint32_t k = 0; k < go.span_count; ++k) {
+                if (go.span[k].to == to) width += span_width(go.span, k);
+            }
+            // Round up, so that the estimate is zero only if the transition is never taken.
+            const uint64_t c = trans(i, to);
+            freq[j] = static_cast<uint64_t>(std::ceil(static_cast<double>(c)
+                    * static_cast<double>(span_width(go.span, j)) / static_cast<double>(width)));
+        }
+        go.freq = freq;
+    }
+
+    if (opts->code_model != CodeModel::GOTO_LABEL) return;
+
+    // States in the order of decreasing visit counts (the order of cold states is preserved).
+    std::vector<uint32_t> hot(nstates);
+    for (uint32_t i = 0; i < nstates; ++i) hot[i] = i;
+    std::stable_sort(hot.begin(), hot.end(), [&](uint32_t x, uint32_t y) {
+        return visits[x] > visits[y];
+    });
+
+    // The move part of a split state is always placed right after it.
+    auto unit = [&](uint32_t i) { return i > 0 && states[i - 1]->is_base ? i - 1 : i; };
+
+    std::vector<bool> placed(nstates, false);
+    std::vector<State*> order;
+    order.reserve(nstates + 1);
+    auto place = [&](uint32_t i) {
+        placed[i] = true;
+        order.push_back(states[i]);
+        if (states[i]->is_base) {
+            placed[++i] = true;
+            order.push_back(states[i]);
+        }
+        return i;
+    };
+
+    auto h = hot.cbegin();
+    for (uint32_t last = place(0); order.size() < nstates;) {
+        // Find the hottest transition from the last placed state to a state that is not placed.
+        const CodeGo& go = states[last]->go;
+        uint32_t next = nstates;
+        uint64_t max = 0;
+        for (uint32_t j = 0; j < go.span_count; ++j) {
+            const uint32_t k = unit(ids[go.span[j].to]);
+            if (placed[k]) continue;
+            const uint64_t c = trans(last, go.span[j].to);
+            if (c > max) {
+                max = c;
+                next = k;
+            }
+        }
+        if (next == nstates) {
+            while (placed[unit(*h)]) ++h;
+            next = unit(*h);
+        }
+        last = place(next);
+    }
+
+    order.push_back(nullptr);
+    for (uint32_t i = 0; i < nstates; ++i) {
+        order[i]->next = order[i + 1];
+    }
+}
+
+// note [character weights]
+//
+// Configuration `re2c:char-weights` describes the expected distribution of code units in the input,
+// for example "0x61-0x7A:50, 0x20:20" means that each lowercase ASCII letter is 50 times and space
+// is 20 times more frequent than any other code unit (which has weight 1). The weight of a span is
+// the sum of weights of its code units. Binary if-trees are built so that they minimize the expected
+// number of comparisons (see `optimal_split`) rather than balanced by the number of spans, and the
+// comparisons with a zero-weight side get branch probability hints. Weights do not depend on the
+// state, so they do not change the choice between a switch and if-trees. A state that has counts
+// in the profile (see note [profile-guided optimizations]) ignores weights.
+
+static void char_weights(OutAllocator& alc, Adfa& dfa, const opt_t* opts) {
+    std::vector<CharWeight> weights;
+    if (!parse_char_weights(opts->char_weights, weights)) return; // checked by option parser
+
+    for (State* s = dfa.head; s; s = s->next) {
+        CodeGo& go = s->go;
+        if (go.freq || go.span_count == 0) continue;
+
+        uint64_t* weight = alc.alloct<uint64_t>(go.span_count);
+        for (uint32_t i = 0; i < go.span_count; ++i) {
+            const uint32_t lb = i == 0 ? 0 : go.span[i - 1].ub, ub = go.span[i].ub;
+            uint64_t w = ub - lb;
+            for (const CharWeight& cw : weights) {
+                const uint32_t l = std::max(lb, cw.lb), u = std::min(ub, cw.ub + 1);
+                if (l < u) w = w - (u - l) + static_cast<uint64_t>(u - l) * cw.weight;
+            }
+            weight[i] = w;
+        }
+        go.weight = weight;
+    }
+}
+
 // In rec-func mode we can precompute common YYFN parts.
 // This should be done for each block (with block-level configurations YYFN and `fn:sep`)
 // and once for the whole program (with whole-program configurations).
@@ -634,10 +1459,32 @@ LOCAL_NODISCARD(Ret codegen_analyze_block(Output& output)) {
             break;
         }
 
+        if (opts->profile_gen && opts->target == Target::CODE) {
+            profile_counters(output, *dfa);
+        }
+        if (!opts->profile_use.empty()) {
+            profile_use(output, *dfa, opts);
+        }
+        if (!opts->char_weights.empty()) {
+            char_weights(alc, *dfa, opts);
+        }
+        if (opts->collapse_chains) {
+            collapse_chains(alc, *dfa, opts);
+        }
+        if (opts->simd_loops) {
+            simd_loops(alc, *dfa, opts);
+        }
+        if (opts->table_driven) {
+            table_dispatch(alc, *dfa, opts);
+        }
+        if (opts->class_switch) {
+            class_table(alc, *dfa, opts);
+        }
+
         // Generate DFA transitions and perform used label analysis: for every transition mark its
         // destination state label as used.
         for (State* s = dfa->head; s; s = s->next) {
-            code_go(alc, *dfa, opts, s);
+            if (!s->go.table) code_go(alc, *dfa, opts, s);
         }
 
         // Assign label indices (only to the labels that are used).
@@ -675,6 +1522,21 @@ LOCAL_NODISCARD(Ret codegen_analyze_block(Output& output)) {
         }
     }
 
+    // Tables are built after all state and YYFILL label indices are known.
+    if (opts->table_driven && opts->target == Target::SKELETON) {
+        // With skeleton each DFA is a separate lexer with its own state switch.
+        for (auto i = dfas.cbegin(); i != dfas.cend(); ++i) {
+            uint32_t n = 0;
+            for (const State* s = (*i)->head; s; s = s->next) {
+                if (s->label->used) n = std::max(n, s->label->index + 1);
+                if (s->fill_label) n = std::max(n, s->fill_label->index + 1);
+            }
+            table_build(output, i, i + 1, n);
+        }
+    } else if (opts->table_driven) {
+        table_build(output, dfas.cbegin(), dfas.cend(), output.label_counter);
+    }
+
     return Ret::OK;
 }
 
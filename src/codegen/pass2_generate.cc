@@ -132,6 +132,24 @@ class GenLessThan : public RenderCallback {
     FORBID_COPY(GenLessThan);
 };
 
+class GenCondHint : public RenderCallback {
+    std::ostringstream& os;
+    const char* cond;
+
+  public:
+    GenCondHint(std::ostringstream& os, const char* cond)
+        : os(os), cond(cond) {}
+
+    void render_var(StxVarId var) override {
+        switch (var) {
+            case StxVarId::COND: os << cond; break;
+            default: UNREACHABLE(); break;
+        }
+    }
+
+    FORBID_COPY(GenCondHint);
+};
+
 bool endstate(const State* s) {
     // An 'end' state is a state which has no outgoing transitions on symbols. Usually 'end' states
     // are final states (not all final states are 'end' states), but sometimes it be initial
@@ -334,10 +352,10 @@ static void gen_fintags(Output& output, CodeList* stmts, const Adfa& dfa, const
 class GenArrayElem : public RenderCallback {
     std::ostream& os;
     const char* array;
-    size_t index;
+    const char* index;
 
   public:
-    GenArrayElem(std::ostream& os, const char* array, size_t index)
+    GenArrayElem(std::ostream& os, const char* array, const char* index)
         : os(os), array(array), index(index) {}
 
     void render_var(StxVarId var) override {
@@ -351,6 +369,24 @@ class GenArrayElem : public RenderCallback {
     FORBID_COPY(GenArrayElem);
 };
 
+class GenCharIndex : public RenderCallback {
+    std::ostream& os;
+    const opt_t* opts;
+
+  public:
+    GenCharIndex(std::ostream& os, const opt_t* opts)
+        : os(os), opts(opts) {}
+
+    void render_var(StxVarId var) override {
+        switch (var) {
+            case StxVarId::CHAR: os << opts->var_char; break;
+            default: UNREACHABLE(); break;
+        }
+    }
+
+    FORBID_COPY(GenCharIndex);
+};
+
 void expand_fintags(Output& output, const Tag& tag, std::vector<const char*>& fintags) {
     const opt_t* opts = output.block().opts;
     fintags.clear();
@@ -364,7 +400,8 @@ void expand_fintags(Output& output, const Tag& tag, std::vector<const char*>& fi
         Scratchbuf& buf = output.scratchbuf;
         const char* yypmatch = fintag_expr(output, opts->var_pmatch.c_str());
         for (size_t i = tag.lsub; i <= tag.hsub; i += 2) {
-            GenArrayElem callback(buf.stream(), yypmatch, i);
+            const char* index = buf.u64(i).flush();
+            GenArrayElem callback(buf.stream(), yypmatch, index);
             fintags.push_back(opts->gen_code_array_elem(buf, callback));
         }
     }
@@ -382,6 +419,12 @@ static void gen_continue_yyloop(Output& output, CodeList* stmts, const char* nex
     append(stmts, code_stmt(alc, buf.flush()));
 }
 
+// Increment profile counter, see note [profiling].
+static void gen_profile_count(Output& output, CodeList* stmts, uint32_t counter) {
+    Scratchbuf& o = output.scratchbuf;
+    append(stmts, code_stmt(output.allocator, o.cstr("++yyprof[").u32(counter).cstr("]").flush()));
+}
+
 static CodeList* gen_fill_falllback(
         Output& output, const Adfa& dfa, const State* from, const CodeJump* jump) {
     const opt_t* opts = output.block().opts;
@@ -498,6 +541,41 @@ CodeList* gen_goto_after_fill(
     }
 }
 
+static const char* gen_fill_call(Output& output, size_t need) {
+    const opt_t* opts = output.block().opts;
+    const bool eof_rule = opts->fill_eof != NOEOF;
+    Scratchbuf& o = output.scratchbuf;
+
+    // With end-of-input rule $ there is no YYFILL argument and no parameter to replace.
+    o.str(opts->api_fill);
+    if (!eof_rule) {
+        argsubst(o.stream(), opts->fill_param, "len", true, need);
+    }
+    if (opts->fill_param_enable) {
+        o.cstr("(");
+        if (!eof_rule) o.u64(need);
+        o.cstr(")");
+    }
+    return o.flush();
+}
+
+static void gen_fill_or_fallback(
+        Output& output, CodeList* fill, CodeList* rematch, CodeList* fallback) {
+    const opt_t* opts = output.block().opts;
+    OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
+
+    // End-of-input rule $ without a storable state: check YYFILL return value. If it succeeds
+    // (returns zero) then go to YYFILL label and rematch, otherwise follow fallback transition.
+    const char* call = gen_fill_call(output, 0);
+    if (!opts->fill_naked) call = o.cstr(call).cstr(" == 0").flush();
+    if (!opts->var_fill.empty()) {
+        append(fill, opts->fill_naked ? code_text(alc, call) : code_stmt(alc, call));
+        call = opts->var_fill.c_str(); // replace call with its result
+    }
+    gen_if(alc, opts, call, rematch, fallback, fill);
+}
+
 static void gen_fill(
         Output& output,
         CodeList* stmts,
@@ -513,34 +591,20 @@ static void gen_fill(
 
     CodeList* fill = code_list(alc);
     if (opts->fill_enable) {
+        if (dfa.profile) {
+            gen_profile_count(output, fill, dfa.profile->fill);
+        }
         if (opts->storable_state) {
             append(fill, code_set_state(alc, o.u32(from->fill_state->fill_label->index).flush()));
         }
 
-        // With end-of-input rule $ there is no YYFILL argument and no parameter to replace.
-        o.str(opts->api_fill);
-        if (!eof_rule) {
-            argsubst(o.stream(), opts->fill_param, "len", true, need);
-        }
-        if (opts->fill_param_enable) {
-            o.cstr("(");
-            if (!eof_rule) o.u64(need);
-            o.cstr(")");
-        }
         if (eof_rule && !opts->storable_state) {
-            // End-of-input rule $ without a storable state: check YYFILL return value. If it
-            // succeeds (returns zero) then go to YYFILL label and rematch.
-            const char* call = o.cstr(opts->fill_naked ? "" : " == 0").flush();
-            if (!opts->var_fill.empty()) {
-                append(fill, opts->fill_naked ? code_text(alc, call) : code_stmt(alc, call));
-                call = opts->var_fill.c_str(); // replace call with its result
-            }
             CodeList* rematch = gen_goto_after_fill(output, dfa, from, jump);
             CodeList* fallback = gen_fill_falllback(output, dfa, from, jump);
-            gen_if(alc, opts, call, rematch, fallback, fill);
+            gen_fill_or_fallback(output, fill, rematch, fallback);
         } else {
             // Otherwise don't check YYFILL return value: assume that it does not return on failure.
-            const char* call = o.flush();
+            const char* call = gen_fill_call(output, need);
             append(fill, opts->fill_naked ? code_text(alc, call) : code_stmt(alc, call));
         }
     } else if (eof_rule && !opts->storable_state) {
@@ -586,6 +650,14 @@ static void gen_goto(
 
     CodeList* transition = code_list(alc);
 
+    if (from != nullptr && from->go.prof != nullptr) {
+        const CodeGoProf* prof = from->go.prof;
+        const State** to = std::find(prof->to, prof->to + prof->ntrans, jump.to);
+        if (to != prof->to + prof->ntrans) {
+            gen_profile_count(output, transition, prof->trans + static_cast<uint32_t>(to - prof->to));
+        }
+    }
+
     gen_set_tags(output, transition, dfa, jump.tags);
 
     if (jump.skip) {
@@ -628,7 +700,17 @@ static const char* gen_cond(Output& output, const CodeCmp* cond) {
 
     buf.str(opts->var_char).cstr(" ").str(cond->cmp).cstr(" ");
     print_char_or_hex(buf.stream(), cond->val, opts);
-    return buf.flush();
+    const char* c = buf.flush();
+
+    // Branch probability hints are added only if the syntax file defines them.
+    if (cond->hint == CodeCmp::Hint::LIKELY && opts->code_cond_likely) {
+        GenCondHint callback(buf.stream(), c);
+        c = opts->gen_code_cond_likely(buf, callback);
+    } else if (cond->hint == CodeCmp::Hint::UNLIKELY && opts->code_cond_unlikely) {
+        GenCondHint callback(buf.stream(), c);
+        c = opts->gen_code_cond_unlikely(buf, callback);
+    }
+    return c;
 }
 
 static CodeList* gen_gosw(Output& output, const Adfa& dfa, const CodeGoSw* go, const State* from) {
@@ -636,7 +718,17 @@ static CodeList* gen_gosw(Output& output, const Adfa& dfa, const CodeGoSw* go, c
     OutAllocator& alc = output.allocator;
     Scratchbuf& o = output.scratchbuf;
 
-    const char* expr = o.str(opts->var_char).flush();
+    const char* expr;
+    if (go->classes) {
+        // `YYCTYPE` may be signed, see note [class switch].
+        GenCharIndex index_callback(o.stream(), opts);
+        const char* index = opts->gen_code_char_index(o, index_callback);
+        const char* table = o.str(class_table_name(dfa.cond)).flush();
+        GenArrayElem callback(o.stream(), table, index);
+        expr = opts->gen_code_array_elem(o, callback);
+    } else {
+        expr = o.str(opts->var_char).flush();
+    }
 
     CodeCases* cases = code_cases(alc);
     CodeCase* defcase = nullptr;
@@ -663,10 +755,22 @@ static CodeList* gen_goifb(
         Output& output, const Adfa& dfa, const CodeGoIfB* go, const State* from) {
     OutAllocator& alc = output.allocator;
     CodeList* stmts = code_list(alc);
-    const char* if_cond = gen_cond(output, go->cond);
     CodeList* if_then = gen_goif(output, dfa, go->gothen, from);
     CodeList* if_else = gen_goif(output, dfa, go->goelse, from);
-    append(stmts, code_if_then_else(alc, if_cond, if_then, if_else));
+    if (if_then->head == nullptr) {
+        // The lower half is a single elided transition (this may happen in weighted if-trees, see
+        // note [profile-guided optimizations]). Invert the condition to avoid an empty branch.
+        const CodeCmp::Hint hint = go->cond->hint == CodeCmp::Hint::LIKELY
+                ? CodeCmp::Hint::UNLIKELY
+                : go->cond->hint == CodeCmp::Hint::UNLIKELY
+                ? CodeCmp::Hint::LIKELY : CodeCmp::Hint::NONE;
+        const CodeCmp cmp = {">", go->cond->val, hint};
+        append(stmts, code_if_then_else(alc, gen_cond(output, &cmp), if_else, nullptr));
+    } else {
+        const char* if_cond = gen_cond(output, go->cond);
+        if (if_else->head == nullptr) if_else = nullptr;
+        append(stmts, code_if_then_else(alc, if_cond, if_then, if_else));
+    }
     return stmts;
 }
 
@@ -841,6 +945,211 @@ static void gen_godot(
     }
 }
 
+// Fast path for a chain of transitions, see note [collapsed chains]. For a chain "abc" it is:
+//
+//     if (((unsigned long)(unsigned char)YYCURSOR[0]
+//             | (unsigned long)(unsigned char)YYCURSOR[1] << 8
+//             | (unsigned long)(unsigned char)YYCURSOR[2] << 16) == 0x636261ul) {
+//         YYCURSOR += 2;
+//         goto <state after "abc">;
+//     }
+//
+static void gen_gochain(
+        Output& output, const Adfa& dfa, const CodeGoChain* chain, CodeList* stmts) {
+    const opt_t* opts = output.block().opts;
+    OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
+
+    const bool wide = chain->length > 4;
+    const char* type = wide ? "(unsigned long long)" : "(unsigned long)";
+    uint64_t value = 0;
+
+    o.cstr("(");
+    for (uint32_t i = 0; i < chain->length; ++i) {
+        if (i > 0) o.cstr(" | ");
+        o.cstr(type).cstr("(unsigned char)").str(opts->api_cursor).cstr("[").u32(i).cstr("]");
+        if (i > 0) o.cstr(" << ").u32(8 * i);
+        value |= static_cast<uint64_t>(chain->chars[i]) << (8 * i);
+    }
+    o.cstr(") == 0x");
+    o.stream() << std::hex << value << std::dec;
+    const char* cond = o.cstr(wide ? "ull" : "ul").flush();
+
+    CodeList* then = code_list(alc);
+    o.str(opts->api_cursor).cstr(" += ").u32(chain->length - 1);
+    append(then, code_stmt(alc, o.flush()));
+    if (chain->to->action.kind == Action::Kind::MOVE) {
+        // Move states dispatch on the character that has been peeked by the previous state.
+        print_char_or_hex(o.stream(), chain->chars[chain->length - 1], opts);
+        append(then, code_assign(alc, opts->var_char.c_str(), o.flush()));
+    }
+    // With eager skip the last transition skips the last character of the chain.
+    const CodeJump jump = {chain->to, TCID0, opts->eager_skip && consume(chain->to), false, false};
+    gen_goto(output, dfa, then, nullptr, jump);
+
+    append(stmts, code_if_then_else(alc, cond, then, nullptr));
+}
+
+// Vectorized loop for a self-looping state, see note [SIMD loops]. For a loop on `[^"\\\n]` it is:
+//
+//     #if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+//     {
+//     #if defined(__AVX2__)
+//         typedef unsigned char yyvec_t __attribute__((vector_size(32)));
+//         typedef char yymsk_t __attribute__((vector_size(32)));
+//     #elif defined(__SSE2__)
+//         typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+//         typedef char yymsk_t __attribute__((vector_size(16)));
+//     #else
+//         typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+//         unsigned long long yyw[sizeof(yyvec_t) / 8];
+//     #endif
+//         yyvec_t yyv;
+//         unsigned int yyi;
+//         for (;;) {
+//             if (YYLIMIT - YYCURSOR < (long)sizeof(yyvec_t) + <need>) break;
+//             __builtin_memcpy(&yyv, YYCURSOR, sizeof(yyv));
+//             yyv = (yyvec_t)((yyv == 0x0A) | (yyv == 0x22) | (yyv == 0x5C));
+//     #if defined(__AVX2__)
+//             yyi = (unsigned int)__builtin_ctzll((unsigned int)__builtin_ia32_pmovmskb256((yymsk_t)yyv) | 1ull << 32);
+//     #elif defined(__SSE2__)
+//             yyi = (unsigned int)__builtin_ctz((unsigned int)__builtin_ia32_pmovmskb128((yymsk_t)yyv) | 1u << 16);
+//     #else
+//             __builtin_memcpy(yyw, &yyv, sizeof(yyv));
+//             yyi = 0;
+//             while (yyi < sizeof(yyv) && yyw[yyi / 8] == 0) yyi += 8;
+//             if (yyi < sizeof(yyv)) yyi += (unsigned int)__builtin_ctzll(yyw[yyi / 8]) / 8;
+//     #endif
+//             YYCURSOR += yyi;
+//             if (yyi < sizeof(yyv)) break;
+//         }
+//         yych = *YYCURSOR;
+//     }
+//     #endif
+//
+// Here `yyi` is the offset of the first exit character in the vector, or the vector size if there
+// is none. SSE2 and AVX2 get it from the byte mask; elsewhere the mask is scanned in 64-bit words.
+static void gen_goloop(Output& output, const CodeGoLoop* loop, CodeList* stmts) {
+    const opt_t* opts = output.block().opts;
+    OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
+
+    // mask of the characters that exit the loop
+    o.cstr("yyv = (yyvec_t)").cstr(loop->exit ? "(" : "~(");
+    for (uint32_t i = 0; i < loop->nranges; ++i) {
+        const uint32_t l = loop->lower[i], u = loop->upper[i];
+        if (i > 0) o.cstr(" | ");
+        o.cstr("(");
+        if (l == u) {
+            o.cstr("yyv == ");
+            print_hex(o.stream(), l, opts);
+        } else if (l == 0) {
+            o.cstr("yyv <= ");
+            print_hex(o.stream(), u, opts);
+        } else if (u == 0xFF) {
+            o.cstr("yyv >= ");
+            print_hex(o.stream(), l, opts);
+        } else {
+            o.cstr("(yyvec_t)(yyv - ");
+            print_hex(o.stream(), l, opts);
+            o.cstr(") <= ");
+            print_hex(o.stream(), u - l, opts);
+        }
+        o.cstr(")");
+    }
+    const char* mask = o.cstr(")").flush();
+
+    CodeList* body = code_list(alc);
+    o.cstr("if (").str(opts->api_limit).cstr(" - ").str(opts->api_cursor)
+        .cstr(" < (long)sizeof(yyvec_t) + ").u64(loop->need).cstr(") break");
+    append(body, code_stmt(alc, o.flush()));
+    o.cstr("__builtin_memcpy(&yyv, ").str(opts->api_cursor).cstr(", sizeof(yyv))");
+    append(body, code_stmt(alc, o.flush()));
+    append(body, code_stmt(alc, mask));
+    append(body, code_textraw(alc, "#if defined(__AVX2__)"));
+    append(body, code_stmt(alc, "yyi = (unsigned int)__builtin_ctzll("
+            "(unsigned int)__builtin_ia32_pmovmskb256((yymsk_t)yyv) | 1ull << 32)"));
+    append(body, code_textraw(alc, "#elif defined(__SSE2__)"));
+    append(body, code_stmt(alc, "yyi = (unsigned int)__builtin_ctz("
+            "(unsigned int)__builtin_ia32_pmovmskb128((yymsk_t)yyv) | 1u << 16)"));
+    append(body, code_textraw(alc, "#else"));
+    append(body, code_stmt(alc, "__builtin_memcpy(yyw, &yyv, sizeof(yyv))"));
+    append(body, code_stmt(alc, "yyi = 0"));
+    append(body, code_stmt(alc, "while (yyi < sizeof(yyv) && yyw[yyi / 8] == 0) yyi += 8"));
+    append(body, code_stmt(alc, "if (yyi < sizeof(yyv)) "
+            "yyi += (unsigned int)__builtin_ctzll(yyw[yyi / 8]) / 8"));
+    append(body, code_textraw(alc, "#endif"));
+    append(body, code_stmt(alc, o.str(opts->api_cursor).cstr(" += yyi").flush()));
+    append(body, code_stmt(alc, "if (yyi < sizeof(yyv)) break"));
+
+    CodeList* block = code_list(alc);
+    append(block, code_textraw(alc, "#if defined(__AVX2__)"));
+    append(block, code_stmt(alc, "typedef unsigned char yyvec_t __attribute__((vector_size(32)))"));
+    append(block, code_stmt(alc, "typedef char yymsk_t __attribute__((vector_size(32)))"));
+    append(block, code_textraw(alc, "#elif defined(__SSE2__)"));
+    append(block, code_stmt(alc, "typedef unsigned char yyvec_t __attribute__((vector_size(16)))"));
+    append(block, code_stmt(alc, "typedef char yymsk_t __attribute__((vector_size(16)))"));
+    append(block, code_textraw(alc, "#else"));
+    append(block, code_stmt(alc, "typedef unsigned char yyvec_t __attribute__((vector_size(16)))"));
+    append(block, code_stmt(alc, "unsigned long long yyw[sizeof(yyvec_t) / 8]"));
+    append(block, code_textraw(alc, "#endif"));
+    append(block, code_stmt(alc, "yyvec_t yyv"));
+    append(block, code_stmt(alc, "unsigned int yyi"));
+    append(block, code_loop(alc, body));
+    append(block, code_peek(alc));
+
+    append(stmts, code_textraw(alc,
+            "#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__"));
+    append(stmts, code_block(alc, block, CodeBlock::Kind::WRAPPED));
+    append(stmts, code_textraw(alc, "#endif"));
+}
+
+static void gen_table_lookup(Output& output, CodeList* stmts, const char* base) {
+    const opt_t* opts = output.block().opts;
+    OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
+
+    // See note [table-driven code]: the low bit of a table entry is the skip bit.
+    o.str(opts->var_state).cstr(" = yytrans[");
+    if (base) o.cstr(base).cstr(" + ");
+    o.cstr("yyclass[(unsigned char)").str(opts->var_char).cstr("]]");
+    append(stmts, code_stmt(alc, o.flush()));
+    if (opts->api == Api::DEFAULT) {
+        o.str(opts->api_cursor).cstr(" += ").str(opts->var_state).cstr(" & 1");
+        append(stmts, code_stmt(alc, o.flush()));
+    } else {
+        CodeList* skip = code_list(alc);
+        append(skip, code_skip(alc));
+        const char* cond = o.str(opts->var_state).cstr(" & 1").flush();
+        append(stmts, code_if_then_else(alc, cond, skip, nullptr));
+    }
+    gen_continue_yyloop(output, stmts, o.str(opts->var_state).cstr(" >> 1").flush());
+}
+
+static void gen_table_eof(Output& output, CodeList* stmts, CodeList* eof) {
+    const opt_t* opts = output.block().opts;
+    Scratchbuf& o = output.scratchbuf;
+
+    // The end-of-input symbol also has a transition in the table, which is taken if it is not at
+    // the end of input.
+    o.str(opts->var_char).cstr(" == ");
+    print_char_or_hex(o.stream(), opts->fill_eof, opts);
+    append(stmts, code_if_then_else(output.allocator, o.flush(), eof, nullptr));
+}
+
+static void gen_gotable(
+        Output& output, const Adfa& dfa, const CodeGoTable* go, const State* from, CodeList* stmts) {
+    OutAllocator& alc = output.allocator;
+
+    if (go->eof) {
+        CodeList* eof = code_list(alc);
+        gen_fill(output, eof, nullptr, dfa, from, nullptr);
+        gen_table_eof(output, stmts, eof);
+    }
+    const char* base = go->base == 0 ? nullptr : output.scratchbuf.u32(go->base).flush();
+    gen_table_lookup(output, stmts, base);
+}
+
 static void gen_go(Output& output, const Adfa& dfa, const CodeGo* go, const State* from, CodeList* stmts) {
     const opt_t* opts = output.block().opts;
     OutAllocator& alc = output.allocator;
@@ -862,6 +1171,19 @@ static void gen_go(Output& output, const Adfa& dfa, const CodeGo* go, const Stat
         append(stmts, code_skip(alc));
     }
 
+    if (go->table) {
+        gen_gotable(output, dfa, go->table, from, stmts);
+        return;
+    }
+
+    if (go->loop) {
+        gen_goloop(output, go->loop, stmts);
+    }
+
+    if (go->chain) {
+        gen_gochain(output, dfa, go->chain, stmts);
+    }
+
     if (go->kind == CodeGo::Kind::SWITCH_IF) {
         append(stmts, gen_goswif(output, dfa, go->goswif, from));
     } else if (go->kind == CodeGo::Kind::BITMAP) {
@@ -905,6 +1227,9 @@ static void emit_accept(
     if (nacc == 0) return;
 
     append(stmts, code_restore(alc));
+    if (dfa.profile) {
+        gen_profile_count(output, stmts, dfa.profile->backtrack);
+    }
 
     GenGetAccept callback(buf.stream(), opts);
     const char* var = opts->gen_code_yygetaccept(buf, callback);
@@ -985,12 +1310,130 @@ static const char* gen_cond_enum_elem(Scratchbuf& buf, const opt_t* opts, const
     return opts->gen_code_enum_elem(buf, callback);
 }
 
-static void emit_rule(Output& output, CodeList* stmts, const Adfa& dfa, size_t rule_idx) {
+static void emit_semact(Output& output, CodeList* stmts, const Adfa& dfa, const Rule& rule);
+
+// Keyword lookup in the action of a rule that matches keywords, see note [keyword lookup]. For
+// keywords `do`, `if` and `int` and the lexeme start `tok` it is:
+//
+//     {
+//         int yykw = -1;
+//         switch (YYCURSOR - tok) {
+//         case 2:
+//             switch ((unsigned char)tok[0]) {
+//             case 'd':
+//                 if (memcmp(tok + 1, "o", 1) == 0) yykw = 0;
+//                 break;
+//             case 'i':
+//                 if (memcmp(tok + 1, "f", 1) == 0) yykw = 1;
+//                 break;
+//             }
+//             break;
+//         case 3:
+//             switch ((unsigned char)tok[0]) {
+//             case 'i':
+//                 if (memcmp(tok + 1, "nt", 2) == 0) yykw = 2;
+//                 break;
+//             }
+//             break;
+//         }
+//         if (yykw == 0) {
+//             <action of `do`>
+//         } else if (yykw == 1) {
+//             <action of `if`>
+//         } else if (yykw == 2) {
+//             <action of `int`>
+//         } else {
+//             <action of the rule>
+//         }
+//     }
+//
+// User actions are not placed in the switch, so that `break` in them keeps its meaning.
+static void gen_keyword_lookup(Output& output, CodeList* stmts, const Adfa& dfa, const Rule& rule) {
     const opt_t* opts = output.block().opts;
-    const Rule& rule = dfa.rules[rule_idx];
-    const SemAct* semact = rule.semact;
     OutAllocator& alc = output.allocator;
     Scratchbuf& o = output.scratchbuf;
+    const std::string& tok = opts->keyword_lookup;
+
+    // Keyword numbers ordered by length and the first character (and by priority within a group).
+    const size_t nkws = rule.keywords.size();
+    std::vector<size_t> kws(nkws);
+    for (size_t i = 0; i < nkws; ++i) kws[i] = i;
+    auto keyword = [&](size_t i) -> const std::string& {
+        return dfa.rules[rule.keywords[i]].keyword;
+    };
+    std::stable_sort(kws.begin(), kws.end(), [&](size_t i, size_t j) {
+        const std::string& x = keyword(i), &y = keyword(j);
+        return x.size() < y.size() || (x.size() == y.size() && static_cast<uint8_t>(x[0])
+                < static_cast<uint8_t>(y[0]));
+    });
+
+    CodeCases* lens = code_cases(alc);
+    for (size_t i = 0; i < nkws;) {
+        const size_t len = keyword(kws[i]).size();
+        CodeCases* chars = code_cases(alc);
+        while (i < nkws && keyword(kws[i]).size() == len) {
+            const char first = keyword(kws[i])[0];
+            CodeList* body = code_list(alc);
+            Code* ifte = code_if_then_else(alc);
+            for (; i < nkws && keyword(kws[i]).size() == len && keyword(kws[i])[0] == first; ++i) {
+                CodeList* set = code_list(alc);
+                append(set, code_assign(alc, "yykw", o.u64(kws[i]).flush()));
+                if (len == 1) {
+                    // single-character keywords are unique in their group
+                    append(body, set);
+                    continue;
+                }
+                o.cstr("memcmp(").str(tok).cstr(" + 1, \"");
+                for (size_t k = 1; k < len; ++k) {
+                    const uint8_t c = static_cast<uint8_t>(keyword(kws[i])[k]);
+                    if (c >= 0x20 && c < 0x7F && c != '"' && c != '\\' && c != '?') {
+                        o.stream() << static_cast<char>(c);
+                    } else {
+                        o.stream() << '\\' << static_cast<char>('0' + (c >> 6))
+                            << static_cast<char>('0' + ((c >> 3) & 7))
+                            << static_cast<char>('0' + (c & 7));
+                    }
+                }
+                o.cstr("\", ").u64(len - 1).cstr(") == 0");
+                append(ifte->ifte, code_branch(alc, o.flush(), set));
+            }
+            if (ifte->ifte->head) append(body, ifte);
+            append(body, code_stmt(alc, "break"));
+            print_char_or_hex(o.stream(), static_cast<uint8_t>(first), opts);
+            append(chars, code_case_string(alc, body, o.flush()));
+        }
+        CodeList* body = code_list(alc);
+        append(body, code_switch(alc, o.cstr("(unsigned char)").str(tok).cstr("[0]").flush(), chars));
+        append(body, code_stmt(alc, "break"));
+        append(lens, code_case_number(alc, body, static_cast<int32_t>(len)));
+    }
+
+    // Dispatch on the keyword number.
+    Code* actions = code_if_then_else(alc);
+    for (size_t i = 0; i < nkws; ++i) {
+        CodeList* action = code_list(alc);
+        emit_semact(output, action, dfa, dfa.rules[rule.keywords[i]]);
+        append(actions->ifte, code_branch(alc, o.cstr("yykw == ").u64(i).flush(), action));
+    }
+    CodeList* action = code_list(alc);
+    emit_semact(output, action, dfa, rule);
+    append(actions->ifte, code_branch(alc, nullptr, action));
+
+    CodeList* block = code_list(alc);
+    append(block, code_var(alc, VarType::INT, false, "yykw", "-1"));
+    append(block, code_switch(
+            alc, o.str(opts->api_cursor).cstr(" - ").str(tok).flush(), lens));
+    append(block, actions);
+    append(stmts, code_block(alc, block, CodeBlock::Kind::WRAPPED));
+}
+
+static void emit_rule(Output& output, CodeList* stmts, const Adfa& dfa, size_t rule_idx) {
+    const opt_t* opts = output.block().opts;
+    const Rule& rule = dfa.rules[rule_idx];
+
+    if (dfa.profile) {
+        gen_profile_count(output, stmts, dfa.profile->rules + static_cast<uint32_t>(rule_idx));
+    }
 
     gen_fintags(output, stmts, dfa, rule);
 
@@ -999,6 +1442,19 @@ static void emit_rule(Output& output, CodeList* stmts, const Adfa& dfa, size_t r
         return;
     }
 
+    if (!rule.keywords.empty()) {
+        gen_keyword_lookup(output, stmts, dfa, rule);
+    } else {
+        emit_semact(output, stmts, dfa, rule);
+    }
+}
+
+static void emit_semact(Output& output, CodeList* stmts, const Adfa& dfa, const Rule& rule) {
+    const opt_t* opts = output.block().opts;
+    const SemAct* semact = rule.semact;
+    OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
+
     // Condition in the semantic action is the one set with => or :=> rule.
     const char* cond = semact->cond == nullptr ? dfa.cond.c_str() : semact->cond;
     // Next condition is either the one specified in semantic action, or the current one.
@@ -1091,6 +1547,9 @@ static void emit_action(Output& output, const Adfa& dfa, const State* s, CodeLis
             append(stmts, code_skip(alc));
         }
         append(stmts, code_nlabel(alc, dfa.initial_label));
+        if (s->go.prof) {
+            gen_profile_count(output, stmts, s->go.prof->visits);
+        }
         gen_fill_and_label(output, stmts, dfa, s);
         if (backup) {
             append(stmts, code_backup(alc));
@@ -1126,16 +1585,34 @@ static void emit_action(Output& output, const Adfa& dfa, const State* s, CodeLis
 static void emit_state(Output& output, const State* state, CodeList* stmts) {
     const opt_t* opts = output.block().opts;
     OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
 
     // If state label is unused, we should not generate it.
     // Nor can we emit an YYDEBUG statement, as there is no state number to pass to it.
-    if (!state->label->used) return;
+    if (state->label->used) {
+        if (opts->code_model == CodeModel::GOTO_LABEL) {
+            append(stmts, code_nlabel(output.allocator, state->label));
+        }
+        if (opts->debug && state->action.kind != Action::Kind::INITIAL) {
+            append(stmts, code_debug(alc, state->label->index));
+        }
+    }
 
-    if (opts->code_model == CodeModel::GOTO_LABEL) {
-        append(stmts, code_nlabel(output.allocator, state->label));
+    // A head of the fast path goes to the slow path if the remaining input is too short to stay
+    // on the fast path (see note [fast path]).
+    if (state->slow_path) {
+        GenLessThan callback(o.stream(), opts, state->fast_need);
+        const char* less_than = opts->gen_code_yylessthan(o, callback);
+        CodeList* slow = code_list(alc);
+        o.str(opts->label_prefix).label(*state->slow_path->label);
+        append(slow, code_goto(alc, o.flush()));
+        append(stmts, code_if_then_else(alc, less_than, slow, nullptr));
     }
-    if (opts->debug && state->action.kind != Action::Kind::INITIAL) {
-        append(stmts, code_debug(alc, state->label->index));
+
+    // A state with unused label is entered by falling through from the previous state, it still
+    // needs a visit counter. In the initial state it is generated after the initial label.
+    if (state->go.prof && state->action.kind != Action::Kind::INITIAL) {
+        gen_profile_count(output, stmts, state->go.prof->visits);
     }
 }
 
@@ -1375,7 +1852,7 @@ void gen_tags(Scratchbuf& buf, const opt_t* opts, Code* code, const tagnames_t&
     }
 
     code->kind = CodeKind::RAW;
-    code->raw.size = buf.stream().str().length();
+    code->raw.size = buf.size();
     code->raw.data = buf.flush();
 }
 
@@ -1449,7 +1926,7 @@ static void gen_cond_enum(
         buf.cstr("\n");
 
         code->kind = CodeKind::RAW;
-        code->raw.size = buf.stream().str().length();
+        code->raw.size = buf.size();
         code->raw.data = buf.flush();
     } else {
         // prepare an array of enum member names
@@ -1718,6 +2195,61 @@ LOCAL_NODISCARD(Ret gen_yymax(Output& output, Code* code)) {
     return Ret::OK;
 }
 
+// Profile counters and the function that writes them to a file, see note [profiling]:
+//
+//     static unsigned long long yyprof[<n>];
+//     static const char *const yyprofkeys[<n>] = { "line5 fill", ... };
+//     static void yyprofdump(FILE *yyf) {
+//         unsigned int yyi;
+//         for (yyi = 0; yyi < <n>; ++yyi) {
+//             if (yyprof[yyi] != 0) fprintf(yyf, "%s %llu\n", yyprofkeys[yyi], yyprof[yyi]);
+//         }
+//     }
+//
+LOCAL_NODISCARD(Ret gen_profile(Output& output, Code* code)) {
+    const opt_t* opts = output.block().opts;
+    const std::vector<const char*>& keys = output.profile_keys;
+    OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
+
+    if (code->fmt.block_names != nullptr) {
+        RET_FAIL(error("`profile:re2c` directive does not accept a list of blocks: counters are "
+                       "shared by all blocks"));
+    }
+    if (opts->target != Target::CODE || keys.empty()) {
+        code->kind = CodeKind::EMPTY;
+        return Ret::OK;
+    }
+
+    const size_t n = keys.size();
+    const char** elems = alc.alloct<const char*>(n);
+    for (size_t i = 0; i < n; ++i) {
+        elems[i] = o.cstr("\"").cstr(keys[i]).cstr("\"").flush();
+    }
+
+    CodeList* stmts = code_list(alc);
+    append(stmts, code_stmt(alc, o.cstr("static unsigned long long yyprof[").u64(n).cstr("]")
+            .flush()));
+    append(stmts, code_array(alc, "yyprofkeys", "static const char *const", elems, n));
+
+    CodeList* loop = code_list(alc);
+    append(loop, code_stmt(alc, "if (yyprof[yyi] != 0) "
+            "fprintf(yyf, \"%s %llu\\n\", yyprofkeys[yyi], yyprof[yyi])"));
+    CodeList* body = code_list(alc);
+    append(body, code_stmt(alc, "unsigned int yyi"));
+    append(body, code_text(alc, o.cstr("for (yyi = 0; yyi < ").u64(n).cstr("; ++yyi) {").flush()));
+    append(body, code_block(alc, loop, CodeBlock::Kind::INDENTED));
+    append(body, code_text(alc, "}"));
+    CodeParams* params = code_params(alc);
+    append(params, code_param(alc, "yyf", "FILE*"));
+    append(stmts, code_fndef(alc, "yyprofdump", "static void", params, body));
+
+    code->kind = CodeKind::BLOCK;
+    code->block.kind = CodeBlock::Kind::RAW;
+    code->block.stmts = stmts;
+    return Ret::OK;
+}
+
 std::string bitmap_name(const opt_t* opts, const std::string& cond) {
     return cond.empty()
             ? opts->var_bitmaps
@@ -1811,6 +2343,10 @@ void gen_dfa_as_switch_cases(Output& output, Adfa& dfa, CodeCases* cases) {
     DCHECK(output.block().opts->code_model != CodeModel::GOTO_LABEL);
 
     for (State* s = dfa.head; s; s = s->next) {
+        // In table-driven code the states that are run by the shared default case have no cases,
+        // and the states that only follow a table dispatch are unreachable.
+        if (!s->label->used || (s->go.table && s->go.table->shared)) continue;
+
         CodeList* body = code_list(alc);
 
         // Emit current state.
@@ -1823,7 +2359,7 @@ void gen_dfa_as_switch_cases(Output& output, Adfa& dfa, CodeCases* cases) {
         // As long as the following state has no incoming transitions (its label is unused),
         // generate it as a continuation of the current state. This avoids looping through the
         // `yystate` switch only to return to the next case.
-        while (s->next && !s->next->label->used) {
+        while (s->next && !s->next->label->used && !s->go.table) {
             s = s->next;
             emit_state(output, s, body);
             emit_action(output, dfa, s, body);
@@ -1834,7 +2370,116 @@ void gen_dfa_as_switch_cases(Output& output, Adfa& dfa, CodeCases* cases) {
     }
 }
 
-void wrap_dfas_in_loop_switch(Output& output, CodeList* stmts, CodeCases* cases) {
+static void gen_table_cases(Output& output, const CodeTable* table, CodeCases* cases) {
+    OutAllocator& alc = output.allocator;
+
+    // Tagged transitions in table-driven code.
+    for (const CodeTableJump* j = table->jumps, *e = j + table->njumps; j < e; ++j) {
+        CodeList* body = code_list(alc);
+        gen_goto(output, *j->dfa, body, nullptr, j->jump);
+        append(cases, code_case_number(alc, body, static_cast<int32_t>(j->index)));
+    }
+}
+
+static CodeList* gen_table_default(Output& output, const CodeTable* table) {
+    const opt_t* opts = output.block().opts;
+    OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
+
+    // Shared case for the states that have no code of their own, see note [table-driven code].
+    CodeList* body = code_list(alc);
+    if (opts->state_abort) {
+        o.cstr("(unsigned int)").str(opts->var_state).cstr(" >= ").u32(table->nstates);
+        append(body, code_if_then_else(alc, o.flush(), gen_abort(alc), nullptr));
+    }
+    append(body, code_peek(alc));
+    if (table->fallback) {
+        CodeList* fill = code_list(alc);
+        CodeList* fallback = code_list(alc);
+        gen_continue_yyloop(output, fallback,
+                o.cstr("yyfallback[").str(opts->var_state).cstr("]").flush());
+        if (opts->fill_enable) {
+            // Rematch in the same state after YYFILL.
+            CodeList* rematch = code_list(alc);
+            o.cstr("continue");
+            if (!opts->label_loop.empty()) o.cstr(" ").str(opts->label_loop);
+            append(rematch, code_stmt(alc, o.flush()));
+            gen_fill_or_fallback(output, fill, rematch, fallback);
+        } else {
+            append(fill, fallback);
+        }
+        CodeList* eof = code_list(alc);
+        if (opts->fill_check) {
+            GenLessThan callback(o.stream(), opts, 1);
+            const char* less_than = opts->gen_code_yylessthan(o, callback);
+            append(eof, code_if_then_else(alc, less_than, fill, nullptr));
+        } else {
+            append(eof, fill);
+        }
+        gen_table_eof(output, body, eof);
+    }
+    gen_table_lookup(output, body, o.cstr("yybase[").str(opts->var_state).cstr("]").flush());
+    return body;
+}
+
+static void gen_table_array(
+        Output& output, CodeList* stmts, const char* name, const uint32_t* elems, size_t size) {
+    OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
+
+    // Pad the array with zeroes so that it can be tabulated.
+    const size_t n = (size + 7) / 8 * 8;
+    const char** xs = alc.alloct<const char*>(n);
+    uint32_t max = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const uint32_t x = i < size ? elems[i] : 0;
+        max = std::max(max, x);
+        xs[i] = o.u32(x).flush();
+    }
+    const char* type = max <= 0xFF ? "static const unsigned char"
+            : max <= 0xFFFF ? "static const unsigned short" : "static const unsigned int";
+    append(stmts, code_array(alc, name, type, xs, n, /*tabulate*/ true));
+}
+
+CodeList* gen_tables(Output& output, const CodeTable* table) {
+    CodeList* stmts = code_list(output.allocator);
+    gen_table_array(output, stmts, "yyclass", table->classes, 0x100);
+    if (table->nstates > 0) {
+        gen_table_array(output, stmts, "yybase", table->base, table->nstates);
+        if (table->fallback) {
+            gen_table_array(output, stmts, "yyfallback", table->fallback, table->nstates);
+        }
+    }
+    gen_table_array(output, stmts, "yytrans", table->trans, table->ntrans);
+    return stmts;
+}
+
+std::string class_table_name(const std::string& cond) {
+    return cond.empty() ? "yycc" : "yycc_" + cond;
+}
+
+CodeList* gen_class_table(Output& output, const Adfa& dfa) {
+    if (!dfa.classes->used) return nullptr;
+
+    const opt_t* opts = output.block().opts;
+    OutAllocator& alc = output.allocator;
+    Scratchbuf& o = output.scratchbuf;
+
+    // There are at most 256 classes, so class numbers have the same type as bitmap elements.
+    const char** elems = alc.alloct<const char*>(0x100);
+    for (uint32_t i = 0; i < 0x100; ++i) {
+        elems[i] = o.u32(dfa.classes->classes[i]).flush();
+    }
+    const char* name = o.str(class_table_name(dfa.cond)).flush();
+    const char* type = opts->gen_code_type_yybm(o);
+
+    CodeList* stmts = code_list(alc);
+    append(stmts, code_array(alc, name, type, elems, 0x100, /*tabulate*/ true));
+    return stmts;
+}
+
+void wrap_dfas_in_loop_switch(
+        Output& output, CodeList* stmts, CodeCases* cases, const CodeTable* table) {
     const opt_t* opts = output.block().opts;
     OutAllocator& alc = output.allocator;
 
@@ -1842,7 +2487,12 @@ void wrap_dfas_in_loop_switch(Output& output, CodeList* stmts, CodeCases* cases)
 
     CodeList* loop = code_list(alc);
     gen_storable_state_cases(output, cases);
-    if (opts->state_abort) {
+    if (table) {
+        gen_table_cases(output, table, cases);
+    }
+    if (table && table->nstates > 0) {
+        append(cases, code_case_default(alc, gen_table_default(output, table)));
+    } else if (opts->state_abort) {
         append(cases, code_case_default(alc, gen_abort(alc)));
     }
     append(loop, code_switch(alc, opts->var_state.c_str(), cases));
@@ -1982,6 +2632,13 @@ LOCAL_NODISCARD(Ret gen_block_code(Output& output, const Adfas& dfas, CodeList*
                 }
             }
         }
+        for (const std::unique_ptr<Adfa>& dfa : dfas) {
+            CodeList* classes = dfa->classes ? gen_class_table(output, *dfa) : nullptr;
+            if (classes) {
+                local_decls = true;
+                append(code, classes);
+            }
+        }
         if (opts->storable_state) {
             CHECK_RET(gen_state_goto_implicit(output, code));
         }
@@ -2013,12 +2670,20 @@ LOCAL_NODISCARD(Ret gen_block_code(Output& output, const Adfas& dfas, CodeList*
         // Merge DFAs for different conditions together in one switch.
         local_decls = true;
         append(code, gen_yystate_def(output));
+        // Tables for table-driven code are shared by all DFAs in the block.
+        const CodeTable* table = dfas.front()->table;
+        if (table) {
+            append(code, gen_tables(output, table));
+        }
+        for (const std::unique_ptr<Adfa>& dfa : dfas) {
+            if (dfa->classes) append(code, gen_class_table(output, *dfa));
+        }
 
         CodeCases* cases = code_cases(alc);
         for (const std::unique_ptr<Adfa>& dfa : dfas) {
             gen_dfa_as_switch_cases(output, *dfa, cases);
         }
-        wrap_dfas_in_loop_switch(output, code, cases);
+        wrap_dfas_in_loop_switch(output, code, cases, table);
     } else {
         DCHECK(opts->code_model == CodeModel::REC_FUNC);
         // In the rec/func mode DFA states are separate co-recursive functions that tail-call
@@ -2121,6 +2786,9 @@ LOCAL_NODISCARD(Ret codegen_generate_block(Output& output)) {
         case CodeKind::MAXNMATCH:
             CHECK_RET(gen_yymax(output, code));
             break;
+        case CodeKind::PROFILE:
+            CHECK_RET(gen_profile(output, code));
+            break;
         default:
             // skip for now, leave the rest for the render phase
             break;
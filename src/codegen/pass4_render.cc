@@ -28,7 +28,7 @@ static bool oneline_stmt_list(const CodeList* list) {
 
 static void render_nl(RenderContext& rctx) {
     if (!rctx.oneline_mode) {
-        rctx.os << std::endl;
+        rctx.os << '\n';
         ++rctx.line;
     }
 }
@@ -116,12 +116,12 @@ static void render_list(RenderContext& rctx, const CodeList* code) {
 static void render_block(RenderContext& rctx, const CodeBlock* code) {
     switch (code->kind) {
     case CodeBlock::Kind::WRAPPED:
-        rctx.os << indent(rctx.ind, rctx.opts->indent_str) << "{" << std::endl;
+        rctx.os << indent(rctx.ind, rctx.opts->indent_str) << "{\n";
         ++rctx.line;
         ++rctx.ind;
         render_list(rctx, code->stmts);
         --rctx.ind;
-        rctx.os << indent(rctx.ind, rctx.opts->indent_str) << "}" << std::endl;
+        rctx.os << indent(rctx.ind, rctx.opts->indent_str) << "}\n";
         ++rctx.line;
         break;
     case CodeBlock::Kind::INDENTED:
@@ -1037,11 +1037,11 @@ class RenderTagOps : public RenderCallback {
 
 static void render_label(RenderContext& rctx, const CodeLabel& label) {
     if (label.kind == CodeLabel::Kind::SLABEL) {
-        rctx.os << label.slabel << ":" << std::endl;
+        rctx.os << label.slabel << ":\n";
         ++rctx.line;
     } else if (label.nlabel->used) {
         DCHECK(label.nlabel->index != Label::NONE);
-        rctx.os << rctx.opts->label_prefix << label.nlabel->index << ":" << std::endl;
+        rctx.os << rctx.opts->label_prefix << label.nlabel->index << ":\n";
         ++rctx.line;
     }
 }
@@ -1351,7 +1351,7 @@ class RenderSetState : public RenderCallback {
 };
 
 static void render(RenderContext& rctx, const Code* code) {
-    std::ostringstream& os = rctx.os;
+    std::ostream& os = rctx.os;
     const opt_t* opts = rctx.opts;
     const uint32_t ind = rctx.ind;
     uint32_t& line = rctx.line;
@@ -1410,7 +1410,7 @@ static void render(RenderContext& rctx, const Code* code) {
         break;
     }
     case CodeKind::TEXT_RAW:
-        os << code->text << std::endl;
+        os << code->text << '\n';
         line += count_lines_text(code->text) + 1;
         break;
     case CodeKind::STMT:
@@ -1616,6 +1616,7 @@ static void render(RenderContext& rctx, const Code* code) {
     case CodeKind::MTAGS:
     case CodeKind::MAXFILL:
     case CodeKind::MAXNMATCH:
+    case CodeKind::PROFILE:
     case CodeKind::COND_ENUM:
     case CodeKind::STATE_GOTO:
     case CodeKind::DFAS:
@@ -1623,29 +1624,6 @@ static void render(RenderContext& rctx, const Code* code) {
     }
 }
 
-static uint32_t write_converting_newlines(const std::string& str, FILE* f) {
-    const char* s = str.c_str(), *e = s + str.length();
-    uint32_t lines = 0;
-
-    // In order to maintain consistency we convert all newlines to LF when writing output to file.
-    // Some newlines originate in user-defined code (including semantic actions and code fragments
-    // in configurations and directives), and some are generated by re2c itself.
-    for (const char* p = s;; ++p) {
-        size_t l = static_cast<size_t>(p - s);
-        if (p == e) {
-            fwrite(s, 1, l, f);
-            break;
-        } else if (*p == '\n') {
-            ++lines;
-            if (p > s && p[-1] == '\r') --l;
-            fwrite(s, 1, l, f);
-            s = p;
-        }
-    }
-
-    return lines;
-}
-
 LOCAL_NODISCARD(Ret codegen_render_blocks(
         Output& output, const std::string& fname, const blocks_t& blocks)) {
     FILE* file = nullptr, *temp = nullptr;
@@ -1662,14 +1640,14 @@ LOCAL_NODISCARD(Ret codegen_render_blocks(
     filename = escape_backslashes(filename);
 
     // Second code generation pass: expand labels, combine/simplify statements, convert newlines,
-    // write the generated code to a file.
-    RenderContext rctx(output.msg, filename);
+    // write the generated code to a file. The code is streamed to the file as it is rendered.
+    RenderContext rctx(output.msg, filename, file);
     for (const OutputBlock* b : blocks) {
         rctx.opts = b->opts;
         rctx.ind = b->opts->indent_top;
         render_list(rctx, b->code);
     }
-    write_converting_newlines(rctx.os.str(), file);
+    rctx.buf.finish();
 
     fclose(file);
     if (temp && !overwrite_file(tempname.c_str(), fname.c_str())) {
@@ -65,7 +65,8 @@ enum class EmptyClass: uint32_t {
 
 enum class Minimization: uint32_t {
     TABLE,
-    MOORE
+    MOORE,
+    HOPCROFT
 };
 
 // Whether a group is capturing or non-capturng depending on --invert-capture option and
@@ -127,6 +128,7 @@ enum class CodeKind: uint32_t {
     MTAGS,
     MAXFILL,
     MAXNMATCH,
+    PROFILE,
     VAR,
     CONST,
     ARRAY,
@@ -190,16 +192,21 @@ enum class StxGOpt {
     LOOP_LABEL
 };
 
+#define RE2C_STX_LOPTS \
+    STX_LOPT(CHAR_LITERALS) \
+    STX_LOPT(HAVE_ARGS) \
+    STX_LOPT(HAVE_COND) \
+    STX_LOPT(HAVE_INIT) \
+    STX_LOPT(HAVE_TYPE) \
+    STX_LOPT(HAVE_RETVAL) \
+    STX_LOPT(MANY) \
+    STX_LOPT(NESTED)
+
+#define STX_LOPT(id) id,
 enum class StxLOpt {
-    CHAR_LITERALS,
-    HAVE_ARGS,
-    HAVE_COND,
-    HAVE_INIT,
-    HAVE_TYPE,
-    HAVE_RETVAL,
-    MANY,
-    NESTED
+    RE2C_STX_LOPTS
 };
+#undef STX_LOPT
 
 enum class Ret: uint32_t {
     OK,   // all good
@@ -46,6 +46,7 @@ struct dump_dfa_tree_t {
 namespace re2c {
 
 struct Adfa;
+class bitmatrix_t;
 struct cfg_t;
 struct Tdfa;
 struct Tnfa;
@@ -104,8 +105,8 @@ struct dump_dfa_tree_t {
 void dump_nfa(const Tnfa&);
 void dump_dfa(const Tdfa&);
 void dump_adfa(const Adfa&);
-void dump_cfg(const cfg_t&, const bool*);
-void dump_interf(const cfg_t&, const bool*);
+void dump_cfg(const cfg_t&, const bitmatrix_t&);
+void dump_interf(const cfg_t&, const bitmatrix_t&);
 void dump_tcmd(const tcmd_t*);
 void dump_tag(const Tag& tag, bool negative);
 template<typename ctx_t> void dump_clstats(const ctx_t&);
@@ -11,7 +11,7 @@
 
 namespace re2c {
 
-void dump_cfg(const cfg_t& cfg, const bool* live) {
+void dump_cfg(const cfg_t& cfg, const bitmatrix_t& live) {
     const tagver_t nver = cfg.dfa.maxtagver + 1;
 
     fprintf(stderr,
@@ -20,7 +20,7 @@ void dump_cfg(const cfg_t& cfg, const bool* live) {
             "  node[shape=Mrecord fontname=Terminus height=0.2 width=0.2]\n"
             "  edge[arrowhead=vee fontname=Terminus]\n\n");
 
-    for (cfg_ix_t i = 0; i < cfg.nbbfall; ++i, live += nver) {
+    for (cfg_ix_t i = 0; i < cfg.nbbfall; ++i) {
         const cfg_bb_t* b = cfg.bblocks + i;
 
         fprintf(stderr, "  n%u [label=\"%u\\n", i, i);
@@ -51,7 +51,7 @@ void dump_cfg(const cfg_t& cfg, const bool* live) {
         if (i < cfg.nbbfin) {
             fprintf(stderr, "\\nneed:");
             for (tagver_t v = 0; v < nver; ++v) {
-                if (live[v]) {
+                if (live.test(i, static_cast<size_t>(v))) {
                     fprintf(stderr, " %i", v);
                 }
             }
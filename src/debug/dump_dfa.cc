@@ -111,9 +111,9 @@ void dump_dfa_t::state(const ctx_t& ctx, bool isnew) {
             const TdfaState* o = dfa.states[origin];
             fprintf(stderr,
                     "  i%u [style=dotted]\n"
-                    "  i%u:s -> %zu:s [style=dotted label=\"",
+                    "  i%u:s -> %u:s [style=dotted label=\"",
                     state, state, o->arcs[symbol]);
-            dump_tcmd(o->tcmd[symbol]);
+            dump_tcmd(o->cmd(symbol));
             fprintf(stderr, "\"]\n");
         }
 
@@ -132,7 +132,7 @@ void dump_dfa_t::state(const ctx_t& ctx, bool isnew) {
     const TdfaState* t = dfa.states[target];
     if (t->rule != Rule::NONE) {
         const Rule& r = ctx.rules[t->rule];
-        const tcmd_t* cmd = t->tcmd[dfa.nchars];
+        const tcmd_t* cmd = t->cmd(dfa.nchars);
 
         // see note [at most one final item per closure]
         cclositer_t b = ctx.state.begin(), e = ctx.state.end(), c = std::find_if(b, e, clos_t::fin);
@@ -224,7 +224,7 @@ void dump_dfa(const Tdfa& dfa) {
 
 void dump_tcmd_or_tcid(
         tcmd_t* const* tcmd, const tcid_t* tcid, size_t sym, const tcpool_t& tcpool) {
-    const tcmd_t* cmd = tcmd ? tcmd[sym] : tcpool[tcid[sym]];
+    const tcmd_t* cmd = tcid ? tcpool[tcid[sym]] : (tcmd ? tcmd[sym] : nullptr);
     dump_tcmd(cmd);
 }
 
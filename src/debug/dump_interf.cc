@@ -9,7 +9,7 @@
 
 namespace re2c {
 
-void dump_interf(const cfg_t& cfg, const bool* interf) {
+void dump_interf(const cfg_t& cfg, const bitmatrix_t& interf) {
     const tagver_t nver = cfg.dfa.maxtagver + 1;
     for (tagver_t y = 1; y < nver; ++y) {
         fprintf(stderr, "%2d ", y);
@@ -17,7 +17,8 @@ void dump_interf(const cfg_t& cfg, const bool* interf) {
     fprintf(stderr, "\n");
     for (tagver_t x = 1; x < nver; ++x) {
         for (tagver_t y = 1; y < nver; ++y) {
-            fprintf(stderr, "%2c ", interf[x * nver + y] ? '*' : '.');
+            const bool i = interf.test(static_cast<size_t>(x), static_cast<size_t>(y));
+            fprintf(stderr, "%2c ", i ? '*' : '.');
         }
         fprintf(stderr, "\n");
     }
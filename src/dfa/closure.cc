@@ -232,12 +232,12 @@ bool newver_cmp_t<history_t>::operator()(const newver_t& x, const newver_t& y) c
     uint64_t k = static_cast<uint32_t>(xh);
     k = (k << 32) | static_cast<uint32_t>(yh);
 
-    hc_cache_t::const_iterator i = cache.find(k);
-    if (i != cache.end()) {
-        cmp = i->second;
+    const int32_t* i = cache.find(k);
+    if (i) {
+        cmp = *i;
     } else {
         cmp = compare_reversed(history, xh, yh, x.tag);
-        cache.insert(std::make_pair(k, cmp));
+        cache.insert(k, cmp);
     }
 
     if (invert) cmp = -cmp;
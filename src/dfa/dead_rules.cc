@@ -10,6 +10,7 @@
 #include "src/msg/warn.h"
 #include "src/regexp/rule.h"
 #include "src/options/opt.h"
+#include "src/util/bitset.h"
 #include "src/util/check.h"
 #include "src/util/forbid_copy.h"
 
@@ -115,7 +116,7 @@ struct DfsBackprop {
     const RevDfa::arc_t* arc;
 };
 
-static void liveness_analysis(const RevDfa& rdfa, bool* live) {
+static void liveness_analysis(const RevDfa& rdfa, bitmatrix_t& live) {
     std::vector<DfsBackprop> stack;
     for (size_t i = 0; i < rdfa.nstates; ++i) {
         const RevDfa::state_t& s = rdfa.states[i];
@@ -138,9 +139,8 @@ static void liveness_analysis(const RevDfa& rdfa, bool* live) {
                 // If the rule has already been set, than either it's a loop, or another branch of
                 // backward propagation has already been here, in both cases we should stop: there's
                 // nothing new to propagate.
-                bool& l = live[x.rule * rdfa.nstates + x.state];
-                if (!l) {
-                    l = true;
+                if (!live.test(x.rule, x.state)) {
+                    live.set(x.rule, x.state);
                     x.arc = t.arcs;
                 }
             } else {
@@ -156,16 +156,17 @@ static void liveness_analysis(const RevDfa& rdfa, bool* live) {
     }
 }
 
-static void warn_dead_rules(Tdfa& dfa, const std::string& cond, const bool* live, Msg& msg) {
+static void warn_dead_rules(
+        Tdfa& dfa, const std::string& cond, const bitmatrix_t& live, Msg& msg) {
     const size_t nstates = dfa.states.size();
     const size_t nrules = dfa.rules.size();
 
     for (size_t i = 0; i < nstates; ++i) {
         const size_t r = dfa.states[i]->rule;
-        if (r != Rule::NONE && !live[r * nstates + i]) {
+        if (r != Rule::NONE && !live.test(r, i)) {
             // skip last rule (it's the NONE-rule)
             for (size_t j = 0; j < nrules; ++j) {
-                if (live[j * nstates + i]) {
+                if (live.test(j, i)) {
                     dfa.rules[r].shadow.insert(dfa.rules[j].semact->loc.line);
                 }
             }
@@ -173,15 +174,19 @@ static void warn_dead_rules(Tdfa& dfa, const std::string& cond, const bool* live
     }
 
     for (size_t i = 0; i < nrules; ++i) {
-        // default rule '*' should not be reported
-        if (i != dfa.def_rule && !live[i * nstates]) {
+        // default rule '*' and keyword rules (see note [keyword lookup]) should not be reported
+        if (i != dfa.def_rule && dfa.rules[i].kwrule == Rule::NONE && !live.test(i, 0)) {
             msg.warn.unreachable_rule(cond, dfa.rules[i]);
         }
     }
 }
 
 static void warn_sentinel_in_midrule(
-        const Tdfa& dfa, const opt_t* opts, const std::string& cond, const bool* live, Msg& msg) {
+        const Tdfa& dfa,
+        const opt_t* opts,
+        const std::string& cond,
+        const bitmatrix_t& live,
+        Msg& msg) {
     // perform check only in case sentinel method is used
     if (opts->fill_enable || opts->fill_eof != NOEOF) return;
 
@@ -205,13 +210,13 @@ static void warn_sentinel_in_midrule(
         const size_t j = dfa.states[i]->arcs[sentcls];
         if (j == Tdfa::NIL) continue;
 
-        const size_t* arcs = dfa.states[j]->arcs;
+        const uint32_t* arcs = dfa.states[j]->arcs;
         for (size_t c = 0; c < nsym; ++c) {
             const size_t k = arcs[c];
             if (k == Tdfa::NIL) continue;
 
             for (size_t r = 0; r < nrules; ++r) {
-                bad[r] |= live[r * nstates + k];
+                bad[r] |= live.test(r, k);
             }
         }
     }
@@ -225,7 +230,7 @@ static void warn_sentinel_in_midrule(
     delete[] bad;
 }
 
-static void remove_dead_final_states(Tdfa& dfa, const bool* fallthru) {
+static void remove_dead_final_states(Tdfa& dfa, const bitword_t* fallthru) {
     const size_t nsym = dfa.nchars;
 
     for (TdfaState* s : dfa.states) {
@@ -235,7 +240,7 @@ static void remove_dead_final_states(Tdfa& dfa, const bool* fallthru) {
         bool shadowed = true;
         for (size_t c = 0; c < nsym; ++c) {
             const size_t j = s->arcs[c];
-            if (j == Tdfa::NIL || fallthru[j]) {
+            if (j == Tdfa::NIL || bit_test(fallthru, j)) {
                 shadowed = false;
                 break;
             }
@@ -243,25 +248,25 @@ static void remove_dead_final_states(Tdfa& dfa, const bool* fallthru) {
 
         if (shadowed) {
             s->rule = Rule::NONE;
-            s->tcmd[nsym] = nullptr;
+            dfa.set_tcmd(s, nsym, nullptr);
         }
     }
 }
 
-static void find_fallback_states(Tdfa& dfa, const bool* fallthru) {
+static void find_fallback_states(Tdfa& dfa, const bitword_t* fallthru) {
     const size_t nstate = dfa.states.size();
     const size_t nsym = dfa.nchars;
 
     for (size_t i = 0; i < nstate; ++i) {
         TdfaState* s = dfa.states[i];
-        s->fallthru = fallthru[i];
+        s->fallthru = bit_test(fallthru, i);
         if (s->rule == Rule::NONE) continue;
 
         // A final state is a fallback state if there are non-accepting paths from it (i.e. paths
         // that end with a transition to default state).
         for (size_t c = 0; c < nsym; ++c) {
             const size_t j = s->arcs[c];
-            if (j != Tdfa::NIL && fallthru[j]) {
+            if (j != Tdfa::NIL && bit_test(fallthru, j)) {
                 s->fallback = true;
                 break;
             }
@@ -311,11 +316,9 @@ void cutoff_dead_rules(Tdfa& dfa, const opt_t* opts, const std::string& cond, Ms
         remove_dead_final_states_with_eof_rule(dfa);
     } else {
         const RevDfa rdfa(dfa);
-        const size_t ns = rdfa.nstates;
-        const size_t nl = (rdfa.nrules + 1) * ns;
-        bool* live = new bool[nl];
-        bool* fallthru = live + nl - ns;
-        memset(live, 0, nl * sizeof(bool));
+        // one row per rule plus the "none-rule", one column per state
+        bitmatrix_t live(rdfa.nrules + 1, rdfa.nstates);
+        const bitword_t* fallthru = live.row(rdfa.nrules);
 
         liveness_analysis(rdfa, live);
 
@@ -323,8 +326,6 @@ void cutoff_dead_rules(Tdfa& dfa, const opt_t* opts, const std::string& cond, Ms
         remove_dead_final_states(dfa, fallthru);
         warn_sentinel_in_midrule(dfa, opts, cond, live, msg);
         find_fallback_states(dfa, fallthru);
-
-        delete[] live;
     }
 }
 
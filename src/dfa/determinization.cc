@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <memory>
+#include <new>
 #include <set>
 #include <string>
 #include <vector>
@@ -13,6 +14,7 @@
 #include "src/regexp/rule.h"
 #include "src/regexp/tag.h"
 #include "src/util/check.h"
+#include "src/util/hash64.h"
 #include "src/util/range.h"
 
 namespace re2c {
@@ -20,6 +22,7 @@ namespace re2c {
 template<typename ctx_t> static Ret determinization(ctx_t& ctx) NODISCARD;
 template<typename ctx_t> static void clear_caches(ctx_t& ctx);
 template<typename ctx_t> static void warn_nondeterministic_tags(const ctx_t& ctx);
+template<typename ctx_t> static bool dump_transitions(const ctx_t& ctx);
 
 Tdfa::Tdfa(DfaAllocator& dfa_alc, size_t charset_bounds, size_t def_rule, size_t eof_rule)
     : dfa_alc(dfa_alc),
@@ -46,10 +49,22 @@ Ret determinization(Tnfa&& nfa, Tdfa& dfa, const opt_t* opts, Msg& msg, const st
     }
 }
 
-Tdfa::~Tdfa() {
-    for (TdfaState* s : states) {
-        delete s;
+TdfaState* Tdfa::add_state() {
+    uint32_t* arcs = ir_alc.alloct<uint32_t>(nchars);
+    std::fill(arcs, arcs + nchars, NIL);
+    TdfaState* s = new(ir_alc.alloct<TdfaState>(1)) TdfaState(arcs);
+    states.push_back(s);
+    return s;
+}
+
+void Tdfa::set_tcmd(TdfaState* s, size_t c, tcmd_t* cmd) {
+    if (!s->tcmd) {
+        if (!cmd) return; // the row is allocated only for non-empty commands
+        const size_t n = nchars + 2; // +2 for final and fallback epsilon-transitions
+        s->tcmd = ir_alc.alloct<tcmd_t*>(n);
+        std::fill(s->tcmd, s->tcmd + n, nullptr);
     }
+    s->tcmd[c] = cmd;
 }
 
 template<typename ctx_t>
@@ -64,12 +79,16 @@ Ret determinization(ctx_t& ctx) {
 
     // Iterate while new kernels are added: for each alphabet symbol, build tagged epsilon-closure
     // of all reachable TNFA states, then find identical or mappable TDFA state or add a new one.
+    // Symbols with empty reach set lead to the default state and need no processing (transitions
+    // of a new TDFA state are initially set to the default state).
     for (uint32_t i = 0; i < ctx.kernels.size(); ++i) {
         ctx.origin = i;
         clear_caches(ctx);
+        live_symbols(ctx);
 
-        for (uint32_t c = 0; c < ctx.dfa.nchars; ++c) {
+        for (uint32_t c : ctx.symbols) {
             reach_on_symbol(ctx, c);
+            if (reuse_transition(ctx)) continue;
             tagged_epsilon_closure(ctx);
             find_state(ctx);
 
@@ -85,8 +104,10 @@ Ret determinization(ctx_t& ctx) {
 
     warn_nondeterministic_tags(ctx);
 
-    // Move ownership of common data from determinization context to TDFA.
-    ctx.dfa.ir_alc = std::move(ctx.ir_alc);
+    // Move ownership of common data from determinization context to TDFA. TDFA allocator already
+    // holds the states, so it takes over the slabs of the context allocator rather than being
+    // replaced by it.
+    ctx.dfa.ir_alc.splice(ctx.ir_alc);
     ctx.dfa.charset = std::move(ctx.charset);
     ctx.dfa.rules = std::move(ctx.rules);
     ctx.dfa.tags = std::move(ctx.tags);
@@ -96,6 +117,8 @@ Ret determinization(ctx_t& ctx) {
 template<typename ctx_t>
 void clear_caches(ctx_t& ctx) {
     ctx.newvers.clear();
+    ctx.reachtbl.clear();
+    ctx.reachbuf.clear();
 
     const size_t ntags = ctx.tags.size();
     for (size_t t = 0; t < ntags; ++t) {
@@ -103,6 +126,49 @@ void clear_caches(ctx_t& ctx) {
     }
 }
 
+// Find symbols with non-empty reach set in the current kernel. Rather than checking each symbol
+// for each kernel item, go over the ranges of kernel items and mark all symbols that fall into
+// them: the cost is proportional to the number of ranges, not to the size of the alphabet.
+//
+// Debug dumps of the determinization process expect a closure for every symbol (closure statistics
+// are printed even for an empty closure), so with these dumps all symbols are processed.
+template<typename ctx_t>
+void live_symbols(ctx_t& ctx) {
+    const kernel_t* kernel = ctx.kernels[ctx.origin];
+    const uint32_t* charset = ctx.charset.data();
+    const size_t nsym = ctx.dfa.nchars;
+    bitword_t* bits = ctx.symbits.data();
+    const size_t nwords = ctx.symbits.size();
+
+    ctx.symbols.clear();
+    if (dump_transitions(ctx)) {
+        for (uint32_t c = 0; c < nsym; ++c) {
+            ctx.symbols.push_back(c);
+        }
+        return;
+    }
+
+    bits_clear(bits, nwords);
+    for (size_t i = 0; i < kernel->size; ++i) {
+        const TnfaState* s = kernel->state[i];
+        if (s->kind != TnfaState::Kind::RAN) continue;
+
+        // Symbol `c` belongs to the range iff its lower bound `charset[c]` does (the same check as
+        // in `transition`).
+        for (const Range* r = s->ran; r; r = r->next()) {
+            size_t c = static_cast<size_t>(
+                std::lower_bound(charset, charset + nsym, r->lower()) - charset);
+            for (; c < nsym && charset[c] < r->upper(); ++c) {
+                bit_set(bits, c);
+            }
+        }
+    }
+
+    bits_for_each(bits, nwords, [&ctx](size_t c) {
+        ctx.symbols.push_back(static_cast<uint32_t>(c));
+    });
+}
+
 template<typename ctx_t>
 void reach_on_symbol(ctx_t& ctx, uint32_t sym) {
     ctx.symbol = sym;
@@ -126,6 +192,64 @@ void reach_on_symbol(ctx_t& ctx, uint32_t sym) {
     }
 }
 
+// note [memoization of epsilon closures]
+//
+// Different symbols often have identical reach sets in a given kernel (e.g. all letters in a state
+// that matches an identifier). Reach set is fully determined by the list of kernel items that have
+// a transition on the symbol (the TNFA state, tag versions and history of each reach item are taken
+// from the kernel item). The closure, the resulting TDFA state and tag actions are fully determined
+// by the reach set and the kernel, so for a repeated reach set they are copied from the first
+// symbol with this reach set instead of being recomputed. The set of new tag versions is kept for
+// the whole kernel (see `clear_caches`), so the computation would produce the same result anyway.
+//
+// Tag actions are not shared, but duplicated: tag optimizations later modify actions in place,
+// separately for each transition.
+//
+// Debug dumps of the determinization process (raw TDFA, tag history trees and closure statistics)
+// show the closure of each transition, so with these dumps the transitions are not copied: they are
+// built in full and go through the same dump hooks as any other transition.
+template<typename ctx_t>
+bool reuse_transition(ctx_t& ctx) {
+    if (dump_transitions(ctx)) return false;
+
+    std::vector<uint32_t>& buf = ctx.reachbuf;
+
+    // append origins of the current reach set to the buffer
+    const uint32_t lower = static_cast<uint32_t>(buf.size());
+    for (const clos_t& c : ctx.reach) {
+        buf.push_back(c.origin);
+    }
+    const uint32_t upper = static_cast<uint32_t>(buf.size());
+    const uint32_t size = upper - lower;
+    const reach_t reach = {ctx.symbol, lower, upper};
+
+    const uint64_t hash = hash64(size, buf.data() + lower, size * sizeof(uint32_t));
+    auto eq = [&buf](const reach_t& x, const reach_t& y) {
+        return x.upper - x.lower == y.upper - y.lower
+            && std::equal(buf.begin() + x.lower, buf.begin() + x.upper, buf.begin() + y.lower);
+    };
+    const uint32_t i = ctx.reachtbl.find_with(hash, reach, eq);
+    if (i == reachtbl_t::NIL) {
+        ctx.reachtbl.push(hash, reach);
+        return false;
+    }
+
+    // same reach set as on some previous symbol: copy the transition
+    buf.resize(lower);
+    const uint32_t sym = ctx.symbol, prev = ctx.reachtbl[i].symbol;
+    Tdfa& dfa = ctx.dfa;
+    TdfaState* s = dfa.states[ctx.origin];
+    s->arcs[sym] = s->arcs[prev];
+    dfa.set_tcmd(s, sym, dfa.tcpool.duplicate(s->cmd(prev)));
+    return true;
+}
+
+template<typename ctx_t>
+bool dump_transitions(const ctx_t& ctx) {
+    const opt_t* opts = ctx.opts;
+    return opts->dump_dfa_raw || opts->dump_dfa_tree || opts->dump_closure_stats;
+}
+
 TnfaState* transition(TnfaState* state, uint32_t symbol) {
     if (state->kind != TnfaState::Kind::RAN) {
         return nullptr;
@@ -252,6 +376,10 @@ determ_context_t<history_t>::determ_context_t(Tnfa&& nfa,
       buffers(),
       hc_caches(),
       newvers(newver_cmp_t<history_t>(history, hc_caches)),
+      symbits(),
+      symbols(),
+      reachtbl(),
+      reachbuf(),
       path1(),
       path2(),
       path3(),
@@ -278,6 +406,8 @@ determ_context_t<history_t>::determ_context_t(Tnfa&& nfa,
     state.reserve(nstates);
 
     hc_caches.resize(ntags);
+    symbits.resize(bit_words(dfa.nchars));
+    symbols.reserve(dfa.nchars);
     path1.reserve(ntags);
     path2.reserve(ntags);
     path3.reserve(ntags);
@@ -302,8 +432,12 @@ determ_context_t<history_t>::~determ_context_t() {
 }
 
 // explicit instantiation for context types
+template void live_symbols<ldetctx_t>(ldetctx_t& ctx);
+template void live_symbols<pdetctx_t>(pdetctx_t& ctx);
 template void reach_on_symbol<ldetctx_t>(ldetctx_t& ctx, uint32_t sym);
 template void reach_on_symbol<pdetctx_t>(pdetctx_t& ctx, uint32_t sym);
+template bool reuse_transition<ldetctx_t>(ldetctx_t& ctx);
+template bool reuse_transition<pdetctx_t>(pdetctx_t& ctx);
 template uint32_t init_tag_versions<ldetctx_t>(ldetctx_t& ctx);
 template uint32_t init_tag_versions<pdetctx_t>(pdetctx_t& ctx);
 template determ_context_t<lhistory_t>::~determ_context_t();
@@ -15,6 +15,7 @@
 #include "src/dfa/tag_history.h"
 #include "src/regexp/tag.h"
 #include "src/util/allocator.h"
+#include "src/util/bitset.h"
 #include "src/util/containers.h"
 #include "src/util/forbid_copy.h"
 
@@ -57,7 +58,7 @@ struct newver_t {
     hidx_t history;
 };
 
-using hc_cache_t = std::map<uint64_t, int32_t>; // 'hc' for history comparison
+using hc_cache_t = hash_table_t<int32_t>; // 'hc' for history comparison
 using hc_caches_t = std::vector<hc_cache_t>;
 
 template<typename history_t>
@@ -105,6 +106,15 @@ struct histleaf_t {
 
 using kernels_t = lookup_t<const kernel_t*>;
 
+// reach set on the given symbol (see note [memoization of epsilon closures])
+struct reach_t {
+    uint32_t symbol;
+    uint32_t lower; // bounds of the list of origins in the reach buffer
+    uint32_t upper;
+};
+
+using reachtbl_t = lookup_t<reach_t>;
+
 template<typename history_type_t>
 struct determ_context_t {
     using conf_t = clos_t;
@@ -144,6 +154,10 @@ struct determ_context_t {
     kernel_buffers_t buffers;
     hc_caches_t hc_caches;          // per-tag cache of history comparisons
     newvers_t newvers;              // map of triples (tag, version, history) to new version
+    std::vector<bitword_t> symbits; // symbols with non-empty reach set in the current kernel
+    std::vector<uint32_t> symbols;  // same symbols as a sorted list
+    reachtbl_t reachtbl;            // reach sets of the current kernel (by hash)
+    std::vector<uint32_t> reachbuf; // origins of items in all reach sets in `reachtbl`
     tag_path_t path1;               // buffer 1 for tag history
     tag_path_t path2;               // buffer 2 for tag history
     tag_path_t path3;               // buffer 3 for tag history
@@ -181,7 +195,9 @@ template<typename ctx_t> void tagged_epsilon_closure(ctx_t& ctx);
 template<typename ctx_t> void closure(ctx_t& ctx);
 template<typename ctx_t> void find_state(ctx_t& ctx);
 template<typename ctx_t, bool b> bool do_find_state(ctx_t& ctx);
+template<typename ctx_t> void live_symbols(ctx_t& ctx);
 template<typename ctx_t> void reach_on_symbol(ctx_t& ctx, uint32_t sym);
+template<typename ctx_t> bool reuse_transition(ctx_t& ctx);
 template<typename ctx_t> uint32_t init_tag_versions(ctx_t& ctx);
 TnfaState* transition(TnfaState*, uint32_t);
 
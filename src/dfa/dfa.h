@@ -4,7 +4,6 @@
 #include <stdint.h>
 #include <vector>
 #include <set>
-#include <string.h>
 
 #include "src/constants.h"
 #include "src/msg/msg.h"
@@ -20,30 +19,35 @@ namespace re2c {
 struct Tnfa;
 struct opt_t;
 
+// note [TDFA state storage]
+//
+// Large DFAs (especially Unicode ones with many character classes) may have tens of thousands of
+// states, each with a row of transitions and a row of tag commands per symbol. To keep memory
+// usage low, all rows are allocated in the TDFA-local slab allocator (they live as long as the
+// TDFA and are never freed individually), transitions are 32-bit, and the rows are compact:
+//   - The row of tag commands is allocated lazily on the first non-empty command; a state without
+//     tagged transitions (all states in a DFA without tags) has no row at all.
+//   - Rows of frozen command IDs are interned (see note [tag freezing]): states with identical
+//     rows share one copy, and most states share the all-TCID0 row.
 struct TdfaState {
-    size_t* arcs;
-    tcmd_t** tcmd;
-    tcid_t* tcid;
+    uint32_t* arcs;     // target state on each symbol, or Tdfa::NIL
+    tcmd_t** tcmd;      // tag commands on each symbol + final and fallback (null if all empty)
+    const tcid_t* tcid; // frozen tag commands (interned row, valid after `freeze_tags`)
     size_t rule;
     bool fallthru;
     bool fallback;
 
-    explicit TdfaState(size_t nchars)
-        : arcs(new size_t[nchars]),
+    explicit TdfaState(uint32_t* arcs)
+        : arcs(arcs),
           tcmd(nullptr),
           tcid(nullptr),
           rule(Rule::NONE),
           fallthru(false),
-          fallback(false) {
-        size_t sz = nchars + 2; // +2 for final and fallback epsilon-transitions
-        tcmd = new tcmd_t* [sz];
-        memset(tcmd, 0, sizeof (tcmd_t*) * sz);
-    }
+          fallback(false) {}
 
-    ~TdfaState() {
-        delete[] arcs;
-        delete[] tcmd;
-        delete[] tcid;
+    // Returns tag commands on the given symbol (or final/fallback quasi-symbol).
+    tcmd_t* cmd(size_t c) const {
+        return tcmd ? tcmd[c] : nullptr;
     }
 
     FORBID_COPY(TdfaState);
@@ -69,7 +73,12 @@ struct Tdfa {
     size_t eof_rule;
 
     Tdfa(DfaAllocator& dfa_alc, size_t charset_bounds, size_t def_rule, size_t eof_rule);
-    ~Tdfa();
+
+    // Allocates a new state with no transitions and no tag commands (see note [TDFA state storage]).
+    TdfaState* add_state();
+
+    // Sets tag commands on the given symbol (or final/fallback quasi-symbol) of the given state.
+    void set_tcmd(TdfaState* s, size_t c, tcmd_t* cmd);
 
     FORBID_COPY(Tdfa);
 };
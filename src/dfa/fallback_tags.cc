@@ -34,7 +34,7 @@ static void find_overwritten_tags(const Tdfa& dfa, size_t state, bool* been, boo
 
     const TdfaState* s = dfa.states[state];
     for (size_t c = 0; c < dfa.nchars; ++c) {
-        for (const tcmd_t* p = s->tcmd[c]; p; p = p->next) {
+        for (const tcmd_t* p = s->cmd(c); p; p = p->next) {
             owrt[p->lhs] = true;
         }
 
@@ -52,8 +52,7 @@ static void backup(Tdfa& dfa, TdfaState* s, tagver_t l, tagver_t r) {
     for (size_t c = 0; c < dfa.nchars; ++c) {
         size_t i = s->arcs[c];
         if (i != Tdfa::NIL && dfa.states[i]->fallthru) {
-            tcmd_t*& p = s->tcmd[c];
-            p = dfa.tcpool.make_copy(p, l, r);
+            dfa.set_tcmd(s, c, dfa.tcpool.make_copy(s->cmd(c), l, r));
         }
     }
 }
@@ -72,7 +71,8 @@ void insert_fallback_tags(Tdfa& dfa) {
 
     for (size_t i = 0; i < nstates; ++i) {
         TdfaState* s = dfa.states[i];
-        if (!s->fallback) continue;
+        // no final commands means no fallback commands (and maybe no row of commands at all)
+        if (!s->fallback || !s->cmd(nsym)) continue;
 
         std::fill(been, been + nstates, false);
         std::fill(owrt, owrt + nver, false);
@@ -32,7 +32,7 @@ namespace {
 static constexpr size_t SCC_INF = std::numeric_limits<size_t>::max();
 static constexpr size_t SCC_UND = SCC_INF - 1;
 
-static bool loopback(size_t state, size_t narcs, const size_t* arcs) {
+static bool loopback(size_t state, size_t narcs, const uint32_t* arcs) {
     for (size_t i = 0; i < narcs; ++i) {
         if (arcs[i] == state) return true;
     }
@@ -58,7 +58,7 @@ static void scc(const Tdfa& dfa, std::vector<bool>& trivial, std::vector<StackIt
         size_t link = stack_dfs.back().link;
         stack_dfs.pop_back();
 
-        const size_t* arcs = dfa.states[i]->arcs;
+        const uint32_t* arcs = dfa.states[i]->arcs;
 
         if (c == 0) {
             // DFS recursive enter
@@ -117,7 +117,7 @@ static void calc_fill(const Tdfa& dfa,
         size_t c = stack_dfs.back().symbol;
         stack_dfs.pop_back();
 
-        const size_t* arcs = dfa.states[i]->arcs;
+        const uint32_t* arcs = dfa.states[i]->arcs;
 
         if (c == 0) {
             // DFS recursive enter
@@ -13,7 +13,7 @@
 #include "src/regexp/tag.h"
 #include "src/regexp/rule.h"
 #include "src/util/check.h"
-#include "src/util/hash32.h"
+#include "src/util/hash64.h"
 
 namespace re2c {
 
@@ -81,7 +81,7 @@ static kernel_t* make_new_kernel(size_t, IrAllocator&);
 static kernel_t* make_kernel_copy(const kernel_t*, IrAllocator&);
 static void copy_to_buffer(const closure_t&, const prectable_t*, kernel_t*);
 static void group_by_tag(tag_path_t&, tag_path_t&, std::vector<uint32_t>&);
-static uint32_t hash_kernel(const kernel_t*);
+static uint64_t hash_kernel(const kernel_t*);
 
 // explicit instantiation for context types
 template void find_state<pdetctx_t>(pdetctx_t& ctx);
@@ -99,21 +99,20 @@ void find_state(ctx_t& ctx) {
 
     if (is_new) {
         // create new DFA state
-        TdfaState* t = new TdfaState(dfa.nchars);
-        dfa.states.push_back(t);
+        TdfaState* t = dfa.add_state();
 
         // check if the new state is final (see note [at most one final item per closure])
         cclositer_t f = std::find_if(ctx.state.begin(), ctx.state.end(), clos_t::fin);
         if (f != ctx.state.end()) {
             t->rule = f->state->rule;
-            t->tcmd[dfa.nchars] = final_actions(ctx, *f);
+            dfa.set_tcmd(t, dfa.nchars, final_actions(ctx, *f));
         }
     }
 
     if (ctx.origin != Tdfa::NIL) {
         TdfaState* s = dfa.states[ctx.origin];
         s->arcs[ctx.symbol] = ctx.target;
-        s->tcmd[ctx.symbol] = ctx.actions;
+        dfa.set_tcmd(s, ctx.symbol, ctx.actions);
     }
 
     DDUMP_DFA_RAW(ctx, is_new);
@@ -140,7 +139,7 @@ bool do_find_state(ctx_t& ctx) {
     copy_to_buffer(closure, ctx.newprectbl, k);
 
     // hash "static" part of the kernel
-    const uint32_t hash = hash_kernel(k);
+    const uint64_t hash = hash_kernel(k);
 
     // try to find identical kernel
     kernel_eq_t<ctx_t> cmp_eq = {ctx};
@@ -232,18 +231,18 @@ kernel_t* make_kernel_copy(const kernel_t* kernel, IrAllocator& alc) {
     return k;
 }
 
-uint32_t hash_kernel(const kernel_t* kernel) {
+uint64_t hash_kernel(const kernel_t* kernel) {
     const size_t n = kernel->size;
 
     // seed
-    uint32_t h = static_cast<uint32_t>(n);
+    uint64_t h = static_cast<uint64_t>(n);
 
     // TNFA states
-    h = hash32(h, kernel->state, n * sizeof(void*));
+    h = hash64(h, kernel->state, n * sizeof(void*));
 
     // precedence table
     if (kernel->prectbl) {
-        h = hash32(h, kernel->prectbl, n * n * sizeof(prectable_t));
+        h = hash64(h, kernel->prectbl, n * n * sizeof(prectable_t));
     }
 
     return h;
@@ -1,4 +1,5 @@
 #include <string.h>
+#include <algorithm>
 #include <map>
 #include <utility>
 #include <vector>
@@ -36,6 +37,26 @@ namespace re2c {
  * The algorithm loops until partition stops changing.
  */
 
+/*
+ * note [DFA minimization: Hopcroft algorithm]
+ *
+ * The algorithm maintains partition of DFA states and a worklist
+ * of "splitter" sets. Initial partition is the same as in Moore
+ * algorithm, except that states are also distinguished by tag
+ * commands on outgoing transitions (these do not depend on the
+ * partition, so it suffices to check them once). Missing
+ * transitions go to an artificial "dead" state that is always
+ * in a separate set.
+ *
+ * For each splitter taken from the worklist and for each symbol,
+ * the algorithm finds all states that have a transition on this
+ * symbol into the splitter (using inverse transition lists), and
+ * splits each set that contains both such and other states. If
+ * the split set is in the worklist, both halves are put in the
+ * worklist; otherwise it suffices to add only the smaller half.
+ * This gives O(k n log n) time, where k is the number of symbols.
+ */
+
 /* note [distinguish states by tags]
  *
  * Final states may have 'rule' tags: tags that must be set when lexer
@@ -58,6 +79,7 @@ using moore_init_t = std::map<moore_key_t, size_t>;
 static bool operator <(const moore_key_t&, const moore_key_t&);
 static void minimization_table(size_t*, const std::vector<TdfaState*>&, size_t);
 static void minimization_moore(size_t*, const std::vector<TdfaState*>&, size_t);
+static void minimization_hopcroft(size_t*, const std::vector<TdfaState*>&, size_t);
 
 
 void minimization(Tdfa& dfa, Minimization type) {
@@ -69,6 +91,8 @@ void minimization(Tdfa& dfa, Minimization type) {
         minimization_table(part, dfa.states, dfa.nchars); break;
     case Minimization::MOORE:
         minimization_moore(part, dfa.states, dfa.nchars); break;
+    case Minimization::HOPCROFT:
+        minimization_hopcroft(part, dfa.states, dfa.nchars); break;
     }
 
     size_t* compact = new size_t[count];
@@ -78,20 +102,20 @@ void minimization(Tdfa& dfa, Minimization type) {
         }
     }
 
+    // Keep only class representatives. Other states are simply dropped: their memory is owned by
+    // the TDFA allocator (see note [TDFA state storage]).
     size_t new_count = 0;
     for (size_t i = 0; i < count; ++i) {
         TdfaState* s = dfa.states[i];
 
         if (i == part[i]) {
-            size_t* arcs = s->arcs;
+            uint32_t* arcs = s->arcs;
             for (size_t c = 0; c < dfa.nchars; ++c) {
                 if (arcs[c] != Tdfa::NIL) {
-                    arcs[c] = compact[part[arcs[c]]];
+                    arcs[c] = static_cast<uint32_t>(compact[part[arcs[c]]]);
                 }
             }
             dfa.states[new_count++] = s;
-        } else {
-            delete s;
         }
     }
     dfa.states.resize(new_count);
@@ -203,7 +227,7 @@ void minimization_moore(size_t* part, const std::vector<TdfaState*>& states, siz
 
             for (size_t j = i; j != Tdfa::NIL; j = next[j]) {
                 size_t* o = &out[j * nchars];
-                size_t* a = states[j]->arcs;
+                const uint32_t* a = states[j]->arcs;
 
                 for (size_t c = 0; c < nchars; ++c) {
                     o[c] = a[c] == Tdfa::NIL ? Tdfa::NIL : part[a[c]];
@@ -246,6 +270,161 @@ void minimization_moore(size_t* part, const std::vector<TdfaState*>& states, siz
     delete[] next;
 }
 
+void minimization_hopcroft(size_t* part, const std::vector<TdfaState*>& states, size_t nchars) {
+    const size_t count = states.size();
+    const size_t dead = count; // artificial state for missing transitions
+    const size_t nstates = count + 1;
+
+    // Inverse transitions on each symbol, grouped by target state: sources of transitions on
+    // symbol `c` into state `t` are `inv[inv_beg[c * (nstates + 1) + t] .. next offset]`.
+    const size_t stride = nstates + 1;
+    size_t* inv_beg = new size_t[nchars * stride];
+    size_t* inv = new size_t[nchars * nstates];
+    for (size_t c = 0; c < nchars; ++c) {
+        size_t* beg = &inv_beg[c * stride];
+        memset(beg, 0, stride * sizeof(size_t));
+        for (size_t i = 0; i < count; ++i) {
+            const size_t t = states[i]->arcs[c];
+            ++beg[(t == Tdfa::NIL ? dead : t) + 1];
+        }
+        ++beg[dead + 1];
+        for (size_t t = 0; t < nstates; ++t) {
+            beg[t + 1] += beg[t];
+        }
+        size_t* pos = new size_t[nstates];
+        memcpy(pos, beg, nstates * sizeof(size_t));
+        size_t* in = &inv[c * nstates];
+        for (size_t i = 0; i < count; ++i) {
+            const size_t t = states[i]->arcs[c];
+            in[pos[t == Tdfa::NIL ? dead : t]++] = i;
+        }
+        in[pos[dead]++] = dead;
+        delete[] pos;
+    }
+
+    // Partition: states of each set are stored contiguously in `elems[first[b] .. last[b]]`, and
+    // the states that have been marked during the current split are at the beginning of the set.
+    size_t* elems = new size_t[nstates];
+    size_t* index = new size_t[nstates]; // position of each state in `elems`
+    size_t* block = new size_t[nstates]; // set of each state
+    std::vector<size_t> first, last, marked;
+    std::vector<bool> in_worklist;
+    std::vector<size_t> worklist, touched, splitter;
+
+    // Initial partition: see note [distinguish states by tags]. Sort states by rule, tag commands
+    // on the final transition and tag commands on symbol transitions, then form sets of equal
+    // states. The dead state goes last and forms a separate set.
+    auto compare = [&](size_t i, size_t j) {
+        const TdfaState* x = states[i], *y = states[j];
+        if (x->rule != y->rule) return x->rule < y->rule ? -1 : 1;
+        if (x->tcid[nchars] != y->tcid[nchars]) return x->tcid[nchars] < y->tcid[nchars] ? -1 : 1;
+        return memcmp(x->tcid, y->tcid, nchars * sizeof(tcid_t));
+    };
+    for (size_t i = 0; i < nstates; ++i) elems[i] = i;
+    std::sort(elems, elems + count, [&](size_t i, size_t j) {
+        const int cmp = compare(i, j);
+        return cmp != 0 ? cmp < 0 : i < j;
+    });
+    for (size_t k = 0; k < nstates; ++k) {
+        const size_t i = elems[k];
+        if (k == 0 || i == dead || compare(elems[k - 1], i) != 0) {
+            first.push_back(k);
+            last.push_back(k);
+            marked.push_back(0);
+        }
+        const size_t b = first.size() - 1;
+        last[b] = k + 1;
+        index[i] = k;
+        block[i] = b;
+    }
+
+    // Put all initial sets except for the largest one in the worklist.
+    size_t largest = 0;
+    for (size_t b = 1; b < first.size(); ++b) {
+        if (last[b] - first[b] > last[largest] - first[largest]) largest = b;
+    }
+    in_worklist.assign(first.size(), false);
+    for (size_t b = 0; b < first.size(); ++b) {
+        if (b != largest) {
+            worklist.push_back(b);
+            in_worklist[b] = true;
+        }
+    }
+
+    while (!worklist.empty()) {
+        const size_t s = worklist.back();
+        worklist.pop_back();
+        in_worklist[s] = false;
+
+        // The splitter set may itself be split while it is processed, so take a copy.
+        splitter.assign(elems + first[s], elems + last[s]);
+
+        for (size_t c = 0; c < nchars; ++c) {
+            const size_t* beg = &inv_beg[c * stride];
+            const size_t* in = &inv[c * nstates];
+
+            // Mark all states that have a transition on symbol `c` into the splitter.
+            for (size_t t : splitter) {
+                for (size_t k = beg[t]; k < beg[t + 1]; ++k) {
+                    const size_t i = in[k];
+                    const size_t b = block[i];
+                    const size_t m = first[b] + marked[b];
+                    if (index[i] < m) continue; // already marked
+
+                    if (marked[b] == 0) touched.push_back(b);
+                    const size_t j = elems[m];
+                    std::swap(elems[index[i]], elems[m]);
+                    index[j] = index[i];
+                    index[i] = m;
+                    ++marked[b];
+                }
+            }
+
+            // Split sets that have both marked and unmarked states.
+            for (size_t b : touched) {
+                const size_t m = first[b] + marked[b];
+                marked[b] = 0;
+                if (m == last[b]) continue;
+
+                // The marked part becomes a new set.
+                const size_t n = first.size();
+                first.push_back(first[b]);
+                last.push_back(m);
+                marked.push_back(0);
+                first[b] = m;
+                for (size_t k = first[n]; k < last[n]; ++k) {
+                    block[elems[k]] = n;
+                }
+
+                if (in_worklist[b]) {
+                    worklist.push_back(n);
+                    in_worklist.push_back(true);
+                } else {
+                    const bool smaller = last[n] - first[n] <= last[b] - first[b];
+                    worklist.push_back(smaller ? n : b);
+                    in_worklist.push_back(smaller);
+                    if (!smaller) in_worklist[b] = true;
+                }
+            }
+            touched.clear();
+        }
+    }
+
+    // Choose the state with the lowest index as a representative of each set.
+    std::vector<size_t> repr(first.size(), Tdfa::NIL);
+    for (size_t i = 0; i < count; ++i) {
+        size_t& r = repr[block[i]];
+        if (r == Tdfa::NIL) r = i;
+        part[i] = r;
+    }
+
+    delete[] block;
+    delete[] index;
+    delete[] elems;
+    delete[] inv;
+    delete[] inv_beg;
+}
+
 bool operator<(const moore_key_t& x, const moore_key_t& y) {
     if (x.rule < y.rule) return true;
     if (x.rule > y.rule) return false;
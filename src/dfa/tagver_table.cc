@@ -3,7 +3,7 @@
 #include <algorithm>
 
 #include "src/dfa/tagver_table.h"
-#include "src/util/hash32.h"
+#include "src/util/hash64.h"
 
 namespace re2c {
 
@@ -40,7 +40,7 @@ uint32_t tagver_table_t::insert_succ(tagver_t fst) {
 
 uint32_t tagver_table_t::insert(const tagver_t* tags) {
     const size_t size = ntags * sizeof(tagver_t);
-    const uint32_t hash = hash32(0, tags, size);
+    const uint64_t hash = hash64(0, tags, size);
 
     eqtag_t eq(ntags);
     const uint32_t idx = lookup.find_with(hash, tags, eq);
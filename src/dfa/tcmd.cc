@@ -2,7 +2,7 @@
 
 #include "src/dfa/tcmd.h"
 #include "src/util/check.h"
-#include "src/util/hash32.h"
+#include "src/util/hash64.h"
 
 namespace re2c {
 
@@ -39,7 +39,7 @@ template tcmd_t* tcpool_t::make_add<lhistory_t>(tcmd_t* next,
                                                 hidx_t hidx,
                                                 size_t tag);
 
-static uint32_t hash_tcmd(const tcmd_t* tcmd);
+static uint64_t hash_tcmd(const tcmd_t* tcmd);
 
 bool tcmd_t::equal(const tcmd_t& x, const tcmd_t& y) {
     return x.lhs == y.lhs
@@ -170,12 +170,17 @@ tcmd_t* tcpool_t::copy_add(tcmd_t* next,
     return p;
 }
 
-uint32_t hash_tcmd(const tcmd_t* tcmd) {
-    uint32_t h = 0;
+tcmd_t* tcpool_t::duplicate(const tcmd_t* cmd) {
+    if (!cmd) return nullptr;
+    return copy_add(duplicate(cmd->next), cmd->lhs, cmd->rhs, cmd->history);
+}
+
+uint64_t hash_tcmd(const tcmd_t* tcmd) {
+    uint64_t h = 0;
     for (const tcmd_t* p = tcmd; p; p = p->next) {
-        h = hash32(h, &p->lhs, sizeof(p->lhs));
-        h = hash32(h, &p->rhs, sizeof(p->rhs));
-        h = hash32(h, &p->history[0], sizeof(p->history[0]));
+        h = hash64(h, &p->lhs, sizeof(p->lhs));
+        h = hash64(h, &p->rhs, sizeof(p->rhs));
+        h = hash64(h, &p->history[0], sizeof(p->history[0]));
     }
     return h;
 }
@@ -193,7 +198,7 @@ struct tcmd_eq_t {
 };
 
 tcid_t tcpool_t::insert(const tcmd_t* tcmd) {
-    const uint32_t h = hash_tcmd(tcmd);
+    const uint64_t h = hash_tcmd(tcmd);
 
     tcmd_eq_t eq;
     size_t id = index.find_with(h, tcmd, eq);
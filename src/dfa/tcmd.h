@@ -47,6 +47,7 @@ class tcpool_t {
                                                   hidx_t hidx,
                                                   size_t tag);
     tcmd_t* copy_add(tcmd_t* next, tagver_t lhs, tagver_t rhs, const tagver_t* history);
+    tcmd_t* duplicate(const tcmd_t* cmd);
     tcid_t insert(const tcmd_t* tcmd);
     const tcmd_t* operator[](tcid_t id) const;
 };
@@ -2,12 +2,17 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <ostream>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 #include <cctype>
 
 #include "src/adfa/adfa.h"
+#include "src/codegen/cache.h"
 #include "src/codegen/output.h"
 #include "src/debug/debug.h"
 #include "src/dfa/dfa.h"
@@ -22,16 +27,19 @@
 #include "src/regexp/regexp.h"
 #include "src/regexp/rule.h"
 #include "src/skeleton/skeleton.h"
+#include "src/util/file_utils.h"
+#include "src/util/forbid_copy.h"
 #include "src/util/range.h"
+#include "src/util/time_report.h"
 
 namespace re2c {
 
-static std::string make_name(Output& output, const std::string& cond, const loc_t& loc) {
+static std::string make_name(const Msg& msg, const std::string& cond, const loc_t& loc) {
     std::string name;
 
     // if the block is included from another file, prepend filename for disambiguation
     if (loc.file > 0) {
-        name += output.msg.filenames[loc.file];
+        name += msg.filenames[loc.file];
         for (size_t i = 0; i < name.length(); ++i) {
             if (!std::isalnum(static_cast<unsigned char>(name[i]))) name[i] = '_';
         }
@@ -48,33 +56,47 @@ static std::string make_name(Output& output, const std::string& cond, const loc_
     return name;
 }
 
-LOCAL_NODISCARD(Ret ast_to_dfa(
-        const AstGram& gram, Output& output, Adfas& dfas, DfaAllocator& dfa_alc)) {
-    OutputBlock& block = output.block();
+// Convert AST for one condition to ADFA. This function does not modify the output block and uses
+// only its own message stream and allocator, so that it can run in parallel with other conditions.
+LOCAL_NODISCARD(Ret ast_to_dfa(const AstGram& gram,
+                               const OutputBlock& block,
+                               Msg& msg,
+                               DfaAllocator& dfa_alc,
+                               TimeReport& report,
+                               std::unique_ptr<Adfa>& adfa)) {
     const opt_t* opts = block.opts;
     const loc_t& loc = block.loc;
-    Msg& msg = output.msg;
     const std::vector<AstRule>& ast = gram.rules;
     const std::string&cond = gram.name;
-    const std::string name = make_name(output, cond, loc);
+    const std::string name = make_name(msg, cond, loc);
     const std::string& setup = gram.setup.empty() ? "" : gram.setup[0]->text;
+    const std::string block_name = make_name(msg, "", loc);
+    auto mark = [&](const char* phase, size_t size) { report.mark(phase, block_name, cond, size); };
+
+    report.start();
 
     // Build a mutable tree representation of a regexp from an immutable AST.
     RESpec re(opts, msg);
     CHECK_RET(re.init(ast));
+    find_keywords(re, gram.def_rule, gram.eof_rule);
+    mark("regexp", 0);
     split_charset(re);
+    mark("split_charset", 0);
     find_fixed_tags(re);
     insert_default_tags(re);
     warn_nullable(re, cond);
+    mark("tags", 0);
 
     // Transform regexp to TNFA.
     Tnfa nfa;
     CHECK_RET(re_to_nfa(nfa, std::move(re)));
+    mark("re_to_nfa", nfa.nstates);
     DDUMP_NFA(opts, nfa);
 
     // Transmorm TNFA to TDFA.
     Tdfa dfa(dfa_alc, nfa.charset.size(), gram.def_rule, gram.eof_rule);
     CHECK_RET(determinization(std::move(nfa), dfa, opts, msg, cond));
+    mark("determinization", dfa.states.size());
     DDUMP_DFA_DET(opts, dfa);
 
     // Skeleton must be constructed after TDFA construction, but prior to any other TDFA
@@ -84,10 +106,11 @@ LOCAL_NODISCARD(Ret ast_to_dfa(
     warn_undefined_control_flow(skeleton);
     if (opts->target == Target::SKELETON) {
         CHECK_RET(emit_data(skeleton));
-        output.skeletons.insert(name);
     }
+    mark("skeleton", 0);
 
     cutoff_dead_rules(dfa, opts, cond, msg);
+    mark("dead_rules", 0);
 
     insert_fallback_tags(dfa);
 
@@ -96,18 +119,19 @@ LOCAL_NODISCARD(Ret ast_to_dfa(
     DDUMP_DFA_TAGOPT(opts, dfa);
 
     freeze_tags(dfa);
+    mark("tag_optimization", 0);
 
     minimization(dfa, opts->minimization);
+    mark("minimization", dfa.states.size());
     DDUMP_DFA_MIN(opts, dfa);
 
     // find strongly connected components and calculate argument to YYFILL
     std::vector<size_t> fill;
     fillpoints(dfa, fill);
+    mark("fillpoints", 0);
 
     // Transform TDFA to ADFA (DFA with actions, tunnel automaton).
-    Adfa* adfa = new Adfa(
-            std::move(dfa), fill, skeleton.sizeof_key, loc, name, cond, setup, opts, msg);
-    dfas.push_back(std::unique_ptr<Adfa>(adfa));
+    adfa.reset(new Adfa(std::move(dfa), fill, skeleton.sizeof_key, loc, name, cond, setup, opts));
 
     // see note [reordering DFA states]
     adfa->reorder();
@@ -115,24 +139,121 @@ LOCAL_NODISCARD(Ret ast_to_dfa(
     // skeleton is constructed, do further DFA transformations
     adfa->prepare(opts);
     DDUMP_ADFA(opts, *adfa);
+    mark("adfa", 0);
+
+    return Ret::OK;
+}
+
+// Add ADFA to the current output block. DFAs must be added in the order of conditions, as the
+// generated code (and the order of error messages) depends on it.
+LOCAL_NODISCARD(Ret add_dfa(Output& output, std::unique_ptr<Adfa>&& adfa)) {
+    OutputBlock& block = output.block();
+
+    if (block.opts->target == Target::SKELETON) {
+        output.skeletons.insert(adfa->name);
+    }
 
     // gather overall DFA statistics and add it to the output block
-    CHECK_RET(adfa->calc_stats(block));
+    CHECK_RET(adfa->calc_stats(block, output.msg));
     block.max_fill = std::max(block.max_fill, adfa->max_fill);
     block.max_nmatch = std::max(block.max_nmatch, adfa->max_nmatch);
     block.used_yyaccept = block.used_yyaccept || adfa->need_accept;
 
+    block.dfas.push_back(std::move(adfa));
+    return Ret::OK;
+}
+
+// A unit of work for the parallel mode: conversion of AST to DFA for one condition. Each job has a
+// separate message stream that is merged into the main one after the job is done.
+struct DfaJob {
+    const AstGram& gram;
+    FILE* diag;
+    Msg msg;
+    Ret ret;
+    TimeReport report;
+    std::unique_ptr<Adfa> adfa;
+
+    DfaJob(const AstGram& gram, const Msg& msg, FILE* diag, bool time_report)
+        : gram(gram), diag(diag), msg(msg, diag), ret(Ret::OK), report(time_report), adfa() {}
+    ~DfaJob() { fclose(diag); }
+    FORBID_COPY(DfaJob);
+};
+
+// Number of worker threads for `-j, --jobs`: it makes no sense to run more threads than the hardware
+// can run in parallel (the number of DFAs or batch jobs is a further limit).
+static uint32_t max_threads(uint32_t jobs) {
+    return std::max(1u, std::min(jobs, std::thread::hardware_concurrency()));
+}
+
+// Convert AST to DFA for each condition in the block, distributing conditions between worker
+// threads. Each worker has its own DFA allocator (allocators are not thread-safe, and DFAs must be
+// kept alive until the end of codegen). Results are merged in the order of conditions, so the
+// output is the same as in the serial mode.
+LOCAL_NODISCARD(Ret ast_to_dfa_parallel(
+        const AstGrams& grams,
+        Output& output,
+        std::vector<DfaAllocator>& dfa_alcs,
+        TimeReport& report)) {
+    const OutputBlock& block = output.block();
+    const size_t njobs = grams.size();
+
+    std::vector<std::unique_ptr<DfaJob>> jobs;
+    jobs.reserve(njobs);
+    for (const AstGram& gram : grams) {
+        FILE* diag = tmpfile();
+        if (diag == nullptr) RET_FAIL(error("cannot create temporary file"));
+        jobs.emplace_back(new DfaJob(gram, output.msg, diag, report.is_enabled()));
+    }
+
+    // worker threads count memory in the statistics of this compilation, see `alloc_stats_t`
+    alloc_stats_t* stats = thread_alloc_stats();
+    std::atomic<size_t> next(0);
+    auto worker = [&](DfaAllocator& dfa_alc) {
+        thread_alloc_stats() = stats;
+        for (size_t i; (i = next++) < njobs;) {
+            DfaJob& job = *jobs[i];
+            job.ret = ast_to_dfa(job.gram, block, job.msg, dfa_alc, job.report, job.adfa);
+        }
+    };
+
+    const size_t nthreads = std::min(dfa_alcs.size(), njobs);
+    std::vector<std::thread> threads;
+    threads.reserve(nthreads - 1);
+    for (size_t i = 1; i < nthreads; ++i) {
+        threads.emplace_back(worker, std::ref(dfa_alcs[i]));
+    }
+    worker(dfa_alcs[0]); // the main thread is also a worker
+    for (std::thread& t : threads) t.join();
+
+    for (std::unique_ptr<DfaJob>& job : jobs) {
+        output.msg.merge(job->msg);
+        report.merge(job->report);
+        CHECK_RET(job->ret);
+        CHECK_RET(add_dfa(output, std::move(job->adfa)));
+    }
     return Ret::OK;
 }
 
-LOCAL_NODISCARD(Ret compile(int, char* argv[])) {
+static Ret compile_batch(
+        const char* prog, const std::vector<std::string>& args, const conopt_t& globopts) NODISCARD;
+static Ret serve(const char* prog, const std::vector<std::string>& args) NODISCARD;
+
+// Compile one source file. Paths of the generated files are stored in `outputs`. If `memcache` is
+// not null, it is used as the compilation cache (see note [compile server]).
+LOCAL_NODISCARD(Ret compile(
+        int argc, char* argv[], std::vector<std::string>& outputs, MemoryCache* memcache)) {
+    // Memory statistics of this compilation (it must outlive the allocators below). In batch mode
+    // files are compiled in parallel, and their statistics should not be mixed.
+    alloc_stats_scope_t alloc_stats;
+
     // Allocator for objects with whole-program lifetime (from parsing to codegen).
     OutAllocator out_alc;
     // Allocator for AST (parts of AST from one block may be reused by other blocks, so they need
     // to be alive during parsing of the whole program).
     AstAllocator ast_alc;
-    // Allocator for DFAs (only the final stage, not all the intermediate representations).
-    DfaAllocator dfa_alc;
+    // Allocators for DFAs (only the final stage, not all the intermediate representations). There
+    // is one allocator per thread in the parallel mode, the first one is used by the main thread.
+    std::vector<DfaAllocator> dfa_alcs(1);
 
     Msg msg;
 
@@ -142,11 +263,35 @@ LOCAL_NODISCARD(Ret compile(int, char* argv[])) {
     Opt opts(out_alc, msg);
     const conopt_t& globopts = opts.global();
     Input input(out_alc, &globopts, msg);
+    const std::vector<std::string> args(argv + 1, argv + argc); // parsing may modify `argv`
     CHECK_RET(opts.parse(argv, input));
+    if (!globopts.batch_file.empty()) return compile_batch(argv[0], args, globopts);
+    if (globopts.server) return serve(argv[0], args);
+    dfa_alcs.resize(max_threads(globopts.jobs));
+
+    // Per-phase timing and memory statistics, see note [time report].
+    TimeReport report(!globopts.time_report.empty());
+
+    // If the generated files for this input are in the cache, there is nothing else to do.
+    // See note [compilation cache].
+    Cache cache(&globopts, memcache);
+    bool cache_hit;
+    report.start();
+    CHECK_RET(cache.lookup(args, cache_hit, outputs));
+    if (cache_hit) {
+        // The report has a single phase (the time spent on the lookup and copying the files).
+        report.mark("cache");
+        if (report.is_enabled() && !report.write(globopts.time_report)) {
+            RET_FAIL(error("cannot write time report file %s", globopts.time_report.c_str()));
+        }
+        if (globopts.verbose) fprintf(msg.out, "re2c: success\n");
+        return Ret::OK;
+    }
 
     CHECK_RET(input.open(globopts.source_file, nullptr));
 
     Output output(out_alc, msg);
+    CHECK_RET(input.load_profile(output.profile));
 
     Ast ast(ast_alc, out_alc);
 
@@ -155,6 +300,8 @@ LOCAL_NODISCARD(Ret compile(int, char* argv[])) {
     const opt_t* accum_opts = output.block().opts;
 
     for (;;) {
+        report.start();
+
         // parse everything up to the next re2c block
         InputBlock kind;
         std::string block_name;
@@ -171,6 +318,7 @@ LOCAL_NODISCARD(Ret compile(int, char* argv[])) {
         }
         loc_t block_loc = input.tok_loc();
         CHECK_RET(parse(input, ast, opts, grams));
+        report.mark("parse", make_name(output.msg, "", block_loc), "", 0);
 
         // start new output block with accumulated options
         CHECK_RET(output.new_block(opts, kind, block_name, block_loc));
@@ -182,8 +330,14 @@ LOCAL_NODISCARD(Ret compile(int, char* argv[])) {
         } else {
             // Convert AST to a DFA for each condition.
             CHECK_RET(check_and_merge_special_rules(grams, b.opts, output.msg, ast));
-            for (const AstGram& gram : grams) {
-                CHECK_RET(ast_to_dfa(gram, output, b.dfas, dfa_alc));
+            if (dfa_alcs.size() > 1 && grams.size() > 1) {
+                CHECK_RET(ast_to_dfa_parallel(grams, output, dfa_alcs, report));
+            } else {
+                for (const AstGram& gram : grams) {
+                    std::unique_ptr<Adfa> adfa;
+                    CHECK_RET(ast_to_dfa(gram, b, output.msg, dfa_alcs[0], report, adfa));
+                    CHECK_RET(add_dfa(output, std::move(adfa)));
+                }
             }
             output.gen_stmt(code_dfas(out_alc));
         }
@@ -200,6 +354,7 @@ LOCAL_NODISCARD(Ret compile(int, char* argv[])) {
     }
 
     output.gen_epilog();
+    report.mark("parse");
 
     output.total_opts = accum_opts ? accum_opts : ast.blocks.last_opts();
 
@@ -207,31 +362,277 @@ LOCAL_NODISCARD(Ret compile(int, char* argv[])) {
 
     // Early codegen pass that gathers whole-program information.
     CHECK_RET(codegen_analyze(output));
+    report.mark("codegen_analyze");
 
     // Main codegen pass that generates code.
     CHECK_RET(codegen_generate(output));
+    report.mark("codegen_generate");
 
-    dfa_alc.clear(); // Release memory used for DFAs.
+    dfa_alcs.clear(); // Release memory used for DFAs.
 
     // Late codegen pass that cleans up the generated code.
     codegen_fixup(output);
+    report.mark("codegen_fixup");
 
     // Check for -Werror warnings before writing output file(s).
     CHECK_RET(output.msg.warn.check());
 
     // Rendering pass that prints the generated code into the output file.
     CHECK_RET(codegen_render(output));
+    report.mark("codegen_render");
 
     out_alc.clear(); // Release memory used for codegen.
 
     CHECK_RET(input.gen_dep_file(output.total_opts->header_file));
 
-    if (globopts.verbose) fprintf(stderr, "re2c: success\n");
+    if (report.is_enabled() && !report.write(globopts.time_report)) {
+        RET_FAIL(error("cannot write time report file %s", globopts.time_report.c_str()));
+    }
+
+    const std::string& header = output.total_opts->header_file;
+    outputs.clear();
+    if (!globopts.output_file.empty()) outputs.push_back(globopts.output_file);
+    if (!header.empty()) outputs.push_back(header);
+    if (!globopts.dep_file.empty()) outputs.push_back(globopts.dep_file);
+
+    // Save the generated files in the cache, unless there were warnings that would not be
+    // reproduced on a cache hit, some of the output went to stdout, or some of the input files
+    // could not be hashed.
+    if (!output.msg.warning_seen
+            && (!header.empty() || !output.need_header)
+            && input.input_hashes() != nullptr) {
+        cache.store(*input.input_hashes(), input.missing_paths(), outputs);
+    }
+
+    if (globopts.verbose) fprintf(msg.out, "re2c: success\n");
+    return Ret::OK;
+}
+
+// note [batch mode]
+//
+// With `--batch FILE` option re2c compiles all input files listed in the manifest in one process.
+// Each file is compiled by a separate call to `compile` with its own command line: common options
+// (the command-line arguments without `--batch FILE`), `-j 1`, then the options from the manifest
+// entry, the output and the input file. Files share nothing but the process (they have separate
+// options, message streams, allocators and outputs), so the output is the same as with separate
+// re2c runs, but process startup and thread creation are paid once for the whole batch.
+//
+// Files are distributed between `-j` worker threads. Each file collects its diagnostics in a
+// temporary file (see `set_error_stream`), and when all files are done the diagnostics are printed
+// to stderr in the order of the manifest. A failed file does not stop the batch.
+
+// note [compile server]
+//
+// With `--server` option re2c reads compile requests from stdin, one per line, in the same format
+// as the entries of a batch manifest, and compiles them one by one in the same way (see note
+// [batch mode]), except that the common options are not followed by `-j 1`. After each request
+// re2c writes a response to stdout:
+//
+//     ok|error <diagnostics size> <number of files>
+//     <diagnostics>
+//     <file size> <file path>
+//     <file contents>
+//     ...
+//
+// where the files are all generated files (the output file, header and depfile), so that the client
+// does not have to read them from disk. The server exits at the end of input.
+//
+// Between requests the server keeps the generated files in an in-memory compilation cache (see note
+// [compilation cache]). A request with the same options and unchanged source and include files is
+// answered from memory without parsing and compilation. Caching works on the level of files rather
+// than blocks for the same reasons as with `--cache-dir`, and it is not used if the generation
+// date is enabled (that is, unless the request has `--no-generation-date`).
+
+struct BatchJob {
+    uint32_t line; // line in the manifest
+    std::string input;
+    std::vector<std::string> args;
+    std::string diag;
+    std::vector<std::string> outputs;
+    Ret ret;
+
+    BatchJob(): line(0), input(), args(), diag(), outputs(), ret(Ret::OK) {}
+};
+
+// Split the part of text from `i` to `eol` into whitespace-separated words.
+static void split_words(
+        const std::string& text, size_t i, size_t eol, std::vector<std::string>& words) {
+    words.clear();
+    while (i < eol) {
+        if (isspace(static_cast<unsigned char>(text[i]))) {
+            ++i;
+            continue;
+        }
+        const size_t start = i;
+        while (i < eol && !isspace(static_cast<unsigned char>(text[i]))) ++i;
+        words.emplace_back(text, start, i - start);
+    }
+}
+
+// Common options for all jobs: command-line arguments without the ones that select batch or server
+// mode.
+static std::vector<std::string> common_args(const char* prog, const std::vector<std::string>& args) {
+    std::vector<std::string> common{prog};
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (args[i] == "--batch") {
+            ++i;
+        } else if (args[i] != "--server") {
+            common.push_back(args[i]);
+        }
+    }
+    return common;
+}
+
+// Make a job from an entry of the form `INPUT OUTPUT [OPTIONS]`.
+LOCAL_NODISCARD(Ret make_job(const char* fname,
+                             uint32_t line,
+                             const std::vector<std::string>& words,
+                             const std::vector<std::string>& common,
+                             BatchJob& job)) {
+    if (words.size() < 2) RET_FAIL(error("%s:%u: expected input and output file", fname, line));
+    for (size_t i = 2; i < words.size(); ++i) {
+        if (words[i] == "--batch" || words[i] == "--server") {
+            RET_FAIL(error("%s:%u: nested %s option", fname, line, words[i].c_str()));
+        }
+    }
+
+    job.line = line;
+    job.input = words[0];
+    job.args = common;
+    job.args.insert(job.args.end(), words.begin() + 2, words.end());
+    job.args.insert(job.args.end(), {"-o", words[1], words[0]});
+    return Ret::OK;
+}
+
+LOCAL_NODISCARD(Ret parse_manifest(const std::string& fname,
+                                   const std::vector<std::string>& common,
+                                   std::vector<BatchJob>& jobs)) {
+    std::string text;
+    if (!read_file(fname, text)) RET_FAIL(error("cannot read batch file %s", fname.c_str()));
+
+    std::vector<std::string> words;
+    uint32_t line = 0;
+    for (size_t i = 0; i < text.size();) {
+        size_t eol = text.find('\n', i);
+        if (eol == std::string::npos) eol = text.size();
+        ++line;
+
+        split_words(text, i, eol, words);
+        i = eol + 1;
+
+        if (words.empty() || words[0][0] == '#') continue;
+        jobs.emplace_back();
+        CHECK_RET(make_job(fname.c_str(), line, words, common, jobs.back()));
+    }
+    return Ret::OK;
+}
+
+// Call `f` and collect all diagnostics that it emits in the current thread in `diag`.
+template<typename func_t>
+static Ret collect_diagnostics(std::string& diag, func_t f) {
+    FILE* out = tmpfile();
+    if (out == nullptr) RET_FAIL(error("cannot create temporary file"));
+
+    set_error_stream(out);
+    const Ret ret = f();
+    set_error_stream(nullptr);
+
+    char buf[4096];
+    rewind(out);
+    for (size_t n; (n = fread(buf, 1, sizeof(buf), out)) > 0;) diag.append(buf, n);
+    fclose(out);
+
+    return ret;
+}
+
+LOCAL_NODISCARD(Ret compile_job(BatchJob& job, MemoryCache* memcache)) {
+    std::vector<char*> argv;
+    for (std::string& arg : job.args) argv.push_back(&arg[0]);
+    argv.push_back(nullptr);
+    return compile(static_cast<int>(job.args.size()), argv.data(), job.outputs, memcache);
+}
+
+static Ret compile_batch(
+        const char* prog, const std::vector<std::string>& args, const conopt_t& globopts) {
+    const std::string& fname = globopts.batch_file;
+
+    // Parallelism is across files, so each file is compiled in one thread by default (but the
+    // manifest may override that).
+    std::vector<std::string> common = common_args(prog, args);
+    common.insert(common.end(), {"-j", "1"});
+
+    std::vector<BatchJob> jobs;
+    CHECK_RET(parse_manifest(fname, common, jobs));
+    if (jobs.empty()) return Ret::OK;
+
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t i; (i = next++) < jobs.size();) {
+            BatchJob& job = jobs[i];
+            job.ret = collect_diagnostics(job.diag, [&]() { return compile_job(job, nullptr); });
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < std::min<size_t>(max_threads(globopts.jobs), jobs.size()); ++i) {
+        threads.emplace_back(worker);
+    }
+    worker(); // the main thread is also a worker
+    for (std::thread& t : threads) t.join();
+
+    Ret ret = Ret::OK;
+    for (const BatchJob& job : jobs) {
+        fwrite(job.diag.data(), 1, job.diag.size(), stderr);
+        if (job.ret == Ret::FAIL) {
+            error("%s:%u: cannot compile %s", fname.c_str(), job.line, job.input.c_str());
+            ret = Ret::FAIL;
+        }
+    }
+    return ret;
+}
+
+static Ret serve(const char* prog, const std::vector<std::string>& args) {
+    const std::vector<std::string> common = common_args(prog, args);
+    MemoryCache memcache;
+
+    std::string request, content;
+    std::vector<std::string> words;
+    for (uint32_t line = 1;; ++line) {
+        request.clear();
+        int c;
+        while ((c = getchar()) != EOF && c != '\n') request += static_cast<char>(c);
+        if (c == EOF && request.empty()) break;
+
+        split_words(request, 0, request.size(), words);
+        if (words.empty()) continue;
+
+        BatchJob job;
+        const Ret ret = collect_diagnostics(job.diag, [&]() {
+            CHECK_RET(make_job("<stdin>", line, words, common, job));
+            return compile_job(job, &memcache);
+        });
+
+        // collect generated files (missing files are not an error: the output may be incomplete
+        // if compilation failed)
+        std::vector<std::pair<std::string, std::string>> files;
+        for (const std::string& path : job.outputs) {
+            if (read_file(path, content)) files.push_back(std::make_pair(path, content));
+        }
+
+        printf("%s %zu %zu\n", ret == Ret::OK ? "ok" : "error", job.diag.size(), files.size());
+        fwrite(job.diag.data(), 1, job.diag.size(), stdout);
+        for (const std::pair<std::string, std::string>& f : files) {
+            printf("%zu %s\n", f.second.size(), f.first.c_str());
+            fwrite(f.second.data(), 1, f.second.size(), stdout);
+        }
+        fflush(stdout);
+    }
     return Ret::OK;
 }
 
 } // namespace re2c
 
 int main(int argc, char* argv[]) {
-    return re2c::compile(argc, argv) == re2c::Ret::FAIL ? 1 : 0;
+    std::vector<std::string> outputs;
+    return re2c::compile(argc, argv, outputs, nullptr) == re2c::Ret::FAIL ? 1 : 0;
 }
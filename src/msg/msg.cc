@@ -12,25 +12,55 @@ extern const char* help; // autogenerated
 
 namespace re2c {
 
+static thread_local FILE* thread_error_stream = nullptr;
+
+FILE* error_stream() {
+    return thread_error_stream ? thread_error_stream : stderr;
+}
+
+void set_error_stream(FILE* f) {
+    thread_error_stream = f;
+}
+
 void error(const char* fmt, ...) {
-    fprintf(stderr, RE2C_PROG ": error: ");
+    FILE* out = error_stream();
+    fprintf(out, RE2C_PROG ": error: ");
 
     va_list args;
     va_start(args, fmt);
-    vfprintf(stderr, fmt, args);
+    vfprintf(out, fmt, args);
     va_end(args);
 
-    fprintf(stderr, "\n");
+    fprintf(out, "\n");
+}
+
+Msg::Msg(const Msg& msg, FILE* out)
+    : filenames(msg.filenames)
+    , warn(*this, msg.warn)
+    , locfmt(msg.locfmt)
+    , error_seen(msg.error_seen)
+    , warning_seen(false)
+    , out(out) {}
+
+void Msg::merge(const Msg& job) {
+    char buf[4096];
+    rewind(job.out);
+    for (size_t n; (n = fread(buf, 1, sizeof(buf), job.out)) > 0;) {
+        fwrite(buf, 1, n, out);
+    }
+    warn.merge(job.warn);
+    error_seen |= job.error_seen;
+    warning_seen |= job.warning_seen;
 }
 
 void Msg::print_location(const loc_t& loc) const {
     const char* f = filenames[loc.file].c_str();
     switch (locfmt) {
     case LOCFMT_GNU:
-        fprintf(stderr, "%s:%u:%u: ", f, loc.line, loc.coln);
+        fprintf(out, "%s:%u:%u: ", f, loc.line, loc.coln);
         break;
     case LOCFMT_MSVC:
-        fprintf(stderr, "%s(%u,%u): ", f, loc.line, loc.coln);
+        fprintf(out, "%s(%u,%u): ", f, loc.line, loc.coln);
         break;
     }
 }
@@ -49,9 +79,9 @@ void Msg::verror(const loc_t& loc, const char* fmt, va_list args) {
     error_seen = true;
 
     print_location(loc);
-    fprintf(stderr, "error: ");
-    vfprintf(stderr, fmt, args);
-    fprintf(stderr, "\n");
+    fprintf(out, "error: ");
+    vfprintf(out, fmt, args);
+    fprintf(out, "\n");
 }
 
 void error_arg(const char* option) {
@@ -59,17 +89,18 @@ void error_arg(const char* option) {
 }
 
 void Msg::warning_start(const loc_t& loc, bool error) {
+    warning_seen = true;
     print_location(loc);
     const char* msg = error ? "error" : "warning";
-    fprintf(stderr, "%s: ", msg);
+    fprintf(out, "%s: ", msg);
 }
 
 void Msg::warning_end(const char* type, bool error) {
     if (type != nullptr) {
         const char* prefix = error ? "error-" : "";
-        fprintf(stderr, " [-W%s%s]", prefix, type);
+        fprintf(out, " [-W%s%s]", prefix, type);
     }
-    fprintf(stderr, "\n");
+    fprintf(out, "\n");
 }
 
 void Msg::warning(const char* type, const loc_t& loc, bool error, const char* fmt, ...) {
@@ -77,7 +108,7 @@ void Msg::warning(const char* type, const loc_t& loc, bool error, const char* fm
 
     va_list args;
     va_start(args, fmt);
-    vfprintf(stderr, fmt, args);
+    vfprintf(out, fmt, args);
     va_end(args);
 
     warning_end(type, error);
@@ -4,6 +4,7 @@
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <string>
 #include <vector>
 
@@ -11,18 +12,36 @@
 #include "src/msg/location.h"
 #include "src/msg/warn.h"
 #include "src/util/attribute.h"
+#include "src/util/forbid_copy.h"
 
 namespace re2c {
 
+// Stream for errors and warnings of the current thread (stderr, unless the thread compiles a file in
+// batch mode and collects diagnostics in a temporary file).
+FILE* error_stream();
+void set_error_stream(FILE* f);
+
 class Msg {
   public:
     std::vector<std::string> filenames;
     Warn warn;
     locfmt_t locfmt;
     bool error_seen;
+    bool warning_seen;
+    FILE* out; // stream for errors and warnings (a temporary file in parallel jobs)
 
   public:
-    inline Msg(): filenames(), warn(*this), locfmt(LOCFMT_GNU), error_seen(false) {}
+    inline Msg()
+        : filenames()
+        , warn(*this)
+        , locfmt(LOCFMT_GNU)
+        , error_seen(false)
+        , warning_seen(false)
+        , out(error_stream()) {}
+    Msg(const Msg& msg, FILE* out);
+
+    // Append diagnostics and error state of a parallel job to this message stream.
+    void merge(const Msg& job);
 
     void error(const loc_t& loc, const char* fmt, ...) RE2C_ATTR((format(printf, 3, 4)));
     void verror(const loc_t& loc, const char* fmt, va_list args) RE2C_ATTR((format(printf, 3, 0)));
@@ -30,6 +49,7 @@ class Msg {
             RE2C_ATTR((format(printf, 5, 6)));
 
     friend class Warn;
+    FORBID_COPY(Msg);
 
   private:
     void print_location(const loc_t& loc) const;
@@ -26,6 +26,16 @@ Warn::Warn(Msg& msg): mask(), error_accuml(false), msg(msg) {
     }
 }
 
+Warn::Warn(Msg& msg, const Warn& warn): mask(), error_accuml(false), msg(msg) {
+    for (uint32_t i = 0; i < TYPES; ++i) {
+        mask[i] = warn.mask[i];
+    }
+}
+
+void Warn::merge(const Warn& warn) {
+    error_accuml |= warn.error_accuml;
+}
+
 Ret Warn::check() const {
     return error_accuml ? Ret::FAIL : Ret::OK;
 }
@@ -108,11 +118,11 @@ void Warn::nondeterministic_tags(
 
         msg.warning_start(loc, e);
         if (tagname == nullptr) {
-            fprintf(stderr, "trailing context");
+            fprintf(msg.out, "trailing context");
         } else {
-            fprintf(stderr, "tag '%s'", tagname);
+            fprintf(msg.out, "tag '%s'", tagname);
         }
-        fprintf(stderr, " %shas %zu%s degree of nondeterminism",
+        fprintf(msg.out, " %shas %zu%s degree of nondeterminism",
                 incond(cond).c_str(), nver, nver == 2 ? "nd" : nver == 3 ? "rd" : "th");
         msg.warning_end(names[NONDETERMINISTIC_TAGS], e);
     }
@@ -137,21 +147,21 @@ void Warn::undefined_control_flow(
         std::sort(paths.begin(), paths.end());
 
         msg.warning_start(skel.loc, e);
-        fprintf(stderr, "control flow %sis undefined for strings that match ",
+        fprintf(msg.out, "control flow %sis undefined for strings that match ",
                 incond(skel.cond).c_str());
         if (paths.size() == 1) {
-            fprint_default_path(stderr, skel, paths.front());
+            fprint_default_path(msg.out, skel, paths.front());
         } else {
             for (const path_t& path : paths) {
-                fprintf(stderr, "\n\t");
-                fprint_default_path(stderr, skel, path);
+                fprintf(msg.out, "\n\t");
+                fprint_default_path(msg.out, skel, path);
             }
-            fprintf (stderr, "\n");
+            fprintf (msg.out, "\n");
         }
         if (overflow) {
-            fprintf(stderr, " ... and a few more");
+            fprintf(msg.out, " ... and a few more");
         }
-        fprintf(stderr, ", use default rule '*'");
+        fprintf(msg.out, ", use default rule '*'");
         msg.warning_end(names[UNDEFINED_CONTROL_FLOW], e);
     }
 }
@@ -162,16 +172,16 @@ void Warn::unreachable_rule(const std::string& cond, const Rule& rule) {
         error_accuml |= e;
 
         msg.warning_start(rule.semact->loc, e);
-        fprintf(stderr, "unreachable rule %s", incond(cond).c_str());
+        fprintf(msg.out, "unreachable rule %s", incond(cond).c_str());
         const size_t shadows = rule.shadow.size();
         if (shadows > 0) {
             const char* pl = shadows > 1 ? "s" : "";
             std::set<uint32_t>::const_iterator i = rule.shadow.begin();
-            fprintf (stderr, "(shadowed by rule%s at line%s %u", pl, pl, *i);
+            fprintf (msg.out, "(shadowed by rule%s at line%s %u", pl, pl, *i);
             for (++i; i != rule.shadow.end(); ++i) {
-                fprintf(stderr, ", %u", *i);
+                fprintf(msg.out, ", %u", *i);
             }
-            fprintf(stderr, ")");
+            fprintf(msg.out, ")");
         }
         msg.warning_end(names[UNREACHABLE_RULES], e);
     }
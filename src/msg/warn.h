@@ -58,6 +58,8 @@ class Warn {
 
   public:
     explicit Warn(Msg& msg);
+    Warn(Msg& msg, const Warn& warn);
+    void merge(const Warn& warn);
     Ret check() const NODISCARD;
     void set(type_t t, option_t o);
     void set_all();
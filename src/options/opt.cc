@@ -1,3 +1,7 @@
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
 #include "src/codegen/output.h"
 #include "src/msg/msg.h"
 #include "src/options/opt.h"
@@ -71,6 +75,48 @@ LOCAL_NODISCARD(Ret fix_conopt(conopt_t& glob)) {
     return Ret::OK;
 }
 
+// Parse `re2c:char-weights` configuration: a list of items `LB-UB:WEIGHT` or `CHAR:WEIGHT` separated
+// with spaces or commas, where code units and weights are decimal or hexadecimal (with `0x` prefix)
+// numbers. The resulting ranges are sorted; false is returned if the list is malformed, or if the
+// ranges overlap.
+bool parse_char_weights(const std::string& str, std::vector<CharWeight>& weights) {
+    weights.clear();
+    const char* p = str.c_str();
+
+    auto number = [&p](uint32_t& n) {
+        if (*p < '0' || *p > '9') return false;
+        char* e;
+        const unsigned long x = strtoul(p, &e, p[0] == '0' && (p[1] == 'x' || p[1] == 'X') ? 16 : 10);
+        if (x > UINT32_MAX) return false;
+        n = static_cast<uint32_t>(x);
+        p = e;
+        return true;
+    };
+
+    for (;;) {
+        while (*p == ' ' || *p == ',' || *p == '\t' || *p == '\n') ++p;
+        if (*p == 0) break;
+
+        CharWeight w;
+        if (!number(w.lb)) return false;
+        w.ub = w.lb;
+        if (*p == '-') {
+            ++p;
+            if (!number(w.ub)) return false;
+        }
+        if (*p++ != ':' || !number(w.weight) || w.lb > w.ub) return false;
+        weights.push_back(w);
+    }
+
+    std::sort(weights.begin(), weights.end(), [](const CharWeight& x, const CharWeight& y) {
+        return x.lb < y.lb;
+    });
+    for (size_t i = 1; i < weights.size(); ++i) {
+        if (weights[i].lb <= weights[i - 1].ub) return false;
+    }
+    return true;
+}
+
 // This function should only change real mutable options (based on the global options, default
 // mutable options and default flags). User-defined options are intentionally not passed to prevent
 // accidental change, and default flags are passed as read-only.
@@ -304,6 +350,35 @@ LOCAL_NODISCARD(Ret fix_mutopt(
     if (!is_default.case_ranges && !glob.supported_features_contains("case_ranges")) {
         RET_FAIL(error("`case_ranges` feature is not supported for this backend"));
     }
+    if (!is_default.collapse_chains && !glob.supported_features_contains("collapse_chains")) {
+        RET_FAIL(error("`collapse_chains` feature is not supported for this backend"));
+    }
+    if (!is_default.simd_loops && !glob.supported_features_contains("simd_loops")) {
+        RET_FAIL(error("`simd_loops` feature is not supported for this backend"));
+    }
+    if (!is_default.table_driven && !glob.supported_features_contains("table_driven")) {
+        RET_FAIL(error("`table_driven` feature is not supported for this backend"));
+    }
+    if (!is_default.class_switch && !glob.supported_features_contains("class_switch")) {
+        RET_FAIL(error("`class_switch` feature is not supported for this backend"));
+    }
+    if (!is_default.profile_gen && !glob.supported_features_contains("profile_gen")) {
+        RET_FAIL(error("`profile_gen` feature is not supported for this backend"));
+    }
+    if (!real.char_weights.empty()) {
+        std::vector<CharWeight> weights;
+        if (!parse_char_weights(real.char_weights, weights)) {
+            RET_FAIL(error("bad configuration 're2c:char-weights' (expected a list of "
+                           "non-overlapping items 'LB-UB:WEIGHT' or 'CHAR:WEIGHT')"));
+        }
+        if (!weights.empty() && weights.back().ub >= real.encoding.cunit_count()) {
+            RET_FAIL(error("'re2c:char-weights' exceeds maximum code unit value for given "
+                           "encoding"));
+        }
+    }
+    if (real.table_driven && glob.code_model != CodeModel::LOOP_SWITCH) {
+        RET_FAIL(error("table-driven code requires loop/switch code model (--loop-switch)"));
+    }
     if (!is_default.unsafe && !glob.supported_features_contains("unsafe")) {
         RET_FAIL(error("`unsafe` feature is not supported for this backend"));
     }
@@ -338,6 +413,28 @@ LOCAL_NODISCARD(Ret fix_mutopt(
         // the lexer is resumed from the wrong program point.
         RET_FAIL(error("storable state requires YYFILL to be enabled"));
     }
+    if (real.fast_path) {
+        if (glob.code_model != CodeModel::GOTO_LABEL) {
+            RET_FAIL(error("fast path requires goto/label code model"));
+        }
+        if (glob.storable_state) {
+            RET_FAIL(error("fast path cannot be used with storable state"));
+        }
+        if (real.fill_eof != NOEOF) {
+            RET_FAIL(error("fast path cannot be used with the end-of-input rule"));
+        }
+    }
+    if (!real.keyword_lookup.empty()) {
+        if (!glob.supported_features_contains("keyword_lookup")) {
+            RET_FAIL(error("`keyword_lookup` feature is not supported for this backend"));
+        }
+        if (real.api != Api::DEFAULT) {
+            RET_FAIL(error("keyword lookup requires the default API"));
+        }
+    }
+    if (real.unroll_loops > 16) {
+        RET_FAIL(error("loop unrolling factor should not exceed 16"));
+    }
     if (glob.code_model != CodeModel::GOTO_LABEL) {
         if (real.computed_gotos) {
             RET_FAIL(error("computed gotos are not supported in this code model"));
@@ -347,6 +444,9 @@ LOCAL_NODISCARD(Ret fix_mutopt(
             RET_FAIL(error("bitmaps are not supported in this code model"));
         }
     }
+    if (glob.code_model == CodeModel::REC_FUNC && real.class_switch) {
+        RET_FAIL(error("class switch is not supported in this code model"));
+    }
 
     return Ret::OK;
 }
@@ -514,9 +614,9 @@ RE2C_STX_OPTS
 } */ \
 Ret Opt::check_code_##name() { \
     if (glob.code_##name == nullptr) return Ret::OK; \
-    static const std::unordered_set<StxVarId> vs vars; \
-    static const std::unordered_set<StxVarId> lvs list_vars; \
-    static const std::unordered_set<StxLOpt> cs conds; \
+    static const enum_set_t<StxVarId> vs vars; \
+    static const enum_set_t<StxVarId> lvs list_vars; \
+    static const enum_set_t<StxLOpt> cs conds; \
     return validate_conf_code(glob.code_##name, "code:" #name, vs, lvs, cs); \
 }
 RE2C_CODE_TEMPLATES
@@ -575,23 +675,23 @@ const char* Opt::var_name(StxVarId id) {
 }
 
 // is this a known configuration-specific conditional?
-Ret Opt::check_cond(StxLOpt opt, const char* conf, const std::unordered_set<StxLOpt>& conds) const {
-    if (conds.find(opt) != conds.end()) return Ret::OK;
+Ret Opt::check_cond(StxLOpt opt, const char* conf, const enum_set_t<StxLOpt>& conds) const {
+    if (conds.contains(opt)) return Ret::OK;
     RET_FAIL(error("unknown conditional in configuration '%s'", conf));
 }
 
 Ret Opt::check_var(
         StxVarId var,
         const char* conf,
-        const std::unordered_set<StxVarId>& vars,
-        const std::unordered_set<StxVarId>& list_vars) const {
+        const enum_set_t<StxVarId>& vars,
+        const enum_set_t<StxVarId>& list_vars) const {
     // is this a global variable?
-    static const std::unordered_set<StxVarId> global_vars({
+    static const enum_set_t<StxVarId> global_vars({
 #define STX_GLOBAL_VAR(id, name) StxVarId:: id,
     RE2C_STX_GLOBAL_VARS
 #undef STX_GLOBAL_VAR
     });
-    if (global_vars.find(var) != global_vars.end()) return Ret::OK;
+    if (global_vars.contains(var)) return Ret::OK;
 
     // this may be a list var; in that case it must be on the list stack
     bool is_list_var = std::find_if(stack_code_list.begin(), stack_code_list.end(),
@@ -599,8 +699,8 @@ Ret Opt::check_var(
         != stack_code_list.end();
 
     // is this a known configuration-specific variable?
-    const std::unordered_set<StxVarId>& v = is_list_var ? list_vars : vars;
-    if (std::find(v.begin(), v.end(), var) != v.end()) return Ret::OK;
+    const enum_set_t<StxVarId>& v = is_list_var ? list_vars : vars;
+    if (v.contains(var)) return Ret::OK;
 
     RET_FAIL(error("unknown variable '%s' in configuration '%s'", var_name(var), conf));
 }
@@ -609,9 +709,9 @@ Ret Opt::check_var(
 Ret Opt::validate_conf_code(
         const StxCodes* code,
         const char* conf,
-        const std::unordered_set<StxVarId>& vars,
-        const std::unordered_set<StxVarId>& list_vars,
-        const std::unordered_set<StxLOpt>& conds) {
+        const enum_set_t<StxVarId>& vars,
+        const enum_set_t<StxVarId>& list_vars,
+        const enum_set_t<StxLOpt>& conds) {
     stack_code_list.clear();
     stack_code_t& stack = stack_code;
     stack.clear();
@@ -619,12 +719,13 @@ Ret Opt::validate_conf_code(
         stack.push_back({x, 0});
     }
 
-    static const std::unordered_set<std::string> oneliners {
+    static const char* const oneliners[] = {
 #define ONELINE_CODE(name, kind) name,
         RE2C_ONELINE_CODES
 #undef ONELINE_CODE
     };
-    bool oneline = oneliners.find(conf) != oneliners.end();
+    bool oneline = false;
+    for (const char* s : oneliners) oneline = oneline || strcmp(s, conf) == 0;
     uint32_t newlines = 0;
 
     while (!stack.empty()) {
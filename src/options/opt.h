@@ -3,6 +3,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <initializer_list>
 #include <string>
 #include <vector>
 #include <unordered_set>
@@ -12,6 +13,8 @@
 #include "src/options/symtab.h"
 #include "src/util/allocator.h"
 #include "src/util/attribute.h"
+#include "src/util/bitset.h"
+#include "src/util/check.h"
 #include "src/util/containers.h"
 #include "src/util/forbid_copy.h"
 
@@ -64,7 +67,8 @@ using StxCodes = list_t<StxCode>;
     CHECKED_LIST(supported_targets, \
             ({"code", "dot", "skeleton"})) \
     CHECKED_LIST(supported_features, \
-            ({"nested_ifs", "bitmaps", "computed_gotos", "case_ranges", "unsafe", "monadic"}))
+            ({"nested_ifs", "bitmaps", "computed_gotos", "case_ranges", "unsafe", "monadic", \
+              "collapse_chains", "simd_loops", "table_driven", "profile_gen", "keyword_lookup", "class_switch"}))
 
 #define RE2C_STX_OPTS \
     STX_OPT(bool, semicolons, false) \
@@ -98,6 +102,9 @@ using StxCodes = list_t<StxCode>;
     CODE_TEMPLATE(array_elem, \
         ({StxVarId::ARRAY, StxVarId::INDEX}), ({}), ({}) \
     ) \
+    CODE_TEMPLATE(char_index, \
+        ({StxVarId::CHAR}), ({}), ({}) \
+    ) \
     CODE_TEMPLATE(type_int, \
         ({}), ({}), ({}) \
     ) \
@@ -282,6 +289,12 @@ using StxCodes = list_t<StxCode>;
     CODE_TEMPLATE(yylessthan, \
         ({StxVarId::LESSTHAN, StxVarId::NEED, StxVarId::CURSOR, StxVarId::LIMIT, \
             StxVarId::RECORD}), ({}), ({StxLOpt::MANY}) \
+    ) \
+    CODE_TEMPLATE(cond_likely, \
+        ({StxVarId::COND}), ({}), ({}) \
+    ) \
+    CODE_TEMPLATE(cond_unlikely, \
+        ({StxVarId::COND}), ({}), ({}) \
     )
 
 #define RE2C_ONELINE_CODES \
@@ -377,6 +390,43 @@ enum class StxVarId : uint32_t {
 #undef STX_LOCAL_VAR
 #undef STX_GLOBAL_VAR
 
+// Number of values in an enumeration that is used with `enum_set_t`.
+template<typename enum_t> struct enum_size;
+
+#define STX_LOCAL_VAR(id, name) + 1
+#define STX_GLOBAL_VAR(id, name) + 1
+template<> struct enum_size<StxVarId> {
+    static constexpr size_t value = 0 RE2C_STX_LOCAL_VARS RE2C_STX_GLOBAL_VARS;
+};
+#undef STX_LOCAL_VAR
+#undef STX_GLOBAL_VAR
+
+#define STX_LOPT(id) + 1
+template<> struct enum_size<StxLOpt> {
+    static constexpr size_t value = 0 RE2C_STX_LOPTS;
+};
+#undef STX_LOPT
+
+// Set of enumeration values (syntax variables or conditionals) as a bit mask. Sets of allowed names
+// for each code template are checked on every run when the syntax file is loaded, so they should
+// be cheap to construct (no heap allocation, unlike `std::unordered_set`).
+template<typename enum_t>
+class enum_set_t {
+    static constexpr size_t NWORDS = bit_words(enum_size<enum_t>::value);
+    bitword_t bits[NWORDS];
+
+  public:
+    enum_set_t(std::initializer_list<enum_t> elems): bits() {
+        for (enum_t e : elems) {
+            DCHECK(static_cast<size_t>(e) < enum_size<enum_t>::value);
+            bit_set(bits, static_cast<size_t>(e));
+        }
+    }
+    bool contains(enum_t e) const {
+        return bit_test(bits, static_cast<size_t>(e));
+    }
+};
+
 // Immutable options (passed on the command line).
 #define RE2C_CONSTOPTS \
     CONSTOPT(Target, target, Target::CODE) \
@@ -389,11 +439,17 @@ enum class StxVarId : uint32_t {
     CONSTOPT(bool, flex_syntax, false) \
     CONSTOPT(bool, verbose, false) \
     CONSTOPT(bool, line_dirs, true) \
+    CONSTOPT(bool, server, false) \
+    CONSTOPT(uint32_t, jobs, 1) \
     /* files */ \
     CONSTOPT(std::string, source_file, "") \
     CONSTOPT(std::string, output_file, "") \
     CONSTOPT(std::string, dep_file, "") \
     CONSTOPT(std::string, syntax_file, "") \
+    CONSTOPT(std::string, cache_dir, "") \
+    CONSTOPT(std::string, time_report, "") \
+    CONSTOPT(std::string, profile_use, "") \
+    CONSTOPT(std::string, batch_file, "") \
     CONSTOPT(std::vector<std::string>, include_paths, std::vector<std::string>()) \
     /* internals */ \
     CONSTOPT(Minimization, minimization, Minimization::MOORE) \
@@ -445,9 +501,18 @@ enum class StxVarId : uint32_t {
     MUTOPT(bool, bitmaps, false) \
     MUTOPT(bool, bitmaps_hex, false) \
     MUTOPT(bool, case_ranges, false) \
+    MUTOPT(bool, class_switch, false) \
+    MUTOPT(bool, collapse_chains, false) \
     MUTOPT(bool, computed_gotos, false) \
     MUTOPT(uint32_t, computed_gotos_threshold, 9) \
     MUTOPT(bool, nested_ifs, false) \
+    MUTOPT(bool, simd_loops, false) \
+    MUTOPT(bool, table_driven, false) \
+    MUTOPT(bool, profile_gen, false) \
+    MUTOPT(std::string, char_weights, "") \
+    MUTOPT(bool, fast_path, false) \
+    MUTOPT(uint32_t, unroll_loops, 0) \
+    MUTOPT(std::string, keyword_lookup, "") \
     MUTOPT(bool, unsafe, true) \
     MUTOPT(bool, monadic, false) \
     /* YYFILL */ \
@@ -893,9 +958,9 @@ struct Opt {
     Ret validate_conf_code(
         const StxCodes* code,
         const char* conf,
-        const std::unordered_set<StxVarId>& vars,
-        const std::unordered_set<StxVarId>& list_vars,
-        const std::unordered_set<StxLOpt>& conds) NODISCARD;
+        const enum_set_t<StxVarId>& vars,
+        const enum_set_t<StxVarId>& list_vars,
+        const enum_set_t<StxLOpt>& conds) NODISCARD;
 
   private:
     Ret sync() NODISCARD;
@@ -904,15 +969,24 @@ struct Opt {
 
     StxCode* make_code(StxCodeType type);
 
-    Ret check_cond(StxLOpt opt, const char* conf, const std::unordered_set<StxLOpt>& conds) const;
-    Ret check_var(StxVarId var, const char* conf, const std::unordered_set<StxVarId>& vars,
-        const std::unordered_set<StxVarId>& list_vars) const;
+    Ret check_cond(StxLOpt opt, const char* conf, const enum_set_t<StxLOpt>& conds) const;
+    Ret check_var(StxVarId var, const char* conf, const enum_set_t<StxVarId>& vars,
+        const enum_set_t<StxVarId>& list_vars) const;
 
     FORBID_COPY(Opt);
 };
 
 Ret parse_opts(char** argv, conopt_t& globopts, Opt& opts, Msg& msg) NODISCARD;
 
+// A range of code units [lb, ub] with the given weight (an element of `re2c:char-weights`).
+struct CharWeight {
+    uint32_t lb;
+    uint32_t ub;
+    uint32_t weight;
+};
+
+bool parse_char_weights(const std::string& str, std::vector<CharWeight>& weights) NODISCARD;
+
 } // namespace re2c
 
 namespace std {
@@ -925,8 +999,6 @@ template<> struct hash<type> { \
         return h(static_cast<uint32_t>(v)); \
     } \
 }
-GEN_STD_HASH(re2c::StxVarId);
-GEN_STD_HASH(re2c::StxLOpt);
 GEN_STD_HASH(re2c::CodeKind);
 #undef GEN_STD_HASH
 
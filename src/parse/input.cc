@@ -3,6 +3,7 @@
 #include <string.h>
 #include <algorithm>
 #include <limits>
+#include <utility>
 
 #include "src/msg/msg.h"
 #include "src/options/opt.h"
@@ -19,12 +20,14 @@ InputFile::InputFile(size_t fidx)
       escaped_name(),
       so(Input::ENDPOS),
       eo(Input::ENDPOS),
+      size(0),
       line(1),
       fidx(static_cast<uint32_t>(fidx)) {}
 
 Ret InputFile::open(const std::string& filename,
                 const std::string* parent,
-                const std::vector<std::string>& include_paths) {
+                const std::vector<std::string>& include_paths,
+                std::set<std::string>& misses) {
     name = filename;
 
     if (!parent) {
@@ -40,12 +43,14 @@ Ret InputFile::open(const std::string& filename,
         // otherwise search in all include paths
         for (const std::string& incpath : include_paths) {
             if (file != nullptr) break;
+            misses.insert(path);
             path = incpath + name;
             file = fopen(path.c_str(), "rb");
         }
 
         // if user-defined include paths failed, try stdlib path
         if (!file) {
+            misses.insert(path);
             path = RE2C_STDLIB_DIR + name;
             file = fopen(path.c_str(), "rb");
         }
@@ -53,6 +58,13 @@ Ret InputFile::open(const std::string& filename,
 
     if (!file) RET_FAIL(error("cannot open file: %s", name.c_str()));
 
+    // find file size (this fails for stdin and pipes, in which case the size remains unknown)
+    if (file != stdin && fseek(file, 0, SEEK_END) == 0) {
+        const long n = ftell(file);
+        if (n > 0) size = static_cast<size_t>(n);
+        if (fseek(file, 0, SEEK_SET) != 0) size = 0;
+    }
+
     // name displayed in #line directives is the resolved name
     escaped_name = escape_backslashes(path);
 
@@ -101,8 +113,11 @@ size_t Input::get_input_index() const {
 Ret Input::open(const std::string& filename, const std::string* parent) {
     InputFile* in = new InputFile(msg.filenames.size());
     files.push_back(in);
-    CHECK_RET(in->open(filename, parent, globopts->include_paths));
+    CHECK_RET(in->open(filename, parent, globopts->include_paths, filemisses));
     filedeps.insert(in->escaped_name);
+    uint64_t hash = 0;
+    const bool hashed = in->file != stdin && hash_file(in->file, hash);
+    add_filehash(in->path, hashed, hash);
     msg.filenames.push_back(in->escaped_name);
     return Ret::OK;
 }
@@ -175,6 +190,13 @@ Ret Input::include(const std::string& filename, uint8_t* at) {
     return fill(BSIZE) ? Ret::OK : Ret::FAIL;
 }
 
+// Remember the hash of a file that has been opened (before its contents are compiled, see note
+// [compilation cache]). A file that is read many times must have the same hash every time.
+void Input::add_filehash(const std::string& path, bool ok, uint64_t hash) {
+    const auto i = filehashes.insert(std::make_pair(path, hash));
+    if (!ok || i.first->second != hash) filehashes_ok = false;
+}
+
 bool Input::read(size_t want) {
     CHECK(!files.empty());
     for (size_t i = files.size(); i --> 0; ) {
@@ -191,6 +213,18 @@ bool Input::read(size_t want) {
     return false;
 }
 
+size_t Input::unread_size() const {
+    size_t rest = 0;
+    for (const InputFile* in : files) {
+        if (in->size == 0) continue;
+        const long pos = ftell(in->file);
+        if (pos >= 0 && in->size > static_cast<size_t>(pos)) {
+            rest += in->size - static_cast<size_t>(pos);
+        }
+    }
+    return rest;
+}
+
 void Input::shift_ptrs_and_fpos(ptrdiff_t offs) {
     // shift buffer pointers
     shift_ptrs(offs);
@@ -226,6 +260,12 @@ bool Input::fill(size_t need) {
 
     pop_finished_files();
 
+    // If the sizes of input files are known, read all the remaining input at once (plus one byte to
+    // detect the end of input). Otherwise the lexer would refill the buffer every BSIZE bytes and
+    // move the unfinished lexeme to the start of buffer each time.
+    const size_t rest = unread_size();
+    if (rest > 0) need = std::max(need, rest + 1);
+
     CHECK(bot <= tok && tok <= lim);
     size_t free = static_cast<size_t>(tok - bot);
     size_t copy = static_cast<size_t>(lim - tok);
@@ -280,6 +320,44 @@ Ret Input::gen_dep_file(const std::string& header) const {
     return Ret::OK;
 }
 
+// Read profile file given with `--profile-use` option (see note [profiling]). Each line has the
+// name of a counter followed by its value. If the same counter occurs many times, the values are
+// added up, so that profiles of several runs can be concatenated.
+Ret Input::load_profile(std::unordered_map<std::string, uint64_t>& profile) {
+    const std::string& fname = globopts->profile_use;
+    if (fname.empty()) return Ret::OK;
+
+    std::string data;
+    if (!read_file(fname, data)) RET_FAIL(error("cannot open profile file: %s", fname.c_str()));
+    filedeps.insert(escape_backslashes(fname));
+    add_filehash(fname, true, hash_content(data));
+
+    uint32_t line = 0;
+    for (size_t p = 0, q; p < data.size(); p = q + 1) {
+        ++line;
+        q = data.find('\n', p);
+        if (q == std::string::npos) q = data.size();
+        size_t e = q;
+        if (e > p && data[e - 1] == '\r') --e;
+        if (e == p) continue;
+
+        // The counter value is the last space-separated field, everything before it is the name.
+        const size_t k = data.rfind(' ', e - 1);
+        uint64_t n = 0;
+        bool ok = k != std::string::npos && k > p && k + 1 < e;
+        for (size_t i = k + 1; ok && i < e; ++i) {
+            const char c = data[i];
+            ok = c >= '0' && c <= '9';
+            n = n * 10 + static_cast<uint64_t>(c - '0');
+        }
+        if (!ok) RET_FAIL(error("malformed profile file %s at line %u", fname.c_str(), line));
+
+        profile[data.substr(p, k - p)] += n;
+    }
+
+    return Ret::OK;
+}
+
 uint32_t Input::decode(const uint8_t* str) const {
     return globopts->input_encoding == Enc::Type::ASCII ? str[0] : utf8::decode_unsafe(str);
 }
@@ -4,8 +4,10 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "src/constants.h"
@@ -42,6 +44,7 @@ struct InputFile {
     std::string escaped_name;
     const uint8_t* so; // start offset in buffer
     const uint8_t* eo; // end offset in buffer
+    size_t size;       // file size, or zero if unknown (stdin, pipes)
     uint32_t line;
     uint32_t fidx;
 
@@ -49,7 +52,8 @@ struct InputFile {
     ~InputFile();
     Ret open(const std::string& filename,
              const std::string* parent,
-             const std::vector<std::string>& include_paths) NODISCARD;
+             const std::vector<std::string>& include_paths,
+             std::set<std::string>& misses) NODISCARD;
 
     FORBID_COPY(InputFile);
 };
@@ -64,6 +68,9 @@ class Input: private LexerState {
     Msg& msg;
     std::vector<InputFile*> files;
     std::set<std::string> filedeps;
+    std::map<std::string, uint64_t> filehashes; // resolved paths and hashes of all files read so far
+    bool filehashes_ok; // false if some file cannot be hashed or has changed while reading
+    std::set<std::string> filemisses; // paths where include files were searched for, but not found
     const conopt_t* globopts;
 
     // This is needed to save `tok` locaton to be used in `tok_loc()` later.
@@ -87,6 +94,11 @@ class Input: private LexerState {
     Ret load_syntax_config(Opt& opts, Lang& lang);
     Ret include(const std::string& filename, uint8_t* at) NODISCARD;
     Ret gen_dep_file(const std::string& header) const NODISCARD;
+    Ret load_profile(std::unordered_map<std::string, uint64_t>& profile) NODISCARD;
+    const std::map<std::string, uint64_t>* input_hashes() const {
+        return filehashes_ok ? &filehashes : nullptr;
+    }
+    const std::set<std::string>& missing_paths() const { return filemisses; }
 
     Ret lex_program(Output& out, std::string& block_name, InputBlock& kind) NODISCARD;
     Ret lex_block(YYSTYPE* yylval, Ast& ast, int& token) NODISCARD;
@@ -109,6 +121,7 @@ class Input: private LexerState {
     void reset();
 
     bool read(size_t want) NODISCARD;
+    size_t unread_size() const;
     bool fill(size_t need) NODISCARD;
     void shift_ptrs_and_fpos(ptrdiff_t offs);
     void pop_finished_files();
@@ -155,6 +168,7 @@ class Input: private LexerState {
     Ret lex_conf_list(Opt& opts) NODISCARD;
     Ret lex_conf_code(Opt& opts) NODISCARD;
     Ret parse_conf(Opt& opts);
+    void add_filehash(const std::string& path, bool ok, uint64_t hash);
 
     FORBID_COPY(Input);
 };
@@ -165,6 +179,9 @@ inline Input::Input(OutAllocator& alc, const conopt_t* o, Msg& m)
       msg(m),
       files(),
       filedeps(),
+      filehashes(),
+      filehashes_ok(true),
+      filemisses(),
       globopts(o),
       location(ATSTART),
       conf_kind(ConfKind::NONE),
@@ -0,0 +1,160 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "src/options/opt.h"
+#include "src/regexp/regexp.h"
+#include "src/regexp/rule.h"
+#include "src/util/check.h"
+#include "src/util/range.h"
+
+namespace re2c {
+namespace {
+
+// note [keyword lookup]
+//
+// Lexers for programming languages usually have many keyword rules (string literals) followed by a
+// general identifier rule that matches all keywords as well. The keyword rules make the DFA large:
+// every prefix of every keyword needs its own state, and each of these states duplicates the
+// transitions of the identifier rule. With `re2c:keyword-lookup` configuration re2c removes such
+// keyword rules from the DFA and looks up keywords in the action of the identifier rule: it compares
+// the lexeme length and the first character of the lexeme, and then the rest of the lexeme with
+// memcmp. If the lexeme is a keyword, the lexer executes the action of the keyword rule, otherwise
+// it executes the action of the identifier rule.
+//
+// A literal rule is a keyword of the first rule that follows it and matches the literal, provided
+// that this rule is not a literal itself (which would mean a duplicate rule) and neither rule has
+// tags. This preserves the semantics of the lexer:
+//
+//   - Removing the keyword rule does not change the longest match, since the identifier rule
+//     matches the keyword.
+//
+//   - Among the rules that match the longest lexeme, the keyword rule had priority over the
+//     identifier rule and all rules in between (they don't match the keyword by construction).
+//     Rules after the identifier rule have lower priority than it.
+//
+// A literal rule that is matched by some rule before it (e.g. a duplicate keyword) is unreachable.
+// Such rules are left in the DFA, so that they are reported by `-Wunreachable-rules` (otherwise
+// they would silently become dead code in the keyword lookup).
+//
+// Membership of a keyword in the language of a rule is checked with a simple matcher on the regexp
+// (rules are usually short and keywords are a few characters long).
+
+static bool in_range(const Range* r, uint32_t c) {
+    for (; r; r = r->next()) {
+        if (r->lower() <= c && c < r->upper()) return true;
+    }
+    return false;
+}
+
+// Find the positions in the string where a match of the regexp may end, given the positions where
+// it may start.
+static std::vector<bool> match(
+        const Regexp* re, const std::vector<uint32_t>& str, const std::vector<bool>& from) {
+    const size_t len = str.size();
+    std::vector<bool> to(len + 1, false);
+
+    switch (re->kind) {
+    case Regexp::Kind::NIL:
+    case Regexp::Kind::TAG:
+        return from;
+    case Regexp::Kind::SYM:
+        for (size_t i = 0; i < len; ++i) {
+            if (from[i] && in_range(re->sym, str[i])) to[i + 1] = true;
+        }
+        break;
+    case Regexp::Kind::ALT: {
+        const std::vector<bool> x = match(re->alt.re1, str, from);
+        const std::vector<bool> y = match(re->alt.re2, str, from);
+        for (size_t i = 0; i <= len; ++i) to[i] = x[i] || y[i];
+        break;
+    }
+    case Regexp::Kind::CAT:
+        return match(re->cat.re2, str, match(re->cat.re1, str, from));
+    case Regexp::Kind::ITER: {
+        // More than `min + len` iterations can only add empty matches of the sub-regexp.
+        const uint64_t n = std::min<uint64_t>(re->iter.max, uint64_t{re->iter.min} + len);
+        std::vector<bool> cur = from;
+        for (uint64_t k = 1; k <= n; ++k) {
+            cur = match(re->iter.re, str, cur);
+            if (k >= re->iter.min) {
+                for (size_t i = 0; i <= len; ++i) to[i] = to[i] || cur[i];
+            }
+        }
+        break;
+    }}
+    return to;
+}
+
+static bool matches(const Regexp* re, const std::vector<uint32_t>& str) {
+    std::vector<bool> from(str.size() + 1, false);
+    from[0] = true;
+    return match(re, str, from).back();
+}
+
+// Check if the regexp is a non-empty string literal and collect its code units.
+static bool literal(const Regexp* re, std::vector<uint32_t>& str) {
+    switch (re->kind) {
+    case Regexp::Kind::SYM:
+        if (!re->sym || re->sym->next() || re->sym->upper() != re->sym->lower() + 1) return false;
+        str.push_back(re->sym->lower());
+        return true;
+    case Regexp::Kind::CAT:
+        return literal(re->cat.re1, str) && literal(re->cat.re2, str);
+    default:
+        return false;
+    }
+}
+
+} // anonymous namespace
+
+void find_keywords(RESpec& spec, size_t def_rule, size_t eof_rule) {
+    const opt_t* opts = spec.opts;
+    if (opts->keyword_lookup.empty()
+            || opts->target != Target::CODE
+            || opts->encoding.cunit_size() != 1
+            || opts->encoding.type() == Enc::Type::EBCDIC) {
+        return;
+    }
+
+    const size_t nrules = spec.rules.size();
+    std::vector<std::vector<uint32_t>> literals(nrules);
+    for (size_t i = 0; i < nrules; ++i) {
+        if (i != def_rule && i != eof_rule && spec.rules[i].ltag == spec.rules[i].htag) {
+            if (!literal(spec.res[i], literals[i])) literals[i].clear();
+        }
+    }
+
+    // Find shadowed literals before any keyword rules are removed from the DFA.
+    std::vector<bool> shadowed(nrules, false);
+    for (size_t i = 0; i < nrules; ++i) {
+        if (literals[i].empty()) continue;
+        for (size_t j = 0; j < i && !shadowed[i]; ++j) {
+            shadowed[i] = j != def_rule && j != eof_rule && matches(spec.res[j], literals[i]);
+        }
+    }
+
+    for (size_t i = 0; i < nrules; ++i) {
+        const std::vector<uint32_t>& kw = literals[i];
+        if (kw.empty() || shadowed[i]) continue;
+
+        for (size_t j = i + 1; j < nrules; ++j) {
+            if (j == def_rule || j == eof_rule || !matches(spec.res[j], kw)) continue;
+
+            Rule& rule = spec.rules[j];
+            if (literals[j].empty() && rule.ltag == rule.htag) {
+                // Remove the keyword rule from the DFA: replace its regexp with an empty language.
+                Rule& kwrule = spec.rules[i];
+                kwrule.kwrule = j;
+                for (uint32_t c : kw) kwrule.keyword.push_back(static_cast<char>(c));
+                rule.keywords.push_back(i);
+                spec.res[i] = re_sym(spec, nullptr);
+            }
+            break;
+        }
+    }
+}
+
+} // namespace re2c
@@ -60,6 +60,7 @@ void split_charset(RESpec& spec);
 void find_fixed_tags(RESpec& spec);
 void insert_default_tags(RESpec& spec);
 void warn_nullable(const RESpec& spec, const std::string& cond);
+void find_keywords(RESpec& spec, size_t def_rule, size_t eof_rule);
 
 Regexp* re_nil(RESpec& spec);
 Regexp* re_sym(RESpec& spec, const Range* r);
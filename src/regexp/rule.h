@@ -6,6 +6,7 @@
 #include <limits>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "src/msg/location.h"
 
@@ -29,7 +30,21 @@ struct Rule {
     size_t ttag; // trailing context
     size_t ncap; // number of POSIX captures
 
-    Rule(): semact(nullptr), shadow(), ltag(0), htag(0), ttag(0), ncap(0) {}
+    // see note [keyword lookup]
+    size_t kwrule;                // for a keyword rule: the rule that matches the keyword in DFA
+    std::string keyword;          // for a keyword rule: the keyword (a string of code units)
+    std::vector<size_t> keywords; // for a rule that matches keywords: their rules by priority
+
+    Rule()
+        : semact(nullptr),
+          shadow(),
+          ltag(0),
+          htag(0),
+          ttag(0),
+          ncap(0),
+          kwrule(NONE),
+          keyword(),
+          keywords() {}
     ~Rule() {}
     Rule(const Rule& r) = default;
     Rule& operator=(const Rule& r) = default;
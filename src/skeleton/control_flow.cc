@@ -123,7 +123,7 @@ void fprint_default_path(FILE* f, const Skeleton& skel, const path_t& p) {
         if (i > 0) {
             fprintf(f, " ");
         }
-        fprint_default_arc(stderr, p.arc(skel, i));
+        fprint_default_arc(f, p.arc(skel, i));
     }
     fprintf(f, "'");
 }
@@ -654,6 +654,12 @@ static void emit_skeleton_function_lex(Output& output, CodeList* code, Adfa& dfa
     if (opts->bitmaps) {
         append(block2, gen_bitmap(output, dfa.bitmap, dfa.cond));
     }
+    if (dfa.table) {
+        append(block2, gen_tables(output, dfa.table));
+    }
+    if (dfa.classes) {
+        append(block2, gen_class_table(output, dfa));
+    }
     append(block2, code_textraw(alc, ""));
 
     switch (opts->code_model) {
@@ -666,7 +672,7 @@ static void emit_skeleton_function_lex(Output& output, CodeList* code, Adfa& dfa
         output.label_counter = 0;
         CodeCases* cases = code_cases(alc);
         gen_dfa_as_switch_cases(output, dfa, cases);
-        wrap_dfas_in_loop_switch(output, block2, cases);
+        wrap_dfas_in_loop_switch(output, block2, cases, dfa.table);
         break;
     }
     case CodeModel::REC_FUNC:
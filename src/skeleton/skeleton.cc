@@ -19,8 +19,8 @@ void Node::init(const TdfaState* s,
     for (uint32_t c = 0, l = 0; c < nc;) {
 
         size_t j = s->arcs[c];
-        const tcmd_t* t = s->tcmd[c];
-        for (; ++c < nc && s->arcs[c] == j && s->tcmd[c] == t;);
+        const tcmd_t* t = s->cmd(c);
+        for (; ++c < nc && s->arcs[c] == j && s->cmd(c) == t;);
         if (j == Tdfa::NIL) j = nil;
 
         // all arcs go to default node => this node is final
@@ -46,7 +46,7 @@ void Node::init(const TdfaState* s,
     }
 
     rule = s->rule;
-    cmd = s->tcmd[nc];
+    cmd = s->cmd(nc);
 }
 
 bool Node::end() const {
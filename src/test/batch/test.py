@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+
+"""Test batch mode (`--batch` option).
+
+Usage: test.py [path-to-re2c]
+"""
+
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def write(path, text):
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def read(path):
+    with open(path) as f:
+        return f.read()
+
+
+def check(cond, msg):
+    if not cond:
+        print(f'FAIL: {msg}')
+        sys.exit(1)
+
+
+def main():
+    re2c = os.path.abspath(sys.argv[1] if len(sys.argv) > 1 else 're2c')
+
+    with tempfile.TemporaryDirectory() as tmp:
+        os.chdir(tmp)
+        write('a.re', '/*!re2c\n'
+                      '    re2c:yyfill:enable = 0;\n'
+                      '    [a-z]+ { return 1; }\n'
+                      '    *      { return 0; }\n'
+                      '*/\n')
+        write('b.re', '/*!re2c\n'
+                      '    re2c:yyfill:enable = 0;\n'
+                      '    "b" { return 1; }\n'
+                      '    "b" { return 2; }\n'
+                      '    *   { return 0; }\n'
+                      '*/\n')
+        write('bad.re', '/*!re2c\n'
+                        '    [a-z { return 1; }\n'
+                        '*/\n')
+        write('m.txt', '# comment\n'
+                       'a.re a.c --time-report a.json\n'
+                       'bad.re bad.c\n'
+                       '\n'
+                       'b.re b.c -Wunreachable-rules\n')
+
+        # Reference outputs and diagnostics of separate runs.
+        def single(src, out, *opts):
+            p = subprocess.run([re2c, src, '-o', out, '--no-generation-date', *opts],
+                               capture_output=True, text=True)
+            return p.stderr, read(out) if p.returncode == 0 else None
+
+        _, a_out = single('a.re', 'a.c', '--time-report', 'a0.json')
+        b_err, b_out = single('b.re', 'b.c', '-Wunreachable-rules')
+        bad_err, _ = single('bad.re', 'bad.c')
+        os.remove('a.c')
+        os.remove('b.c')
+
+        for jobs in ['1', '3']:
+            p = subprocess.run([re2c, '--batch', 'm.txt', '-j', jobs, '--no-generation-date'],
+                               capture_output=True, text=True)
+
+            # A failed entry fails the batch, but does not stop it.
+            check(p.returncode != 0, f'-j{jobs}: failed entry does not fail the batch')
+            check(read('a.c') == a_out, f'-j{jobs}: batch output differs for a.re')
+            check(read('b.c') == b_out, f'-j{jobs}: batch output differs for b.re')
+
+            # Diagnostics are the same as with separate runs, in the order of the manifest.
+            fail = 'm.txt:3: cannot compile bad.re'
+            check(fail in p.stderr, f'-j{jobs}: failed entry is not reported')
+            check(p.stderr.find(bad_err) < p.stderr.find(fail) < p.stderr.find(b_err),
+                  f'-j{jobs}: diagnostics are out of order:\n{p.stderr}')
+
+            # Time report of a file does not include the memory used by other files.
+            a0 = json.load(open('a0.json'))
+            a = json.load(open('a.json'))
+            check(a['peak_mem'] == a0['peak_mem'], f'-j{jobs}: time report includes other files')
+
+            os.remove('a.c')
+            os.remove('b.c')
+
+        # Manifest errors are reported before anything is compiled.
+        write('m.txt', 'a.re\n')
+        p = subprocess.run([re2c, '--batch', 'm.txt'], capture_output=True, text=True)
+        check(p.returncode != 0 and 'm.txt:1: expected input and output file' in p.stderr,
+              'malformed manifest entry is not reported')
+
+    print('OK')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+
+"""Test the compilation cache (`--cache-dir` option).
+
+Usage: test.py [path-to-re2c]
+"""
+
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def write(path, text):
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def read(path):
+    with open(path) as f:
+        return f.read()
+
+
+def check(cond, msg):
+    if not cond:
+        print(f'FAIL: {msg}')
+        sys.exit(1)
+
+
+def main():
+    re2c = os.path.abspath(sys.argv[1] if len(sys.argv) > 1 else 're2c')
+
+    with tempfile.TemporaryDirectory() as tmp:
+        os.chdir(tmp)
+        os.mkdir('src')
+        os.mkdir('inc')
+        os.mkdir('cache')
+        write('src/x.re', '/*!include:re2c "d.re" */\n'
+                          '/*!re2c\n'
+                          '    re2c:yyfill:enable = 0;\n'
+                          '    d { return 1; }\n'
+                          '    * { return 0; }\n'
+                          '*/\n')
+        write('inc/d.re', '/*!re2c d = "inc"; */\n')
+
+        def compile(cache=True, opts=()):
+            args = [re2c, 'src/x.re', '-o', 'x.c', '-I', 'inc/', '--no-generation-date', *opts]
+            if cache:
+                args += ['--cache-dir', 'cache']
+            subprocess.run(args, check=True)
+            return read('x.c')
+
+        def entries():
+            return [os.path.join('cache', f) for f in os.listdir('cache')]
+
+        # The first run stores a cache entry.
+        out = compile()
+        check(len(entries()) == 1, 'cache entry is not stored')
+        check(out == compile(cache=False), 'cached run differs from uncached run')
+
+        # The second run uses the entry: tamper with the cached output to see that it is used.
+        entry = entries()[0]
+        write(entry, read(entry).replace('return 1;', 'return 2;'))
+        check('return 2;' in compile(), 'cache entry is not used')
+        write(entry, read(entry).replace('return 2;', 'return 1;'))
+
+        # The time report is written on a cache hit as well.
+        compile(opts=['--time-report', 'r.json'])
+        os.remove('r.json')
+        check(compile(opts=['--time-report', 'r.json']) == out, 'cached run with time report differs')
+        check(os.path.exists('r.json'), 'time report is not written on a cache hit')
+        phases = [p['phase'] for p in json.loads(read('r.json'))['phases']]
+        check(phases == ['cache'], f'unexpected phases on a cache hit: {phases}')
+
+        # A changed include file invalidates the entry.
+        write('inc/d.re', '/*!re2c d = "inc2"; */\n')
+        out2 = compile()
+        check(out2 != out and out2 == compile(cache=False), 'changed include file is not detected')
+
+        # A new include file that shadows the old one in the search order invalidates the entry.
+        write('src/d.re', '/*!re2c d = "src"; */\n')
+        out3 = compile()
+        check(out3 != out2 and out3 == compile(cache=False), 'shadowing include file is not detected')
+
+    print('OK')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+
+"""Test the compile server (`--server` option).
+
+Usage: test.py [path-to-re2c]
+"""
+
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def write(path, text):
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def read(path):
+    with open(path) as f:
+        return f.read()
+
+
+def check(cond, msg):
+    if not cond:
+        print(f'FAIL: {msg}')
+        sys.exit(1)
+
+
+class Server:
+    def __init__(self, re2c, *opts):
+        self.proc = subprocess.Popen([re2c, '--server', '--no-generation-date', *opts],
+                                     stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+
+    def line(self):
+        return self.proc.stdout.readline().decode()
+
+    def request(self, req):
+        """Send a request, return status, diagnostics and a dict of generated files."""
+        self.proc.stdin.write((req + '\n').encode())
+        self.proc.stdin.flush()
+
+        header = self.line().split()
+        check(len(header) == 3 and header[0] in ['ok', 'error'], f'bad response header: {header}')
+        diag = self.proc.stdout.read(int(header[1])).decode()
+        files = {}
+        for _ in range(int(header[2])):
+            size, path = self.line().rstrip('\n').split(' ', 1)
+            files[path] = self.proc.stdout.read(int(size)).decode()
+        return header[0], diag, files
+
+    def close(self):
+        self.proc.stdin.close()
+        rest = self.proc.stdout.read()
+        return self.proc.wait(), rest
+
+
+def main():
+    re2c = os.path.abspath(sys.argv[1] if len(sys.argv) > 1 else 're2c')
+
+    with tempfile.TemporaryDirectory() as tmp:
+        os.chdir(tmp)
+        write('x.re', '/*!include:re2c "d.re" */\n'
+                      '/*!re2c\n'
+                      '    re2c:yyfill:enable = 0;\n'
+                      '    d { return 1; }\n'
+                      '    * { return 0; }\n'
+                      '*/\n')
+        write('d.re', '/*!re2c d = "a"; */\n')
+        write('bad.re', '/*!re2c\n'
+                        '    [a-z { return 1; }\n'
+                        '*/\n')
+
+        # Reference diagnostics and generated files of a separate run.
+        def single(src, out, header=None):
+            args = [re2c, src, '-o', out, '--no-generation-date']
+            if header:
+                args += ['-t', header]
+            p = subprocess.run(args, capture_output=True, text=True)
+            if p.returncode != 0:
+                return p.stderr, None
+            return p.stderr, {f: read(f) for f in [out, header] if f}
+
+        server = Server(re2c, '-j', '2')
+
+        # The response contains all generated files, the same as with a separate re2c run.
+        _, expect = single('x.re', 'x.c', 'x.h')
+        status, diag, files = server.request('x.re x.c -t x.h --time-report r.json')
+        check(status == 'ok' and diag == '', f'request failed: {status} {diag}')
+        check(files == expect, 'response differs from a separate run')
+
+        # An unchanged file is served from memory.
+        os.remove('x.c')
+        status, _, files = server.request('x.re x.c -t x.h --time-report r.json')
+        phases = [p['phase'] for p in json.loads(read('r.json'))['phases']]
+        check(status == 'ok' and files == expect, 'cached response differs')
+        check(phases == ['cache'], f'unchanged file is not served from memory: {phases}')
+        check(read('x.c') == expect['x.c'], 'cached output file is not written')
+
+        # A changed include file is detected.
+        write('d.re', '/*!re2c d = "b"; */\n')
+        _, expect2 = single('x.re', 'x.c', 'x.h')
+        status, _, files = server.request('x.re x.c -t x.h --time-report r.json')
+        phases = [p['phase'] for p in json.loads(read('r.json'))['phases']]
+        check(status == 'ok' and files == expect2, 'changed include file is not detected')
+        check(phases != ['cache'], 'stale entry is used')
+
+        # A failed request reports diagnostics and does not stop the server.
+        err, _ = single('bad.re', 'bad.c')
+        status, diag, files = server.request('bad.re bad.c')
+        check(status == 'error' and diag == err, f'failed request is not reported: {status} {diag}')
+        status, diag, _ = server.request('x.re')
+        check(status == 'error' and 'expected input and output file' in diag,
+              f'malformed request is not reported: {status} {diag}')
+        status, diag, files = server.request('x.re x.c -t x.h')
+        check(status == 'ok' and files == expect2, 'server does not recover after a failure')
+
+        # Empty lines are ignored, and the server exits at the end of input.
+        server.proc.stdin.write(b'\n\n')
+        ret, rest = server.close()
+        check(ret == 0 and rest == b'', f'server exits with status {ret} and output {rest}')
+
+    print('OK')
+
+
+if __name__ == '__main__':
+    main()
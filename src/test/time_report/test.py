@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+
+"""Test the time report (`--time-report` option).
+
+Usage: test.py [path-to-re2c]
+"""
+
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def write(path, text):
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def read(path):
+    with open(path) as f:
+        return f.read()
+
+
+def check(cond, msg):
+    if not cond:
+        print(f'FAIL: {msg}')
+        sys.exit(1)
+
+
+PHASE_KEYS = {'phase', 'block', 'cond', 'wall_ms', 'cpu_ms', 'size', 'mem'}
+MEM_KEYS = {'ast', 'ir', 'dfa', 'out'}
+DFA_PHASES = ['regexp', 're_to_nfa', 'determinization', 'minimization', 'adfa']
+CODEGEN_PHASES = ['codegen_analyze', 'codegen_generate', 'codegen_fixup', 'codegen_render']
+
+
+def main():
+    re2c = os.path.abspath(sys.argv[1] if len(sys.argv) > 1 else 're2c')
+
+    with tempfile.TemporaryDirectory() as tmp:
+        os.chdir(tmp)
+        write('x.re', '/*!re2c\n'
+                      '    re2c:yyfill:enable = 0;\n'
+                      '    <a> "x"          { return 1; }\n'
+                      '    <a> *            { return 0; }\n'
+                      '    <b> [a-z]+ @t "y" { return 2; }\n'
+                      '    <b> *            { return 0; }\n'
+                      '*/\n')
+
+        def compile(*opts):
+            args = [re2c, 'x.re', '-o', 'x.c', '-cT', '--no-generation-date', *opts]
+            p = subprocess.run(args, capture_output=True, text=True)
+            return p.returncode, p.stderr, read('x.c') if p.returncode == 0 else None
+
+        _, _, out = compile()
+
+        for jobs in ['1', '2']:
+            ret, err, out2 = compile('-j', jobs, '--time-report', 'r.json')
+            check(ret == 0 and err == '', f'-j{jobs}: compilation failed:\n{err}')
+            check(out2 == out, f'-j{jobs}: time report changes the output')
+
+            # The report exists and parses.
+            check(os.path.exists('r.json'), f'-j{jobs}: time report is not written')
+            try:
+                report = json.loads(read('r.json'))
+            except ValueError as e:
+                check(False, f'-j{jobs}: time report is not valid JSON: {e}')
+            check(set(report) == {'phases', 'total', 'peak_mem'}, f'-j{jobs}: bad report keys')
+
+            phases = report['phases']
+            for p in phases:
+                check(set(p) == PHASE_KEYS and set(p['mem']) == MEM_KEYS,
+                      f'-j{jobs}: bad phase keys: {p}')
+                check(p['wall_ms'] >= 0 and p['cpu_ms'] >= 0, f'-j{jobs}: negative time: {p}')
+
+            # Per-DFA phases are recorded for each condition, codegen phases for the whole program.
+            for cond in ['a', 'b']:
+                names = [p['phase'] for p in phases if p['cond'] == cond]
+                for name in DFA_PHASES:
+                    check(name in names, f'-j{jobs}: no phase {name} for condition {cond}')
+                dets = [p for p in phases if p['cond'] == cond and p['phase'] == 'determinization']
+                check(dets[0]['size'] > 0, f'-j{jobs}: no TDFA size for condition {cond}')
+            names = [p['phase'] for p in phases if p['block'] == '']
+            for name in CODEGEN_PHASES:
+                check(name in names, f'-j{jobs}: no phase {name}')
+
+            # Totals are consistent with the phases.
+            total = report['total']
+            cpu = sum(p['cpu_ms'] for p in phases)
+            check(abs(total['cpu_ms'] - cpu) < 0.001 * len(phases) + 0.01,
+                  f'-j{jobs}: total CPU time {total["cpu_ms"]} is not the sum of phases {cpu}')
+            for kind in MEM_KEYS:
+                check(all(report['peak_mem'][kind] >= p['mem'][kind] for p in phases),
+                      f'-j{jobs}: peak {kind} memory is less than memory in some phase')
+
+            os.remove('r.json')
+
+        # A report that cannot be written is an error.
+        ret, err, _ = compile('--time-report', os.path.join('nonexistent', 'r.json'))
+        check(ret != 0 and 'cannot write time report file' in err, 'write error is not reported')
+
+    print('OK')
+
+
+if __name__ == '__main__':
+    main()
@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <algorithm>
+#include <atomic>
 #include <vector>
 
 #include "src/util/forbid_copy.h"
@@ -18,6 +19,53 @@ enum class AllocatorKind: uint32_t {
     OUT  // output is always alive (parts of it are constructed as early as in the parser)
 };
 
+static constexpr uint32_t ALLOCATOR_KINDS = 4;
+
+// Memory held by allocators of each kind: the current amount and the high-water mark. Counters are
+// shared between threads and updated only when a slab is allocated or freed, so the overhead is
+// negligible. They are used for `--time-report`.
+//
+// Statistics are kept per compilation: in batch mode several files are compiled at the same time
+// in different threads (see note [batch mode]), and each of them must count only its own memory.
+// An allocator uses the statistics that were current in the thread that created it.
+struct alloc_stats_t {
+    std::atomic<size_t> bytes[ALLOCATOR_KINDS];
+    std::atomic<size_t> peak[ALLOCATOR_KINDS];
+
+    alloc_stats_t(): bytes(), peak() {}
+
+    void add(AllocatorKind kind, size_t size) {
+        const uint32_t k = static_cast<uint32_t>(kind);
+        const size_t n = bytes[k] += size;
+        for (size_t m = peak[k]; m < n && !peak[k].compare_exchange_weak(m, n);) {}
+    }
+
+    void sub(AllocatorKind kind, size_t size) {
+        bytes[static_cast<uint32_t>(kind)] -= size;
+    }
+
+    FORBID_COPY(alloc_stats_t);
+};
+
+// Statistics for allocators created in the current thread (process-wide ones by default).
+inline alloc_stats_t*& thread_alloc_stats() {
+    static alloc_stats_t process_stats;
+    static thread_local alloc_stats_t* stats = &process_stats;
+    return stats;
+}
+
+// Use separate statistics in the current thread for the lifetime of this object. It must outlive
+// all allocators created in its scope.
+class alloc_stats_scope_t {
+    alloc_stats_t stats;
+    alloc_stats_t* prev;
+
+  public:
+    alloc_stats_scope_t(): stats(), prev(thread_alloc_stats()) { thread_alloc_stats() = &stats; }
+    ~alloc_stats_scope_t() { thread_alloc_stats() = prev; }
+    FORBID_COPY(alloc_stats_scope_t);
+};
+
 // Works nice for tiny POD objects (~30 bytes and lower)
 // WARNING: Does not free memory for distinct objects!
 //
@@ -30,15 +78,34 @@ class slab_allocator_t {
     slabs_t slabs_; // quasilist of allocated slabs of `SLAB_SIZE` bytes
     char* current_slab_;
     char* current_slab_end_;
+    size_t bytes_; // total size of allocated slabs
+    alloc_stats_t* stats_;
+
+    void take(slab_allocator_t& that) {
+        slabs_.swap(that.slabs_);
+        current_slab_ = that.current_slab_;
+        current_slab_end_ = that.current_slab_end_;
+        bytes_ = that.bytes_;
+        stats_ = that.stats_;
+        that.current_slab_ = that.current_slab_end_ = nullptr;
+        that.bytes_ = 0;
+    }
 
   public:
-    slab_allocator_t(): slabs_(), current_slab_(nullptr), current_slab_end_(nullptr) {}
+    slab_allocator_t()
+        : slabs_(),
+          current_slab_(nullptr),
+          current_slab_end_(nullptr),
+          bytes_(0),
+          stats_(thread_alloc_stats()) {}
     ~slab_allocator_t() { clear(); }
 
     void clear() {
         std::for_each(slabs_.rbegin(), slabs_.rend(), free);
         slabs_.clear();
         current_slab_ = current_slab_end_ = nullptr;
+        stats_->sub(kind, bytes_);
+        bytes_ = 0;
     }
 
     void* alloc(size_t size) {
@@ -58,10 +125,14 @@ class slab_allocator_t {
             slabs_.push_back(current_slab_);
             result = current_slab_;
             current_slab_ += size;
+            bytes_ += SLAB_SIZE;
+            stats_->add(kind, SLAB_SIZE);
         } else {
             // large size; allocate standalone piece of memory
             result = static_cast<char*>(malloc(size));
             slabs_.push_back(result);
+            bytes_ += size;
+            stats_->add(kind, size);
         }
 
         return result;
@@ -72,8 +143,36 @@ class slab_allocator_t {
         return static_cast<data_t*>(alloc(n * sizeof(data_t)));
     }
 
-    slab_allocator_t(slab_allocator_t&&) = default;
-    slab_allocator_t& operator=(slab_allocator_t&&) = default;
+    // Take ownership of all memory allocated by another allocator (which becomes empty). Unlike
+    // move assignment, this keeps the memory already allocated by this allocator.
+    void splice(slab_allocator_t& that) {
+        slabs_.insert(slabs_.end(), that.slabs_.begin(), that.slabs_.end());
+        bytes_ += that.bytes_;
+        if (stats_ != that.stats_) {
+            that.stats_->sub(kind, that.bytes_);
+            stats_->add(kind, that.bytes_);
+        }
+        that.slabs_.clear();
+        that.current_slab_ = that.current_slab_end_ = nullptr;
+        that.bytes_ = 0;
+    }
+
+    // moved-from allocator must not free (or uncount) the slabs that it no longer owns
+    slab_allocator_t(slab_allocator_t&& that)
+        : slabs_(),
+          current_slab_(nullptr),
+          current_slab_end_(nullptr),
+          bytes_(0),
+          stats_(that.stats_) {
+        take(that);
+    }
+    slab_allocator_t& operator=(slab_allocator_t&& that) {
+        if (this != &that) {
+            clear();
+            take(that);
+        }
+        return *this;
+    }
     FORBID_COPY(slab_allocator_t);
 };
 
@@ -0,0 +1,117 @@
+#ifndef _RE2C_UTIL_BITSET_
+#define _RE2C_UTIL_BITSET_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "src/util/check.h"
+#include "src/util/forbid_copy.h"
+
+namespace re2c {
+
+// Packed bit sets stored as arrays of 64-bit words. Sets that are used together must have the
+// same number of words: set operations (union, difference, comparison) work on whole words, and
+// the simple loops over words are easily vectorized by the compiler. Bits past the end of the set
+// (in the last word) are never set, so whole-word operations need no masking.
+
+using bitword_t = uint64_t;
+
+static constexpr size_t BITWORD_BITS = 64;
+
+constexpr inline size_t bit_words(size_t nbits) {
+    return (nbits + BITWORD_BITS - 1) / BITWORD_BITS;
+}
+
+inline bool bit_test(const bitword_t* s, size_t i) {
+    return (s[i / BITWORD_BITS] >> (i % BITWORD_BITS)) & 1u;
+}
+
+inline void bit_set(bitword_t* s, size_t i) {
+    s[i / BITWORD_BITS] |= bitword_t(1) << (i % BITWORD_BITS);
+}
+
+inline void bit_reset(bitword_t* s, size_t i) {
+    s[i / BITWORD_BITS] &= ~(bitword_t(1) << (i % BITWORD_BITS));
+}
+
+inline void bits_clear(bitword_t* s, size_t nwords) {
+    memset(s, 0, nwords * sizeof(bitword_t));
+}
+
+inline void bits_copy(bitword_t* s, const bitword_t* t, size_t nwords) {
+    memcpy(s, t, nwords * sizeof(bitword_t));
+}
+
+inline bool bits_equal(const bitword_t* s, const bitword_t* t, size_t nwords) {
+    return memcmp(s, t, nwords * sizeof(bitword_t)) == 0;
+}
+
+// s = s | t
+inline void bits_union(bitword_t* s, const bitword_t* t, size_t nwords) {
+    for (size_t i = 0; i < nwords; ++i) s[i] |= t[i];
+}
+
+inline uint32_t bit_ctz(bitword_t w) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_ctzll(w));
+#else
+    uint32_t n = 0;
+    for (; !(w & 1u); w >>= 1) ++n;
+    return n;
+#endif
+}
+
+// Calls `f` for the index of each bit in the set, in increasing order. Zero words are skipped at
+// once, so the cost is proportional to the number of words plus the number of set bits.
+template<typename func_t>
+inline void bits_for_each(const bitword_t* s, size_t nwords, func_t f) {
+    for (size_t i = 0; i < nwords; ++i) {
+        for (bitword_t w = s[i]; w != 0; w &= w - 1) {
+            f(i * BITWORD_BITS + bit_ctz(w));
+        }
+    }
+}
+
+// Matrix of bits with each row stored as a separate bit set (rows are padded to whole words).
+class bitmatrix_t {
+    bitword_t* data;
+    size_t nrows;
+    size_t nwords;
+
+  public:
+    bitmatrix_t(size_t rows, size_t cols)
+        : data(new bitword_t[rows * bit_words(cols)]), nrows(rows), nwords(bit_words(cols)) {
+        clear();
+    }
+
+    ~bitmatrix_t() {
+        delete[] data;
+    }
+
+    size_t rows() const { return nrows; }
+
+    // number of words in a row
+    size_t words() const { return nwords; }
+
+    bitword_t* row(size_t i) {
+        DCHECK(i < nrows);
+        return data + i * nwords;
+    }
+
+    const bitword_t* row(size_t i) const {
+        DCHECK(i < nrows);
+        return data + i * nwords;
+    }
+
+    bool test(size_t i, size_t j) const { return bit_test(row(i), j); }
+    void set(size_t i, size_t j) { bit_set(row(i), j); }
+
+    void clear() { bits_clear(data, nrows * nwords); }
+
+    FORBID_COPY(bitmatrix_t);
+};
+
+} // namespace re2c
+
+#endif // _RE2C_UTIL_BITSET_
@@ -5,10 +5,10 @@
 #include <stdint.h>
 #include <string.h>
 #include <limits>
-#include <map>
 #include <vector>
 
 #include "src/util/check.h"
+#include "src/util/hash64.h"
 
 namespace re2c {
 
@@ -82,8 +82,94 @@ struct membuf_t {
     }
 };
 
-// Lookup table with O(1) random access and  O(log(n)) insertion (a vector paired with a map).
-template<typename data_t, typename hash_t = uint32_t>
+// Hash table with 64-bit keys and open addressing (linear probing). All slots are stored in one
+// contiguous array, which is much more cache-friendly than a node-based std::map or
+// std::unordered_map, and clearing the table keeps the memory for reuse. The table is kept at most
+// half full, so probe sequences are short. Values must be copyable; there is no removal.
+//
+// A slot is used if its generation is the current generation of the table, so clearing the table
+// is O(1): it starts a new generation (a table that grew large once may be cleared many times).
+template<typename value_t>
+class hash_table_t {
+    struct slot_t {
+        uint64_t key;
+        value_t value;
+        uint32_t gen;
+    };
+
+    std::vector<slot_t> slots;
+    size_t count;
+    uint32_t gen; // current generation (never zero, unused slots have generation zero)
+
+  public:
+    hash_table_t(): slots(), count(0), gen(1) {}
+
+    size_t size() const { return count; }
+
+    void clear() {
+        if (count == 0) return;
+        count = 0;
+        if (++gen == 0) {
+            // generation counter wrapped around, reset all slots
+            for (slot_t& s : slots) s.gen = 0;
+            gen = 1;
+        }
+    }
+
+    // Returns a pointer to the value for the given key, or null if the key is not in the table.
+    value_t* find(uint64_t key) {
+        if (count == 0) return nullptr;
+        slot_t& s = probe(key);
+        return s.gen == gen ? &s.value : nullptr;
+    }
+
+    const value_t* find(uint64_t key) const {
+        return const_cast<hash_table_t*>(this)->find(key);
+    }
+
+    // Inserts a new value for the given key (if the key is already in the table, the old value is
+    // kept). Returns a reference to the value in the table.
+    value_t& insert(uint64_t key, const value_t& value) {
+        if (2 * (count + 1) > slots.size()) grow();
+        slot_t& s = probe(key);
+        if (s.gen != gen) {
+            s.key = key;
+            s.value = value;
+            s.gen = gen;
+            ++count;
+        }
+        return s.value;
+    }
+
+    // Same as `insert`, but overwrites the old value if there is one.
+    void set(uint64_t key, const value_t& value) {
+        insert(key, value) = value;
+    }
+
+  private:
+    // Returns either the slot with the given key, or the empty slot where it should be inserted.
+    slot_t& probe(uint64_t key) {
+        const size_t mask = slots.size() - 1;
+        for (size_t i = static_cast<size_t>(mix64(key)) & mask;; i = (i + 1) & mask) {
+            slot_t& s = slots[i];
+            if (s.gen != gen || s.key == key) return s;
+        }
+    }
+
+    void grow() {
+        std::vector<slot_t> old;
+        old.swap(slots);
+        slots.resize(old.empty() ? 16 : 2 * old.size());
+        for (slot_t& s : slots) s.gen = 0;
+        for (const slot_t& s : old) {
+            if (s.gen == gen) probe(s.key) = s;
+        }
+    }
+};
+
+// Lookup table with O(1) random access and O(1) insertion (a vector paired with a hash table that
+// maps hashes to chains of elements with the same hash).
+template<typename data_t>
 struct lookup_t {
     enum : uint32_t { NIL = ~0u };
 
@@ -96,7 +182,7 @@ struct lookup_t {
     };
 
     std::vector<elem_t> elems;
-    std::map<hash_t, uint32_t> lookup;
+    hash_table_t<uint32_t> lookup;
 
   public:
     lookup_t(): elems(), lookup() {}
@@ -105,6 +191,11 @@ struct lookup_t {
         return static_cast<uint32_t>(elems.size());
     }
 
+    void clear() {
+        elems.clear();
+        lookup.clear();
+    }
+
     data_t& operator[](uint32_t idx) {
         DCHECK(idx < elems.size());
         return elems[idx].data;
@@ -115,16 +206,16 @@ struct lookup_t {
         return elems[idx].data;
     }
 
-    uint32_t push(hash_t hash, const data_t& data) {
+    uint32_t push(uint64_t hash, const data_t& data) {
         DCHECK(elems.size() < NIL);
         const uint32_t idx = static_cast<uint32_t>(elems.size());
         elems.push_back(elem_t(head(hash), data));
-        lookup[hash] = idx;
+        lookup.set(hash, idx);
         return idx;
     }
 
     template<typename pred_t>
-    uint32_t find_with(hash_t hash, const data_t& data, pred_t& pred) const {
+    uint32_t find_with(uint64_t hash, const data_t& data, pred_t& pred) const {
         return find(head(hash), data, pred);
     }
 
@@ -134,9 +225,9 @@ struct lookup_t {
     }
 
   private:
-    uint32_t head(hash_t h) const {
-        typename std::map<hash_t, uint32_t>::const_iterator x = lookup.find(h);
-        return x == lookup.end() ? NIL : x->second;
+    uint32_t head(uint64_t h) const {
+        const uint32_t* x = lookup.find(h);
+        return x ? *x : NIL;
     }
 
     template<typename pred_t>
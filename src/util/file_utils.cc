@@ -1,6 +1,7 @@
 #include "config.h"
 #include <time.h>
 #include "src/util/file_utils.h"
+#include "src/util/hash64.h"
 
 #if !defined(_MSC_VER) \
     && defined(HAVE_FCNTL_H) \
@@ -111,6 +112,70 @@ void get_dir(std::string& path) {
     path.resize(i);
 }
 
+bool read_file(const std::string& fname, std::string& content) {
+    FILE* f = fopen(fname.c_str(), "r");
+    if (!f) return false;
+
+    static constexpr size_t BLK = 4096;
+    char buf[BLK];
+    content.clear();
+    for (size_t n; (n = fread(buf, 1, BLK, f)) > 0;) {
+        content.append(buf, n);
+    }
+    const bool ok = !ferror(f);
+
+    fclose(f);
+    return ok;
+}
+
+bool write_file(const std::string& fname, const std::string& content) {
+    // write to a temporary file first, so that a partially written file is never observed
+    std::string tempname = fname;
+    FILE* f = temp_file(tempname);
+    if (!f) return false;
+
+    const bool ok = fwrite(content.data(), 1, content.size(), f) == content.size();
+
+    fclose(f);
+    if (!ok || !overwrite_file(tempname.c_str(), fname.c_str())) {
+        remove(tempname.c_str());
+        return false;
+    }
+    return true;
+}
+
+// The hash of file contents (the terminating null is included, so that it is the same as the hash
+// of the contents followed by other strings).
+uint64_t hash_content(const std::string& content) {
+    return fnv64(FNV64_INIT, content.c_str(), content.length() + 1);
+}
+
+// Hash the contents of an open file and rewind it. This fails for stdin and pipes (they cannot be
+// rewound, and reading them would consume the input).
+bool hash_file(FILE* file, uint64_t& hash) {
+    if (fseek(file, 0, SEEK_SET) != 0) return false;
+
+    static constexpr size_t BLK = 4096;
+    char buf[BLK];
+    uint64_t h = FNV64_INIT;
+    for (size_t n; (n = fread(buf, 1, BLK, file)) > 0;) {
+        h = fnv64(h, buf, n);
+    }
+    const char nul = 0;
+    hash = fnv64(h, &nul, 1);
+
+    const bool ok = !ferror(file);
+    return fseek(file, 0, SEEK_SET) == 0 && ok;
+}
+
+bool hash_file(const std::string& fname, uint64_t& hash) {
+    FILE* f = fopen(fname.c_str(), "rb");
+    if (!f) return false;
+    const bool ok = hash_file(f, hash);
+    fclose(f);
+    return ok;
+}
+
 } // namespace re2c
 
 #undef OPEN
@@ -1,6 +1,7 @@
 #ifndef _RE2C_UTIL_FILE_UTILS_
 #define _RE2C_UTIL_FILE_UTILS_
 
+#include <stdint.h>
 #include <stdio.h>
 #include <string>
 
@@ -9,6 +10,11 @@ namespace re2c {
 FILE* temp_file(std::string& fname);
 bool overwrite_file(const char* srcname, const char* dstname);
 void get_dir(std::string& path);
+bool read_file(const std::string& fname, std::string& content);
+bool write_file(const std::string& fname, const std::string& content);
+uint64_t hash_content(const std::string& content);
+bool hash_file(FILE* file, uint64_t& hash);
+bool hash_file(const std::string& fname, uint64_t& hash);
 
 } // namespace re2c
 
@@ -0,0 +1,59 @@
+#ifndef _RE2C_UTIL_HASH64_
+#define _RE2C_UTIL_HASH64_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace re2c {
+
+// Final mixing step of splitmix64: every input bit affects every output bit, so that keys that
+// differ only in a few bits (such as pairs of small indices) are spread uniformly over the table.
+static inline uint64_t mix64(uint64_t h) {
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebull;
+    h ^= h >> 31;
+    return h;
+}
+
+static inline uint64_t hash8(uint64_t h, uint64_t k) {
+    return (h ^ mix64(k)) * 0x9e3779b97f4a7c15ull;
+}
+
+// hash in 8-byte chunks for speed (memcpy compiles to a single unaligned load)
+inline uint64_t hash64(uint64_t h, const void* data, size_t size) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    const uint8_t* e = p + size;
+    uint64_t k;
+
+    for (; e - p >= 8; p += 8) {
+        memcpy(&k, p, 8);
+        h = hash8(h, k);
+    }
+    if (p < e) {
+        k = 0;
+        memcpy(&k, p, static_cast<size_t>(e - p));
+        h = hash8(h, k ^ (static_cast<uint64_t>(e - p) << 56));
+    }
+
+    return h;
+}
+
+// 64-bit FNV-1a hash. It is slower than `hash64`, but does not depend on the byte order, so it is
+// used for hashes that are stored in files (see note [compilation cache]).
+static const uint64_t FNV64_INIT = 0xcbf29ce484222325ull;
+
+inline uint64_t fnv64(uint64_t h, const void* data, size_t size) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        h ^= p[i];
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+} // namespace re2c
+
+#endif // _RE2C_UTIL_HASH64_
@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <time.h>
+#include <string>
+
+#include "src/util/file_utils.h"
+#include "src/util/string_utils.h"
+#include "src/util/time_report.h"
+
+namespace re2c {
+
+static const char* ALLOCATOR_NAMES[ALLOCATOR_KINDS] = {"ast", "ir", "dfa", "out"};
+
+static double ms_since(std::chrono::steady_clock::time_point t) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t).count();
+}
+
+// CPU time of the calling thread (or of the whole process if per-thread time is unsupported).
+static double thread_cpu_ms() {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+        return static_cast<double>(ts.tv_sec) * 1e3 + static_cast<double>(ts.tv_nsec) / 1e6;
+    }
+#endif
+    return static_cast<double>(clock()) * 1e3 / CLOCKS_PER_SEC;
+}
+
+static void json_str(std::string& out, const std::string& s) {
+    out += '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+static void json_num(std::string& out, double x) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.3f", x);
+    out += buf;
+}
+
+static void json_num(std::string& out, size_t x) {
+    out += to_string(x);
+}
+
+static void json_mem(std::string& out, const size_t* mem) {
+    out += '{';
+    for (uint32_t i = 0; i < ALLOCATOR_KINDS; ++i) {
+        if (i > 0) out += ", ";
+        json_str(out, ALLOCATOR_NAMES[i]);
+        out += ": ";
+        json_num(out, mem[i]);
+    }
+    out += '}';
+}
+
+TimeReport::TimeReport(bool enabled)
+    : enabled(enabled),
+      phases(),
+      wall_start(std::chrono::steady_clock::now()),
+      cpu_start(thread_cpu_ms()),
+      wall_init(wall_start) {}
+
+void TimeReport::start() {
+    if (!enabled) return;
+    wall_start = std::chrono::steady_clock::now();
+    cpu_start = thread_cpu_ms();
+}
+
+void TimeReport::mark(
+        const char* name, const std::string& block, const std::string& cond, size_t size) {
+    if (!enabled) return;
+
+    const double cpu = thread_cpu_ms();
+    phase_t p = {name, block, cond, ms_since(wall_start), cpu - cpu_start, size, {}};
+    const alloc_stats_t& stats = *thread_alloc_stats();
+    for (uint32_t i = 0; i < ALLOCATOR_KINDS; ++i) p.mem[i] = stats.bytes[i];
+    phases.push_back(p);
+
+    // start the next phase (excluding the time spent in this function)
+    wall_start = std::chrono::steady_clock::now();
+    cpu_start = thread_cpu_ms();
+}
+
+void TimeReport::merge(const TimeReport& that) {
+    if (!enabled) return;
+    phases.insert(phases.end(), that.phases.begin(), that.phases.end());
+    start();
+}
+
+bool TimeReport::write(const std::string& fname) const {
+    std::string out = "{\n  \"phases\": [";
+    double cpu_ms = 0;
+    for (size_t i = 0; i < phases.size(); ++i) {
+        const phase_t& p = phases[i];
+        cpu_ms += p.cpu_ms;
+        out += i > 0 ? ",\n    {" : "\n    {";
+        out += "\"phase\": ";
+        json_str(out, p.name);
+        out += ", \"block\": ";
+        json_str(out, p.block);
+        out += ", \"cond\": ";
+        json_str(out, p.cond);
+        out += ", \"wall_ms\": ";
+        json_num(out, p.wall_ms);
+        out += ", \"cpu_ms\": ";
+        json_num(out, p.cpu_ms);
+        out += ", \"size\": ";
+        json_num(out, p.size);
+        out += ", \"mem\": ";
+        json_mem(out, p.mem);
+        out += '}';
+    }
+    out += "\n  ],\n  \"total\": {\"wall_ms\": ";
+    json_num(out, ms_since(wall_init));
+    out += ", \"cpu_ms\": ";
+    json_num(out, cpu_ms);
+    out += "},\n  \"peak_mem\": ";
+    const alloc_stats_t& stats = *thread_alloc_stats();
+    size_t peak[ALLOCATOR_KINDS];
+    for (uint32_t i = 0; i < ALLOCATOR_KINDS; ++i) peak[i] = stats.peak[i];
+    json_mem(out, peak);
+    out += "\n}\n";
+
+    return write_file(fname, out);
+}
+
+} // namespace re2c
@@ -0,0 +1,59 @@
+#ifndef _RE2C_UTIL_TIME_REPORT_
+#define _RE2C_UTIL_TIME_REPORT_
+
+#include <stddef.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "src/util/allocator.h"
+
+namespace re2c {
+
+// note [time report]
+//
+// With `--time-report FILE` option re2c records wall and CPU time spent in each compilation phase
+// (parsing, regexp transformations, TNFA and TDFA construction, tag optimization, minimization,
+// codegen passes) and writes a JSON report to the given file. Per-DFA phases are recorded for each
+// block and condition, codegen passes work on the whole program and have no block.
+//
+// For each phase the report also contains the size of its result (the number of TNFA/TDFA states,
+// zero if not applicable) and the memory held by slab allocators of each kind at the end of phase.
+// The peak memory for each allocator kind is reported at the end. CPU time is per-thread where
+// the platform supports it, and the total CPU time is the sum over all phases. Memory counters are
+// per compilation (see `alloc_stats_t`), so in batch mode each file reports only its own memory,
+// but with `--jobs` per-phase memory includes allocations made by other threads of the same
+// compilation at the same time.
+//
+// The report is a lap timer: each `mark` closes the phase that started at the previous `mark` (or
+// `start`). When the report is disabled, `mark` does nothing.
+class TimeReport {
+    struct phase_t {
+        const char* name;
+        std::string block;
+        std::string cond;
+        double wall_ms;
+        double cpu_ms;
+        size_t size;
+        size_t mem[ALLOCATOR_KINDS];
+    };
+
+    bool enabled;
+    std::vector<phase_t> phases;
+    std::chrono::steady_clock::time_point wall_start; // start of the current phase
+    double cpu_start;
+    std::chrono::steady_clock::time_point wall_init; // start of the whole program
+
+  public:
+    explicit TimeReport(bool enabled);
+    bool is_enabled() const { return enabled; }
+    void start();
+    void mark(const char* name, const std::string& block, const std::string& cond, size_t size);
+    void mark(const char* name) { mark(name, "", "", 0); }
+    void merge(const TimeReport& that);
+    bool write(const std::string& fname) const;
+};
+
+} // namespace re2c
+
+#endif // _RE2C_UTIL_TIME_REPORT_
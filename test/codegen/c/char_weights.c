@@ -0,0 +1,172 @@
+/* Generated by re2c */
+#line 1 "codegen/c/char_weights.re"
+// re2c $INPUT -o $OUTPUT -s
+#include <assert.h>
+
+static int lex(const char *YYCURSOR)
+{
+    
+#line 10 "codegen/c/char_weights.c"
+{
+	unsigned char yych;
+	yych = *YYCURSOR;
+	if (yych <= 'z') {
+		if (yych <= '`') {
+			if (yych <= ' ') {
+				if (yych <= 0x1F) {
+					if (yych <= '\r') {
+						if (yych <= 0x08) {
+							if (__builtin_expect(yych >= 0x01, 1)) goto yy1;
+						} else {
+							if (yych <= '\n') goto yy2;
+							if (yych <= '\f') goto yy1;
+							goto yy2;
+						}
+					} else {
+						goto yy1;
+					}
+				} else {
+					goto yy2;
+				}
+			} else {
+				if (yych <= '@') {
+					if (yych <= '/') {
+						if (yych <= '!') goto yy4;
+						if (yych <= '\'') goto yy1;
+						goto yy6;
+					} else {
+						if (yych <= '9') {
+							goto yy7;
+						} else {
+							if (yych <= ':') goto yy1;
+							if (yych <= ';') goto yy6;
+							if (yych <= '>') goto yy4;
+							goto yy1;
+						}
+					}
+				} else {
+					if (yych <= 'Z') goto yy9;
+					if (yych == '_') goto yy10;
+					goto yy1;
+				}
+			}
+		} else {
+			goto yy10;
+		}
+	} else {
+		if (yych <= 0x7F) {
+			if (yych == '|') goto yy1;
+			if (yych <= '}') goto yy6;
+			goto yy1;
+		} else {
+			goto yy11;
+		}
+	}
+	++YYCURSOR;
+#line 11 "codegen/c/char_weights.re"
+	{ return 0; }
+#line 69 "codegen/c/char_weights.c"
+yy1:
+	++YYCURSOR;
+#line 19 "codegen/c/char_weights.re"
+	{ return -1; }
+#line 74 "codegen/c/char_weights.c"
+yy2:
+	yych = *++YYCURSOR;
+	if (yych <= ' ') {
+		if (yych <= 0x1F) {
+			if (yych <= '\r') {
+				if (yych <= 0x08) goto yy3;
+				if (yych <= '\n') goto yy2;
+				if (yych >= '\r') goto yy2;
+			}
+		} else {
+			goto yy2;
+		}
+	}
+yy3:
+#line 15 "codegen/c/char_weights.re"
+	{ return 4; }
+#line 91 "codegen/c/char_weights.c"
+yy4:
+	yych = *++YYCURSOR;
+	if (yych == '=') goto yy12;
+yy5:
+#line 17 "codegen/c/char_weights.re"
+	{ return 6; }
+#line 98 "codegen/c/char_weights.c"
+yy6:
+	++YYCURSOR;
+	goto yy5;
+yy7:
+	yych = *++YYCURSOR;
+	if (yych <= '/') goto yy8;
+	if (yych <= '9') goto yy7;
+yy8:
+#line 14 "codegen/c/char_weights.re"
+	{ return 3; }
+#line 109 "codegen/c/char_weights.c"
+yy9:
+	yych = *++YYCURSOR;
+	if (yych <= 'z') {
+		if (yych <= '`') {
+			if (yych > '/') {
+				if (yych <= '@') {
+					if (yych <= '9') goto yy9;
+				} else {
+					if (yych <= 'Z') goto yy9;
+					if (yych == '_') goto yy9;
+				}
+			}
+		} else {
+			goto yy9;
+		}
+	}
+#line 13 "codegen/c/char_weights.re"
+	{ return 2; }
+#line 128 "codegen/c/char_weights.c"
+yy10:
+	yych = *++YYCURSOR;
+	if (yych <= 'z') {
+		if (yych <= '`') {
+			if (yych > '/') {
+				if (yych <= '9') goto yy10;
+				if (yych == '_') goto yy10;
+			}
+		} else {
+			goto yy10;
+		}
+	}
+#line 12 "codegen/c/char_weights.re"
+	{ return 1; }
+#line 143 "codegen/c/char_weights.c"
+yy11:
+	yych = *++YYCURSOR;
+	if (yych >= 0x80) goto yy11;
+#line 18 "codegen/c/char_weights.re"
+	{ return 7; }
+#line 149 "codegen/c/char_weights.c"
+yy12:
+	++YYCURSOR;
+#line 16 "codegen/c/char_weights.re"
+	{ return 5; }
+#line 154 "codegen/c/char_weights.c"
+}
+#line 20 "codegen/c/char_weights.re"
+
+}
+
+int main()
+{
+    assert(lex("") == 0);
+    assert(lex("abc") == 1);
+    assert(lex("_x1") == 1);
+    assert(lex("Abc") == 2);
+    assert(lex("123") == 3);
+    assert(lex(" \n") == 4);
+    assert(lex("<=") == 5);
+    assert(lex("<") == 6);
+    assert(lex("\xC3\xA9") == 7);
+    assert(lex("@") == -1);
+    return 0;
+}
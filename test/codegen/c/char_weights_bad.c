@@ -0,0 +1 @@
+re2c: error: bad configuration 're2c:char-weights' (expected a list of non-overlapping items 'LB-UB:WEIGHT' or 'CHAR:WEIGHT')
@@ -0,0 +1,1071 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i --collapse-chains
+#include <assert.h>
+#include <string.h>
+
+#define YYCTYPE char
+#define YYMAXFILL 23
+
+
+
+
+static int lex1(const char *YYCURSOR, const char *YYLIMIT)
+{
+    
+{
+	YYCTYPE yych;
+	if ((YYLIMIT - YYCURSOR) < 23) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 's':
+		case 't':
+		case 'x':
+		case 'y':
+		case 'z': goto yy2;
+		case 'r': goto yy5;
+		case 'u': goto yy6;
+		case 'v': goto yy7;
+		case 'w': goto yy8;
+		default: goto yy1;
+	}
+yy1:
+	++YYCURSOR;
+	{ return -1; }
+yy2:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+yy3:
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy2;
+		default: goto yy4;
+	}
+yy4:
+	{ return 0; }
+yy5:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'e': goto yy9;
+		default: goto yy3;
+	}
+yy6:
+	yych = *++YYCURSOR;
+	if (((unsigned long long)(unsigned char)YYCURSOR[0] | (unsigned long long)(unsigned char)YYCURSOR[1] << 8 | (unsigned long long)(unsigned char)YYCURSOR[2] << 16 | (unsigned long long)(unsigned char)YYCURSOR[3] << 24 | (unsigned long long)(unsigned char)YYCURSOR[4] << 32 | (unsigned long long)(unsigned char)YYCURSOR[5] << 40 | (unsigned long long)(unsigned char)YYCURSOR[6] << 48 | (unsigned long long)(unsigned char)YYCURSOR[7] << 56) == 0x5f64656e6769736eull) {
+		YYCURSOR += 7;
+		goto yy42;
+	}
+	switch (yych) {
+		case 'n': goto yy10;
+		default: goto yy3;
+	}
+yy7:
+	yych = *++YYCURSOR;
+	if (((unsigned long long)(unsigned char)YYCURSOR[0] | (unsigned long long)(unsigned char)YYCURSOR[1] << 8 | (unsigned long long)(unsigned char)YYCURSOR[2] << 16 | (unsigned long long)(unsigned char)YYCURSOR[3] << 24 | (unsigned long long)(unsigned char)YYCURSOR[4] << 32 | (unsigned long long)(unsigned char)YYCURSOR[5] << 40 | (unsigned long long)(unsigned char)YYCURSOR[6] << 48) == 0x656c6974616c6full) {
+		YYCURSOR += 6;
+		goto yy40;
+	}
+	switch (yych) {
+		case 'o': goto yy11;
+		default: goto yy3;
+	}
+yy8:
+	yych = *++YYCURSOR;
+	if (((unsigned long)(unsigned char)YYCURSOR[0] | (unsigned long)(unsigned char)YYCURSOR[1] << 8 | (unsigned long)(unsigned char)YYCURSOR[2] << 16 | (unsigned long)(unsigned char)YYCURSOR[3] << 24) == 0x656c6968ul) {
+		YYCURSOR += 3;
+		goto yy27;
+	}
+	switch (yych) {
+		case 'h': goto yy12;
+		default: goto yy3;
+	}
+yy9:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'g': goto yy13;
+		case 't': goto yy14;
+		default: goto yy3;
+	}
+yy10:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 's': goto yy15;
+		default: goto yy3;
+	}
+yy11:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'l': goto yy16;
+		default: goto yy3;
+	}
+yy12:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'i': goto yy17;
+		default: goto yy3;
+	}
+yy13:
+	yych = *++YYCURSOR;
+	if (((unsigned long long)(unsigned char)YYCURSOR[0] | (unsigned long long)(unsigned char)YYCURSOR[1] << 8 | (unsigned long long)(unsigned char)YYCURSOR[2] << 16 | (unsigned long long)(unsigned char)YYCURSOR[3] << 24 | (unsigned long long)(unsigned char)YYCURSOR[4] << 32) == 0x7265747369ull) {
+		YYCURSOR += 4;
+		goto yy37;
+	}
+	switch (yych) {
+		case 'i': goto yy18;
+		default: goto yy3;
+	}
+yy14:
+	yych = *++YYCURSOR;
+	if (((unsigned long)(unsigned char)YYCURSOR[0] | (unsigned long)(unsigned char)YYCURSOR[1] << 8 | (unsigned long)(unsigned char)YYCURSOR[2] << 16) == 0x6e7275ul) {
+		YYCURSOR += 2;
+		goto yy30;
+	}
+	switch (yych) {
+		case 'u': goto yy19;
+		default: goto yy3;
+	}
+yy15:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'i': goto yy20;
+		default: goto yy3;
+	}
+yy16:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'a': goto yy21;
+		default: goto yy3;
+	}
+yy17:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'l': goto yy22;
+		default: goto yy3;
+	}
+yy18:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 's': goto yy23;
+		default: goto yy3;
+	}
+yy19:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'r': goto yy24;
+		default: goto yy3;
+	}
+yy20:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'g': goto yy25;
+		default: goto yy3;
+	}
+yy21:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 't': goto yy26;
+		default: goto yy3;
+	}
+yy22:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'e': goto yy27;
+		default: goto yy3;
+	}
+yy23:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 't': goto yy29;
+		default: goto yy3;
+	}
+yy24:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'n': goto yy30;
+		default: goto yy3;
+	}
+yy25:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'n': goto yy32;
+		default: goto yy3;
+	}
+yy26:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'i': goto yy33;
+		default: goto yy3;
+	}
+yy27:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy2;
+		default: goto yy28;
+	}
+yy28:
+	{ return 3; }
+yy29:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'e': goto yy34;
+		default: goto yy3;
+	}
+yy30:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy2;
+		default: goto yy31;
+	}
+yy31:
+	{ return 1; }
+yy32:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'e': goto yy35;
+		default: goto yy3;
+	}
+yy33:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'l': goto yy36;
+		default: goto yy3;
+	}
+yy34:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'r': goto yy37;
+		default: goto yy3;
+	}
+yy35:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'd': goto yy39;
+		default: goto yy3;
+	}
+yy36:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'e': goto yy40;
+		default: goto yy3;
+	}
+yy37:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy2;
+		default: goto yy38;
+	}
+yy38:
+	{ return 2; }
+yy39:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_': goto yy42;
+		default: goto yy3;
+	}
+yy40:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy2;
+		default: goto yy41;
+	}
+yy41:
+	{ return 4; }
+yy42:
+	yych = *++YYCURSOR;
+	if (((unsigned long long)(unsigned char)YYCURSOR[0] | (unsigned long long)(unsigned char)YYCURSOR[1] << 8 | (unsigned long long)(unsigned char)YYCURSOR[2] << 16 | (unsigned long long)(unsigned char)YYCURSOR[3] << 24 | (unsigned long long)(unsigned char)YYCURSOR[4] << 32 | (unsigned long long)(unsigned char)YYCURSOR[5] << 40 | (unsigned long long)(unsigned char)YYCURSOR[6] << 48 | (unsigned long long)(unsigned char)YYCURSOR[7] << 56) == 0x6e6f6c5f676e6f6cull) {
+		YYCURSOR += 7;
+		goto yy50;
+	}
+	switch (yych) {
+		case 'l': goto yy43;
+		default: goto yy3;
+	}
+yy43:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'o': goto yy44;
+		default: goto yy3;
+	}
+yy44:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'n': goto yy45;
+		default: goto yy3;
+	}
+yy45:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'g': goto yy46;
+		default: goto yy3;
+	}
+yy46:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_': goto yy47;
+		default: goto yy3;
+	}
+yy47:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'l': goto yy48;
+		default: goto yy3;
+	}
+yy48:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'o': goto yy49;
+		default: goto yy3;
+	}
+yy49:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'n': goto yy50;
+		default: goto yy3;
+	}
+yy50:
+	yych = *++YYCURSOR;
+	if (((unsigned long long)(unsigned char)YYCURSOR[0] | (unsigned long long)(unsigned char)YYCURSOR[1] << 8 | (unsigned long long)(unsigned char)YYCURSOR[2] << 16 | (unsigned long long)(unsigned char)YYCURSOR[3] << 24 | (unsigned long long)(unsigned char)YYCURSOR[4] << 32) == 0x746e695f67ull) {
+		YYCURSOR += 4;
+		goto yy55;
+	}
+	switch (yych) {
+		case 'g': goto yy51;
+		default: goto yy3;
+	}
+yy51:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_': goto yy52;
+		default: goto yy3;
+	}
+yy52:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'i': goto yy53;
+		default: goto yy3;
+	}
+yy53:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'n': goto yy54;
+		default: goto yy3;
+	}
+yy54:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 't': goto yy55;
+		default: goto yy3;
+	}
+yy55:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy2;
+		default: goto yy56;
+	}
+yy56:
+	{ return 5; }
+}
+
+}
+
+static int lex2(const char *YYCURSOR, const char *YYLIMIT)
+{
+    
+{
+	YYCTYPE yych;
+	if ((YYLIMIT - YYCURSOR) < 23) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 's':
+		case 't':
+		case 'x':
+		case 'y':
+		case 'z': goto yy59;
+		case 'r': goto yy62;
+		case 'u': goto yy63;
+		case 'v': goto yy64;
+		case 'w': goto yy65;
+		default: goto yy58;
+	}
+yy58:
+	++YYCURSOR;
+	{ return -1; }
+yy59:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+yy60:
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy59;
+		default: goto yy61;
+	}
+yy61:
+	{ return 0; }
+yy62:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'e': goto yy66;
+		default: goto yy60;
+	}
+yy63:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'n': goto yy67;
+		default: goto yy60;
+	}
+yy64:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'o': goto yy68;
+		default: goto yy60;
+	}
+yy65:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'h': goto yy69;
+		default: goto yy60;
+	}
+yy66:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'g': goto yy70;
+		case 't': goto yy71;
+		default: goto yy60;
+	}
+yy67:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 's': goto yy72;
+		default: goto yy60;
+	}
+yy68:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'l': goto yy73;
+		default: goto yy60;
+	}
+yy69:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'i': goto yy74;
+		default: goto yy60;
+	}
+yy70:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'i': goto yy75;
+		default: goto yy60;
+	}
+yy71:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'u': goto yy76;
+		default: goto yy60;
+	}
+yy72:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'i': goto yy77;
+		default: goto yy60;
+	}
+yy73:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'a': goto yy78;
+		default: goto yy60;
+	}
+yy74:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'l': goto yy79;
+		default: goto yy60;
+	}
+yy75:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 's': goto yy80;
+		default: goto yy60;
+	}
+yy76:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'r': goto yy81;
+		default: goto yy60;
+	}
+yy77:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'g': goto yy82;
+		default: goto yy60;
+	}
+yy78:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 't': goto yy83;
+		default: goto yy60;
+	}
+yy79:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'e': goto yy84;
+		default: goto yy60;
+	}
+yy80:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 't': goto yy86;
+		default: goto yy60;
+	}
+yy81:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'n': goto yy87;
+		default: goto yy60;
+	}
+yy82:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'n': goto yy89;
+		default: goto yy60;
+	}
+yy83:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'i': goto yy90;
+		default: goto yy60;
+	}
+yy84:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy59;
+		default: goto yy85;
+	}
+yy85:
+	{ return 3; }
+yy86:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'e': goto yy91;
+		default: goto yy60;
+	}
+yy87:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy59;
+		default: goto yy88;
+	}
+yy88:
+	{ return 1; }
+yy89:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'e': goto yy92;
+		default: goto yy60;
+	}
+yy90:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'l': goto yy93;
+		default: goto yy60;
+	}
+yy91:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'r': goto yy94;
+		default: goto yy60;
+	}
+yy92:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'd': goto yy96;
+		default: goto yy60;
+	}
+yy93:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'e': goto yy97;
+		default: goto yy60;
+	}
+yy94:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy59;
+		default: goto yy95;
+	}
+yy95:
+	{ return 2; }
+yy96:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_': goto yy99;
+		default: goto yy60;
+	}
+yy97:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy59;
+		default: goto yy98;
+	}
+yy98:
+	{ return 4; }
+yy99:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'l': goto yy100;
+		default: goto yy60;
+	}
+yy100:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'o': goto yy101;
+		default: goto yy60;
+	}
+yy101:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'n': goto yy102;
+		default: goto yy60;
+	}
+yy102:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'g': goto yy103;
+		default: goto yy60;
+	}
+yy103:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_': goto yy104;
+		default: goto yy60;
+	}
+yy104:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'l': goto yy105;
+		default: goto yy60;
+	}
+yy105:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'o': goto yy106;
+		default: goto yy60;
+	}
+yy106:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'n': goto yy107;
+		default: goto yy60;
+	}
+yy107:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'g': goto yy108;
+		default: goto yy60;
+	}
+yy108:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_': goto yy109;
+		default: goto yy60;
+	}
+yy109:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'i': goto yy110;
+		default: goto yy60;
+	}
+yy110:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'n': goto yy111;
+		default: goto yy60;
+	}
+yy111:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 't': goto yy112;
+		default: goto yy60;
+	}
+yy112:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy59;
+		default: goto yy113;
+	}
+yy113:
+	{ return 5; }
+}
+
+}
+
+static int test(const char *s)
+{
+    // pad input with YYMAXFILL zeroes, so that the lexer can read ahead
+    char buf[64] = {0};
+    const size_t len = strlen(s);
+    memcpy(buf, s, len);
+    const int i = lex1(buf, buf + len + YYMAXFILL);
+    assert(i == lex2(buf, buf + len + YYMAXFILL));
+    return i;
+}
+
+int main()
+{
+    assert(test("return") == 1);
+    assert(test("retur") == 0);
+    assert(test("returns") == 0);
+    assert(test("register") == 2);
+    assert(test("while") == 3);
+    assert(test("volatile") == 4);
+    assert(test("unsigned_long_long_int") == 5);
+    assert(test("unsigned_long_long") == 0);
+    assert(test("!") == -1);
+    return 0;
+}
@@ -0,0 +1,294 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i --fast-path
+#include <assert.h>
+#include <string.h>
+
+#define YYMAXFILL 2
+
+#define SIZE 64
+
+typedef struct {
+    char buf[SIZE + YYMAXFILL];
+    const char *lim, *cur, *mar, *tok;
+    const char *src; // remaining input
+    size_t len;
+    int eof;
+} Input;
+
+// Refill the buffer from the input string, at most SIZE characters at a time, and pad the end of
+// input with YYMAXFILL zeroes.
+static int fill(Input *in, size_t need)
+{
+    if (in->eof) return 1;
+    const size_t used = (size_t)(in->tok - in->buf);
+    if (used + (size_t)(in->buf + SIZE - in->lim) < need) return 2;
+    memmove(in->buf, in->tok, (size_t)(in->lim - in->tok));
+    in->lim -= used;
+    in->cur -= used;
+    in->mar -= used;
+    in->tok -= used;
+    // read in small chunks to test the slow path
+    size_t n = (size_t)(in->buf + SIZE - in->lim);
+    if (n > need + 4) n = need + 4;
+    if (n > in->len) n = in->len;
+    memcpy((char*)in->lim, in->src, n);
+    in->lim += n;
+    in->src += n;
+    in->len -= n;
+    if (in->len == 0) {
+        memset((char*)in->lim, 0, YYMAXFILL);
+        in->lim += YYMAXFILL;
+        in->eof = 1;
+    }
+    return 0;
+}
+
+static int lex(Input *in)
+{
+    in->tok = in->cur;
+    
+{
+	char yych;
+	if ((in->lim - in->cur) < 2) if (fill(in, 2) != 0) return -1;
+	yych = *in->cur;
+	switch (yych) {
+		case 0x00: goto yy1;
+		case ' ': goto yy4;
+		case '"': goto yy7;
+		case '/': goto yy8;
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy9;
+		default: goto yy2;
+	}
+yy1:
+	++in->cur;
+	{ return 0; }
+yy2:
+	++in->cur;
+yy3:
+	{ return -2; }
+yy4:
+	if ((in->lim - in->cur) < 4) goto yy5;
+	yych = *++in->cur;
+	switch (yych) {
+		case ' ': goto yy4;
+		default: goto yy6;
+	}
+yy5:
+	++in->cur;
+	if (in->lim <= in->cur) if (fill(in, 1) != 0) return -1;
+	yych = *in->cur;
+	switch (yych) {
+		case ' ': goto yy4;
+		default: goto yy6;
+	}
+yy6:
+	{ return 4; }
+yy7:
+	yych = *(in->mar = ++in->cur);
+	switch (yych) {
+		case '\n': goto yy3;
+		default: goto yy13;
+	}
+yy8:
+	yych = *++in->cur;
+	switch (yych) {
+		case '*': goto yy20;
+		default: goto yy3;
+	}
+yy9:
+	if ((in->lim - in->cur) < 4) goto yy10;
+	yych = *++in->cur;
+	switch (yych) {
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy9;
+		default: goto yy11;
+	}
+yy10:
+	++in->cur;
+	if (in->lim <= in->cur) if (fill(in, 1) != 0) return -1;
+	yych = *in->cur;
+	switch (yych) {
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy9;
+		default: goto yy11;
+	}
+yy11:
+	{ return 3; }
+yy12:
+	yych = *++in->cur;
+yy13:
+	if ((in->lim - in->cur) < 5) goto yy16;
+	switch (yych) {
+		case '\n': goto yy17;
+		case '"': goto yy18;
+		case '\\': goto yy14;
+		default: goto yy12;
+	}
+yy14:
+	yych = *++in->cur;
+	switch (yych) {
+		case '\n': goto yy17;
+		default: goto yy12;
+	}
+yy15:
+	++in->cur;
+	if (in->lim <= in->cur) if (fill(in, 1) != 0) return -1;
+	yych = *in->cur;
+	goto yy13;
+yy16:
+	switch (yych) {
+		case '\n': goto yy17;
+		case '"': goto yy18;
+		case '\\': goto yy19;
+		default: goto yy15;
+	}
+yy17:
+	in->cur = in->mar;
+	goto yy3;
+yy18:
+	++in->cur;
+	{ return 2; }
+yy19:
+	++in->cur;
+	if (in->lim <= in->cur) if (fill(in, 1) != 0) return -1;
+	yych = *in->cur;
+	switch (yych) {
+		case '\n': goto yy17;
+		default: goto yy15;
+	}
+yy20:
+	if ((in->lim - in->cur) < 6) goto yy22;
+	yych = *++in->cur;
+	switch (yych) {
+		case '*': goto yy21;
+		default: goto yy20;
+	}
+yy21:
+	if ((in->lim - in->cur) < 6) goto yy23;
+	yych = *++in->cur;
+	switch (yych) {
+		case '*': goto yy21;
+		case '/': goto yy24;
+		default: goto yy20;
+	}
+yy22:
+	++in->cur;
+	if (in->lim <= in->cur) if (fill(in, 1) != 0) return -1;
+	yych = *in->cur;
+	switch (yych) {
+		case '*': goto yy21;
+		default: goto yy20;
+	}
+yy23:
+	++in->cur;
+	if (in->lim <= in->cur) if (fill(in, 1) != 0) return -1;
+	yych = *in->cur;
+	switch (yych) {
+		case '*': goto yy21;
+		case '/': goto yy24;
+		default: goto yy20;
+	}
+yy24:
+	++in->cur;
+	{ return 1; }
+}
+
+}
+
+static int test(const char *s, const int *expect)
+{
+    Input in;
+    in.src = s;
+    in.len = strlen(s);
+    in.lim = in.cur = in.mar = in.tok = in.buf + SIZE;
+    in.eof = 0;
+    for (;;) {
+        const int t = lex(&in);
+        if (t != *expect++) return 0;
+        if (t <= 0) return 1;
+    }
+}
+
+int main()
+{
+    const int t1[] = {3, 4, 1, 4, 2, 4, 3, 0};
+    assert(test("ab /* a * comment ** with stars **/ \"a string with \\\"escapes\\\"\" xyz", t1));
+    const int t2[] = {1, 0};
+    assert(test("/*****/", t2));
+    const int t3[] = {2, 4, -1};
+    assert(test("\"\" /* unterminated", t3));
+    return 0;
+}
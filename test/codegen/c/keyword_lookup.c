@@ -0,0 +1,214 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i
+#include <assert.h>
+#include <string.h>
+
+enum { ERR, END, SP, ID, NUM, KW_IF, KW_INT, KW_DO, KW_WHILE, KW_RETURN, KW_I };
+
+static int lex(const char *str, int *toks) {
+    const char *YYCURSOR = str, *tok;
+    int n = 0;
+loop:
+    tok = YYCURSOR;
+    
+{
+	char yych;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case 0x00: goto yy1;
+		case ' ': goto yy3;
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy5;
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy7;
+		default: goto yy2;
+	}
+yy1:
+	++YYCURSOR;
+	{ toks[n++] = END; return n; }
+yy2:
+	++YYCURSOR;
+	{ toks[n++] = ERR; return n; }
+yy3:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case ' ': goto yy3;
+		default: goto yy4;
+	}
+yy4:
+	{ goto loop; }
+yy5:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy5;
+		default: goto yy6;
+	}
+yy6:
+	{ toks[n++] = NUM; goto loop; }
+yy7:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy7;
+		default: goto yy8;
+	}
+yy8:
+	{
+		int yykw = -1;
+		switch (YYCURSOR - tok) {
+			case 1:
+				switch ((unsigned char)tok[0]) {
+					case 'i':
+						yykw = 5;
+						break;
+				}
+				break;
+			case 2:
+				switch ((unsigned char)tok[0]) {
+					case 'd':
+						if (memcmp(tok + 1, "o", 1) == 0) {
+							yykw = 2;
+						}
+						break;
+					case 'i':
+						if (memcmp(tok + 1, "f", 1) == 0) {
+							yykw = 0;
+						}
+						break;
+				}
+				break;
+			case 3:
+				switch ((unsigned char)tok[0]) {
+					case 'i':
+						if (memcmp(tok + 1, "nt", 2) == 0) {
+							yykw = 1;
+						}
+						break;
+				}
+				break;
+			case 4:
+				switch ((unsigned char)tok[0]) {
+					case 'e':
+						if (memcmp(tok + 1, "lse", 3) == 0) {
+							yykw = 6;
+						}
+						break;
+				}
+				break;
+			case 5:
+				switch ((unsigned char)tok[0]) {
+					case 'w':
+						if (memcmp(tok + 1, "hile", 4) == 0) {
+							yykw = 3;
+						}
+						break;
+				}
+				break;
+			case 6:
+				switch ((unsigned char)tok[0]) {
+					case 'r':
+						if (memcmp(tok + 1, "eturn", 5) == 0) {
+							yykw = 4;
+						}
+						break;
+				}
+				break;
+		}
+		if (yykw == 0) { toks[n++] = KW_IF;     goto loop; }
+		else if (yykw == 1) { toks[n++] = KW_INT;    goto loop; }
+		else if (yykw == 2) { toks[n++] = KW_DO;     goto loop; }
+		else if (yykw == 3) { toks[n++] = KW_WHILE;  goto loop; }
+		else if (yykw == 4) { toks[n++] = KW_RETURN; goto loop; }
+		else if (yykw == 5) { toks[n++] = KW_I;      goto loop; }
+		else if (yykw == 6) { toks[n++] = ID;        goto loop; }
+		else { toks[n++] = ID;  goto loop; }
+	}
+}
+
+}
+
+int main() {
+    int toks[16];
+    const int expect[] = {KW_IF, KW_INT, ID, KW_DO, KW_WHILE, ID, KW_RETURN, KW_I, ID, NUM, ID, END};
+    int n = lex("if int in do while whiles return i x 42 else", toks);
+    assert(n == sizeof(expect) / sizeof(expect[0]));
+    for (int i = 0; i < n; ++i) assert(toks[i] == expect[i]);
+    return 0;
+}
@@ -0,0 +1,151 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i
+#include <assert.h>
+#include <string.h>
+
+enum { ERR, END, ID, KW_IF, KW_DO };
+
+// The second "if" rule is shadowed by the first one. It should not be used as a keyword of the
+// identifier rule and should be reported as unreachable.
+static int lex(const char *str) {
+    const char *YYCURSOR = str, *tok = str;
+    
+{
+	char yych;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case 0x00: goto yy1;
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy3;
+		case 'i': goto yy6;
+		default: goto yy2;
+	}
+yy1:
+	++YYCURSOR;
+	{ return END; }
+yy2:
+	++YYCURSOR;
+	{ return ERR; }
+yy3:
+	yych = *++YYCURSOR;
+yy4:
+	switch (yych) {
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy3;
+		default: goto yy5;
+	}
+yy5:
+	{
+		int yykw = -1;
+		switch (YYCURSOR - tok) {
+			case 2:
+				switch ((unsigned char)tok[0]) {
+					case 'd':
+						if (memcmp(tok + 1, "o", 1) == 0) {
+							yykw = 0;
+						}
+						break;
+				}
+				break;
+		}
+		if (yykw == 0) { return KW_DO; }
+		else { return ID; }
+	}
+yy6:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'f': goto yy7;
+		default: goto yy4;
+	}
+yy7:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy3;
+		default: goto yy8;
+	}
+yy8:
+	{ return KW_IF; }
+}
+
+}
+
+int main() {
+    assert(lex("if") == KW_IF);
+    assert(lex("do") == KW_DO);
+    assert(lex("ifx") == ID);
+    assert(lex("") == END);
+    return 0;
+}
+codegen/c/keyword_lookup_shadowed.re:18:25: warning: unreachable rule (shadowed by rule at line 16) [-Wunreachable-rules]
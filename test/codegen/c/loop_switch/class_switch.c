@@ -0,0 +1,1096 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i --loop-switch --class-switch
+#include <assert.h>
+#include <string.h>
+
+
+
+static int lex1(const char **end, const char *YYLIMIT)
+{
+    const char *YYMARKER;
+    
+{
+	char yych;
+	unsigned int yyaccept = 0;
+	unsigned int yystate = 0;
+	static const unsigned char yycc[256] = {
+		 0,  1,  1,  1,  1,  1,  1,  1,
+		 1,  2,  2,  3,  3,  3,  3,  3,
+		 3,  3,  3,  3,  3,  3,  3,  3,
+		 3,  3,  3,  3,  3,  3,  3,  3,
+		 4,  5,  6,  7,  7,  7,  7,  7,
+		 7,  7,  7,  7,  7,  7,  7,  7,
+		 8,  9,  9,  9,  9,  9,  9,  9,
+		 9,  9, 10, 10, 10, 10, 10, 10,
+		10, 11, 11, 11, 11, 11, 11, 12,
+		12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 13, 14, 14, 15,
+		16, 17, 17, 17, 17, 17, 18, 19,
+		19, 20, 21, 21, 21, 21, 22, 23,
+		24, 24, 25, 26, 27, 28, 28, 28,
+		29, 30, 30, 31, 31, 31, 31, 31,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32
+	};
+	for (;;) {
+		switch (yystate) {
+			case 0:
+				yych = **end;
+				switch (yycc[(unsigned char)yych]) {
+					case 0:
+					case 1:
+					case 3:
+					case 5:
+					case 7:
+					case 10:
+					case 11:
+					case 12:
+					case 13:
+					case 14:
+					case 16:
+					case 31:
+						if (YYLIMIT <= *end) {
+							yystate = 28;
+							continue;
+						}
+						++*end;
+						yystate = 1;
+						continue;
+					case 2:
+					case 4:
+						++*end;
+						yystate = 3;
+						continue;
+					case 6:
+						++*end;
+						yystate = 5;
+						continue;
+					case 8:
+						++*end;
+						yystate = 6;
+						continue;
+					case 9:
+						++*end;
+						yystate = 8;
+						continue;
+					case 15:
+					case 17:
+					case 19:
+					case 21:
+					case 22:
+					case 23:
+					case 24:
+					case 25:
+					case 26:
+					case 27:
+					case 28:
+					case 29:
+					case 30:
+						++*end;
+						yystate = 10;
+						continue;
+					case 18:
+						++*end;
+						yystate = 13;
+						continue;
+					case 20:
+						++*end;
+						yystate = 14;
+						continue;
+					default:
+						++*end;
+						yystate = 15;
+						continue;
+				}
+			case 1:
+				yystate = 2;
+				continue;
+			case 2: { return -1; }
+			case 3:
+				yych = **end;
+				switch (yycc[(unsigned char)yych]) {
+					case 2:
+					case 4:
+						++*end;
+						yystate = 3;
+						continue;
+					default:
+						yystate = 4;
+						continue;
+				}
+			case 4: { return 4; }
+			case 5:
+				yyaccept = 0;
+				YYMARKER = *end;
+				yych = **end;
+				if (yych <= 0x00) {
+					yystate = 2;
+					continue;
+				}
+				yystate = 18;
+				continue;
+			case 6:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				switch (yycc[(unsigned char)yych]) {
+					case 0:
+						yystate = 7;
+						continue;
+					case 29:
+						++*end;
+						yystate = 22;
+						continue;
+					default:
+						yystate = 9;
+						continue;
+				}
+			case 7: { return 3; }
+			case 8:
+				yych = **end;
+				yystate = 9;
+				continue;
+			case 9:
+				switch (yycc[(unsigned char)yych]) {
+					case 8:
+					case 9:
+						++*end;
+						yystate = 8;
+						continue;
+					default:
+						yystate = 7;
+						continue;
+				}
+			case 10:
+				yych = **end;
+				yystate = 11;
+				continue;
+			case 11:
+				switch (yycc[(unsigned char)yych]) {
+					case 8:
+					case 9:
+					case 15:
+					case 17:
+					case 18:
+					case 19:
+					case 20:
+					case 21:
+					case 22:
+					case 23:
+					case 24:
+					case 25:
+					case 26:
+					case 27:
+					case 28:
+					case 29:
+					case 30:
+						++*end;
+						yystate = 10;
+						continue;
+					default:
+						yystate = 12;
+						continue;
+				}
+			case 12: { return 2; }
+			case 13:
+				yych = **end;
+				switch (yycc[(unsigned char)yych]) {
+					case 0:
+						yystate = 12;
+						continue;
+					case 23:
+						++*end;
+						yystate = 23;
+						continue;
+					default:
+						yystate = 11;
+						continue;
+				}
+			case 14:
+				yych = **end;
+				switch (yycc[(unsigned char)yych]) {
+					case 0:
+						yystate = 12;
+						continue;
+					case 18:
+						++*end;
+						yystate = 24;
+						continue;
+					case 22:
+						++*end;
+						yystate = 26;
+						continue;
+					default:
+						yystate = 11;
+						continue;
+				}
+			case 15:
+				yych = **end;
+				switch (yycc[(unsigned char)yych]) {
+					case 0:
+					case 1:
+					case 2:
+					case 3:
+					case 4:
+					case 5:
+					case 6:
+					case 7:
+					case 8:
+					case 9:
+					case 10:
+					case 11:
+					case 12:
+					case 13:
+					case 14:
+					case 15:
+					case 16:
+					case 17:
+					case 18:
+					case 19:
+					case 20:
+					case 21:
+					case 22:
+					case 23:
+					case 24:
+					case 25:
+					case 26:
+					case 27:
+					case 28:
+					case 29:
+					case 30:
+					case 31:
+						yystate = 16;
+						continue;
+					default:
+						++*end;
+						yystate = 15;
+						continue;
+				}
+			case 16: { return 6; }
+			case 17:
+				yych = **end;
+				yystate = 18;
+				continue;
+			case 18:
+				switch (yycc[(unsigned char)yych]) {
+					case 0:
+						yystate = 19;
+						continue;
+					case 6:
+						++*end;
+						yystate = 20;
+						continue;
+					case 13:
+						++*end;
+						yystate = 21;
+						continue;
+					default:
+						++*end;
+						yystate = 17;
+						continue;
+				}
+			case 19:
+				*end = YYMARKER;
+				if (yyaccept == 0) {
+					yystate = 2;
+					continue;
+				} else {
+					yystate = 7;
+					continue;
+				}
+			case 20: { return 5; }
+			case 21:
+				yych = **end;
+				if (yych <= 0x00) {
+					yystate = 19;
+					continue;
+				}
+				++*end;
+				yystate = 17;
+				continue;
+			case 22:
+				yych = **end;
+				switch (yycc[(unsigned char)yych]) {
+					case 8:
+					case 9:
+					case 11:
+					case 17:
+					case 18:
+						++*end;
+						yystate = 27;
+						continue;
+					default:
+						yystate = 19;
+						continue;
+				}
+			case 23:
+				yych = **end;
+				switch (yycc[(unsigned char)yych]) {
+					case 0:
+						yystate = 12;
+						continue;
+					case 25:
+						++*end;
+						yystate = 24;
+						continue;
+					default:
+						yystate = 11;
+						continue;
+				}
+			case 24:
+				yych = **end;
+				switch (yycc[(unsigned char)yych]) {
+					case 8:
+					case 9:
+					case 15:
+					case 17:
+					case 18:
+					case 19:
+					case 20:
+					case 21:
+					case 22:
+					case 23:
+					case 24:
+					case 25:
+					case 26:
+					case 27:
+					case 28:
+					case 29:
+					case 30:
+						++*end;
+						yystate = 10;
+						continue;
+					default:
+						yystate = 25;
+						continue;
+				}
+			case 25: { return 1; }
+			case 26:
+				yych = **end;
+				switch (yycc[(unsigned char)yych]) {
+					case 0:
+						yystate = 12;
+						continue;
+					case 27:
+						++*end;
+						yystate = 24;
+						continue;
+					default:
+						yystate = 11;
+						continue;
+				}
+			case 27:
+				yych = **end;
+				switch (yycc[(unsigned char)yych]) {
+					case 8:
+					case 9:
+					case 11:
+					case 17:
+					case 18:
+						++*end;
+						yystate = 27;
+						continue;
+					default:
+						yystate = 7;
+						continue;
+				}
+			case 28: { return 0; }
+		}
+	}
+}
+
+}
+
+static int lex2(const char **end, const char *YYLIMIT)
+{
+    const char *YYMARKER;
+    
+{
+	char yych;
+	unsigned int yyaccept = 0;
+	unsigned int yystate = 0;
+	for (;;) {
+		switch (yystate) {
+			case 0:
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+					case 0x01:
+					case 0x02:
+					case 0x03:
+					case 0x04:
+					case 0x05:
+					case 0x06:
+					case 0x07:
+					case 0x08:
+					case '\v':
+					case '\f':
+					case '\r':
+					case 0x0E:
+					case 0x0F:
+					case 0x10:
+					case 0x11:
+					case 0x12:
+					case 0x13:
+					case 0x14:
+					case 0x15:
+					case 0x16:
+					case 0x17:
+					case 0x18:
+					case 0x19:
+					case 0x1A:
+					case 0x1B:
+					case 0x1C:
+					case 0x1D:
+					case 0x1E:
+					case 0x1F:
+					case '!':
+					case '#':
+					case '$':
+					case '%':
+					case '&':
+					case '\'':
+					case '(':
+					case ')':
+					case '*':
+					case '+':
+					case ',':
+					case '-':
+					case '.':
+					case '/':
+					case ':':
+					case ';':
+					case '<':
+					case '=':
+					case '>':
+					case '?':
+					case '@':
+					case 'A':
+					case 'B':
+					case 'C':
+					case 'D':
+					case 'E':
+					case 'F':
+					case 'G':
+					case 'H':
+					case 'I':
+					case 'J':
+					case 'K':
+					case 'L':
+					case 'M':
+					case 'N':
+					case 'O':
+					case 'P':
+					case 'Q':
+					case 'R':
+					case 'S':
+					case 'T':
+					case 'U':
+					case 'V':
+					case 'W':
+					case 'X':
+					case 'Y':
+					case 'Z':
+					case '[':
+					case '\\':
+					case ']':
+					case '^':
+					case '`':
+					case '{':
+					case '|':
+					case '}':
+					case '~':
+					case 0x7F:
+						if (YYLIMIT <= *end) {
+							yystate = 28;
+							continue;
+						}
+						++*end;
+						yystate = 1;
+						continue;
+					case '\t':
+					case '\n':
+					case ' ':
+						++*end;
+						yystate = 3;
+						continue;
+					case '"':
+						++*end;
+						yystate = 5;
+						continue;
+					case '0':
+						++*end;
+						yystate = 6;
+						continue;
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+						++*end;
+						yystate = 8;
+						continue;
+					case '_':
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'g':
+					case 'h':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'n':
+					case 'o':
+					case 'p':
+					case 'q':
+					case 'r':
+					case 's':
+					case 't':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+						++*end;
+						yystate = 10;
+						continue;
+					case 'f':
+						++*end;
+						yystate = 13;
+						continue;
+					case 'i':
+						++*end;
+						yystate = 14;
+						continue;
+					default:
+						++*end;
+						yystate = 15;
+						continue;
+				}
+			case 1:
+				yystate = 2;
+				continue;
+			case 2: { return -1; }
+			case 3:
+				yych = **end;
+				switch (yych) {
+					case '\t':
+					case '\n':
+					case ' ':
+						++*end;
+						yystate = 3;
+						continue;
+					default:
+						yystate = 4;
+						continue;
+				}
+			case 4: { return 4; }
+			case 5:
+				yyaccept = 0;
+				YYMARKER = *end;
+				yych = **end;
+				if (yych <= 0x00) {
+					yystate = 2;
+					continue;
+				}
+				yystate = 18;
+				continue;
+			case 6:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+						yystate = 7;
+						continue;
+					case 'x':
+						++*end;
+						yystate = 22;
+						continue;
+					default:
+						yystate = 9;
+						continue;
+				}
+			case 7: { return 3; }
+			case 8:
+				yych = **end;
+				yystate = 9;
+				continue;
+			case 9:
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+						++*end;
+						yystate = 8;
+						continue;
+					default:
+						yystate = 7;
+						continue;
+				}
+			case 10:
+				yych = **end;
+				yystate = 11;
+				continue;
+			case 11:
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+					case '_':
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+					case 'g':
+					case 'h':
+					case 'i':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'n':
+					case 'o':
+					case 'p':
+					case 'q':
+					case 'r':
+					case 's':
+					case 't':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+						++*end;
+						yystate = 10;
+						continue;
+					default:
+						yystate = 12;
+						continue;
+				}
+			case 12: { return 2; }
+			case 13:
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+						yystate = 12;
+						continue;
+					case 'o':
+						++*end;
+						yystate = 23;
+						continue;
+					default:
+						yystate = 11;
+						continue;
+				}
+			case 14:
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+						yystate = 12;
+						continue;
+					case 'f':
+						++*end;
+						yystate = 24;
+						continue;
+					case 'n':
+						++*end;
+						yystate = 26;
+						continue;
+					default:
+						yystate = 11;
+						continue;
+				}
+			case 15:
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+					case 0x01:
+					case 0x02:
+					case 0x03:
+					case 0x04:
+					case 0x05:
+					case 0x06:
+					case 0x07:
+					case 0x08:
+					case '\t':
+					case '\n':
+					case '\v':
+					case '\f':
+					case '\r':
+					case 0x0E:
+					case 0x0F:
+					case 0x10:
+					case 0x11:
+					case 0x12:
+					case 0x13:
+					case 0x14:
+					case 0x15:
+					case 0x16:
+					case 0x17:
+					case 0x18:
+					case 0x19:
+					case 0x1A:
+					case 0x1B:
+					case 0x1C:
+					case 0x1D:
+					case 0x1E:
+					case 0x1F:
+					case ' ':
+					case '!':
+					case '"':
+					case '#':
+					case '$':
+					case '%':
+					case '&':
+					case '\'':
+					case '(':
+					case ')':
+					case '*':
+					case '+':
+					case ',':
+					case '-':
+					case '.':
+					case '/':
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+					case ':':
+					case ';':
+					case '<':
+					case '=':
+					case '>':
+					case '?':
+					case '@':
+					case 'A':
+					case 'B':
+					case 'C':
+					case 'D':
+					case 'E':
+					case 'F':
+					case 'G':
+					case 'H':
+					case 'I':
+					case 'J':
+					case 'K':
+					case 'L':
+					case 'M':
+					case 'N':
+					case 'O':
+					case 'P':
+					case 'Q':
+					case 'R':
+					case 'S':
+					case 'T':
+					case 'U':
+					case 'V':
+					case 'W':
+					case 'X':
+					case 'Y':
+					case 'Z':
+					case '[':
+					case '\\':
+					case ']':
+					case '^':
+					case '_':
+					case '`':
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+					case 'g':
+					case 'h':
+					case 'i':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'n':
+					case 'o':
+					case 'p':
+					case 'q':
+					case 'r':
+					case 's':
+					case 't':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+					case '{':
+					case '|':
+					case '}':
+					case '~':
+					case 0x7F:
+						yystate = 16;
+						continue;
+					default:
+						++*end;
+						yystate = 15;
+						continue;
+				}
+			case 16: { return 6; }
+			case 17:
+				yych = **end;
+				yystate = 18;
+				continue;
+			case 18:
+				switch (yych) {
+					case 0x00:
+						yystate = 19;
+						continue;
+					case '"':
+						++*end;
+						yystate = 20;
+						continue;
+					case '\\':
+						++*end;
+						yystate = 21;
+						continue;
+					default:
+						++*end;
+						yystate = 17;
+						continue;
+				}
+			case 19:
+				*end = YYMARKER;
+				if (yyaccept == 0) {
+					yystate = 2;
+					continue;
+				} else {
+					yystate = 7;
+					continue;
+				}
+			case 20: { return 5; }
+			case 21:
+				yych = **end;
+				if (yych <= 0x00) {
+					yystate = 19;
+					continue;
+				}
+				++*end;
+				yystate = 17;
+				continue;
+			case 22:
+				yych = **end;
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+					case 'A':
+					case 'B':
+					case 'C':
+					case 'D':
+					case 'E':
+					case 'F':
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+						++*end;
+						yystate = 27;
+						continue;
+					default:
+						yystate = 19;
+						continue;
+				}
+			case 23:
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+						yystate = 12;
+						continue;
+					case 'r':
+						++*end;
+						yystate = 24;
+						continue;
+					default:
+						yystate = 11;
+						continue;
+				}
+			case 24:
+				yych = **end;
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+					case '_':
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+					case 'g':
+					case 'h':
+					case 'i':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'n':
+					case 'o':
+					case 'p':
+					case 'q':
+					case 'r':
+					case 's':
+					case 't':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+						++*end;
+						yystate = 10;
+						continue;
+					default:
+						yystate = 25;
+						continue;
+				}
+			case 25: { return 1; }
+			case 26:
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+						yystate = 12;
+						continue;
+					case 't':
+						++*end;
+						yystate = 24;
+						continue;
+					default:
+						yystate = 11;
+						continue;
+				}
+			case 27:
+				yych = **end;
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+					case 'A':
+					case 'B':
+					case 'C':
+					case 'D':
+					case 'E':
+					case 'F':
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+						++*end;
+						yystate = 27;
+						continue;
+					default:
+						yystate = 7;
+						continue;
+				}
+			case 28: { return 0; }
+		}
+	}
+}
+
+}
+
+static int test(const char *s)
+{
+    const char *e1 = s, *e2 = s, *lim = s + strlen(s);
+    const int i = lex1(&e1, lim);
+    assert(i == lex2(&e2, lim));
+    assert(e1 == e2);
+    return i;
+}
+
+int main()
+{
+    assert(test("") == 0);
+    assert(test("if") == 1);
+    assert(test("int") == 1);
+    assert(test("integer") == 2);
+    assert(test("for_each") == 2);
+    assert(test("0x1F") == 3);
+    assert(test("0x") == 3);
+    assert(test("42") == 3);
+    assert(test("  \n\t") == 4);
+    assert(test("\"a\\\"b\"") == 5);
+    assert(test("\"abc") == -1);
+    assert(test("$") == -1);
+    assert(test("\xc3\xa9") == 6);
+    return 0;
+}
@@ -0,0 +1,430 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i --profile-gen
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define YYMAXFILL 6
+
+static unsigned long long yyprof[61];
+static const char *const yyprofkeys[61] = {
+	"line16 fill",
+	"line16 backtrack",
+	"line16 rule 0",
+	"line16 rule 1",
+	"line16 rule 2",
+	"line16 rule 3",
+	"line16 rule 4",
+	"line16 state 0",
+	"line16 trans 0 1",
+	"line16 trans 0 3",
+	"line16 trans 0 5",
+	"line16 trans 0 8",
+	"line16 trans 0 11",
+	"line16 trans 0 12",
+	"line16 state 1",
+	"line16 trans 1 2",
+	"line16 state 2",
+	"line16 state 3",
+	"line16 trans 3 4",
+	"line16 state 4",
+	"line16 state 5",
+	"line16 trans 5 6",
+	"line16 state 6",
+	"line16 trans 6 7",
+	"line16 trans 6 13",
+	"line16 trans 6 5",
+	"line16 state 7",
+	"line16 state 8",
+	"line16 trans 8 9",
+	"line16 state 9",
+	"line16 trans 9 10",
+	"line16 trans 9 8",
+	"line16 state 10",
+	"line16 state 11",
+	"line16 trans 11 9",
+	"line16 trans 11 15",
+	"line16 state 12",
+	"line16 trans 12 9",
+	"line16 trans 12 17",
+	"line16 state 13",
+	"line16 trans 13 14",
+	"line16 trans 13 18",
+	"line16 state 14",
+	"line16 state 15",
+	"line16 trans 15 16",
+	"line16 trans 15 8",
+	"line16 state 16",
+	"line16 state 17",
+	"line16 trans 17 9",
+	"line16 trans 17 20",
+	"line16 state 18",
+	"line16 trans 18 19",
+	"line16 state 19",
+	"line16 trans 19 7",
+	"line16 trans 19 18",
+	"line16 state 20",
+	"line16 trans 20 9",
+	"line16 trans 20 21",
+	"line16 state 21",
+	"line16 trans 21 9",
+	"line16 trans 21 15"
+};
+static void yyprofdump(FILE* yyf) {
+	unsigned int yyi;
+	for (yyi = 0; yyi < 61; ++yyi) {
+		if (yyprof[yyi] != 0) fprintf(yyf, "%s %llu\n", yyprofkeys[yyi], yyprof[yyi]);
+	}
+}
+
+
+// YYFILL does nothing: the input is padded with YYMAXFILL zeroes, and YYLIMIT points at the padding
+// so that YYFILL is called near the end of input.
+#define YYFILL(n) do {} while (0)
+
+static int lex(const char *YYCURSOR, const char *YYLIMIT)
+{
+    const char *YYMARKER;
+    
+{
+	char yych;
+	++yyprof[7];
+	if ((YYLIMIT - YYCURSOR) < 6) {
+		++yyprof[0];
+		YYFILL(6);
+	}
+	yych = *YYCURSOR;
+	switch (yych) {
+		case 0x00:
+			++yyprof[8];
+			goto yy1;
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			++yyprof[10];
+			goto yy3;
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'x':
+		case 'y':
+		case 'z':
+			++yyprof[11];
+			goto yy5;
+		case 'i':
+			++yyprof[12];
+			goto yy8;
+		case 'w':
+			++yyprof[13];
+			goto yy9;
+		default:
+			++yyprof[9];
+			goto yy2;
+	}
+yy1:
+	++yyprof[14];
+	++YYCURSOR;
+	++yyprof[15];
+	++yyprof[16];
+	++yyprof[2];
+	{ return 0; }
+yy2:
+	++yyprof[17];
+	++YYCURSOR;
+	++yyprof[18];
+	++yyprof[19];
+	++yyprof[6];
+	{ return -1; }
+yy3:
+	++yyprof[20];
+	YYMARKER = ++YYCURSOR;
+	if ((YYLIMIT - YYCURSOR) < 2) {
+		++yyprof[0];
+		YYFILL(2);
+	}
+	yych = *YYCURSOR;
+	++yyprof[21];
+	++yyprof[22];
+	switch (yych) {
+		case '.':
+			++yyprof[24];
+			goto yy10;
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			++yyprof[25];
+			goto yy3;
+		default:
+			++yyprof[23];
+			goto yy4;
+	}
+yy4:
+	++yyprof[26];
+	++yyprof[5];
+	{ return 3; }
+yy5:
+	++yyprof[27];
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) {
+		++yyprof[0];
+		YYFILL(1);
+	}
+	yych = *YYCURSOR;
+	++yyprof[28];
+yy6:
+	++yyprof[29];
+	switch (yych) {
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+			++yyprof[31];
+			goto yy5;
+		default:
+			++yyprof[30];
+			goto yy7;
+	}
+yy7:
+	++yyprof[32];
+	++yyprof[4];
+	{ return 2; }
+yy8:
+	++yyprof[33];
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'f':
+			++yyprof[35];
+			goto yy12;
+		default:
+			++yyprof[34];
+			goto yy6;
+	}
+yy9:
+	++yyprof[36];
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'h':
+			++yyprof[38];
+			goto yy14;
+		default:
+			++yyprof[37];
+			goto yy6;
+	}
+yy10:
+	++yyprof[39];
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			++yyprof[41];
+			goto yy15;
+		default:
+			++yyprof[40];
+			goto yy11;
+	}
+yy11:
+	++yyprof[42];
+	YYCURSOR = YYMARKER;
+	++yyprof[1];
+	goto yy4;
+yy12:
+	++yyprof[43];
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+			++yyprof[45];
+			goto yy5;
+		default:
+			++yyprof[44];
+			goto yy13;
+	}
+yy13:
+	++yyprof[46];
+	++yyprof[3];
+	{ return 1; }
+yy14:
+	++yyprof[47];
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'i':
+			++yyprof[49];
+			goto yy16;
+		default:
+			++yyprof[48];
+			goto yy6;
+	}
+yy15:
+	++yyprof[50];
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) {
+		++yyprof[0];
+		YYFILL(1);
+	}
+	yych = *YYCURSOR;
+	++yyprof[51];
+	++yyprof[52];
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			++yyprof[54];
+			goto yy15;
+		default:
+			++yyprof[53];
+			goto yy4;
+	}
+yy16:
+	++yyprof[55];
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'l':
+			++yyprof[57];
+			goto yy17;
+		default:
+			++yyprof[56];
+			goto yy6;
+	}
+yy17:
+	++yyprof[58];
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'e':
+			++yyprof[60];
+			goto yy12;
+		default:
+			++yyprof[59];
+			goto yy6;
+	}
+}
+
+}
+
+static int test(const char *s)
+{
+    char buf[32] = {0};
+    const size_t len = strlen(s);
+    memcpy(buf, s, len);
+    return lex(buf, buf + len);
+}
+
+int main()
+{
+    char buf[4096];
+    size_t n;
+    FILE *f = tmpfile();
+
+    assert(test("if") == 1);
+    assert(test("iffy") == 2);
+    assert(test("while") == 1);
+    assert(test("12.5") == 3);
+    assert(test("12.") == 3);
+    assert(test("?") == -1);
+
+    yyprofdump(f);
+    rewind(f);
+    n = fread(buf, 1, sizeof(buf) - 1, f);
+    buf[n] = 0;
+    fclose(f);
+
+    assert(strstr(buf, "line16 state 0 6\n"));
+    assert(strstr(buf, "line16 rule 1 2\n"));
+    assert(strstr(buf, "line16 rule 2 1\n"));
+    assert(strstr(buf, "line16 rule 3 2\n"));
+    assert(strstr(buf, "line16 backtrack 1\n"));
+    assert(strstr(buf, "line16 fill "));
+    return 0;
+}
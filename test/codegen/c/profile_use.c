@@ -0,0 +1,190 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i --profile-use codegen/c/profile_use.re.inc
+#include <assert.h>
+#include <string.h>
+
+#define YYMAXFILL 6
+
+
+// The profile is collected with `--profile-gen` on a workload that consists mostly of long
+// identifiers, so the identifier loop becomes a fall-through path with weighted comparisons.
+#define YYFILL(n) do {} while (0)
+
+static int lex(const char *YYCURSOR, const char *YYLIMIT)
+{
+    const char *YYMARKER;
+    
+{
+	char yych;
+	if ((YYLIMIT - YYCURSOR) < 6) YYFILL(6);
+	yych = *YYCURSOR;
+	switch (yych) {
+		case 0x00: goto yy13;
+		case '\t':
+		case '\n':
+		case ' ': goto yy5;
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy7;
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'x':
+		case 'y':
+		case 'z': goto yy1;
+		case 'i': goto yy3;
+		case 'w': goto yy9;
+		default: goto yy11;
+	}
+yy1:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+yy2:
+	if (yych <= '`') {
+		if (yych <= '9') {
+			if (yych >= '0') goto yy1;
+		} else {
+			if (yych == '_') goto yy1;
+		}
+	} else {
+		if (yych <= 'z') goto yy1;
+	}
+	{ return 2; }
+yy3:
+	yych = *++YYCURSOR;
+	if (yych != 'f') goto yy2;
+yy4:
+	yych = *++YYCURSOR;
+	if (yych <= 'z') {
+		if (yych > '/') {
+			if (yych <= '^') {
+				if (__builtin_expect(yych <= '9', 0)) goto yy1;
+			} else {
+				if (__builtin_expect(yych != '`', 0)) goto yy1;
+			}
+		}
+	}
+	{ return 1; }
+yy5:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	if (yych <= ' ') {
+		if (yych <= 0x08) goto yy6;
+		if (__builtin_expect(yych <= '\n', 0)) goto yy5;
+		if (__builtin_expect(yych >= ' ', 0)) goto yy5;
+	}
+yy6:
+	{ return 4; }
+yy7:
+	YYMARKER = ++YYCURSOR;
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '.': goto yy12;
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy7;
+		default: goto yy8;
+	}
+yy8:
+	{ return 3; }
+yy9:
+	yych = *++YYCURSOR;
+	if (__builtin_expect(yych != 'h', 0)) goto yy2;
+	yych = *++YYCURSOR;
+	if (__builtin_expect(yych != 'i', 0)) goto yy2;
+	yych = *++YYCURSOR;
+	if (__builtin_expect(yych != 'l', 0)) goto yy2;
+	yych = *++YYCURSOR;
+	if (__builtin_expect(yych == 'e', 1)) goto yy4;
+	goto yy2;
+yy10:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9': goto yy10;
+		default: goto yy8;
+	}
+yy11:
+	++YYCURSOR;
+	{ return -1; }
+yy12:
+	yych = *++YYCURSOR;
+	if (__builtin_expect(yych <= '/', 0)) goto yy14;
+	if (__builtin_expect(yych <= '9', 1)) goto yy10;
+	goto yy14;
+yy13:
+	++YYCURSOR;
+	{ return 0; }
+yy14:
+	YYCURSOR = YYMARKER;
+	goto yy8;
+}
+
+}
+
+static int test(const char *s)
+{
+    char buf[64] = {0};
+    const size_t len = strlen(s);
+    memcpy(buf, s, len);
+    return lex(buf, buf + len);
+}
+
+int main()
+{
+    assert(test("if") == 1);
+    assert(test("iffy") == 2);
+    assert(test("while") == 1);
+    assert(test("a_very_long_identifier_42") == 2);
+    assert(test("12.5") == 3);
+    assert(test("12.") == 3);
+    assert(test(" \t\n") == 4);
+    assert(test("?") == -1);
+    return 0;
+}
@@ -0,0 +1,290 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT --recursive-functions -i --unroll-loops 4
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define YYMAXFILL 4
+
+
+struct State {
+    const char* cur;
+    const char* lim;
+    int count;
+};
+
+
+int yy0(State& st);
+int yy1(State& st);
+int yy2(State& st);
+int yy3(State& st);
+int yy4(State& st);
+int yy5(State& st);
+int yy6(State& st);
+int yy7(State& st);
+int yy8(State& st);
+int yy9(State& st);
+int yy10(State& st);
+int yy11(State& st);
+int yy12(State& st);
+int lex(State& st);
+
+int yy0(State& st) {
+	if (st.lim <= st.cur) return -1;
+	char yych = *st.cur++;
+	switch (yych) {
+		case 0x00: return yy1(st);
+		case ' ': return yy3(st);
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': return yy8(st);
+		default: return yy2(st);
+	}
+}
+
+int yy1(State& st) {
+	return st.cur + YYMAXFILL - 1 == st.lim ? st.count : -1;
+}
+
+int yy2(State& st) {
+	return -1;
+}
+
+int yy3(State& st) {
+	if ((st.lim - st.cur) < 4) return -1;
+	char yych = *st.cur;
+	switch (yych) {
+		case ' ':
+			++st.cur;
+			return yy4(st);
+		default: return yy7(st);
+	}
+}
+
+int yy4(State& st) {
+	char yych = *st.cur;
+	switch (yych) {
+		case ' ':
+			++st.cur;
+			return yy5(st);
+		default: return yy7(st);
+	}
+}
+
+int yy5(State& st) {
+	char yych = *st.cur;
+	switch (yych) {
+		case ' ':
+			++st.cur;
+			return yy6(st);
+		default: return yy7(st);
+	}
+}
+
+int yy6(State& st) {
+	char yych = *st.cur;
+	switch (yych) {
+		case ' ':
+			++st.cur;
+			return yy3(st);
+		default: return yy7(st);
+	}
+}
+
+int yy7(State& st) {
+	return lex(st);
+}
+
+int yy8(State& st) {
+	if ((st.lim - st.cur) < 4) return -1;
+	char yych = *st.cur;
+	switch (yych) {
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+			++st.cur;
+			return yy9(st);
+		default: return yy12(st);
+	}
+}
+
+int yy9(State& st) {
+	char yych = *st.cur;
+	switch (yych) {
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+			++st.cur;
+			return yy10(st);
+		default: return yy12(st);
+	}
+}
+
+int yy10(State& st) {
+	char yych = *st.cur;
+	switch (yych) {
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+			++st.cur;
+			return yy11(st);
+		default: return yy12(st);
+	}
+}
+
+int yy11(State& st) {
+	char yych = *st.cur;
+	switch (yych) {
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+			++st.cur;
+			return yy8(st);
+		default: return yy12(st);
+	}
+}
+
+int yy12(State& st) {
+	++st.count; return lex(st);
+}
+
+int lex(State& st) {
+	return yy0(st);
+}
+
+
+
+// make a copy of the string with YYMAXFILL zeroes at the end
+static void test(const char *str, unsigned int len, int res) {
+    char *s = (char*) malloc(len + YYMAXFILL);
+    memcpy(s, str, len);
+    memset(s + len, 0, YYMAXFILL);
+    State st{s, s + len + YYMAXFILL, 0};
+    int r = lex(st);
+    free(s);
+    assert(r == res);
+}
+
+#define TEST(s, r) test(s, sizeof(s) - 1, r)
+int main() {
+    TEST("", 0);
+    TEST("a", 1);
+    TEST("a bc def ghij klmno  pqrstu   vwxyzab", 7);
+    TEST("words and 42", -1);
+    return 0;
+}
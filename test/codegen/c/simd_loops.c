@@ -0,0 +1,629 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i --simd-loops
+#include <assert.h>
+#include <string.h>
+
+#define YYCTYPE char
+#define YYMAXFILL 2
+
+
+
+
+static int lex1(const char *YYCURSOR, const char *YYLIMIT, const char **end)
+{
+    const char *YYMARKER;
+    
+{
+	YYCTYPE yych;
+	if ((YYLIMIT - YYCURSOR) < 2) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy3;
+		case '"': goto yy5;
+		case '/': goto yy6;
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy7;
+		default: goto yy1;
+	}
+yy1:
+	++YYCURSOR;
+yy2:
+	{ *end = YYCURSOR; return -1; }
+yy3:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	{
+#if defined(__AVX2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(32)));
+		typedef char yymsk_t __attribute__((vector_size(32)));
+#elif defined(__SSE2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		typedef char yymsk_t __attribute__((vector_size(16)));
+#else
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		unsigned long long yyw[sizeof(yyvec_t) / 8];
+#endif
+		yyvec_t yyv;
+		unsigned int yyi;
+		for (;;) {
+			if (YYLIMIT - YYCURSOR < (long)sizeof(yyvec_t) + 1) break;
+			__builtin_memcpy(&yyv, YYCURSOR, sizeof(yyv));
+			yyv = (yyvec_t)~(((yyvec_t)(yyv - 0x09) <= 0x01) | (yyv == 0x20));
+#if defined(__AVX2__)
+			yyi = (unsigned int)__builtin_ctzll((unsigned int)__builtin_ia32_pmovmskb256((yymsk_t)yyv) | 1ull << 32);
+#elif defined(__SSE2__)
+			yyi = (unsigned int)__builtin_ctz((unsigned int)__builtin_ia32_pmovmskb128((yymsk_t)yyv) | 1u << 16);
+#else
+			__builtin_memcpy(yyw, &yyv, sizeof(yyv));
+			yyi = 0;
+			while (yyi < sizeof(yyv) && yyw[yyi / 8] == 0) yyi += 8;
+			if (yyi < sizeof(yyv)) yyi += (unsigned int)__builtin_ctzll(yyw[yyi / 8]) / 8;
+#endif
+			YYCURSOR += yyi;
+			if (yyi < sizeof(yyv)) break;
+		}
+		yych = *YYCURSOR;
+	}
+#endif
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy3;
+		default: goto yy4;
+	}
+yy4:
+	{ *end = YYCURSOR; return 4; }
+yy5:
+	yych = *(YYMARKER = ++YYCURSOR);
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy2;
+		default: goto yy10;
+	}
+yy6:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '*': goto yy13;
+		default: goto yy2;
+	}
+yy7:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	{
+#if defined(__AVX2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(32)));
+		typedef char yymsk_t __attribute__((vector_size(32)));
+#elif defined(__SSE2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		typedef char yymsk_t __attribute__((vector_size(16)));
+#else
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		unsigned long long yyw[sizeof(yyvec_t) / 8];
+#endif
+		yyvec_t yyv;
+		unsigned int yyi;
+		for (;;) {
+			if (YYLIMIT - YYCURSOR < (long)sizeof(yyvec_t) + 1) break;
+			__builtin_memcpy(&yyv, YYCURSOR, sizeof(yyv));
+			yyv = (yyvec_t)~(((yyvec_t)(yyv - 0x30) <= 0x09) | ((yyvec_t)(yyv - 0x41) <= 0x19) | (yyv == 0x5F) | ((yyvec_t)(yyv - 0x61) <= 0x19));
+#if defined(__AVX2__)
+			yyi = (unsigned int)__builtin_ctzll((unsigned int)__builtin_ia32_pmovmskb256((yymsk_t)yyv) | 1ull << 32);
+#elif defined(__SSE2__)
+			yyi = (unsigned int)__builtin_ctz((unsigned int)__builtin_ia32_pmovmskb128((yymsk_t)yyv) | 1u << 16);
+#else
+			__builtin_memcpy(yyw, &yyv, sizeof(yyv));
+			yyi = 0;
+			while (yyi < sizeof(yyv) && yyw[yyi / 8] == 0) yyi += 8;
+			if (yyi < sizeof(yyv)) yyi += (unsigned int)__builtin_ctzll(yyw[yyi / 8]) / 8;
+#endif
+			YYCURSOR += yyi;
+			if (yyi < sizeof(yyv)) break;
+		}
+		yych = *YYCURSOR;
+	}
+#endif
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy7;
+		default: goto yy8;
+	}
+yy8:
+	{ *end = YYCURSOR; return 3; }
+yy9:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	{
+#if defined(__AVX2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(32)));
+		typedef char yymsk_t __attribute__((vector_size(32)));
+#elif defined(__SSE2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		typedef char yymsk_t __attribute__((vector_size(16)));
+#else
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		unsigned long long yyw[sizeof(yyvec_t) / 8];
+#endif
+		yyvec_t yyv;
+		unsigned int yyi;
+		for (;;) {
+			if (YYLIMIT - YYCURSOR < (long)sizeof(yyvec_t) + 1) break;
+			__builtin_memcpy(&yyv, YYCURSOR, sizeof(yyv));
+			yyv = (yyvec_t)((yyv == 0x0A) | (yyv == 0x22) | (yyv == 0x5C));
+#if defined(__AVX2__)
+			yyi = (unsigned int)__builtin_ctzll((unsigned int)__builtin_ia32_pmovmskb256((yymsk_t)yyv) | 1ull << 32);
+#elif defined(__SSE2__)
+			yyi = (unsigned int)__builtin_ctz((unsigned int)__builtin_ia32_pmovmskb128((yymsk_t)yyv) | 1u << 16);
+#else
+			__builtin_memcpy(yyw, &yyv, sizeof(yyv));
+			yyi = 0;
+			while (yyi < sizeof(yyv) && yyw[yyi / 8] == 0) yyi += 8;
+			if (yyi < sizeof(yyv)) yyi += (unsigned int)__builtin_ctzll(yyw[yyi / 8]) / 8;
+#endif
+			YYCURSOR += yyi;
+			if (yyi < sizeof(yyv)) break;
+		}
+		yych = *YYCURSOR;
+	}
+#endif
+yy10:
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy11;
+		case '"': goto yy12;
+		default: goto yy9;
+	}
+yy11:
+	YYCURSOR = YYMARKER;
+	goto yy2;
+yy12:
+	++YYCURSOR;
+	{ *end = YYCURSOR; return 1; }
+yy13:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	{
+#if defined(__AVX2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(32)));
+		typedef char yymsk_t __attribute__((vector_size(32)));
+#elif defined(__SSE2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		typedef char yymsk_t __attribute__((vector_size(16)));
+#else
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		unsigned long long yyw[sizeof(yyvec_t) / 8];
+#endif
+		yyvec_t yyv;
+		unsigned int yyi;
+		for (;;) {
+			if (YYLIMIT - YYCURSOR < (long)sizeof(yyvec_t) + 1) break;
+			__builtin_memcpy(&yyv, YYCURSOR, sizeof(yyv));
+			yyv = (yyvec_t)((yyv == 0x2A));
+#if defined(__AVX2__)
+			yyi = (unsigned int)__builtin_ctzll((unsigned int)__builtin_ia32_pmovmskb256((yymsk_t)yyv) | 1ull << 32);
+#elif defined(__SSE2__)
+			yyi = (unsigned int)__builtin_ctz((unsigned int)__builtin_ia32_pmovmskb128((yymsk_t)yyv) | 1u << 16);
+#else
+			__builtin_memcpy(yyw, &yyv, sizeof(yyv));
+			yyi = 0;
+			while (yyi < sizeof(yyv) && yyw[yyi / 8] == 0) yyi += 8;
+			if (yyi < sizeof(yyv)) yyi += (unsigned int)__builtin_ctzll(yyw[yyi / 8]) / 8;
+#endif
+			YYCURSOR += yyi;
+			if (yyi < sizeof(yyv)) break;
+		}
+		yych = *YYCURSOR;
+	}
+#endif
+	switch (yych) {
+		case '*': goto yy14;
+		default: goto yy13;
+	}
+yy14:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	{
+#if defined(__AVX2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(32)));
+		typedef char yymsk_t __attribute__((vector_size(32)));
+#elif defined(__SSE2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		typedef char yymsk_t __attribute__((vector_size(16)));
+#else
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		unsigned long long yyw[sizeof(yyvec_t) / 8];
+#endif
+		yyvec_t yyv;
+		unsigned int yyi;
+		for (;;) {
+			if (YYLIMIT - YYCURSOR < (long)sizeof(yyvec_t) + 1) break;
+			__builtin_memcpy(&yyv, YYCURSOR, sizeof(yyv));
+			yyv = (yyvec_t)~((yyv == 0x2A));
+#if defined(__AVX2__)
+			yyi = (unsigned int)__builtin_ctzll((unsigned int)__builtin_ia32_pmovmskb256((yymsk_t)yyv) | 1ull << 32);
+#elif defined(__SSE2__)
+			yyi = (unsigned int)__builtin_ctz((unsigned int)__builtin_ia32_pmovmskb128((yymsk_t)yyv) | 1u << 16);
+#else
+			__builtin_memcpy(yyw, &yyv, sizeof(yyv));
+			yyi = 0;
+			while (yyi < sizeof(yyv) && yyw[yyi / 8] == 0) yyi += 8;
+			if (yyi < sizeof(yyv)) yyi += (unsigned int)__builtin_ctzll(yyw[yyi / 8]) / 8;
+#endif
+			YYCURSOR += yyi;
+			if (yyi < sizeof(yyv)) break;
+		}
+		yych = *YYCURSOR;
+	}
+#endif
+	switch (yych) {
+		case '*': goto yy14;
+		case '/': goto yy15;
+		default: goto yy13;
+	}
+yy15:
+	++YYCURSOR;
+	{ *end = YYCURSOR; return 2; }
+}
+
+}
+
+static int lex2(const char *YYCURSOR, const char *YYLIMIT, const char **end)
+{
+    const char *YYMARKER;
+    
+{
+	YYCTYPE yych;
+	if ((YYLIMIT - YYCURSOR) < 2) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy19;
+		case '"': goto yy21;
+		case '/': goto yy22;
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy23;
+		default: goto yy17;
+	}
+yy17:
+	++YYCURSOR;
+yy18:
+	{ *end = YYCURSOR; return -1; }
+yy19:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy19;
+		default: goto yy20;
+	}
+yy20:
+	{ *end = YYCURSOR; return 4; }
+yy21:
+	yych = *(YYMARKER = ++YYCURSOR);
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy18;
+		default: goto yy26;
+	}
+yy22:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '*': goto yy29;
+		default: goto yy18;
+	}
+yy23:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy23;
+		default: goto yy24;
+	}
+yy24:
+	{ *end = YYCURSOR; return 3; }
+yy25:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+yy26:
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy27;
+		case '"': goto yy28;
+		default: goto yy25;
+	}
+yy27:
+	YYCURSOR = YYMARKER;
+	goto yy18;
+yy28:
+	++YYCURSOR;
+	{ *end = YYCURSOR; return 1; }
+yy29:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '*': goto yy30;
+		default: goto yy29;
+	}
+yy30:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '*': goto yy30;
+		case '/': goto yy31;
+		default: goto yy29;
+	}
+yy31:
+	++YYCURSOR;
+	{ *end = YYCURSOR; return 2; }
+}
+
+}
+
+static int test(const char *s, size_t *n)
+{
+    // pad input with YYMAXFILL zeroes, so that the lexer can read ahead
+    char buf[256] = {0};
+    const char *e1, *e2;
+    const size_t len = strlen(s);
+    memcpy(buf, s, len);
+    const int i = lex1(buf, buf + len + YYMAXFILL, &e1);
+    assert(i == lex2(buf, buf + len + YYMAXFILL, &e2));
+    assert(e1 == e2);
+    *n = (size_t)(e1 - buf);
+    return i;
+}
+
+int main()
+{
+    size_t n;
+    assert(test("\"a short string\"", &n) == 1 && n == 16);
+    assert(test("\"a string that is longer than thirty-two characters\" x", &n) == 1 && n == 52);
+    assert(test("\"an unterminated string\n\"", &n) == -1 && n == 1);
+    assert(test("/* a comment * with ** stars **/ x", &n) == 2 && n == 32);
+    assert(test("identifier_that_is_longer_than_thirty_two_characters+", &n) == 3 && n == 52);
+    assert(test("id", &n) == 3 && n == 2);
+    assert(test("    \t\t\n\n                                    x", &n) == 4 && n == 44);
+    return 0;
+}
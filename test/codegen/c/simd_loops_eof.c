@@ -0,0 +1,44 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i --simd-loops
+
+{
+	YYCTYPE yych;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case 'a': goto yy3;
+		default:
+			if (YYLIMIT <= YYCURSOR) goto yy7;
+			goto yy1;
+	}
+yy1:
+	++YYCURSOR;
+yy2:
+	{ return 0; }
+yy3:
+	yych = *(YYMARKER = ++YYCURSOR);
+	switch (yych) {
+		case 0x00:
+			if (YYLIMIT <= YYCURSOR) goto yy2;
+			goto yy4;
+		case 'b': goto yy6;
+		default: goto yy2;
+	}
+yy4:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 0x00:
+			if (YYLIMIT <= YYCURSOR) goto yy5;
+			goto yy4;
+		case 'b': goto yy6;
+		default: goto yy5;
+	}
+yy5:
+	YYCURSOR = YYMARKER;
+	goto yy2;
+yy6:
+	++YYCURSOR;
+	{ return 1; }
+yy7:
+	{ return -1; }
+}
+
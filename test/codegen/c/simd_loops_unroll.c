@@ -0,0 +1,286 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i --eager-skip --simd-loops --unroll-loops 2
+
+{
+	char yych;
+	if ((YYLIMIT - YYCURSOR) < 2) return -2;
+	yych = *YYCURSOR++;
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy3;
+		case '"': goto yy5;
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy6;
+		default: goto yy1;
+	}
+yy1:
+yy2:
+	{ return -1; }
+yy3:
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	{
+#if defined(__AVX2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(32)));
+		typedef char yymsk_t __attribute__((vector_size(32)));
+#elif defined(__SSE2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		typedef char yymsk_t __attribute__((vector_size(16)));
+#else
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		unsigned long long yyw[sizeof(yyvec_t) / 8];
+#endif
+		yyvec_t yyv;
+		unsigned int yyi;
+		for (;;) {
+			if (YYLIMIT - YYCURSOR < (long)sizeof(yyvec_t) + 1) break;
+			__builtin_memcpy(&yyv, YYCURSOR, sizeof(yyv));
+			yyv = (yyvec_t)~(((yyvec_t)(yyv - 0x09) <= 0x01) | (yyv == 0x20));
+#if defined(__AVX2__)
+			yyi = (unsigned int)__builtin_ctzll((unsigned int)__builtin_ia32_pmovmskb256((yymsk_t)yyv) | 1ull << 32);
+#elif defined(__SSE2__)
+			yyi = (unsigned int)__builtin_ctz((unsigned int)__builtin_ia32_pmovmskb128((yymsk_t)yyv) | 1u << 16);
+#else
+			__builtin_memcpy(yyw, &yyv, sizeof(yyv));
+			yyi = 0;
+			while (yyi < sizeof(yyv) && yyw[yyi / 8] == 0) yyi += 8;
+			if (yyi < sizeof(yyv)) yyi += (unsigned int)__builtin_ctzll(yyw[yyi / 8]) / 8;
+#endif
+			YYCURSOR += yyi;
+			if (yyi < sizeof(yyv)) break;
+		}
+		yych = *YYCURSOR;
+	}
+#endif
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ':
+			++YYCURSOR;
+			goto yy3;
+		default: goto yy4;
+	}
+yy4:
+	{ return 2; }
+yy5:
+	yych = *(YYMARKER = YYCURSOR);
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy2;
+		default: goto yy9;
+	}
+yy6:
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	{
+#if defined(__AVX2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(32)));
+		typedef char yymsk_t __attribute__((vector_size(32)));
+#elif defined(__SSE2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		typedef char yymsk_t __attribute__((vector_size(16)));
+#else
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		unsigned long long yyw[sizeof(yyvec_t) / 8];
+#endif
+		yyvec_t yyv;
+		unsigned int yyi;
+		for (;;) {
+			if (YYLIMIT - YYCURSOR < (long)sizeof(yyvec_t) + 1) break;
+			__builtin_memcpy(&yyv, YYCURSOR, sizeof(yyv));
+			yyv = (yyvec_t)~(((yyvec_t)(yyv - 0x30) <= 0x09) | ((yyvec_t)(yyv - 0x41) <= 0x19) | (yyv == 0x5F) | ((yyvec_t)(yyv - 0x61) <= 0x19));
+#if defined(__AVX2__)
+			yyi = (unsigned int)__builtin_ctzll((unsigned int)__builtin_ia32_pmovmskb256((yymsk_t)yyv) | 1ull << 32);
+#elif defined(__SSE2__)
+			yyi = (unsigned int)__builtin_ctz((unsigned int)__builtin_ia32_pmovmskb128((yymsk_t)yyv) | 1u << 16);
+#else
+			__builtin_memcpy(yyw, &yyv, sizeof(yyv));
+			yyi = 0;
+			while (yyi < sizeof(yyv) && yyw[yyi / 8] == 0) yyi += 8;
+			if (yyi < sizeof(yyv)) yyi += (unsigned int)__builtin_ctzll(yyw[yyi / 8]) / 8;
+#endif
+			YYCURSOR += yyi;
+			if (yyi < sizeof(yyv)) break;
+		}
+		yych = *YYCURSOR;
+	}
+#endif
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z':
+			++YYCURSOR;
+			goto yy6;
+		default: goto yy7;
+	}
+yy7:
+	{ return 1; }
+yy8:
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	{
+#if defined(__AVX2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(32)));
+		typedef char yymsk_t __attribute__((vector_size(32)));
+#elif defined(__SSE2__)
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		typedef char yymsk_t __attribute__((vector_size(16)));
+#else
+		typedef unsigned char yyvec_t __attribute__((vector_size(16)));
+		unsigned long long yyw[sizeof(yyvec_t) / 8];
+#endif
+		yyvec_t yyv;
+		unsigned int yyi;
+		for (;;) {
+			if (YYLIMIT - YYCURSOR < (long)sizeof(yyvec_t) + 1) break;
+			__builtin_memcpy(&yyv, YYCURSOR, sizeof(yyv));
+			yyv = (yyvec_t)((yyv == 0x0A) | (yyv == 0x22) | (yyv == 0x5C));
+#if defined(__AVX2__)
+			yyi = (unsigned int)__builtin_ctzll((unsigned int)__builtin_ia32_pmovmskb256((yymsk_t)yyv) | 1ull << 32);
+#elif defined(__SSE2__)
+			yyi = (unsigned int)__builtin_ctz((unsigned int)__builtin_ia32_pmovmskb128((yymsk_t)yyv) | 1u << 16);
+#else
+			__builtin_memcpy(yyw, &yyv, sizeof(yyv));
+			yyi = 0;
+			while (yyi < sizeof(yyv) && yyw[yyi / 8] == 0) yyi += 8;
+			if (yyi < sizeof(yyv)) yyi += (unsigned int)__builtin_ctzll(yyw[yyi / 8]) / 8;
+#endif
+			YYCURSOR += yyi;
+			if (yyi < sizeof(yyv)) break;
+		}
+		yych = *YYCURSOR;
+	}
+#endif
+yy9:
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy10;
+		case '"':
+			++YYCURSOR;
+			goto yy11;
+		default:
+			++YYCURSOR;
+			goto yy8;
+	}
+yy10:
+	YYCURSOR = YYMARKER;
+	goto yy2;
+yy11:
+	{ return 3; }
+}
+
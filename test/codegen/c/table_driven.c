@@ -0,0 +1,951 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i --table-driven
+#include <assert.h>
+#include <string.h>
+
+
+
+static int lex1(const char **end, const char *YYLIMIT, int *len)
+{
+    const char *YYMARKER, *a, *b;
+    const char *yyt1;const char *yyt2;
+    
+{
+	char yych;
+	unsigned int yyaccept = 0;
+	unsigned int yystate = 0;
+	static const unsigned char yyclass[256] = {
+		 0,  1,  1,  1,  1,  1,  1,  1,
+		 1,  2,  2,  3,  3,  3,  3,  3,
+		 3,  3,  3,  3,  3,  3,  3,  3,
+		 3,  3,  3,  3,  3,  3,  3,  3,
+		 4,  5,  5,  5,  5,  5,  5,  5,
+		 5,  5,  5,  5,  5,  5,  5,  5,
+		 6,  7,  7,  7,  7,  7,  7,  7,
+		 7,  7,  8,  8,  8,  9, 10, 10,
+		10, 11, 11, 11, 11, 11, 11, 12,
+		12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 12,
+		12, 12, 12, 12, 12, 12, 12, 13,
+		14, 15, 15, 15, 15, 15, 16, 17,
+		17, 18, 19, 19, 19, 19, 20, 21,
+		22, 22, 23, 24, 25, 26, 26, 26,
+		27, 28, 28, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29,
+		29, 29, 29, 29, 29, 29, 29, 29
+	};
+	static const unsigned short yybase[24] = {
+		  0,   0,  30,   0,   0,   0,  90,  90,
+		120, 120,   0,   0,   0,   0, 240,   0,
+		270,   0,   0,   0,   0, 390, 420,   0
+	};
+	static const unsigned char yyfallback[24] = {
+		 0,  0,  3,  0,  0,  0,  5,  5,
+		10, 10,  0,  0,  0,  0, 15,  0,
+		15,  0,  0,  0,  0,  5, 23,  0
+	};
+	static const unsigned char yytrans[456] = {
+		 3,  3,  5,  3,  5,  3,  9, 13,
+		 3,  3,  3,  3,  3, 17,  3, 50,
+		52, 50, 54, 50, 50, 50, 50, 50,
+		50, 50, 50, 50, 50,  3,  6,  6,
+		 5,  6,  5,  6,  6,  6,  6,  6,
+		 6,  6,  6,  6,  6,  6,  6,  6,
+		 6,  6,  6,  6,  6,  6,  6,  6,
+		 6,  6,  6,  6, 10, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 14,
+		14, 14, 14, 14, 14, 14, 14, 29,
+		14, 14, 10, 10, 10, 10, 10, 10,
+		13, 13, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10,
+		20, 20, 20, 20, 20, 20, 17, 17,
+		20, 20, 20, 20, 20, 17, 20, 17,
+		17, 17, 17, 17, 17, 17, 17, 17,
+		17, 17, 17, 17, 17, 20, 20, 20,
+		20, 20, 20, 20, 17, 17, 20, 56,
+		20, 20, 20, 17, 20, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 20, 20, 18, 18, 18,
+		18, 18, 18, 18, 18, 56, 18, 18,
+		18, 18, 18, 23, 23, 23, 23, 23,
+		23, 35, 23, 23, 23, 23, 23, 23,
+		23, 18, 20, 18, 18, 18, 18, 18,
+		18, 18, 18, 56, 18, 18, 18, 18,
+		18, 23, 37, 23, 23, 23, 41, 23,
+		23, 23, 23, 23, 23, 23, 23, 18,
+		30, 30, 30, 30, 30, 30, 43, 43,
+		30, 30, 30, 43, 30, 30, 30, 43,
+		43, 30, 30, 30, 30, 30, 30, 30,
+		30, 30, 30, 30, 30, 30, 30, 30,
+		30, 30, 30, 30, 45, 45, 30, 30,
+		30, 30, 30, 30, 30, 30, 30, 30,
+		30, 30, 30, 30, 30, 30, 30, 30,
+		30, 30, 30, 30, 20, 18, 18, 18,
+		18, 18, 18, 18, 18, 56, 18, 18,
+		18, 18, 18, 23, 23, 23, 23, 23,
+		23, 23, 23, 37, 23, 23, 23, 23,
+		23, 18, 38, 38, 38, 38, 38, 38,
+		17, 17, 38, 56, 38, 38, 38, 17,
+		38, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 38,
+		20, 18, 18, 18, 18, 18, 18, 18,
+		18, 56, 18, 18, 18, 18, 18, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 37, 23, 23, 23, 18, 10, 10,
+		10, 10, 10, 10, 43, 43, 10, 10,
+		10, 43, 10, 10, 10, 43, 43, 10,
+		10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 46, 46, 46, 46,
+		46, 46, 45, 45, 46, 46, 46, 46,
+		46, 46, 46, 46, 46, 46, 46, 46,
+		46, 46, 46, 46, 46, 46, 46, 46,
+		46, 46,  0,  0,  0,  0,  0,  0
+	};
+	for (;;) {
+		switch (yystate) {
+			case 0:
+				yych = **end;
+				if (yych == 0x00) {
+					if (YYLIMIT <= *end) {
+						yystate = 24;
+						continue;
+					}
+				}
+				yystate = yytrans[yyclass[(unsigned char)yych]];
+				*end += yystate & 1;
+				yystate = yystate >> 1;
+				continue;
+			case 1: { return -1; }
+			case 3: { return 5; }
+			case 4:
+				yyaccept = 0;
+				YYMARKER = *end;
+				yych = **end;
+				if (yych == 0x00) {
+					if (YYLIMIT <= *end) {
+						yystate = 5;
+						continue;
+					}
+				}
+				yystate = yytrans[60 + yyclass[(unsigned char)yych]];
+				*end += yystate & 1;
+				yystate = yystate >> 1;
+				continue;
+			case 5: { return 4; }
+			case 10: { return 3; }
+			case 11:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				if (yych == 0x00) {
+					if (YYLIMIT <= *end) {
+						yystate = 10;
+						continue;
+					}
+				}
+				yystate = yytrans[150 + yyclass[(unsigned char)yych]];
+				*end += yystate & 1;
+				yystate = yystate >> 1;
+				continue;
+			case 12:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				if (yych == 0x00) {
+					if (YYLIMIT <= *end) {
+						yystate = 10;
+						continue;
+					}
+				}
+				yystate = yytrans[180 + yyclass[(unsigned char)yych]];
+				*end += yystate & 1;
+				yystate = yystate >> 1;
+				continue;
+			case 13:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				if (yych == 0x00) {
+					if (YYLIMIT <= *end) {
+						yystate = 10;
+						continue;
+					}
+				}
+				yystate = yytrans[210 + yyclass[(unsigned char)yych]];
+				*end += yystate & 1;
+				yystate = yystate >> 1;
+				continue;
+			case 15:
+				*end = YYMARKER;
+				switch (yyaccept) {
+					case 0:
+						yystate = 5;
+						continue;
+					case 1:
+						yystate = 10;
+						continue;
+					default:
+						yystate = 19;
+						continue;
+				}
+			case 17:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				if (yych == 0x00) {
+					if (YYLIMIT <= *end) {
+						yystate = 10;
+						continue;
+					}
+				}
+				yystate = yytrans[300 + yyclass[(unsigned char)yych]];
+				*end += yystate & 1;
+				yystate = yystate >> 1;
+				continue;
+			case 18:
+				yyaccept = 2;
+				YYMARKER = *end;
+				yych = **end;
+				if (yych == 0x00) {
+					if (YYLIMIT <= *end) {
+						yystate = 19;
+						continue;
+					}
+				}
+				yystate = yytrans[330 + yyclass[(unsigned char)yych]];
+				*end += yystate & 1;
+				yystate = yystate >> 1;
+				continue;
+			case 19: { return 1; }
+			case 20:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				if (yych == 0x00) {
+					if (YYLIMIT <= *end) {
+						yystate = 10;
+						continue;
+					}
+				}
+				yystate = yytrans[360 + yyclass[(unsigned char)yych]];
+				*end += yystate & 1;
+				yystate = yystate >> 1;
+				continue;
+			case 23:
+				a = yyt1;
+				b = yyt2;
+				{ *len = (int)(b - a); return 2; }
+			case 24: { return 0; }
+			case 25:
+				yyt1 = *end;
+				++*end;
+				yystate = 11;
+				continue;
+			case 26:
+				yyt1 = *end;
+				++*end;
+				yystate = 12;
+				continue;
+			case 27:
+				yyt1 = *end;
+				++*end;
+				yystate = 13;
+				continue;
+			case 28:
+				yyt2 = *end;
+				++*end;
+				yystate = 16;
+				continue;
+			default:
+				yych = **end;
+				if (yych == 0x00) {
+					if (YYLIMIT <= *end) {
+						yystate = yyfallback[yystate];
+						continue;
+					}
+				}
+				yystate = yytrans[yybase[yystate] + yyclass[(unsigned char)yych]];
+				*end += yystate & 1;
+				yystate = yystate >> 1;
+				continue;
+		}
+	}
+}
+
+}
+
+static int lex2(const char **end, const char *YYLIMIT, int *len)
+{
+    const char *YYMARKER, *a, *b;
+    const char *yyt1;const char *yyt2;
+    
+{
+	char yych;
+	unsigned int yyaccept = 0;
+	unsigned int yystate = 0;
+	for (;;) {
+		switch (yystate) {
+			case 0:
+				yych = **end;
+				switch (yych) {
+					case '\t':
+					case '\n':
+					case ' ':
+						++*end;
+						yystate = 2;
+						continue;
+					case '0':
+						++*end;
+						yystate = 4;
+						continue;
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+						++*end;
+						yystate = 6;
+						continue;
+					case '_':
+						++*end;
+						yystate = 8;
+						continue;
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'g':
+					case 'h':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'n':
+					case 'o':
+					case 'p':
+					case 'q':
+					case 'r':
+					case 's':
+					case 't':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+						yyt1 = *end;
+						++*end;
+						yystate = 11;
+						continue;
+					case 'f':
+						yyt1 = *end;
+						++*end;
+						yystate = 12;
+						continue;
+					case 'i':
+						yyt1 = *end;
+						++*end;
+						yystate = 13;
+						continue;
+					default:
+						if (YYLIMIT <= *end) {
+							yystate = 24;
+							continue;
+						}
+						++*end;
+						yystate = 1;
+						continue;
+				}
+			case 1: { return -1; }
+			case 2:
+				yych = **end;
+				switch (yych) {
+					case '\t':
+					case '\n':
+					case ' ':
+						++*end;
+						yystate = 2;
+						continue;
+					default:
+						yystate = 3;
+						continue;
+				}
+			case 3: { return 5; }
+			case 4:
+				yyaccept = 0;
+				YYMARKER = *end;
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+						yystate = 5;
+						continue;
+					case 'x':
+						++*end;
+						yystate = 14;
+						continue;
+					default:
+						yystate = 7;
+						continue;
+				}
+			case 5: { return 4; }
+			case 6:
+				yych = **end;
+				yystate = 7;
+				continue;
+			case 7:
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+						++*end;
+						yystate = 6;
+						continue;
+					default:
+						yystate = 5;
+						continue;
+				}
+			case 8:
+				yych = **end;
+				yystate = 9;
+				continue;
+			case 9:
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+					case '_':
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+					case 'g':
+					case 'h':
+					case 'i':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'n':
+					case 'o':
+					case 'p':
+					case 'q':
+					case 'r':
+					case 's':
+					case 't':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+						++*end;
+						yystate = 8;
+						continue;
+					default:
+						yystate = 10;
+						continue;
+				}
+			case 10: { return 3; }
+			case 11:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+					case '_':
+						++*end;
+						yystate = 8;
+						continue;
+					case '=':
+						yyt2 = *end;
+						++*end;
+						yystate = 16;
+						continue;
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+					case 'g':
+					case 'h':
+					case 'i':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'n':
+					case 'o':
+					case 'p':
+					case 'q':
+					case 'r':
+					case 's':
+					case 't':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+						++*end;
+						yystate = 11;
+						continue;
+					default:
+						yystate = 10;
+						continue;
+				}
+			case 12:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+						yystate = 10;
+						continue;
+					case '=':
+						yyt2 = *end;
+						++*end;
+						yystate = 16;
+						continue;
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+					case 'g':
+					case 'h':
+					case 'i':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'n':
+					case 'p':
+					case 'q':
+					case 'r':
+					case 's':
+					case 't':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+						++*end;
+						yystate = 11;
+						continue;
+					case 'o':
+						++*end;
+						yystate = 17;
+						continue;
+					default:
+						yystate = 9;
+						continue;
+				}
+			case 13:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+						yystate = 10;
+						continue;
+					case '=':
+						yyt2 = *end;
+						++*end;
+						yystate = 16;
+						continue;
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'g':
+					case 'h':
+					case 'i':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'o':
+					case 'p':
+					case 'q':
+					case 'r':
+					case 's':
+					case 't':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+						++*end;
+						yystate = 11;
+						continue;
+					case 'f':
+						++*end;
+						yystate = 18;
+						continue;
+					case 'n':
+						++*end;
+						yystate = 20;
+						continue;
+					default:
+						yystate = 9;
+						continue;
+				}
+			case 14:
+				yych = **end;
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+					case 'A':
+					case 'B':
+					case 'C':
+					case 'D':
+					case 'E':
+					case 'F':
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+						++*end;
+						yystate = 21;
+						continue;
+					default:
+						yystate = 15;
+						continue;
+				}
+			case 15:
+				*end = YYMARKER;
+				switch (yyaccept) {
+					case 0:
+						yystate = 5;
+						continue;
+					case 1:
+						yystate = 10;
+						continue;
+					default:
+						yystate = 19;
+						continue;
+				}
+			case 16:
+				yych = **end;
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+						++*end;
+						yystate = 22;
+						continue;
+					default:
+						yystate = 15;
+						continue;
+				}
+			case 17:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+						yystate = 10;
+						continue;
+					case '=':
+						yyt2 = *end;
+						++*end;
+						yystate = 16;
+						continue;
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+					case 'g':
+					case 'h':
+					case 'i':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'n':
+					case 'o':
+					case 'p':
+					case 'q':
+					case 's':
+					case 't':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+						++*end;
+						yystate = 11;
+						continue;
+					case 'r':
+						++*end;
+						yystate = 18;
+						continue;
+					default:
+						yystate = 9;
+						continue;
+				}
+			case 18:
+				yyaccept = 2;
+				YYMARKER = *end;
+				yych = **end;
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+					case '_':
+						++*end;
+						yystate = 8;
+						continue;
+					case '=':
+						yyt2 = *end;
+						++*end;
+						yystate = 16;
+						continue;
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+					case 'g':
+					case 'h':
+					case 'i':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'n':
+					case 'o':
+					case 'p':
+					case 'q':
+					case 'r':
+					case 's':
+					case 't':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+						++*end;
+						yystate = 11;
+						continue;
+					default:
+						yystate = 19;
+						continue;
+				}
+			case 19: { return 1; }
+			case 20:
+				yyaccept = 1;
+				YYMARKER = *end;
+				yych = **end;
+				switch (yych) {
+					case 0x00:
+						yystate = 10;
+						continue;
+					case '=':
+						yyt2 = *end;
+						++*end;
+						yystate = 16;
+						continue;
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+					case 'g':
+					case 'h':
+					case 'i':
+					case 'j':
+					case 'k':
+					case 'l':
+					case 'm':
+					case 'n':
+					case 'o':
+					case 'p':
+					case 'q':
+					case 'r':
+					case 's':
+					case 'u':
+					case 'v':
+					case 'w':
+					case 'x':
+					case 'y':
+					case 'z':
+						++*end;
+						yystate = 11;
+						continue;
+					case 't':
+						++*end;
+						yystate = 18;
+						continue;
+					default:
+						yystate = 9;
+						continue;
+				}
+			case 21:
+				yych = **end;
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+					case 'A':
+					case 'B':
+					case 'C':
+					case 'D':
+					case 'E':
+					case 'F':
+					case 'a':
+					case 'b':
+					case 'c':
+					case 'd':
+					case 'e':
+					case 'f':
+						++*end;
+						yystate = 21;
+						continue;
+					default:
+						yystate = 5;
+						continue;
+				}
+			case 22:
+				yych = **end;
+				switch (yych) {
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+						++*end;
+						yystate = 22;
+						continue;
+					default:
+						yystate = 23;
+						continue;
+				}
+			case 23:
+				a = yyt1;
+				b = yyt2;
+				{ *len = (int)(b - a); return 2; }
+			case 24: { return 0; }
+		}
+	}
+}
+
+}
+
+static int test(const char *s)
+{
+    const char *e1 = s, *e2 = s, *lim = s + strlen(s);
+    int l1 = 0, l2 = 0;
+    const int i = lex1(&e1, lim, &l1);
+    assert(i == lex2(&e2, lim, &l2));
+    assert(e1 == e2 && l1 == l2);
+    return i;
+}
+
+int main()
+{
+    assert(test("") == 0);
+    assert(test("if") == 1);
+    assert(test("int") == 1);
+    assert(test("integer") == 3);
+    assert(test("abc=123") == 2);
+    assert(test("abc=") == 3);
+    assert(test("0x1F") == 4);
+    assert(test("0x") == 4);
+    assert(test("  \n\t") == 5);
+    assert(test("$") == -1);
+    return 0;
+}
@@ -0,0 +1,752 @@
+/* Generated by re2c */
+// re2c $INPUT -o $OUTPUT -i --unroll-loops 4
+#include <assert.h>
+#include <string.h>
+
+#define YYCTYPE char
+#define YYMAXFILL 4
+
+
+
+
+static int lex1(const char *YYCURSOR, const char *YYLIMIT, const char **end)
+{
+    const char *YYMARKER;
+    
+{
+	YYCTYPE yych;
+	if ((YYLIMIT - YYCURSOR) < 2) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy3;
+		case '"': goto yy8;
+		case '/': goto yy9;
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy10;
+		default: goto yy1;
+	}
+yy1:
+	++YYCURSOR;
+yy2:
+	{ *end = YYCURSOR; return -1; }
+yy3:
+	++YYCURSOR;
+	if ((YYLIMIT - YYCURSOR) < 4) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy4;
+		default: goto yy7;
+	}
+yy4:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy5;
+		default: goto yy7;
+	}
+yy5:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy6;
+		default: goto yy7;
+	}
+yy6:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy3;
+		default: goto yy7;
+	}
+yy7:
+	{ *end = YYCURSOR; return 4; }
+yy8:
+	yych = *(YYMARKER = ++YYCURSOR);
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy2;
+		case '"': goto yy20;
+		default: goto yy15;
+	}
+yy9:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '*': goto yy21;
+		default: goto yy2;
+	}
+yy10:
+	++YYCURSOR;
+	if ((YYLIMIT - YYCURSOR) < 4) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy11;
+		default: goto yy14;
+	}
+yy11:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy12;
+		default: goto yy14;
+	}
+yy12:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy13;
+		default: goto yy14;
+	}
+yy13:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy10;
+		default: goto yy14;
+	}
+yy14:
+	{ *end = YYCURSOR; return 3; }
+yy15:
+	++YYCURSOR;
+	if ((YYLIMIT - YYCURSOR) < 4) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy19;
+		case '"': goto yy20;
+		default: goto yy16;
+	}
+yy16:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy19;
+		case '"': goto yy20;
+		default: goto yy17;
+	}
+yy17:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy19;
+		case '"': goto yy20;
+		default: goto yy18;
+	}
+yy18:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy19;
+		case '"': goto yy20;
+		default: goto yy15;
+	}
+yy19:
+	YYCURSOR = YYMARKER;
+	goto yy2;
+yy20:
+	++YYCURSOR;
+	{ *end = YYCURSOR; return 1; }
+yy21:
+	++YYCURSOR;
+	if ((YYLIMIT - YYCURSOR) < 4) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '*': goto yy25;
+		default: goto yy22;
+	}
+yy22:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '*': goto yy25;
+		default: goto yy23;
+	}
+yy23:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '*': goto yy25;
+		default: goto yy24;
+	}
+yy24:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '*': goto yy25;
+		default: goto yy21;
+	}
+yy25:
+	++YYCURSOR;
+	if ((YYLIMIT - YYCURSOR) < 4) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '*': goto yy26;
+		case '/': goto yy29;
+		default: goto yy21;
+	}
+yy26:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '*': goto yy27;
+		case '/': goto yy29;
+		default: goto yy21;
+	}
+yy27:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '*': goto yy28;
+		case '/': goto yy29;
+		default: goto yy21;
+	}
+yy28:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '*': goto yy25;
+		case '/': goto yy29;
+		default: goto yy21;
+	}
+yy29:
+	++YYCURSOR;
+	{ *end = YYCURSOR; return 2; }
+}
+
+}
+
+static int lex2(const char *YYCURSOR, const char *YYLIMIT, const char **end)
+{
+    const char *YYMARKER;
+    
+{
+	YYCTYPE yych;
+	if ((YYLIMIT - YYCURSOR) < 2) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy33;
+		case '"': goto yy35;
+		case '/': goto yy36;
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy37;
+		default: goto yy31;
+	}
+yy31:
+	++YYCURSOR;
+yy32:
+	{ *end = YYCURSOR; return -1; }
+yy33:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '\t':
+		case '\n':
+		case ' ': goto yy33;
+		default: goto yy34;
+	}
+yy34:
+	{ *end = YYCURSOR; return 4; }
+yy35:
+	yych = *(YYMARKER = ++YYCURSOR);
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy32;
+		default: goto yy40;
+	}
+yy36:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case '*': goto yy43;
+		default: goto yy32;
+	}
+yy37:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+		case 'A':
+		case 'B':
+		case 'C':
+		case 'D':
+		case 'E':
+		case 'F':
+		case 'G':
+		case 'H':
+		case 'I':
+		case 'J':
+		case 'K':
+		case 'L':
+		case 'M':
+		case 'N':
+		case 'O':
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+		case 'T':
+		case 'U':
+		case 'V':
+		case 'W':
+		case 'X':
+		case 'Y':
+		case 'Z':
+		case '_':
+		case 'a':
+		case 'b':
+		case 'c':
+		case 'd':
+		case 'e':
+		case 'f':
+		case 'g':
+		case 'h':
+		case 'i':
+		case 'j':
+		case 'k':
+		case 'l':
+		case 'm':
+		case 'n':
+		case 'o':
+		case 'p':
+		case 'q':
+		case 'r':
+		case 's':
+		case 't':
+		case 'u':
+		case 'v':
+		case 'w':
+		case 'x':
+		case 'y':
+		case 'z': goto yy37;
+		default: goto yy38;
+	}
+yy38:
+	{ *end = YYCURSOR; return 3; }
+yy39:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+yy40:
+	switch (yych) {
+		case '\n':
+		case '\\': goto yy41;
+		case '"': goto yy42;
+		default: goto yy39;
+	}
+yy41:
+	YYCURSOR = YYMARKER;
+	goto yy32;
+yy42:
+	++YYCURSOR;
+	{ *end = YYCURSOR; return 1; }
+yy43:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '*': goto yy44;
+		default: goto yy43;
+	}
+yy44:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) return -2;
+	yych = *YYCURSOR;
+	switch (yych) {
+		case '*': goto yy44;
+		case '/': goto yy45;
+		default: goto yy43;
+	}
+yy45:
+	++YYCURSOR;
+	{ *end = YYCURSOR; return 2; }
+}
+
+}
+
+static int test(const char *s, size_t *n)
+{
+    // pad input with YYMAXFILL zeroes, so that the lexer can read ahead
+    char buf[256] = {0};
+    const char *e1, *e2;
+    const size_t len = strlen(s);
+    memcpy(buf, s, len);
+    const int i = lex1(buf, buf + len + YYMAXFILL, &e1);
+    assert(i == lex2(buf, buf + len + YYMAXFILL, &e2));
+    assert(e1 == e2);
+    *n = (size_t)(e1 - buf);
+    return i;
+}
+
+int main()
+{
+    size_t n;
+    assert(test("\"\"", &n) == 1 && n == 2);
+    assert(test("\"a short string\"", &n) == 1 && n == 16);
+    assert(test("\"an unterminated string\n\"", &n) == -1 && n == 1);
+    assert(test("/* a comment * with ** stars **/ x", &n) == 2 && n == 32);
+    assert(test("/**/", &n) == 2 && n == 4);
+    assert(test("id", &n) == 3 && n == 2);
+    assert(test("ident", &n) == 3 && n == 5);
+    assert(test("identifier_42+", &n) == 3 && n == 13);
+    assert(test(" \t\n x", &n) == 4 && n == 4);
+    return 0;
+}
@@ -0,0 +1,271 @@
+// Code generated by re2c, DO NOT EDIT.
+//line "codegen/go/class_switch.re":1
+//go:generate re2go $INPUT -o $OUTPUT --class-switch
+package main
+
+func Lex(str string) int {
+	var cursor, marker int
+
+	
+//line "codegen/go/class_switch.go":11
+{
+	var yych byte
+	yycc := [256]byte{
+		 0,  1,  1,  1,  1,  1,  1,  1,
+		 1,  1,  1,  1,  1,  1,  1,  1,
+		 1,  1,  1,  1,  1,  1,  1,  1,
+		 1,  1,  1,  1,  1,  1,  1,  1,
+		 1,  1,  1,  1,  1,  1,  1,  1,
+		 1,  1,  1,  1,  1,  1,  1,  1,
+		 2,  3,  3,  3,  3,  3,  3,  3,
+		 3,  3,  4,  4,  4,  4,  4,  4,
+		 4,  5,  5,  5,  5,  5,  5,  6,
+		 6,  6,  6,  6,  6,  6,  6,  6,
+		 6,  6,  6,  6,  6,  6,  6,  6,
+		 6,  6,  6,  6,  6,  6,  6,  7,
+		 8,  9,  9,  9,  9,  9, 10, 11,
+		11, 12, 13, 13, 13, 13, 14, 15,
+		16, 16, 17, 18, 19, 20, 20, 20,
+		21, 22, 22, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+		23, 23, 23, 23, 23, 23, 23, 23,
+	}
+	yych = str[cursor]
+	switch (yycc[yych]) {
+	case 2:
+		goto yy3
+	case 3:
+		goto yy4
+	case 7:
+		fallthrough
+	case 9:
+		fallthrough
+	case 11:
+		fallthrough
+	case 13,14,15,16,17,18,19,20,21,22:
+		goto yy5
+	case 10:
+		goto yy6
+	case 12:
+		goto yy7
+	default:
+		goto yy1
+	}
+yy1:
+	cursor += 1
+yy2:
+//line "codegen/go/class_switch.re":17
+	{ return -1 }
+//line "codegen/go/class_switch.go":74
+yy3:
+	cursor += 1
+	marker = cursor
+	yych = str[cursor]
+	switch (yycc[yych]) {
+	case 0:
+		goto yy8
+	case 2,3:
+		goto yy9
+	case 21:
+		goto yy11
+	default:
+		goto yy2
+	}
+yy4:
+	cursor += 1
+	marker = cursor
+	yych = str[cursor]
+	switch (yycc[yych]) {
+	case 0:
+		goto yy8
+	case 2,3:
+		goto yy9
+	default:
+		goto yy2
+	}
+yy5:
+	cursor += 1
+	marker = cursor
+	yych = str[cursor]
+	switch (yycc[yych]) {
+	case 0:
+		goto yy12
+	case 2,3:
+		fallthrough
+	case 7:
+		fallthrough
+	case 9,10,11,12,13,14,15,16,17,18,19,20,21,22:
+		goto yy13
+	default:
+		goto yy2
+	}
+yy6:
+	cursor += 1
+	marker = cursor
+	yych = str[cursor]
+	switch (yycc[yych]) {
+	case 0:
+		goto yy12
+	case 2,3:
+		fallthrough
+	case 7:
+		fallthrough
+	case 9,10,11,12,13,14:
+		fallthrough
+	case 16,17,18,19,20,21,22:
+		goto yy13
+	case 15:
+		goto yy15
+	default:
+		goto yy2
+	}
+yy7:
+	cursor += 1
+	marker = cursor
+	yych = str[cursor]
+	switch (yycc[yych]) {
+	case 0:
+		goto yy12
+	case 2,3:
+		fallthrough
+	case 7:
+		fallthrough
+	case 9:
+		fallthrough
+	case 11,12,13:
+		fallthrough
+	case 15,16,17,18,19,20,21,22:
+		goto yy13
+	case 10:
+		goto yy16
+	case 14:
+		goto yy17
+	default:
+		goto yy2
+	}
+yy8:
+	cursor += 1
+//line "codegen/go/class_switch.re":20
+	{ return 3 }
+//line "codegen/go/class_switch.go":165
+yy9:
+	cursor += 1
+	yych = str[cursor]
+	switch (yycc[yych]) {
+	case 0:
+		goto yy8
+	case 2,3:
+		goto yy9
+	default:
+		goto yy10
+	}
+yy10:
+	cursor = marker
+	goto yy2
+yy11:
+	cursor += 1
+	yych = str[cursor]
+	if (yych <= 0x00) {
+		goto yy10
+	}
+	goto yy19
+yy12:
+	cursor += 1
+//line "codegen/go/class_switch.re":19
+	{ return 2 }
+//line "codegen/go/class_switch.go":191
+yy13:
+	cursor += 1
+	yych = str[cursor]
+yy14:
+	switch (yycc[yych]) {
+	case 0:
+		goto yy12
+	case 2,3:
+		fallthrough
+	case 7:
+		fallthrough
+	case 9,10,11,12,13,14,15,16,17,18,19,20,21,22:
+		goto yy13
+	default:
+		goto yy10
+	}
+yy15:
+	cursor += 1
+	yych = str[cursor]
+	switch (yycc[yych]) {
+	case 17:
+		goto yy16
+	default:
+		goto yy14
+	}
+yy16:
+	cursor += 1
+	yych = str[cursor]
+	if (yych <= 0x00) {
+		goto yy20
+	}
+	goto yy14
+yy17:
+	cursor += 1
+	yych = str[cursor]
+	switch (yycc[yych]) {
+	case 19:
+		goto yy16
+	default:
+		goto yy14
+	}
+yy18:
+	cursor += 1
+	yych = str[cursor]
+yy19:
+	switch (yycc[yych]) {
+	case 0:
+		goto yy8
+	case 2,3:
+		fallthrough
+	case 5:
+		fallthrough
+	case 9,10:
+		goto yy18
+	default:
+		goto yy10
+	}
+yy20:
+	cursor += 1
+//line "codegen/go/class_switch.re":18
+	{ return 1 }
+//line "codegen/go/class_switch.go":253
+}
+//line "codegen/go/class_switch.re":21
+
+}
+
+func main() {
+	if Lex("if\000") != 1 {
+		panic("expected keyword")
+	}
+	if Lex("integer\000") != 2 {
+		panic("expected identifier")
+	}
+	if Lex("0x1F\000") != 3 {
+		panic("expected number")
+	}
+	if Lex("0x\000") != -1 {
+		panic("expected error")
+	}
+}
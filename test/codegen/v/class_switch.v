@@ -0,0 +1,190 @@
+// Code generated by re2c, DO NOT EDIT.
+//line "codegen/v/class_switch.re":1
+// re2v $INPUT -o $OUTPUT --class-switch
+
+fn lex(str string) int {
+    mut cursor := 0
+    mut marker := 0
+    
+//line "codegen/v/class_switch.v":10
+    mut yych := 0
+    yycc := [
+         0,  1,  1,  1,  1,  1,  1,  1,
+         1,  1,  1,  1,  1,  1,  1,  1,
+         1,  1,  1,  1,  1,  1,  1,  1,
+         1,  1,  1,  1,  1,  1,  1,  1,
+         1,  1,  1,  1,  1,  1,  1,  1,
+         1,  1,  1,  1,  1,  1,  1,  1,
+         2,  3,  3,  3,  3,  3,  3,  3,
+         3,  3,  4,  4,  4,  4,  4,  4,
+         4,  5,  5,  5,  5,  5,  5,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  6,
+         6,  6,  6,  6,  6,  6,  6,  7,
+         8,  9,  9,  9,  9,  9, 10, 11,
+        11, 12, 13, 13, 13, 13, 14, 15,
+        16, 16, 17, 18, 19, 20, 20, 20,
+        21, 22, 22, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23,
+    ]
+    yych = str[cursor]
+    match yycc[yych] {
+        2 { unsafe { goto yy3 } }
+        3 { unsafe { goto yy4 } }
+        7, 9, 11, 13...22 { unsafe { goto yy5 } }
+        10 { unsafe { goto yy6 } }
+        12 { unsafe { goto yy7 } }
+        else { unsafe { goto yy1 } }
+    }
+yy1:
+    cursor += 1
+yy2:
+//line "codegen/v/class_switch.re":17
+    return -1
+//line "codegen/v/class_switch.v":60
+yy3:
+    cursor += 1
+    marker = cursor
+    yych = str[cursor]
+    match yycc[yych] {
+        0 { unsafe { goto yy8 } }
+        2...3 { unsafe { goto yy9 } }
+        21 { unsafe { goto yy11 } }
+        else { unsafe { goto yy2 } }
+    }
+yy4:
+    cursor += 1
+    marker = cursor
+    yych = str[cursor]
+    match yycc[yych] {
+        0 { unsafe { goto yy8 } }
+        2...3 { unsafe { goto yy9 } }
+        else { unsafe { goto yy2 } }
+    }
+yy5:
+    cursor += 1
+    marker = cursor
+    yych = str[cursor]
+    match yycc[yych] {
+        0 { unsafe { goto yy12 } }
+        2...3, 7, 9...22 { unsafe { goto yy13 } }
+        else { unsafe { goto yy2 } }
+    }
+yy6:
+    cursor += 1
+    marker = cursor
+    yych = str[cursor]
+    match yycc[yych] {
+        0 { unsafe { goto yy12 } }
+        2...3, 7, 9...14, 16...22 { unsafe { goto yy13 } }
+        15 { unsafe { goto yy15 } }
+        else { unsafe { goto yy2 } }
+    }
+yy7:
+    cursor += 1
+    marker = cursor
+    yych = str[cursor]
+    match yycc[yych] {
+        0 { unsafe { goto yy12 } }
+        2...3, 7, 9, 11...13, 15...22 { unsafe { goto yy13 } }
+        10 { unsafe { goto yy16 } }
+        14 { unsafe { goto yy17 } }
+        else { unsafe { goto yy2 } }
+    }
+yy8:
+    cursor += 1
+//line "codegen/v/class_switch.re":20
+    return 3
+//line "codegen/v/class_switch.v":114
+yy9:
+    cursor += 1
+    yych = str[cursor]
+    match yycc[yych] {
+        0 { unsafe { goto yy8 } }
+        2...3 { unsafe { goto yy9 } }
+        else { unsafe { goto yy10 } }
+    }
+yy10:
+    cursor = marker
+    unsafe { goto yy2 }
+yy11:
+    cursor += 1
+    yych = str[cursor]
+    if yych <= 0x00 {
+        unsafe { goto yy10 }
+    }
+    unsafe { goto yy19 }
+yy12:
+    cursor += 1
+//line "codegen/v/class_switch.re":19
+    return 2
+//line "codegen/v/class_switch.v":137
+yy13:
+    cursor += 1
+    yych = str[cursor]
+yy14:
+    match yycc[yych] {
+        0 { unsafe { goto yy12 } }
+        2...3, 7, 9...22 { unsafe { goto yy13 } }
+        else { unsafe { goto yy10 } }
+    }
+yy15:
+    cursor += 1
+    yych = str[cursor]
+    match yycc[yych] {
+        17 { unsafe { goto yy16 } }
+        else { unsafe { goto yy14 } }
+    }
+yy16:
+    cursor += 1
+    yych = str[cursor]
+    if yych <= 0x00 {
+        unsafe { goto yy20 }
+    }
+    unsafe { goto yy14 }
+yy17:
+    cursor += 1
+    yych = str[cursor]
+    match yycc[yych] {
+        19 { unsafe { goto yy16 } }
+        else { unsafe { goto yy14 } }
+    }
+yy18:
+    cursor += 1
+    yych = str[cursor]
+yy19:
+    match yycc[yych] {
+        0 { unsafe { goto yy8 } }
+        2...3, 5, 9...10 { unsafe { goto yy18 } }
+        else { unsafe { goto yy10 } }
+    }
+yy20:
+    cursor += 1
+//line "codegen/v/class_switch.re":18
+    return 1
+//line "codegen/v/class_switch.v":181
+//line "codegen/v/class_switch.re":21
+
+}
+
+fn main() {
+    assert lex("if\x00") == 1
+    assert lex("integer\x00") == 2
+    assert lex("0x1F\x00") == 3
+    assert lex("0x\x00") == -1
+}
@@ -0,0 +1,62 @@
+/* Generated by re2c */
+#line 1 "conditions/condition_01_j4.re"
+// re2c $INPUT -o $OUTPUT -c -j4
+
+#line 6 "conditions/condition_01_j4.c"
+{
+	YYCTYPE yych;
+	switch (YYGETCONDITION()) {
+		case yyca: goto yyc_a;
+		case yycb: goto yyc_b;
+	}
+/* *********************************** */
+yyc_a:
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+		case 'a': goto yy2;
+		default: goto yy1;
+	}
+yy1:
+yy2:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'b': goto yy3;
+		default: goto yy1;
+	}
+yy3:
+	++YYCURSOR;
+#line 4 "conditions/condition_01_j4.re"
+	{ }
+#line 32 "conditions/condition_01_j4.c"
+/* *********************************** */
+yyc_b:
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+		case 'a': goto yy6;
+		default: goto yy5;
+	}
+yy5:
+yy6:
+	yych = *++YYCURSOR;
+	switch (yych) {
+		case 'b': goto yy7;
+		default: goto yy5;
+	}
+yy7:
+	++YYCURSOR;
+#line 4 "conditions/condition_01_j4.re"
+	{ }
+#line 52 "conditions/condition_01_j4.c"
+}
+#line 6 "conditions/condition_01_j4.re"
+
+conditions/condition_01_j4.re:2:0: warning: control flow in condition 'a' is undefined for strings that match 
+	'[\x0-\x60\x62-\xFF]'
+	'\x61 [\x0-\x61\x63-\xFF]'
+, use default rule '*' [-Wundefined-control-flow]
+conditions/condition_01_j4.re:2:0: warning: control flow in condition 'b' is undefined for strings that match 
+	'[\x0-\x60\x62-\xFF]'
+	'\x61 [\x0-\x61\x63-\xFF]'
+, use default rule '*' [-Wundefined-control-flow]
@@ -1 +1 @@
-re2c: error: bad argument 'xxx' to option --dfa-minimization (expected <table | moore>)
+re2c: error: bad argument 'xxx' to option --dfa-minimization (expected <table | moore | hopcroft>)